@@ -37,6 +37,12 @@
 /* Define to 1 if you have the <sys/times.h> header file. */
 #cmakedefine HAVE_SYS_TIMES_H 1
 
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#cmakedefine HAVE_SYS_MMAN_H 1
+
+/* Define to 1 if you have the `fsync' function. */
+#cmakedefine HAVE_FSYNC 1
+
 /* Define to 1 if you have the `cfmakeraw' function. */
 #cmakedefine HAVE_CFMAKERAW 1
 
@@ -49,6 +55,9 @@
 /* Define to 1 if you have unix domain sockets */
 #cmakedefine HAVE_UNIX_DOMAIN_SOCKETS 1
 
+/* Define to 1 if you have TCP/IP sockets */
+#cmakedefine HAVE_TCP_SOCKETS 1
+
 /* Define to 1 if you have the 'posix_memalign' function. */
 #cmakedefine HAVE_POSIX_MEMALIGN 1
 
@@ -96,3 +105,6 @@
 
 /* Define to 1 to enable trace logs - undefine to slightly increase speed */
 #cmakedefine ENABLE_TRACING 1
+
+/* Define to 1 to enable host time counters for emulation subsystems (slight slowdown) */
+#cmakedefine ENABLE_PERFCOUNT 1
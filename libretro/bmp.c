@@ -8,7 +8,8 @@
 #include "main.h"
 #include "screen.h"
 
-extern unsigned char savbkg[1024*1024*2];
+extern unsigned char *savbkg;
+extern int PIXEL_BYTES;
 
 typedef struct                       /**** BMP file header structure ****/
 {
@@ -209,15 +210,26 @@ int SDL_SaveBMP(SDL_Surface *surface,const char *file){
 
    for (i = 0; i < retrow * retroh; i++)
    {
-      temp = (unsigned short  int) (*ptr)&0xffff;
+      if (PIXEL_BYTES == 4)
+      {
+         unsigned int xrgb = ((unsigned int *)savbkg)[i];
+
+         R8 = (xrgb >> 16) & 0xff;
+         G8 = (xrgb >> 8) & 0xff;
+         B8 = xrgb & 0xff;
+      }
+      else
+      {
+         temp = (unsigned short  int) (*ptr)&0xffff;
 
 #define R5 ((temp>>11)&0x1F)
 #define G6 ((temp>>5 )&0x3F)
 #define B5 ((temp    )&0x1F)
 
-      R8 = ( R5 * 527 + 23 ) >> 6;
-      G8 = ( G6 * 259 + 33 ) >> 6;
-      B8 = ( B5 * 527 + 23 ) >> 6;
+         R8 = ( R5 * 527 + 23 ) >> 6;
+         G8 = ( G6 * 259 + 33 ) >> 6;
+         B8 = ( B5 * 527 + 23 ) >> 6;
+      }
 
       ptr++; 
 
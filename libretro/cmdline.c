@@ -1,4 +1,5 @@
 #include <ctype.h>
+#include <stdio.h>
 
 //Args for experimental_cmdline
 static char ARGUV[64][1024];
@@ -14,7 +15,23 @@ void parse_cmdline( const char *argv );
 
 // Global variables
 extern bool hatari_borders;
+extern bool hatari_native_res;
 extern char hatari_frameskips[2];
+extern bool hatari_fast_timing;
+extern bool hatari_auto_prefetch;
+extern bool hatari_cpu_turbo;
+extern bool hatari_batch_hbl;
+extern bool hatari_deterministic;
+extern bool hatari_ym_hq;
+extern bool hatari_crossbar_batch;
+extern bool hatari_microphone;
+extern char hatari_dsp_skew[5];
+extern bool hatari_turbo_fdc;
+extern bool hatari_floppy_hle;
+extern bool hatari_turbo_boot;
+extern bool hatari_boot_snapshot;
+extern int hatari_audio_rate;
+extern char hatari_gdb_port[6];
 
 void Add_Option(const char* option)
 {
@@ -51,8 +68,51 @@ int pre_main(const char *argv)
       Add_Option("0");
       Add_Option("--borders");
       Add_Option(hatari_borders==true?"1":"0");
+      Add_Option("--native-res");
+      Add_Option(hatari_native_res==true?"1":"0");
       Add_Option("--frameskips");
       Add_Option(hatari_frameskips);
+      Add_Option("--fast-timing");
+      Add_Option(hatari_fast_timing==true?"1":"0");
+      Add_Option("--auto-prefetch");
+      Add_Option(hatari_auto_prefetch==true?"1":"0");
+      Add_Option("--cpu-turbo");
+      Add_Option(hatari_cpu_turbo==true?"1":"0");
+      Add_Option("--batch-hbl");
+      Add_Option(hatari_batch_hbl==true?"1":"0");
+      Add_Option("--deterministic");
+      Add_Option(hatari_deterministic==true?"1":"0");
+      Add_Option("--turbo-fdc");
+      Add_Option(hatari_turbo_fdc==true?"1":"0");
+      Add_Option("--floppy-hle");
+      Add_Option(hatari_floppy_hle==true?"1":"0");
+      Add_Option("--turbo-boot");
+      Add_Option(hatari_turbo_boot==true?"1":"0");
+      Add_Option("--boot-snapshot");
+      Add_Option(hatari_boot_snapshot==true?"1":"0");
+      Add_Option("--ym-hq");
+      Add_Option(hatari_ym_hq==true?"1":"0");
+      Add_Option("--crossbar-batch");
+      Add_Option(hatari_crossbar_batch==true?"1":"0");
+      Add_Option("--mic");
+      Add_Option(hatari_microphone==true?"1":"0");
+      if (hatari_dsp_skew[0])
+      {
+         Add_Option("--dsp-skew");
+         Add_Option(hatari_dsp_skew);
+      }
+      if (hatari_audio_rate)
+      {
+         static char rate[8];
+         snprintf(rate, sizeof(rate), "%d", hatari_audio_rate);
+         Add_Option("--sound");
+         Add_Option(rate);
+      }
+      if (hatari_gdb_port[0] && strcmp(hatari_gdb_port, "0") != 0)
+      {
+         Add_Option("--gdb-port");
+         Add_Option(hatari_gdb_port);
+      }
       Add_Option("--disk-a");
       Add_Option(RPATH/*ARGUV[0]*/);
    }
@@ -2,75 +2,113 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <math.h>
+#include <string.h>
 
 #include "graph.h"
 
-void DrawPointBmp(unsigned short *buffer,int x, int y, unsigned short color)
+// Colors are always given as RGB565, expand them when the frontend uses XRGB8888
+static inline void put_pixel(unsigned short *buffer,int idx,unsigned short color)
 {
-   int idx;
+   if (PIXEL_BYTES == 4)
+   {
+      unsigned int r = (color >> 11) & 0x1f;
+      unsigned int g = (color >> 6) & 0x1f;
+      unsigned int b = color & 0x1f;
 
-   idx=x+y*VIRTUAL_WIDTH;
-   buffer[idx]=color;	
+      ((unsigned int *)buffer)[idx] = ((r << 3 | r >> 2) << 16)
+                                    | ((g << 3 | g >> 2) << 8)
+                                    | (b << 3 | b >> 2);
+   }
+   else
+      buffer[idx]=color;
 }
 
-void DrawFBoxBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short color)
+static inline unsigned int expand_color(unsigned short color)
 {
-   int i,j,idx;
+   unsigned int r = (color >> 11) & 0x1f;
+   unsigned int g = (color >> 6) & 0x1f;
+   unsigned int b = color & 0x1f;
 
-   for(i=x;i<x+dx;i++)
+   return ((r << 3 | r >> 2) << 16) | ((g << 3 | g >> 2) << 8) | (b << 3 | b >> 2);
+}
+
+// Fill n pixels starting from idx, color is already in output format
+static inline void fill_span(unsigned short *buffer,int idx,int n,unsigned int color)
+{
+   if (PIXEL_BYTES == 4)
    {
-      for(j=y;j<y+dy;j++)
-      {
-         idx=i+j*VIRTUAL_WIDTH;
-         buffer[idx]=color;	
-      }
+      unsigned int *dst = (unsigned int *)buffer + idx;
+      while (n-- > 0)
+         *dst++ = color;
+   }
+   else if ((color & 0xff) == (color >> 8))
+      memset(buffer + idx, color & 0xff, (size_t)n * 2);
+   else
+   {
+      unsigned short *dst = buffer + idx;
+      while (n-- > 0)
+         *dst++ = color;
    }
-
 }
 
-void DrawBoxBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short  color)
+// Clip given area to the output, return false if nothing is left of it
+static bool clip_area(int *x,int *y,int *dx,int *dy)
 {
-   int i,j,idx;
-
-   for(i=x;i<x+dx;i++)
+   if (*x < 0)
    {
-      idx=i+y*VIRTUAL_WIDTH;
-      buffer[idx]=color;
-      idx=i+(y+dy)*VIRTUAL_WIDTH;
-      buffer[idx]=color;
+      *dx += *x;
+      *x = 0;
    }
-
-   for(j=y;j<y+dy;j++)
+   if (*y < 0)
    {
-      idx=x+j*VIRTUAL_WIDTH;
-      buffer[idx]=color;	
-      idx=(x+dx)+j*VIRTUAL_WIDTH;
-      buffer[idx]=color;	
+      *dy += *y;
+      *y = 0;
    }
+   if (*x + *dx > VIRTUAL_WIDTH)
+      *dx = VIRTUAL_WIDTH - *x;
+   if (*y + *dy > retroh)
+      *dy = retroh - *y;
+   return *dx > 0 && *dy > 0;
+}
 
+void DrawPointBmp(unsigned short *buffer,int x, int y, unsigned short color)
+{
+   if (x < 0 || y < 0 || x >= VIRTUAL_WIDTH || y >= retroh)
+      return;
+   put_pixel(buffer,x+y*VIRTUAL_WIDTH,color);
+}
+
+void DrawFBoxBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short color)
+{
+   unsigned int col;
+   int j,idx;
+
+   if (!clip_area(&x,&y,&dx,&dy))
+      return;
+
+   col = (PIXEL_BYTES == 4) ? expand_color(color) : color;
+   idx = x+y*VIRTUAL_WIDTH;
+   for(j=0;j<dy;j++,idx+=VIRTUAL_WIDTH)
+      fill_span(buffer,idx,dx,col);
+}
+
+void DrawBoxBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short  color)
+{
+   DrawHlineBmp(buffer,x,y,dx,0,color);
+   DrawHlineBmp(buffer,x,y+dy,dx,0,color);
+   DrawVlineBmp(buffer,x,y,0,dy,color);
+   DrawVlineBmp(buffer,x+dx,y,0,dy,color);
 }
 
 
 void DrawHlineBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short  color)
 {
-	int i,j,idx;
-		
-	for(i=x;i<x+dx;i++)
-   {
-		idx=i+y*VIRTUAL_WIDTH;
-		buffer[idx]=color;		
-	}
+   DrawFBoxBmp(buffer,x,y,dx,1,color);
 }
 
 void DrawVlineBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short  color)
 {
-	int i,j,idx;
-
-	for(j=y;j<y+dy;j++)
-   {
-		idx=x+j*VIRTUAL_WIDTH;
-		buffer[idx]=color;		
-	}	
+   DrawFBoxBmp(buffer,x,y,1,dy,color);
 }
 
 void DrawlineBmp(unsigned short *buffer,int x1,int y1,int x2,int y2,unsigned short color)
@@ -91,7 +129,7 @@ void DrawlineBmp(unsigned short *buffer,int x1,int y1,int x2,int y2,unsigned sho
       else
       {
          idx=x1+y1*VIRTUAL_WIDTH;
-         buffer[idx]=color;
+         put_pixel(buffer,idx,color);
       }
       return;
    }
@@ -131,7 +169,7 @@ void DrawlineBmp(unsigned short *buffer,int x1,int y1,int x2,int y2,unsigned sho
 
    for (; x < dx; x++, idx +=pixx)
    {
-      buffer[idx]=color;
+      put_pixel(buffer,idx,color);
       y += dy;
       if (y >= dx)
       {
@@ -158,63 +196,92 @@ void DrawCircle(unsigned short *buf,int x, int y, int radius,unsigned short rgba
       if (full)
          DrawlineBmp(buf,x,y, x1,y1,rgba); 
       else
-         buf[x1+y1*VIRTUAL_WIDTH]=rgba;
+         put_pixel(buf,x1+y1*VIRTUAL_WIDTH,rgba);
    }
 
 }
 
 #include "font2.c"
 
+// Glyph rows are blitted directly from the font bitmap, one output row
+// per glyph row & vertical repeat.  0-valued colors are transparent.
 void Draw_string(unsigned short *surf, signed short int x, signed short int y, 
       const unsigned char *string,unsigned short maxstrlen,unsigned short xscale,
       unsigned short yscale, unsigned short fg, unsigned short bg)
 {
-   int k,strlen, col, bit, xrepeat, yrepeat, surfw, surfh;
-   unsigned char *linesurf, b;
-   signed short int ypixel;
-   unsigned short *yptr; 
+   int strlen, col, bit, xrepeat, yrepeat, ypixel;
+   int x0, x1, y0, y1, px, py;
+   unsigned int fgc, bgc, c;
+   unsigned char b;
 
-   if(string == NULL)
+   if(string == NULL || xscale == 0 || yscale == 0)
       return;
    for(strlen = 0; strlen<maxstrlen && string[strlen]; strlen++) {}
 
-   surfw=strlen * 7 * xscale;
-   surfh=8 * yscale;
-
-   linesurf = (unsigned char*)malloc(sizeof(unsigned short)*surfw*surfh );
+   /* visible part of the string, in output coordinates */
+   x0 = x;
+   y0 = y;
+   x1 = strlen * 7 * xscale;
+   y1 = 8 * yscale;
+   if (!clip_area(&x0,&y0,&x1,&y1))
+      return;
+   x1 += x0;
+   y1 += y0;
 
-   yptr = (unsigned short *)&linesurf[0];
+   fgc = (PIXEL_BYTES == 4) ? expand_color(fg) : fg;
+   bgc = (PIXEL_BYTES == 4) ? expand_color(bg) : bg;
 
    for(ypixel = 0; ypixel<8; ypixel++)
    {
-      for(col=0; col<strlen; col++)
+      for(yrepeat = 0; yrepeat < yscale; yrepeat++)
       {
-         b = font_array[(string[col]^0x80)*8 + ypixel];
+         py = y + ypixel*yscale + yrepeat;
+         if (py < y0 || py >= y1)
+            continue;
 
-         for(bit=0; bit<7; bit++, yptr++)
+         px = x;
+         for(col=0; col<strlen; col++)
          {
-            *yptr = (b & (1<<(7-bit))) ? fg : bg;
-            for(xrepeat = 1; xrepeat < xscale; xrepeat++, yptr++)
-               yptr[1] = *yptr;
+            if (px >= x1)
+               break;
+            if (px + 7*xscale <= x0)
+            {
+               px += 7*xscale;
+               continue;
+            }
+            b = font_array[(string[col]^0x80)*8 + ypixel];
+
+            for(bit=0; bit<7; bit++, px += xscale)
+            {
+               if (b & (1<<(7-bit)))
+               {
+                  if (!fg)
+                     continue;
+                  c = fgc;
+               }
+               else
+               {
+                  if (!bg)
+                     continue;
+                  c = bgc;
+               }
+               for(xrepeat = 0; xrepeat < xscale; xrepeat++)
+               {
+                  int idx = px + xrepeat;
+                  if (idx < x0 || idx >= x1)
+                     continue;
+                  idx += py*VIRTUAL_WIDTH;
+                  if (PIXEL_BYTES == 4)
+                     ((unsigned int *)surf)[idx] = c;
+                  else
+                     surf[idx] = c;
+               }
+            }
          }
       }
-
-      for(yrepeat = 1; yrepeat < yscale; yrepeat++) 
-         for(xrepeat = 0; xrepeat<surfw; xrepeat++, yptr++)
-            *yptr = yptr[-surfw];
-
    }
-
-   yptr = (unsigned short*)&linesurf[0];
-
-   for(yrepeat = y; yrepeat < y+ surfh; yrepeat++) 
-      for(xrepeat = x; xrepeat< x+surfw; xrepeat++,yptr++)
-         if(*yptr!=0)surf[xrepeat+yrepeat*VIRTUAL_WIDTH] = *yptr;
-
-   free(linesurf);
 }
 
-
 void Draw_text(unsigned short *buffer,int x,int y,unsigned short fgcol,
       unsigned short int bgcol ,int scalex,int scaley , int max,char *string, ...)
 {
@@ -231,3 +298,66 @@ void Draw_text(unsigned short *buffer,int x,int y,unsigned short fgcol,
 
    Draw_string(buffer, x,y, (const unsigned char*)text,max, scalex, scaley,fgcol,bgcol);	
 }
+
+
+// Start (re-)rendering the overlay: returns the cleared buffer to draw
+// into with the usual functions, with y relative to the overlay top
+unsigned short *Overlay_Begin(overlay_t *ov, int x, int y, int w, int h, bool opaque)
+{
+   size_t size = (size_t)VIRTUAL_WIDTH * h * PIXEL_BYTES;
+
+   if (!ov->pixels || ov->width != VIRTUAL_WIDTH || ov->bytes != PIXEL_BYTES || ov->h != h)
+   {
+      free(ov->pixels);
+      ov->pixels = (unsigned char*)malloc(size);
+      if (!ov->pixels)
+         return NULL;
+   }
+   memset(ov->pixels, 0, size);
+
+   ov->x = x;
+   ov->y = y;
+   ov->w = w;
+   ov->h = h;
+   ov->width = VIRTUAL_WIDTH;
+   ov->bytes = PIXEL_BYTES;
+   ov->opaque = opaque;
+   return (unsigned short*)ov->pixels;
+}
+
+// Whether the rendered overlay is still usable for given area & output format
+bool Overlay_Valid(const overlay_t *ov, int x, int y, int w, int h)
+{
+   return ov->pixels && ov->width == VIRTUAL_WIDTH && ov->bytes == PIXEL_BYTES
+      && ov->x == x && ov->y == y && ov->w == w && ov->h == h;
+}
+
+void Overlay_Blend(const overlay_t *ov, unsigned short *buffer)
+{
+   int i, j;
+
+   if (!Overlay_Valid(ov, ov->x, ov->y, ov->w, ov->h))
+      return;
+
+   for (j = 0; j < ov->h; j++)
+   {
+      size_t offset = ((size_t)j * ov->width + ov->x) * ov->bytes;
+      unsigned char *dst = (unsigned char*)buffer + (size_t)ov->y * ov->width * ov->bytes + offset;
+      const unsigned char *src = ov->pixels + offset;
+
+      if (ov->opaque)
+         memcpy(dst, src, (size_t)ov->w * ov->bytes);
+      else if (ov->bytes == 4)
+      {
+         for (i = 0; i < ov->w; i++)
+            if (((const unsigned int*)src)[i])
+               ((unsigned int*)dst)[i] = ((const unsigned int*)src)[i];
+      }
+      else
+      {
+         for (i = 0; i < ov->w; i++)
+            if (((const unsigned short*)src)[i])
+               ((unsigned short*)dst)[i] = ((const unsigned short*)src)[i];
+      }
+   }
+}
@@ -1,8 +1,26 @@
 #ifndef GRAPH_H
 #define GRAPH_H 1
 
+#include <stdbool.h>
 #include "retroscreen.h"
 
+// Pre-rendered overlay (virtual keyboard, status bar) over output rows
+// y..y+h-1, blended into columns x..x+w-1 of the output on each frame.
+// Zero pixels are transparent, unless the overlay is opaque.
+typedef struct
+{
+   unsigned char *pixels;
+   int x, y, w, h;
+   int width, bytes;    // VIRTUAL_WIDTH & PIXEL_BYTES it was rendered for
+   bool opaque;
+} overlay_t;
+
+extern unsigned short *Overlay_Begin(overlay_t *ov, int x, int y, int w, int h, bool opaque);
+
+extern bool Overlay_Valid(const overlay_t *ov, int x, int y, int w, int h);
+
+extern void Overlay_Blend(const overlay_t *ov, unsigned short *buffer);
+
 extern void DrawFBoxBmp(unsigned  short  *buffer,int x,int y,int dx,int dy,unsigned  short color);
 
 extern void DrawBoxBmp(unsigned  short  *buffer,int x,int y,int dx,int dy,unsigned  short  color);
@@ -11,6 +11,9 @@ const char DlgFileSelect_fileid[] = "Hatari dlgFileSelect.c : " __DATE__ " " __T
 #include <SDL.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#ifdef HAVE_THREADS
+#include <rthreads/rthreads.h>
+#endif
 
 #include "main.h"
 #include "scandir.h"
@@ -22,6 +25,8 @@ const char DlgFileSelect_fileid[] = "Hatari dlgFileSelect.c : " __DATE__ " " __T
 #include "gui-retro.h"
 
 #define SGFS_NUMENTRIES   16            /* How many entries are displayed at once */
+#define DIRCACHE_SIZE      4            /* How many folder listings are remembered */
+#define DIRSCAN_CHUNK     64            /* How many entries are read at a time */
 
 
 #define SGFSDLG_FILENAME    5
@@ -105,6 +110,39 @@ static float scrollbar_Ypos = 0.0;		/* scrollbar heigth */
 /* Convert file position (in file list) to scrollbar y position */
 static void DlgFileSelect_Convert_ypos_to_scrollbar_Ypos(void);
 
+/* Sorted listings (with hidden files) of the last shown folders,
+ * used again as long as the folder modification time is the same */
+typedef struct {
+	char *path;			/* NULL if slot is unused */
+	time_t mtime;
+	struct dirent **files;
+	int count;
+	unsigned int lastuse;
+} dircache_t;
+
+static dircache_t dircache[DIRCACHE_SIZE];
+static unsigned int dircache_uses;
+
+/* Folder being read. With thread support, a reader thread adds the
+ * entries to the list, otherwise they are read a chunk at a time from
+ * the dialog loop. The dialog merges new entries to its list as they come.
+ */
+static struct {
+	DIR *dir;			/* NULL if no folder is being read */
+	char *path;
+	time_t mtime;			/* folder state when reading started */
+	struct dirent **files;		/* entries in readdir() order */
+	int count;
+	int alloc;
+	int taken;			/* entries already merged to the dialog list */
+	bool done;
+#ifdef HAVE_THREADS
+	sthread_t *thread;
+	slock_t *lock;
+	bool quit;
+#endif
+} dirscan;
+
 
 
 /*-----------------------------------------------------------------------*/
@@ -396,6 +434,354 @@ static struct dirent **files_free(struct dirent **files)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Allocate a file entry with the given name (only d_name is used here)
+ */
+static struct dirent *DlgFileSelect_NewEntry(const char *name)
+{
+	struct dirent *entry = calloc(1, sizeof(struct dirent));
+
+	if (entry)
+		strncpy(entry->d_name, name, sizeof(entry->d_name) - 1);
+	return entry;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * qsort() wrapper for alphasort()
+ */
+static int DlgFileSelect_CompareEntries(const void *p1, const void *p2)
+{
+	const struct dirent *d1 = *(const struct dirent * const *)p1;
+	const struct dirent *d2 = *(const struct dirent * const *)p2;
+
+	return alphasort(&d1, &d2);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Sort the new entries and merge them into the sorted file list,
+ * so that the whole list doesn't need to be sorted again.
+ * The batch array is freed, the entries are moved to the list.
+ */
+static struct dirent **DlgFileSelect_MergeEntries(struct dirent **files,
+                                                  struct dirent **batch, int count)
+{
+	struct dirent **merged;
+	int i, j, k;
+
+	if (count > 0)
+	{
+		qsort(batch, count, sizeof(*batch), DlgFileSelect_CompareEntries);
+		merged = realloc(files, (entries + count) * sizeof(*files));
+		if (!merged)
+		{
+			perror("DlgFileSelect_MergeEntries");
+			while (count > 0)
+				free(batch[--count]);
+			free(batch);
+			return files;
+		}
+		/* Merge from the end, then no temporary list is needed */
+		i = entries - 1;
+		j = count - 1;
+		k = entries + count - 1;
+		while (j >= 0)
+		{
+			if (i >= 0 && DlgFileSelect_CompareEntries(&merged[i], &batch[j]) > 0)
+				merged[k--] = merged[i--];
+			else
+				merged[k--] = batch[j--];
+		}
+		files = merged;
+		entries += count;
+	}
+	free(batch);
+	return files;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy the cached listing of the given folder to a new file list,
+ * if the folder hasn't changed since. Returns NULL if not cached.
+ */
+static struct dirent **DlgFileSelect_CacheGet(const char *path, time_t mtime, bool showhidden)
+{
+	struct dirent **files;
+	dircache_t *cache = NULL;
+	int i;
+
+	for (i = 0; i < DIRCACHE_SIZE; i++)
+	{
+		if (dircache[i].path && dircache[i].mtime == mtime
+		    && strcmp(dircache[i].path, path) == 0)
+		{
+			cache = &dircache[i];
+			break;
+		}
+	}
+	if (!cache)
+		return NULL;
+
+	files = malloc((cache->count + 1) * sizeof(*files));
+	if (!files)
+		return NULL;
+	entries = 0;
+	for (i = 0; i < cache->count; i++)
+	{
+		if (!showhidden && cache->files[i]->d_name[0] == '.')
+			continue;
+		files[entries] = DlgFileSelect_NewEntry(cache->files[i]->d_name);
+		if (!files[entries])
+			break;
+		entries += 1;
+	}
+	cache->lastuse = ++dircache_uses;
+	return files;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Remember the complete listing of a folder, the list is
+ * owned by the cache afterwards.
+ */
+static void DlgFileSelect_CachePut(const char *path, time_t mtime,
+                                   struct dirent **files, int count)
+{
+	dircache_t *cache = &dircache[0];
+	int i;
+
+	qsort(files, count, sizeof(*files), DlgFileSelect_CompareEntries);
+
+	/* Replace the old listing of same folder, or the least recently used one */
+	for (i = 0; i < DIRCACHE_SIZE; i++)
+	{
+		if (!dircache[i].path || strcmp(dircache[i].path, path) == 0)
+		{
+			cache = &dircache[i];
+			break;
+		}
+		if (dircache[i].lastuse < cache->lastuse)
+			cache = &dircache[i];
+	}
+	if (cache->path)
+	{
+		for (i = 0; i < cache->count; i++)
+			free(cache->files[i]);
+		free(cache->files);
+		free(cache->path);
+	}
+	cache->path = strdup(path);
+	cache->mtime = mtime;
+	cache->files = files;
+	cache->count = count;
+	cache->lastuse = ++dircache_uses;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Lock/unlock the folder reading state shared with the reader thread
+ */
+static void DlgFileSelect_ScanLock(void)
+{
+#ifdef HAVE_THREADS
+	if (dirscan.lock)
+		slock_lock(dirscan.lock);
+#endif
+}
+
+static void DlgFileSelect_ScanUnlock(void)
+{
+#ifdef HAVE_THREADS
+	if (dirscan.lock)
+		slock_unlock(dirscan.lock);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read next (at most DIRSCAN_CHUNK) folder entries to the scan list.
+ * Returns false when the whole folder has been read (or reading
+ * was cancelled), true otherwise.
+ */
+static bool DlgFileSelect_ScanRead(void)
+{
+	struct dirent *entry, *copy, **list;
+	bool more = true;
+	int i;
+
+	for (i = 0; i < DIRSCAN_CHUNK && more; i++)
+	{
+		entry = readdir(dirscan.dir);
+		if (!entry)
+			return false;
+		copy = DlgFileSelect_NewEntry(entry->d_name);
+		if (!copy)
+			return false;
+
+		DlgFileSelect_ScanLock();
+		if (dirscan.count == dirscan.alloc)
+		{
+			list = realloc(dirscan.files, (2 * dirscan.alloc + 64) * sizeof(*list));
+			if (list)
+			{
+				dirscan.files = list;
+				dirscan.alloc = 2 * dirscan.alloc + 64;
+			}
+		}
+		if (dirscan.count < dirscan.alloc)
+			dirscan.files[dirscan.count++] = copy;
+		else
+		{
+			free(copy);
+			more = false;
+		}
+#ifdef HAVE_THREADS
+		if (dirscan.quit)
+			more = false;
+#endif
+		DlgFileSelect_ScanUnlock();
+	}
+	return more;
+}
+
+
+#ifdef HAVE_THREADS
+/*-----------------------------------------------------------------------*/
+/**
+ * Reader thread: read the whole folder, or until reading is cancelled
+ */
+static void DlgFileSelect_ScanThread(void *data)
+{
+	while (DlgFileSelect_ScanRead())
+		;
+	slock_lock(dirscan.lock);
+	dirscan.done = true;
+	slock_unlock(dirscan.lock);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop reading the folder and free the read entries
+ */
+static void DlgFileSelect_ScanStop(void)
+{
+	int i;
+
+	if (!dirscan.dir)
+		return;
+#ifdef HAVE_THREADS
+	if (dirscan.thread)
+	{
+		slock_lock(dirscan.lock);
+		dirscan.quit = true;
+		slock_unlock(dirscan.lock);
+		sthread_join(dirscan.thread);
+	}
+	if (dirscan.lock)
+		slock_free(dirscan.lock);
+#endif
+	closedir(dirscan.dir);
+	for (i = 0; i < dirscan.count; i++)
+		free(dirscan.files[i]);
+	free(dirscan.files);
+	free(dirscan.path);
+	memset(&dirscan, 0, sizeof(dirscan));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start reading the given folder. Returns false if it can't be opened.
+ */
+static bool DlgFileSelect_ScanStart(const char *path, time_t mtime)
+{
+	DlgFileSelect_ScanStop();
+
+	dirscan.dir = opendir(path);
+	if (!dirscan.dir)
+		return false;
+	dirscan.path = strdup(path);
+	dirscan.mtime = mtime;
+#ifdef HAVE_THREADS
+	dirscan.lock = slock_new();
+	if (dirscan.lock)
+		dirscan.thread = sthread_create(DlgFileSelect_ScanThread, NULL);
+#endif
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Merge the entries read since last call into the sorted file list.
+ * When the whole folder has been read, its listing is cached and
+ * the reading is stopped. Returns the updated file list.
+ */
+static struct dirent **DlgFileSelect_ScanPoll(struct dirent **files, bool showhidden)
+{
+	struct dirent **batch;
+	int i, count = 0;
+	bool done;
+
+	if (!dirscan.dir)
+		return files;
+#ifdef HAVE_THREADS
+	if (!dirscan.thread)
+#endif
+	{
+		if (!DlgFileSelect_ScanRead())
+			dirscan.done = true;
+	}
+
+	DlgFileSelect_ScanLock();
+	batch = malloc((dirscan.count - dirscan.taken + 1) * sizeof(*batch));
+	if (batch)
+	{
+		for (i = dirscan.taken; i < dirscan.count; i++)
+		{
+			if (!showhidden && dirscan.files[i]->d_name[0] == '.')
+				continue;
+			batch[count] = DlgFileSelect_NewEntry(dirscan.files[i]->d_name);
+			if (batch[count])
+				count += 1;
+		}
+		dirscan.taken = dirscan.count;
+	}
+	done = dirscan.done;
+	DlgFileSelect_ScanUnlock();
+
+	if (batch)
+	{
+		if (count)
+			refreshentries = true;
+		files = DlgFileSelect_MergeEntries(files, batch, count);
+	}
+
+	if (done)
+	{
+		if (dirscan.path)
+		{
+			DlgFileSelect_CachePut(dirscan.path, dirscan.mtime,
+			                       dirscan.files, dirscan.count);
+			dirscan.files = NULL;
+			dirscan.count = 0;
+		}
+		DlgFileSelect_ScanStop();
+	}
+	return files;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Copy to dst src+add if they are below maxlen and return true,
@@ -557,12 +943,21 @@ char* SDLGui_FileSelect(const char *title,const char *path_and_name, char **zip_
 			}
 			else
 			{
-				/* Load directory entries: */
-				entries = scandir(path, &files, 0, alphasort);
+				/* Use cached directory entries, or start reading them */
+				struct stat dirstat;
+				bool showhidden = fsdlg[SGFSDLG_SHOWHIDDEN].state & SG_SELECTED;
+
+				DlgFileSelect_ScanStop();
+				entries = 0;
+				if (stat(path, &dirstat) != 0)
+					entries = -1;
+				else if (!(files = DlgFileSelect_CacheGet(path, dirstat.st_mtime, showhidden))
+				         && !DlgFileSelect_ScanStart(path, dirstat.st_mtime))
+					entries = -1;
 			}
-			
+
 			/* Remove hidden files from the list if necessary: */
-			if (!(fsdlg[SGFSDLG_SHOWHIDDEN].state & SG_SELECTED))
+			if (browsingzip && !(fsdlg[SGFSDLG_SHOWHIDDEN].state & SG_SELECTED))
 			{
 				DlgFileSelect_RemoveHiddenFiles(files);
 			}
@@ -578,6 +973,17 @@ char* SDLGui_FileSelect(const char *title,const char *path_and_name, char **zip_
 			refreshentries = true;
 		}/* reloaddir */
 
+		/* Show the entries read so far of a large or slow folder */
+		if (dirscan.dir)
+		{
+			int oldentries = entries;
+			files = DlgFileSelect_ScanPoll(files, fsdlg[SGFSDLG_SHOWHIDDEN].state & SG_SELECTED);
+			/* Keep the shown position while the list grows */
+			if (entries != oldentries)
+				DlgFileSelect_Convert_ypos_to_scrollbar_Ypos();
+			fsdlg[1].txt = dirscan.dir ? "Reading..." : "Choose a file";
+		}
+
 		/* Refresh scrollbar size */
  		if (entries <= SGFS_NUMENTRIES)
 			yScrollbar_size = (SGFS_NUMENTRIES-2) * sdlgui_fontheight;
@@ -835,6 +1241,7 @@ char* SDLGui_FileSelect(const char *title,const char *path_and_name, char **zip_
 	while (retbut!=SGFSDLG_OKAY && retbut!=SGFSDLG_CANCEL
 	       && retbut!=SDLGUI_QUIT && retbut != SDLGUI_ERROR && !bQuitProgram);
 
+	DlgFileSelect_ScanStop();
 	files_free(files);
 
 	if (browsingzip)
@@ -853,6 +1260,8 @@ char* SDLGui_FileSelect(const char *title,const char *path_and_name, char **zip_
 	else
 		retpath = NULL;
 clean_exit:
+	DlgFileSelect_ScanStop();
+	fsdlg[1].txt = "Choose a file";
 	SDL_ShowCursor(bOldMouseVisibility);
 	free(pStringMem);
 	return retpath;
@@ -23,7 +23,8 @@ extern int touch;
 int gmx,gmy;
 int okold=0,boutc=0;
 
-extern unsigned short int bmp[1024*1024];
+extern unsigned short int *bmp;
+extern void texture_clear(void);
 #define B ((rgba>> 8)&0xff)>>3 
 #define G ((rgba>>16)&0xff)>>3
 #define R ((rgba>>24)&0xff)>>3
@@ -226,7 +227,7 @@ int SDLGui_SetScreen(SDL_Surface *pScrn)
 	return 0;
 #else
 	pSdlGuiScrn = pScrn;
-	memset(bmp, 0, sizeof(bmp));
+	texture_clear();
 
 	sdlgui_fontwidth  = 10;
 	sdlgui_fontheight = 16;
@@ -664,7 +665,7 @@ void SDLGui_DrawDialog(const SGOBJ *dlg)
 {
 	int i;
 
-	memset(bmp, 0, sizeof(bmp));
+	texture_clear();
 
 	for (i = 0; dlg[i].type != -1; i++)
 	{
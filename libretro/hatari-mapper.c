@@ -5,6 +5,7 @@
 #include "joy.h"
 #include "screen.h"
 #include "video.h"	/* FIXME: video.h is dependent on HBL_PALETTE_LINES from screen.h */
+#include "cycInt.h"
 
 //CORE VAR
 extern const char *retro_save_directory;
@@ -15,6 +16,7 @@ char RETRO_TOS[512];
 
 //HATARI PROTOTYPES
 #include "configuration.h"
+#include "inputMovie.h"
 #include "file.h"
 extern bool Dialog_DoProperty(void);
 extern void Screen_SetFullUpdate(void);
@@ -39,8 +41,9 @@ static unsigned long Ktime=0, LastFPSTime=0;
 
 //VIDEO
 extern SDL_Surface *sdlscrn; 
-unsigned short int bmp[1024*1024];
-unsigned char savbkg[1024*1024* 2];
+unsigned short int *bmp = NULL;
+unsigned char *savbkg = NULL;
+static size_t bmp_size = 0;
 
 //SOUND
 short signed int SNDBUF[1024*2];
@@ -55,6 +58,7 @@ int SHIFTON=-1,MOUSEMODE=-1,NUMJOY=0,SHOWKEY=-1,PAS=4,STATUTON=-1;
 int SND; //SOUND ON/OFF
 static int firstps=0;
 int pauseg=0; //enter_gui
+bool rewind_held=false; //step back in rewind buffer
 
 //JOY
 int al[2];//left analog1
@@ -71,7 +75,12 @@ extern int gmx,gmy; //gui mouse
 char Key_Sate[512];
 char Key_Sate2[512];
 
-static int mbt[16]={0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+//JOYPAD buttons, as (1 << RETRO_DEVICE_ID_JOYPAD_*) bits
+bool libretro_supports_bitmasks = false;
+static unsigned joypad_cur, joypad_prev, joypad_seen;
+
+#define JOYPAD_PRESSED(id)  (joypad_cur & (1u << (id)))
+#define JOYPAD_RELEASED(id) (joypad_prev & ~joypad_cur & (1u << (id)))
 
 //STATS GUI
 extern int LEDA,LEDB,LEDC;
@@ -91,6 +100,30 @@ void retro_set_input_poll(retro_input_poll_t cb)
    input_poll_cb = cb;
 }
 
+// Poll the frontend and read the whole joypad state,
+// button toggles act on the release edges between polls.
+// Late polls within the frame only update the current state,
+// buttons they saw are still released on the next full poll
+static void poll_input(bool late)
+{
+   int i;
+
+   input_poll_cb();
+
+   if (!late)
+      joypad_prev = joypad_seen;
+   if (libretro_supports_bitmasks)
+      joypad_cur = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_MASK);
+   else
+   {
+      joypad_cur = 0;
+      for (i = 0; i <= RETRO_DEVICE_ID_JOYPAD_R3; i++)
+         if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i))
+            joypad_cur |= 1u << i;
+   }
+   joypad_seen = late ? (joypad_seen | joypad_cur) : joypad_cur;
+}
+
 long GetTicks(void)
 { // in MSec
 #ifndef _ANDROID_
@@ -166,7 +199,7 @@ void save_bkg(void)
 
    for(j=0;j<retroh;j++)
    {
-      for(i=0;i<retrow*2;i++)
+      for(i=0;i<retrow*PIXEL_BYTES;i++)
       {
          savbkg[k]=*ptr;
          ptr++;
@@ -177,6 +210,10 @@ void save_bkg(void)
 
 void retro_fillrect(SDL_Surface * surf,SDL_Rect *rect,unsigned int col)
 {
+   // Drawing helpers take RGB565, fold SDL_MapRGB() XRGB8888 colors back
+   if (surf && surf->format->BytesPerPixel == 4)
+      col = RGB565((col >> 19) & 0x1f, (col >> 11) & 0x1f, (col >> 3) & 0x1f);
+
    DrawFBoxBmp(bmp,rect->x,rect->y,rect->w ,rect->h,col); 
 }
 
@@ -187,6 +224,55 @@ int  GuiGetMouseState( int * x,int * y)
    return 0;
 }
 
+// Frame buffer follows the configured output size, it only ever grows
+static bool texture_alloc(void)
+{
+   size_t size = (size_t)retrow * retroh * PIXEL_BYTES;
+   void *buf;
+
+   if (size <= bmp_size)
+      return true;
+
+   buf = realloc(bmp, size);
+   if (buf == NULL)
+   {
+      printf("frame buffer alloc failed");
+      return false;
+   }
+   bmp = buf;
+
+   buf = realloc(savbkg, size);
+   if (buf == NULL)
+   {
+      printf("background buffer alloc failed");
+      return false;
+   }
+   savbkg = buf;
+
+   memset(bmp, 0, size);
+   bmp_size = size;
+
+   if (sdlscrn)
+      sdlscrn->pixels = (unsigned char *)bmp;
+
+   return true;
+}
+
+void texture_clear(void)
+{
+   if (bmp)
+      memset(bmp, 0, bmp_size);
+}
+
+void texture_free(void)
+{
+   free(bmp);
+   free(savbkg);
+   bmp = NULL;
+   savbkg = NULL;
+   bmp_size = 0;
+}
+
 void texture_uninit(void)
 {
    if(sdlscrn)
@@ -195,6 +281,7 @@ void texture_uninit(void)
          free(sdlscrn->format);
 
       free(sdlscrn);
+      sdlscrn = NULL;
    }
 }
 
@@ -205,6 +292,9 @@ SDL_Surface *prepare_texture(int w,int h,int b)
    if(sdlscrn)
       texture_uninit();
 
+   if (!texture_alloc())
+      return NULL;
+
    bitmp = (SDL_Surface *) calloc(1, sizeof(*bitmp));
    if (bitmp == NULL)
    {
@@ -219,20 +309,41 @@ SDL_Surface *prepare_texture(int w,int h,int b)
       return NULL;
    }
 
-   bitmp->format->BitsPerPixel = 16;
-   bitmp->format->BytesPerPixel = 2;
-   bitmp->format->Rloss=3;
-   bitmp->format->Gloss=3;
-   bitmp->format->Bloss=3;
-   bitmp->format->Aloss=0;
-   bitmp->format->Rshift=11;
-   bitmp->format->Gshift=6;
-   bitmp->format->Bshift=0;
-   bitmp->format->Ashift=0;
-   bitmp->format->Rmask=0x0000F800;
-   bitmp->format->Gmask=0x000007E0;
-   bitmp->format->Bmask=0x0000001F;
-   bitmp->format->Amask=0x00000000;
+   // The requested depth is ignored, the frontend pixel format decides
+   if (PIXEL_BYTES == 4)
+   {
+      bitmp->format->BitsPerPixel = 32;
+      bitmp->format->BytesPerPixel = 4;
+      bitmp->format->Rloss=0;
+      bitmp->format->Gloss=0;
+      bitmp->format->Bloss=0;
+      bitmp->format->Aloss=8;
+      bitmp->format->Rshift=16;
+      bitmp->format->Gshift=8;
+      bitmp->format->Bshift=0;
+      bitmp->format->Ashift=0;
+      bitmp->format->Rmask=0x00FF0000;
+      bitmp->format->Gmask=0x0000FF00;
+      bitmp->format->Bmask=0x000000FF;
+      bitmp->format->Amask=0x00000000;
+   }
+   else
+   {
+      bitmp->format->BitsPerPixel = 16;
+      bitmp->format->BytesPerPixel = 2;
+      bitmp->format->Rloss=3;
+      bitmp->format->Gloss=3;
+      bitmp->format->Bloss=3;
+      bitmp->format->Aloss=0;
+      bitmp->format->Rshift=11;
+      bitmp->format->Gshift=6;
+      bitmp->format->Bshift=0;
+      bitmp->format->Ashift=0;
+      bitmp->format->Rmask=0x0000F800;
+      bitmp->format->Gmask=0x000007E0;
+      bitmp->format->Bmask=0x0000001F;
+      bitmp->format->Amask=0x00000000;
+   }
    bitmp->format->colorkey=0;
    bitmp->format->alpha=0;
    bitmp->format->palette = NULL;
@@ -240,7 +351,7 @@ SDL_Surface *prepare_texture(int w,int h,int b)
    bitmp->flags=0;
    bitmp->w=w;
    bitmp->h=h;
-   bitmp->pitch=retrow*2;
+   bitmp->pitch=retrow*PIXEL_BYTES;
    bitmp->pixels=(unsigned char *)&bmp[0];
    bitmp->clip_rect.x=0;
    bitmp->clip_rect.y=0;
@@ -253,7 +364,8 @@ SDL_Surface *prepare_texture(int w,int h,int b)
 
 void texture_init(void)
 {
-   memset(bmp, 0, sizeof(bmp));
+   if (texture_alloc())
+      texture_clear();
 
    gmx=(retrow/2)-1;
    gmy=(retroh/2)-1;
@@ -277,40 +389,72 @@ void pause_select(void)
    }
 }
 
-void Print_Statut(void)
+// Status bar text is rendered only when one of its fields changes,
+// otherwise the previous rendering is just copied in.  Drive LEDs
+// toggle constantly during disk access, so they're separate
+// pre-rendered tiles blended over the text only while lit.
+static overlay_t statut_overlay;
+static overlay_t led_overlay[3];
+
+static void Print_Led(int led, int x, const char *name)
 {
-   STAT_BASEY=CROP_HEIGHT;
+   overlay_t *ov = &led_overlay[led];
+   unsigned short *pix;
 
-   DrawFBoxBmp(bmp,0,CROP_HEIGHT,CROP_WIDTH,STAT_YSZ,RGB565(0,0,0));
+   if (!Overlay_Valid(ov, x, STAT_BASEY, 16, 16))
+   {
+      pix = Overlay_Begin(ov, x, STAT_BASEY, 16, 16, true);
+      if (!pix)
+         return;
+      DrawFBoxBmp(pix,x,0,16,16,RGB565(0,7,0));
+      Draw_text(pix,x,0,0xffff,0x0,1,2,40,(char*)name);
+   }
+   Overlay_Blend(ov, bmp);
+}
 
-   if(MOUSEMODE==-1)
-      Draw_text(bmp,STAT_DECX,STAT_BASEY,0xffff,0x8080,1,2,40,"Joy  ");
-   else
-      Draw_text(bmp,STAT_DECX,STAT_BASEY,0xffff,0x8080,1,2,40,"Mouse");
+void Print_Statut(void)
+{
+   static int prev_state[6];
+   int state[6];
+   unsigned short *pix;
 
-   Draw_text(bmp,STAT_DECX+40 ,STAT_BASEY,0xffff,0x8080,1,2,40,(SHIFTON>0?"SHFT":""));
-   Draw_text(bmp,STAT_DECX+80 ,STAT_BASEY,0xffff,0x8080,1,2,40,"MS:%d",PAS);
-   Draw_text(bmp,STAT_DECX+120,STAT_BASEY,0xffff,0x8080,1,2,40,"Joy:%d",NUMjoy);
+   STAT_BASEY=CROP_HEIGHT;
 
-   if(LEDA)
-   {
-      DrawFBoxBmp(bmp,CROP_WIDTH-6*BOXDEC-6-16,CROP_HEIGHT-0,16,16,RGB565(0,7,0));//led A drive
-      Draw_text(bmp,CROP_WIDTH-6*BOXDEC-6-16,CROP_HEIGHT-0,0xffff,0x0,1,2,40," A");
-   }	
+   state[0] = MOUSEMODE;
+   state[1] = SHIFTON;
+   state[2] = PAS;
+   state[3] = NUMjoy;
+   state[4] = CROP_WIDTH;
+   state[5] = CROP_HEIGHT;
 
-   if(LEDB)
+   if (!Overlay_Valid(&statut_overlay, 0, STAT_BASEY, CROP_WIDTH, STAT_YSZ)
+       || memcmp(state, prev_state, sizeof(state)) != 0)
    {
-      DrawFBoxBmp(bmp,CROP_WIDTH-7*BOXDEC-6-16,CROP_HEIGHT-0,16,16,RGB565(0,7,0));//led B drive
-      Draw_text(bmp,CROP_WIDTH-7*BOXDEC-6-16,CROP_HEIGHT-0,0xffff,0x0,1,2,40," B");
+      pix = Overlay_Begin(&statut_overlay, 0, STAT_BASEY, CROP_WIDTH, STAT_YSZ, true);
+      if (!pix)
+         return;
+      memcpy(prev_state, state, sizeof(state));
+
+      /* overlay rows start at STAT_BASEY */
+      if(MOUSEMODE==-1)
+         Draw_text(pix,STAT_DECX,0,0xffff,0x8080,1,2,40,"Joy  ");
+      else
+         Draw_text(pix,STAT_DECX,0,0xffff,0x8080,1,2,40,"Mouse");
+
+      Draw_text(pix,STAT_DECX+40 ,0,0xffff,0x8080,1,2,40,(SHIFTON>0?"SHFT":""));
+      Draw_text(pix,STAT_DECX+80 ,0,0xffff,0x8080,1,2,40,"MS:%d",PAS);
+      Draw_text(pix,STAT_DECX+120,0,0xffff,0x8080,1,2,40,"Joy:%d",NUMjoy);
    }
+   Overlay_Blend(&statut_overlay, bmp);
 
+   if(LEDA)
+      Print_Led(0, CROP_WIDTH-6*BOXDEC-6-16, " A");   //led A drive
+   if(LEDB)
+      Print_Led(1, CROP_WIDTH-7*BOXDEC-6-16, " B");   //led B drive
    if(LEDC)
-   {
-      DrawFBoxBmp(bmp,CROP_WIDTH-8*BOXDEC-6-16,CROP_HEIGHT-0,16,16,RGB565(0,7,0));//led C drive
-      Draw_text(bmp,CROP_WIDTH-8*BOXDEC-6-16,CROP_HEIGHT-0,0xffff,0x0,1,2,40," C");
-      LEDC=0;
-   }
+      Print_Led(2, CROP_WIDTH-8*BOXDEC-6-16, " C");   //led C drive
 
+   LEDC=0;
 }
 
 void retro_key_down(unsigned char retrok)
@@ -325,48 +469,200 @@ void retro_key_up(unsigned char retrok)
 
 void Process_key(void)
 {
-   int i;
-   for(i=0;i<320;i++)
+   // Only keys with an ST mapping (and the GUI key) need to be polled
+   static short keys[320];
+   static int nkeys = -1;
+   int i, n;
+
+   if (nkeys < 0)
+   {
+      nkeys = 0;
+      for (i = 0; i < 320; i++)
+         if (SDLKeyToSTScanCode[i] != -1 || i == RETROK_F11)
+            keys[nkeys++] = i;
+   }
+
+   for (n = 0; n < nkeys; n++)
    {
+      i = keys[n];
       Key_Sate[i]=input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0,i) ? 0x80: 0;
 
+      if (!Key_Sate[i] == !Key_Sate2[i] || SDLKeyToSTScanCode[i] == -1)
+         continue;
+      Key_Sate2[i] = Key_Sate[i] ? 1 : 0;
+
       if(SDLKeyToSTScanCode[i]==0x2a )
       {  //SHIFT CASE
+         if (!Key_Sate[i])
+            continue;
 
-         if( Key_Sate[i] && Key_Sate2[i]==0 )
-         {
-            if(SHIFTON == 1)
-               retro_key_up(	SDLKeyToSTScanCode[i] );					
-            else if(SHIFTON == -1) 
-               retro_key_down(SDLKeyToSTScanCode[i] );
+         if(SHIFTON == 1)
+            retro_key_up(	SDLKeyToSTScanCode[i] );
+         else if(SHIFTON == -1)
+            retro_key_down(SDLKeyToSTScanCode[i] );
 
-            SHIFTON=-SHIFTON;
+         SHIFTON=-SHIFTON;
+      }
+      else if (Key_Sate[i])
+         retro_key_down(	SDLKeyToSTScanCode[i] );
+      else
+         retro_key_up( SDLKeyToSTScanCode[i] );
+   }
 
-            Key_Sate2[i]=1;
+}
 
-         }
-         else if ( !Key_Sate[i] && Key_Sate2[i]==1 )Key_Sate2[i]=0;
 
-      }
-      else
-      {
-         if(Key_Sate[i] && SDLKeyToSTScanCode[i]!=-1  && Key_Sate2[i]==0)
-         {
-            retro_key_down(	SDLKeyToSTScanCode[i] );
-            Key_Sate2[i]=1;
-         }
-         else if ( !Key_Sate[i] && SDLKeyToSTScanCode[i]!=-1 && Key_Sate2[i]==1 )
-         {
-            retro_key_up( SDLKeyToSTScanCode[i] );
-            Key_Sate2[i]=0;
+//   RETRO        B    Y    SLT  STA  UP   DWN  LEFT RGT  A    X    L    R    L2   R2   L3   R3
+//   INDEX        0    1    2    3    4    5    6    7    8    9    10   11   12   13   14   15
+static const int vbt[16]={0x1C,0x39,0x01,0x3B,0x01,0x02,0x04,0x08,0x80,0x6D,0x15,0x31,0x24,0x1F,0x6E,0x6F};
 
-         }
+// Give joystick, mouse buttons & motion to the emulated machine,
+// recorded to or replaced from an input movie
+static int emu_mouse_l=0, emu_mouse_r=0;
 
-      }
+static void apply_emu_input(int mouse_l, int mouse_r, bool late)
+{
+   static int mbL=0,mbR=0;
+   static unsigned char oldjoy0=0;
+   static int oldnumjoy=0;
+   INPUTMOVIE_INPUT input;
+
+   input.nJoy = MXjoy0;
+   input.nButtons = (mouse_l ? INPUTMOVIE_LBUTTON : 0)
+      | (mouse_r ? INPUTMOVIE_RBUTTON : 0) | (NUMjoy < 0 ? INPUTMOVIE_JOY0 : 0);
+   input.nMouseX = fmousex;
+   input.nMouseY = fmousey;
+   InputMovie_Update(&input, late);
+   MXjoy0 = input.nJoy;
+   mouse_l = input.nButtons & INPUTMOVIE_LBUTTON;
+   mouse_r = input.nButtons & INPUTMOVIE_RBUTTON;
+   emu_mouse_l = mouse_l;
+   emu_mouse_r = mouse_r;
+   NUMjoy = (input.nButtons & INPUTMOVIE_JOY0) ? -1 : 1;
+   fmousex = input.nMouseX;
+   fmousey = input.nMouseY;
+
+   // Only let the IKBD generate packets when something changed
+   if(MXjoy0!=oldjoy0 || NUMjoy!=oldnumjoy || mbL!=(mouse_l?1:0) || mbR!=(mouse_r?1:0))
+   {
+      oldjoy0=MXjoy0;
+      oldnumjoy=NUMjoy;
+      IKBD_InputChanged();
    }
 
+   if(mbL==0 && mouse_l)
+   {
+      mbL=1;
+      Keyboard.bLButtonDown |= BUTTON_MOUSE;
+   }
+   else if(mbL==1 && !mouse_l)
+   {
+      Keyboard.bLButtonDown &= ~BUTTON_MOUSE;
+      mbL=0;
+   }
+
+   if(mbR==0 && mouse_r)
+   {
+      mbR=1;
+      Keyboard.bRButtonDown |= BUTTON_MOUSE;
+   }
+   else if(mbR==1 && !mouse_r)
+   {
+      Keyboard.bRButtonDown &= ~BUTTON_MOUSE;
+      mbR=0;
+   }
+
+   Main_HandleMouseMotion();
 }
 
+// Emulated joystick & mouse from the polled input
+static void update_emu_input(bool late)
+{
+   int i;
+   int mouse_l;
+   int mouse_r;
+   int16_t mouse_x;
+   int16_t mouse_y;
+
+   MXjoy0=0;
+
+   if(MOUSEMODE==-1)
+   {
+      //Joy mode
+      //emulate Joy0 with joy analog left 
+      
+      al[0] =(input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X));///2;
+      al[1] =(input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y));///2;
+
+      /* Directions */
+      if (al[1] <= JOYRANGE_UP_VALUE)
+         MXjoy0 |= ATARIJOY_BITMASK_UP;
+      else if (al[1] >= JOYRANGE_DOWN_VALUE)
+         MXjoy0 |= ATARIJOY_BITMASK_DOWN;
+
+      if (al[0] <= JOYRANGE_LEFT_VALUE)
+         MXjoy0 |= ATARIJOY_BITMASK_LEFT;
+      else if (al[0] >= JOYRANGE_RIGHT_VALUE)
+         MXjoy0 |= ATARIJOY_BITMASK_RIGHT;
+
+
+      for(i=4;i<9;i++)if( JOYPAD_PRESSED(i) )MXjoy0 |= vbt[i]; // Joy press	
+
+      // Joy autofire
+      if( JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_B) )
+      {
+         MXjoy0 |= ATARIJOY_BITMASK_FIRE;
+         if ((nVBLs&0x7)<4)
+            MXjoy0 &= ~ATARIJOY_BITMASK_FIRE;
+      }
+
+      mouse_x = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_X);
+      mouse_y = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_Y);
+      mouse_l    = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_LEFT);
+      mouse_r    = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_RIGHT);
+
+      fmousex=mouse_x;
+      fmousey=mouse_y;
+
+   }
+   else
+   {
+      //Mouse mode
+      fmousex=fmousey=0;
+
+      //emulate mouse with joy analog right 
+      ar[0] = (input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X));
+      ar[1] = (input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y));
+
+      if(ar[0]<=-1024)
+         fmousex -=(-ar[0])/1024;
+      if(ar[0]>= 1024)
+         fmousex +=( ar[0])/1024;
+      if(ar[1]<=-1024)
+         fmousey -=(-ar[1])/1024;
+      if(ar[1]>= 1024)
+         fmousey +=( ar[1])/1024;
+
+      //emulate mouse with dpad
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_RIGHT))
+         fmousex += PAS;
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_LEFT))
+         fmousex -= PAS;
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_DOWN))
+         fmousey += PAS;
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_UP))
+         fmousey -= PAS;
+
+      // Emulated motion is per frame, not per poll
+      if (late)
+         fmousex=fmousey=0;
+
+      mouse_l=JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_A);
+      mouse_r=JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_B);
+   }
+
+   apply_emu_input(mouse_l, mouse_r, late);
+}
 
 /*
    L2  show/hide Statut
@@ -384,9 +680,6 @@ void Process_key(void)
 void update_input(void)
 {
    int i;
-   //   RETRO        B    Y    SLT  STA  UP   DWN  LEFT RGT  A    X    L    R    L2   R2   L3   R3
-   //   INDEX        0    1    2    3    4    5    6    7    8    9    10   11   12   13   14   15
-   static int vbt[16]={0x1C,0x39,0x01,0x3B,0x01,0x02,0x04,0x08,0x80,0x6D,0x15,0x31,0x24,0x1F,0x6E,0x6F};
    static int oldi=-1;
    static int vkx=0,vky=0;
 
@@ -397,77 +690,58 @@ void update_input(void)
       oldi=-1;
    }
 
-   input_poll_cb();
+   poll_input(false);
 
    Process_key();
 
-   if (Key_Sate[RETROK_F11] || input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_Y) )
+   if (Key_Sate[RETROK_F11] || JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_Y) )
       pauseg=1;
 
+   rewind_held = JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_L3) != 0;
+
    i=10;//show vkey toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       SHOWKEY=-SHOWKEY;
       Screen_SetFullUpdate();
    }
 
    i=2;//mouse/joy toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       MOUSEMODE=-MOUSEMODE;
    }
 
    i=3;//num joy toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       NUMJOY++;if(NUMJOY>1)NUMJOY=0;
       NUMjoy=-NUMjoy;
    }
 
    i=11;//mouse gui speed
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       PAS++;if(PAS>MAXPAS)PAS=1;
    }
 
    i=9;//switch shift On/Off 
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       SHIFTON=-SHIFTON;
       Screen_SetFullUpdate();
    }
 
    i=12;//show/hide statut
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       STATUTON=-STATUTON;
       Screen_SetFullUpdate();
    }
 
    i=13;//swap kbd pages
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
-      mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if ( JOYPAD_RELEASED(i) )
    {
-      mbt[i]=0;
       if(SHOWKEY==1)
       {
          NPAGE=-NPAGE;
@@ -477,37 +751,23 @@ void update_input(void)
 
    if(SHOWKEY==1)
    {
-      static int vkflag[5]={0,0,0,0,0};		
-
-      if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP) && vkflag[0]==0 )
-         vkflag[0]=1;
-      else if (vkflag[0]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP) )
+      if ( JOYPAD_RELEASED(RETRO_DEVICE_ID_JOYPAD_UP) )
       {
-         vkflag[0]=0;
          vky -= 1; 
       }
 
-      if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN) && vkflag[1]==0 )
-         vkflag[1]=1;
-      else if (vkflag[1]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN) )
+      if ( JOYPAD_RELEASED(RETRO_DEVICE_ID_JOYPAD_DOWN) )
       {
-         vkflag[1]=0;
          vky += 1; 
       }
 
-      if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT) && vkflag[2]==0 )
-         vkflag[2]=1;
-      else if (vkflag[2]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT) )
+      if ( JOYPAD_RELEASED(RETRO_DEVICE_ID_JOYPAD_LEFT) )
       {
-         vkflag[2]=0;
          vkx -= 1;
       }
 
-      if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) && vkflag[3]==0 )
-         vkflag[3]=1;
-      else if (vkflag[3]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) )
+      if ( JOYPAD_RELEASED(RETRO_DEVICE_ID_JOYPAD_RIGHT) )
       {
-         vkflag[3]=0;
          vkx += 1;
       }
 
@@ -519,11 +779,8 @@ void update_input(void)
       virtual_kdb(bmp,vkx,vky);
 
       i=8;
-      if(input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i)  && vkflag[4]==0) 	
-         vkflag[4]=1;
-      else if( !input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i)  && vkflag[4]==1)
+      if( JOYPAD_RELEASED(i) )
       {
-         vkflag[4]=0;
          i=check_vkey2(vkx,vky);
 
          if(i==-2)
@@ -576,122 +833,42 @@ void update_input(void)
          }
       }
 
+      // No joystick or mouse motion while the keyboard is shown
+      fmousex=fmousey=0;
+      apply_emu_input(emu_mouse_l, emu_mouse_r, false);
+
       if(STATUTON==1)
          Print_Statut();
 
       return;
    }
 
-   static int mbL=0,mbR=0;
-   int mouse_l;
-   int mouse_r;
-   int16_t mouse_x;
-   int16_t mouse_y;
-
-   if(MOUSEMODE==-1)
-   {
-      //Joy mode
-      //emulate Joy0 with joy analog left 
-      
-      al[0] =(input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X));///2;
-      al[1] =(input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y));///2;
-
-      /* Directions */
-      if (al[1] <= JOYRANGE_UP_VALUE)
-         MXjoy0 |= ATARIJOY_BITMASK_UP;
-      else if (al[1] >= JOYRANGE_DOWN_VALUE)
-         MXjoy0 |= ATARIJOY_BITMASK_DOWN;
-
-      if (al[0] <= JOYRANGE_LEFT_VALUE)
-         MXjoy0 |= ATARIJOY_BITMASK_LEFT;
-      else if (al[0] >= JOYRANGE_RIGHT_VALUE)
-         MXjoy0 |= ATARIJOY_BITMASK_RIGHT;
-
-
-      for(i=4;i<9;i++)if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )MXjoy0 |= vbt[i]; // Joy press	
-
-      // Joy autofire
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B) )
-      {
-         MXjoy0 |= ATARIJOY_BITMASK_FIRE;
-         if ((nVBLs&0x7)<4)
-            MXjoy0 &= ~ATARIJOY_BITMASK_FIRE;
-      }
-
-      mouse_x = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_X);
-      mouse_y = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_Y);
-      mouse_l    = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_LEFT);
-      mouse_r    = input_state_cb(0, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_RIGHT);
-
-      fmousex=mouse_x;
-      fmousey=mouse_y;
-
-   }
-   else
-   {
-      //Mouse mode
-      fmousex=fmousey=0;
-
-      //emulate mouse with joy analog right 
-      ar[0] = (input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X));
-      ar[1] = (input_state_cb(0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y));
-
-      if(ar[0]<=-1024)
-         fmousex -=(-ar[0])/1024;
-      if(ar[0]>= 1024)
-         fmousex +=( ar[0])/1024;
-      if(ar[1]<=-1024)
-         fmousey -=(-ar[1])/1024;
-      if(ar[1]>= 1024)
-         fmousey +=( ar[1])/1024;
-
-      //emulate mouse with dpad
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
-         fmousex += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT))
-         fmousex -= PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN))
-         fmousey += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
-         fmousey -= PAS;
-
-      mouse_l=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A);
-      mouse_r=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B);
-   }
+   update_emu_input(false);
 
-   if(mbL==0 && mouse_l)
-   {
-      mbL=1;
-      Keyboard.bLButtonDown |= BUTTON_MOUSE;
-   }
-   else if(mbL==1 && !mouse_l)
-   {
-      Keyboard.bLButtonDown &= ~BUTTON_MOUSE;
-      mbL=0;
-   }
+   if(STATUTON==1)
+      Print_Statut();
+}
 
-   if(mbR==0 && mouse_r)
-   {
-      mbR=1;
-      Keyboard.bRButtonDown |= BUTTON_MOUSE;
-   }
-   else if(mbR==1 && !mouse_r)
-   {
-      Keyboard.bRButtonDown &= ~BUTTON_MOUSE;
-      mbR=0;
-   }
+// Poll input again at the configured scanline so that it reaches the
+// emulated machine within the frame: IKBD packets are sent right away
+void update_input_late(void)
+{
+   if (pauseg!=0 || SHOWKEY==1)
+      return;
 
-   Main_HandleMouseMotion();
+   poll_input(true);
+   Process_key();
+   update_emu_input(true);
 
-   if(STATUTON==1)
-      Print_Statut();
+   CycInt_RemovePendingInterrupt(INTERRUPT_IKBD_AUTOSEND);
+   CycInt_AddRelativeInterrupt(4, INT_CPU_CYCLE, INTERRUPT_IKBD_AUTOSEND);
 }
 
 void input_gui(void)
 {
    int SAVPAS=PAS;	
 
-   input_poll_cb();
+   poll_input(false);
 
    int mouse_l;
    int mouse_r;
@@ -699,11 +876,8 @@ void input_gui(void)
    mouse_x=mouse_y=0;
 
    //mouse/joy toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, 2) && mbt[2]==0 )
-      mbt[2]=1;
-   else if ( mbt[2]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, 2) )
+   if ( JOYPAD_RELEASED(RETRO_DEVICE_ID_JOYPAD_SELECT) )
    {
-      mbt[2]=0;
       MOUSEMODE=-MOUSEMODE;
    }
 
@@ -712,16 +886,16 @@ void input_gui(void)
    if(MOUSEMODE==1)
    {
 
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_RIGHT))
          mouse_x += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT))
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_LEFT))
          mouse_x -= PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN))
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_DOWN))
          mouse_y += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
+      if (JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_UP))
          mouse_y -= PAS;
-      mouse_l=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A);
-      mouse_r=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B);
+      mouse_l=JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_A);
+      mouse_r=JOYPAD_PRESSED(RETRO_DEVICE_ID_JOYPAD_B);
 
       PAS=SAVPAS;
 	
@@ -19,7 +19,8 @@ extern int Reset_Warm(void);
 #include "SDL_types.h"
 
 #define RGB565(r, g, b)  (((r) << (5+6)) | ((g) << 6) | (b))
-#define SDL_MapRGB(a, r, g, b) RGB565( (r)>>3, (g)>>3, (b)>>3)
+#define XRGB8888(r, g, b)  (((r) << 16) | ((g) << 8) | (b))
+#define SDL_MapRGB(a, r, g, b) ((a)->BytesPerPixel == 4 ? XRGB8888((r), (g), (b)) : RGB565( (r)>>3, (g)>>3, (b)>>3))
 extern long GetTicks(void);
 
 extern void retro_fillrect(SDL_Surface * surf,SDL_Rect *rect,unsigned int col);
@@ -54,7 +55,8 @@ Uint8 type;
 #define SDL_Delay(a) usleep((a)*1000)
 #endif
 //SURFACE
-#define SDL_SetColors(a, b, c, d)
+//no palette, arguments only used so that callers don't get unused warnings
+#define SDL_SetColors(a, b, c, d) ((void)(a), (void)(b), (void)(c), (void)(d))
 #define SDL_MUSTLOCK(a) 0
 #define SDL_LockSurface(a) 0
 #define SDL_UnlockSurface(a) 0
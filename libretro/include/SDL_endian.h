@@ -3,6 +3,15 @@
 //RETRO HACK
 #include "SDL.h"
 
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8)))
+/* single bswap/rev instruction, also in non-optimized builds */
+static __inline__ unsigned short SDL_Swap16(unsigned short x){
+	return __builtin_bswap16(x);
+}
+static __inline__ unsigned SDL_Swap32(unsigned x){
+	return __builtin_bswap32(x);
+}
+#else
 static __inline__ unsigned short SDL_Swap16(unsigned short x){
 	unsigned short result= ((x<<8)|(x>>8)); 
 return result;
@@ -11,6 +20,7 @@ static __inline__ unsigned SDL_Swap32(unsigned x){
 	unsigned result= ((x<<24)|((x<<8)&0x00FF0000)|((x>>8)&0x0000FF00)|(x>>24));
  return result;
 }
+#endif
 
 //#define SDL_SwapLE16(X) SDL_Swap16(X)
 //#define SDL_SwapLE32(X) SDL_Swap32(X)
@@ -49,6 +49,11 @@
 /* Define to 1 if you have unix domain sockets */
 //#define HAVE_UNIX_DOMAIN_SOCKETS 1
 
+/* Define to 1 if you have TCP/IP sockets */
+#if defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+#define HAVE_TCP_SOCKETS 1
+#endif
+
 #ifdef __LIBRETRO__
 #if defined(AND) || defined(__CELLOS_LV2__) || defined(WIIU)
 #undef HAVE_POSIX_MEMALIGN
@@ -96,6 +101,16 @@
 /* Define to 1 if you have the 'statvfs' function. */
 //#define HAVE_STATVFS 1
 
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#if !defined(WIN32PORT) && !defined(_WIN32) && !defined(__CELLOS_LV2__) && !defined(GEKKO) && !defined(WIIU)
+#define HAVE_SYS_MMAN_H 1
+#endif
+
+/* Define to 1 if you have the 'fsync' function. */
+#if !defined(WIN32PORT) && !defined(_WIN32) && !defined(__CELLOS_LV2__) && !defined(GEKKO) && !defined(WIIU)
+#define HAVE_FSYNC 1
+#endif
+
 /* Define to 1 if you have the 'fseeko' function. */
 //#define HAVE_FSEEKO 1
 
@@ -107,8 +122,13 @@
 /* Relative path from bindir to datadir */
 #define BIN2DATADIR "."
 
+/* Define to 1 to build only ST/STE emulation (68000, no TT/Falcon/DSP) */
+//#define ENABLE_ST_ONLY 1
+
 /* Define to 1 to enable DSP 56k emulation for Falcon mode */
+#if !ENABLE_ST_ONLY
 #define ENABLE_DSP_EMU 1
+#endif
 
 /* Define to 1 to enable WINUAE cpu  */
 //#define ENABLE_WINUAE_CPU 1
@@ -118,3 +138,6 @@
 
 /* Define to 1 to enable trace logs - undefine to slightly increase speed */
 //#define ENABLE_TRACING 1
+
+/* Define to 1 to enable host time counters for emulation subsystems (slight slowdown) */
+//#define ENABLE_PERFCOUNT 1
@@ -18,12 +18,15 @@ extern const char SDLKeyToSTScanCode[512] ;
 #include <libco.h>
 
 extern cothread_t mainThread;
-extern cothread_t emuThread;
+extern cothread_t guiThread;
 
 extern char Key_Sate[512];
 extern char Key_Sate2[512];
 
 extern int pauseg; 
+extern bool rewind_held;
+
+extern bool libretro_supports_bitmasks;
 
 #include "SDL_video.h"
 
@@ -4,37 +4,58 @@
 
 #include "STkeymap.h"
 #include "memorySnapShot.h"
+#include "stMemory.h"
+#include "ioMem.h"
+#include "tos.h"
+#include "emumemory.h"
+#include "screen.h"
+#include "video.h"
+#include "audio.h"
+#include "sound.h"
 
 #include "retro_strings.h"
 #include "retro_files.h"
 #include "retro_disk_control.h"
+#include "diskPrefetch.h"
+#include "inputMovie.h"
+#include "midi.h"
+#include "microphone.h"
+#include "change.h"
+#include "perfcount.h"
+#include "metrics.h"
+#include "rewind.h"
 static dc_storage* dc;
 
 // LOG
 retro_log_printf_t log_cb;
 
 cothread_t mainThread;
-cothread_t emuThread;
+cothread_t guiThread;
+static bool gui_running = false;
 
 int CROP_WIDTH;
 int CROP_HEIGHT;
 int VIRTUAL_WIDTH ;
-int retrow=1024; 
-int retroh=1024;
+int retrow=416; 
+int retroh=260;
+int PIXEL_BYTES=2;
 
-extern unsigned short int bmp[1024*1024];
+extern unsigned short int *bmp;
 extern int STATUTON,SHOWKEY,SHIFTON,pauseg,SND ,snd_sampler;
 extern short signed int SNDBUF[1024*2];
 extern char RPATH[512];
 extern char RETRO_DIR[512];
 extern char RETRO_TOS[512];
 extern struct retro_midi_interface *MidiRetroInterface;
+extern struct retro_microphone_interface *MicrophoneRetroInterface;
 
 #include "cmdline.c"
 
 extern void update_input(void);
+extern void pause_select(void);
 extern void texture_init(void);
 extern void texture_uninit(void);
+extern void texture_free(void);
 extern void Emu_init();
 extern void Emu_uninit();
 
@@ -46,6 +67,7 @@ static retro_video_refresh_t video_cb;
 static retro_audio_sample_t audio_cb;
 static retro_audio_sample_batch_t audio_batch_cb;
 static retro_environment_t environ_cb;
+static bool can_dupe = false;
 static char buf[64][4096] = { 0 };
 
 unsigned int video_config = 0;
@@ -57,10 +79,32 @@ unsigned int video_config = 0;
 #define HATARI_VIDEO_OV_HI 	HATARI_VIDEO_HIRES
 #define HATARI_VIDEO_CR_HI 	HATARI_VIDEO_HIRES|HATARI_VIDEO_CROP
 
+#define RETRO_OUTPUT_RATE	44100	// advertised in retro_get_system_av_info
+#define RETRO_INTERNAL_RATE	50066	// STE/TT DMA rates are exact divisions of it
+
 bool hatari_borders = true;
 char hatari_frameskips[2];
+bool hatari_fast_timing = false;
+bool hatari_auto_prefetch = false;
+bool hatari_cpu_turbo = false;
+bool hatari_batch_hbl = false;
+bool hatari_deterministic = false;
+bool hatari_turbo_fdc = false;
+bool hatari_floppy_hle = false;
+bool hatari_turbo_boot = false;
+bool hatari_boot_snapshot = false;
+bool hatari_ym_hq = false;
+bool hatari_crossbar_batch = false;
+bool hatari_microphone = false;
+char hatari_dsp_skew[5];
+int hatari_audio_rate = 0;
+char hatari_gdb_port[6];
+bool hatari_video_thread = false;
+bool hatari_native_res = false;
+bool hatari_frameskip_audio = false;
+int hatari_input_scanline = -1;
+int hatari_rewind = 0;
 int firstpass = 1;
-char savestate_fname[RETRO_PATH_MAX];
 
 static struct retro_input_descriptor input_descriptors[] = {
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP, "Up" },
@@ -75,6 +119,7 @@ static struct retro_input_descriptor input_descriptors[] = {
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L2, "Toggle m/k status" },
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L, "Joystick number" },
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R, "Mouse speed" },
+   { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L3, "Rewind (hold)" },
    // Terminate
    { 255, 255, 255, 255, NULL }
 };
@@ -108,10 +153,32 @@ void retro_set_environment(retro_environment_t cb)
          },
          "false"
       },  
+      {
+         "hatari_video_native",
+         "Native resolution",
+         "Outputs each screen mode at its own size and aspect ratio, without doubling ST low resolution, so that the frontend does the scaling. Needs restart",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_video_pixel_format",
+         "Pixel format",
+         "Needs restart",
+         {
+            { "rgb565", "RGB565" },
+            { "xrgb8888", "XRGB8888" },
+            { NULL, NULL },
+         },
+         "rgb565"
+      },
       {
          "hatari_frameskips",
          "Frameskip",
-         "Needs restart",
+         "Emulated frames skipped after each shown one. The auto modes skip only while the emulation can't keep up",
          {
             { "0", "disabled" },
             { "1", NULL },
@@ -120,6 +187,211 @@ void retro_set_environment(retro_environment_t cb)
             { "4", NULL },
             { "5", "auto (max 5)" },
             { "10", "auto (max 10)" },
+            { "audio", "auto (audio buffer)" },
+            { NULL, NULL },
+         },
+         "0"
+      },
+      {
+         "hatari_video_thread",
+         "Threaded video conversion",
+         "Convert each frame in a thread while the next one is emulated. Adds a frame of latency",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      // System
+      {
+         "hatari_cpu_timing",
+         "CPU timing",
+         "Fast skips prefetch, instruction pairing and wait states, which most GEM programs and games don't need. Auto skips prefetch and pairing until self-modifying code needs them",
+         {
+            { "exact", "exact" },
+            { "auto", "auto prefetch" },
+            { "fast", "fast" },
+            { NULL, NULL },
+         },
+         "exact"
+      },
+      {
+         "hatari_cpu_turbo",
+         "CPU turbo on disk access",
+         "Runs the CPU at 32 MHz while the floppy or ACSI hard disk is busy, so that loaders and depackers finish sooner. Stays off for a while when the program changes the video timings during the frame",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_batch_hbl",
+         "Batch HBL interrupts",
+         "Handles the end of successive lines in one interrupt while HBL interrupts are masked and timer B doesn't count lines. Emulation stays exact, the lines are caught up as soon as the program could notice",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_deterministic",
+         "Deterministic mode",
+         "Derive random numbers, real time clock and GEMDOS file dates from emulated state only, so that input replays and netplay stay in sync. Needs restart",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_turbo_fdc",
+         "Turbo floppy",
+         "Completes floppy commands almost at once for ST/MSA/DIM images, loading is much faster. STX/IPF images keep the accurate timings",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_floppy_hle",
+         "Floppy BIOS calls HLE",
+         "Serves the BIOS/XBIOS floppy sector calls of ST/MSA/DIM images directly from the image. Programs accessing the floppy controller themselves are not affected",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_turbo_boot",
+         "Turbo boot",
+         "Runs the boot at full speed without showing it, until TOS reads the floppy or hard disk. Emulated timings are unchanged. Needs restart",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_boot_snapshot",
+         "Boot snapshot",
+         "Saves the state from before TOS reads the boot disk on first start, and resumes from it on later starts with the same TOS and machine settings. Needs restart",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_rewind",
+         "Rewind buffer",
+         "Keeps this many seconds of emulation in memory, hold L3 to step back through them. Each second takes about as much memory as the emulated ST RAM",
+         {
+            { "0", "disabled" },
+            { "10", "10 seconds" },
+            { "30", "30 seconds" },
+            { "60", "60 seconds" },
+            { NULL, NULL },
+         },
+         "0"
+      },
+      // Audio
+      {
+         "hatari_ym_quality",
+         "YM2149 quality",
+         "High runs the YM at its own 250 kHz clock and filters it down, removing aliasing of high pitched sounds. Uses more CPU",
+         {
+            { "normal", "normal" },
+            { "high", "high" },
+            { NULL, NULL },
+         },
+         "normal"
+      },
+      {
+         "hatari_crossbar_batch",
+         "Falcon sound batching",
+         "Handles Falcon sound transfers once per scanline while the DSP isn't used, which is less exact but much faster",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_microphone",
+         "Falcon microphone",
+         "Records the Falcon's microphone input from the frontend's microphone. Takes effect at the next Falcon reset",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_dsp_skew",
+         "Falcon DSP slices",
+         "Runs the Falcon DSP in slices of up to this many DSP cycles instead of after every CPU instruction. The DSP still catches up whenever the CPU talks to it. Larger slices are faster but can break programs with tight CPU/DSP timing",
+         {
+            { "0", "disabled" },
+            { "256", NULL },
+            { "1024", NULL },
+            { "4096", NULL },
+            { NULL, NULL },
+         },
+         "0"
+      },
+      {
+         "hatari_audio_resampler",
+         "Audio synthesis rate",
+         "Internal generates the sound at 50066 Hz (exact STE DMA rates) and resamples it to the output rate, so sound emulation cost doesn't depend on the output rate. Sinc is cleaner but uses a little more CPU",
+         {
+            { "output", "output rate" },
+            { "linear", "internal, linear resampler" },
+            { "sinc", "internal, sinc resampler" },
+            { NULL, NULL },
+         },
+         "output"
+      },
+      // Input
+      {
+         "hatari_input_scanline",
+         "Late input polling",
+         "Polls input again when the emulated screen reaches this scanline and sends IKBD packets right away, so games see it within the frame instead of on the next one. Pick a line just before the game reads its input",
+         {
+            { "-1", "disabled" },
+            { "0", NULL },
+            { "50", NULL },
+            { "100", NULL },
+            { "150", NULL },
+            { "200", NULL },
+            { "250", NULL },
+            { "300", NULL },
+            { NULL, NULL },
+         },
+         "-1"
+      },
+      // Debugging
+      {
+         "hatari_gdb_port",
+         "GDB remote debugging",
+         "Accepts GDB remote protocol connections on this local TCP port, e.g. from m68k-atari-mint-gdb 'target remote :1234'. Emulation stops while GDB has it stopped. Needs restart",
+         {
+            { "0", "disabled" },
+            { "1234", NULL },
+            { "2345", NULL },
             { NULL, NULL },
          },
          "0"
@@ -166,6 +438,12 @@ void retro_set_environment(retro_environment_t cb)
 static void update_variables(void)
 {
    struct retro_variable var = {0};
+   // Options changed while running are applied like GUI changes, so that
+   // each gets the least disruptive action (see Change_GetResetTier())
+   static CNF_PARAMS current, changed;
+
+   if (!firstpass)
+      current = changed = ConfigureParams;
 
    // Video
    var.key = "hatari_video_hires";
@@ -186,14 +464,200 @@ static void update_variables(void)
 		   video_config |= HATARI_VIDEO_CROP;
    }
 
+   var.key = "hatari_video_native";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_native_res = (strcmp(var.value, "true") == 0);
+   }
+
    var.key = "hatari_frameskips";
    var.value = NULL;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
-	   strncpy((char*)hatari_frameskips, var.value, 2);
+	   // Skipping on frontend audio buffer underruns is done here, not by Hatari
+	   hatari_frameskip_audio = (strcmp(var.value, "audio") == 0);
+	   strncpy((char*)hatari_frameskips, hatari_frameskip_audio ? "0" : var.value, 2);
+	   if (!firstpass)
+		   changed.Screen.nFrameSkips = hatari_frameskip_audio ? 0 : atoi(var.value);
+   }
+
+   var.key = "hatari_video_thread";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_video_thread = (strcmp(var.value, "true") == 0);
+   }
+
+   // System
+   var.key = "hatari_cpu_timing";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_fast_timing = (strcmp(var.value, "fast") == 0);
+	   hatari_auto_prefetch = (strcmp(var.value, "auto") == 0);
+	   if (!firstpass)
+	   {
+		   changed.System.bFastTiming = hatari_fast_timing;
+		   changed.System.bAutoPrefetch = hatari_auto_prefetch;
+	   }
+   }
+
+   var.key = "hatari_cpu_turbo";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_cpu_turbo = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.System.bCpuTurbo = hatari_cpu_turbo;
+   }
+
+   var.key = "hatari_batch_hbl";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_batch_hbl = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.System.bBatchHbl = hatari_batch_hbl;
+   }
+
+   var.key = "hatari_deterministic";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_deterministic = (strcmp(var.value, "true") == 0);
+   }
+
+   var.key = "hatari_turbo_fdc";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_turbo_fdc = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.DiskImage.TurboFloppy = hatari_turbo_fdc;
+   }
+
+   var.key = "hatari_floppy_hle";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_floppy_hle = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.DiskImage.bFloppyHLE = hatari_floppy_hle;
+   }
+
+   var.key = "hatari_turbo_boot";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_turbo_boot = (strcmp(var.value, "true") == 0);
+   }
+
+   var.key = "hatari_boot_snapshot";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_boot_snapshot = (strcmp(var.value, "true") == 0);
+   }
+
+   var.key = "hatari_rewind";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && atoi(var.value) != hatari_rewind)
+   {
+	   hatari_rewind = atoi(var.value);
+	   Rewind_SetLength(hatari_rewind);
+   }
+
+   // Audio
+   var.key = "hatari_ym_quality";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_ym_hq = (strcmp(var.value, "high") == 0);
+	   // Passed on the command line at start, can be switched while running
+	   if (!firstpass)
+		   changed.Sound.bYmHighQuality = hatari_ym_hq;
+   }
+
+   var.key = "hatari_crossbar_batch";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_crossbar_batch = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.Sound.bCrossbarBatch = hatari_crossbar_batch;
+   }
+
+   var.key = "hatari_microphone";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_microphone = (strcmp(var.value, "true") == 0);
+	   if (!firstpass)
+		   changed.Sound.bEnableMicrophone = hatari_microphone;
+   }
+
+   var.key = "hatari_dsp_skew";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   snprintf(hatari_dsp_skew, sizeof(hatari_dsp_skew), "%s", var.value);
+	   // The DSP picks up the new slice after its next run
+	   if (!firstpass)
+		   changed.System.nDSPSkew = atoi(hatari_dsp_skew);
+   }
+
+   var.key = "hatari_audio_resampler";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   // 0 keeps the configured frequency, resampled if it isn't the output rate
+	   int rate = (strcmp(var.value, "output") == 0) ? 0 : RETRO_INTERNAL_RATE;
+	   Sound_RetroRingSetOutput(RETRO_OUTPUT_RATE, strcmp(var.value, "sinc") == 0);
+	   if (!firstpass && rate != hatari_audio_rate)
+		   changed.Sound.nPlaybackFreq = rate ? rate : RETRO_OUTPUT_RATE;
+	   hatari_audio_rate = rate;
+   }
+
+   // Input
+   var.key = "hatari_input_scanline";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   hatari_input_scanline = atoi(var.value);
+   }
+
+   // Debugging
+   var.key = "hatari_gdb_port";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+	   snprintf(hatari_gdb_port, sizeof(hatari_gdb_port), "%s", var.value);
    }
 
+   if (!firstpass)
+      Change_CopyChangedParamsToConfiguration(&current, &changed, false);
+
    switch(video_config)
    {
 		case HATARI_VIDEO_OV_LO:
@@ -219,6 +683,13 @@ static void update_variables(void)
 			break;
    }
 
+   // Room for every screen mode at its own size
+   if (hatari_native_res)
+   {
+      retrow = 832;
+      retroh = 520;
+   }
+
    printf("Resolution %u x %u.\n", retrow, retroh);
 
    CROP_WIDTH =retrow;
@@ -227,25 +698,138 @@ static void update_variables(void)
    texture_init();
 }
 
-static void retro_wrap_emulator()
+// Negotiated once, the screen surface is created with the matching depth
+static void update_pixel_format(void)
 {
-   pre_main(RPATH);
+   struct retro_variable var = {0};
+   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
 
-   pauseg=-1;
+   var.key = "hatari_video_pixel_format";
+   var.value = NULL;
 
-   environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0); 
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && strcmp(var.value, "xrgb8888") == 0)
+   {
+      fmt = RETRO_PIXEL_FORMAT_XRGB8888;
+      if (environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+      {
+         PIXEL_BYTES = 4;
+         return;
+      }
+      log_cb(RETRO_LOG_WARN, "XRGB8888 is not supported, using RGB565.\n");
+      fmt = RETRO_PIXEL_FORMAT_RGB565;
+   }
 
-   // Were done here
-   co_switch(mainThread);
+   if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+   {
+      fprintf(stderr, "RGB565 is not supported.\n");
+      exit(0);
+   }
+   PIXEL_BYTES = 2;
+}
 
-   // Dead emulator, but libco says not to return
+// Frontend audio buffer state, reported right before each retro_run()
+static bool audio_buffer_active = false;
+static bool audio_underrun_likely = false;
+static bool audio_buffer_status = false;
+
+#define FRAMESKIP_AUDIO_MAX      4    // consecutive frames skipped at most
+#define TURBOBOOT_FRAMES_PER_RUN 50   // boot frames emulated in one retro_run
+#define FRAMESKIP_AUDIO_LATENCY  128  // ms, gives room to catch up
+#define FASTFORWARD_SHOW_MS      16   // ms between frames drawn while fast-forwarding
+
+extern long GetTicks(void);
+
+// Follow the frontend fast-forward state. Only its changes are applied,
+// so that fast forward enabled through Hatari itself is left alone.
+static bool update_fastforward(void)
+{
+   static bool prev_ff = false;
+   bool ff = false;
+
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_FASTFORWARDING, &ff))
+      ff = false;
+   if (ff != prev_ff)
+   {
+      prev_ff = ff;
+      ConfigureParams.System.bFastForward = ff;
+      if (!ff)
+         Sound_BufferIndexNeedReset = true;
+   }
+   return ff;
+}
+
+static void audio_buffer_status_cb(bool active, unsigned occupancy, bool underrun_likely)
+{
+   (void)occupancy;
+   if (underrun_likely && !audio_underrun_likely)
+      Metrics_Count(METRICS_AUDIO_UNDERRUN);
+   audio_buffer_active = active;
+   audio_underrun_likely = underrun_likely;
+}
+
+static void update_audio_buffer_status(void)
+{
+   struct retro_audio_buffer_status_callback buf_status_cb;
+   unsigned latency = 0;
+
+   if (hatari_frameskip_audio == audio_buffer_status)
+      return;
+
+   buf_status_cb.callback = audio_buffer_status_cb;
+   if (hatari_frameskip_audio
+       && !environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, &buf_status_cb))
+   {
+      log_cb(RETRO_LOG_WARN, "Audio buffer status is not supported, frameskip disabled.\n");
+      hatari_frameskip_audio = false;
+      return;
+   }
+   if (!hatari_frameskip_audio)
+      environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, NULL);
+   else
+      latency = FRAMESKIP_AUDIO_LATENCY;
+   environ_cb(RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY, &latency);
+
+   audio_buffer_status = hatari_frameskip_audio;
+   audio_buffer_active = false;
+   audio_underrun_likely = false;
+}
+
+// The GUI dialogs loop until closed, returning to the frontend from
+// gui_poll_events() for each shown frame, so they run in their own
+// coroutine. So does the emulator startup, which can bring up the GUI
+// to select another TOS image. Emulated frames run on the main thread.
+static void retro_wrap_gui(void)
+{
+   pre_main(RPATH);
+
+   if (pauseg == -1)
+      environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0);
+
+   // libco says not to return
    while(true)
    {
-      LOGI("Running a dead emulator.");
+      gui_running = false;
       co_switch(mainThread);
+      pause_select();
    }
 }
 
+// Run the GUI (or the startup) until its next frame or until it's done
+static void run_gui(void)
+{
+   gui_running = true;
+   co_switch(guiThread);
+}
+
+static void run_frame(void)
+{
+   if (pauseg == -1)
+      return;
+   if (!Main_RunFrame())
+      environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0);
+}
+
 void Emu_init()
 {
 #ifdef RETRO_AND
@@ -260,16 +844,18 @@ void Emu_init()
    memset(Key_Sate,0,512);
    memset(Key_Sate2,0,512);
 
-   if(!emuThread)
+   if(!guiThread)
       mainThread = co_active();
 
-   if(!emuThread)
-      emuThread = co_create(65536*sizeof(void*), retro_wrap_emulator);
+   if(!guiThread)
+      guiThread = co_create(65536*sizeof(void*), retro_wrap_gui);
 }
 
 void Emu_uninit()
 {
+   InputMovie_UnInit();
    texture_uninit();
+   texture_free();
 }
 
 void retro_shutdown_hatari(void)
@@ -290,6 +876,25 @@ extern bool Floppy_EjectDiskFromDrive(int Drive);
 extern const char* Floppy_SetDiskFileName(int Drive, const char *pszFileName, const char *pszZipPath);
 extern bool Floppy_InsertDiskIntoDrive(int Drive);
 
+// Load the disks around the current one in the background, so that
+// swapping to them does not have to read them. The current disk is
+// also loaded if it is about to be inserted.
+static void disk_prefetch_neighbours(bool with_current)
+{
+	const char *files[DISKPREFETCH_MAX] = { NULL, NULL, NULL };
+
+	if (!dc || dc->count < 2 || dc->index < 0)
+		return;
+
+	if (with_current)
+		files[0] = dc->files[dc->index];
+	if (dc->index + 1 < (int)dc->count)
+		files[1] = dc->files[dc->index + 1];
+	if (dc->index > 0)
+		files[2] = dc->files[dc->index - 1];
+	DiskPrefetch_Set(files, DISKPREFETCH_MAX);
+}
+
 static bool disk_set_eject_state(bool ejected)
 {
 	if (dc)
@@ -336,6 +941,7 @@ static bool disk_set_image_index(unsigned index)
 			dc->index = index;
 			Floppy_SetDiskFileName(0, dc->files[index], NULL);
 			log_cb(RETRO_LOG_INFO, "Disk (%d) inserted into drive A : %s\n", dc->index+1, dc->files[dc->index]);
+			disk_prefetch_neighbours(true);
 			return true;
 		}
 	}
@@ -355,19 +961,11 @@ static bool disk_replace_image_index(unsigned index, const struct retro_game_inf
 {
 	if (dc)
 	{
-		if (index >= dc->count)
-			return false;
-
-		if(dc->files[index])
-		{
-			free(dc->files[index]);
-			dc->files[index] = NULL;
-		}
-
 		// TODO : Handling removing of a disk image when info = NULL
+		if (!dc_replace_file(dc, index, info ? info->path : NULL))
+			return false;
 
-		if(info != NULL)
-			dc->files[index] = strdup(info->path);
+		disk_prefetch_neighbours(false);
 	}
 
     return false;
@@ -377,9 +975,10 @@ static bool disk_add_image_index(void)
 {
 	if (dc)
 	{
-		if(dc->count <= DC_MAX_SIZE)
+		if(dc->count < DC_MAX_SIZE)
 		{
 			dc->files[dc->count] = NULL;
+			dc->labels[dc->count] = NULL;
 			dc->count++;
 			return true;
 		}
@@ -388,6 +987,34 @@ static bool disk_add_image_index(void)
     return false;
 }
 
+// Disk the frontend wants inserted first, set before retro_load_game()
+static unsigned disk_initial_index = 0;
+static char disk_initial_path[RETRO_PATH_MAX];
+
+static bool disk_set_initial_image(unsigned index, const char *path)
+{
+	if (!path || !*path)
+		return false;
+
+	disk_initial_index = index;
+	snprintf(disk_initial_path, sizeof(disk_initial_path), "%s", path);
+	return true;
+}
+
+static bool disk_get_image_path(unsigned index, char *path, size_t len)
+{
+	if (!dc || len == 0 || index >= dc->count || !dc->files[index])
+		return false;
+
+	snprintf(path, len, "%s", dc->files[index]);
+	return true;
+}
+
+static bool disk_get_image_label(unsigned index, char *label, size_t len)
+{
+	return dc_get_label(dc, index, label, len);
+}
+
 static struct retro_disk_control_callback disk_interface = {
    disk_set_eject_state,
    disk_get_eject_state,
@@ -398,6 +1025,19 @@ static struct retro_disk_control_callback disk_interface = {
    disk_add_image_index,
 };
 
+static struct retro_disk_control_ext_callback disk_interface_ext = {
+   disk_set_eject_state,
+   disk_get_eject_state,
+   disk_get_image_index,
+   disk_set_image_index,
+   disk_get_num_images,
+   disk_replace_image_index,
+   disk_add_image_index,
+   disk_set_initial_image,
+   disk_get_image_path,
+   disk_get_image_label,
+};
+
 //*****************************************************************************
 //*****************************************************************************
 // Init
@@ -451,12 +1091,14 @@ void retro_init(void)
    printf("Retro SAVE_DIRECTORY %s\n",retro_save_directory);
    printf("Retro CONTENT_DIRECTORY %s\n",retro_content_directory);
 
-   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
-   if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
-   {
-      fprintf(stderr, "RGB565 is not supported.\n");
-      exit(0);
-   }
+   // Unchanged frames are not uploaded again when frontend allows it
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+      can_dupe = false;
+
+   update_pixel_format();
+
+   // Whole joypad state can then be read with a single call per frame
+   libretro_supports_bitmasks = environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL);
 
 	struct retro_input_descriptor inputDescriptors[] = {
 		{ 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A, "A" },
@@ -487,8 +1129,20 @@ void retro_init(void)
    else
       MidiRetroInterface = NULL;
 
- 	// Disk control interface
-	environ_cb(RETRO_ENVIRONMENT_SET_DISK_CONTROL_INTERFACE, &disk_interface);
+   static struct retro_microphone_interface microphone_interface;
+
+   microphone_interface.interface_version = RETRO_MICROPHONE_INTERFACE_VERSION;
+   if(environ_cb(RETRO_ENVIRONMENT_GET_MICROPHONE_INTERFACE, &microphone_interface))
+      MicrophoneRetroInterface = &microphone_interface;
+   else
+      MicrophoneRetroInterface = NULL;
+
+ 	// Disk control interface, with image labels if the frontend supports them
+	unsigned dci_version = 0;
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_DISK_CONTROL_INTERFACE_VERSION, &dci_version)
+	    || dci_version < 1
+	    || !environ_cb(RETRO_ENVIRONMENT_SET_DISK_CONTROL_EXT_INTERFACE, &disk_interface_ext))
+		environ_cb(RETRO_ENVIRONMENT_SET_DISK_CONTROL_INTERFACE, &disk_interface);
 
    // Savestates
    static uint32_t quirks = RETRO_SERIALIZATION_QUIRK_INCOMPLETE | RETRO_SERIALIZATION_QUIRK_MUST_INITIALIZE | RETRO_SERIALIZATION_QUIRK_CORE_VARIABLE_SIZE;
@@ -502,11 +1156,13 @@ void retro_init(void)
 void retro_deinit(void)
 {	 
    Emu_uninit(); 
+   Microphone_Stop();
+   Rewind_SetLength(0);
 
-   if(emuThread)
+   if(guiThread)
    {
-      co_delete(emuThread);
-      emuThread = 0;
+      co_delete(guiThread);
+      guiThread = 0;
    }
 
 	// Clean the m3u storage
@@ -544,12 +1200,24 @@ void retro_get_system_info(struct retro_system_info *info)
 
 }
 
+// Native resolution output is the emulated screen, whose pixels Hatari keeps square
+static void get_geometry(struct retro_game_geometry *geom, unsigned width, unsigned height)
+{
+   geom->base_width   = width;
+   geom->base_height  = height;
+   geom->max_width    = retrow;
+   geom->max_height   = retroh;
+   geom->aspect_ratio = hatari_native_res ? (float)width / height : 4.0 / 3.0;
+}
+
 void retro_get_system_av_info(struct retro_system_av_info *info)
 {
-   struct retro_game_geometry geom = { retrow, retroh, 1024, 1024, 4.0 / 3.0 };
-   struct retro_system_timing timing = { 50.0, 44100.0 };
+   struct retro_system_timing timing = { 50.0, RETRO_OUTPUT_RATE };
 
-   info->geometry = geom;
+   if (hatari_native_res && sdlscrn)
+      get_geometry(&info->geometry, sdlscrn->w, sdlscrn->h);
+   else
+      get_geometry(&info->geometry, retrow, retroh);
    info->timing   = timing;
 }
 
@@ -570,39 +1238,116 @@ void retro_set_video_refresh(retro_video_refresh_t cb)
 
 void retro_run(void)
 {
-   int x;
+   static unsigned prev_width = 0, prev_height = 0;
+   static bool prev_overlay = true;
+   static unsigned frames_skipped = 0;
+   static long ff_shown = 0;
    unsigned width = 640;
    unsigned height = 400;
+   bool overlay, changed, ff, ff_skip = false;
 
    bool updated = false;
+   int i;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+   {
       update_variables();
+      update_audio_buffer_status();
+   }
+
+   ff = update_fastforward();
+
+   // Turbo boot: emulate many boot frames per call, without showing them
+   for (i = 0; i < TURBOBOOT_FRAMES_PER_RUN && nTurboBootVBLs && pauseg==0 && !gui_running; i++)
+   {
+      bSkipNextFrame = true;
+      run_frame();
+   }
+   if (i > 0)
+      Sound_RetroRingFlush();
 
    if(pauseg==0)
    {
       update_input();
 
-      if(SND==1)
+      // Step back while rewind is held, otherwise record the frame start
+      if (hatari_rewind && !gui_running)
       {
-         int16_t *p=(int16_t*)SNDBUF;
+         if (rewind_held)
+            Rewind_Step();
+         else
+            Rewind_Capture();
+      }
 
-         for(x = 0; x < snd_sampler; x++)
-            audio_cb(*p++,*p++);
+      // Whole frame of samples at once, rate adjusted from the core ring
+      if(SND==1)
+      {
+         Sound_RetroRingRead(SNDBUF, snd_sampler);
+         audio_batch_cb((const int16_t*)SNDBUF, snd_sampler);
       }
    }
 
-   if(ConfigureParams.Screen.bAllowOverscan || SHOWKEY==1 || STATUTON==1 || pauseg==1 )
+   // Overlays & GUI are drawn into bmp outside of the emulated screen updates
+   overlay = (SHOWKEY==1 || STATUTON==1 || pauseg==1);
+
+   if (hatari_native_res && sdlscrn && !overlay)
+   {
+      width  = sdlscrn->w;
+      height = sdlscrn->h;
+   }
+   else if(ConfigureParams.Screen.bAllowOverscan || overlay)
    {
       width  = retrow;
       height = retroh;
    }
-   video_cb(bmp, width, height, retrow<< 1);
 
-   co_switch(emuThread);
+   if (hatari_native_res && (width != prev_width || height != prev_height))
+   {
+      struct retro_game_geometry geom;
+      get_geometry(&geom, width, height);
+      environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &geom);
+   }
+
+   changed = Screen_CheckUpdated();
+   if (ConfigureParams.Screen.bHeadless)
+      ;  // test runs only want frame hashes, nothing is shown
+   else if (!can_dupe || changed || overlay || prev_overlay
+       || width != prev_width || height != prev_height)
+      video_cb(bmp, width, height, retrow * PIXEL_BYTES);
+   else
+      video_cb(NULL, width, height, retrow * PIXEL_BYTES);
+   prev_overlay = overlay;
+   prev_width = width;
+   prev_height = height;
+
+   // When audio is about to run dry, next frame is emulated but not drawn
+   if (hatari_frameskip_audio && audio_buffer_active && audio_underrun_likely
+       && pauseg==0 && frames_skipped < FRAMESKIP_AUDIO_MAX)
+      frames_skipped++;
+   else
+      frames_skipped = 0;
+
+   // While fast-forwarding, the frontend shows only some of the frames,
+   // so draw at most about one per host refresh
+   if (ff && !overlay)
+   {
+      long now = GetTicks();
+      if (now - ff_shown < FASTFORWARD_SHOW_MS)
+         ff_skip = true;
+      else
+         ff_shown = now;
+   }
+   bSkipNextFrame = (frames_skipped > 0) || ff_skip;
+
+   // Shown frame is done, convert next one while emulating the one after it
+   Screen_ConvertThread(hatari_video_thread && pauseg==0);
+   if (gui_running || pauseg==1)
+      run_gui();
+   else
+      run_frame();
+   Screen_ConvertWait();
 
-   if (MidiRetroInterface && MidiRetroInterface->output_enabled())
-      MidiRetroInterface->flush();
+   Midi_UpdateFrame();
   
    if (firstpass)
       firstpass=0;
@@ -610,6 +1355,53 @@ void retro_run(void)
 
 #define M3U_FILE_EXT "m3u"
 
+// Publish emulated memory areas for achievements, cheats and debugging tools
+static void update_memory_maps(void)
+{
+   static struct retro_memory_descriptor desc[4];
+   static struct retro_memory_map mmap;
+   uae_u32 ttram_size;
+   uae_u8 *ttram = memory_get_ttmemory(&ttram_size);
+   unsigned n = 0;
+
+   memset(desc, 0, sizeof(desc));
+
+   desc[n].flags = RETRO_MEMDESC_SYSTEM_RAM | RETRO_MEMDESC_BIGENDIAN;
+   desc[n].ptr = STRam;
+   desc[n].start = 0;
+   desc[n].len = STRamEnd;
+   desc[n].addrspace = "STRAM";
+   n++;
+
+   if (ttram)
+   {
+      desc[n].flags = RETRO_MEMDESC_BIGENDIAN;
+      desc[n].ptr = ttram;
+      desc[n].start = 0x01000000;
+      desc[n].len = ttram_size;
+      desc[n].addrspace = "TTRAM";
+      n++;
+   }
+
+   desc[n].flags = RETRO_MEMDESC_CONST | RETRO_MEMDESC_BIGENDIAN;
+   desc[n].ptr = &RomMem[TosAddress];
+   desc[n].start = TosAddress;
+   desc[n].len = TosSize;
+   desc[n].addrspace = "ROM";
+   n++;
+
+   desc[n].flags = RETRO_MEMDESC_BIGENDIAN;
+   desc[n].ptr = &IoMem[0xff8000];
+   desc[n].start = 0xff8000;
+   desc[n].len = 0x8000;
+   desc[n].addrspace = "IO";
+   n++;
+
+   mmap.descriptors = desc;
+   mmap.num_descriptors = n;
+   environ_cb(RETRO_ENVIRONMENT_SET_MEMORY_MAPS, &mmap);
+}
+
 bool retro_load_game(const struct retro_game_info *info)
 {
    // Init
@@ -649,13 +1441,22 @@ bool retro_load_game(const struct retro_game_info *info)
 		dc_add_file(dc, full_path);
 	}
 
-	// Init first disk
+	// Init first disk, or the one the frontend remembered for this content
 	dc->index = 0;
+	if (disk_initial_index > 0 && disk_initial_index < dc->count
+	    && dc->files[disk_initial_index]
+	    && strcmp(dc->files[disk_initial_index], disk_initial_path) == 0)
+		dc->index = disk_initial_index;
 	dc->eject_state = false;
 	log_cb(RETRO_LOG_INFO, "Disk (%d) inserted into drive A : %s\n", dc->index+1, dc->files[dc->index]);
-	strcpy(RPATH,dc->files[0]);
+	strcpy(RPATH,dc->files[dc->index]);
+	disk_prefetch_neighbours(true);
+
+	run_gui();
 
-	co_switch(emuThread);
+   // Machine memory is set up now
+   update_memory_maps();
+   update_audio_buffer_status();
 
    return true;
 }
@@ -678,75 +1479,57 @@ bool retro_load_game_special(unsigned type, const struct retro_game_info *info,
    return false;
 }
 
+// Frontend asks for fast savestates for run-ahead & netplay, they're
+// only loaded by the same instance and can leave out host side state
+static bool fast_savestates(void)
+{
+   int flags = 0;
+
+   return environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &flags) && (flags & 4);
+}
+
 size_t retro_serialize_size(void)
 {
    if (firstpass != 1)
-   {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      MemorySnapShot_Capture(savestate_fname, false);
-	  FILE *file = fopen(savestate_fname, "rb");
-	  if (file)
-	  {
-		 size_t size = 0;
-		 fseek(file, 0L, SEEK_END);
-		 size = ftell(file);
-		 fclose(file);
-		 return size;
-	  }
-   }
+      return MemorySnapShot_MemorySize(fast_savestates());
    return 0;
 }
 
 bool retro_serialize(void *data_, size_t size)
 {
-   if (firstpass != 1)
-   {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      MemorySnapShot_Capture(savestate_fname, false);
-	  FILE *file = fopen(savestate_fname, "rb");
-	  if (file)
-	  {
-		 if (fread(data_, size, 1, file) == 1)
-		 {
-		    fclose(file);
-		    return true;
-		 }
-		 fclose(file);
-	  }
-   }
-   return false;
+   Uint64 start = PerfCount_Now();
+   bool ok;
+
+   if (firstpass == 1)
+      return false;
+   ok = MemorySnapShot_CaptureMemory(data_, size, fast_savestates());
+   Metrics_Snapshot(true, start);
+   return ok;
 }
 
 bool retro_unserialize(const void *data_, size_t size)
 {
-   if (firstpass != 1)
-   {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      FILE *file = fopen(savestate_fname, "wb");
-      if (file)
-      {
-         if (fwrite(data_, size, 1, file) == 1)
-         {
-            fclose(file);
-            MemorySnapShot_Restore(savestate_fname, false);
-            return true;
-         }
-         else
-            fclose(file);
-      }
-   }
-   return false;
+   Uint64 start = PerfCount_Now();
+   bool ok;
+
+   if (firstpass == 1)
+      return false;
+   ok = MemorySnapShot_RestoreMemory(data_, size);
+   Metrics_Snapshot(false, start);
+   return ok;
 }
 
 void *retro_get_memory_data(unsigned id)
 {
-   (void)id;
+   if (id == RETRO_MEMORY_SYSTEM_RAM)
+      return STRam;
    return NULL;
 }
 
 size_t retro_get_memory_size(unsigned id)
 {
-   (void)id;
+   if (id == RETRO_MEMORY_SYSTEM_RAM)
+      return STRamEnd;
    return 0;
 }
 
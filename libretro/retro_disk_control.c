@@ -32,6 +32,7 @@
 
 #define COMMENT "#"
 #define M3U_SPECIAL_COMMAND "#COMMAND:"
+#define M3U_LABEL_SEPARATOR '|'
 
 // Return the directory name of filename 'filename'.
 char* dirname_int(const char* filename)
@@ -104,6 +105,8 @@ void dc_reset(dc_storage* dc)
 	{
 		free(dc->files[i]);
 		dc->files[i] = NULL;
+		free(dc->labels[i]);
+		dc->labels[i] = NULL;
 	}
 	dc->count = 0;
 	dc->index = -1;
@@ -124,13 +127,14 @@ dc_storage* dc_create(void)
 		for(int i = 0; i < DC_MAX_SIZE; i++)
 		{
 			dc->files[i] = NULL;
+			dc->labels[i] = NULL;
 		}
 	}
 	
 	return dc;
 }
 
-bool dc_add_file_int(dc_storage* dc, char* filename)
+bool dc_add_file_int(dc_storage* dc, char* filename, char* label)
 {
 	// Verify
 	if(dc == NULL)
@@ -145,6 +149,7 @@ bool dc_add_file_int(dc_storage* dc, char* filename)
 		// Add the file
 		dc->count++;
 		dc->files[dc->count-1] = filename;
+		dc->labels[dc->count-1] = label;
 		return true;
 	}
 	
@@ -163,7 +168,68 @@ bool dc_add_file(dc_storage* dc, const char* filename)
 	// Copy and return
 	char* filename_int = calloc(strlen(filename) + 1, sizeof(char));
 	strcpy(filename_int, filename);
-	return dc_add_file_int(dc, filename_int);
+	if (dc_add_file_int(dc, filename_int, NULL))
+		return true;
+	free(filename_int);
+	return false;
+}
+
+bool dc_replace_file(dc_storage* dc, unsigned index, const char* filename)
+{
+	// Verify
+	if(dc == NULL)
+		return false;
+
+	if(index >= dc->count)
+		return false;
+
+	// The label came with the old file
+	free(dc->files[index]);
+	dc->files[index] = NULL;
+	free(dc->labels[index]);
+	dc->labels[index] = NULL;
+
+	if(filename != NULL)
+		dc->files[index] = strdup(filename);
+	return true;
+}
+
+// Label of an image: the one given in the m3u file, or the file name
+// without directory and extension. This doesn't need to access the
+// image, so frontends can show the labels while browsing.
+bool dc_get_label(dc_storage* dc, unsigned index, char* label, size_t len)
+{
+	const char* name;
+	const char* ext;
+	size_t name_len;
+
+	// Verify
+	if(dc == NULL || label == NULL || len == 0)
+		return false;
+
+	if(index >= dc->count || dc->files[index] == NULL)
+		return false;
+
+	if(dc->labels[index])
+	{
+		snprintf(label, len, "%s", dc->labels[index]);
+		return true;
+	}
+
+	name = strrchr(dc->files[index], RETRO_PATH_SEPARATOR[0]);
+#ifdef _WIN32
+	if (name == NULL)
+		name = strrchr(dc->files[index], RETRO_PATH_SEPARATOR_ALT[0]);
+#endif
+	name = name ? name + 1 : dc->files[index];
+
+	ext = strrchr(name, '.');
+	name_len = (ext && ext != name) ? (size_t)(ext - name) : strlen(name);
+	if(name_len >= len)
+		name_len = len - 1;
+	memcpy(label, name, name_len);
+	label[name_len] = '\0';
+	return true;
 }
 
 void dc_parse_m3u(dc_storage* dc, const char* m3u_file)
@@ -200,14 +266,30 @@ void dc_parse_m3u(dc_storage* dc, const char* m3u_file)
 		}
 		else if (!strstartswith(string, COMMENT))
 		{
+			// Optional label after the file name: "disk1.st|Disk A"
+			char* label = NULL;
+			char* separator = strchr(string, M3U_LABEL_SEPARATOR);
+			if (separator != NULL)
+			{
+				*separator = '\0';
+				string = trimwhitespace(string);
+				label = trimwhitespace(separator + 1);
+				label = *label ? strdup(label) : NULL;
+			}
+
 			// Search the file (absolute, relative to m3u)
 			char* filename;
 			if ((filename = m3u_search_file(basedir, string)) != NULL)
 			{
 				// Add the file to the struct
-				dc_add_file_int(dc, filename);
+				if (!dc_add_file_int(dc, filename, label))
+				{
+					free(filename);
+					free(label);
+				}
 			}
-
+			else
+				free(label);
 		}
 	}
 	
@@ -20,14 +20,16 @@
 #define RETRO_DISK_CONTROL_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 
 //*****************************************************************************
 // Disk control structure and functions
-#define DC_MAX_SIZE 20
+#define DC_MAX_SIZE 64
 
 struct dc_storage{
 	char* command;
 	char* files[DC_MAX_SIZE];
+	char* labels[DC_MAX_SIZE];
 	unsigned count;
 	int index;
 	bool eject_state;
@@ -37,6 +39,8 @@ typedef struct dc_storage dc_storage;
 dc_storage* dc_create(void);
 void dc_parse_m3u(dc_storage* dc, const char* m3u_file);
 bool dc_add_file(dc_storage* dc, const char* filename);
+bool dc_replace_file(dc_storage* dc, unsigned index, const char* filename);
+bool dc_get_label(dc_storage* dc, unsigned index, char* label, size_t len);
 void dc_free(dc_storage* dc);
 
 #endif
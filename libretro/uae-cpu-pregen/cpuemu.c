@@ -428,7 +428,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b9_0)(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_d0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 8;  
@@ -446,7 +446,7 @@ m68k_incpc(4);
 }}}endlabel27: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e8_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -464,7 +464,7 @@ m68k_incpc(6);
 }}}endlabel28: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -483,7 +483,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f0_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel29: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f8_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
 {	uaecptr oldpc = m68k_getpc();
@@ -500,7 +500,7 @@ m68k_incpc(6);
 }}}endlabel30: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f9_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f9_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 16; 
 {	uaecptr oldpc = m68k_getpc();
@@ -517,7 +517,7 @@ m68k_incpc(8);
 }}}endlabel31: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_fa_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_fa_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -536,7 +536,7 @@ m68k_incpc(6);
 }}}endlabel32: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_fb_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_fb_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -556,7 +556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_fb_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel33: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_100_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_100_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -582,7 +582,7 @@ unsigned long REGPARAM2 CPUFUNC(op_108_0)(uae_u32 opcode) /* MVPMR */
 }}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_110_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_110_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -595,7 +595,7 @@ unsigned long REGPARAM2 CPUFUNC(op_110_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_118_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_118_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -609,7 +609,7 @@ unsigned long REGPARAM2 CPUFUNC(op_118_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_120_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_120_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -623,7 +623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_120_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_128_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_128_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -636,7 +636,7 @@ unsigned long REGPARAM2 CPUFUNC(op_128_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_130_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_130_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -650,7 +650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_130_0)(uae_u32 opcode) /* BTST */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_138_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_138_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -662,7 +662,7 @@ unsigned long REGPARAM2 CPUFUNC(op_138_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_139_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_139_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -674,7 +674,7 @@ unsigned long REGPARAM2 CPUFUNC(op_139_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13a_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13a_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -688,7 +688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13a_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13b_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13b_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -703,7 +703,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13b_0)(uae_u32 opcode) /* BTST */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 8;  
@@ -1622,7 +1622,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b9_0)(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2d0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2d0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 8;  
@@ -1640,7 +1640,7 @@ m68k_incpc(4);
 }}}endlabel105: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2e8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2e8_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -1658,7 +1658,7 @@ m68k_incpc(6);
 }}}endlabel106: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2f0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2f0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -1677,7 +1677,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2f0_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel107: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2f8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2f8_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
 {	uaecptr oldpc = m68k_getpc();
@@ -1694,7 +1694,7 @@ m68k_incpc(6);
 }}}endlabel108: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2f9_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2f9_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 16; 
 {	uaecptr oldpc = m68k_getpc();
@@ -1711,7 +1711,7 @@ m68k_incpc(8);
 }}}endlabel109: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2fa_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2fa_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -1730,7 +1730,7 @@ m68k_incpc(6);
 }}}endlabel110: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2fb_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_2fb_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -1750,7 +1750,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2fb_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel111: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -1770,7 +1770,7 @@ unsigned long REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -1791,7 +1791,7 @@ unsigned long REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -1813,7 +1813,7 @@ unsigned long REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -1835,7 +1835,7 @@ unsigned long REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -1856,7 +1856,7 @@ unsigned long REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -1878,7 +1878,7 @@ unsigned long REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB */
 	put_byte(dsta,newv);
 }}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte(2);
@@ -1898,7 +1898,7 @@ unsigned long REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
 {{	uae_s8 src = get_ibyte(2);
@@ -1918,7 +1918,7 @@ unsigned long REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -1938,7 +1938,7 @@ unsigned long REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -1959,7 +1959,7 @@ unsigned long REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -1981,7 +1981,7 @@ unsigned long REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -2003,7 +2003,7 @@ unsigned long REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -2024,7 +2024,7 @@ unsigned long REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -2046,7 +2046,7 @@ unsigned long REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB */
 	put_word(dsta,newv);
 }}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -2066,7 +2066,7 @@ unsigned long REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword(2);
@@ -2086,7 +2086,7 @@ unsigned long REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -2106,7 +2106,7 @@ unsigned long REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -2127,7 +2127,7 @@ unsigned long REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -2149,7 +2149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 30; 
@@ -2171,7 +2171,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 32; 
@@ -2192,7 +2192,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 34; 
@@ -2214,7 +2214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB */
 	put_long(dsta,newv);
 }}}}}}}}return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 32; 
 {{	uae_s32 src = get_ilong(2);
@@ -2234,7 +2234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 36; 
 {{	uae_s32 src = get_ilong(2);
@@ -2254,7 +2254,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4d0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4d0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 8;  
@@ -2271,7 +2271,7 @@ m68k_incpc(4);
 }}}endlabel136: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e8_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -2288,7 +2288,7 @@ m68k_incpc(6);
 }}}endlabel137: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4f0_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4f0_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -2306,7 +2306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4f0_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel138: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4f8_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4f8_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
 {	uaecptr oldpc = m68k_getpc();
@@ -2322,7 +2322,7 @@ m68k_incpc(6);
 }}}endlabel139: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4f9_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4f9_0)(uae_u32 opcode) /* CHK2 */
 {
 	OpcodeFamily = 81; CurrentInstrCycles = 16; 
 {	uaecptr oldpc = m68k_getpc();
@@ -2338,7 +2338,7 @@ m68k_incpc(8);
 }}}endlabel140: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4fa_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4fa_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 81; CurrentInstrCycles = 12; 
@@ -2356,7 +2356,7 @@ m68k_incpc(6);
 }}}endlabel141: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4fb_0)(uae_u32 opcode) /* CHK2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4fb_0)(uae_u32 opcode) /* CHK2 */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 81; CurrentInstrCycles = 14; 
@@ -2375,7 +2375,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4fb_0)(uae_u32 opcode) /* CHK2 */
 }}}}endlabel142: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -2395,7 +2395,7 @@ unsigned long REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -2416,7 +2416,7 @@ unsigned long REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -2438,7 +2438,7 @@ unsigned long REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -2460,7 +2460,7 @@ unsigned long REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -2481,7 +2481,7 @@ unsigned long REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -2503,7 +2503,7 @@ unsigned long REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD */
 	put_byte(dsta,newv);
 }}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte(2);
@@ -2523,7 +2523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
 {{	uae_s8 src = get_ibyte(2);
@@ -2543,7 +2543,7 @@ unsigned long REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -2563,7 +2563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -2584,7 +2584,7 @@ unsigned long REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -2606,7 +2606,7 @@ unsigned long REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -2628,7 +2628,7 @@ unsigned long REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -2649,7 +2649,7 @@ unsigned long REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -2671,7 +2671,7 @@ unsigned long REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD */
 	put_word(dsta,newv);
 }}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -2691,7 +2691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword(2);
@@ -2711,7 +2711,7 @@ unsigned long REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -2731,7 +2731,7 @@ unsigned long REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -2752,7 +2752,7 @@ unsigned long REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -2774,7 +2774,7 @@ unsigned long REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 30; 
@@ -2796,7 +2796,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 32; 
@@ -2817,7 +2817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 34; 
@@ -2839,7 +2839,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD */
 	put_long(dsta,newv);
 }}}}}}}}return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 32; 
 {{	uae_s32 src = get_ilong(2);
@@ -2859,7 +2859,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 36; 
 {{	uae_s32 src = get_ilong(2);
@@ -2879,7 +2879,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c0_0)(uae_u32 opcode) /* RTM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6c0_0)(uae_u32 opcode) /* RTM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 101; CurrentInstrCycles = 4;  
@@ -2887,7 +2887,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6c0_0)(uae_u32 opcode) /* RTM */
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c8_0)(uae_u32 opcode) /* RTM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6c8_0)(uae_u32 opcode) /* RTM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 101; CurrentInstrCycles = 4;  
@@ -2895,7 +2895,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6c8_0)(uae_u32 opcode) /* RTM */
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6d0_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6d0_0)(uae_u32 opcode) /* CALLM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
@@ -2903,7 +2903,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6d0_0)(uae_u32 opcode) /* CALLM */
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6e8_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6e8_0)(uae_u32 opcode) /* CALLM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
@@ -2911,7 +2911,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6e8_0)(uae_u32 opcode) /* CALLM */
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f0_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6f0_0)(uae_u32 opcode) /* CALLM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
@@ -2919,35 +2919,35 @@ unsigned long REGPARAM2 CPUFUNC(op_6f0_0)(uae_u32 opcode) /* CALLM */
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f8_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6f8_0)(uae_u32 opcode) /* CALLM */
 {
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f9_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6f9_0)(uae_u32 opcode) /* CALLM */
 {
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6fa_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6fa_0)(uae_u32 opcode) /* CALLM */
 {
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6fb_0)(uae_u32 opcode) /* CALLM */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_6fb_0)(uae_u32 opcode) /* CALLM */
 {
 	OpcodeFamily = 100; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
 	op_illg(opcode);
 }return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_800_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_800_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 10; 
@@ -2958,7 +2958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_800_0)(uae_u32 opcode) /* BTST */
 }}}m68k_incpc(4);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_810_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_810_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -2970,7 +2970,7 @@ unsigned long REGPARAM2 CPUFUNC(op_810_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_818_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_818_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -2983,7 +2983,7 @@ unsigned long REGPARAM2 CPUFUNC(op_818_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_820_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_820_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 14; 
@@ -2996,7 +2996,7 @@ unsigned long REGPARAM2 CPUFUNC(op_820_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_828_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_828_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -3008,7 +3008,7 @@ unsigned long REGPARAM2 CPUFUNC(op_828_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_830_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_830_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -3021,7 +3021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_830_0)(uae_u32 opcode) /* BTST */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_838_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_838_0)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword(2);
@@ -3032,7 +3032,7 @@ unsigned long REGPARAM2 CPUFUNC(op_838_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_839_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_839_0)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -3043,7 +3043,7 @@ unsigned long REGPARAM2 CPUFUNC(op_839_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(8);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83a_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83a_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -3056,7 +3056,7 @@ unsigned long REGPARAM2 CPUFUNC(op_83a_0)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83b_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83b_0)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -3070,7 +3070,7 @@ unsigned long REGPARAM2 CPUFUNC(op_83b_0)(uae_u32 opcode) /* BTST */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83c_0)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83c_0)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -3920,7 +3920,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab9_0)(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 16; 
@@ -3942,7 +3942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 16; 
@@ -3965,7 +3965,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 18; 
@@ -3988,7 +3988,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 20; 
@@ -4010,7 +4010,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 22; 
@@ -4033,7 +4033,7 @@ unsigned long REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS */
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -4054,7 +4054,7 @@ unsigned long REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword(2);
@@ -4075,7 +4075,7 @@ unsigned long REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -4092,7 +4092,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -4110,7 +4110,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -4129,7 +4129,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -4148,7 +4148,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -4166,7 +4166,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -4185,7 +4185,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
 {{	uae_s8 src = get_ibyte(2);
@@ -4202,7 +4202,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte(2);
@@ -4219,7 +4219,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -4238,7 +4238,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -4258,7 +4258,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -4275,7 +4275,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -4293,7 +4293,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -4312,7 +4312,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -4331,7 +4331,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -4349,7 +4349,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -4368,7 +4368,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword(2);
@@ -4385,7 +4385,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -4402,7 +4402,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -4421,7 +4421,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -4441,7 +4441,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -4458,7 +4458,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -4476,7 +4476,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -4495,7 +4495,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 22; 
@@ -4514,7 +4514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
@@ -4532,7 +4532,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -4551,7 +4551,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
 {{	uae_s32 src = get_ilong(2);
@@ -4568,7 +4568,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 28; 
 {{	uae_s32 src = get_ilong(2);
@@ -4585,7 +4585,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(10);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
@@ -4604,7 +4604,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -4624,7 +4624,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 16; 
@@ -4646,7 +4646,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 16; 
@@ -4669,7 +4669,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 18; 
@@ -4692,7 +4692,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 20; 
@@ -4714,7 +4714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 22; 
@@ -4737,7 +4737,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS */
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -4758,7 +4758,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword(2);
@@ -4779,7 +4779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2 */
 {
 	OpcodeFamily = 85; CurrentInstrCycles = 12; 
 {{	uae_s32 extra = get_ilong(2);
@@ -4814,7 +4814,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2 */
 }}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e10_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e10_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 16; 
@@ -4835,7 +4835,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e10_0)(uae_u32 opcode) /* MOVES */
 endlabel288: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e18_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e18_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 16; 
@@ -4858,7 +4858,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e18_0)(uae_u32 opcode) /* MOVES */
 endlabel289: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e20_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e20_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 20; 
@@ -4881,7 +4881,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e20_0)(uae_u32 opcode) /* MOVES */
 endlabel290: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e28_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e28_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
@@ -4902,7 +4902,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e28_0)(uae_u32 opcode) /* MOVES */
 endlabel291: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 28; 
@@ -4925,7 +4925,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES */
 }}}}}}}endlabel292: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e38_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e38_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel293; }
@@ -4945,7 +4945,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e38_0)(uae_u32 opcode) /* MOVES */
 endlabel293: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e39_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e39_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 32; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel294; }
@@ -4965,7 +4965,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e39_0)(uae_u32 opcode) /* MOVES */
 endlabel294: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e50_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e50_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 16; 
@@ -4986,7 +4986,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e50_0)(uae_u32 opcode) /* MOVES */
 endlabel295: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e58_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e58_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 16; 
@@ -5009,7 +5009,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e58_0)(uae_u32 opcode) /* MOVES */
 endlabel296: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e60_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e60_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 20; 
@@ -5032,7 +5032,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e60_0)(uae_u32 opcode) /* MOVES */
 endlabel297: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e68_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e68_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
@@ -5053,7 +5053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e68_0)(uae_u32 opcode) /* MOVES */
 endlabel298: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 28; 
@@ -5076,7 +5076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES */
 }}}}}}}endlabel299: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e78_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e78_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel300; }
@@ -5096,7 +5096,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e78_0)(uae_u32 opcode) /* MOVES */
 endlabel300: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e79_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e79_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 32; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel301; }
@@ -5116,7 +5116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e79_0)(uae_u32 opcode) /* MOVES */
 endlabel301: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e90_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e90_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
@@ -5137,7 +5137,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e90_0)(uae_u32 opcode) /* MOVES */
 endlabel302: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e98_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_e98_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 24; 
@@ -5160,7 +5160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e98_0)(uae_u32 opcode) /* MOVES */
 endlabel303: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ea0_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ea0_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 28; 
@@ -5183,7 +5183,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ea0_0)(uae_u32 opcode) /* MOVES */
 endlabel304: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ea8_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ea8_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 32; 
@@ -5204,7 +5204,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ea8_0)(uae_u32 opcode) /* MOVES */
 endlabel305: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 103; CurrentInstrCycles = 36; 
@@ -5227,7 +5227,7 @@ unsigned long REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES */
 }}}}}}}endlabel306: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_eb8_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_eb8_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 32; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel307; }
@@ -5247,7 +5247,7 @@ unsigned long REGPARAM2 CPUFUNC(op_eb8_0)(uae_u32 opcode) /* MOVES */
 endlabel307: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_eb9_0)(uae_u32 opcode) /* MOVES */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_eb9_0)(uae_u32 opcode) /* MOVES */
 {
 	OpcodeFamily = 103; CurrentInstrCycles = 40; 
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel308; }
@@ -5267,7 +5267,7 @@ unsigned long REGPARAM2 CPUFUNC(op_eb9_0)(uae_u32 opcode) /* MOVES */
 endlabel308: ;
 return 40;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 24; 
@@ -5289,7 +5289,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 24; 
@@ -5312,7 +5312,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 26; 
@@ -5335,7 +5335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 28; 
@@ -5357,7 +5357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 84; CurrentInstrCycles = 30; 
@@ -5380,7 +5380,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS */
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 28; 
 {{	uae_s16 src = get_iword(2);
@@ -5401,7 +5401,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS */
 {
 	OpcodeFamily = 84; CurrentInstrCycles = 32; 
 {{	uae_s16 src = get_iword(2);
@@ -5422,7 +5422,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS */
 }}}}}}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2 */
 {
 	OpcodeFamily = 85; CurrentInstrCycles = 12; 
 {{	uae_s32 extra = get_ilong(2);
@@ -5457,7 +5457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2 */
 }}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5470,7 +5470,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1008_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1008_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5483,7 +5483,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1008_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5497,7 +5497,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5512,7 +5512,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5527,7 +5527,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5541,7 +5541,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5556,7 +5556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -5569,7 +5569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -5582,7 +5582,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -5596,7 +5596,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -5611,7 +5611,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
@@ -5623,7 +5623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5637,7 +5637,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1088_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1088_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5651,7 +5651,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1088_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5666,7 +5666,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5682,7 +5682,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5698,7 +5698,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5713,7 +5713,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5729,7 +5729,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -5743,7 +5743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -5757,7 +5757,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -5772,7 +5772,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -5788,7 +5788,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -5801,7 +5801,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5816,7 +5816,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5831,7 +5831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5847,7 +5847,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5864,7 +5864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5881,7 +5881,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5897,7 +5897,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5914,7 +5914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -5929,7 +5929,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -5944,7 +5944,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -5960,7 +5960,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -5977,7 +5977,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -5991,7 +5991,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6006,7 +6006,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1108_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1108_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6021,7 +6021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1108_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6037,7 +6037,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6054,7 +6054,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6071,7 +6071,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6087,7 +6087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6104,7 +6104,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6119,7 +6119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6134,7 +6134,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6150,7 +6150,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -6167,7 +6167,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -6181,7 +6181,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6195,7 +6195,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1148_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1148_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6209,7 +6209,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1148_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6224,7 +6224,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6240,7 +6240,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6256,7 +6256,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6271,7 +6271,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6288,7 +6288,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6302,7 +6302,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -6316,7 +6316,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6331,7 +6331,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -6348,7 +6348,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6361,7 +6361,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6376,7 +6376,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1188_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1188_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6391,7 +6391,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1188_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6407,7 +6407,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6424,7 +6424,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6441,7 +6441,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6457,7 +6457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6474,7 +6474,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -6489,7 +6489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -6504,7 +6504,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -6520,7 +6520,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -6537,7 +6537,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -6551,7 +6551,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE */
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -6564,7 +6564,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -6577,7 +6577,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6591,7 +6591,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6606,7 +6606,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -6621,7 +6621,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6635,7 +6635,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -6651,7 +6651,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6664,7 +6664,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = get_ilong(2);
@@ -6677,7 +6677,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6691,7 +6691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{m68k_incpc(2);
@@ -6707,7 +6707,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uae_s8 src = get_ibyte(2);
@@ -6719,7 +6719,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6732,7 +6732,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6745,7 +6745,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6759,7 +6759,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -6774,7 +6774,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -6789,7 +6789,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -6803,7 +6803,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -6819,7 +6819,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6832,7 +6832,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong(2);
@@ -6845,7 +6845,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6859,7 +6859,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{m68k_incpc(2);
@@ -6875,7 +6875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte(2);
@@ -6887,7 +6887,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6900,7 +6900,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6913,7 +6913,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6927,7 +6927,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6942,7 +6942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6957,7 +6957,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6971,7 +6971,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6986,7 +6986,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -6999,7 +6999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -7012,7 +7012,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -7026,7 +7026,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -7041,7 +7041,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -7053,7 +7053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2040_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2040_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7064,7 +7064,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2040_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2048_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2048_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7075,7 +7075,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2048_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2050_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2050_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7087,7 +7087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2050_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2058_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2058_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7100,7 +7100,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2058_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2060_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2060_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7113,7 +7113,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2060_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2068_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2068_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7125,7 +7125,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2068_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2070_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2070_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7138,7 +7138,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2070_0)(uae_u32 opcode) /* MOVEA */
 	m68k_areg(regs, dstreg) = (val);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2078_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2078_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -7149,7 +7149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2078_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2079_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2079_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 20; 
@@ -7160,7 +7160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2079_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207a_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207a_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -7172,7 +7172,7 @@ unsigned long REGPARAM2 CPUFUNC(op_207a_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207b_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207b_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 18; 
@@ -7185,7 +7185,7 @@ unsigned long REGPARAM2 CPUFUNC(op_207b_0)(uae_u32 opcode) /* MOVEA */
 	m68k_areg(regs, dstreg) = (val);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207c_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207c_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -7195,7 +7195,7 @@ unsigned long REGPARAM2 CPUFUNC(op_207c_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7209,7 +7209,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7223,7 +7223,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7238,7 +7238,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7254,7 +7254,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7270,7 +7270,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7285,7 +7285,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7301,7 +7301,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7315,7 +7315,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -7329,7 +7329,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7344,7 +7344,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -7360,7 +7360,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -7373,7 +7373,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7388,7 +7388,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7403,7 +7403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7419,7 +7419,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7436,7 +7436,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7453,7 +7453,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7469,7 +7469,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7486,7 +7486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7501,7 +7501,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -7516,7 +7516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7532,7 +7532,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -7549,7 +7549,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -7563,7 +7563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7578,7 +7578,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7593,7 +7593,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7609,7 +7609,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7626,7 +7626,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7643,7 +7643,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7659,7 +7659,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7676,7 +7676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7694,7 +7694,7 @@ return 24;
 #endif
 
 #ifdef PART_3
-unsigned long REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -7709,7 +7709,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7725,7 +7725,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -7742,7 +7742,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -7756,7 +7756,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7770,7 +7770,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7784,7 +7784,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7799,7 +7799,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7815,7 +7815,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7831,7 +7831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7846,7 +7846,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7863,7 +7863,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -7877,7 +7877,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -7891,7 +7891,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -7906,7 +7906,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -7923,7 +7923,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -7936,7 +7936,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7951,7 +7951,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7966,7 +7966,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7982,7 +7982,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7999,7 +7999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8016,7 +8016,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8032,7 +8032,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8049,7 +8049,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}}return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -8064,7 +8064,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -8079,7 +8079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -8095,7 +8095,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -8112,7 +8112,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}}}return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -8126,7 +8126,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE */
 	put_long(dsta,src);
 }}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -8139,7 +8139,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -8152,7 +8152,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -8166,7 +8166,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -8181,7 +8181,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -8196,7 +8196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -8210,7 +8210,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -8226,7 +8226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -8239,7 +8239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = get_ilong(2);
@@ -8252,7 +8252,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -8266,7 +8266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
 {{m68k_incpc(2);
@@ -8282,7 +8282,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uae_s32 src = get_ilong(2);
@@ -8294,7 +8294,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -8307,7 +8307,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -8320,7 +8320,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -8334,7 +8334,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -8349,7 +8349,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -8364,7 +8364,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -8378,7 +8378,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -8394,7 +8394,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -8407,7 +8407,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 36; 
 {{	uaecptr srca = get_ilong(2);
@@ -8420,7 +8420,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -8434,7 +8434,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
 {{m68k_incpc(2);
@@ -8450,7 +8450,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uae_s32 src = get_ilong(2);
@@ -8462,7 +8462,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(10);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8475,7 +8475,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8488,7 +8488,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8502,7 +8502,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8517,7 +8517,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8532,7 +8532,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8546,7 +8546,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8561,7 +8561,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -8574,7 +8574,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -8587,7 +8587,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -8601,7 +8601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -8616,7 +8616,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
@@ -8628,7 +8628,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3040_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3040_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8639,7 +8639,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3040_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3048_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3048_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8650,7 +8650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3048_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3050_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3050_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8662,7 +8662,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3050_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3058_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3058_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8675,7 +8675,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3058_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3060_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3060_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8688,7 +8688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3060_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3068_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3068_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8700,7 +8700,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3068_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3070_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3070_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8713,7 +8713,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3070_0)(uae_u32 opcode) /* MOVEA */
 	m68k_areg(regs, dstreg) = (val);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3078_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3078_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -8724,7 +8724,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3078_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3079_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3079_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -8735,7 +8735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3079_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307a_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307a_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -8747,7 +8747,7 @@ unsigned long REGPARAM2 CPUFUNC(op_307a_0)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307b_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307b_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 14; 
@@ -8760,7 +8760,7 @@ unsigned long REGPARAM2 CPUFUNC(op_307b_0)(uae_u32 opcode) /* MOVEA */
 	m68k_areg(regs, dstreg) = (val);
 }}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307c_0)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307c_0)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 8;  
@@ -8770,7 +8770,7 @@ unsigned long REGPARAM2 CPUFUNC(op_307c_0)(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8784,7 +8784,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8798,7 +8798,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8813,7 +8813,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8829,7 +8829,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8845,7 +8845,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8860,7 +8860,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8876,7 +8876,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -8890,7 +8890,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -8904,7 +8904,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -8919,7 +8919,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -8935,7 +8935,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -8948,7 +8948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8963,7 +8963,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8978,7 +8978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8994,7 +8994,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9011,7 +9011,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9028,7 +9028,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9044,7 +9044,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9061,7 +9061,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9076,7 +9076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9091,7 +9091,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9107,7 +9107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -9124,7 +9124,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -9138,7 +9138,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9153,7 +9153,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9168,7 +9168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9184,7 +9184,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9201,7 +9201,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9218,7 +9218,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9234,7 +9234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9251,7 +9251,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9266,7 +9266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9281,7 +9281,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9297,7 +9297,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -9314,7 +9314,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -9328,7 +9328,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9342,7 +9342,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9356,7 +9356,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9371,7 +9371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9387,7 +9387,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9403,7 +9403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9418,7 +9418,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9435,7 +9435,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9449,7 +9449,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -9463,7 +9463,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9478,7 +9478,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -9495,7 +9495,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9508,7 +9508,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9523,7 +9523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9538,7 +9538,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9554,7 +9554,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9571,7 +9571,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9588,7 +9588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9604,7 +9604,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -9621,7 +9621,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -9636,7 +9636,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -9651,7 +9651,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -9667,7 +9667,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -9684,7 +9684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -9698,7 +9698,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE */
 	put_word(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -9711,7 +9711,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -9724,7 +9724,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9738,7 +9738,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9753,7 +9753,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -9768,7 +9768,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9782,7 +9782,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -9798,7 +9798,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -9811,7 +9811,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = get_ilong(2);
@@ -9824,7 +9824,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -9838,7 +9838,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{m68k_incpc(2);
@@ -9854,7 +9854,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword(2);
@@ -9866,7 +9866,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9879,7 +9879,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -9892,7 +9892,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9906,7 +9906,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -9921,7 +9921,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -9936,7 +9936,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -9950,7 +9950,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -9966,7 +9966,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -9979,7 +9979,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong(2);
@@ -9992,7 +9992,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -10006,7 +10006,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{m68k_incpc(2);
@@ -10022,7 +10022,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE */
 }}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword(2);
@@ -10938,7 +10938,7 @@ m68k_incpc(4);
 }}}endlabel682: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41d0_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41d0_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -10948,7 +10948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41d0_0)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41e8_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41e8_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -10958,7 +10958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41e8_0)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f0_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f0_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -10969,7 +10969,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f0_0)(uae_u32 opcode) /* LEA */
 {	m68k_areg(regs, dstreg) = (srca);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f8_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f8_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 8;  
@@ -10978,7 +10978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f8_0)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f9_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f9_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 12; 
@@ -10987,7 +10987,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f9_0)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41fa_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41fa_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 8;  
@@ -10997,7 +10997,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41fa_0)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41fb_0)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41fb_0)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 14; 
@@ -11008,7 +11008,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41fb_0)(uae_u32 opcode) /* LEA */
 {	m68k_areg(regs, dstreg) = (srca);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
@@ -11019,7 +11019,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -11032,7 +11032,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -11046,7 +11046,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 14; 
@@ -11060,7 +11060,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
@@ -11073,7 +11073,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -11087,7 +11087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR */
 	put_byte(srca,0);
 }}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -11099,7 +11099,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong(2);
@@ -11111,7 +11111,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
@@ -11122,7 +11122,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -11135,7 +11135,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -11149,7 +11149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 14; 
@@ -11163,7 +11163,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
@@ -11179,7 +11179,7 @@ return 16;
 #endif
 
 #ifdef PART_4
-unsigned long REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -11193,7 +11193,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR */
 	put_word(srca,0);
 }}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -11205,7 +11205,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong(2);
@@ -11217,7 +11217,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
@@ -11228,7 +11228,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
@@ -11241,7 +11241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
@@ -11255,7 +11255,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 22; 
@@ -11269,7 +11269,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
@@ -11282,7 +11282,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 26; 
@@ -11296,7 +11296,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR */
 	put_long(srca,0);
 }}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -11308,7 +11308,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong(2);
@@ -12706,7 +12706,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4839_0)(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 34; CurrentInstrCycles = 4;  
@@ -12719,7 +12719,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4848_0)(uae_u32 opcode) /* BKPT */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4848_0)(uae_u32 opcode) /* BKPT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 99; CurrentInstrCycles = 4;  
@@ -12804,7 +12804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_487b_0)(uae_u32 opcode) /* PEA */
 	put_long(dsta,srca);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
@@ -12817,7 +12817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4890_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4890_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12831,7 +12831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4890_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48a0_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48a0_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12846,7 +12846,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48a0_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48a8_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48a8_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12860,7 +12860,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48a8_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b0_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b0_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12875,7 +12875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48b0_0)(uae_u32 opcode) /* MVMLE */
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; retcycles+=4; }
 }}}} return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b8_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b8_0)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 12; 
@@ -12888,7 +12888,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48b8_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b9_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b9_0)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 16; 
@@ -12901,7 +12901,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48b9_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(8);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
@@ -12914,7 +12914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_48d0_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48d0_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12928,7 +12928,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48d0_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48e0_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48e0_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12943,7 +12943,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48e0_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48e8_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48e8_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12957,7 +12957,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48e8_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f0_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f0_0)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -12972,7 +12972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48f0_0)(uae_u32 opcode) /* MVMLE */
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; retcycles+=8; }
 }}}} return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f8_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f8_0)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 12; 
@@ -12985,7 +12985,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48f8_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f9_0)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f9_0)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 16; 
@@ -12998,7 +12998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48f9_0)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(8);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
@@ -13011,7 +13011,7 @@ unsigned long REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -13022,7 +13022,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -13034,7 +13034,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -13047,7 +13047,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 10; 
@@ -13060,7 +13060,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -13072,7 +13072,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -13085,7 +13085,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s8)(src)) < 0);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -13096,7 +13096,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = get_ilong(2);
@@ -13107,7 +13107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -13119,7 +13119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{m68k_incpc(2);
@@ -13132,7 +13132,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s8)(src)) < 0);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte(2);
@@ -13142,7 +13142,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -13153,7 +13153,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -13164,7 +13164,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -13176,7 +13176,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -13189,7 +13189,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 10; 
@@ -13202,7 +13202,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -13214,7 +13214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -13227,7 +13227,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s16)(src)) < 0);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -13238,7 +13238,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = get_ilong(2);
@@ -13249,7 +13249,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -13261,7 +13261,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{m68k_incpc(2);
@@ -13274,7 +13274,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s16)(src)) < 0);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword(2);
@@ -13284,7 +13284,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -13295,7 +13295,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -13306,7 +13306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -13318,7 +13318,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -13331,7 +13331,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -13344,7 +13344,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
@@ -13356,7 +13356,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
@@ -13369,7 +13369,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s32)(src)) < 0);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -13380,7 +13380,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong(2);
@@ -13391,7 +13391,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -13403,7 +13403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
 {{m68k_incpc(2);
@@ -13416,7 +13416,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST */
 	SET_NFLG (((uae_s32)(src)) < 0);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -13804,7 +13804,7 @@ m68k_incpc(6);
 	m68k_divl(opcode, dst, extra, oldpc);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4c90_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4c90_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13818,7 +13818,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4c90_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4c98_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4c98_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13833,7 +13833,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4c98_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ca8_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ca8_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13847,7 +13847,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ca8_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb0_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb0_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13862,7 +13862,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cb0_0)(uae_u32 opcode) /* MVMEL */
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; retcycles+=4; }
 }}}} return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb8_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb8_0)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 16; 
@@ -13875,7 +13875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cb8_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb9_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb9_0)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 20; 
@@ -13888,7 +13888,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cb9_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(8);
  return (20+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cba_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cba_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 	unsigned int retcycles = 0;
@@ -13903,7 +13903,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cba_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cbb_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cbb_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -13919,7 +13919,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cbb_0)(uae_u32 opcode) /* MVMEL */
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; retcycles+=4; }
 }}}} return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cd0_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cd0_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13933,7 +13933,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cd0_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cd8_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cd8_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13948,7 +13948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cd8_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ce8_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ce8_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13962,7 +13962,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ce8_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf0_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf0_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -13977,7 +13977,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cf0_0)(uae_u32 opcode) /* MVMEL */
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; retcycles+=8; }
 }}}} return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf8_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf8_0)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 16; 
@@ -13990,7 +13990,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cf8_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf9_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf9_0)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 20; 
@@ -14003,7 +14003,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cf9_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(8);
  return (20+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cfa_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cfa_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 	unsigned int retcycles = 0;
@@ -14018,7 +14018,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cfa_0)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cfb_0)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cfb_0)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -14091,7 +14091,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e68_0)(uae_u32 opcode) /* MVUSP2R */
 endlabel910: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e70_0)(uae_u32 opcode) /* RESET */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e70_0)(uae_u32 opcode) /* RESET */
 {
 	OpcodeFamily = 42; CurrentInstrCycles = 132;
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel911; }
@@ -14106,7 +14106,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e71_0)(uae_u32 opcode) /* NOP */
 {}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e72_0)(uae_u32 opcode) /* STOP */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e72_0)(uae_u32 opcode) /* STOP */
 {
 	OpcodeFamily = 44; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel913; }
@@ -14148,7 +14148,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e73_0)(uae_u32 opcode) /* RTE */
 }}endlabel914: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e74_0)(uae_u32 opcode) /* RTD */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e74_0)(uae_u32 opcode) /* RTD */
 {
 	OpcodeFamily = 46; CurrentInstrCycles = 16; 
 {{	uaecptr pca = m68k_areg(regs, 7);
@@ -14159,13 +14159,13 @@ unsigned long REGPARAM2 CPUFUNC(op_4e74_0)(uae_u32 opcode) /* RTD */
 	m68k_setpc_rte(pc);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e75_0)(uae_u32 opcode) /* RTS */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4e75_0)(uae_u32 opcode) /* RTS */
 {
 	OpcodeFamily = 49; CurrentInstrCycles = 16; 
 {	m68k_do_rts();
 }return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e76_0)(uae_u32 opcode) /* TRAPV */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e76_0)(uae_u32 opcode) /* TRAPV */
 {
 	OpcodeFamily = 50; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
@@ -14188,7 +14188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e77_0)(uae_u32 opcode) /* RTR */
 	MakeFromSR();
 }}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e7a_0)(uae_u32 opcode) /* MOVEC2 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e7a_0)(uae_u32 opcode) /* MOVEC2 */
 {
 	OpcodeFamily = 82; CurrentInstrCycles = 8;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel919; }
@@ -14200,7 +14200,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e7a_0)(uae_u32 opcode) /* MOVEC2 */
 endlabel919: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e7b_0)(uae_u32 opcode) /* MOVE2C */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e7b_0)(uae_u32 opcode) /* MOVE2C */
 {
 	OpcodeFamily = 83; CurrentInstrCycles = 8;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel920; }
@@ -14212,7 +14212,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e7b_0)(uae_u32 opcode) /* MOVE2C */
 endlabel920: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e90_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4e90_0)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 16; 
@@ -14221,7 +14221,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e90_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 2, srca);
 }}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ea8_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ea8_0)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
@@ -14230,7 +14230,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ea8_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb0_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb0_0)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
@@ -14241,7 +14241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4eb0_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 0, srca);
 }}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb8_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb8_0)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -14249,7 +14249,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4eb8_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb9_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb9_0)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong(2);
@@ -14257,7 +14257,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4eb9_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 6, srca);
 }}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eba_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eba_0)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -14266,7 +14266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4eba_0)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ebb_0)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ebb_0)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
 {{m68k_incpc(2);
@@ -14335,7 +14335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4efb_0)(uae_u32 opcode) /* JMP */
 	m68k_setpc(srca);
 }}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14356,7 +14356,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14378,7 +14378,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14404,7 +14404,7 @@ return 12;
 #endif
 
 #ifdef PART_5
-unsigned long REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14427,7 +14427,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14449,7 +14449,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14472,7 +14472,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD */
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -14493,7 +14493,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -14514,7 +14514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14535,7 +14535,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5048_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5048_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14547,7 +14547,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5048_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14569,7 +14569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14592,7 +14592,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14615,7 +14615,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14637,7 +14637,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14660,7 +14660,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD */
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -14681,7 +14681,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -14702,7 +14702,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14723,7 +14723,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5088_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5088_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14735,7 +14735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5088_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14757,7 +14757,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14780,7 +14780,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14803,7 +14803,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14825,7 +14825,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -14848,7 +14848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD */
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
@@ -14869,7 +14869,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -14900,7 +14900,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -14991,7 +14991,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_50fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -15000,7 +15000,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel970: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_50fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -15009,7 +15009,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel971: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_50fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(0)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel972; }
@@ -15017,7 +15017,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50fc_0)(uae_u32 opcode) /* TRAPcc */
 endlabel972: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15038,7 +15038,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15060,7 +15060,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15083,7 +15083,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15106,7 +15106,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15128,7 +15128,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15151,7 +15151,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB */
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -15172,7 +15172,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -15193,7 +15193,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15214,7 +15214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5148_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5148_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15226,7 +15226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5148_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15248,7 +15248,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15271,7 +15271,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15294,7 +15294,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15316,7 +15316,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15339,7 +15339,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB */
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -15360,7 +15360,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -15381,7 +15381,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15402,7 +15402,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5188_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5188_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15414,7 +15414,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5188_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15436,7 +15436,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15459,7 +15459,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15482,7 +15482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15504,7 +15504,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -15527,7 +15527,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB */
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
@@ -15548,7 +15548,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -15579,7 +15579,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -15670,7 +15670,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_51fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -15679,7 +15679,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1008: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_51fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -15688,7 +15688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1009: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_51fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(1)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1010; }
@@ -15706,7 +15706,7 @@ unsigned long REGPARAM2 CPUFUNC(op_52c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_52c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_52c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -15797,7 +15797,7 @@ unsigned long REGPARAM2 CPUFUNC(op_52f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_52fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_52fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -15806,7 +15806,7 @@ unsigned long REGPARAM2 CPUFUNC(op_52fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1020: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_52fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_52fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -15815,7 +15815,7 @@ unsigned long REGPARAM2 CPUFUNC(op_52fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1021: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_52fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_52fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(2)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1022; }
@@ -15833,7 +15833,7 @@ unsigned long REGPARAM2 CPUFUNC(op_53c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_53c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_53c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -15924,7 +15924,7 @@ unsigned long REGPARAM2 CPUFUNC(op_53f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_53fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_53fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -15933,7 +15933,7 @@ unsigned long REGPARAM2 CPUFUNC(op_53fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1032: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_53fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_53fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -15942,7 +15942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_53fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1033: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_53fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_53fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(3)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1034; }
@@ -15960,7 +15960,7 @@ unsigned long REGPARAM2 CPUFUNC(op_54c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_54c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_54c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16051,7 +16051,7 @@ unsigned long REGPARAM2 CPUFUNC(op_54f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_54fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_54fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16060,7 +16060,7 @@ unsigned long REGPARAM2 CPUFUNC(op_54fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1044: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_54fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_54fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16069,7 +16069,7 @@ unsigned long REGPARAM2 CPUFUNC(op_54fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1045: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_54fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_54fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(4)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1046; }
@@ -16087,7 +16087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_55c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_55c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_55c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16178,7 +16178,7 @@ unsigned long REGPARAM2 CPUFUNC(op_55f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_55fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_55fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16187,7 +16187,7 @@ unsigned long REGPARAM2 CPUFUNC(op_55fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1056: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_55fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_55fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16196,7 +16196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_55fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1057: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_55fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_55fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(5)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1058; }
@@ -16214,7 +16214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_56c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_56c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_56c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16305,7 +16305,7 @@ unsigned long REGPARAM2 CPUFUNC(op_56f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_56fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_56fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16314,7 +16314,7 @@ unsigned long REGPARAM2 CPUFUNC(op_56fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1068: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_56fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_56fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16323,7 +16323,7 @@ unsigned long REGPARAM2 CPUFUNC(op_56fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1069: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_56fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_56fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(6)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1070; }
@@ -16341,7 +16341,7 @@ unsigned long REGPARAM2 CPUFUNC(op_57c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_57c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_57c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16432,7 +16432,7 @@ unsigned long REGPARAM2 CPUFUNC(op_57f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_57fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_57fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16441,7 +16441,7 @@ unsigned long REGPARAM2 CPUFUNC(op_57fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1080: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_57fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_57fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16450,7 +16450,7 @@ unsigned long REGPARAM2 CPUFUNC(op_57fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1081: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_57fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_57fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(7)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1082; }
@@ -16468,7 +16468,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_58c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_58c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16559,7 +16559,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_58fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_58fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16568,7 +16568,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1092: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_58fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_58fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16577,7 +16577,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1093: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_58fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_58fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(8)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1094; }
@@ -16595,7 +16595,7 @@ unsigned long REGPARAM2 CPUFUNC(op_59c0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_59c8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_59c8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16686,7 +16686,7 @@ unsigned long REGPARAM2 CPUFUNC(op_59f9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_59fa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_59fa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16695,7 +16695,7 @@ unsigned long REGPARAM2 CPUFUNC(op_59fa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1104: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_59fb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_59fb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16704,7 +16704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_59fb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1105: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_59fc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_59fc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(9)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1106; }
@@ -16722,7 +16722,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ac0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ac8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5ac8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16813,7 +16813,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5af9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5afa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5afa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16822,7 +16822,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5afa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1116: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5afb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5afb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16831,7 +16831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5afb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1117: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5afc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5afc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(10)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1118; }
@@ -16849,7 +16849,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5bc0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5bc8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5bc8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -16940,7 +16940,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5bf9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5bfa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5bfa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -16949,7 +16949,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5bfa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1128: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5bfb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5bfb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -16958,7 +16958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5bfb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1129: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5bfc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5bfc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(11)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1130; }
@@ -16976,7 +16976,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5cc0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5cc8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5cc8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -17067,7 +17067,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5cf9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5cfa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5cfa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -17076,7 +17076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5cfa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1140: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5cfb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5cfb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -17085,7 +17085,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5cfb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1141: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5cfc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5cfc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(12)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1142; }
@@ -17103,7 +17103,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5dc0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5dc8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5dc8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -17194,7 +17194,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5df9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5dfa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5dfa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -17203,7 +17203,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5dfa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1152: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5dfb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5dfb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -17212,7 +17212,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5dfb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1153: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5dfc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5dfc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(13)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1154; }
@@ -17230,7 +17230,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ec0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ec8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5ec8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -17321,7 +17321,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ef9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5efa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5efa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -17330,7 +17330,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5efa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1164: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5efb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5efb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -17339,7 +17339,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5efb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1165: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5efc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5efc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(14)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1166; }
@@ -17357,7 +17357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5fc0_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5fc8_0)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5fc8_0)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -17451,7 +17451,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ff9_0)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ffa_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5ffa_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 8;  
 {{	uae_s16 dummy = get_iword(2);
@@ -17460,7 +17460,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ffa_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1176: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ffb_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5ffb_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 12; 
 {{	uae_s32 dummy = get_ilong(2);
@@ -17469,7 +17469,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ffb_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1177: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ffc_0)(uae_u32 opcode) /* TRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_5ffc_0)(uae_u32 opcode) /* TRAPcc */
 {
 	OpcodeFamily = 102; CurrentInstrCycles = 4;  
 {	if (cctrue(15)) { Exception(7,m68k_getpc(),M68000_EXC_SRC_CPU); goto endlabel1178; }
@@ -17477,7 +17477,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ffc_0)(uae_u32 opcode) /* TRAPcc */
 endlabel1178: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6000_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6000_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17489,7 +17489,7 @@ didnt_jump:;
 endlabel1179: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6001_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6001_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17502,7 +17502,7 @@ didnt_jump:;
 endlabel1180: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_60ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_60ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17514,7 +17514,7 @@ didnt_jump:;
 endlabel1181: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6100_0)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6100_0)(uae_u32 opcode) /* BSR */
 {
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
 {{	uae_s16 src = get_iword(2);
@@ -17522,7 +17522,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6100_0)(uae_u32 opcode) /* BSR */
 	m68k_do_bsr(m68k_getpc() + 4, s);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6101_0)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6101_0)(uae_u32 opcode) /* BSR */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
@@ -17531,7 +17531,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6101_0)(uae_u32 opcode) /* BSR */
 	m68k_do_bsr(m68k_getpc() + 2, s);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_61ff_0)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_61ff_0)(uae_u32 opcode) /* BSR */
 {
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
 {{	uae_s32 src = get_ilong(2);
@@ -17539,7 +17539,7 @@ unsigned long REGPARAM2 CPUFUNC(op_61ff_0)(uae_u32 opcode) /* BSR */
 	m68k_do_bsr(m68k_getpc() + 6, s);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6200_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6200_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17551,7 +17551,7 @@ didnt_jump:;
 endlabel1185: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6201_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6201_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17564,7 +17564,7 @@ didnt_jump:;
 endlabel1186: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_62ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_62ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17576,7 +17576,7 @@ didnt_jump:;
 endlabel1187: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6300_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6300_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17588,7 +17588,7 @@ didnt_jump:;
 endlabel1188: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6301_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6301_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17601,7 +17601,7 @@ didnt_jump:;
 endlabel1189: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_63ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_63ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17613,7 +17613,7 @@ didnt_jump:;
 endlabel1190: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6400_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6400_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17625,7 +17625,7 @@ didnt_jump:;
 endlabel1191: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6401_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6401_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17638,7 +17638,7 @@ didnt_jump:;
 endlabel1192: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_64ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_64ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17650,7 +17650,7 @@ didnt_jump:;
 endlabel1193: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6500_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6500_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17662,7 +17662,7 @@ didnt_jump:;
 endlabel1194: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6501_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6501_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17675,7 +17675,7 @@ didnt_jump:;
 endlabel1195: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_65ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_65ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17687,7 +17687,7 @@ didnt_jump:;
 endlabel1196: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6600_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6600_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17699,7 +17699,7 @@ didnt_jump:;
 endlabel1197: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6601_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6601_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17712,7 +17712,7 @@ didnt_jump:;
 endlabel1198: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_66ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_66ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17724,7 +17724,7 @@ didnt_jump:;
 endlabel1199: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6700_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6700_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17736,7 +17736,7 @@ didnt_jump:;
 endlabel1200: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6701_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6701_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17749,7 +17749,7 @@ didnt_jump:;
 endlabel1201: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_67ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_67ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17761,7 +17761,7 @@ didnt_jump:;
 endlabel1202: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6800_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6800_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17773,7 +17773,7 @@ didnt_jump:;
 endlabel1203: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6801_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6801_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17786,7 +17786,7 @@ didnt_jump:;
 endlabel1204: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_68ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_68ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17798,7 +17798,7 @@ didnt_jump:;
 endlabel1205: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6900_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6900_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17810,7 +17810,7 @@ didnt_jump:;
 endlabel1206: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6901_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6901_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17823,7 +17823,7 @@ didnt_jump:;
 endlabel1207: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_69ff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_69ff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17835,7 +17835,7 @@ didnt_jump:;
 endlabel1208: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17847,7 +17847,7 @@ didnt_jump:;
 endlabel1209: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17860,7 +17860,7 @@ didnt_jump:;
 endlabel1210: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6aff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6aff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17872,7 +17872,7 @@ didnt_jump:;
 endlabel1211: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17884,7 +17884,7 @@ didnt_jump:;
 endlabel1212: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17897,7 +17897,7 @@ didnt_jump:;
 endlabel1213: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6bff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6bff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17909,7 +17909,7 @@ didnt_jump:;
 endlabel1214: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6c00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17921,7 +17921,7 @@ didnt_jump:;
 endlabel1215: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6c01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17934,7 +17934,7 @@ didnt_jump:;
 endlabel1216: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6cff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6cff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17946,7 +17946,7 @@ didnt_jump:;
 endlabel1217: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6d00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6d00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17958,7 +17958,7 @@ didnt_jump:;
 endlabel1218: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6d01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6d01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -17971,7 +17971,7 @@ didnt_jump:;
 endlabel1219: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6dff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6dff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -17983,7 +17983,7 @@ didnt_jump:;
 endlabel1220: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6e00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6e00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -17995,7 +17995,7 @@ didnt_jump:;
 endlabel1221: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6e01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6e01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -18008,7 +18008,7 @@ didnt_jump:;
 endlabel1222: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6eff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6eff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -18020,7 +18020,7 @@ didnt_jump:;
 endlabel1223: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f00_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6f00_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword(2);
@@ -18032,7 +18032,7 @@ didnt_jump:;
 endlabel1224: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f01_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6f01_0)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -18045,7 +18045,7 @@ didnt_jump:;
 endlabel1225: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6fff_0)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6fff_0)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
@@ -18057,7 +18057,7 @@ didnt_jump:;
 endlabel1226: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19094,7 +19094,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8139_0)(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_8140_0)(uae_u32 opcode) /* PACK */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_8140_0)(uae_u32 opcode) /* PACK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19104,7 +19104,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8140_0)(uae_u32 opcode) /* PACK */
 }m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_8148_0)(uae_u32 opcode) /* PACK */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_8148_0)(uae_u32 opcode) /* PACK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19239,7 +19239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8179_0)(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_8180_0)(uae_u32 opcode) /* UNPK */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_8180_0)(uae_u32 opcode) /* UNPK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19250,7 +19250,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8180_0)(uae_u32 opcode) /* UNPK */
 }m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_8188_0)(uae_u32 opcode) /* UNPK */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_8188_0)(uae_u32 opcode) /* UNPK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19693,7 +19693,7 @@ m68k_incpc(4);
 }}}endlabel1309: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19714,7 +19714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19736,7 +19736,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19759,7 +19759,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19782,7 +19782,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19804,7 +19804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19827,7 +19827,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -19848,7 +19848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -19869,7 +19869,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -19891,7 +19891,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -19914,7 +19914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -19934,7 +19934,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19955,7 +19955,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19976,7 +19976,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19998,7 +19998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20021,7 +20021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20044,7 +20044,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20066,7 +20066,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20089,7 +20089,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -20110,7 +20110,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -20131,7 +20131,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -20153,7 +20153,7 @@ unsigned long REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -20176,7 +20176,7 @@ unsigned long REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -20196,7 +20196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20217,7 +20217,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20238,7 +20238,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20260,7 +20260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20283,7 +20283,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20306,7 +20306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20328,7 +20328,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20351,7 +20351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -20372,7 +20372,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -20393,7 +20393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -20415,7 +20415,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -20438,7 +20438,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB */
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -20458,7 +20458,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90c0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90c0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20470,7 +20470,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90c0_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90c8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90c8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20482,7 +20482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90c8_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90d0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90d0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20495,7 +20495,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90d0_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90d8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90d8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20509,7 +20509,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90d8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90e0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90e0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20523,7 +20523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90e0_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90e8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90e8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20536,7 +20536,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90e8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20550,7 +20550,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90f0_0)(uae_u32 opcode) /* SUBA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -20562,7 +20562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90f8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f9_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f9_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 20; 
@@ -20574,7 +20574,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90f9_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fa_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fa_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -20587,7 +20587,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90fa_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fb_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fb_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -20601,7 +20601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90fb_0)(uae_u32 opcode) /* SUBA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fc_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fc_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 12; 
@@ -20656,7 +20656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9108_0)(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20678,7 +20678,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20701,7 +20701,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20724,7 +20724,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20746,7 +20746,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20769,7 +20769,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB */
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -20790,7 +20790,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -20855,7 +20855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9148_0)(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20877,7 +20877,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20900,7 +20900,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20923,7 +20923,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20945,7 +20945,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20968,7 +20968,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB */
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -20989,7 +20989,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -21054,7 +21054,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9188_0)(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21076,7 +21076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21099,7 +21099,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21122,7 +21122,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21144,7 +21144,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21167,7 +21167,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB */
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
@@ -21188,7 +21188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -21209,7 +21209,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91c0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91c0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21221,7 +21221,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91c0_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91c8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91c8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21233,7 +21233,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91c8_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91d0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91d0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21246,7 +21246,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91d0_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91d8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91d8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21260,7 +21260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91d8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91e0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91e0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21274,7 +21274,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91e0_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91e8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91e8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21287,7 +21287,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91e8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f0_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f0_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21301,7 +21301,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91f0_0)(uae_u32 opcode) /* SUBA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f8_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f8_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -21313,7 +21313,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91f8_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f9_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f9_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 22; 
@@ -21325,7 +21325,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91f9_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fa_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fa_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -21338,7 +21338,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91fa_0)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fb_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fb_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 20; 
@@ -21352,7 +21352,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91fb_0)(uae_u32 opcode) /* SUBA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fc_0)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fc_0)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -21363,7 +21363,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91fc_0)(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21381,7 +21381,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21400,7 +21400,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21420,7 +21420,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21440,7 +21440,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21459,7 +21459,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21479,7 +21479,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -21497,7 +21497,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -21515,7 +21515,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -21534,7 +21534,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -21557,7 +21557,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP */
 #endif
 
 #ifdef PART_7
-unsigned long REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -21574,7 +21574,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21592,7 +21592,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21610,7 +21610,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21629,7 +21629,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21649,7 +21649,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21669,7 +21669,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21688,7 +21688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21708,7 +21708,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -21726,7 +21726,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -21744,7 +21744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -21763,7 +21763,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -21783,7 +21783,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -21800,7 +21800,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21818,7 +21818,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21836,7 +21836,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21855,7 +21855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21875,7 +21875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21895,7 +21895,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21914,7 +21914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21934,7 +21934,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -21952,7 +21952,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 22; 
@@ -21970,7 +21970,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -21989,7 +21989,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -22009,7 +22009,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -22026,7 +22026,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22044,7 +22044,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22062,7 +22062,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22081,7 +22081,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22101,7 +22101,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22121,7 +22121,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22140,7 +22140,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22160,7 +22160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -22178,7 +22178,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -22196,7 +22196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -22215,7 +22215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 16; 
@@ -22235,7 +22235,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 10; 
@@ -22726,7 +22726,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b9_0)(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22744,7 +22744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22762,7 +22762,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22781,7 +22781,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22801,7 +22801,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22821,7 +22821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22840,7 +22840,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -22860,7 +22860,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -22878,7 +22878,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 22; 
@@ -22896,7 +22896,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -22915,7 +22915,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 20; 
@@ -22935,7 +22935,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA */
 	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -23523,7 +23523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0c0_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}m68k_incpc(2);
  return (38+retcycles*2);
 }
@@ -23541,7 +23541,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d0_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(2);
  return (42+retcycles*2);
 }
@@ -23560,7 +23560,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d8_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(2);
  return (42+retcycles*2);
 }
@@ -23579,7 +23579,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e0_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(2);
  return (44+retcycles*2);
 }
@@ -23597,7 +23597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e8_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -23617,7 +23617,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}} return (48+retcycles*2);
 }
 unsigned long REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU */
@@ -23633,7 +23633,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -23650,7 +23650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f9_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(6);
  return (50+retcycles*2);
 }
@@ -23668,7 +23668,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fa_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -23688,7 +23688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}} return (48+retcycles*2);
 }
 unsigned long REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU */
@@ -23703,7 +23703,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}m68k_incpc(4);
  return (42+retcycles*2);
 }
@@ -24168,7 +24168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1c0_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}m68k_incpc(2);
  return (38+retcycles*2);
 }
@@ -24188,7 +24188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d0_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(2);
  return (42+retcycles*2);
 }
@@ -24209,7 +24209,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d8_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(2);
  return (42+retcycles*2);
 }
@@ -24230,7 +24230,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e0_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(2);
  return (44+retcycles*2);
 }
@@ -24250,7 +24250,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e8_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -24272,7 +24272,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}} return (48+retcycles*2);
 }
 unsigned long REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS */
@@ -24290,7 +24290,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -24309,7 +24309,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f9_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(6);
  return (50+retcycles*2);
 }
@@ -24329,7 +24329,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fa_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(4);
  return (46+retcycles*2);
 }
@@ -24351,7 +24351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}} return (48+retcycles*2);
 }
 unsigned long REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS */
@@ -24368,11 +24368,11 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}m68k_incpc(4);
  return (42+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24393,7 +24393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24415,7 +24415,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24438,7 +24438,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24461,7 +24461,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24483,7 +24483,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24506,7 +24506,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -24527,7 +24527,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -24548,7 +24548,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -24570,7 +24570,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -24593,7 +24593,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -24613,7 +24613,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24634,7 +24634,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24655,7 +24655,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24677,7 +24677,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24700,7 +24700,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24723,7 +24723,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24745,7 +24745,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24768,7 +24768,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -24789,7 +24789,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -24810,7 +24810,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -24832,7 +24832,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -24855,7 +24855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -24875,7 +24875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24896,7 +24896,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24917,7 +24917,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24939,7 +24939,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24962,7 +24962,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -24985,7 +24985,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25007,7 +25007,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25030,7 +25030,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -25051,7 +25051,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -25072,7 +25072,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -25094,7 +25094,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -25117,7 +25117,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD */
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -25137,7 +25137,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0c0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0c0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25149,7 +25149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0c0_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0c8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0c8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25161,7 +25161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0c8_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0d0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0d0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25174,7 +25174,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0d0_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0d8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0d8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25188,7 +25188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0d8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0e0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0e0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25202,7 +25202,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0e0_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0e8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0e8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25215,7 +25215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0e8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25229,7 +25229,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0f0_0)(uae_u32 opcode) /* ADDA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -25241,7 +25241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0f8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f9_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f9_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 20; 
@@ -25253,7 +25253,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0f9_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fa_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fa_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -25266,7 +25266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0fa_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fb_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fb_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -25280,7 +25280,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0fb_0)(uae_u32 opcode) /* ADDA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fc_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fc_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 12; 
@@ -25335,7 +25335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d108_0)(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25357,7 +25357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25380,7 +25380,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25403,7 +25403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25425,7 +25425,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25448,7 +25448,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD */
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -25469,7 +25469,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -25534,7 +25534,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d148_0)(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25556,7 +25556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25579,7 +25579,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25602,7 +25602,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25624,7 +25624,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25647,7 +25647,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD */
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -25668,7 +25668,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -25733,7 +25733,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d188_0)(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25755,7 +25755,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25778,7 +25778,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25801,7 +25801,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25823,7 +25823,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -25846,7 +25846,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD */
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
@@ -25867,7 +25867,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -25888,7 +25888,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1c0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1c0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25900,7 +25900,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1c0_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1c8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1c8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25912,7 +25912,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1c8_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1d0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1d0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25928,7 +25928,7 @@ return 14;
 #endif
 
 #ifdef PART_8
-unsigned long REGPARAM2 CPUFUNC(op_d1d8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1d8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25942,7 +25942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1d8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1e0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1e0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25956,7 +25956,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1e0_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1e8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1e8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25969,7 +25969,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1e8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f0_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f0_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -25983,7 +25983,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1f0_0)(uae_u32 opcode) /* ADDA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f8_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f8_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -25995,7 +25995,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1f8_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f9_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f9_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 22; 
@@ -26007,7 +26007,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1f9_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fa_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fa_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -26020,7 +26020,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1fa_0)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fb_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fb_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 20; 
@@ -26034,7 +26034,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1fb_0)(uae_u32 opcode) /* ADDA */
 	m68k_areg(regs, dstreg) = (newv);
 }}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fc_0)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fc_0)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -26045,7 +26045,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1fc_0)(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(6);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e000_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e000_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26076,7 +26076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e000_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e008_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e008_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26161,7 +26161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e018_0)(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e020_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e020_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26192,7 +26192,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e020_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e028_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e028_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26281,7 +26281,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e038_0)(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e040_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e040_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26312,7 +26312,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e040_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e048_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e048_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26397,7 +26397,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e058_0)(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e060_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e060_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26428,7 +26428,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e060_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e068_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e068_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26516,7 +26516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e078_0)(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e080_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e080_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26547,7 +26547,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e080_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e088_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e088_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26632,7 +26632,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e098_0)(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e0a0_0)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e0a0_0)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26663,7 +26663,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a0_0)(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e0a8_0)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e0a8_0)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -26884,7 +26884,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f9_0)(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(6);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e100_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e100_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26916,7 +26916,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e100_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e108_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e108_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -26999,7 +26999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e118_0)(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e120_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e120_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -27031,7 +27031,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e120_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e128_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e128_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -27119,7 +27119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e138_0)(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e140_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e140_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -27151,7 +27151,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e140_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e148_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e148_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -27234,7 +27234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e158_0)(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e160_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e160_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -27266,7 +27266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e160_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e168_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e168_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -27353,7 +27353,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e178_0)(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e180_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e180_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -27385,7 +27385,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e180_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e188_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e188_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -27468,7 +27468,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e198_0)(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e1a0_0)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e1a0_0)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -27500,7 +27500,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a0_0)(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e1a8_0)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e1a8_0)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -30002,7 +30002,7 @@ m68k_incpc(4);
 	fscc_opp(opcode,extra);
 }}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f27a_0)(uae_u32 opcode) /* FTRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f27a_0)(uae_u32 opcode) /* FTRAPcc */
 {
 	OpcodeFamily = 107; CurrentInstrCycles = 8;  
 {m68k_incpc(2);
@@ -30012,7 +30012,7 @@ m68k_incpc(2);
 	ftrapcc_opp(opcode,oldpc);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f27b_0)(uae_u32 opcode) /* FTRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f27b_0)(uae_u32 opcode) /* FTRAPcc */
 {
 	OpcodeFamily = 107; CurrentInstrCycles = 12; 
 {m68k_incpc(2);
@@ -30022,7 +30022,7 @@ m68k_incpc(4);
 	ftrapcc_opp(opcode,oldpc);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f27c_0)(uae_u32 opcode) /* FTRAPcc */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f27c_0)(uae_u32 opcode) /* FTRAPcc */
 {
 	OpcodeFamily = 107; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
@@ -30052,7 +30052,7 @@ m68k_incpc(4);
 	fbcc_opp(opcode,pc,extra);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f310_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f310_0)(uae_u32 opcode) /* FSAVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
@@ -30062,7 +30062,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f310_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1835: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f320_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f320_0)(uae_u32 opcode) /* FSAVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
@@ -30072,7 +30072,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f320_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1836: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f328_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f328_0)(uae_u32 opcode) /* FSAVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
@@ -30082,7 +30082,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f328_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1837: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f330_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f330_0)(uae_u32 opcode) /* FSAVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
@@ -30092,7 +30092,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f330_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1838: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f338_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f338_0)(uae_u32 opcode) /* FSAVE */
 {
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1839; }
@@ -30101,7 +30101,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f338_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1839: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f339_0)(uae_u32 opcode) /* FSAVE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f339_0)(uae_u32 opcode) /* FSAVE */
 {
 	OpcodeFamily = 109; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1840; }
@@ -30110,7 +30110,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f339_0)(uae_u32 opcode) /* FSAVE */
 }}endlabel1840: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f350_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f350_0)(uae_u32 opcode) /* FRESTORE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
@@ -30120,7 +30120,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f350_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1841: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f358_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f358_0)(uae_u32 opcode) /* FRESTORE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
@@ -30130,7 +30130,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f358_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1842: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f368_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f368_0)(uae_u32 opcode) /* FRESTORE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
@@ -30140,7 +30140,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f368_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1843: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f370_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f370_0)(uae_u32 opcode) /* FRESTORE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
@@ -30150,7 +30150,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f370_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1844: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f378_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f378_0)(uae_u32 opcode) /* FRESTORE */
 {
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1845; }
@@ -30159,7 +30159,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f378_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1845: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f379_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f379_0)(uae_u32 opcode) /* FRESTORE */
 {
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1846; }
@@ -30168,7 +30168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f379_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1846: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f37a_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f37a_0)(uae_u32 opcode) /* FRESTORE */
 {
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1847; }
@@ -30177,7 +30177,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f37a_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1847: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f37b_0)(uae_u32 opcode) /* FRESTORE */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f37b_0)(uae_u32 opcode) /* FRESTORE */
 {
 	OpcodeFamily = 110; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel1848; }
@@ -30186,7 +30186,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f37b_0)(uae_u32 opcode) /* FRESTORE */
 }}endlabel1848: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f408_0)(uae_u32 opcode) /* CINVL */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f408_0)(uae_u32 opcode) /* CINVL */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	uae_u32 dstreg = opcode & 7;
@@ -30196,7 +30196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f408_0)(uae_u32 opcode) /* CINVL */
 endlabel1849: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f410_0)(uae_u32 opcode) /* CINVP */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f410_0)(uae_u32 opcode) /* CINVP */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	uae_u32 dstreg = opcode & 7;
@@ -30206,7 +30206,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f410_0)(uae_u32 opcode) /* CINVP */
 endlabel1850: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f418_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f418_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30215,7 +30215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f418_0)(uae_u32 opcode) /* CINVA */
 endlabel1851: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f419_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f419_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30224,7 +30224,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f419_0)(uae_u32 opcode) /* CINVA */
 endlabel1852: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41a_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41a_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30233,7 +30233,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41a_0)(uae_u32 opcode) /* CINVA */
 endlabel1853: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41b_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41b_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30242,7 +30242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41b_0)(uae_u32 opcode) /* CINVA */
 endlabel1854: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41c_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41c_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30251,7 +30251,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41c_0)(uae_u32 opcode) /* CINVA */
 endlabel1855: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41d_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41d_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30260,7 +30260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41d_0)(uae_u32 opcode) /* CINVA */
 endlabel1856: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41e_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41e_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30269,7 +30269,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41e_0)(uae_u32 opcode) /* CINVA */
 endlabel1857: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f41f_0)(uae_u32 opcode) /* CINVA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f41f_0)(uae_u32 opcode) /* CINVA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 113; CurrentInstrCycles = 4;  
@@ -30278,7 +30278,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f41f_0)(uae_u32 opcode) /* CINVA */
 endlabel1858: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f428_0)(uae_u32 opcode) /* CPUSHL */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f428_0)(uae_u32 opcode) /* CPUSHL */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	uae_u32 dstreg = opcode & 7;
@@ -30288,7 +30288,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f428_0)(uae_u32 opcode) /* CPUSHL */
 endlabel1859: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f430_0)(uae_u32 opcode) /* CPUSHP */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f430_0)(uae_u32 opcode) /* CPUSHP */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	uae_u32 dstreg = opcode & 7;
@@ -30298,7 +30298,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f430_0)(uae_u32 opcode) /* CPUSHP */
 endlabel1860: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f438_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f438_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30307,7 +30307,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f438_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1861: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f439_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f439_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30316,7 +30316,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f439_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1862: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43a_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43a_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30325,7 +30325,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43a_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1863: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30334,7 +30334,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1864: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30343,7 +30343,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1865: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30352,7 +30352,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1866: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30361,7 +30361,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1867: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA */
 {
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 	OpcodeFamily = 116; CurrentInstrCycles = 4;  
@@ -30370,7 +30370,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA */
 endlabel1868: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f500_0)(uae_u32 opcode) /* MMUOP */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f500_0)(uae_u32 opcode) /* MMUOP */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 3) & 255);
 	uae_u32 dstreg = opcode & 7;
@@ -30380,7 +30380,7 @@ m68k_incpc(2);
 	mmu_op(opcode,extra);
 }}return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f600_0)(uae_u32 opcode) /* MOVE16 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f600_0)(uae_u32 opcode) /* MOVE16 */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 117; CurrentInstrCycles = 12; 
@@ -30396,7 +30396,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f600_0)(uae_u32 opcode) /* MOVE16 */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f608_0)(uae_u32 opcode) /* MOVE16 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f608_0)(uae_u32 opcode) /* MOVE16 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 117; CurrentInstrCycles = 12; 
@@ -30412,7 +30412,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f608_0)(uae_u32 opcode) /* MOVE16 */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f610_0)(uae_u32 opcode) /* MOVE16 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f610_0)(uae_u32 opcode) /* MOVE16 */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 117; CurrentInstrCycles = 12; 
@@ -30427,7 +30427,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f610_0)(uae_u32 opcode) /* MOVE16 */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f618_0)(uae_u32 opcode) /* MOVE16 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f618_0)(uae_u32 opcode) /* MOVE16 */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 117; CurrentInstrCycles = 12; 
@@ -30442,7 +30442,7 @@ unsigned long REGPARAM2 CPUFUNC(op_f618_0)(uae_u32 opcode) /* MOVE16 */
 }}}m68k_incpc(6);
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_f620_0)(uae_u32 opcode) /* MOVE16 */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_f620_0)(uae_u32 opcode) /* MOVE16 */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = 0;
@@ -30598,7 +30598,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_130_3)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_130_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -30612,7 +30612,7 @@ unsigned long REGPARAM2 CPUFUNC(op_130_3)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13b_3)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13b_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -30777,7 +30777,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -30799,7 +30799,7 @@ unsigned long REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -30821,7 +30821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 34; 
@@ -30843,7 +30843,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -30865,7 +30865,7 @@ unsigned long REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -30887,7 +30887,7 @@ unsigned long REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 34; 
@@ -30909,7 +30909,7 @@ unsigned long REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -30922,7 +30922,7 @@ unsigned long REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83b_3)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83b_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -31083,7 +31083,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -31102,7 +31102,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -31122,7 +31122,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -31141,7 +31141,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -31161,7 +31161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -31180,7 +31180,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -31200,7 +31200,7 @@ unsigned long REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31215,7 +31215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -31230,7 +31230,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31246,7 +31246,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -31262,7 +31262,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31279,7 +31279,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -31296,7 +31296,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31313,7 +31313,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -31330,7 +31330,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31346,7 +31346,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -31362,7 +31362,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31377,7 +31377,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1188_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1188_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31392,7 +31392,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1188_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31408,7 +31408,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31425,7 +31425,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31442,7 +31442,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31458,7 +31458,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31475,7 +31475,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -31490,7 +31490,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31505,7 +31505,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -31521,7 +31521,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -31538,7 +31538,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -31552,7 +31552,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -31567,7 +31567,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -31582,7 +31582,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31597,7 +31597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -31612,7 +31612,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31627,7 +31627,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -31642,7 +31642,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2070_3)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2070_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31655,7 +31655,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2070_3)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207b_3)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207b_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 18; 
@@ -31668,7 +31668,7 @@ unsigned long REGPARAM2 CPUFUNC(op_207b_3)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31684,7 +31684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31700,7 +31700,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31717,7 +31717,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31734,7 +31734,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31754,7 +31754,7 @@ return 26;
 #endif
 
 #ifdef PART_3
-unsigned long REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31771,7 +31771,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31787,7 +31787,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -31803,7 +31803,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31818,7 +31818,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31833,7 +31833,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31849,7 +31849,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31866,7 +31866,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31883,7 +31883,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31899,7 +31899,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -31916,7 +31916,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -31931,7 +31931,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -31946,7 +31946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -31962,7 +31962,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -31979,7 +31979,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -31993,7 +31993,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -32008,7 +32008,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32023,7 +32023,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -32038,7 +32038,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32053,7 +32053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32068,7 +32068,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -32083,7 +32083,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3070_3)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3070_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32096,7 +32096,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3070_3)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307b_3)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307b_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 14; 
@@ -32109,7 +32109,7 @@ unsigned long REGPARAM2 CPUFUNC(op_307b_3)(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32125,7 +32125,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -32141,7 +32141,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32158,7 +32158,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -32175,7 +32175,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32192,7 +32192,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -32209,7 +32209,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32225,7 +32225,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -32241,7 +32241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32256,7 +32256,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32271,7 +32271,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32287,7 +32287,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32304,7 +32304,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32321,7 +32321,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32337,7 +32337,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32354,7 +32354,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -32369,7 +32369,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -32384,7 +32384,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -32400,7 +32400,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -32417,7 +32417,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -32431,7 +32431,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -32446,7 +32446,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32461,7 +32461,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -32476,7 +32476,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32599,7 +32599,7 @@ m68k_incpc(4);
 }}}}endlabel1999: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -32610,7 +32610,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 14; 
@@ -32621,7 +32621,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -32638,7 +32638,7 @@ return 18;
 #endif
 
 #ifdef PART_4
-unsigned long REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -32652,7 +32652,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 26; 
@@ -32890,7 +32890,7 @@ unsigned long REGPARAM2 CPUFUNC(op_487b_3)(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -32905,7 +32905,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -32920,7 +32920,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
  return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -32933,7 +32933,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32946,7 +32946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -32959,7 +32959,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -32972,7 +32972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
@@ -32985,7 +32985,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -33013,7 +33013,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -33028,7 +33028,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -33044,7 +33044,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -33059,7 +33059,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -33075,7 +33075,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
@@ -33085,7 +33085,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR */
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ebb_3)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ebb_3)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -33116,7 +33116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4efb_3)(uae_u32 opcode) /* JMP */
 #endif
 
 #ifdef PART_5
-unsigned long REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33139,7 +33139,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33162,7 +33162,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33196,7 +33196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50f0_3)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33219,7 +33219,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33242,7 +33242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -33433,7 +33433,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ff0_3)(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33450,7 +33450,7 @@ didnt_jump:;
 endlabel2058: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33467,7 +33467,7 @@ didnt_jump:;
 endlabel2059: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33484,7 +33484,7 @@ didnt_jump:;
 endlabel2060: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33501,7 +33501,7 @@ didnt_jump:;
 endlabel2061: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33518,7 +33518,7 @@ didnt_jump:;
 endlabel2062: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33535,7 +33535,7 @@ didnt_jump:;
 endlabel2063: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33552,7 +33552,7 @@ didnt_jump:;
 endlabel2064: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33569,7 +33569,7 @@ didnt_jump:;
 endlabel2065: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33586,7 +33586,7 @@ didnt_jump:;
 endlabel2066: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33603,7 +33603,7 @@ didnt_jump:;
 endlabel2067: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33620,7 +33620,7 @@ didnt_jump:;
 endlabel2068: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33637,7 +33637,7 @@ didnt_jump:;
 endlabel2069: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33654,7 +33654,7 @@ didnt_jump:;
 endlabel2070: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33671,7 +33671,7 @@ didnt_jump:;
 endlabel2071: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -33964,7 +33964,7 @@ m68k_incpc(4);
 }}}}endlabel2085: ;
  return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -33987,7 +33987,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -34010,7 +34010,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34033,7 +34033,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -34056,7 +34056,7 @@ unsigned long REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34079,7 +34079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -34102,7 +34102,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f0_3)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34116,7 +34116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90f0_3)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fb_3)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fb_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -34130,7 +34130,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90fb_3)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34153,7 +34153,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34176,7 +34176,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34199,7 +34199,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f0_3)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34213,7 +34213,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91f0_3)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fb_3)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fb_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 20; 
@@ -34227,7 +34227,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91fb_3)(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34247,7 +34247,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -34270,7 +34270,7 @@ return 14;
 #endif
 
 #ifdef PART_7
-unsigned long REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34290,7 +34290,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -34310,7 +34310,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34330,7 +34330,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -34350,7 +34350,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34370,7 +34370,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 16; 
@@ -34444,7 +34444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34464,7 +34464,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 20; 
@@ -34607,7 +34607,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(4);
  return (48+retcycles*2);
 }
@@ -34626,7 +34626,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}m68k_incpc(4);
  return (48+retcycles*2);
 }
@@ -34701,7 +34701,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(4);
  return (48+retcycles*2);
 }
@@ -34722,11 +34722,11 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}m68k_incpc(4);
  return (48+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34749,7 +34749,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -34772,7 +34772,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34795,7 +34795,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -34818,7 +34818,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34841,7 +34841,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -34864,7 +34864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34878,7 +34878,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fb_3)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fb_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -34892,7 +34892,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0fb_3)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34915,7 +34915,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34938,7 +34938,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -34964,7 +34964,7 @@ return 26;
 #endif
 
 #ifdef PART_8
-unsigned long REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -34978,7 +34978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fb_3)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fb_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 20; 
@@ -35841,7 +35841,7 @@ fill_prefetch_0 ();
 }}}}}endlabel2180: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_100_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_100_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35869,7 +35869,7 @@ unsigned long REGPARAM2 CPUFUNC(op_108_5)(uae_u32 opcode) /* MVPMR */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_110_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_110_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35883,7 +35883,7 @@ unsigned long REGPARAM2 CPUFUNC(op_110_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_118_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_118_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35898,7 +35898,7 @@ unsigned long REGPARAM2 CPUFUNC(op_118_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_120_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_120_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35913,7 +35913,7 @@ unsigned long REGPARAM2 CPUFUNC(op_120_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_128_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_128_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35927,7 +35927,7 @@ unsigned long REGPARAM2 CPUFUNC(op_128_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_130_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_130_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -35942,7 +35942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_130_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_138_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_138_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -35955,7 +35955,7 @@ unsigned long REGPARAM2 CPUFUNC(op_138_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_139_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_139_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -35968,7 +35968,7 @@ unsigned long REGPARAM2 CPUFUNC(op_139_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13a_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13a_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -35983,7 +35983,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13a_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13b_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13b_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -35999,7 +35999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13b_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 21; CurrentInstrCycles = 8;  
@@ -37090,7 +37090,7 @@ fill_prefetch_0 ();
 }}}}}endlabel2251: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_400_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_400_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -37111,7 +37111,7 @@ unsigned long REGPARAM2 CPUFUNC(op_400_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_410_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_410_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -37133,7 +37133,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_418_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_418_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -37156,7 +37156,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_420_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_420_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -37179,7 +37179,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_428_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_428_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -37201,7 +37201,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_430_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_430_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -37224,7 +37224,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_438_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_438_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -37245,7 +37245,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_439_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_439_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -37266,7 +37266,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_440_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_440_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -37287,7 +37287,7 @@ unsigned long REGPARAM2 CPUFUNC(op_440_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_450_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_450_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -37317,7 +37317,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2261: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_458_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_458_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -37348,7 +37348,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2262: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_460_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_460_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -37379,7 +37379,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2263: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_468_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_468_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -37409,7 +37409,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2264: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_470_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_470_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -37440,7 +37440,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2265: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_478_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_478_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -37469,7 +37469,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2266: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_479_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_479_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -37498,7 +37498,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2267: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_480_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_480_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -37519,7 +37519,7 @@ unsigned long REGPARAM2 CPUFUNC(op_480_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_490_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_490_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -37549,7 +37549,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2269: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_498_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_498_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -37580,7 +37580,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2270: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 30; 
@@ -37611,7 +37611,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2271: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 32; 
@@ -37641,7 +37641,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2272: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 34; 
@@ -37672,7 +37672,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2273: ;
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b8_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 32; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -37701,7 +37701,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2274: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4b9_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4b9_5)(uae_u32 opcode) /* SUB */
 {
 	OpcodeFamily = 7; CurrentInstrCycles = 36; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -37730,7 +37730,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2275: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_600_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_600_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -37751,7 +37751,7 @@ unsigned long REGPARAM2 CPUFUNC(op_600_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_610_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_610_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -37773,7 +37773,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_618_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_618_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -37796,7 +37796,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_620_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_620_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -37819,7 +37819,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_628_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_628_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -37841,7 +37841,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_630_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_630_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -37864,7 +37864,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_638_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_638_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -37885,7 +37885,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_639_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_639_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -37906,7 +37906,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_640_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_640_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -37927,7 +37927,7 @@ unsigned long REGPARAM2 CPUFUNC(op_640_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_650_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_650_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -37957,7 +37957,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2285: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_658_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_658_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -37988,7 +37988,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2286: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_660_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_660_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -38019,7 +38019,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2287: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_668_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_668_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -38049,7 +38049,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2288: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_670_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_670_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -38080,7 +38080,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2289: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_678_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_678_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -38109,7 +38109,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2290: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_679_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_679_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -38138,7 +38138,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2291: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_680_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_680_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -38159,7 +38159,7 @@ unsigned long REGPARAM2 CPUFUNC(op_680_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_690_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_690_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -38189,7 +38189,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2293: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_698_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_698_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -38220,7 +38220,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2294: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 30; 
@@ -38251,7 +38251,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2295: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 32; 
@@ -38281,7 +38281,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2296: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 34; 
@@ -38312,7 +38312,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2297: ;
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b8_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 32; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -38341,7 +38341,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2298: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b9_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b9_5)(uae_u32 opcode) /* ADD */
 {
 	OpcodeFamily = 11; CurrentInstrCycles = 36; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -38370,7 +38370,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2299: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_800_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_800_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 10; 
@@ -38382,7 +38382,7 @@ unsigned long REGPARAM2 CPUFUNC(op_800_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_810_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_810_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -38395,7 +38395,7 @@ unsigned long REGPARAM2 CPUFUNC(op_810_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_818_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_818_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
@@ -38409,7 +38409,7 @@ unsigned long REGPARAM2 CPUFUNC(op_818_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_820_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_820_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 14; 
@@ -38423,7 +38423,7 @@ unsigned long REGPARAM2 CPUFUNC(op_820_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_828_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_828_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -38436,7 +38436,7 @@ unsigned long REGPARAM2 CPUFUNC(op_828_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_830_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_830_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -38450,7 +38450,7 @@ unsigned long REGPARAM2 CPUFUNC(op_830_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_838_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_838_5)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -38462,7 +38462,7 @@ unsigned long REGPARAM2 CPUFUNC(op_838_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_839_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_839_5)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -38474,7 +38474,7 @@ unsigned long REGPARAM2 CPUFUNC(op_839_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83a_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83a_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 21; CurrentInstrCycles = 16; 
@@ -38488,7 +38488,7 @@ unsigned long REGPARAM2 CPUFUNC(op_83a_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83b_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83b_5)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 21; CurrentInstrCycles = 18; 
@@ -38503,7 +38503,7 @@ unsigned long REGPARAM2 CPUFUNC(op_83b_5)(uae_u32 opcode) /* BTST */
 fill_prefetch_0 ();
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_83c_5)(uae_u32 opcode) /* BTST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_83c_5)(uae_u32 opcode) /* BTST */
 {
 	OpcodeFamily = 21; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -39522,7 +39522,7 @@ fill_prefetch_0 ();
 }}}}}endlabel2366: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c00_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c00_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -39540,7 +39540,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c00_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c10_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c10_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -39559,7 +39559,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c10_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c18_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c18_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -39579,7 +39579,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c18_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c20_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c20_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -39599,7 +39599,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c20_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c28_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c28_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -39618,7 +39618,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c28_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c30_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c30_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -39638,7 +39638,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c38_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c38_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -39656,7 +39656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c38_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c39_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c39_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -39674,7 +39674,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c39_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c3a_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c3a_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -39694,7 +39694,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c3a_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c3b_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c3b_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -39715,7 +39715,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c40_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c40_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -39733,7 +39733,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c40_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c50_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c50_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -39760,7 +39760,7 @@ fill_prefetch_0 ();
 endlabel2378: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c58_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c58_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -39788,7 +39788,7 @@ fill_prefetch_0 ();
 endlabel2379: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c60_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c60_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -39816,7 +39816,7 @@ fill_prefetch_0 ();
 endlabel2380: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c68_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c68_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -39843,7 +39843,7 @@ fill_prefetch_0 ();
 endlabel2381: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c70_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c70_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -39871,7 +39871,7 @@ fill_prefetch_0 ();
 endlabel2382: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c78_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c78_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -39897,7 +39897,7 @@ fill_prefetch_0 ();
 endlabel2383: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c79_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c79_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -39923,7 +39923,7 @@ fill_prefetch_0 ();
 endlabel2384: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c7a_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c7a_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -39951,7 +39951,7 @@ fill_prefetch_0 ();
 endlabel2385: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c7b_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c7b_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -39980,7 +39980,7 @@ fill_prefetch_0 ();
 endlabel2386: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c80_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c80_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -39998,7 +39998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c80_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c90_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c90_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -40025,7 +40025,7 @@ fill_prefetch_0 ();
 endlabel2388: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_c98_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_c98_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -40053,7 +40053,7 @@ fill_prefetch_0 ();
 endlabel2389: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ca0_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_ca0_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 22; 
@@ -40081,7 +40081,7 @@ fill_prefetch_0 ();
 endlabel2390: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_ca8_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_ca8_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
@@ -40108,7 +40108,7 @@ fill_prefetch_0 ();
 endlabel2391: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb0_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb0_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -40136,7 +40136,7 @@ fill_prefetch_0 ();
 endlabel2392: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb8_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb8_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -40162,7 +40162,7 @@ fill_prefetch_0 ();
 endlabel2393: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cb9_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cb9_5)(uae_u32 opcode) /* CMP */
 {
 	OpcodeFamily = 25; CurrentInstrCycles = 28; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -40188,7 +40188,7 @@ fill_prefetch_0 ();
 endlabel2394: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cba_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cba_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 	OpcodeFamily = 25; CurrentInstrCycles = 24; 
@@ -40216,7 +40216,7 @@ fill_prefetch_0 ();
 endlabel2395: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_cbb_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_cbb_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 	OpcodeFamily = 25; CurrentInstrCycles = 26; 
@@ -40245,7 +40245,7 @@ fill_prefetch_0 ();
 endlabel2396: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1000_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1000_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40259,7 +40259,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1000_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1008_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1008_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40273,7 +40273,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1008_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1010_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1010_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40288,7 +40288,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1010_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1018_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1018_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40304,7 +40304,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1018_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1020_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1020_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40320,7 +40320,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1020_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1028_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1028_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40335,7 +40335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1028_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1030_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1030_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40351,7 +40351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1038_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1038_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -40365,7 +40365,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1038_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1039_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1039_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40379,7 +40379,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1039_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -40394,7 +40394,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103a_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -40410,7 +40410,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_103c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_103c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
@@ -40423,7 +40423,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103c_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1080_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1080_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40438,7 +40438,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1088_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1088_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40453,7 +40453,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1090_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1090_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40469,7 +40469,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1098_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1098_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40486,7 +40486,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40503,7 +40503,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40519,7 +40519,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40536,7 +40536,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40551,7 +40551,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -40566,7 +40566,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40582,7 +40582,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -40599,7 +40599,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -40613,7 +40613,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40629,7 +40629,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40645,7 +40645,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40662,7 +40662,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40680,7 +40680,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40698,7 +40698,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40715,7 +40715,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40733,7 +40733,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40749,7 +40749,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10f9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -40765,7 +40765,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fa_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40782,7 +40782,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -40800,7 +40800,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_10fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_10fc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -40815,7 +40815,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1100_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1100_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40831,7 +40831,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1108_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1108_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40847,7 +40847,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1110_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1110_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40864,7 +40864,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1118_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1118_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40882,7 +40882,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1120_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1120_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40900,7 +40900,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,src);
 }}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1128_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1128_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40917,7 +40917,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1130_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1130_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -40935,7 +40935,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1138_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1138_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40951,7 +40951,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1139_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1139_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -40967,7 +40967,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -40984,7 +40984,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -41002,7 +41002,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_113c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_113c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -41017,7 +41017,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1140_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1140_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41032,7 +41032,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1148_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1148_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41047,7 +41047,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1150_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1150_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41063,7 +41063,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1158_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1158_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41080,7 +41080,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1160_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1160_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41097,7 +41097,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1168_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1168_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41113,7 +41113,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1170_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1170_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41130,7 +41130,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1178_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1178_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41145,7 +41145,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1179_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1179_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -41160,7 +41160,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41176,7 +41176,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -41193,7 +41193,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_117c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_117c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41207,7 +41207,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1180_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1180_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41223,7 +41223,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1188_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1188_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41239,7 +41239,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1190_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1190_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41256,7 +41256,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_1198_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_1198_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41274,7 +41274,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41292,7 +41292,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41309,7 +41309,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41327,7 +41327,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -41343,7 +41343,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -41359,7 +41359,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -41376,7 +41376,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -41394,7 +41394,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -41409,7 +41409,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -41423,7 +41423,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -41437,7 +41437,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41452,7 +41452,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41468,7 +41468,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -41484,7 +41484,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41499,7 +41499,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -41515,7 +41515,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -41529,7 +41529,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -41543,7 +41543,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -41558,7 +41558,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -41574,7 +41574,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_11fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_11fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -41587,7 +41587,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41601,7 +41601,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41615,7 +41615,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41630,7 +41630,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41646,7 +41646,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -41662,7 +41662,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -41677,7 +41677,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -41693,7 +41693,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -41707,7 +41707,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -41721,7 +41721,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -41736,7 +41736,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -41752,7 +41752,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}}return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_13fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_13fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -41765,7 +41765,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,src);
 }}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2000_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2000_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41779,7 +41779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2000_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2008_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2008_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41793,7 +41793,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2008_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2010_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2010_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41816,7 +41816,7 @@ fill_prefetch_2 ();
 endlabel2495: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2018_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2018_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41840,7 +41840,7 @@ fill_prefetch_2 ();
 endlabel2496: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2020_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2020_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41864,7 +41864,7 @@ fill_prefetch_2 ();
 endlabel2497: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2028_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2028_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41887,7 +41887,7 @@ fill_prefetch_0 ();
 endlabel2498: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2030_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2030_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -41911,7 +41911,7 @@ fill_prefetch_0 ();
 endlabel2499: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2038_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2038_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41933,7 +41933,7 @@ fill_prefetch_0 ();
 endlabel2500: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2039_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2039_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -41955,7 +41955,7 @@ fill_prefetch_0 ();
 endlabel2501: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -41978,7 +41978,7 @@ fill_prefetch_0 ();
 endlabel2502: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -42002,7 +42002,7 @@ fill_prefetch_0 ();
 endlabel2503: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_203c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_203c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -42015,7 +42015,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203c_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2040_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2040_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42027,7 +42027,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2040_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2048_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2048_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42039,7 +42039,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2048_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2050_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2050_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42060,7 +42060,7 @@ fill_prefetch_2 ();
 endlabel2507: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2058_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2058_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42082,7 +42082,7 @@ fill_prefetch_2 ();
 endlabel2508: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2060_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2060_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42104,7 +42104,7 @@ fill_prefetch_2 ();
 endlabel2509: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2068_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2068_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42125,7 +42125,7 @@ fill_prefetch_0 ();
 endlabel2510: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2070_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2070_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42147,7 +42147,7 @@ fill_prefetch_0 ();
 endlabel2511: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2078_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2078_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -42167,7 +42167,7 @@ fill_prefetch_0 ();
 endlabel2512: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2079_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2079_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 20; 
@@ -42187,7 +42187,7 @@ fill_prefetch_0 ();
 endlabel2513: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207a_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207a_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -42208,7 +42208,7 @@ fill_prefetch_0 ();
 endlabel2514: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207b_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207b_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 18; 
@@ -42230,7 +42230,7 @@ fill_prefetch_0 ();
 endlabel2515: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_207c_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_207c_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -42241,7 +42241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_207c_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2080_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2080_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42264,7 +42264,7 @@ fill_prefetch_2 ();
 }}}}endlabel2517: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2088_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2088_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42287,7 +42287,7 @@ fill_prefetch_2 ();
 }}}}endlabel2518: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2090_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2090_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42318,7 +42318,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2519: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2098_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2098_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42350,7 +42350,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2520: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42382,7 +42382,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2521: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42413,7 +42413,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2522: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42445,7 +42445,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2523: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -42475,7 +42475,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2524: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -42505,7 +42505,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2525: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -42536,7 +42536,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2526: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -42568,7 +42568,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2527: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -42590,7 +42590,7 @@ fill_prefetch_0 ();
 }}}}endlabel2528: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42614,7 +42614,7 @@ fill_prefetch_2 ();
 }}}}endlabel2529: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42638,7 +42638,7 @@ fill_prefetch_2 ();
 }}}}endlabel2530: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42670,7 +42670,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2531: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42703,7 +42703,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2532: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42736,7 +42736,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2533: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42768,7 +42768,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2534: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42801,7 +42801,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2535: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -42832,7 +42832,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2536: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20f9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -42863,7 +42863,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2537: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fa_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -42895,7 +42895,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2538: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -42928,7 +42928,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2539: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_20fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_20fc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -42951,7 +42951,7 @@ fill_prefetch_0 ();
 }}}}endlabel2540: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2100_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2100_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42975,7 +42975,7 @@ fill_prefetch_2 ();
 }}}}endlabel2541: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2108_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2108_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -42999,7 +42999,7 @@ fill_prefetch_2 ();
 }}}}endlabel2542: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2110_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2110_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43031,7 +43031,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2543: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2118_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2118_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43064,7 +43064,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2544: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2120_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2120_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43097,7 +43097,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2545: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2128_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2128_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43129,7 +43129,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2546: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2130_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2130_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43162,7 +43162,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2547: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2138_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2138_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -43196,7 +43196,7 @@ return 24;
 #endif
 
 #ifdef PART_3
-unsigned long REGPARAM2 CPUFUNC(op_2139_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2139_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -43227,7 +43227,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2549: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -43259,7 +43259,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2550: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -43292,7 +43292,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2551: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_213c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_213c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -43315,7 +43315,7 @@ fill_prefetch_0 ();
 }}}}endlabel2552: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2140_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2140_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43338,7 +43338,7 @@ fill_prefetch_0 ();
 }}}}endlabel2553: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2148_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2148_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43361,7 +43361,7 @@ fill_prefetch_0 ();
 }}}}endlabel2554: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2150_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2150_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43392,7 +43392,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2555: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2158_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2158_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43424,7 +43424,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2556: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2160_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2160_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43456,7 +43456,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2557: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2168_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2168_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43487,7 +43487,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2558: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2170_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2170_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43519,7 +43519,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2559: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2178_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2178_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -43549,7 +43549,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2560: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2179_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2179_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -43579,7 +43579,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2561: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -43610,7 +43610,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2562: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -43642,7 +43642,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2563: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_217c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_217c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -43664,7 +43664,7 @@ fill_prefetch_0 ();
 }}}}endlabel2564: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2180_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2180_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43688,7 +43688,7 @@ fill_prefetch_0 ();
 }}}}endlabel2565: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2188_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2188_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43712,7 +43712,7 @@ fill_prefetch_0 ();
 }}}}endlabel2566: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2190_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2190_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43744,7 +43744,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2567: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_2198_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_2198_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43777,7 +43777,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2568: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43810,7 +43810,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2569: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43842,7 +43842,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2570: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -43875,7 +43875,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2571: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -43906,7 +43906,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2572: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -43937,7 +43937,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2573: ;
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -43969,7 +43969,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2574: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -44002,7 +44002,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2575: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -44025,7 +44025,7 @@ fill_prefetch_0 ();
 }}}}endlabel2576: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -44047,7 +44047,7 @@ fill_prefetch_0 ();
 }}}}endlabel2577: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -44069,7 +44069,7 @@ fill_prefetch_0 ();
 }}}}endlabel2578: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -44099,7 +44099,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2579: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -44130,7 +44130,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2580: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -44161,7 +44161,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2581: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -44191,7 +44191,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2582: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -44222,7 +44222,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2583: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -44251,7 +44251,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2584: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -44280,7 +44280,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2585: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -44310,7 +44310,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2586: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -44341,7 +44341,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2587: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_21fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_21fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -44362,7 +44362,7 @@ fill_prefetch_0 ();
 }}}}endlabel2588: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -44384,7 +44384,7 @@ fill_prefetch_0 ();
 }}}}endlabel2589: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -44406,7 +44406,7 @@ fill_prefetch_0 ();
 }}}}endlabel2590: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -44436,7 +44436,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2591: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
@@ -44467,7 +44467,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2592: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 30; 
@@ -44498,7 +44498,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2593: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
@@ -44528,7 +44528,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2594: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
@@ -44559,7 +44559,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2595: ;
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -44588,7 +44588,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2596: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 36; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -44617,7 +44617,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2597: ;
 return 36;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 32; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -44647,7 +44647,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2598: ;
 return 32;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 34; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -44678,7 +44678,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2599: ;
 return 34;
 }
-unsigned long REGPARAM2 CPUFUNC(op_23fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_23fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -44699,7 +44699,7 @@ fill_prefetch_0 ();
 }}}}endlabel2600: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3000_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3000_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44713,7 +44713,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3000_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3008_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3008_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44727,7 +44727,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3008_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3010_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3010_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44750,7 +44750,7 @@ fill_prefetch_2 ();
 endlabel2603: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3018_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3018_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44774,7 +44774,7 @@ fill_prefetch_2 ();
 endlabel2604: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3020_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3020_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44798,7 +44798,7 @@ fill_prefetch_2 ();
 endlabel2605: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3028_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3028_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44821,7 +44821,7 @@ fill_prefetch_0 ();
 endlabel2606: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3030_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3030_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44845,7 +44845,7 @@ fill_prefetch_0 ();
 endlabel2607: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3038_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3038_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -44867,7 +44867,7 @@ fill_prefetch_0 ();
 endlabel2608: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3039_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3039_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -44889,7 +44889,7 @@ fill_prefetch_0 ();
 endlabel2609: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -44912,7 +44912,7 @@ fill_prefetch_0 ();
 endlabel2610: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 14; 
@@ -44936,7 +44936,7 @@ fill_prefetch_0 ();
 endlabel2611: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_303c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_303c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
@@ -44949,7 +44949,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303c_5)(uae_u32 opcode) /* MOVE */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3040_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3040_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44961,7 +44961,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3040_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3048_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3048_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44973,7 +44973,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3048_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3050_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3050_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -44994,7 +44994,7 @@ fill_prefetch_2 ();
 endlabel2615: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3058_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3058_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45016,7 +45016,7 @@ fill_prefetch_2 ();
 endlabel2616: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3060_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3060_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45038,7 +45038,7 @@ fill_prefetch_2 ();
 endlabel2617: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3068_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3068_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45059,7 +45059,7 @@ fill_prefetch_0 ();
 endlabel2618: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3070_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3070_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45081,7 +45081,7 @@ fill_prefetch_0 ();
 endlabel2619: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3078_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3078_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -45101,7 +45101,7 @@ fill_prefetch_0 ();
 endlabel2620: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3079_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3079_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 16; 
@@ -45121,7 +45121,7 @@ fill_prefetch_0 ();
 endlabel2621: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307a_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307a_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 12; 
@@ -45142,7 +45142,7 @@ fill_prefetch_0 ();
 endlabel2622: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307b_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307b_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 14; 
@@ -45164,7 +45164,7 @@ fill_prefetch_0 ();
 endlabel2623: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_307c_5)(uae_u32 opcode) /* MOVEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_307c_5)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 31; CurrentInstrCycles = 8;  
@@ -45175,7 +45175,7 @@ unsigned long REGPARAM2 CPUFUNC(op_307c_5)(uae_u32 opcode) /* MOVEA */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3080_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3080_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45198,7 +45198,7 @@ fill_prefetch_2 ();
 }}}}endlabel2625: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3088_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3088_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45221,7 +45221,7 @@ fill_prefetch_2 ();
 }}}}endlabel2626: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3090_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3090_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45252,7 +45252,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2627: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3098_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3098_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45284,7 +45284,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2628: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45316,7 +45316,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2629: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45347,7 +45347,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2630: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45379,7 +45379,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2631: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -45409,7 +45409,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2632: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -45439,7 +45439,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2633: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -45470,7 +45470,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2634: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -45502,7 +45502,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2635: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -45524,7 +45524,7 @@ fill_prefetch_0 ();
 }}}}endlabel2636: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45548,7 +45548,7 @@ fill_prefetch_2 ();
 }}}}endlabel2637: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45572,7 +45572,7 @@ fill_prefetch_2 ();
 }}}}endlabel2638: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45604,7 +45604,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2639: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45637,7 +45637,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2640: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45670,7 +45670,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2641: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45702,7 +45702,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2642: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45735,7 +45735,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2643: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -45766,7 +45766,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2644: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30f9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -45797,7 +45797,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2645: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fa_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -45829,7 +45829,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2646: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -45862,7 +45862,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2647: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_30fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_30fc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -45885,7 +45885,7 @@ fill_prefetch_0 ();
 }}}}endlabel2648: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3100_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3100_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45909,7 +45909,7 @@ fill_prefetch_2 ();
 }}}}endlabel2649: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3108_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3108_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45933,7 +45933,7 @@ fill_prefetch_2 ();
 }}}}endlabel2650: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3110_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3110_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45965,7 +45965,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2651: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3118_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3118_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -45998,7 +45998,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2652: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3120_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3120_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46031,7 +46031,7 @@ fill_prefetch_2 ();
 }}}}}}endlabel2653: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3128_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3128_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46063,7 +46063,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2654: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3130_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3130_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46096,7 +46096,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2655: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3138_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3138_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -46127,7 +46127,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2656: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3139_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3139_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -46158,7 +46158,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2657: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -46190,7 +46190,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2658: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -46223,7 +46223,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2659: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_313c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_313c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -46246,7 +46246,7 @@ fill_prefetch_0 ();
 }}}}endlabel2660: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3140_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3140_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46269,7 +46269,7 @@ fill_prefetch_0 ();
 }}}}endlabel2661: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3148_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3148_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46292,7 +46292,7 @@ fill_prefetch_0 ();
 }}}}endlabel2662: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3150_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3150_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46323,7 +46323,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2663: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3158_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3158_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46355,7 +46355,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2664: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3160_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3160_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46387,7 +46387,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2665: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3168_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3168_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46418,7 +46418,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2666: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3170_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3170_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46450,7 +46450,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2667: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3178_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3178_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -46480,7 +46480,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2668: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3179_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3179_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -46510,7 +46510,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2669: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317a_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317a_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -46541,7 +46541,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2670: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317b_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317b_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -46573,7 +46573,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2671: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_317c_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_317c_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -46595,7 +46595,7 @@ fill_prefetch_0 ();
 }}}}endlabel2672: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3180_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3180_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46619,7 +46619,7 @@ fill_prefetch_0 ();
 }}}}endlabel2673: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3188_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3188_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46643,7 +46643,7 @@ fill_prefetch_0 ();
 }}}}endlabel2674: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3190_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3190_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46675,7 +46675,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2675: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_3198_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_3198_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46708,7 +46708,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2676: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46741,7 +46741,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2677: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31a8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31a8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46773,7 +46773,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2678: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -46806,7 +46806,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2679: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -46837,7 +46837,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2680: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31b9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31b9_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -46868,7 +46868,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2681: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31ba_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31ba_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -46900,7 +46900,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2682: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bb_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -46933,7 +46933,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2683: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31bc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31bc_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -46956,7 +46956,7 @@ fill_prefetch_0 ();
 }}}}endlabel2684: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -46978,7 +46978,7 @@ fill_prefetch_0 ();
 }}}}endlabel2685: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
@@ -47000,7 +47000,7 @@ fill_prefetch_0 ();
 }}}}endlabel2686: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -47030,7 +47030,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2687: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -47061,7 +47061,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2688: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 18; 
@@ -47092,7 +47092,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2689: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -47122,7 +47122,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2690: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -47153,7 +47153,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2691: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -47182,7 +47182,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2692: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -47211,7 +47211,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2693: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -47241,7 +47241,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2694: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -47272,7 +47272,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2695: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_31fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_31fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -47293,7 +47293,7 @@ fill_prefetch_0 ();
 }}}}endlabel2696: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33c0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33c0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -47315,7 +47315,7 @@ fill_prefetch_0 ();
 }}}}endlabel2697: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33c8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33c8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
@@ -47337,7 +47337,7 @@ fill_prefetch_0 ();
 }}}}endlabel2698: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33d0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33d0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -47367,7 +47367,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2699: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33d8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33d8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
@@ -47398,7 +47398,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2700: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33e0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33e0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 22; 
@@ -47429,7 +47429,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2701: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33e8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33e8_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
@@ -47459,7 +47459,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2702: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f0_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f0_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
@@ -47490,7 +47490,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2703: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f8_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f8_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -47519,7 +47519,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2704: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33f9_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33f9_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -47548,7 +47548,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2705: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fa_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fa_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -47578,7 +47578,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2706: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fb_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fb_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 26; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -47609,7 +47609,7 @@ fill_prefetch_0 ();
 }}}}}}endlabel2707: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_33fc_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_33fc_5)(uae_u32 opcode) /* MOVE */
 {
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -48628,7 +48628,7 @@ fill_prefetch_0 ();
 }}}endlabel2751: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41d0_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41d0_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -48639,7 +48639,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41d0_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41e8_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41e8_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -48650,7 +48650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41e8_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f0_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f0_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -48662,7 +48662,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f0_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f8_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f8_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 8;  
@@ -48672,7 +48672,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f8_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41f9_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41f9_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 12; 
@@ -48682,7 +48682,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41f9_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41fa_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41fa_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 8;  
@@ -48693,7 +48693,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41fa_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_41fb_5)(uae_u32 opcode) /* LEA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_41fb_5)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 56; CurrentInstrCycles = 14; 
@@ -48705,7 +48705,7 @@ unsigned long REGPARAM2 CPUFUNC(op_41fb_5)(uae_u32 opcode) /* LEA */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4200_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4200_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
@@ -48717,7 +48717,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4200_5)(uae_u32 opcode) /* CLR */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4210_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4210_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -48731,7 +48731,7 @@ fill_prefetch_2 ();
 	put_byte(srca,0);
 }}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4218_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4218_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -48746,7 +48746,7 @@ fill_prefetch_2 ();
 	put_byte(srca,0);
 }}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4220_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4220_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 14; 
@@ -48761,7 +48761,7 @@ fill_prefetch_2 ();
 	put_byte(srca,0);
 }}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4228_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4228_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
@@ -48775,7 +48775,7 @@ fill_prefetch_0 ();
 	put_byte(srca,0);
 }}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4230_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4230_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -48790,7 +48790,7 @@ fill_prefetch_0 ();
 	put_byte(srca,0);
 }}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4238_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4238_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -48803,7 +48803,7 @@ fill_prefetch_0 ();
 	put_byte(srca,0);
 }}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4239_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4239_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -48816,7 +48816,7 @@ fill_prefetch_0 ();
 	put_byte(srca,0);
 }}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4240_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4240_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
@@ -48828,7 +48828,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4240_5)(uae_u32 opcode) /* CLR */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4250_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4250_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -48850,7 +48850,7 @@ fill_prefetch_2 ();
 }}}endlabel2768: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4258_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4258_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
@@ -48873,7 +48873,7 @@ fill_prefetch_2 ();
 }}}endlabel2769: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4260_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4260_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 14; 
@@ -48896,7 +48896,7 @@ fill_prefetch_2 ();
 }}}endlabel2770: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4268_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4268_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
@@ -48921,7 +48921,7 @@ return 16;
 #endif
 
 #ifdef PART_4
-unsigned long REGPARAM2 CPUFUNC(op_4270_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4270_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 18; 
@@ -48944,7 +48944,7 @@ fill_prefetch_0 ();
 }}}endlabel2772: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4278_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4278_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -48965,7 +48965,7 @@ fill_prefetch_0 ();
 }}}endlabel2773: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4279_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4279_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -48986,7 +48986,7 @@ fill_prefetch_0 ();
 }}}endlabel2774: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4280_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4280_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
@@ -48998,7 +48998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4280_5)(uae_u32 opcode) /* CLR */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4290_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4290_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
@@ -49020,7 +49020,7 @@ fill_prefetch_2 ();
 }}}endlabel2776: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4298_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4298_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
@@ -49043,7 +49043,7 @@ fill_prefetch_2 ();
 }}}endlabel2777: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42a0_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42a0_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 22; 
@@ -49066,7 +49066,7 @@ fill_prefetch_2 ();
 }}}endlabel2778: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42a8_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42a8_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
@@ -49088,7 +49088,7 @@ fill_prefetch_0 ();
 }}}endlabel2779: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b0_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b0_5)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 26; 
@@ -49111,7 +49111,7 @@ fill_prefetch_0 ();
 }}}endlabel2780: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b8_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b8_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -49132,7 +49132,7 @@ fill_prefetch_0 ();
 }}}endlabel2781: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_42b9_5)(uae_u32 opcode) /* CLR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_42b9_5)(uae_u32 opcode) /* CLR */
 {
 	OpcodeFamily = 18; CurrentInstrCycles = 28; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -50882,7 +50882,7 @@ fill_prefetch_0 ();
 	put_byte(srca,newv);
 }}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4840_5)(uae_u32 opcode) /* SWAP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4840_5)(uae_u32 opcode) /* SWAP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 34; CurrentInstrCycles = 4;  
@@ -51036,7 +51036,7 @@ fill_prefetch_0 ();
 }}}}endlabel2868: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4880_5)(uae_u32 opcode) /* EXT */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4880_5)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
@@ -51050,7 +51050,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4880_5)(uae_u32 opcode) /* EXT */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4890_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4890_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51073,7 +51073,7 @@ fill_prefetch_0 ();
 }}}}endlabel2870: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48a0_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48a0_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51097,7 +51097,7 @@ fill_prefetch_0 ();
 }}}}endlabel2871: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48a8_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48a8_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51120,7 +51120,7 @@ fill_prefetch_0 ();
 }}}}endlabel2872: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b0_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b0_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51144,7 +51144,7 @@ fill_prefetch_0 ();
 }}}}endlabel2873: ;
  return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b8_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b8_5)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 12; 
@@ -51166,7 +51166,7 @@ fill_prefetch_0 ();
 }}}}endlabel2874: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48b9_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48b9_5)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 16; 
@@ -51188,7 +51188,7 @@ fill_prefetch_0 ();
 }}}}endlabel2875: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48c0_5)(uae_u32 opcode) /* EXT */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48c0_5)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
@@ -51202,7 +51202,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48c0_5)(uae_u32 opcode) /* EXT */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_48d0_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48d0_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51225,7 +51225,7 @@ fill_prefetch_0 ();
 }}}}endlabel2877: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48e0_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48e0_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51249,7 +51249,7 @@ fill_prefetch_0 ();
 }}}}endlabel2878: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48e8_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48e8_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51272,7 +51272,7 @@ fill_prefetch_0 ();
 }}}}endlabel2879: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f0_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f0_5)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -51296,7 +51296,7 @@ fill_prefetch_0 ();
 }}}}endlabel2880: ;
  return (14+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f8_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f8_5)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 12; 
@@ -51318,7 +51318,7 @@ fill_prefetch_0 ();
 }}}}endlabel2881: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_48f9_5)(uae_u32 opcode) /* MVMLE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_48f9_5)(uae_u32 opcode) /* MVMLE */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 38; CurrentInstrCycles = 16; 
@@ -51340,7 +51340,7 @@ fill_prefetch_0 ();
 }}}}endlabel2882: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a00_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a00_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -51352,7 +51352,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a00_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a10_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a10_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -51365,7 +51365,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a10_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a18_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a18_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -51379,7 +51379,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a18_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a20_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a20_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 10; 
@@ -51393,7 +51393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a20_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a28_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a28_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -51406,7 +51406,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a28_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a30_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a30_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -51420,7 +51420,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a38_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a38_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -51432,7 +51432,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a38_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a39_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a39_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -51444,7 +51444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a39_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3a_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3a_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -51457,7 +51457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3a_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3b_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3b_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -51471,7 +51471,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a3c_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a3c_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte_prefetch(2);
@@ -51482,7 +51482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3c_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a40_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a40_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -51494,7 +51494,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a40_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a48_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a48_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -51506,7 +51506,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a48_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a50_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a50_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -51527,7 +51527,7 @@ fill_prefetch_2 ();
 endlabel2896: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a58_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a58_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
@@ -51549,7 +51549,7 @@ fill_prefetch_2 ();
 endlabel2897: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a60_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a60_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 10; 
@@ -51571,7 +51571,7 @@ fill_prefetch_2 ();
 endlabel2898: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a68_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a68_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -51592,7 +51592,7 @@ fill_prefetch_0 ();
 endlabel2899: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a70_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a70_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -51614,7 +51614,7 @@ fill_prefetch_0 ();
 endlabel2900: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a78_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a78_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -51634,7 +51634,7 @@ fill_prefetch_0 ();
 endlabel2901: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a79_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a79_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -51654,7 +51654,7 @@ fill_prefetch_0 ();
 endlabel2902: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7a_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7a_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -51675,7 +51675,7 @@ fill_prefetch_0 ();
 endlabel2903: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7b_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7b_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -51697,7 +51697,7 @@ fill_prefetch_0 ();
 endlabel2904: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a7c_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a7c_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -51708,7 +51708,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7c_5)(uae_u32 opcode) /* TST */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a80_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a80_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -51720,7 +51720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a80_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a88_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a88_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
@@ -51732,7 +51732,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a88_5)(uae_u32 opcode) /* TST */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a90_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a90_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -51753,7 +51753,7 @@ fill_prefetch_2 ();
 endlabel2908: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4a98_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4a98_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
@@ -51775,7 +51775,7 @@ fill_prefetch_2 ();
 endlabel2909: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aa0_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aa0_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 14; 
@@ -51797,7 +51797,7 @@ fill_prefetch_2 ();
 endlabel2910: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aa8_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aa8_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
@@ -51818,7 +51818,7 @@ fill_prefetch_0 ();
 endlabel2911: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab0_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab0_5)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
@@ -51840,7 +51840,7 @@ fill_prefetch_0 ();
 endlabel2912: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab8_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab8_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -51860,7 +51860,7 @@ fill_prefetch_0 ();
 endlabel2913: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ab9_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ab9_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -51880,7 +51880,7 @@ fill_prefetch_0 ();
 endlabel2914: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4aba_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4aba_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -51901,7 +51901,7 @@ fill_prefetch_0 ();
 endlabel2915: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4abb_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4abb_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 18; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -51923,7 +51923,7 @@ fill_prefetch_0 ();
 endlabel2916: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4abc_5)(uae_u32 opcode) /* TST */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4abc_5)(uae_u32 opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -52054,7 +52054,7 @@ fill_prefetch_0 ();
 	put_byte(srca,src);
 }}}return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4c90_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4c90_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52077,7 +52077,7 @@ fill_prefetch_0 ();
 endlabel2926: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4c98_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4c98_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52101,7 +52101,7 @@ fill_prefetch_0 ();
 endlabel2927: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ca8_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ca8_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52124,7 +52124,7 @@ fill_prefetch_0 ();
 endlabel2928: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb0_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb0_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52148,7 +52148,7 @@ fill_prefetch_0 ();
 endlabel2929: ;
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb8_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb8_5)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 16; 
@@ -52170,7 +52170,7 @@ fill_prefetch_0 ();
 endlabel2930: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cb9_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cb9_5)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 20; 
@@ -52192,7 +52192,7 @@ fill_prefetch_0 ();
 endlabel2931: ;
  return (20+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cba_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cba_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 	unsigned int retcycles = 0;
@@ -52216,7 +52216,7 @@ fill_prefetch_0 ();
 endlabel2932: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cbb_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cbb_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -52241,7 +52241,7 @@ fill_prefetch_0 ();
 endlabel2933: ;
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cd0_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cd0_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52264,7 +52264,7 @@ fill_prefetch_0 ();
 endlabel2934: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cd8_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cd8_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52288,7 +52288,7 @@ fill_prefetch_0 ();
 endlabel2935: ;
  return (12+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ce8_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ce8_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52311,7 +52311,7 @@ fill_prefetch_0 ();
 endlabel2936: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf0_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf0_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 	unsigned int retcycles = 0;
@@ -52335,7 +52335,7 @@ fill_prefetch_0 ();
 endlabel2937: ;
  return (18+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf8_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf8_5)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 16; 
@@ -52357,7 +52357,7 @@ fill_prefetch_0 ();
 endlabel2938: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cf9_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cf9_5)(uae_u32 opcode) /* MVMEL */
 {
 	unsigned int retcycles = 0;
 	OpcodeFamily = 37; CurrentInstrCycles = 20; 
@@ -52379,7 +52379,7 @@ fill_prefetch_0 ();
 endlabel2939: ;
  return (20+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cfa_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cfa_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 	unsigned int retcycles = 0;
@@ -52403,7 +52403,7 @@ fill_prefetch_0 ();
 endlabel2940: ;
  return (16+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_4cfb_5)(uae_u32 opcode) /* MVMEL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4cfb_5)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 	unsigned int retcycles = 0;
@@ -52508,7 +52508,7 @@ fill_prefetch_2 ();
 endlabel2946: ;
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e70_5)(uae_u32 opcode) /* RESET */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e70_5)(uae_u32 opcode) /* RESET */
 {
 	OpcodeFamily = 42; CurrentInstrCycles = 132;
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel2947; }
@@ -52525,7 +52525,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4e71_5)(uae_u32 opcode) /* NOP */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e72_5)(uae_u32 opcode) /* STOP */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e72_5)(uae_u32 opcode) /* STOP */
 {
 	OpcodeFamily = 44; CurrentInstrCycles = 4;  
 {if (!regs.s) { Exception(8,0,M68000_EXC_SRC_CPU); goto endlabel2949; }
@@ -52568,7 +52568,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2950: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e74_5)(uae_u32 opcode) /* RTD */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e74_5)(uae_u32 opcode) /* RTD */
 {
 	OpcodeFamily = 46; CurrentInstrCycles = 16; 
 {{	uaecptr pca = m68k_areg(regs, 7);
@@ -52588,14 +52588,14 @@ fill_prefetch_0 ();
 }}}}}endlabel2951: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e75_5)(uae_u32 opcode) /* RTS */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4e75_5)(uae_u32 opcode) /* RTS */
 {
 	OpcodeFamily = 49; CurrentInstrCycles = 16; 
 {	m68k_do_rts();
 fill_prefetch_0 ();
 }return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e76_5)(uae_u32 opcode) /* TRAPV */
+OPCODE_COLD unsigned long REGPARAM2 CPUFUNC(op_4e76_5)(uae_u32 opcode) /* TRAPV */
 {
 	OpcodeFamily = 50; CurrentInstrCycles = 4;  
 {m68k_incpc(2);
@@ -52635,7 +52635,7 @@ fill_prefetch_0 ();
 }}}}}}}endlabel2954: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4e90_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4e90_5)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 16; 
@@ -52651,7 +52651,7 @@ fill_prefetch_0 ();
 }}endlabel2955: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ea8_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ea8_5)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
@@ -52667,7 +52667,7 @@ fill_prefetch_0 ();
 }}endlabel2956: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb0_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb0_5)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
@@ -52684,7 +52684,7 @@ fill_prefetch_0 ();
 }}endlabel2957: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb8_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb8_5)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
@@ -52699,7 +52699,7 @@ fill_prefetch_0 ();
 }}endlabel2958: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eb9_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eb9_5)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 20; 
 {{	uaecptr srca = get_ilong_prefetch(2);
@@ -52714,7 +52714,7 @@ fill_prefetch_0 ();
 }}endlabel2959: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4eba_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4eba_5)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 18; 
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -52730,7 +52730,7 @@ fill_prefetch_0 ();
 }}endlabel2960: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_4ebb_5)(uae_u32 opcode) /* JSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_4ebb_5)(uae_u32 opcode) /* JSR */
 {
 	OpcodeFamily = 52; CurrentInstrCycles = 22; 
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -52852,7 +52852,7 @@ fill_prefetch_0 ();
 }}endlabel2968: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5000_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5000_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52874,7 +52874,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5000_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5010_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5010_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52897,7 +52897,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5018_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5018_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52924,7 +52924,7 @@ fill_prefetch_2 ();
 #endif
 
 #ifdef PART_5
-unsigned long REGPARAM2 CPUFUNC(op_5020_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5020_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52948,7 +52948,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5028_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5028_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52971,7 +52971,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5030_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5030_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -52995,7 +52995,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5038_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5038_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -53017,7 +53017,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5039_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5039_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -53039,7 +53039,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5040_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5040_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53061,7 +53061,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5040_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5048_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5048_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53074,7 +53074,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5048_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5050_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5050_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53105,7 +53105,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2979: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5058_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5058_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53137,7 +53137,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2980: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5060_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5060_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53169,7 +53169,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2981: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5068_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5068_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53200,7 +53200,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2982: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5070_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5070_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53232,7 +53232,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2983: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5078_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5078_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -53262,7 +53262,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2984: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5079_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5079_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -53292,7 +53292,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2985: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5080_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5080_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53314,7 +53314,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5080_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5088_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5088_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53327,7 +53327,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5088_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5090_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5090_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53358,7 +53358,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2988: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5098_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5098_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53390,7 +53390,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2989: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50a0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50a0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53422,7 +53422,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel2990: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50a8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50a8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53453,7 +53453,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2991: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53485,7 +53485,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2992: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
@@ -53515,7 +53515,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel2993: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50b9_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50b9_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -53556,7 +53556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_50c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_50c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -53662,7 +53662,7 @@ fill_prefetch_0 ();
 	put_byte(srca,val);
 }}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5100_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5100_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53684,7 +53684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5100_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5110_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5110_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53707,7 +53707,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5118_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5118_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53731,7 +53731,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5120_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5120_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53755,7 +53755,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5128_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5128_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53778,7 +53778,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5130_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5130_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53802,7 +53802,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5138_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5138_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -53824,7 +53824,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5139_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5139_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -53846,7 +53846,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5140_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5140_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53868,7 +53868,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5140_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5148_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5148_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53881,7 +53881,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5148_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5150_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5150_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53912,7 +53912,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3014: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5158_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5158_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53944,7 +53944,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3015: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5160_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5160_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -53976,7 +53976,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3016: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5168_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5168_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54007,7 +54007,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3017: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5170_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5170_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54039,7 +54039,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3018: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5178_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5178_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -54069,7 +54069,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3019: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5179_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5179_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -54099,7 +54099,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3020: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5180_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5180_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54121,7 +54121,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5180_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5188_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5188_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54134,7 +54134,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5188_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5190_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5190_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54165,7 +54165,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3023: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5198_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5198_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54197,7 +54197,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3024: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51a0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51a0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54229,7 +54229,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3025: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51a8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51a8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54260,7 +54260,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3026: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -54292,7 +54292,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3027: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
@@ -54322,7 +54322,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3028: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51b9_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51b9_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -54363,7 +54363,7 @@ unsigned long REGPARAM2 CPUFUNC(op_51c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_51c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_51c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -54480,7 +54480,7 @@ unsigned long REGPARAM2 CPUFUNC(op_52c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_52c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_52c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -54597,7 +54597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_53c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_53c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_53c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -54714,7 +54714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_54c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_54c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_54c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -54831,7 +54831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_55c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_55c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_55c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -54948,7 +54948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_56c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_56c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_56c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55065,7 +55065,7 @@ unsigned long REGPARAM2 CPUFUNC(op_57c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_57c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_57c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55182,7 +55182,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_58c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_58c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55299,7 +55299,7 @@ unsigned long REGPARAM2 CPUFUNC(op_59c0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_59c8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_59c8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55416,7 +55416,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ac0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ac8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5ac8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55533,7 +55533,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5bc0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5bc8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5bc8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55650,7 +55650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5cc0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5cc8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5cc8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55767,7 +55767,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5dc0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5dc8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5dc8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -55884,7 +55884,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5ec0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5ec8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5ec8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -56001,7 +56001,7 @@ unsigned long REGPARAM2 CPUFUNC(op_5fc0_5)(uae_u32 opcode) /* Scc */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_5fc8_5)(uae_u32 opcode) /* DBcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_5fc8_5)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 58; CurrentInstrCycles = 12; 
@@ -56110,7 +56110,7 @@ fill_prefetch_0 ();
 	put_byte(srca,val);
 }}}return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6000_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6000_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56129,7 +56129,7 @@ fill_prefetch_0 ();
 endlabel3165: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6001_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6001_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56149,7 +56149,7 @@ fill_prefetch_2 ();
 endlabel3166: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_60ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_60ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56173,7 +56173,7 @@ fill_prefetch_0 ();
 endlabel3167: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6100_5)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6100_5)(uae_u32 opcode) /* BSR */
 {
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56188,7 +56188,7 @@ fill_prefetch_0 ();
 }}endlabel3168: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6101_5)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6101_5)(uae_u32 opcode) /* BSR */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
@@ -56204,7 +56204,7 @@ fill_prefetch_0 ();
 }}endlabel3169: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_61ff_5)(uae_u32 opcode) /* BSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_61ff_5)(uae_u32 opcode) /* BSR */
 {
 	OpcodeFamily = 54; CurrentInstrCycles = 18; 
 {{	uae_s32 src = get_ilong_prefetch(2);
@@ -56219,7 +56219,7 @@ fill_prefetch_0 ();
 }}endlabel3170: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6200_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6200_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56238,7 +56238,7 @@ fill_prefetch_0 ();
 endlabel3171: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6201_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6201_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56258,7 +56258,7 @@ fill_prefetch_2 ();
 endlabel3172: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_62ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_62ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56282,7 +56282,7 @@ fill_prefetch_0 ();
 endlabel3173: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6300_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6300_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56301,7 +56301,7 @@ fill_prefetch_0 ();
 endlabel3174: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6301_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6301_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56321,7 +56321,7 @@ fill_prefetch_2 ();
 endlabel3175: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_63ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_63ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56345,7 +56345,7 @@ fill_prefetch_0 ();
 endlabel3176: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6400_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6400_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56364,7 +56364,7 @@ fill_prefetch_0 ();
 endlabel3177: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6401_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6401_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56384,7 +56384,7 @@ fill_prefetch_2 ();
 endlabel3178: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_64ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_64ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56408,7 +56408,7 @@ fill_prefetch_0 ();
 endlabel3179: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6500_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6500_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56427,7 +56427,7 @@ fill_prefetch_0 ();
 endlabel3180: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6501_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6501_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56447,7 +56447,7 @@ fill_prefetch_2 ();
 endlabel3181: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_65ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_65ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56471,7 +56471,7 @@ fill_prefetch_0 ();
 endlabel3182: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6600_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6600_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56490,7 +56490,7 @@ fill_prefetch_0 ();
 endlabel3183: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6601_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6601_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56510,7 +56510,7 @@ fill_prefetch_2 ();
 endlabel3184: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_66ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_66ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56534,7 +56534,7 @@ fill_prefetch_0 ();
 endlabel3185: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6700_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6700_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56553,7 +56553,7 @@ fill_prefetch_0 ();
 endlabel3186: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6701_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6701_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56573,7 +56573,7 @@ fill_prefetch_2 ();
 endlabel3187: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_67ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_67ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56597,7 +56597,7 @@ fill_prefetch_0 ();
 endlabel3188: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6800_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6800_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56616,7 +56616,7 @@ fill_prefetch_0 ();
 endlabel3189: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6801_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6801_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56636,7 +56636,7 @@ fill_prefetch_2 ();
 endlabel3190: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_68ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_68ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56660,7 +56660,7 @@ fill_prefetch_0 ();
 endlabel3191: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6900_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6900_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56679,7 +56679,7 @@ fill_prefetch_0 ();
 endlabel3192: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6901_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6901_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56699,7 +56699,7 @@ fill_prefetch_2 ();
 endlabel3193: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_69ff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_69ff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56723,7 +56723,7 @@ fill_prefetch_0 ();
 endlabel3194: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56742,7 +56742,7 @@ fill_prefetch_0 ();
 endlabel3195: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6a01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6a01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56762,7 +56762,7 @@ fill_prefetch_2 ();
 endlabel3196: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6aff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6aff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56786,7 +56786,7 @@ fill_prefetch_0 ();
 endlabel3197: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56805,7 +56805,7 @@ fill_prefetch_0 ();
 endlabel3198: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6b01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6b01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56825,7 +56825,7 @@ fill_prefetch_2 ();
 endlabel3199: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6bff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6bff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56849,7 +56849,7 @@ fill_prefetch_0 ();
 endlabel3200: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6c00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56868,7 +56868,7 @@ fill_prefetch_0 ();
 endlabel3201: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6c01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6c01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56888,7 +56888,7 @@ fill_prefetch_2 ();
 endlabel3202: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6cff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6cff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56912,7 +56912,7 @@ fill_prefetch_0 ();
 endlabel3203: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6d00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6d00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56931,7 +56931,7 @@ fill_prefetch_0 ();
 endlabel3204: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6d01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6d01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -56951,7 +56951,7 @@ fill_prefetch_2 ();
 endlabel3205: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6dff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6dff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -56975,7 +56975,7 @@ fill_prefetch_0 ();
 endlabel3206: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6e00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6e00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -56994,7 +56994,7 @@ fill_prefetch_0 ();
 endlabel3207: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6e01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6e01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -57014,7 +57014,7 @@ fill_prefetch_2 ();
 endlabel3208: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6eff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6eff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -57038,7 +57038,7 @@ fill_prefetch_0 ();
 endlabel3209: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f00_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6f00_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {{	uae_s16 src = get_iword_prefetch(2);
@@ -57057,7 +57057,7 @@ fill_prefetch_0 ();
 endlabel3210: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6f01_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6f01_5)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	OpcodeFamily = 55; CurrentInstrCycles = 8;  
@@ -57077,7 +57077,7 @@ fill_prefetch_2 ();
 endlabel3211: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_6fff_5)(uae_u32 opcode) /* Bcc */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_6fff_5)(uae_u32 opcode) /* Bcc */
 {
 	OpcodeFamily = 55; CurrentInstrCycles = 12; 
 {	m68k_incpc(2);
@@ -57101,7 +57101,7 @@ fill_prefetch_0 ();
 endlabel3212: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_7000_5)(uae_u32 opcode) /* MOVE */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_7000_5)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59146,7 +59146,7 @@ fill_prefetch_0 ();
 }}}endlabel3291: ;
  return (8+retcycles);
 }
-unsigned long REGPARAM2 CPUFUNC(op_9000_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9000_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59168,7 +59168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9000_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9010_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9010_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59191,7 +59191,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9010_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9018_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9018_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59215,7 +59215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9018_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9020_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9020_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59239,7 +59239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9020_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9028_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9028_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59262,7 +59262,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9028_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9030_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9030_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59286,7 +59286,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9038_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9038_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -59308,7 +59308,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9038_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9039_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9039_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -59330,7 +59330,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9039_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903a_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903a_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -59353,7 +59353,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903a_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903b_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903b_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -59377,7 +59377,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_903c_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_903c_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -59398,7 +59398,7 @@ unsigned long REGPARAM2 CPUFUNC(op_903c_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9040_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9040_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59420,7 +59420,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9040_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9048_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9048_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59442,7 +59442,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9048_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9050_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9050_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59473,7 +59473,7 @@ fill_prefetch_2 ();
 endlabel3305: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9058_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9058_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59505,7 +59505,7 @@ fill_prefetch_2 ();
 endlabel3306: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9060_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9060_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59537,7 +59537,7 @@ fill_prefetch_2 ();
 endlabel3307: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9068_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9068_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59568,7 +59568,7 @@ fill_prefetch_0 ();
 endlabel3308: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9070_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9070_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59600,7 +59600,7 @@ fill_prefetch_0 ();
 endlabel3309: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9078_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9078_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -59630,7 +59630,7 @@ fill_prefetch_0 ();
 endlabel3310: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9079_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9079_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -59660,7 +59660,7 @@ fill_prefetch_0 ();
 endlabel3311: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907a_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907a_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 12; 
@@ -59691,7 +59691,7 @@ fill_prefetch_0 ();
 endlabel3312: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907b_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907b_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 14; 
@@ -59723,7 +59723,7 @@ fill_prefetch_0 ();
 endlabel3313: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_907c_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_907c_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 8;  
@@ -59744,7 +59744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_907c_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9080_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9080_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59766,7 +59766,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9080_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9088_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9088_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59788,7 +59788,7 @@ unsigned long REGPARAM2 CPUFUNC(op_9088_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9090_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9090_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59819,7 +59819,7 @@ fill_prefetch_2 ();
 endlabel3317: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9098_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9098_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59851,7 +59851,7 @@ fill_prefetch_2 ();
 endlabel3318: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90a0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90a0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59883,7 +59883,7 @@ fill_prefetch_2 ();
 endlabel3319: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90a8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90a8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59914,7 +59914,7 @@ fill_prefetch_0 ();
 endlabel3320: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -59946,7 +59946,7 @@ fill_prefetch_0 ();
 endlabel3321: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -59976,7 +59976,7 @@ fill_prefetch_0 ();
 endlabel3322: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90b9_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90b9_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 22; 
@@ -60006,7 +60006,7 @@ fill_prefetch_0 ();
 endlabel3323: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90ba_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90ba_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 18; 
@@ -60037,7 +60037,7 @@ fill_prefetch_0 ();
 endlabel3324: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90bb_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90bb_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -60069,7 +60069,7 @@ fill_prefetch_0 ();
 endlabel3325: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90bc_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90bc_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -60090,7 +60090,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90bc_5)(uae_u32 opcode) /* SUB */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90c0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90c0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60103,7 +60103,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90c0_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90c8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90c8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60116,7 +60116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90c8_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90d0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90d0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60138,7 +60138,7 @@ fill_prefetch_2 ();
 endlabel3329: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90d8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90d8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60161,7 +60161,7 @@ fill_prefetch_2 ();
 endlabel3330: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90e0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90e0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60184,7 +60184,7 @@ fill_prefetch_2 ();
 endlabel3331: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90e8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90e8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60206,7 +60206,7 @@ fill_prefetch_0 ();
 endlabel3332: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -60229,7 +60229,7 @@ fill_prefetch_0 ();
 endlabel3333: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -60250,7 +60250,7 @@ fill_prefetch_0 ();
 endlabel3334: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90f9_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90f9_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 20; 
@@ -60271,7 +60271,7 @@ fill_prefetch_0 ();
 endlabel3335: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fa_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fa_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -60293,7 +60293,7 @@ fill_prefetch_0 ();
 endlabel3336: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fb_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fb_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -60316,7 +60316,7 @@ fill_prefetch_0 ();
 endlabel3337: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_90fc_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_90fc_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 12; 
@@ -60374,7 +60374,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9110_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9110_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60397,7 +60397,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9118_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9118_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60421,7 +60421,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9120_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9120_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60445,7 +60445,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9128_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9128_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60468,7 +60468,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9130_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9130_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60492,7 +60492,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9138_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9138_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -60514,7 +60514,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9139_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9139_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -60597,7 +60597,7 @@ fill_prefetch_2 ();
 }}}}}}}}}endlabel3349: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9150_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9150_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60628,7 +60628,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3350: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9158_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9158_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60660,7 +60660,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3351: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9160_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9160_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60692,7 +60692,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3352: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9168_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9168_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60723,7 +60723,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3353: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9170_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9170_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60755,7 +60755,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3354: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9178_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9178_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 16; 
@@ -60785,7 +60785,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3355: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9179_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9179_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 20; 
@@ -60876,7 +60876,7 @@ fill_prefetch_2 ();
 }}}}}}}}}endlabel3358: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9190_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9190_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60907,7 +60907,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3359: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_9198_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_9198_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60939,7 +60939,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3360: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91a0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91a0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -60971,7 +60971,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3361: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91a8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91a8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -61002,7 +61002,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3362: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b0_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b0_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -61034,7 +61034,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3363: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b8_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b8_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 24; 
@@ -61064,7 +61064,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3364: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91b9_5)(uae_u32 opcode) /* SUB */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91b9_5)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 7; CurrentInstrCycles = 28; 
@@ -61094,7 +61094,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3365: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91c0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91c0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61107,7 +61107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91c0_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91c8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91c8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61120,7 +61120,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91c8_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91d0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91d0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61142,7 +61142,7 @@ fill_prefetch_2 ();
 endlabel3368: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91d8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91d8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61165,7 +61165,7 @@ fill_prefetch_2 ();
 endlabel3369: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91e0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91e0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61188,7 +61188,7 @@ fill_prefetch_2 ();
 endlabel3370: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91e8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91e8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61210,7 +61210,7 @@ fill_prefetch_0 ();
 endlabel3371: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f0_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f0_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61233,7 +61233,7 @@ fill_prefetch_0 ();
 endlabel3372: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f8_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f8_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -61254,7 +61254,7 @@ fill_prefetch_0 ();
 endlabel3373: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91f9_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91f9_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 22; 
@@ -61275,7 +61275,7 @@ fill_prefetch_0 ();
 endlabel3374: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fa_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fa_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 18; 
@@ -61297,7 +61297,7 @@ fill_prefetch_0 ();
 endlabel3375: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fb_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fb_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 20; 
@@ -61320,7 +61320,7 @@ fill_prefetch_0 ();
 endlabel3376: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_91fc_5)(uae_u32 opcode) /* SUBA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_91fc_5)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 8; CurrentInstrCycles = 16; 
@@ -61332,7 +61332,7 @@ unsigned long REGPARAM2 CPUFUNC(op_91fc_5)(uae_u32 opcode) /* SUBA */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b000_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b000_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61351,7 +61351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b000_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b010_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b010_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61371,7 +61371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b010_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b018_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b018_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61392,7 +61392,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b018_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b020_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b020_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61413,7 +61413,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b020_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b028_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b028_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61433,7 +61433,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b028_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b030_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b030_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61454,7 +61454,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b038_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b038_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -61473,7 +61473,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b038_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b039_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b039_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -61492,7 +61492,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b039_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b03a_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03a_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -61512,7 +61512,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b03a_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b03b_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03b_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -61536,7 +61536,7 @@ return 14;
 #endif
 
 #ifdef PART_7
-unsigned long REGPARAM2 CPUFUNC(op_b03c_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b03c_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -61554,7 +61554,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b03c_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b040_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b040_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61573,7 +61573,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b040_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b048_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b048_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61592,7 +61592,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b048_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b050_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b050_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61620,7 +61620,7 @@ fill_prefetch_2 ();
 endlabel3391: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b058_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b058_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61649,7 +61649,7 @@ fill_prefetch_2 ();
 endlabel3392: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b060_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b060_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61678,7 +61678,7 @@ fill_prefetch_2 ();
 endlabel3393: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b068_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b068_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61706,7 +61706,7 @@ fill_prefetch_0 ();
 endlabel3394: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b070_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b070_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61735,7 +61735,7 @@ fill_prefetch_0 ();
 endlabel3395: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b078_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b078_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -61762,7 +61762,7 @@ fill_prefetch_0 ();
 endlabel3396: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b079_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b079_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 16; 
@@ -61789,7 +61789,7 @@ fill_prefetch_0 ();
 endlabel3397: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07a_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07a_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 12; 
@@ -61817,7 +61817,7 @@ fill_prefetch_0 ();
 endlabel3398: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07b_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07b_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -61846,7 +61846,7 @@ fill_prefetch_0 ();
 endlabel3399: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b07c_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b07c_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 8;  
@@ -61864,7 +61864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b07c_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b080_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b080_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61883,7 +61883,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b080_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b088_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b088_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61902,7 +61902,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b088_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b090_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b090_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61930,7 +61930,7 @@ fill_prefetch_2 ();
 endlabel3403: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b098_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b098_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61959,7 +61959,7 @@ fill_prefetch_2 ();
 endlabel3404: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0a0_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0a0_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -61988,7 +61988,7 @@ fill_prefetch_2 ();
 endlabel3405: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0a8_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0a8_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62016,7 +62016,7 @@ fill_prefetch_0 ();
 endlabel3406: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b0_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b0_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62045,7 +62045,7 @@ fill_prefetch_0 ();
 endlabel3407: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b8_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b8_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -62072,7 +62072,7 @@ fill_prefetch_0 ();
 endlabel3408: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0b9_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0b9_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 22; 
@@ -62099,7 +62099,7 @@ fill_prefetch_0 ();
 endlabel3409: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0ba_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0ba_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 18; 
@@ -62127,7 +62127,7 @@ fill_prefetch_0 ();
 endlabel3410: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0bb_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0bb_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 20; 
@@ -62156,7 +62156,7 @@ fill_prefetch_0 ();
 endlabel3411: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0bc_5)(uae_u32 opcode) /* CMP */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0bc_5)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 25; CurrentInstrCycles = 14; 
@@ -62174,7 +62174,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bc_5)(uae_u32 opcode) /* CMP */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0c0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0c0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62193,7 +62193,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c0_5)(uae_u32 opcode) /* CMPA */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0c8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0c8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62212,7 +62212,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c8_5)(uae_u32 opcode) /* CMPA */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0d0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0d0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62240,7 +62240,7 @@ fill_prefetch_2 ();
 endlabel3415: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0d8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0d8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62269,7 +62269,7 @@ fill_prefetch_2 ();
 endlabel3416: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0e0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0e0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62298,7 +62298,7 @@ fill_prefetch_2 ();
 endlabel3417: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0e8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0e8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62326,7 +62326,7 @@ fill_prefetch_0 ();
 endlabel3418: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -62355,7 +62355,7 @@ fill_prefetch_0 ();
 endlabel3419: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -62382,7 +62382,7 @@ fill_prefetch_0 ();
 endlabel3420: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0f9_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0f9_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -62409,7 +62409,7 @@ fill_prefetch_0 ();
 endlabel3421: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fa_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fa_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -62437,7 +62437,7 @@ fill_prefetch_0 ();
 endlabel3422: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fb_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fb_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 16; 
@@ -62466,7 +62466,7 @@ fill_prefetch_0 ();
 endlabel3423: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b0fc_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b0fc_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 10; 
@@ -63127,7 +63127,7 @@ fill_prefetch_0 ();
 }}}}}endlabel3451: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1c0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1c0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63146,7 +63146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c0_5)(uae_u32 opcode) /* CMPA */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1c8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1c8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63165,7 +63165,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c8_5)(uae_u32 opcode) /* CMPA */
 fill_prefetch_2 ();
 return 6;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1d0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1d0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63193,7 +63193,7 @@ fill_prefetch_2 ();
 endlabel3454: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1d8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1d8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63222,7 +63222,7 @@ fill_prefetch_2 ();
 endlabel3455: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1e0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1e0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63251,7 +63251,7 @@ fill_prefetch_2 ();
 endlabel3456: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1e8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1e8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63279,7 +63279,7 @@ fill_prefetch_0 ();
 endlabel3457: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f0_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f0_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -63308,7 +63308,7 @@ fill_prefetch_0 ();
 endlabel3458: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f8_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f8_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -63335,7 +63335,7 @@ fill_prefetch_0 ();
 endlabel3459: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1f9_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1f9_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 22; 
@@ -63362,7 +63362,7 @@ fill_prefetch_0 ();
 endlabel3460: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fa_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fa_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 18; 
@@ -63390,7 +63390,7 @@ fill_prefetch_0 ();
 endlabel3461: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fb_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fb_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 20; 
@@ -63419,7 +63419,7 @@ fill_prefetch_0 ();
 endlabel3462: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_b1fc_5)(uae_u32 opcode) /* CMPA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_b1fc_5)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 27; CurrentInstrCycles = 14; 
@@ -64185,7 +64185,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0c0_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
  return (38+retcycles*2);
@@ -64211,7 +64211,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d0_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3498: ;
@@ -64239,7 +64239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d8_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3499: ;
@@ -64267,7 +64267,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e0_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3500: ;
@@ -64294,7 +64294,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e8_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3501: ;
@@ -64322,7 +64322,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3502: ;
@@ -64348,7 +64348,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f8_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3503: ;
@@ -64374,7 +64374,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f9_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3504: ;
@@ -64401,7 +64401,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fa_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3505: ;
@@ -64429,7 +64429,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3506: ;
@@ -64447,7 +64447,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fc_5)(uae_u32 opcode) /* MULU */
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
-	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
+	retcycles = m68k_bitcount ((uae_u16)src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
  return (42+retcycles*2);
@@ -65051,7 +65051,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1c0_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
  return (38+retcycles*2);
@@ -65079,7 +65079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d0_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3535: ;
@@ -65109,7 +65109,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d8_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3536: ;
@@ -65139,7 +65139,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e0_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3537: ;
@@ -65168,7 +65168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e8_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3538: ;
@@ -65198,7 +65198,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3539: ;
@@ -65226,7 +65226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f8_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3540: ;
@@ -65254,7 +65254,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f9_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3541: ;
@@ -65283,7 +65283,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fa_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3542: ;
@@ -65313,7 +65313,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3543: ;
@@ -65333,12 +65333,12 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fc_5)(uae_u32 opcode) /* MULS */
 	SET_NFLG (((uae_s32)(newv)) < 0);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
-	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
+	retcycles = m68k_bitcount (src2 ^ (src2 >> 1));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
  return (42+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_d000_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d000_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65360,7 +65360,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d000_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d010_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d010_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65383,7 +65383,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d010_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d018_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d018_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65407,7 +65407,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d018_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d020_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d020_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65431,7 +65431,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d020_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d028_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d028_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65454,7 +65454,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d028_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d030_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d030_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65478,7 +65478,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d038_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d038_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -65500,7 +65500,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d038_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d039_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d039_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -65522,7 +65522,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d039_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03a_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03a_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -65545,7 +65545,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03a_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03b_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03b_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -65569,7 +65569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d03c_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d03c_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -65590,7 +65590,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d03c_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d040_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d040_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65612,7 +65612,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d040_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d048_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d048_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65634,7 +65634,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d048_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 4;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d050_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d050_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65665,7 +65665,7 @@ fill_prefetch_2 ();
 endlabel3558: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d058_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d058_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65697,7 +65697,7 @@ fill_prefetch_2 ();
 endlabel3559: ;
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d060_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d060_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65729,7 +65729,7 @@ fill_prefetch_2 ();
 endlabel3560: ;
 return 10;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d068_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d068_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65760,7 +65760,7 @@ fill_prefetch_0 ();
 endlabel3561: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d070_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d070_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65792,7 +65792,7 @@ fill_prefetch_0 ();
 endlabel3562: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d078_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d078_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -65822,7 +65822,7 @@ fill_prefetch_0 ();
 endlabel3563: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d079_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d079_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -65852,7 +65852,7 @@ fill_prefetch_0 ();
 endlabel3564: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07a_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07a_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 12; 
@@ -65883,7 +65883,7 @@ fill_prefetch_0 ();
 endlabel3565: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07b_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07b_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 14; 
@@ -65915,7 +65915,7 @@ fill_prefetch_0 ();
 endlabel3566: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d07c_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d07c_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 8;  
@@ -65936,7 +65936,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d07c_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d080_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d080_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65958,7 +65958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d080_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d088_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d088_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -65980,7 +65980,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d088_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d090_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d090_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66011,7 +66011,7 @@ fill_prefetch_2 ();
 endlabel3570: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d098_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d098_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66043,7 +66043,7 @@ fill_prefetch_2 ();
 endlabel3571: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0a0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0a0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66075,7 +66075,7 @@ fill_prefetch_2 ();
 endlabel3572: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0a8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0a8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66106,7 +66106,7 @@ fill_prefetch_0 ();
 endlabel3573: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66138,7 +66138,7 @@ fill_prefetch_0 ();
 endlabel3574: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -66168,7 +66168,7 @@ fill_prefetch_0 ();
 endlabel3575: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0b9_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0b9_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 22; 
@@ -66198,7 +66198,7 @@ fill_prefetch_0 ();
 endlabel3576: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0ba_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0ba_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 18; 
@@ -66229,7 +66229,7 @@ fill_prefetch_0 ();
 endlabel3577: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0bb_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0bb_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -66261,7 +66261,7 @@ fill_prefetch_0 ();
 endlabel3578: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0bc_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0bc_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -66282,7 +66282,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bc_5)(uae_u32 opcode) /* ADD */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0c0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0c0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66295,7 +66295,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0c0_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0c8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0c8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66308,7 +66308,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d0c8_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0d0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0d0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66330,7 +66330,7 @@ fill_prefetch_2 ();
 endlabel3582: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0d8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0d8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66353,7 +66353,7 @@ fill_prefetch_2 ();
 endlabel3583: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0e0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0e0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66376,7 +66376,7 @@ fill_prefetch_2 ();
 endlabel3584: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0e8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0e8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66398,7 +66398,7 @@ fill_prefetch_0 ();
 endlabel3585: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -66421,7 +66421,7 @@ fill_prefetch_0 ();
 endlabel3586: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -66442,7 +66442,7 @@ fill_prefetch_0 ();
 endlabel3587: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0f9_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0f9_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 20; 
@@ -66463,7 +66463,7 @@ fill_prefetch_0 ();
 endlabel3588: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fa_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fa_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -66485,7 +66485,7 @@ fill_prefetch_0 ();
 endlabel3589: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fb_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fb_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -66508,7 +66508,7 @@ fill_prefetch_0 ();
 endlabel3590: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d0fc_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d0fc_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 12; 
@@ -66566,7 +66566,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d110_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d110_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66589,7 +66589,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d118_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d118_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66613,7 +66613,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d120_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d120_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66637,7 +66637,7 @@ fill_prefetch_2 ();
 	put_byte(dsta,newv);
 }}}}}}}return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d128_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d128_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66660,7 +66660,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d130_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d130_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66684,7 +66684,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d138_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d138_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -66706,7 +66706,7 @@ fill_prefetch_0 ();
 	put_byte(dsta,newv);
 }}}}}}}return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d139_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d139_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -66789,7 +66789,7 @@ fill_prefetch_2 ();
 }}}}}}}}}endlabel3602: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d150_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d150_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66820,7 +66820,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3603: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d158_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d158_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66852,7 +66852,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3604: ;
 return 12;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d160_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d160_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66884,7 +66884,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3605: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d168_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d168_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66915,7 +66915,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3606: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d170_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d170_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -66947,7 +66947,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3607: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d178_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d178_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 16; 
@@ -66977,7 +66977,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3608: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d179_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d179_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 20; 
@@ -67068,7 +67068,7 @@ fill_prefetch_2 ();
 }}}}}}}}}endlabel3611: ;
 return 30;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d190_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d190_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67099,7 +67099,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3612: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d198_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d198_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67131,7 +67131,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3613: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1a0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1a0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67163,7 +67163,7 @@ fill_prefetch_2 ();
 }}}}}}}}endlabel3614: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1a8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1a8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67194,7 +67194,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3615: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b0_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b0_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67226,7 +67226,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3616: ;
 return 26;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b8_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b8_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 24; 
@@ -67256,7 +67256,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3617: ;
 return 24;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1b9_5)(uae_u32 opcode) /* ADD */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1b9_5)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	OpcodeFamily = 11; CurrentInstrCycles = 28; 
@@ -67286,7 +67286,7 @@ fill_prefetch_0 ();
 }}}}}}}}endlabel3618: ;
 return 28;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1c0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1c0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67299,7 +67299,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1c0_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1c8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1c8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67312,7 +67312,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1c8_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_2 ();
 return 8;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1d0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1d0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67337,7 +67337,7 @@ return 14;
 #endif
 
 #ifdef PART_8
-unsigned long REGPARAM2 CPUFUNC(op_d1d8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1d8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67360,7 +67360,7 @@ fill_prefetch_2 ();
 endlabel3622: ;
 return 14;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1e0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1e0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67383,7 +67383,7 @@ fill_prefetch_2 ();
 endlabel3623: ;
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1e8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1e8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67405,7 +67405,7 @@ fill_prefetch_0 ();
 endlabel3624: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f0_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f0_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -67428,7 +67428,7 @@ fill_prefetch_0 ();
 endlabel3625: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f8_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f8_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -67449,7 +67449,7 @@ fill_prefetch_0 ();
 endlabel3626: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1f9_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1f9_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 22; 
@@ -67470,7 +67470,7 @@ fill_prefetch_0 ();
 endlabel3627: ;
 return 22;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fa_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fa_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 18; 
@@ -67492,7 +67492,7 @@ fill_prefetch_0 ();
 endlabel3628: ;
 return 18;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fb_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fb_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 20; 
@@ -67515,7 +67515,7 @@ fill_prefetch_0 ();
 endlabel3629: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_d1fc_5)(uae_u32 opcode) /* ADDA */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_d1fc_5)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 12; CurrentInstrCycles = 16; 
@@ -67527,7 +67527,7 @@ unsigned long REGPARAM2 CPUFUNC(op_d1fc_5)(uae_u32 opcode) /* ADDA */
 fill_prefetch_0 ();
 return 16;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e000_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e000_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -67559,7 +67559,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e000_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e008_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e008_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -67647,7 +67647,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e018_5)(uae_u32 opcode) /* ROR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e020_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e020_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67679,7 +67679,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e020_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e028_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e028_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67771,7 +67771,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e038_5)(uae_u32 opcode) /* ROR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e040_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e040_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -67803,7 +67803,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e040_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e048_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e048_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -67891,7 +67891,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e058_5)(uae_u32 opcode) /* ROR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e060_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e060_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -67923,7 +67923,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e060_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e068_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e068_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68014,7 +68014,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e078_5)(uae_u32 opcode) /* ROR */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e080_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e080_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68046,7 +68046,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e080_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e088_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e088_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68134,7 +68134,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e098_5)(uae_u32 opcode) /* ROR */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e0a0_5)(uae_u32 opcode) /* ASR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e0a0_5)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68166,7 +68166,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a0_5)(uae_u32 opcode) /* ASR */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e0a8_5)(uae_u32 opcode) /* LSR */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e0a8_5)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68453,7 +68453,7 @@ fill_prefetch_0 ();
 }}}}}endlabel3661: ;
 return 20;
 }
-unsigned long REGPARAM2 CPUFUNC(op_e100_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e100_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68486,7 +68486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e100_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e108_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e108_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68572,7 +68572,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e118_5)(uae_u32 opcode) /* ROL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e120_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e120_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68605,7 +68605,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e120_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e128_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e128_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68696,7 +68696,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e138_5)(uae_u32 opcode) /* ROL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e140_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e140_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68729,7 +68729,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e140_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e148_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e148_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68815,7 +68815,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e158_5)(uae_u32 opcode) /* ROL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e160_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e160_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68848,7 +68848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e160_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e168_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e168_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -68938,7 +68938,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e178_5)(uae_u32 opcode) /* ROL */
 fill_prefetch_2 ();
  return (6+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e180_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e180_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -68971,7 +68971,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e180_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e188_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e188_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -69057,7 +69057,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e198_5)(uae_u32 opcode) /* ROL */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e1a0_5)(uae_u32 opcode) /* ASL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e1a0_5)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -69090,7 +69090,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a0_5)(uae_u32 opcode) /* ASL */
 fill_prefetch_2 ();
  return (8+retcycles*2);
 }
-unsigned long REGPARAM2 CPUFUNC(op_e1a8_5)(uae_u32 opcode) /* LSL */
+OPCODE_HOT unsigned long REGPARAM2 CPUFUNC(op_e1a8_5)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -7,30 +7,56 @@ extern int NPAGE;
 extern int KCOL;
 extern int BKGCOLOR;
 extern int SHIFTON;
- 
+
+// Keyboard is rendered only when its selection, page, shift or colors
+// change, otherwise the previous rendering is just blended in
+static overlay_t vkbd_overlay;
+
 void virtual_kdb(unsigned short int *pixels,int vx,int vy)
 {
-   int x, y, page;
+   static int prev_state[6];
+   int state[6];
+   int x, y, page, top, height;
    short unsigned *pix, coul;
 
    page = (NPAGE == -1) ? 0 : 50;
-   pix= (short unsigned *)&pixels[0];
-   coul = RGB565(28, 28, 31);
-   BKGCOLOR = (KCOL>0?0x8080:0);
+   top = YBASE3;
+   height = NLIGN*YSIDE + 1;
+
+   state[0] = vx;
+   state[1] = vy;
+   state[2] = page;
+   state[3] = SHIFTON;
+   state[4] = KCOL;
+   state[5] = CROP_WIDTH;
 
-   for(x=0;x<NPLGN;x++)
+   if (!Overlay_Valid(&vkbd_overlay, 0, top, VIRTUAL_WIDTH, height)
+       || memcmp(state, prev_state, sizeof(state)) != 0)
    {
-      for(y=0;y<NLIGN;y++)
+      pix = Overlay_Begin(&vkbd_overlay, 0, top, VIRTUAL_WIDTH, height, false);
+      if (!pix)
+         return;
+      memcpy(prev_state, state, sizeof(state));
+
+      coul = RGB565(28, 28, 31);
+      BKGCOLOR = (KCOL>0?0x8080:0);
+
+      for(x=0;x<NPLGN;x++)
       {
-         DrawBoxBmp(pix,XBASE3+x*XSIDE,YBASE3+y*YSIDE, XSIDE,YSIDE, RGB565(7, 2, 1));
-         Draw_text(pix,XBASE0-2+x*XSIDE ,YBASE0+YSIDE*y,coul, BKGCOLOR ,2, 2,20,
-               SHIFTON==-1?MVk[(y*NPLGN)+x+page].norml:MVk[(y*NPLGN)+x+page].shift);	
+         for(y=0;y<NLIGN;y++)
+         {
+            DrawBoxBmp(pix,XBASE3+x*XSIDE,YBASE3-top+y*YSIDE, XSIDE,YSIDE, RGB565(7, 2, 1));
+            Draw_text(pix,XBASE0-2+x*XSIDE ,YBASE0-top+YSIDE*y,coul, BKGCOLOR ,2, 2,20,
+                  SHIFTON==-1?MVk[(y*NPLGN)+x+page].norml:MVk[(y*NPLGN)+x+page].shift);
+         }
       }
+
+      DrawBoxBmp(pix,XBASE3+vx*XSIDE,YBASE3-top+vy*YSIDE, XSIDE,YSIDE, RGB565(31, 2, 1));
+      Draw_text(pix,XBASE0-2+vx*XSIDE ,YBASE0-top+YSIDE*vy,RGB565(2,31,1), BKGCOLOR ,2, 2,20,
+            SHIFTON==-1?MVk[(vy*NPLGN)+vx+page].norml:MVk[(vy*NPLGN)+vx+page].shift);
    }
 
-   DrawBoxBmp(pix,XBASE3+vx*XSIDE,YBASE3+vy*YSIDE, XSIDE,YSIDE, RGB565(31, 2, 1));
-   Draw_text(pix,XBASE0-2+vx*XSIDE ,YBASE0+YSIDE*vy,RGB565(2,31,1), BKGCOLOR ,2, 2,20,
-         SHIFTON==-1?MVk[(vy*NPLGN)+vx+page].norml:MVk[(vy*NPLGN)+vx+page].shift);	
+   Overlay_Blend(&vkbd_overlay, pixels);
 }
 
 int check_vkey2(int x,int y)
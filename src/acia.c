@@ -141,6 +141,7 @@ const char ACIA_fileid[] = "Hatari acia.c : " __DATE__ " " __TIME__;
 #include "memorySnapShot.h"
 #include "configuration.h"
 #include "acia.h"
+#include "ikbd.h"
 #include "m68000.h"
 #include "cycInt.h"
 #include "ioMem.h"
@@ -224,11 +225,13 @@ static Uint8 		ACIA_Get_Line_DCD_Dummy ( void );
 static void		ACIA_Set_Line_RTS_Dummy ( int bit );
 
 static void		ACIA_Set_Timers_IKBD ( void *pACIA );
+static int		ACIA_BitCycles_IKBD ( ACIA_STRUCT *pACIA );
 static void		ACIA_Start_InterruptHandler_IKBD ( ACIA_STRUCT *pACIA , int InternalCycleOffset );
 
 static Uint8		ACIA_MasterReset ( ACIA_STRUCT *pACIA , Uint8 CR );
 
 static void		ACIA_UpdateIRQ ( ACIA_STRUCT *pACIA );
+static bool		ACIA_Is_Idle ( ACIA_STRUCT *pACIA );
 
 static Uint8		ACIA_Read_SR ( ACIA_STRUCT *pACIA );
 static void		ACIA_Write_CR ( ACIA_STRUCT *pACIA , Uint8 CR );
@@ -436,18 +439,16 @@ static void	ACIA_Set_Timers_IKBD ( void *pACIA )
 
 /*-----------------------------------------------------------------------*/
 /**
- * Set a timer to handle the RX / TX bits at the expected baud rate.
+ * Return the duration of one RX / TX bit in CPU cycles.
  * NOTE : on ST, TX_Clock and RX_Clock are the same, so the timer's freq will be
  * TX_Clock / Divider and we only need one timer interrupt to handle both RX and TX.
  * This freq should be converted to CPU_CYCLE : 1 ACIA cycle = 16 CPU cycles
  * (with cpu running at 8 MHz)
- * InternalCycleOffset allows to compensate for a != 0 value in PendingInterruptCount
- * to keep a constant baud rate.
  * TODO : we use a fixed 8 MHz clock and nCpuFreqShift to convert cycles for our
  * internal timers in cycInt.c. This should be replaced some days by using
  * MachineClocks.CPU_Freq and not using nCpuFreqShift anymore.
  */
-static void	ACIA_Start_InterruptHandler_IKBD ( ACIA_STRUCT *pACIA , int InternalCycleOffset )
+static int	ACIA_BitCycles_IKBD ( ACIA_STRUCT *pACIA )
 {
 	int		Cycles;
 
@@ -457,6 +458,25 @@ static void	ACIA_Start_InterruptHandler_IKBD ( ACIA_STRUCT *pACIA , int Internal
 	Cycles *= pACIA->Clock_Divider;
 	Cycles <<= nCpuFreqShift;					/* Compensate for x2 or x4 cpu speed */
 
+	return Cycles;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set a timer to handle the RX / TX bits at the expected baud rate.
+ * InternalCycleOffset allows to compensate for a != 0 value in PendingInterruptCount
+ * to keep a constant baud rate.
+ */
+static void	ACIA_Start_InterruptHandler_IKBD ( ACIA_STRUCT *pACIA , int InternalCycleOffset )
+{
+	int		Cycles;
+
+
+	Cycles = ACIA_BitCycles_IKBD ( pACIA );
+
 	LOG_TRACE ( TRACE_ACIA, "acia %s start timer divider=%d cpu_cycles=%d VBL=%d HBL=%d\n" , pACIA->ACIA_Name ,
 		pACIA->Clock_Divider , Cycles , nVBLs , nHBL );
 
@@ -471,7 +491,10 @@ static void	ACIA_Start_InterruptHandler_IKBD ( ACIA_STRUCT *pACIA , int Internal
  * Interrupt called each time a new bit must be sent / received with the IKBD.
  * This interrupt will be called at freq ( 500 MHz / ACIA_CR_COUNTER_DIVIDE )
  * On ST, RX_Clock = TX_Clock = 500 MHz.
- * We continuously restart the interrupt, taking into account PendingCyclesOver.
+ * We restart the interrupt, taking into account PendingCyclesOver, as long
+ * as some bits are moving on the serial line. When both the ACIA and the
+ * IKBD are idle, each new bit would only be a '1' stop bit with no effect,
+ * so we stop the timer until ACIA_IKBD_Wakeup() is called.
  */
 void	ACIA_InterruptHandler_IKBD ( void )
 {
@@ -484,18 +507,60 @@ void	ACIA_InterruptHandler_IKBD ( void )
 
 	LOG_TRACE ( TRACE_ACIA, "acia ikbd interrupt handler pending_cyc=%d VBL=%d HBL=%d\n" , PendingCyclesOver , nVBLs , nHBL );
 
+	/* Clock value when this bit was due, used to restart the timer in phase when leaving idle state */
+	pACIA_IKBD->Last_Bit_Clock = CycInt_GetInterruptClock ( INTERRUPT_ACIA_IKBD );
+
 	/* Remove this interrupt from list and re-order */
 	CycInt_AcknowledgeInterrupt();
 
 	ACIA_Clock_TX ( pACIA_IKBD );
 	ACIA_Clock_RX ( pACIA_IKBD );
 
+	if ( ACIA_Is_Idle ( pACIA_IKBD ) && IKBD_SCI_Is_Idle () )
+	{
+		LOG_TRACE ( TRACE_ACIA, "acia ikbd idle, stop timer VBL=%d HBL=%d\n" , nVBLs , nHBL );
+		return;
+	}
+
 	ACIA_Start_InterruptHandler_IKBD ( pACIA_IKBD , -PendingCyclesOver );	/* Compensate for a != 0 value of PendingCyclesOver */
 }
 
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Restart the IKBD's ACIA timer if it was stopped because the serial line
+ * was idle. This must be called each time a new byte could be transferred
+ * by the ACIA or the IKBD.
+ * The next bit is aligned on the baud rate grid of the last bit that was
+ * handled, so bits are clocked at the same cycles as if the timer had never
+ * been stopped.
+ */
+void	ACIA_IKBD_Wakeup ( void )
+{
+	Uint64	Period;
+	Uint64	Clock;
+
+
+	if ( ( pACIA_IKBD->Clock_Divider == 0 ) || CycInt_InterruptActive ( INTERRUPT_ACIA_IKBD ) )
+		return;
+
+	Period = INT_CONVERT_TO_INTERNAL ( (Uint64)ACIA_BitCycles_IKBD ( pACIA_IKBD ) , INT_CPU_CYCLE );
+	Clock = CycInt_GetClock();
+	if ( Clock < pACIA_IKBD->Last_Bit_Clock )
+		Clock = pACIA_IKBD->Last_Bit_Clock;
+	Clock = pACIA_IKBD->Last_Bit_Clock + ( ( Clock - pACIA_IKBD->Last_Bit_Clock ) / Period + 1 ) * Period;
+
+	LOG_TRACE ( TRACE_ACIA, "acia ikbd wakeup timer in %d cpu_cycles VBL=%d HBL=%d\n" ,
+		(int)INT_CONVERT_FROM_INTERNAL ( (Sint64)( Clock - CycInt_GetClock() ) , INT_CPU_CYCLE ) , nVBLs , nHBL );
+
+	CycInt_AddClockInterrupt ( Clock , INTERRUPT_ACIA_IKBD );
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Interrupt called each time a new bit must be sent / received with the MIDI.
@@ -600,6 +665,7 @@ void	ACIA_IKBD_Write_CR ( void )
 				IoMem[0xfffc00], FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC(), CurrentInstrCycles);
 
 	ACIA_Write_CR ( pACIA_IKBD , IoMem[0xfffc00] );
+	ACIA_IKBD_Wakeup ();						/* Break bit or new serial params */
 }
 
 
@@ -620,6 +686,7 @@ void	ACIA_IKBD_Write_TDR ( void )
 				IoMem[0xfffc02], FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC(), CurrentInstrCycles);
 
 	ACIA_Write_TDR ( pACIA_IKBD , IoMem[0xfffc02] );
+	ACIA_IKBD_Wakeup ();						/* New byte to send */
 }
 
 
@@ -728,6 +795,35 @@ static void	ACIA_UpdateIRQ ( ACIA_STRUCT *pACIA )
 
 
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the ACIA has nothing to send and is not receiving a byte.
+ * In that case, clocking a new bit would only send/receive '1' stop bits
+ * and would not change the ACIA's state.
+ */
+static bool	ACIA_Is_Idle ( ACIA_STRUCT *pACIA )
+{
+	return ( pACIA->TX_State == ACIA_STATE_IDLE ) && ( pACIA->SR & ACIA_SR_BIT_TDRE )
+		&& ( pACIA->TX_SendBrk == 0 ) && ( pACIA->RX_State == ACIA_STATE_IDLE );
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the CPU read the last received byte from RDR and no new
+ * byte is being received in RSR. This is used to pace the keys injected
+ * by the host, so they're sent as soon as the guest is ready for them.
+ */
+bool	ACIA_RX_Is_Empty ( ACIA_STRUCT *pACIA )
+{
+	return ( ( pACIA->SR & ACIA_SR_BIT_RDRF ) == 0 ) && ( pACIA->RX_State == ACIA_STATE_IDLE );
+}
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Read SR.
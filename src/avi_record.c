@@ -63,6 +63,7 @@ const char AVIRecord_fileid[] = "Hatari avi_record.c : " __DATE__ " " __TIME__;
 #include "audio.h"
 #include "configuration.h"
 #include "log.h"
+#include "recWriter.h"
 #include "screen.h"
 #include "screenSnapShot.h"
 #include "sound.h"
@@ -74,6 +75,12 @@ const char AVIRecord_fileid[] = "Hatari avi_record.c : " __DATE__ " " __TIME__;
 #include <png.h>
 #endif
 
+#if HAVE_LIBPNG && defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+#define	AVI_PNG_THREADS				3			/* worker threads compressing png frames */
+#define	AVI_QUEUE_SIZE				16			/* max chunks waiting to be written */
+#endif
+
 #include "pixel_convert.h"				/* inline functions */
 
 
@@ -375,7 +382,7 @@ static bool	Avi_RecordVideoStream_BMP ( RECORD_AVI_PARAMS *pAviParams )
 	/* Write the video frame header */
 	Avi_Store4cc ( Chunk.ChunkName , "00db" );				/* stream 0, uncompressed DIB bytes */
 	Avi_StoreU32 ( Chunk.ChunkSize , SizeImage );					/* max size of RGB image */
-	if ( fwrite ( &Chunk , sizeof ( Chunk ) , 1 , pAviParams->FileOut ) != 1 )
+	if ( !RecWriter_Write ( pAviParams->FileOut , &Chunk , sizeof ( Chunk ) ) )
 	{
 		perror ( "Avi_RecordVideoStream_BMP" );
 		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write bmp frame header" );
@@ -413,7 +420,7 @@ static bool	Avi_RecordVideoStream_BMP ( RECORD_AVI_PARAMS *pAviParams )
 		if ( NeedLock )
 			SDL_UnlockSurface ( pAviParams->Surface );
 
-		if ( (int)fwrite ( pBitmapOut , 1 , pAviParams->Width*3 , pAviParams->FileOut ) != pAviParams->Width*3 )
+		if ( !RecWriter_Write ( pAviParams->FileOut , pBitmapOut , pAviParams->Width*3 ) )
 		{
 			perror ( "Avi_RecordVideoStream_BMP" );
 			Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write bmp video frame" );
@@ -437,6 +444,10 @@ static bool	Avi_RecordVideoStream_PNG ( RECORD_AVI_PARAMS *pAviParams )
 	Uint8	TempSize[4];
 	
 
+	/* The PNG chunk size is patched in the file, wait for the queued data first */
+	if ( !RecWriter_Flush ( pAviParams->FileOut ) )
+		goto png_error;
+
 	/* Write the video frame header */
 	ChunkPos = ftell ( pAviParams->FileOut );
 	Avi_Store4cc ( Chunk.ChunkName , "00dc" );				/* stream 0, compressed DIB bytes */
@@ -473,6 +484,331 @@ png_error:
 	Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write png frame" );
 	return false;
 }
+
+
+
+#ifdef AVI_PNG_THREADS
+/*
+ * Parallel PNG encoding :
+ * the emulation thread only converts the cropped surface to 24-bit RGB
+ * and queues it, AVI_PNG_THREADS worker threads compress the queued frames.
+ * Finished chunks are given to RecWriter in the order they were queued
+ * (audio chunks recorded meanwhile are queued too), so the 'movi' chunk
+ * and the index are the same as with the synchronous encoding.
+ */
+
+enum {
+	AVI_CHUNK_FREE ,
+	AVI_CHUNK_PENDING ,						/* png frame waiting for a worker */
+	AVI_CHUNK_ENCODING ,
+	AVI_CHUNK_DONE ,						/* complete chunk in 'data' */
+	AVI_CHUNK_FAILED
+};
+
+typedef struct {
+	int		State;
+	Uint8		*Rgb;						/* frame to encode */
+	size_t		RgbSize;
+	Uint8		*Data;						/* chunk header + data */
+	size_t		DataAlloc;
+	size_t		DataSize;
+} AVI_QUEUED_CHUNK;
+
+static struct {
+	sthread_t	*Threads[ AVI_PNG_THREADS ];
+	slock_t		*Lock;
+	scond_t		*Cond;						/* signaled on each chunk state change */
+	AVI_QUEUED_CHUNK	Chunks[ AVI_QUEUE_SIZE ];
+	int		Head;						/* oldest chunk, next one to write */
+	int		Count;
+	bool		Quit;
+	bool		Active;
+	int		Width , Height , CompressionLevel;
+} AviQueue;
+
+
+/**
+ * Make sure the buffer '*pBuf' of '*pAlloc' bytes can hold 'Size' bytes
+ */
+static bool	Avi_Queue_Reserve ( Uint8 **pBuf , size_t *pAlloc , size_t Size )
+{
+	Uint8		*p;
+
+	if ( *pAlloc >= Size )
+		return true;
+	p = realloc ( *pBuf , Size );
+	if ( !p )
+		return false;
+	*pBuf = p;
+	*pAlloc = Size;
+	return true;
+}
+
+
+/**
+ * Worker thread : compress the oldest pending frame, until the queue is stopped
+ */
+static void	Avi_Queue_ThreadFunc ( void *data )
+{
+	AVI_QUEUED_CHUNK *c;
+	int		i , SizeImage;
+
+	slock_lock ( AviQueue.Lock );
+	for (;;)
+	{
+		c = NULL;
+		for ( i = 0 ; i < AviQueue.Count ; i++ )
+			if ( AviQueue.Chunks[ ( AviQueue.Head + i ) % AVI_QUEUE_SIZE ].State == AVI_CHUNK_PENDING )
+			{
+				c = &AviQueue.Chunks[ ( AviQueue.Head + i ) % AVI_QUEUE_SIZE ];
+				break;
+			}
+		if ( !c )
+		{
+			if ( AviQueue.Quit )
+				break;
+			scond_wait ( AviQueue.Cond , AviQueue.Lock );
+			continue;
+		}
+		c->State = AVI_CHUNK_ENCODING;
+		slock_unlock ( AviQueue.Lock );
+
+		SizeImage = ScreenSnapShot_SavePNG_ToMemory ( c->Rgb , AviQueue.Width , AviQueue.Height ,
+			AviQueue.CompressionLevel , PNG_FILTER_NONE , &c->Data , &c->DataAlloc , sizeof ( AVI_CHUNK ) );
+		if ( SizeImage > 0 && ( SizeImage & 1 ) )
+		{
+			/* add an extra '\0' byte to get an even size, as Avi_RecordVideoStream_PNG() */
+			if ( Avi_Queue_Reserve ( &c->Data , &c->DataAlloc , sizeof ( AVI_CHUNK ) + SizeImage + 1 ) )
+				c->Data[ sizeof ( AVI_CHUNK ) + SizeImage++ ] = '\0';
+			else
+				SizeImage = -1;
+		}
+		if ( SizeImage > 0 )
+		{
+			Avi_Store4cc ( c->Data , "00dc" );			/* stream 0, compressed DIB bytes */
+			Avi_StoreU32 ( c->Data + 4 , SizeImage );
+			c->DataSize = sizeof ( AVI_CHUNK ) + SizeImage;
+		}
+
+		slock_lock ( AviQueue.Lock );
+		c->State = SizeImage > 0 ? AVI_CHUNK_DONE : AVI_CHUNK_FAILED;
+		scond_broadcast ( AviQueue.Cond );
+	}
+	slock_unlock ( AviQueue.Lock );
+}
+
+
+/**
+ * Write the finished chunks at the head of the queue. If 'Wait' is set,
+ * wait for the pending frames until 'MaxCount' chunks at most remain in the queue.
+ * Return false if a frame could not be encoded or written.
+ */
+static bool	Avi_Queue_WriteDone ( RECORD_AVI_PARAMS *pAviParams , bool Wait , int MaxCount )
+{
+	AVI_QUEUED_CHUNK *c;
+	bool		ok = true;
+
+	slock_lock ( AviQueue.Lock );
+	while ( AviQueue.Count > 0 )
+	{
+		c = &AviQueue.Chunks[ AviQueue.Head ];
+		if ( c->State == AVI_CHUNK_DONE || c->State == AVI_CHUNK_FAILED )
+		{
+			slock_unlock ( AviQueue.Lock );
+			if ( c->State == AVI_CHUNK_FAILED )
+				ok = false;
+			else if ( !RecWriter_Write ( pAviParams->FileOut , c->Data , c->DataSize ) )
+				ok = false;
+			slock_lock ( AviQueue.Lock );
+			c->State = AVI_CHUNK_FREE;
+			AviQueue.Head = ( AviQueue.Head + 1 ) % AVI_QUEUE_SIZE;
+			AviQueue.Count--;
+		}
+		else if ( Wait && AviQueue.Count > MaxCount )
+			scond_wait ( AviQueue.Cond , AviQueue.Lock );
+		else
+			break;
+	}
+	slock_unlock ( AviQueue.Lock );
+
+	if ( !ok )
+	{
+		perror ( "Avi_Queue_WriteDone" );
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write png frame" );
+	}
+	return ok;
+}
+
+
+/**
+ * Return the next free chunk, after writing/waiting for the oldest ones if the queue is full.
+ * The chunk is not visible to the workers until Avi_Queue_Add() is called.
+ */
+static AVI_QUEUED_CHUNK	*Avi_Queue_GetFree ( RECORD_AVI_PARAMS *pAviParams , bool *pOk )
+{
+	*pOk = Avi_Queue_WriteDone ( pAviParams , true , AVI_QUEUE_SIZE - 1 );
+	/* Head/Count are only changed by the emulation thread, no need to lock here */
+	return &AviQueue.Chunks[ ( AviQueue.Head + AviQueue.Count ) % AVI_QUEUE_SIZE ];
+}
+
+
+static void	Avi_Queue_Add ( AVI_QUEUED_CHUNK *c , int State )
+{
+	slock_lock ( AviQueue.Lock );
+	c->State = State;
+	AviQueue.Count++;
+	scond_broadcast ( AviQueue.Cond );
+	slock_unlock ( AviQueue.Lock );
+}
+
+
+/**
+ * Convert the cropped surface to 24-bit RGB and queue it for the workers
+ */
+static bool	Avi_Queue_RecordVideoStream_PNG ( RECORD_AVI_PARAMS *pAviParams )
+{
+	AVI_QUEUED_CHUNK *c;
+	SDL_Surface	*surface = pAviParams->Surface;
+	SDL_PixelFormat	*fmt = surface->format;
+	Uint8		*src_ptr , *dst_ptr;
+	int		y , w = pAviParams->Width;
+	bool		do_lock , ok;
+
+	c = Avi_Queue_GetFree ( pAviParams , &ok );
+	if ( !Avi_Queue_Reserve ( &c->Rgb , &c->RgbSize , w * pAviParams->Height * 3 ) )
+	{
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : not enough memory for png frame" );
+		return false;
+	}
+
+	src_ptr = (Uint8 *)surface->pixels + pAviParams->CropTop * surface->pitch + pAviParams->CropLeft * fmt->BytesPerPixel;
+	dst_ptr = c->Rgb;
+	do_lock = SDL_MUSTLOCK ( surface );
+	if ( do_lock )
+		SDL_LockSurface ( surface );
+	for ( y = 0 ; y < pAviParams->Height ; y++ )
+	{
+		switch ( fmt->BytesPerPixel ) {
+			case 1 :	PixelConvert_8to24Bits(dst_ptr, src_ptr, w, fmt->palette->colors);
+					break;
+			case 2 :	PixelConvert_16to24Bits(dst_ptr, (Uint16 *)src_ptr, w, fmt);
+					break;
+			case 3 :	memcpy(dst_ptr, src_ptr, w * 3);
+					break;
+			case 4 :	PixelConvert_32to24Bits(dst_ptr, (Uint32 *)src_ptr, w, fmt);
+					break;
+		}
+		src_ptr += surface->pitch;
+		dst_ptr += w * 3;
+	}
+	if ( do_lock )
+		SDL_UnlockSurface ( surface );
+
+	Avi_Queue_Add ( c , AVI_CHUNK_PENDING );
+
+	/* Write the frames already encoded */
+	return Avi_Queue_WriteDone ( pAviParams , false , 0 ) && ok;
+}
+
+
+/**
+ * Queue an audio chunk behind the frames still being encoded
+ */
+static bool	Avi_Queue_RecordAudioStream_PCM ( RECORD_AVI_PARAMS *pAviParams , Sint16 pSamples[][2] , int SampleIndex , int SampleLength )
+{
+	AVI_QUEUED_CHUNK *c;
+	Uint8		*p;
+	Sint16		sample;
+	int		i;
+	bool		ok;
+
+	c = Avi_Queue_GetFree ( pAviParams , &ok );
+	if ( !Avi_Queue_Reserve ( &c->Data , &c->DataAlloc , sizeof ( AVI_CHUNK ) + SampleLength * 4 ) )
+	{
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : not enough memory for pcm frame" );
+		return false;
+	}
+
+	p = c->Data;
+	Avi_Store4cc ( p , "01wb" );						/* stream 1, wave bytes */
+	Avi_StoreU32 ( p + 4 , SampleLength * 4 );				/* 16 bits, stereo -> 4 bytes */
+	p += sizeof ( AVI_CHUNK );
+	for ( i = 0 ; i < SampleLength ; i++ )
+	{
+		sample = pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][0];
+		Avi_StoreU16 ( p , sample );
+		sample = pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][1];
+		Avi_StoreU16 ( p + 2 , sample );
+		p += 4;
+	}
+	c->DataSize = p - c->Data;
+
+	Avi_Queue_Add ( c , AVI_CHUNK_DONE );
+	return Avi_Queue_WriteDone ( pAviParams , false , 0 ) && ok;
+}
+
+
+/**
+ * Start the workers for a png recording. If this fails, frames are
+ * encoded synchronously by Avi_RecordVideoStream_PNG().
+ */
+static void	Avi_Queue_Start ( RECORD_AVI_PARAMS *pAviParams )
+{
+	int		i;
+
+	memset ( &AviQueue , 0 , sizeof ( AviQueue ) );
+	AviQueue.Width = pAviParams->Width;
+	AviQueue.Height = pAviParams->Height;
+	AviQueue.CompressionLevel = pAviParams->VideoCodecCompressionLevel;
+	AviQueue.Lock = slock_new();
+	AviQueue.Cond = scond_new();
+	AviQueue.Active = ( AviQueue.Lock && AviQueue.Cond );
+	for ( i = 0 ; i < AVI_PNG_THREADS && AviQueue.Active ; i++ )
+	{
+		AviQueue.Threads[ i ] = sthread_create ( Avi_Queue_ThreadFunc , NULL );
+		if ( !AviQueue.Threads[ i ] )
+			AviQueue.Active = false;
+	}
+	if ( !AviQueue.Active )
+		Log_Printf ( LOG_WARN, "AVI recording : failed to create png threads, encoding frames directly.\n" );
+}
+
+
+/**
+ * Write all the queued chunks, stop the workers and free the buffers
+ */
+static bool	Avi_Queue_Stop ( RECORD_AVI_PARAMS *pAviParams )
+{
+	bool		ok = true;
+	int		i;
+
+	if ( AviQueue.Active )
+		ok = Avi_Queue_WriteDone ( pAviParams , true , 0 );
+	AviQueue.Active = false;
+
+	if ( AviQueue.Lock )
+	{
+		slock_lock ( AviQueue.Lock );
+		AviQueue.Quit = true;
+		scond_broadcast ( AviQueue.Cond );
+		slock_unlock ( AviQueue.Lock );
+	}
+	for ( i = 0 ; i < AVI_PNG_THREADS ; i++ )
+		if ( AviQueue.Threads[ i ] )
+			sthread_join ( AviQueue.Threads[ i ] );
+	if ( AviQueue.Cond )
+		scond_free ( AviQueue.Cond );
+	if ( AviQueue.Lock )
+		slock_free ( AviQueue.Lock );
+	for ( i = 0 ; i < AVI_QUEUE_SIZE ; i++ )
+	{
+		free ( AviQueue.Chunks[ i ].Rgb );
+		free ( AviQueue.Chunks[ i ].Data );
+	}
+	memset ( &AviQueue , 0 , sizeof ( AviQueue ) );
+	return ok;
+}
+#endif  /* AVI_PNG_THREADS */
 #endif  /* HAVE_LIBPNG */
 
 
@@ -489,6 +825,16 @@ bool	Avi_RecordVideoStream ( void )
 #if HAVE_LIBPNG
 	else if ( AviParams.VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
 	{
+#ifdef AVI_PNG_THREADS
+		if ( AviQueue.Active )
+		{
+			if ( Avi_Queue_RecordVideoStream_PNG ( &AviParams ) == false )
+			{
+				return false;
+			}
+		}
+		else
+#endif
 		if ( Avi_RecordVideoStream_PNG ( &AviParams ) == false )
 		{
 			return false;
@@ -518,13 +864,13 @@ bool	Avi_RecordVideoStream ( void )
 static bool	Avi_RecordAudioStream_PCM ( RECORD_AVI_PARAMS *pAviParams , Sint16 pSamples[][2] , int SampleIndex , int SampleLength )
 {
 	AVI_CHUNK	Chunk;
-	Sint16		sample[2];
-	int		i;
+	Sint16		samples[1024][2];
+	int		i , n , done;
 
 	/* Write the audio frame header */
 	Avi_Store4cc ( Chunk.ChunkName , "01wb" );				/* stream 1, wave bytes */
 	Avi_StoreU32 ( Chunk.ChunkSize , SampleLength * 4 );			/* 16 bits, stereo -> 4 bytes */
-	if ( fwrite ( &Chunk , sizeof ( Chunk ) , 1 , pAviParams->FileOut ) != 1 )
+	if ( !RecWriter_Write ( pAviParams->FileOut , &Chunk , sizeof ( Chunk ) ) )
 	{
 		perror ( "Avi_RecordAudioStream_PCM" );
 		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write pcm frame header" );
@@ -532,13 +878,19 @@ static bool	Avi_RecordAudioStream_PCM ( RECORD_AVI_PARAMS *pAviParams , Sint16 p
 	}
 
 	/* Write the audio frame data */
-	for ( i = 0 ; i < SampleLength; i++ )
+	for ( done = 0 ; done < SampleLength ; done += n )
 	{
-		/* Convert sample to little endian */
-		sample[0] = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][0]);
-		sample[1] = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][1]);
-		/* And store */
-		if ( fwrite ( &sample , sizeof ( sample ) , 1 , pAviParams->FileOut ) != 1 )
+		n = SampleLength - done;
+		if ( n > 1024 )
+			n = 1024;
+		for ( i = 0 ; i < n ; i++ )
+		{
+			/* Convert sample to little endian */
+			samples[i][0] = SDL_SwapLE16 ( pSamples[ (SampleIndex+done+i) % MIXBUFFER_SIZE ][0]);
+			samples[i][1] = SDL_SwapLE16 ( pSamples[ (SampleIndex+done+i) % MIXBUFFER_SIZE ][1]);
+		}
+		/* And queue for the writer */
+		if ( !RecWriter_Write ( pAviParams->FileOut , samples , n * sizeof ( samples[0] ) ) )
 		{
 			perror ( "Avi_RecordAudioStream_PCM" );
 			Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write pcm frame" );
@@ -555,6 +907,17 @@ bool	Avi_RecordAudioStream ( Sint16 pSamples[][2] , int SampleIndex , int Sample
 {
 	if ( AviParams.AudioCodec == AVI_RECORD_AUDIO_CODEC_PCM )
 	{
+#ifdef AVI_PNG_THREADS
+		/* keep the chunks order if some frames are still being encoded */
+		if ( AviQueue.Active && AviQueue.Count > 0 )
+		{
+			if ( Avi_Queue_RecordAudioStream_PCM ( &AviParams , pSamples , SampleIndex , SampleLength ) == false )
+			{
+				return false;
+			}
+		}
+		else
+#endif
 		if ( Avi_RecordAudioStream_PCM ( &AviParams , pSamples , SampleIndex , SampleLength ) == false )
 		{
 			return false;
@@ -865,6 +1228,11 @@ static bool	Avi_StartRecording_WithParams ( RECORD_AVI_PARAMS *pAviParams , char
 	}
 
 
+#ifdef AVI_PNG_THREADS
+	if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
+		Avi_Queue_Start ( pAviParams );
+#endif
+
 	/* We're ok to record */
 	Log_AlertDlg ( LOG_INFO, "AVI recording has been started");
 	bRecordingAvi = true;
@@ -883,6 +1251,20 @@ static bool	Avi_StopRecording_WithParams ( RECORD_AVI_PARAMS *pAviParams )
 	if ( bRecordingAvi == false )						/* no recording ? */
 		return true;
 
+#ifdef AVI_PNG_THREADS
+	/* Write the frames still being encoded */
+	if ( !Avi_Queue_Stop ( pAviParams ) )
+		return false;
+#endif
+
+	/* Wait until all the queued frames are written */
+	if ( !RecWriter_Flush ( pAviParams->FileOut ) )
+	{
+		perror ( "AviStopRecording" );
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write frames" );
+		return false;
+	}
+
 	/* Update the size of the 'movi' chunk */
 	fseek ( pAviParams->FileOut , 0 , SEEK_END );				/* go to the end of the 'movi' chunk */
 	pAviParams->MoviChunkPosEnd = ftell ( pAviParams->FileOut );
@@ -18,17 +18,70 @@ const char Bios__fileid[] = "Hatari bios.c : " __DATE__ " " __TIME__;
 #include "printer.h"
 #include "rs232.h"
 #include "stMemory.h"
+#include "tos.h"
 #include "bios.h"
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Serve Rwabs() for a floppy directly from the disk image with --floppy-hle.
+ * Only done when TOS's own hdv_rw handler is installed (no disk cache or
+ * other driver hooked in), and not for the first call after a disk change
+ * so that TOS can report the media change to GEMDOS.
+ * Return true if done.
+ */
+static bool Bios_RWabsHLE(Uint16 RWFlag, Uint32 pBuffer, Uint16 Number, Uint16 RecNo, Uint16 Dev)
+{
+	static Uint32 nImageIds[MAX_FLOPPYDRIVES];
+	Uint32 hdv_rw;
+	int nSectorsPerTrack, nSides, nTrackSectors, Sector, Count;
+
+	if (!ConfigureParams.DiskImage.bFloppyHLE || Dev >= MAX_FLOPPYDRIVES
+	    || Number == 0 || RecNo == 0xffff)	/* long record number */
+		return false;
+
+	hdv_rw = STMemory_ReadLong(0x476);
+	if (hdv_rw < TosAddress || hdv_rw >= TosAddress + TosSize)
+		return false;
+
+	if (EmulationDrives[Dev].nImageId != nImageIds[Dev])
+	{
+		nImageIds[Dev] = EmulationDrives[Dev].nImageId;
+		return false;
+	}
+
+	nSectorsPerTrack = EmulationDrives[Dev].nSectorsPerTrack;
+	nSides = EmulationDrives[Dev].nSides;
+	if (nSectorsPerTrack <= 0 || nSides <= 0)
+		return false;
+	nTrackSectors = nSectorsPerTrack * nSides;
+
+	/* Logical sectors are numbered side by side, track by track */
+	while (Number > 0)
+	{
+		Sector = RecNo % nSectorsPerTrack;
+		Count = nSectorsPerTrack - Sector;
+		if (Count > Number)
+			Count = Number;
+		if (!Floppy_AccessSectorsHLE(Dev, RWFlag & 1, pBuffer, Sector + 1,
+		                             RecNo / nTrackSectors, (RecNo / nSectorsPerTrack) % nSides, Count))
+			return false;
+		pBuffer += Count * NUMBYTESPERSECTOR;
+		RecNo += Count;
+		Number -= Count;
+	}
+
+	Regs[REG_D0] = 0;
+	return true;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * BIOS Read/Write disk sector
  * Call 4
  */
-static void Bios_RWabs(Uint32 Params)
+static bool Bios_RWabs(Uint32 Params)
 {
-#if ENABLE_TRACING
 	Uint32 pBuffer;
 	Uint16 RWFlag, Number, RecNo, Dev;
 
@@ -42,7 +95,8 @@ static void Bios_RWabs(Uint32 Params)
 	LOG_TRACE(TRACE_OS_BIOS, "BIOS 0x04 Rwabs(%d,0x%lX,%d,%d,%i) at PC 0x%X\n",
 	          RWFlag, STRAM_ADDR(pBuffer), Number, RecNo, Dev,
 		  M68000_GetPC());
-#endif
+
+	return Bios_RWabsHLE(RWFlag, pBuffer, Number, RecNo, Dev);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -155,8 +209,7 @@ bool Bios(void)
 		break;
 
 	case 0x4:
-		Bios_RWabs(Params);
-		break;
+		return Bios_RWabs(Params);
 
 	case 0x5:
 		Bios_Setexe(Params);
@@ -40,6 +40,7 @@ const char Blitter_fileid[] = "Hatari blitter.c : " __DATE__ " " __TIME__;
 #include "memorySnapShot.h"
 #include "stMemory.h"
 #include "screen.h"
+#include "timeline.h"
 #include "video.h"
 
 /* Cycles to run for in non-hog mode */
@@ -138,6 +139,7 @@ static void Blitter_AddCycles(int cycles)
 	int all_cycles = cycles + nWaitStateCycles;
 
 	BlitterVars.op_cycles += all_cycles;
+	Timeline_AddBlitter(all_cycles);
 
 	nCyclesMainCounter += all_cycles >> nCpuFreqShift;
 	nWaitStateCycles = 0;
@@ -503,6 +505,130 @@ static void Blitter_Step(void)
 	}
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Blitter emulation - fast path
+ *
+ * Process a run of middle words of the current line in one go.  This does
+ * the same as calling Blitter_MiddleWord() for each word, but without the
+ * per-word state setup and HOP/LOP function calls, and the bus cycles are
+ * accounted for the whole run at once.  The run is limited so that no
+ * cycle interrupt becomes due and the non-HOG bus slice doesn't end before
+ * its last word, so the cycles are flushed wherever it would matter.
+ * Only used for blits within ST RAM, where accesses have no wait states.
+ * Returns false if the current word can't be handled here.
+ */
+static bool Blitter_MiddleWords(void)
+{
+	static const Uint16 lop_uses_dst = 0x6ff6;	/* all but LOP 0, 3, C, F */
+	static const Uint16 lop_uses_hop = 0x7bde;	/* all but LOP 0, 5, A, F */
+	Uint8 hop = BlitterRegs.hop, lop = BlitterRegs.lop;
+	Uint16 mask = BlitterRegs.end_mask_2;
+	Uint16 src = 0, ht, res, dst;
+	Uint32 src_addr, dst_addr, lo, hi;
+	bool need_src, need_dst;
+	int n, i, cycles;
+
+	/* middle word, with at least one more following it? */
+	if (BlitterRegs.words <= 2 || BlitterRegs.words == BlitterVars.dst_words_reset
+	    || nWaitStateCycles)
+		return false;
+
+	need_src = (lop_uses_hop >> lop) & 1
+		&& ((hop & 2) || (hop == 1 && BlitterVars.smudge));
+	need_dst = ((lop_uses_dst >> lop) & 1) || mask != 0xFFFF;
+	cycles = 4 + (need_src ? 4 : 0) + (need_dst ? 4 : 0);
+
+	n = BlitterRegs.words - 1;
+	if (need_src && n > (int)BlitterVars.src_words - 1)
+		n = BlitterVars.src_words - 1;	/* line's last source fetch uses y incr */
+	if (!BlitterVars.hog && n > (NONHOG_CYCLES - BlitterVars.pass_cycles + cycles - 1) / cycles)
+		n = (NONHOG_CYCLES - BlitterVars.pass_cycles + cycles - 1) / cycles;
+	if (PendingInterruptFunction
+	    && n > 1 + (PendingInterruptCount - 1) / INT_CONVERT_TO_INTERNAL(cycles, INT_CPU_CYCLE))
+		n = 1 + (PendingInterruptCount - 1) / INT_CONVERT_TO_INTERNAL(cycles, INT_CPU_CYCLE);
+	if (n < 2)
+		return false;
+
+	/* whole run within ST RAM? */
+	src_addr = BlitterRegs.src_addr;
+	dst_addr = BlitterRegs.dst_addr;
+	lo = dst_addr;
+	hi = dst_addr + (n-1) * BlitterRegs.dst_x_incr;
+	if (lo > hi)
+	{
+		lo = hi;
+		hi = dst_addr;
+	}
+	if (lo < 0x800 || hi + 2 > STRamEnd)
+		return false;
+	if (need_src)
+	{
+		lo = src_addr;
+		hi = src_addr + (n-1) * BlitterRegs.src_x_incr;
+		if (lo > hi)
+		{
+			lo = hi;
+			hi = src_addr;
+		}
+		if (lo < 0x800 || hi + 2 > STRamEnd)
+			return false;
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		if (need_src)
+		{
+			Blitter_SourceShift();
+			if (BlitterRegs.src_x_incr < 0)
+				BlitterVars.buffer |= (Uint32)get_word(src_addr) << 16;
+			else
+				BlitterVars.buffer |= get_word(src_addr);
+			src_addr += BlitterRegs.src_x_incr;
+			src = (Uint16)(BlitterVars.buffer >> BlitterVars.skew);
+		}
+
+		switch (hop)
+		{
+		 case 0:  ht = 0xFFFF; break;
+		 case 1:  ht = BlitterHalftone[BlitterVars.smudge ? src & 15 : BlitterVars.line]; break;
+		 case 2:  ht = src; break;
+		 default: ht = src & BlitterHalftone[BlitterVars.smudge ? src & 15 : BlitterVars.line]; break;
+		}
+		dst = need_dst ? get_word(dst_addr) : 0;
+
+		switch (lop)
+		{
+		 case 0x0: res = 0; break;
+		 case 0x1: res = ht & dst; break;
+		 case 0x2: res = ht & ~dst; break;
+		 case 0x3: res = ht; break;
+		 case 0x4: res = ~ht & dst; break;
+		 case 0x5: res = dst; break;
+		 case 0x6: res = ht ^ dst; break;
+		 case 0x7: res = ht | dst; break;
+		 case 0x8: res = ~ht & ~dst; break;
+		 case 0x9: res = ~ht ^ dst; break;
+		 case 0xA: res = ~dst; break;
+		 case 0xB: res = ht | ~dst; break;
+		 case 0xC: res = ~ht; break;
+		 case 0xD: res = ~ht | dst; break;
+		 case 0xE: res = ~ht | ~dst; break;
+		 default:  res = 0xFFFF; break;
+		}
+		put_word(dst_addr, (res & mask) | (dst & ~mask));
+		dst_addr += BlitterRegs.dst_x_incr;
+	}
+
+	BlitterRegs.src_addr = src_addr;
+	BlitterRegs.dst_addr = dst_addr;
+	BlitterRegs.words -= n;
+	if (need_src)
+		BlitterVars.src_words -= n;
+	Blitter_AddCycles(n * cycles);
+	return true;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Let's do the blit.
@@ -529,7 +655,8 @@ static void Blitter_Start(void)
 	/* Now we enter the main blitting loop */
 	do
 	{
-		Blitter_Step();
+		if (!Blitter_MiddleWords())
+			Blitter_Step();
 		Blitter_FlushCycles();
 	}
 	while (BlitterRegs.lines > 0
@@ -915,23 +1042,24 @@ void Blitter_Control_WriteByte(void)
 	BlitterVars.smudge = BlitterRegs.ctrl & 0x20;
 	BlitterVars.line = BlitterRegs.ctrl & 0xF;
 
-	/* Remove old pending update interrupt */
-	CycInt_RemovePendingInterrupt(INTERRUPT_BLITTER);
-
 	/* Busy bit set? */
-	if (BlitterRegs.ctrl & 0x80)
+	if ((BlitterRegs.ctrl & 0x80) && BlitterRegs.lines > 0)
 	{
-		if (BlitterRegs.lines == 0)
-		{
-			/* We're done, clear busy bit */
-			BlitterRegs.ctrl &= ~0x80;
-		}
-		else
-		{
-			/* Start blitting after some CPU cycles */
-			CycInt_AddRelativeInterrupt((CurrentInstrCycles+nWaitStateCycles)>>nCpuFreqShift,
-							 INT_CPU_CYCLE, INTERRUPT_BLITTER);
-		}
+		/* Start blitting after some CPU cycles. In non-HOG mode, programs
+		 * usually restart the blitter in a loop while it is waiting for
+		 * its next slice : this moves the pending update interrupt in
+		 * place instead of removing and adding it again each time */
+		CycInt_AddRelativeInterrupt((CurrentInstrCycles+nWaitStateCycles)>>nCpuFreqShift,
+						 INT_CPU_CYCLE, INTERRUPT_BLITTER);
+	}
+	else
+	{
+		/* Remove old pending update interrupt */
+		if (CycInt_InterruptActive(INTERRUPT_BLITTER))
+			CycInt_RemovePendingInterrupt(INTERRUPT_BLITTER);
+
+		/* We're done, clear busy bit */
+		BlitterRegs.ctrl &= ~0x80;
 	}
 }
 
@@ -0,0 +1,516 @@
+/*
+  Hatari - blockCache.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Sector cache for the ACSI/SCSI (hdc.c) and IDE (ide.c) hard disk images,
+  so that the emulated commands don't wait for the host storage each time.
+
+  Images are split in chunks of BLOCKCACHE_CHUNK_SECTORS sectors, which
+  are read whole on their first access and kept in a LRU list (the number
+  of chunks comes from the --hd-cache size). Writes only update the cache:
+  the modified sectors are written back when their chunk is evicted, when
+  the image is closed, and by a writer thread once the disk was idle for
+  a second, followed by fsync(). When the emulated system reads
+  sequentially, the thread also reads the next chunk in advance.
+
+  All the I/O on the image file is done with the cache lock held, so the
+  emulation waits at most for the chunk being read or written by the
+  thread, which it would have had to read itself anyway.
+
+  Without thread support, writes go straight to the image (write-through)
+  and there's no read-ahead.
+*/
+const char BlockCache_fileid[] = "Hatari blockCache.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "blockCache.h"
+#include "log.h"
+
+#if HAVE_FSYNC
+#include <unistd.h>
+#endif
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+#define BLOCKCACHE_THREAD 1
+#endif
+
+#define BLOCKCACHE_SECTOR_SIZE		512
+#define BLOCKCACHE_CHUNK_SECTORS	128	/* 64 KiB chunks */
+#define BLOCKCACHE_CHUNK_BYTES		(BLOCKCACHE_CHUNK_SECTORS * BLOCKCACHE_SECTOR_SIZE)
+#define BLOCKCACHE_NONE			0xffffffff
+#define BLOCKCACHE_IDLE_US		1000000	/* Write back after 1s without disk access */
+
+typedef struct
+{
+	Uint32 nChunk;				/* chunk number, BLOCKCACHE_NONE if slot is unused */
+	Uint32 nLastUsed;
+	int nSectors;				/* last chunk of the image can be shorter */
+	int nHashNext;				/* next slot with the same hash, -1 if none */
+	bool bDirty;
+	Uint8 Dirty[BLOCKCACHE_CHUNK_SECTORS / 8];	/* modified sectors */
+	Uint8 *pData;
+} BLOCKCACHE_CHUNK;
+
+struct BLOCKCACHE
+{
+	FILE *fp;
+	Uint32 nSectors;			/* image size */
+	bool bReadOnly;
+	int nSlots;
+	BLOCKCACHE_CHUNK *pSlots;
+	int *pHashHead;				/* first slot for each hash, -1 if none */
+	int nHashMask;
+	Uint32 nUseCounter;
+	Uint32 nNextSector;			/* sector after the last read, to detect sequential reads */
+	bool bWriteBack;			/* false: writes go to the file immediately */
+#if BLOCKCACHE_THREAD
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;				/* signaled on each access and request */
+	Uint32 nReadAhead;			/* chunk to read in advance, BLOCKCACHE_NONE if none */
+	bool bDirty;				/* some chunks must be written back */
+	bool bQuit;
+#endif
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Lock/unlock the cache, when the thread is used
+ */
+static void BlockCache_Lock(BLOCKCACHE *pCache)
+{
+#if BLOCKCACHE_THREAD
+	if (pCache->lock)
+		slock_lock(pCache->lock);
+#endif
+}
+
+static void BlockCache_Unlock(BLOCKCACHE *pCache)
+{
+#if BLOCKCACHE_THREAD
+	if (pCache->lock)
+		slock_unlock(pCache->lock);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the modified sectors of a chunk to the image file.
+ * Return false on error (chunk is then still marked as modified).
+ */
+static bool BlockCache_WriteChunk(BLOCKCACHE *pCache, BLOCKCACHE_CHUNK *pChunk)
+{
+	off_t nOffset;
+	int i, nRun;
+
+	if (!pChunk->bDirty)
+		return true;
+
+	for (i = 0; i < pChunk->nSectors; i += nRun)
+	{
+		/* write each run of modified sectors at once */
+		nRun = 0;
+		while (i + nRun < pChunk->nSectors
+		       && (pChunk->Dirty[(i + nRun) / 8] & (1 << ((i + nRun) & 7))))
+			nRun++;
+		if (nRun == 0)
+		{
+			nRun = 1;
+			continue;
+		}
+		nOffset = ((off_t)pChunk->nChunk * BLOCKCACHE_CHUNK_SECTORS + i) * BLOCKCACHE_SECTOR_SIZE;
+		if (fseeko(pCache->fp, nOffset, SEEK_SET) != 0
+		    || fwrite(pChunk->pData + i * BLOCKCACHE_SECTOR_SIZE, BLOCKCACHE_SECTOR_SIZE,
+		              nRun, pCache->fp) != (size_t)nRun)
+		{
+			Log_Printf(LOG_WARN, "Failed to write back hard disk sectors %u-%u.\n",
+			           pChunk->nChunk * BLOCKCACHE_CHUNK_SECTORS + i,
+			           pChunk->nChunk * BLOCKCACHE_CHUNK_SECTORS + i + nRun - 1);
+			return false;
+		}
+	}
+	memset(pChunk->Dirty, 0, sizeof(pChunk->Dirty));
+	pChunk->bDirty = false;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write all the modified chunks to the image file (called with the lock held)
+ */
+static void BlockCache_WriteAll(BLOCKCACHE *pCache)
+{
+	int i;
+
+	for (i = 0; i < pCache->nSlots; i++)
+	{
+		if (pCache->pSlots[i].nChunk != BLOCKCACHE_NONE)
+			BlockCache_WriteChunk(pCache, &pCache->pSlots[i]);
+	}
+	fflush(pCache->fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Remove a slot from the hash chains
+ */
+static void BlockCache_Unhash(BLOCKCACHE *pCache, int nSlot)
+{
+	int *pLink = &pCache->pHashHead[pCache->pSlots[nSlot].nChunk & pCache->nHashMask];
+
+	while (*pLink != nSlot)
+		pLink = &pCache->pSlots[*pLink].nHashNext;
+	*pLink = pCache->pSlots[nSlot].nHashNext;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the slot of chunk 'nChunk', or NULL if it's not in the cache
+ */
+static BLOCKCACHE_CHUNK *BlockCache_Find(BLOCKCACHE *pCache, Uint32 nChunk)
+{
+	int nSlot = pCache->pHashHead[nChunk & pCache->nHashMask];
+
+	while (nSlot >= 0 && pCache->pSlots[nSlot].nChunk != nChunk)
+		nSlot = pCache->pSlots[nSlot].nHashNext;
+	return nSlot >= 0 ? &pCache->pSlots[nSlot] : NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the slot of chunk 'nChunk', putting it in the cache (in place of
+ * the least recently used one) if needed. Its data is read from the file
+ * unless 'bLoad' is false (i.e. when it will be fully overwritten).
+ * Return NULL on read error. Called with the lock held.
+ */
+static BLOCKCACHE_CHUNK *BlockCache_GetChunk(BLOCKCACHE *pCache, Uint32 nChunk, bool bLoad)
+{
+	BLOCKCACHE_CHUNK *pChunk;
+	Uint32 nFirst;
+	int i, nSlot = 0;
+
+	pChunk = BlockCache_Find(pCache, nChunk);
+	if (pChunk)
+	{
+		pChunk->nLastUsed = ++pCache->nUseCounter;
+		return pChunk;
+	}
+
+	for (i = 1; i < pCache->nSlots; i++)
+	{
+		if (pCache->pSlots[i].nLastUsed < pCache->pSlots[nSlot].nLastUsed)
+			nSlot = i;
+	}
+	pChunk = &pCache->pSlots[nSlot];
+	if (pChunk->nChunk != BLOCKCACHE_NONE)
+	{
+		if (!BlockCache_WriteChunk(pCache, pChunk))
+			Log_Printf(LOG_WARN, "Discarding hard disk sectors that could not be written.\n");
+		BlockCache_Unhash(pCache, nSlot);
+		pChunk->nChunk = BLOCKCACHE_NONE;
+		memset(pChunk->Dirty, 0, sizeof(pChunk->Dirty));
+		pChunk->bDirty = false;
+	}
+
+	nFirst = nChunk * BLOCKCACHE_CHUNK_SECTORS;
+	pChunk->nSectors = BLOCKCACHE_CHUNK_SECTORS;
+	if (pCache->nSectors - nFirst < BLOCKCACHE_CHUNK_SECTORS)
+		pChunk->nSectors = pCache->nSectors - nFirst;
+
+	if (bLoad && (fseeko(pCache->fp, (off_t)nFirst * BLOCKCACHE_SECTOR_SIZE, SEEK_SET) != 0
+	              || fread(pChunk->pData, BLOCKCACHE_SECTOR_SIZE, pChunk->nSectors, pCache->fp)
+	                 != (size_t)pChunk->nSectors))
+	{
+		pChunk->nLastUsed = 0;			/* reuse it first */
+		return NULL;
+	}
+
+	pChunk->nChunk = nChunk;
+	pChunk->nLastUsed = ++pCache->nUseCounter;
+	pChunk->nHashNext = pCache->pHashHead[nChunk & pCache->nHashMask];
+	pCache->pHashHead[nChunk & pCache->nHashMask] = nSlot;
+	return pChunk;
+}
+
+
+#if BLOCKCACHE_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Thread doing the read-ahead, and the write back once the disk is idle
+ */
+static void BlockCache_ThreadFunc(void *data)
+{
+	BLOCKCACHE *pCache = data;
+	Uint32 nChunk;
+
+	slock_lock(pCache->lock);
+	while (!pCache->bQuit)
+	{
+		if (pCache->nReadAhead != BLOCKCACHE_NONE)
+		{
+			nChunk = pCache->nReadAhead;
+			pCache->nReadAhead = BLOCKCACHE_NONE;
+			BlockCache_GetChunk(pCache, nChunk, true);
+			continue;
+		}
+		if (!pCache->bDirty)
+		{
+			scond_wait(pCache->cond, pCache->lock);
+			continue;
+		}
+		/* Disk still in use? Check again later */
+		if (scond_wait_timeout(pCache->cond, pCache->lock, BLOCKCACHE_IDLE_US))
+			continue;
+
+		BlockCache_WriteAll(pCache);
+		pCache->bDirty = false;
+#if HAVE_FSYNC
+		slock_unlock(pCache->lock);
+		fsync(fileno(pCache->fp));
+		slock_lock(pCache->lock);
+#endif
+	}
+	slock_unlock(pCache->lock);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Create a cache for the image 'fp' of 'nSectors' sectors, with the size
+ * set in the configuration. Return NULL if the cache is disabled or can't
+ * be created (the caller then does its I/O directly).
+ */
+BLOCKCACHE *BlockCache_Open(FILE *fp, Uint32 nSectors, bool bReadOnly)
+{
+	BLOCKCACHE *pCache;
+	Uint8 *pData;
+	int i, nSlots, nHashSize;
+
+	nSlots = ConfigureParams.HardDisk.nHdCacheSize * (1024 * 1024 / BLOCKCACHE_CHUNK_BYTES);
+	if (!fp || nSectors == 0 || nSlots <= 0)
+		return NULL;
+	if ((Uint32)nSlots > nSectors / BLOCKCACHE_CHUNK_SECTORS + 1)
+		nSlots = nSectors / BLOCKCACHE_CHUNK_SECTORS + 1;
+	for (nHashSize = 16; nHashSize < nSlots; nHashSize *= 2)
+		;
+
+	pCache = calloc(1, sizeof(BLOCKCACHE));
+	if (!pCache)
+		return NULL;
+	pCache->pSlots = calloc(nSlots, sizeof(BLOCKCACHE_CHUNK));
+	pCache->pHashHead = malloc(nHashSize * sizeof(int));
+	pData = malloc((size_t)nSlots * BLOCKCACHE_CHUNK_BYTES);
+	if (!pCache->pSlots || !pCache->pHashHead || !pData)
+	{
+		Log_Printf(LOG_WARN, "Not enough memory for the hard disk cache.\n");
+		free(pData);
+		free(pCache->pHashHead);
+		free(pCache->pSlots);
+		free(pCache);
+		return NULL;
+	}
+
+	pCache->fp = fp;
+	pCache->nSectors = nSectors;
+	pCache->bReadOnly = bReadOnly;
+	pCache->nSlots = nSlots;
+	pCache->nHashMask = nHashSize - 1;
+	pCache->nNextSector = BLOCKCACHE_NONE;
+	for (i = 0; i < nHashSize; i++)
+		pCache->pHashHead[i] = -1;
+	for (i = 0; i < nSlots; i++)
+	{
+		pCache->pSlots[i].nChunk = BLOCKCACHE_NONE;
+		pCache->pSlots[i].nHashNext = -1;
+		pCache->pSlots[i].pData = pData + (size_t)i * BLOCKCACHE_CHUNK_BYTES;
+	}
+
+#if BLOCKCACHE_THREAD
+	pCache->nReadAhead = BLOCKCACHE_NONE;
+	pCache->lock = slock_new();
+	pCache->cond = scond_new();
+	if (pCache->lock && pCache->cond)
+		pCache->thread = sthread_create(BlockCache_ThreadFunc, pCache);
+	if (pCache->thread)
+		pCache->bWriteBack = true;
+	else
+	{
+		Log_Printf(LOG_WARN, "Failed to create hard disk cache thread, using write-through.\n");
+		if (pCache->cond)
+			scond_free(pCache->cond);
+		if (pCache->lock)
+			slock_free(pCache->lock);
+		pCache->cond = NULL;
+		pCache->lock = NULL;
+	}
+#endif
+
+	return pCache;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write back the modified sectors and free the cache
+ * (the image file itself is closed by the caller)
+ */
+void BlockCache_Close(BLOCKCACHE *pCache)
+{
+	if (!pCache)
+		return;
+
+#if BLOCKCACHE_THREAD
+	if (pCache->thread)
+	{
+		slock_lock(pCache->lock);
+		pCache->bQuit = true;
+		scond_signal(pCache->cond);
+		slock_unlock(pCache->lock);
+		sthread_join(pCache->thread);
+		scond_free(pCache->cond);
+		slock_free(pCache->lock);
+		pCache->lock = NULL;
+	}
+#endif
+	BlockCache_Flush(pCache);
+
+	free(pCache->pSlots[0].pData);
+	free(pCache->pHashHead);
+	free(pCache->pSlots);
+	free(pCache);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write back the modified sectors now, and sync the image file
+ */
+void BlockCache_Flush(BLOCKCACHE *pCache)
+{
+	BlockCache_Lock(pCache);
+	BlockCache_WriteAll(pCache);
+#if BLOCKCACHE_THREAD
+	pCache->bDirty = false;
+#endif
+	BlockCache_Unlock(pCache);
+#if HAVE_FSYNC
+	if (!pCache->bReadOnly)
+		fsync(fileno(pCache->fp));
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read 'nCount' sectors from 'nSector' into 'pDst'.
+ * Return the number of sectors read.
+ */
+int BlockCache_Read(BLOCKCACHE *pCache, Uint8 *pDst, Uint32 nSector, int nCount)
+{
+	BLOCKCACHE_CHUNK *pChunk;
+	Uint32 nCur;
+	int n = 0, nOffset, nPart;
+
+	BlockCache_Lock(pCache);
+
+	while (n < nCount && nSector + n < pCache->nSectors)
+	{
+		nCur = nSector + n;
+		pChunk = BlockCache_GetChunk(pCache, nCur / BLOCKCACHE_CHUNK_SECTORS, true);
+		if (!pChunk)
+			break;
+		nOffset = nCur % BLOCKCACHE_CHUNK_SECTORS;
+		nPart = pChunk->nSectors - nOffset;
+		if (nPart > nCount - n)
+			nPart = nCount - n;
+		memcpy(pDst + n * BLOCKCACHE_SECTOR_SIZE,
+		       pChunk->pData + nOffset * BLOCKCACHE_SECTOR_SIZE,
+		       nPart * BLOCKCACHE_SECTOR_SIZE);
+		n += nPart;
+	}
+
+#if BLOCKCACHE_THREAD
+	/* Sequential reads: ask the thread to read the next chunk */
+	if (pCache->thread && n > 0 && nSector == pCache->nNextSector)
+	{
+		Uint32 nNext = (nSector + n - 1) / BLOCKCACHE_CHUNK_SECTORS + 1;
+
+		if (nNext * BLOCKCACHE_CHUNK_SECTORS < pCache->nSectors && !BlockCache_Find(pCache, nNext))
+			pCache->nReadAhead = nNext;
+	}
+	if (pCache->thread)
+		scond_signal(pCache->cond);
+#endif
+	pCache->nNextSector = nSector + n;
+
+	BlockCache_Unlock(pCache);
+	return n;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write 'nCount' sectors from 'pSrc' at 'nSector'.
+ * Return the number of sectors written.
+ */
+int BlockCache_Write(BLOCKCACHE *pCache, const Uint8 *pSrc, Uint32 nSector, int nCount)
+{
+	BLOCKCACHE_CHUNK *pChunk;
+	Uint32 nCur;
+	int n = 0, i, nOffset, nPart;
+
+	if (pCache->bReadOnly)
+		return 0;
+
+	BlockCache_Lock(pCache);
+
+	while (n < nCount && nSector + n < pCache->nSectors)
+	{
+		nCur = nSector + n;
+		nOffset = nCur % BLOCKCACHE_CHUNK_SECTORS;
+		nPart = BLOCKCACHE_CHUNK_SECTORS - nOffset;
+		if (nPart > nCount - n)
+			nPart = nCount - n;
+		/* No need to read the chunk if it's fully overwritten */
+		pChunk = BlockCache_GetChunk(pCache, nCur / BLOCKCACHE_CHUNK_SECTORS,
+		                             nOffset != 0 || nPart != BLOCKCACHE_CHUNK_SECTORS);
+		if (!pChunk)
+			break;
+		if (nPart > pChunk->nSectors - nOffset)
+			nPart = pChunk->nSectors - nOffset;
+
+		memcpy(pChunk->pData + nOffset * BLOCKCACHE_SECTOR_SIZE,
+		       pSrc + n * BLOCKCACHE_SECTOR_SIZE, nPart * BLOCKCACHE_SECTOR_SIZE);
+		for (i = nOffset; i < nOffset + nPart; i++)
+			pChunk->Dirty[i / 8] |= 1 << (i & 7);
+		pChunk->bDirty = true;
+
+		if (!pCache->bWriteBack && !BlockCache_WriteChunk(pCache, pChunk))
+			break;
+		n += nPart;
+	}
+
+	if (pCache->bWriteBack)
+	{
+#if BLOCKCACHE_THREAD
+		pCache->bDirty = true;
+		scond_signal(pCache->cond);
+#endif
+	}
+	else
+		fflush(pCache->fp);
+
+	BlockCache_Unlock(pCache);
+	return n;
+}
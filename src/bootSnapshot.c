@@ -0,0 +1,417 @@
+/*
+  Hatari - bootSnapshot.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Boot snapshots: instead of booting TOS again on each session start,
+  restore the emulation state saved right before TOS read the boot disk
+  on an earlier start with the same configuration, and insert the disks
+  given for this session.
+
+  While a cold boot runs, the state is captured to memory every
+  BOOTSNAPSHOT_INTERVAL VBLs. On the first boot disk access (the same
+  point where turbo boot ends), the last captured state, which is from
+  before the access, is written to the Hatari home directory. Its name
+  includes a hash of the configuration settings that need a reset when
+  changed (see Change_DoNeedReset()) and of the TOS image file, so each
+  configuration gets its own boot snapshot.
+
+  Capture and restore are both done at the VBL boundary, where the
+  libretro frontend also saves and loads its states.
+*/
+const char BootSnapshot_fileid[] = "Hatari bootSnapshot.c : " __DATE__ " " __TIME__;
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "main.h"
+#include "version.h"
+#include "bootSnapshot.h"
+#include "configuration.h"
+#include "file.h"
+#include "floppy.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "paths.h"
+
+#if HAVE_LIBZ
+/* Remove possible conflicting mkdir declaration from cpu/sysdeps.h */
+#undef mkdir
+#include <zlib.h>
+typedef gzFile BSS_File;
+#define BootSnapshot_fopen(name, mode)	gzopen(name, mode)
+#define BootSnapshot_fclose(fp)		gzclose(fp)
+#define BootSnapshot_fread(fp, buf, len)	gzread(fp, buf, len)
+#define BootSnapshot_fwrite(fp, buf, len)	gzwrite(fp, buf, len)
+#define BOOTSNAPSHOT_WRITEMODE		"wb1"	/* speed over size */
+#else
+typedef FILE* BSS_File;
+#define BootSnapshot_fopen(name, mode)	fopen(name, mode)
+#define BootSnapshot_fclose(fp)		fclose(fp)
+#define BootSnapshot_fread(fp, buf, len)	fread(buf, 1, len, fp)
+#define BootSnapshot_fwrite(fp, buf, len)	fwrite(buf, 1, len, fp)
+#define BOOTSNAPSHOT_WRITEMODE		"wb"
+#endif
+
+#define BOOTSNAPSHOT_MAGIC	"HATARIBS"
+#define BOOTSNAPSHOT_MAX_VBLS	(50*20)	/* give up recording after this */
+
+typedef struct
+{
+	char sMagic[8];
+	Uint64 nHash;
+	Uint32 nSize;
+} BOOTSNAPSHOT_HEADER;
+
+typedef enum
+{
+	BOOTSNAPSHOT_IDLE,
+	BOOTSNAPSHOT_RESTORE,	/* restore the snapshot on next VBL */
+	BOOTSNAPSHOT_RECORD	/* capture states until boot disk access */
+} BOOTSNAPSHOT_STATE;
+
+static BOOTSNAPSHOT_STATE nState;
+static bool bRestoring;			/* restore resets the emulation itself */
+static Uint64 nConfigHash;
+static Uint32 nRecordedVBLs;
+static Uint8 *pStateBuffer;
+static size_t nStateBufferSize;
+static size_t nStateSize;		/* zero until a state is captured */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add given data to the FNV-1a hash.
+ */
+static Uint64 BootSnapshot_Hash(Uint64 hash, const void *pData, size_t nSize)
+{
+	const Uint8 *p = pData;
+
+	while (nSize--)
+	{
+		hash ^= *p++;
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+#define BootSnapshot_HashValue(hash, value)	BootSnapshot_Hash(hash, &(value), sizeof(value))
+#define BootSnapshot_HashString(hash, str)	BootSnapshot_Hash(hash, str, strlen(str))
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return hash of the Hatari version, the TOS image file and the
+ * configuration settings which affect the emulated boot. These are
+ * the ones for which Change_DoNeedReset() asks for a reset, and the
+ * ones used by the TOS patches.
+ */
+static Uint64 BootSnapshot_ConfigHash(void)
+{
+	CNF_PARAMS *cnf = &ConfigureParams;
+	Uint64 hash = 0xcbf29ce484222325ULL;
+	struct stat st;
+	Sint64 nTosSize = 0, nTosTime = 0;
+	int i;
+
+	hash = BootSnapshot_HashString(hash, PROG_NAME);
+
+	hash = BootSnapshot_HashString(hash, cnf->Rom.szTosImageFileName);
+	if (stat(cnf->Rom.szTosImageFileName, &st) == 0)
+	{
+		nTosSize = st.st_size;
+		nTosTime = st.st_mtime;
+	}
+	hash = BootSnapshot_HashValue(hash, nTosSize);
+	hash = BootSnapshot_HashValue(hash, nTosTime);
+	hash = BootSnapshot_HashString(hash, cnf->Rom.szCartridgeImageFileName);
+
+	hash = BootSnapshot_HashValue(hash, cnf->Screen.nMonitorType);
+	hash = BootSnapshot_HashValue(hash, cnf->Screen.bUseExtVdiResolutions);
+	if (cnf->Screen.bUseExtVdiResolutions)
+	{
+		hash = BootSnapshot_HashValue(hash, cnf->Screen.nVdiWidth);
+		hash = BootSnapshot_HashValue(hash, cnf->Screen.nVdiHeight);
+		hash = BootSnapshot_HashValue(hash, cnf->Screen.nVdiColors);
+	}
+
+	for (i = 0; i < MAX_ACSI_DEVS; i++)
+	{
+		hash = BootSnapshot_HashValue(hash, cnf->Acsi[i].bUseDevice);
+		if (cnf->Acsi[i].bUseDevice)
+			hash = BootSnapshot_HashString(hash, cnf->Acsi[i].sDeviceFile);
+	}
+	hash = BootSnapshot_HashValue(hash, cnf->HardDisk.bUseIdeMasterHardDiskImage);
+	if (cnf->HardDisk.bUseIdeMasterHardDiskImage)
+		hash = BootSnapshot_HashString(hash, cnf->HardDisk.szIdeMasterHardDiskImage);
+	hash = BootSnapshot_HashValue(hash, cnf->HardDisk.bUseIdeSlaveHardDiskImage);
+	if (cnf->HardDisk.bUseIdeSlaveHardDiskImage)
+		hash = BootSnapshot_HashString(hash, cnf->HardDisk.szIdeSlaveHardDiskImage);
+	hash = BootSnapshot_HashValue(hash, cnf->HardDisk.nHardDiskDrive);
+	hash = BootSnapshot_HashValue(hash, cnf->HardDisk.bUseHardDiskDirectories);
+	if (cnf->HardDisk.bUseHardDiskDirectories)
+		hash = BootSnapshot_HashString(hash, cnf->HardDisk.szHardDiskDirectories[0]);
+
+	hash = BootSnapshot_HashValue(hash, cnf->System.nMachineType);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bBlitter);
+	hash = BootSnapshot_HashValue(hash, cnf->System.nDSPType);
+	hash = BootSnapshot_HashValue(hash, cnf->System.nCpuLevel);
+	hash = BootSnapshot_HashValue(hash, cnf->System.nCpuFreq);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bCompatibleCpu);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bFastTiming);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bDeterministic);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bRealTimeClock);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bPatchTimerD);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bFastBoot);
+#if ENABLE_WINUAE_CPU
+	hash = BootSnapshot_HashValue(hash, cnf->System.bAddressSpace24);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bCycleExactCpu);
+	hash = BootSnapshot_HashValue(hash, cnf->System.bMMU);
+	hash = BootSnapshot_HashValue(hash, cnf->System.n_FPUType);
+#endif
+	hash = BootSnapshot_HashValue(hash, cnf->Memory.nMemorySize);
+	hash = BootSnapshot_HashValue(hash, cnf->Midi.bEnableMidi);
+
+	return hash;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return boot snapshot file name for given configuration hash
+ * (in a static buffer).
+ */
+static const char *BootSnapshot_FileName(Uint64 hash)
+{
+	static char sFileName[FILENAME_MAX];
+
+	snprintf(sFileName, sizeof(sFileName), "%s%cbootsnap-%08x%08x.sav",
+	         Paths_GetHatariHome(), PATHSEP,
+	         (Uint32)(hash >> 32), (Uint32)hash);
+	return sFileName;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the state buffer and stop recording / restoring.
+ */
+void BootSnapshot_Cancel(void)
+{
+	if (bRestoring)
+		return;
+	free(pStateBuffer);
+	pStateBuffer = NULL;
+	nStateBufferSize = nStateSize = 0;
+	nState = BOOTSNAPSHOT_IDLE;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on cold reset: restore the boot snapshot of the current
+ * configuration on next VBL if there is one, otherwise record it.
+ */
+void BootSnapshot_ColdReset(void)
+{
+	if (bRestoring)
+		return;
+	BootSnapshot_Cancel();
+	if (!ConfigureParams.System.bBootSnapshot || bBenchmarkMode)
+		return;
+
+	nConfigHash = BootSnapshot_ConfigHash();
+	if (File_Exists(BootSnapshot_FileName(nConfigHash)))
+	{
+		nState = BOOTSNAPSHOT_RESTORE;
+	}
+	else
+	{
+		nRecordedVBLs = 0;
+		nState = BOOTSNAPSHOT_RECORD;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the boot snapshot file into the state buffer. Return false if
+ * it's not usable.
+ */
+static bool BootSnapshot_Load(const char *pszFileName)
+{
+	BOOTSNAPSHOT_HEADER header;
+	BSS_File fp;
+	bool ok = false;
+
+	fp = BootSnapshot_fopen(pszFileName, "rb");
+	if (!fp)
+		return false;
+
+	if (BootSnapshot_fread(fp, &header, sizeof(header)) == (int)sizeof(header)
+	    && memcmp(header.sMagic, BOOTSNAPSHOT_MAGIC, sizeof(header.sMagic)) == 0
+	    && header.nHash == nConfigHash && header.nSize > 0)
+	{
+		pStateBuffer = malloc(header.nSize);
+		if (pStateBuffer)
+		{
+			nStateBufferSize = nStateSize = header.nSize;
+			ok = (BootSnapshot_fread(fp, pStateBuffer, nStateSize) == (int)nStateSize);
+		}
+	}
+	BootSnapshot_fclose(fp);
+	return ok;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore the boot snapshot, then put back the current configuration
+ * (the snapshot includes the disk settings of the session which saved it)
+ * and insert the floppy disks given for this session.
+ */
+static void BootSnapshot_Restore(void)
+{
+	const char *pszFileName = BootSnapshot_FileName(nConfigHash);
+	CNF_PARAMS *pCurrent;
+	int i;
+
+	pCurrent = malloc(sizeof(CNF_PARAMS));
+	if (!pCurrent || !BootSnapshot_Load(pszFileName))
+	{
+		Log_Printf(LOG_WARN, "Boot snapshot '%s' can't be used, removing it.\n", pszFileName);
+		remove(pszFileName);
+		free(pCurrent);
+		BootSnapshot_Cancel();
+		return;
+	}
+
+	*pCurrent = ConfigureParams;
+	bRestoring = true;
+	if (!MemorySnapShot_RestoreMemory(pStateBuffer, nStateSize))
+		remove(pszFileName);
+	bRestoring = false;
+	ConfigureParams = *pCurrent;
+	free(pCurrent);
+
+	for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+	{
+		Floppy_EjectDiskFromDrive(i);
+		if (ConfigureParams.DiskImage.szDiskFileName[i][0])
+			Floppy_InsertDiskIntoDrive(i);
+	}
+	Log_Printf(LOG_DEBUG, "Boot snapshot '%s' restored.\n", pszFileName);
+
+	BootSnapshot_Cancel();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture current state to the state buffer.
+ */
+static void BootSnapshot_Record(void)
+{
+	size_t nSize = MemorySnapShot_MemorySize(false);
+	Uint8 *pNew;
+
+	if (nSize > nStateBufferSize)
+	{
+		pNew = realloc(pStateBuffer, nSize);
+		if (!pNew)
+		{
+			BootSnapshot_Cancel();
+			return;
+		}
+		pStateBuffer = pNew;
+		nStateBufferSize = nSize;
+	}
+	if (MemorySnapShot_CaptureMemory(pStateBuffer, nStateBufferSize, false))
+		nStateSize = nSize;
+	else
+		nStateSize = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called at the VBL boundary, before the frame is handed over to the
+ * frontend.
+ */
+void BootSnapshot_Vbl(void)
+{
+	switch (nState)
+	{
+	case BOOTSNAPSHOT_RESTORE:
+		BootSnapshot_Restore();
+		break;
+	case BOOTSNAPSHOT_RECORD:
+		if (++nRecordedVBLs > BOOTSNAPSHOT_MAX_VBLS)
+			BootSnapshot_Cancel();
+		else if (nRecordedVBLs % BOOTSNAPSHOT_INTERVAL == 1)
+			BootSnapshot_Record();
+		break;
+	default:
+		break;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when TOS accesses a disk to boot from it: save the last
+ * recorded state, which is from before the access. It's written to
+ * a temporary file first, so that an interrupted write doesn't leave
+ * a broken boot snapshot behind.
+ */
+void BootSnapshot_DiskAccess(void)
+{
+	BOOTSNAPSHOT_HEADER header;
+	const char *pszFileName;
+	char *pszTmpName;
+	BSS_File fp;
+	bool ok;
+
+	if (nState != BOOTSNAPSHOT_RECORD)
+		return;
+	if (!nStateSize)
+	{
+		BootSnapshot_Cancel();
+		return;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.sMagic, BOOTSNAPSHOT_MAGIC, sizeof(header.sMagic));
+	header.nHash = nConfigHash;
+	header.nSize = nStateSize;
+
+	pszFileName = BootSnapshot_FileName(nConfigHash);
+	pszTmpName = malloc(strlen(pszFileName) + 5);
+	if (!pszTmpName)
+	{
+		BootSnapshot_Cancel();
+		return;
+	}
+	sprintf(pszTmpName, "%s.tmp", pszFileName);
+
+	fp = BootSnapshot_fopen(pszTmpName, BOOTSNAPSHOT_WRITEMODE);
+	if (fp)
+	{
+		ok = BootSnapshot_fwrite(fp, &header, sizeof(header)) == (int)sizeof(header)
+		     && BootSnapshot_fwrite(fp, pStateBuffer, nStateSize) == (int)nStateSize;
+		if (BootSnapshot_fclose(fp) != 0)
+			ok = false;
+		if (ok && rename(pszTmpName, pszFileName) == 0)
+			Log_Printf(LOG_DEBUG, "Boot snapshot '%s' saved.\n", pszFileName);
+		else
+			remove(pszTmpName);
+	}
+	else
+	{
+		Log_Printf(LOG_WARN, "Can't save boot snapshot '%s'.\n", pszTmpName);
+	}
+	free(pszTmpName);
+
+	BootSnapshot_Cancel();
+}
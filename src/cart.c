@@ -135,18 +135,22 @@ void Cart_ResetImage(void)
 	if (PatchIllegal == true)
 	{
 		//fprintf ( stderr ," Cart_ResetImage patch\n" );
-		/* Hatari's specific illegal opcodes for HD emulation */
-		cpufunctbl[GEMDOS_OPCODE] = OpCode_GemDos;	/* 0x0008 */
-		cpufunctbl[SYSINIT_OPCODE] = OpCode_SysInit;	/* 0x000a */
-		cpufunctbl[VDI_OPCODE] = OpCode_VDI;		/* 0x000c */
+		/* Hatari's specific illegal opcodes for HD emulation. Their handlers
+		 * are called directly from the CPU's opcode table, so they don't go
+		 * through op_illg() and the exception processing */
+		cpufunctbl_set(GEMDOS_OPCODE, OpCode_GemDos);	/* 0x0008 */
+		cpufunctbl_set(SYSINIT_OPCODE, OpCode_SysInit);	/* 0x000a */
+		cpufunctbl_set(VDI_OPCODE, OpCode_VDI);		/* 0x000c */
+		cpufunctbl_set(PEXEC_OPCODE, OpCode_Pexec);	/* 0x000e */
 	}
 	else
 	{
 		//fprintf ( stderr ," Cart_ResetImage no patch\n" );
 		/* No built-in cartridge loaded : set same handler as 0x4afc (illegal) */
-		cpufunctbl[GEMDOS_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x0008 */
-		cpufunctbl[SYSINIT_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x000a */
-		cpufunctbl[VDI_OPCODE] = cpufunctbl[ 0x4afc ];		/* 0x000c */
+		cpufunctbl_set(GEMDOS_OPCODE, cpufunctbl_get(0x4afc));	/* 0x0008 */
+		cpufunctbl_set(SYSINIT_OPCODE, cpufunctbl_get(0x4afc));	/* 0x000a */
+		cpufunctbl_set(VDI_OPCODE, cpufunctbl_get(0x4afc));		/* 0x000c */
+		cpufunctbl_set(PEXEC_OPCODE, cpufunctbl_get(0x4afc));	/* 0x000e */
 	}
 
 	/* although these don't need cartridge code, it's better
@@ -155,13 +159,13 @@ void Cart_ResetImage(void)
 	if (ConfigureParams.Log.bNatFeats)
 	{
 		/* illegal opcodes for emulators Native Features */
-		cpufunctbl[NATFEAT_ID_OPCODE] = OpCode_NatFeat_ID;	/* 0x7300 */
-		cpufunctbl[NATFEAT_CALL_OPCODE] = OpCode_NatFeat_Call;	/* 0x7301 */
+		cpufunctbl_set(NATFEAT_ID_OPCODE, OpCode_NatFeat_ID);	/* 0x7300 */
+		cpufunctbl_set(NATFEAT_CALL_OPCODE, OpCode_NatFeat_Call);	/* 0x7301 */
 	}
 	else
 	{
 		/* No Native Features : set same handler as 0x4afc (illegal) */
-		cpufunctbl[NATFEAT_ID_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x7300 */
-		cpufunctbl[NATFEAT_CALL_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x7300 */
+		cpufunctbl_set(NATFEAT_ID_OPCODE, cpufunctbl_get(0x4afc));	/* 0x7300 */
+		cpufunctbl_set(NATFEAT_CALL_OPCODE, cpufunctbl_get(0x4afc));	/* 0x7300 */
 	}
 }
@@ -48,7 +48,7 @@ const Uint8 Cart_data[] =
 0x2b,0x40,0x00,0x20,0x28,0x6d,0x00,0x18,0xd9,0xeb,0x00,0x0e,0x3e,0x2b,0x00,0x1a,
 0x48,0x6d,0x01,0x00,0x48,0x79,0x7f,0xff,0xff,0xff,0x3f,0x06,0x3f,0x3c,0x00,0x3f,
 0x4e,0x41,0x4f,0xef,0x00,0x0c,0x3f,0x06,0x3f,0x3c,0x00,0x3e,0x4e,0x41,0x58,0x4f,
-0x26,0x6d,0x00,0x08,0x20,0x0b,0x4a,0x47,0x66,0x38,0x1e,0x14,0x42,0x1c,0xe1,0x4f,
+0x00,0x0e,0x60,0x4e,0x20,0x0b,0x4a,0x47,0x66,0x38,0x1e,0x14,0x42,0x1c,0xe1,0x4f,
 0x1e,0x14,0x42,0x1c,0x48,0x47,0x1e,0x14,0x42,0x1c,0xe1,0x4f,0x1e,0x14,0x42,0x1c,
 0x4a,0x87,0x67,0x1e,0xd7,0xc7,0x7e,0x00,0xd1,0x93,0x1e,0x14,0x42,0x1c,0x4a,0x07,
 0x67,0x10,0xbe,0x3c,0x00,0x01,0x66,0x06,0x47,0xeb,0x00,0xfe,0x60,0xec,0xd6,0xc7,
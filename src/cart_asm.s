@@ -6,6 +6,7 @@
 GEMDOS_OPCODE		equ	8
 SYSINIT_OPCODE		equ 10
 VDI_OPCODE			equ	12
+PEXEC_OPCODE		equ	14
 
 ; System variables:
 _longframe		equ $059E
@@ -214,7 +215,8 @@ load_n_reloc:
 	trap	#1		; Gemdos
 	addq	#4,sp
 
-	move.l	8(a5),a3
+	dc.w	PEXEC_OPCODE	; Relocate and clear BSS natively, or set a3 to
+	bra.s	cleardone	; the text start and skip this branch (OpCode_Pexec)
 	move.l	a3,d0
 	tst.w	d7		; check absflag
 	bne.s	relocdone
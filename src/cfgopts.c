@@ -65,6 +65,96 @@ const char CfgOpts_fileid[] = "Hatari cfgopts.c : " __DATE__ " " __TIME__;
 #include "str.h"
 
 
+/**
+ * Store the value string of a configuration line to the option's
+ * storage location. Return false if the line had no value.
+ */
+static bool input_value(const struct Config_Tag *ptr, const char *next)
+{
+	TAG_TYPE type = ptr->type;
+
+	if (next == NULL)
+	{
+		if (type != String_Tag)
+			return false;
+		next = "";    /* field with empty string */
+	}
+	switch (type)      /* check type */
+	{
+	case Bool_Tag:
+		if (!strcasecmp(next,"FALSE"))
+			*((bool *)(ptr->buf)) = false;
+		else if (!strcasecmp(next,"TRUE"))
+			*((bool *)(ptr->buf)) = true;
+		break;
+
+	case Char_Tag:
+		sscanf(next, "%c", (char *)(ptr->buf));
+		break;
+
+	case Short_Tag:
+		sscanf(next, "%hd", (short *)(ptr->buf));
+		break;
+
+	case Int_Tag:
+		sscanf(next, "%d", (int *)(ptr->buf));
+		break;
+
+	case Long_Tag:
+		sscanf(next, "%ld", (long *)(ptr->buf));
+		break;
+
+	case Float_Tag:
+		sscanf(next, "%g", (float *)ptr->buf);
+		break;
+
+	case Double_Tag:
+		sscanf(next, "%lg", (double *)ptr->buf);
+		break;
+
+	case String_Tag:
+		strcpy((char *)ptr->buf, next);
+		break;
+
+	case Error_Tag:
+	default:
+		return false;
+	}
+	return true;
+}
+
+
+/**
+ * Parse one "option = value" line against the given options table.
+ * Return number of options set from it.
+ */
+static int input_line(char *fptr, const struct Config_Tag configs[],
+                      const char *filename, int lineno)
+{
+	const struct Config_Tag *ptr;
+	const char *next;
+	char *tok;
+	int count = 0;
+
+	tok = Str_Trim(strtok(fptr, "="));      /* get first token */
+	if (tok == NULL)
+		return 0;
+	for (ptr = configs; ptr->buf; ++ptr)    /* scan for token */
+	{
+		if (!strcmp(tok, ptr->code))    /* got a match? */
+		{
+			/* get actual config value */
+			next = Str_Trim(strtok(NULL, "="));
+			if (input_value(ptr, next))
+				count++;
+			else
+				printf("Error in Config file %s on line %d\n", filename, lineno);
+		}
+	}
+	return count;
+}
+
+
 /**
  * ---------------------------------------------------------------------/
  * /   reads from an input configuration (INI) file.
@@ -80,11 +170,9 @@ const char CfgOpts_fileid[] = "Hatari cfgopts.c : " __DATE__ " " __TIME__;
  */
 int input_config(const char *filename, const struct Config_Tag configs[], const char *header)
 {
-	const struct Config_Tag *ptr;
-	int count=0, lineno=0, type;
+	int count=0, lineno=0;
 	FILE *file;
-	char *fptr,*tok;
-	const char *next;
+	char *fptr;
 	char line[1024];
 
 	file = fopen(filename,"r");
@@ -113,72 +201,71 @@ int input_config(const char *filename, const struct Config_Tag configs[], const
 				continue;                       /* skip comments */
 			if (fptr[0] == '[')
 				continue;                       /* skip next header */
-			tok = Str_Trim(strtok(fptr, "="));      /* get first token */
-			if (tok == NULL)
-				continue;
-			for (ptr = configs; ptr->buf; ++ptr)    /* scan for token */
+			count += input_line(fptr, configs, filename, lineno);
+		}
+		while (fptr != NULL && fptr[0] != '[');
+
+	fclose(file);
+	return count;
+}
+
+
+/**
+ * Read all the given sections from an INI file in a single pass,
+ * instead of re-reading the file for each section with input_config().
+ * Sections are looked up by their header, and options only from the
+ * table of the section they are in.  Only the first occurrence of
+ * a section is read, like input_config() does.
+ * Return number of records read or -1 on error.
+ */
+int input_config_sections(const char *filename, const struct Config_Section sections[])
+{
+	const struct Config_Section *section, *current = NULL;
+	int count = 0, lineno = 0, nsections = 0, i;
+	bool *done;
+	FILE *file;
+	char *fptr;
+	char line[1024];
+
+	file = fopen(filename,"r");
+	if (file == NULL)
+		return -1;                 /* return error designation. */
+
+	for (section = sections; section->header; section++)
+		nsections++;
+	done = calloc(nsections, sizeof(bool));
+	if (!done)
+	{
+		fclose(file);
+		return -1;
+	}
+
+	while ((fptr = Str_Trim(fgets(line, sizeof(line), file))) != NULL)
+	{
+		lineno++;
+		if (fptr[0] == '#')
+			continue;                       /* skip comments */
+		if (fptr[0] == '[')
+		{
+			/* header: switch to its options table, if wanted */
+			current = NULL;
+			for (i = 0; i < nsections; i++)
 			{
-				if (!strcmp(tok, ptr->code))    /* got a match? */
+				if (!done[i] && !memcmp(fptr, sections[i].header,
+				                        strlen(sections[i].header)))
 				{
-					type = ptr->type;
-					/* get actual config value */
-					next = Str_Trim(strtok(NULL, "="));
-					if (next == NULL)
-					{
-						if (type == String_Tag)
-							next = ""; /* field with empty string */
-						else
-							type = Error_Tag;
-					}
-					count++;
-					switch (type)      /* check type */
-					{
-					case Bool_Tag:
-						if (!strcasecmp(next,"FALSE"))
-							*((bool *)(ptr->buf)) = false;
-						else if (!strcasecmp(next,"TRUE"))
-							*((bool *)(ptr->buf)) = true;
-						break;
-						
-					case Char_Tag:
-						sscanf(next, "%c", (char *)(ptr->buf));
-						break;
-						
-					case Short_Tag:
-						sscanf(next, "%hd", (short *)(ptr->buf));
-						break;
-						
-					case Int_Tag:
-						sscanf(next, "%d", (int *)(ptr->buf));
-						break;
-						
-					case Long_Tag:
-						sscanf(next, "%ld", (long *)(ptr->buf));
-						break;
-						
-					case Float_Tag:
-						sscanf(next, "%g", (float *)ptr->buf);
-						break;
-						
-					case Double_Tag:
-						sscanf(next, "%lg", (double *)ptr->buf);
-						break;
-						
-					case String_Tag:
-						strcpy((char *)ptr->buf, next);
-						break;
-						
-					case Error_Tag:
-					default:
-						count--;
-						printf("Error in Config file %s on line %d\n", filename, lineno);
-						break;
-					}
+					current = &sections[i];
+					done[i] = true;
+					break;
 				}
 			}
+			continue;
 		}
-		while (fptr != NULL && fptr[0] != '[');
+		if (current)
+			count += input_line(fptr, current->configs, filename, lineno);
+	}
 
+	free(done);
 	fclose(file);
 	return count;
 }
@@ -7,8 +7,8 @@
   This code handles run-time configuration changes. We keep all our
   configuration details in a structure called 'ConfigureParams'.  Before
   doing he changes, a backup copy is done of this structure. When
-  the changes are done, these are compared to see whether emulator
-  needs to be rebooted
+  the changes are done, these are compared to see whether the changes
+  can be applied while running, or need a warm or a cold reset.
 */
 const char Change_fileid[] = "Hatari change.c : " __DATE__ " " __TIME__;
 
@@ -52,11 +52,17 @@ const char Change_fileid[] = "Hatari change.c : " __DATE__ " " __TIME__;
 
 /*-----------------------------------------------------------------------*/
 /**
- * Check if user needs to be warned that changes will take place after reset.
- * Return true if wants to reset.
+ * Return what it takes to apply the given configuration changes:
+ * - CHANGE_HOT: applied while the emulation runs (sound, frameskip,
+ *   fast FDC, CPU timing, screen conversion, ...)
+ * - CHANGE_WARM: drives/devices which TOS looks for only when booting,
+ *   so a warm reset is enough and RAM/TOS are left alone
+ * - CHANGE_COLD: machine, memory, CPU, TOS or screen memory layout
+ *   changes, which need a cold reset with a TOS reload
  */
-bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
+CHANGE_TIER Change_GetResetTier(CNF_PARAMS *current, CNF_PARAMS *changed)
 {
+	CHANGE_TIER tier = CHANGE_HOT;
 	int i;
 
 	/* Did we change monitor type? If so, must reset */
@@ -64,99 +70,116 @@ bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
 	    && (changed->System.nMachineType == MACHINE_FALCON
 	        || current->Screen.nMonitorType == MONITOR_TYPE_MONO
 	        || changed->Screen.nMonitorType == MONITOR_TYPE_MONO))
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change to GEM VDI display? */
 	if (current->Screen.bUseExtVdiResolutions != changed->Screen.bUseExtVdiResolutions)
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change GEM resolution or color depth? */
 	if (changed->Screen.bUseExtVdiResolutions &&
 	    (current->Screen.nVdiWidth != changed->Screen.nVdiWidth
 	     || current->Screen.nVdiHeight != changed->Screen.nVdiHeight
 	     || current->Screen.nVdiColors != changed->Screen.nVdiColors))
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change TOS ROM image? */
 	if (strcmp(changed->Rom.szTosImageFileName, current->Rom.szTosImageFileName))
-		return true;
-
-	/* Did change ACSI hard disk image? */
-	for (i = 0; i < MAX_ACSI_DEVS; i++)
-	{
-		if (changed->Acsi[i].bUseDevice != current->Acsi[i].bUseDevice
-		    || (strcmp(changed->Acsi[i].sDeviceFile, current->Acsi[i].sDeviceFile)
-		        && changed->Acsi[i].bUseDevice))
-			return true;
-	}
-
-	/* Did change IDE master hard disk image? */
-	if (changed->HardDisk.bUseIdeMasterHardDiskImage != current->HardDisk.bUseIdeMasterHardDiskImage
-	    || strcmp(changed->HardDisk.szIdeMasterHardDiskImage, current->HardDisk.szIdeMasterHardDiskImage))
-		return true;
-
-	/* Did change IDE slave hard disk image? */
-	if (changed->HardDisk.bUseIdeSlaveHardDiskImage != current->HardDisk.bUseIdeSlaveHardDiskImage
-	    || strcmp(changed->HardDisk.szIdeSlaveHardDiskImage, current->HardDisk.szIdeSlaveHardDiskImage))
-		return true;
-
-	/* Did change GEMDOS drive Atari/host location or enabling? */
-	if (changed->HardDisk.nHardDiskDrive != current->HardDisk.nHardDiskDrive
-	    || changed->HardDisk.bUseHardDiskDirectories != current->HardDisk.bUseHardDiskDirectories
-	    || (strcmp(changed->HardDisk.szHardDiskDirectories[0], current->HardDisk.szHardDiskDirectories[0])
-	        && changed->HardDisk.bUseHardDiskDirectories))
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change machine type? */
 	if (changed->System.nMachineType != current->System.nMachineType)
-		return true;
-	/* did change ST Blitter? */
-	else if (current->System.nMachineType == MACHINE_ST &&
-		 current->System.bBlitter != changed->System.bBlitter)
-		return true;
+		return CHANGE_COLD;
 
 #if ENABLE_DSP_EMU
 	/* enabling DSP needs reset (disabling it not) */
 	if (current->System.nDSPType != DSP_TYPE_EMU &&
 	    changed->System.nDSPType == DSP_TYPE_EMU)
-		return true;
+		return CHANGE_COLD;
 #endif
 
 	/* did change CPU type? */
 	if (changed->System.nCpuLevel != current->System.nCpuLevel)
-		return true;
+		return CHANGE_COLD;
 
 #if ENABLE_WINUAE_CPU
 	/* Did change CPU address mode? */
 	if (changed->System.bAddressSpace24 != current->System.bAddressSpace24)
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change CPU prefetch mode? */
 	if (changed->System.bCompatibleCpu != current->System.bCompatibleCpu)
-		return true;
+		return CHANGE_COLD;
+
+	/* Did change CPU timing mode? */
+	if (changed->System.bFastTiming != current->System.bFastTiming)
+		return CHANGE_COLD;
 
 	/* Did change CPU cycle exact? */
 	if (changed->System.bCycleExactCpu != current->System.bCycleExactCpu)
-		return true;
+		return CHANGE_COLD;
 
 	/* Did change MMU? */
 	if (changed->System.bMMU != current->System.bMMU)
-		return true;
+		return CHANGE_COLD;
  
 	/* Did change FPU? */
 	if (changed->System.n_FPUType != current->System.n_FPUType)
-		return true;
+		return CHANGE_COLD;
 #endif
 
 	/* Did change size of memory? */
 	if (current->Memory.nMemorySize != changed->Memory.nMemorySize)
-		return true;
+		return CHANGE_COLD;
+
+	/* Did change ACSI hard disk image? */
+	for (i = 0; i < MAX_ACSI_DEVS; i++)
+	{
+		if (changed->Acsi[i].bUseDevice != current->Acsi[i].bUseDevice
+		    || (strcmp(changed->Acsi[i].sDeviceFile, current->Acsi[i].sDeviceFile)
+		        && changed->Acsi[i].bUseDevice))
+			tier = CHANGE_WARM;
+	}
+
+	/* Did change IDE master hard disk image? */
+	if (changed->HardDisk.bUseIdeMasterHardDiskImage != current->HardDisk.bUseIdeMasterHardDiskImage
+	    || strcmp(changed->HardDisk.szIdeMasterHardDiskImage, current->HardDisk.szIdeMasterHardDiskImage))
+		tier = CHANGE_WARM;
+
+	/* Did change IDE slave hard disk image? */
+	if (changed->HardDisk.bUseIdeSlaveHardDiskImage != current->HardDisk.bUseIdeSlaveHardDiskImage
+	    || strcmp(changed->HardDisk.szIdeSlaveHardDiskImage, current->HardDisk.szIdeSlaveHardDiskImage))
+		tier = CHANGE_WARM;
+
+	/* Did change GEMDOS drive Atari/host location or enabling? */
+	if (changed->HardDisk.nHardDiskDrive != current->HardDisk.nHardDiskDrive
+	    || changed->HardDisk.bUseHardDiskDirectories != current->HardDisk.bUseHardDiskDirectories
+	    || ((strcmp(changed->HardDisk.szHardDiskDirectories[0], current->HardDisk.szHardDiskDirectories[0])
+	         || strcmp(changed->HardDisk.szGemdosOverlayDir, current->HardDisk.szGemdosOverlayDir))
+	        && changed->HardDisk.bUseHardDiskDirectories))
+		tier = CHANGE_WARM;
+
+	/* did change ST Blitter? TOS checks for it at boot */
+	if (current->System.nMachineType == MACHINE_ST &&
+	    current->System.bBlitter != changed->System.bBlitter)
+		tier = CHANGE_WARM;
 
 	/* MIDI related IRQs start/stop needs reset */
 	if (current->Midi.bEnableMidi != changed->Midi.bEnableMidi)
-		return true;
+		tier = CHANGE_WARM;
+
+	return tier;
+}
 
-	return false;
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check if user needs to be warned that changes will take place after reset.
+ * Return true if wants to reset.
+ */
+bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
+{
+	return Change_GetResetTier(current, changed) != CHANGE_HOT;
 }
 
 
@@ -166,6 +189,7 @@ bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
  */
 void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *changed, bool bForceReset)
 {
+	CHANGE_TIER tier;
 	bool NeedReset;
 	bool bReInitGemdosDrive = false;
 	bool bReInitAcsiEmu = false;
@@ -180,9 +204,10 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 	Dprintf("Changes for:\n");
 	/* Do we need to warn user that changes will only take effect after reset? */
 	if (bForceReset)
-		NeedReset = bForceReset;
+		tier = CHANGE_COLD;
 	else
-		NeedReset = Change_DoNeedReset(current, changed);
+		tier = Change_GetResetTier(current, changed);
+	NeedReset = (tier != CHANGE_HOT);
 
 	/* Do need to change resolution? Need if change display/overscan settings
 	 * (if switch between Colour/Mono cause reset later) or toggle statusbar
@@ -192,6 +217,7 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 	     || changed->Screen.bAspectCorrect != current->Screen.bAspectCorrect
 	     || changed->Screen.nMaxWidth != current->Screen.nMaxWidth
 	     || changed->Screen.nMaxHeight != current->Screen.nMaxHeight
+	     || changed->Screen.bNativeRes != current->Screen.bNativeRes
 	     || changed->Screen.bAllowOverscan != current->Screen.bAllowOverscan
 	     || changed->Screen.bShowStatusbar != current->Screen.bShowStatusbar))
 	{
@@ -256,7 +282,8 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 	/* Did change GEMDOS drive Atari/host location or enabling? */
 	if (changed->HardDisk.nHardDiskDrive != current->HardDisk.nHardDiskDrive
 	    || changed->HardDisk.bUseHardDiskDirectories != current->HardDisk.bUseHardDiskDirectories
-	    || (strcmp(changed->HardDisk.szHardDiskDirectories[0], current->HardDisk.szHardDiskDirectories[0])
+	    || ((strcmp(changed->HardDisk.szHardDiskDirectories[0], current->HardDisk.szHardDiskDirectories[0])
+	         || strcmp(changed->HardDisk.szGemdosOverlayDir, current->HardDisk.szGemdosOverlayDir))
 	        && changed->HardDisk.bUseHardDiskDirectories))
 	{
 		Dprintf("- gemdos HD>\n");
@@ -340,8 +367,8 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 		ConfigureParams = *changed;
 	}
 
-	/* Copy details to global, if we reset copy them all */
-	Configuration_Apply(NeedReset);
+	/* Copy details to global, if we cold reset copy them all */
+	Configuration_Apply(tier == CHANGE_COLD);
 
 #if ENABLE_DSP_EMU
 	if (current->System.nDSPType != DSP_TYPE_EMU &&
@@ -433,11 +460,16 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 	}
 
 	/* Do we need to perform reset? */
-	if (NeedReset)
+	if (tier == CHANGE_COLD)
 	{
-		Dprintf("- reset\n");
+		Dprintf("- cold reset\n");
 		Reset_Cold();
 	}
+	else if (tier == CHANGE_WARM)
+	{
+		Dprintf("- warm reset\n");
+		Reset_Warm();
+	}
 
 	/* Go into/return from full screen if flagged */
 	if (!bInFullScreen && ConfigureParams.Screen.bFullScreen)
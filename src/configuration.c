@@ -44,11 +44,13 @@ static const struct Config_Tag configs_Log[] =
 {
 	{ "sLogFileName", String_Tag, ConfigureParams.Log.sLogFileName },
 	{ "sTraceFileName", String_Tag, ConfigureParams.Log.sTraceFileName },
+	{ "sTraceBinFileName", String_Tag, ConfigureParams.Log.sTraceBinFileName },
 	{ "nExceptionDebugMask", Int_Tag, &ConfigureParams.Log.nExceptionDebugMask },
 	{ "nTextLogLevel", Int_Tag, &ConfigureParams.Log.nTextLogLevel },
 	{ "nAlertDlgLogLevel", Int_Tag, &ConfigureParams.Log.nAlertDlgLogLevel },
 	{ "bConfirmQuit", Bool_Tag, &ConfigureParams.Log.bConfirmQuit },
 	{ "bNatFeats", Bool_Tag, &ConfigureParams.Log.bNatFeats },
+	{ "nNatFeatsMemOps", Int_Tag, &ConfigureParams.Log.nNatFeatsMemOps },
 	{ "bConsoleWindow", Bool_Tag, &ConfigureParams.Log.bConsoleWindow },
 	{ NULL , Error_Tag, NULL }
 };
@@ -84,6 +86,9 @@ static const struct Config_Tag configs_Screen[] =
 	{ "bShowDriveLed", Bool_Tag, &ConfigureParams.Screen.bShowDriveLed },
 	{ "bCrop", Bool_Tag, &ConfigureParams.Screen.bCrop },
 	{ "bForceMax", Bool_Tag, &ConfigureParams.Screen.bForceMax },
+	{ "bNativeRes", Bool_Tag, &ConfigureParams.Screen.bNativeRes },
+	{ "bHeadless", Bool_Tag, &ConfigureParams.Screen.bHeadless },
+	{ "nFrameHash", Int_Tag, &ConfigureParams.Screen.nFrameHash },
 	{ "nMaxWidth", Int_Tag, &ConfigureParams.Screen.nMaxWidth },
 	{ "nMaxHeight", Int_Tag, &ConfigureParams.Screen.nMaxHeight },
 	{ NULL , Error_Tag, NULL }
@@ -183,6 +188,7 @@ static const struct Config_Tag configs_Joystick5[] =
 static const struct Config_Tag configs_Keyboard[] =
 {
 	{ "bDisableKeyRepeat", Bool_Tag, &ConfigureParams.Keyboard.bDisableKeyRepeat },
+	{ "bIkbdCpu", Bool_Tag, &ConfigureParams.Keyboard.bIkbdCpu },
 	{ "nKeymapType", Int_Tag, &ConfigureParams.Keyboard.nKeymapType },
 	{ "szMappingFileName", String_Tag, ConfigureParams.Keyboard.szMappingFileName },
 	{ NULL , Error_Tag, NULL }
@@ -255,6 +261,9 @@ static const struct Config_Tag configs_Sound[] =
 	{ "nSdlAudioBufferSize", Int_Tag, &ConfigureParams.Sound.SdlAudioBufferSize },
 	{ "szYMCaptureFileName", String_Tag, ConfigureParams.Sound.szYMCaptureFileName },
 	{ "YmVolumeMixing", Int_Tag, &ConfigureParams.Sound.YmVolumeMixing },
+	{ "bYmHighQuality", Bool_Tag, &ConfigureParams.Sound.bYmHighQuality },
+	{ "bCrossbarBatch", Bool_Tag, &ConfigureParams.Sound.bCrossbarBatch },
+	{ "bYmCompactVolume", Bool_Tag, &ConfigureParams.Sound.bYmCompactVolume },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -265,6 +274,8 @@ static const struct Config_Tag configs_Memory[] =
 	{ "bAutoSave", Bool_Tag, &ConfigureParams.Memory.bAutoSave },
 	{ "szMemoryCaptureFileName", String_Tag, ConfigureParams.Memory.szMemoryCaptureFileName },
 	{ "szAutoSaveFileName", String_Tag, ConfigureParams.Memory.szAutoSaveFileName },
+	{ "nSnapshotCompression", Int_Tag, &ConfigureParams.Memory.nSnapshotCompression },
+	{ "nAutoSaveInterval", Int_Tag, &ConfigureParams.Memory.nAutoSaveInterval },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -274,6 +285,10 @@ static const struct Config_Tag configs_Floppy[] =
 {
 	{ "bAutoInsertDiskB", Bool_Tag, &ConfigureParams.DiskImage.bAutoInsertDiskB },
 	{ "FastFloppy", Bool_Tag, &ConfigureParams.DiskImage.FastFloppy },
+	{ "TurboFloppy", Bool_Tag, &ConfigureParams.DiskImage.TurboFloppy },
+	{ "bFloppyHLE", Bool_Tag, &ConfigureParams.DiskImage.bFloppyHLE },
+	{ "bDiskOverlay", Bool_Tag, &ConfigureParams.DiskImage.bDiskOverlay },
+	{ "bDiskJournal", Bool_Tag, &ConfigureParams.DiskImage.bDiskJournal },
 	{ "EnableDriveA", Bool_Tag, &ConfigureParams.DiskImage.EnableDriveA },
 	{ "DriveA_NumberOfHeads", Int_Tag, &ConfigureParams.DiskImage.DriveA_NumberOfHeads },
 	{ "EnableDriveB", Bool_Tag, &ConfigureParams.DiskImage.EnableDriveB },
@@ -295,6 +310,10 @@ static const struct Config_Tag configs_HardDisk[] =
 	{ "bUseHardDiskDirectory", Bool_Tag, &ConfigureParams.HardDisk.bUseHardDiskDirectories },
 	{ "szHardDiskDirectory", String_Tag, ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C] },
 	{ "nGemdosCase", Int_Tag, &ConfigureParams.HardDisk.nGemdosCase },
+	{ "bGemdosMmap", Bool_Tag, &ConfigureParams.HardDisk.bGemdosMmap },
+	{ "bGemdosFastPexec", Bool_Tag, &ConfigureParams.HardDisk.bGemdosFastPexec },
+	{ "nGemdosFlush", Int_Tag, &ConfigureParams.HardDisk.nGemdosFlush },
+	{ "szGemdosOverlayDir", String_Tag, ConfigureParams.HardDisk.szGemdosOverlayDir },
 	{ "nWriteProtection", Int_Tag, &ConfigureParams.HardDisk.nWriteProtection },
 	{ "bUseHardDiskImage", Bool_Tag, &ConfigureParams.Acsi[0].bUseDevice },
 	{ "szHardDiskImage", String_Tag, ConfigureParams.Acsi[0].sDeviceFile },
@@ -302,6 +321,7 @@ static const struct Config_Tag configs_HardDisk[] =
 	{ "bUseIdeSlaveHardDiskImage", Bool_Tag, &ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage },
 	{ "szIdeMasterHardDiskImage", String_Tag, ConfigureParams.HardDisk.szIdeMasterHardDiskImage },
 	{ "szIdeSlaveHardDiskImage", String_Tag, ConfigureParams.HardDisk.szIdeSlaveHardDiskImage },
+	{ "nHdCacheSize", Int_Tag, &ConfigureParams.HardDisk.nHdCacheSize },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -368,13 +388,21 @@ static const struct Config_Tag configs_System[] =
 	{ "nCpuLevel", Int_Tag, &ConfigureParams.System.nCpuLevel },
 	{ "nCpuFreq", Int_Tag, &ConfigureParams.System.nCpuFreq },
 	{ "bCompatibleCpu", Bool_Tag, &ConfigureParams.System.bCompatibleCpu },
+	{ "bFastTiming", Bool_Tag, &ConfigureParams.System.bFastTiming },
+	{ "bAutoPrefetch", Bool_Tag, &ConfigureParams.System.bAutoPrefetch },
+	{ "bCpuTurbo", Bool_Tag, &ConfigureParams.System.bCpuTurbo },
+	{ "bBatchHbl", Bool_Tag, &ConfigureParams.System.bBatchHbl },
 	{ "nMachineType", Int_Tag, &ConfigureParams.System.nMachineType },
 	{ "bBlitter", Bool_Tag, &ConfigureParams.System.bBlitter },
 	{ "nDSPType", Int_Tag, &ConfigureParams.System.nDSPType },
+	{ "nDSPSkew", Int_Tag, &ConfigureParams.System.nDSPSkew },
 	{ "bRealTimeClock", Bool_Tag, &ConfigureParams.System.bRealTimeClock },
 	{ "bPatchTimerD", Bool_Tag, &ConfigureParams.System.bPatchTimerD },
 	{ "bFastBoot", Bool_Tag, &ConfigureParams.System.bFastBoot },
+	{ "bTurboBoot", Bool_Tag, &ConfigureParams.System.bTurboBoot },
+	{ "bBootSnapshot", Bool_Tag, &ConfigureParams.System.bBootSnapshot },
 	{ "bFastForward", Bool_Tag, &ConfigureParams.System.bFastForward },
+	{ "bDeterministic", Bool_Tag, &ConfigureParams.System.bDeterministic },
 
 #if ENABLE_WINUAE_CPU
 	{ "bAddressSpace24", Bool_Tag, &ConfigureParams.System.bAddressSpace24 },
@@ -392,6 +420,8 @@ static const struct Config_Tag configs_Video[] =
 	{ "AviRecordVcodec", Int_Tag, &ConfigureParams.Video.AviRecordVcodec },
 	{ "AviRecordFps", Int_Tag, &ConfigureParams.Video.AviRecordFps },
 	{ "AviRecordFile", String_Tag, ConfigureParams.Video.AviRecordFile },
+	{ "ScreenShotCompression", Int_Tag, &ConfigureParams.Video.ScreenShotCompression },
+	{ "FramePipeFile", String_Tag, ConfigureParams.Video.FramePipeFile },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -420,6 +450,7 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Log.nAlertDlgLogLevel = LOG_ERROR;
 	ConfigureParams.Log.bConfirmQuit = true;
 	ConfigureParams.Log.bNatFeats = false;
+	ConfigureParams.Log.nNatFeatsMemOps = NATFEATS_MEMOPS_OFF;
 	ConfigureParams.Log.bConsoleWindow = false;
 
 	/* Set defaults for debugger */
@@ -433,6 +464,10 @@ void Configuration_SetDefault(void)
 	/* Set defaults for floppy disk images */
 	ConfigureParams.DiskImage.bAutoInsertDiskB = true;
 	ConfigureParams.DiskImage.FastFloppy = false;
+	ConfigureParams.DiskImage.TurboFloppy = false;
+	ConfigureParams.DiskImage.bFloppyHLE = false;
+	ConfigureParams.DiskImage.bDiskOverlay = false;
+	ConfigureParams.DiskImage.bDiskJournal = true;
 	ConfigureParams.DiskImage.nWriteProtection = WRITEPROT_OFF;
 
 	ConfigureParams.DiskImage.EnableDriveA = true;
@@ -456,6 +491,9 @@ void Configuration_SetDefault(void)
 	/* Set defaults for hard disks */
 	ConfigureParams.HardDisk.bBootFromHardDisk = false;
 	ConfigureParams.HardDisk.nGemdosCase = GEMDOS_NOP;
+	ConfigureParams.HardDisk.bGemdosMmap = false;
+	ConfigureParams.HardDisk.bGemdosFastPexec = false;
+	ConfigureParams.HardDisk.nGemdosFlush = GEMDOS_FLUSH_WRITE;
 	ConfigureParams.HardDisk.nWriteProtection = WRITEPROT_OFF;
 	ConfigureParams.HardDisk.nHardDiskDrive = DRIVE_C;
 	ConfigureParams.HardDisk.bUseHardDiskDirectories = false;
@@ -464,10 +502,12 @@ void Configuration_SetDefault(void)
 		strcpy(ConfigureParams.HardDisk.szHardDiskDirectories[i], psWorkingDir);
 		File_CleanFileName(ConfigureParams.HardDisk.szHardDiskDirectories[i]);
 	}
+	ConfigureParams.HardDisk.szGemdosOverlayDir[0] = '\0';
 	ConfigureParams.HardDisk.bUseIdeMasterHardDiskImage = false;
 	strcpy(ConfigureParams.HardDisk.szIdeMasterHardDiskImage, psWorkingDir);
 	ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage = false;
 	strcpy(ConfigureParams.HardDisk.szIdeSlaveHardDiskImage, psWorkingDir);
+	ConfigureParams.HardDisk.nHdCacheSize = 8;
 
 	/* ACSI */
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
@@ -495,6 +535,7 @@ void Configuration_SetDefault(void)
 
 	/* Set defaults for Keyboard */
 	ConfigureParams.Keyboard.bDisableKeyRepeat = false;
+	ConfigureParams.Keyboard.bIkbdCpu = true;
 	ConfigureParams.Keyboard.nKeymapType = KEYMAP_SYMBOLIC;
 	strcpy(ConfigureParams.Keyboard.szMappingFileName, "");
   
@@ -532,6 +573,8 @@ void Configuration_SetDefault(void)
 	        psHomeDir, PATHSEP);
 	sprintf(ConfigureParams.Memory.szAutoSaveFileName, "%s%cauto.sav",
 	        psHomeDir, PATHSEP);
+	ConfigureParams.Memory.nSnapshotCompression = 1;	/* fast */
+	ConfigureParams.Memory.nAutoSaveInterval = 0;
 
 	/* Set defaults for Printer */
 	ConfigureParams.Printer.bEnablePrinting = false;
@@ -569,6 +612,9 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Screen.nMaxWidth = 2*NUM_VISIBLE_LINE_PIXELS;
 	ConfigureParams.Screen.nMaxHeight = 2*NUM_VISIBLE_LINES+STATUSBAR_MAX_HEIGHT;
 	ConfigureParams.Screen.bForceMax = false;
+	ConfigureParams.Screen.bNativeRes = false;
+	ConfigureParams.Screen.bHeadless = false;
+	ConfigureParams.Screen.nFrameHash = 0;
 
 	/* Set defaults for Sound */
 	ConfigureParams.Sound.bEnableMicrophone = true;
@@ -579,6 +625,9 @@ void Configuration_SetDefault(void)
 	        psWorkingDir, PATHSEP);
 	ConfigureParams.Sound.SdlAudioBufferSize = 0;
 	ConfigureParams.Sound.YmVolumeMixing = YM_TABLE_MIXING;
+	ConfigureParams.Sound.bYmHighQuality = false;
+	ConfigureParams.Sound.bCrossbarBatch = false;
+	ConfigureParams.Sound.bYmCompactVolume = false;
 
 	/* Set defaults for Rom */
 	sprintf(ConfigureParams.Rom.szTosImageFileName, "%s%ctos.img",
@@ -606,11 +655,19 @@ void Configuration_SetDefault(void)
 	ConfigureParams.System.nDSPType = DSP_TYPE_NONE;
 #endif
 	ConfigureParams.System.bCompatibleCpu = true;
+	ConfigureParams.System.bFastTiming = false;
+	ConfigureParams.System.bAutoPrefetch = false;
+	ConfigureParams.System.bCpuTurbo = false;
+	ConfigureParams.System.bBatchHbl = false;
+	ConfigureParams.System.nDSPSkew = 0;
 	ConfigureParams.System.bBlitter = false;
 	ConfigureParams.System.bPatchTimerD = true;
 	ConfigureParams.System.bFastBoot = true;
+	ConfigureParams.System.bTurboBoot = false;
+	ConfigureParams.System.bBootSnapshot = false;
 	ConfigureParams.System.bRealTimeClock = false;
 	ConfigureParams.System.bFastForward = false;
+	ConfigureParams.System.bDeterministic = false;
 
 	/* Set defaults for Video */
 #if HAVE_LIBPNG
@@ -620,6 +677,8 @@ void Configuration_SetDefault(void)
 #endif
 	ConfigureParams.Video.AviRecordFps = 0;			/* automatic FPS */
 	sprintf(ConfigureParams.Video.AviRecordFile, "%s%chatari.avi", psWorkingDir, PATHSEP);
+	ConfigureParams.Video.ScreenShotCompression = 1;	/* fast */
+	ConfigureParams.Video.FramePipeFile[0] = '\0';
 
 	/* Initialize the configuration file name */
 	if (strlen(psHomeDir) < sizeof(sConfigFileName)-13)
@@ -666,6 +725,15 @@ void Configuration_Apply(bool bReset)
 		nFrameSkips = ConfigureParams.Screen.nFrameSkips;
 	}
 
+#if ENABLE_ST_ONLY
+	/* TT and Falcon hardware and 68010+ CPUs are not built in */
+	if (ConfigureParams.System.nMachineType == MACHINE_TT
+	    || ConfigureParams.System.nMachineType == MACHINE_FALCON)
+		ConfigureParams.System.nMachineType = MACHINE_STE;
+	ConfigureParams.System.nCpuLevel = 0;
+	ConfigureParams.System.nDSPType = DSP_TYPE_NONE;
+#endif
+
 	/* Init clocks for this machine */
 	ClocksTimings_InitMachine ( ConfigureParams.System.nMachineType );
 
@@ -702,6 +770,11 @@ void Configuration_Apply(bool bReset)
 		File_MakeAbsoluteName(ConfigureParams.Rom.szCartridgeImageFileName);
 	File_CleanFileName(ConfigureParams.HardDisk.szHardDiskDirectories[0]);
 	File_MakeAbsoluteName(ConfigureParams.HardDisk.szHardDiskDirectories[0]);
+	if (strlen(ConfigureParams.HardDisk.szGemdosOverlayDir) > 0)
+	{
+		File_CleanFileName(ConfigureParams.HardDisk.szGemdosOverlayDir);
+		File_MakeAbsoluteName(ConfigureParams.HardDisk.szGemdosOverlayDir);
+	}
 	File_MakeAbsoluteName(ConfigureParams.Memory.szMemoryCaptureFileName);
 	File_MakeAbsoluteName(ConfigureParams.Sound.szYMCaptureFileName);
 	if (strlen(ConfigureParams.Keyboard.szMappingFileName) > 0)
@@ -715,6 +788,7 @@ void Configuration_Apply(bool bReset)
 	/* make path names absolute, but handle special file names */
 	File_MakeAbsoluteSpecialName(ConfigureParams.Log.sLogFileName);
 	File_MakeAbsoluteSpecialName(ConfigureParams.Log.sTraceFileName);
+	File_MakeAbsoluteSpecialName(ConfigureParams.Log.sTraceBinFileName);
 	File_MakeAbsoluteSpecialName(ConfigureParams.RS232.szInFileName);
 	File_MakeAbsoluteSpecialName(ConfigureParams.RS232.szOutFileName);
 	File_MakeAbsoluteSpecialName(ConfigureParams.Midi.sMidiInFileName);
@@ -737,28 +811,46 @@ void Configuration_Apply(bool bReset)
 }
 
 
-/*-----------------------------------------------------------------------*/
-/**
- * Load a settings section from the configuration file.
- */
-static int Configuration_LoadSection(const char *pFilename, const struct Config_Tag configs[], const char *pSection)
+/* Configuration file sections and their settings */
+static const struct Config_Section configs_Sections[] =
 {
-	int ret;
-
-	ret = input_config(pFilename, configs, pSection);
-
-	if (ret < 0)
-		fprintf(stderr, "Can not load configuration file %s (section %s).\n",
-		        pFilename, pSection);
-
-	return ret;
-}
+	{ "[Log]", configs_Log },
+	{ "[Debugger]", configs_Debugger },
+	{ "[Screen]", configs_Screen },
+	{ "[Joystick0]", configs_Joystick0 },
+	{ "[Joystick1]", configs_Joystick1 },
+	{ "[Joystick2]", configs_Joystick2 },
+	{ "[Joystick3]", configs_Joystick3 },
+	{ "[Joystick4]", configs_Joystick4 },
+	{ "[Joystick5]", configs_Joystick5 },
+	{ "[Keyboard]", configs_Keyboard },
+#if WITH_SDL2
+	{ "[ShortcutsWithModifiers2]", configs_ShortCutWithMod },
+	{ "[ShortcutsWithoutModifiers2]", configs_ShortCutWithoutMod },
+#else
+	{ "[ShortcutsWithModifiers]", configs_ShortCutWithMod },
+	{ "[ShortcutsWithoutModifiers]", configs_ShortCutWithoutMod },
+#endif
+	{ "[Sound]", configs_Sound },
+	{ "[Memory]", configs_Memory },
+	{ "[Floppy]", configs_Floppy },
+	{ "[HardDisk]", configs_HardDisk },
+	{ "[ACSI]", configs_Acsi },
+	{ "[ROM]", configs_Rom },
+	{ "[RS232]", configs_Rs232 },
+	{ "[Printer]", configs_Printer },
+	{ "[Midi]", configs_Midi },
+	{ "[System]", configs_System },
+	{ "[Video]", configs_Video },
+	{ NULL, NULL }
+};
 
 
 /*-----------------------------------------------------------------------*/
 /**
  * Load program setting from configuration file. If psFileName is NULL, use
  * the configuration file given in configuration / last selected by user.
+ * All sections are read in a single pass over the file.
  */
 void Configuration_Load(const char *psFileName)
 {
@@ -771,34 +863,8 @@ void Configuration_Load(const char *psFileName)
 		return;
 	}
 
-	Configuration_LoadSection(psFileName, configs_Log, "[Log]");
-	Configuration_LoadSection(psFileName, configs_Debugger, "[Debugger]");
-	Configuration_LoadSection(psFileName, configs_Screen, "[Screen]");
-	Configuration_LoadSection(psFileName, configs_Joystick0, "[Joystick0]");
-	Configuration_LoadSection(psFileName, configs_Joystick1, "[Joystick1]");
-	Configuration_LoadSection(psFileName, configs_Joystick2, "[Joystick2]");
-	Configuration_LoadSection(psFileName, configs_Joystick3, "[Joystick3]");
-	Configuration_LoadSection(psFileName, configs_Joystick4, "[Joystick4]");
-	Configuration_LoadSection(psFileName, configs_Joystick5, "[Joystick5]");
-	Configuration_LoadSection(psFileName, configs_Keyboard, "[Keyboard]");
-#if WITH_SDL2
-	Configuration_LoadSection(psFileName, configs_ShortCutWithMod, "[ShortcutsWithModifiers2]");
-	Configuration_LoadSection(psFileName, configs_ShortCutWithoutMod, "[ShortcutsWithoutModifiers2]");
-#else
-	Configuration_LoadSection(psFileName, configs_ShortCutWithMod, "[ShortcutsWithModifiers]");
-	Configuration_LoadSection(psFileName, configs_ShortCutWithoutMod, "[ShortcutsWithoutModifiers]");
-#endif
-	Configuration_LoadSection(psFileName, configs_Sound, "[Sound]");
-	Configuration_LoadSection(psFileName, configs_Memory, "[Memory]");
-	Configuration_LoadSection(psFileName, configs_Floppy, "[Floppy]");
-	Configuration_LoadSection(psFileName, configs_HardDisk, "[HardDisk]");
-	Configuration_LoadSection(psFileName, configs_Acsi, "[ACSI]");
-	Configuration_LoadSection(psFileName, configs_Rom, "[ROM]");
-	Configuration_LoadSection(psFileName, configs_Rs232, "[RS232]");
-	Configuration_LoadSection(psFileName, configs_Printer, "[Printer]");
-	Configuration_LoadSection(psFileName, configs_Midi, "[Midi]");
-	Configuration_LoadSection(psFileName, configs_System, "[System]");
-	Configuration_LoadSection(psFileName, configs_Video, "[Video]");
+	if (input_config_sections(psFileName, configs_Sections) < 0)
+		fprintf(stderr, "Can not load configuration file %s.\n", psFileName);
 }
 
 
@@ -900,6 +966,7 @@ void Configuration_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&ConfigureParams.System.nCpuLevel, sizeof(ConfigureParams.System.nCpuLevel));
 	MemorySnapShot_Store(&ConfigureParams.System.nCpuFreq, sizeof(ConfigureParams.System.nCpuFreq));
 	MemorySnapShot_Store(&ConfigureParams.System.bCompatibleCpu, sizeof(ConfigureParams.System.bCompatibleCpu));
+	MemorySnapShot_Store(&ConfigureParams.System.bFastTiming, sizeof(ConfigureParams.System.bFastTiming));
 	MemorySnapShot_Store(&ConfigureParams.System.nMachineType, sizeof(ConfigureParams.System.nMachineType));
 	MemorySnapShot_Store(&ConfigureParams.System.bBlitter, sizeof(ConfigureParams.System.bBlitter));
 	MemorySnapShot_Store(&ConfigureParams.System.nDSPType, sizeof(ConfigureParams.System.nDSPType));
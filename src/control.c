@@ -155,6 +155,38 @@ static bool Control_InsertEvent(const char *event)
 	return false;	
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue given text to be typed on the emulated keyboard as fast as
+ * the emulated machine reads the keys.  As commands are separated by
+ * newlines, "\n" in the text is typed as return.
+ * Return false if all of it didn't fit to the key queue, true otherwise
+ */
+static bool Control_InsertText(char *text)
+{
+	char *src, *dst;
+	int len, queued;
+
+	for (src = dst = text; *src; src++, dst++) {
+		if (src[0] == '\\' && src[1] == 'n') {
+			*dst = '\n';
+			src++;
+		} else {
+			*dst = *src;
+		}
+	}
+	*dst = '\0';
+
+	len = strlen(text);
+	queued = Keymap_QueueString(text);
+	if (queued < len) {
+		fprintf(stderr, "ERROR: key queue full, only %d/%d characters of text queued\n",
+			queued, len);
+		return false;
+	}
+	return true;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Parse device name and enable/disable/toggle & init/uninit it according
@@ -277,6 +309,7 @@ static bool Control_Usage(const char *cmd)
 		"Supported commands are:\n"
 		"- hatari-debug <Debug UI command>\n"
 		"- hatari-event <event to simulate>\n"
+		"- hatari-text <text to type>\n"
 		"- hatari-option <command line options>\n"
 		"- hatari-enable/disable/toggle <device name>\n"
 		"- hatari-path <config name> <new path>\n"
@@ -329,6 +362,8 @@ void Control_ProcessBuffer(const char *orig)
 				ok = Shortcut_Invoke(arg);
 			} else if (strcmp(cmd, "hatari-event") == 0) {
 				ok = Control_InsertEvent(arg);
+			} else if (strcmp(cmd, "hatari-text") == 0) {
+				ok = Control_InsertText(arg);
 			} else if (strcmp(cmd, "hatari-path") == 0) {
 				ok = Control_SetPath(arg);
 			} else if (strcmp(cmd, "hatari-enable") == 0) {
@@ -0,0 +1,561 @@
+/*
+  Hatari - controlBin.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Binary control protocol server, for test automation which injects long
+  input scripts and checks emulated memory, where the line based commands
+  of the control socket would be the bottleneck.  It's served on a local
+  TCP port with non-blocking sockets: all complete requests received by
+  the VBL are handled at once and their replies sent with a single write.
+
+  All values are big endian.  Requests and replies have an 8 byte header:
+    u32 payload length, u8 command, u8 status, u16 tag
+  followed by the payload.  Status is zero in requests; replies have
+  the request command with bit 7 set, its tag, and one of the
+  CTRLBIN_STATUS_* values.  Commands are:
+  - EVENTS: N * { u32 VBL, u8 type, u8 code, s8 dx, s8 dy }
+    queue key and mouse events to be injected at the given VBL
+    (or immediately if it's already past).  Types are KEYDOWN and
+    KEYUP (code is ST scancode) and MOUSE (code bit 0 / 1 are left /
+    right button state, dx / dy relative motion).  Reply: u32 VBL
+  - READ: u32 address, u32 length.  Reply: memory contents
+  - WRITE: u32 address, data.  Writes data to ST RAM
+  - SNAPSHOT: file name, or nothing for the configured one.
+    Saves memory snapshot
+  - FRAMEHASH: no payload.  Reply: u32 VBL, u64 FNV-1a hash of the
+    last rendered frame, u16 width, u16 height
+  - TEXT: ASCII text, queued to be typed as fast as the emulated
+    machine reads the keys.  Reply: u32 number of characters queued,
+    the rest should be sent again later
+*/
+const char ControlBin_fileid[] = "Hatari controlBin.c : " __DATE__ " " __TIME__;
+
+#include "config.h"
+
+#if HAVE_TCP_SOCKETS
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include "main.h"
+#include "configuration.h"
+#include "controlBin.h"
+#include "ikbd.h"
+#include "keymap.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "screen.h"
+#include "stMemory.h"
+#include "video.h"
+
+#define CTRLBIN_HEADER		8
+#define CTRLBIN_PAYLOAD_MAX	(16*1024*1024)	/* whole ST address space */
+#define CTRLBIN_EVENTS_MAX	4096
+
+enum {
+	CTRLBIN_EVENTS = 1,
+	CTRLBIN_READ,
+	CTRLBIN_WRITE,
+	CTRLBIN_SNAPSHOT,
+	CTRLBIN_FRAMEHASH,
+	CTRLBIN_TEXT
+};
+
+enum {
+	CTRLBIN_STATUS_OK,
+	CTRLBIN_STATUS_UNKNOWN,		/* unknown command */
+	CTRLBIN_STATUS_INVALID,		/* invalid payload or address range */
+	CTRLBIN_STATUS_FULL		/* event queue full, retry later */
+};
+
+enum {
+	CTRLBIN_EV_KEYDOWN = 1,
+	CTRLBIN_EV_KEYUP,
+	CTRLBIN_EV_MOUSE
+};
+
+typedef struct {
+	Uint32 vbl;
+	Uint8 type;
+	Uint8 code;
+	Sint8 dx, dy;
+} ctrlbin_event_t;
+
+/* buffer which grows as needed */
+typedef struct {
+	Uint8 *data;
+	size_t len, size;
+} ctrlbin_buf_t;
+
+static int ListenSocket = -1;
+static int ClientSocket = -1;
+
+static ctrlbin_buf_t RecvBuf, SendBuf;
+
+/* ring buffer of queued events, in the order they were received */
+static ctrlbin_event_t Events[CTRLBIN_EVENTS_MAX];
+static int EventHead, EventCount;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Make room for 'len' more bytes in given buffer and return pointer
+ * to them, or NULL if out of memory
+ */
+static Uint8 *ControlBin_Reserve(ctrlbin_buf_t *buf, size_t len)
+{
+	Uint8 *data;
+	size_t size;
+
+	if (buf->len + len > buf->size)
+	{
+		size = buf->size ? buf->size : 4096;
+		while (size < buf->len + len)
+			size *= 2;
+		data = realloc(buf->data, size);
+		if (!data)
+			return NULL;
+		buf->data = data;
+		buf->size = size;
+	}
+	return buf->data + buf->len;
+}
+
+static Uint32 ControlBin_Get32(const Uint8 *p)
+{
+	return (Uint32)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static void ControlBin_Put32(Uint8 *p, Uint32 value)
+{
+	p[0] = value >> 24;
+	p[1] = value >> 16;
+	p[2] = value >> 8;
+	p[3] = value;
+}
+
+/**
+ * Close the client connection and forget its pending data and events
+ */
+static void ControlBin_Close(void)
+{
+	close(ClientSocket);
+	ClientSocket = -1;
+	RecvBuf.len = SendBuf.len = 0;
+	EventCount = 0;
+	Log_Printf(LOG_INFO, "Binary control client disconnected.\n");
+}
+
+/**
+ * Start reply with given payload length to the request with given header,
+ * return pointer to its payload, or NULL if out of memory
+ */
+static Uint8 *ControlBin_Reply(const Uint8 *request, Uint8 status, Uint32 len)
+{
+	Uint8 *reply = ControlBin_Reserve(&SendBuf, CTRLBIN_HEADER + len);
+
+	if (!reply)
+		return NULL;
+	ControlBin_Put32(reply, len);
+	reply[4] = request[4] | 0x80;
+	reply[5] = status;
+	reply[6] = request[6];
+	reply[7] = request[7];
+	SendBuf.len += CTRLBIN_HEADER + len;
+	return reply + CTRLBIN_HEADER;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Inject given event to the emulation
+ */
+static void ControlBin_InjectEvent(const ctrlbin_event_t *ev)
+{
+	switch (ev->type)
+	{
+	case CTRLBIN_EV_KEYDOWN:
+	case CTRLBIN_EV_KEYUP:
+		IKBD_PressSTKey(ev->code, ev->type == CTRLBIN_EV_KEYDOWN);
+		break;
+	case CTRLBIN_EV_MOUSE:
+		if (ev->code & 1)
+			Keyboard.bLButtonDown |= BUTTON_MOUSE;
+		else
+			Keyboard.bLButtonDown &= ~BUTTON_MOUSE;
+		if (ev->code & 2)
+			Keyboard.bRButtonDown |= BUTTON_MOUSE;
+		else
+			Keyboard.bRButtonDown &= ~BUTTON_MOUSE;
+		KeyboardProcessor.Mouse.dx += ev->dx;
+		KeyboardProcessor.Mouse.dy += ev->dy;
+		IKBD_InputChanged();
+		break;
+	}
+}
+
+/**
+ * Inject the queued events which are due at this VBL.  Events are
+ * kept in the order they were sent, so that later ones wait for the
+ * earlier ones.
+ */
+static void ControlBin_InjectDueEvents(void)
+{
+	while (EventCount && (Sint32)(Events[EventHead].vbl - nVBLs) <= 0)
+	{
+		ControlBin_InjectEvent(&Events[EventHead]);
+		EventHead = (EventHead + 1) % CTRLBIN_EVENTS_MAX;
+		EventCount--;
+	}
+}
+
+/**
+ * Handle EVENTS request: queue the events
+ */
+static void ControlBin_QueueEvents(const Uint8 *request, const Uint8 *payload, Uint32 len)
+{
+	ctrlbin_event_t *ev;
+	Uint32 count = len / 8, i;
+	Uint8 *reply;
+
+	if (len % 8)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	if (EventCount + count > CTRLBIN_EVENTS_MAX)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_FULL, 0);
+		return;
+	}
+	for (i = 0; i < count; i++, payload += 8)
+	{
+		ev = &Events[(EventHead + EventCount++) % CTRLBIN_EVENTS_MAX];
+		ev->vbl = ControlBin_Get32(payload);
+		ev->type = payload[4];
+		ev->code = payload[5];
+		ev->dx = (Sint8)payload[6];
+		ev->dy = (Sint8)payload[7];
+	}
+	/* the ones for this VBL go in right away */
+	ControlBin_InjectDueEvents();
+
+	reply = ControlBin_Reply(request, CTRLBIN_STATUS_OK, 4);
+	if (reply)
+		ControlBin_Put32(reply, nVBLs);
+}
+
+/**
+ * Handle READ request, straight from ST RAM when possible,
+ * otherwise from ROM / IO memory
+ */
+static void ControlBin_ReadMemory(const Uint8 *request, const Uint8 *payload, Uint32 len)
+{
+	Uint32 addr, size, i;
+	Uint8 *reply;
+
+	if (len != 8)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	addr = ControlBin_Get32(payload);
+	size = ControlBin_Get32(payload + 4);
+	if (size > CTRLBIN_PAYLOAD_MAX ||
+	    !((addr < STRamEnd && size <= STRamEnd - addr) ||
+	      (addr + size > addr && STMemory_ValidArea(addr, size))))
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	reply = ControlBin_Reply(request, CTRLBIN_STATUS_OK, size);
+	if (!reply)
+		return;
+	if (addr < STRamEnd && size <= STRamEnd - addr)
+	{
+		memcpy(reply, &STRam[addr], size);
+		return;
+	}
+	for (i = 0; i < size; i++)
+		reply[i] = STMemory_ReadByte(addr + i);
+}
+
+/**
+ * Handle WRITE request, to ST RAM
+ */
+static void ControlBin_WriteMemory(const Uint8 *request, const Uint8 *payload, Uint32 len)
+{
+	Uint32 addr, size;
+
+	if (len < 4)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	addr = ControlBin_Get32(payload);
+	size = len - 4;
+	if (addr >= STRamEnd || size > STRamEnd - addr)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	memcpy(&STRam[addr], payload + 4, size);
+	STMemory_SetDirtyArea(addr, size);
+	ControlBin_Reply(request, CTRLBIN_STATUS_OK, 0);
+}
+
+/**
+ * Handle SNAPSHOT request
+ */
+static void ControlBin_Snapshot(const Uint8 *request, const Uint8 *payload, Uint32 len)
+{
+	char filename[FILENAME_MAX];
+
+	if (len >= sizeof(filename))
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	if (len)
+	{
+		memcpy(filename, payload, len);
+		filename[len] = '\0';
+	}
+	else
+		strcpy(filename, ConfigureParams.Memory.szMemoryCaptureFileName);
+
+	MemorySnapShot_Capture(filename, false);
+	ControlBin_Reply(request, CTRLBIN_STATUS_OK, 0);
+}
+
+/**
+ * Handle FRAMEHASH request
+ */
+static void ControlBin_FrameHash(const Uint8 *request)
+{
+	Uint64 hash;
+	Uint8 *reply;
+	int w, h;
+
+	hash = Screen_GetFrameHash(&w, &h);
+	reply = ControlBin_Reply(request, CTRLBIN_STATUS_OK, 16);
+	if (!reply)
+		return;
+	ControlBin_Put32(reply, nVBLs);
+	ControlBin_Put32(reply + 4, hash >> 32);
+	ControlBin_Put32(reply + 8, hash);
+	reply[12] = w >> 8;
+	reply[13] = w;
+	reply[14] = h >> 8;
+	reply[15] = h;
+}
+
+/**
+ * Handle TEXT request: queue the text to be typed
+ */
+static void ControlBin_QueueText(const Uint8 *request, const Uint8 *payload, Uint32 len)
+{
+	char *text;
+	Uint8 *reply;
+	int queued;
+
+	text = malloc(len + 1);
+	if (!text)
+	{
+		ControlBin_Reply(request, CTRLBIN_STATUS_INVALID, 0);
+		return;
+	}
+	memcpy(text, payload, len);
+	text[len] = '\0';
+	queued = Keymap_QueueString(text);
+	free(text);
+
+	reply = ControlBin_Reply(request, CTRLBIN_STATUS_OK, 4);
+	if (reply)
+		ControlBin_Put32(reply, queued);
+}
+
+/**
+ * Handle all complete requests in the receive buffer.
+ * Return false if the client sent something invalid.
+ */
+static bool ControlBin_HandleRequests(void)
+{
+	const Uint8 *request, *payload;
+	size_t pos = 0;
+	Uint32 len;
+
+	while (RecvBuf.len - pos >= CTRLBIN_HEADER)
+	{
+		request = RecvBuf.data + pos;
+		len = ControlBin_Get32(request);
+		if (len > CTRLBIN_PAYLOAD_MAX + 4)
+			return false;
+		if (RecvBuf.len - pos < CTRLBIN_HEADER + len)
+			break;
+		payload = request + CTRLBIN_HEADER;
+
+		switch (request[4])
+		{
+		case CTRLBIN_EVENTS:
+			ControlBin_QueueEvents(request, payload, len);
+			break;
+		case CTRLBIN_READ:
+			ControlBin_ReadMemory(request, payload, len);
+			break;
+		case CTRLBIN_WRITE:
+			ControlBin_WriteMemory(request, payload, len);
+			break;
+		case CTRLBIN_SNAPSHOT:
+			ControlBin_Snapshot(request, payload, len);
+			break;
+		case CTRLBIN_FRAMEHASH:
+			ControlBin_FrameHash(request);
+			break;
+		case CTRLBIN_TEXT:
+			ControlBin_QueueText(request, payload, len);
+			break;
+		default:
+			ControlBin_Reply(request, CTRLBIN_STATUS_UNKNOWN, 0);
+			break;
+		}
+		pos += CTRLBIN_HEADER + len;
+	}
+	/* keep the incomplete request for the next VBL */
+	RecvBuf.len -= pos;
+	memmove(RecvBuf.data, RecvBuf.data + pos, RecvBuf.len);
+	return true;
+}
+
+/**
+ * Read everything the client has sent so far.
+ * Return false if the connection was closed.
+ */
+static bool ControlBin_Receive(void)
+{
+	ssize_t bytes;
+	Uint8 *dst;
+
+	/* leave the rest for next VBL once there's a maximum size request */
+	while (RecvBuf.len < CTRLBIN_HEADER + CTRLBIN_PAYLOAD_MAX + 4)
+	{
+		dst = ControlBin_Reserve(&RecvBuf, 65536);
+		if (!dst)
+			return false;
+		bytes = read(ClientSocket, dst, 65536);
+		if (bytes > 0)
+		{
+			RecvBuf.len += bytes;
+			continue;
+		}
+		if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			return true;
+		if (bytes < 0 && errno == EINTR)
+			continue;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Send as much of the pending replies as the socket takes without
+ * blocking.  Return false if the connection was closed.
+ */
+static bool ControlBin_Send(void)
+{
+	ssize_t bytes;
+
+	if (!SendBuf.len)
+		return true;
+	bytes = write(ClientSocket, SendBuf.data, SendBuf.len);
+	if (bytes < 0)
+		return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+	SendBuf.len -= bytes;
+	memmove(SendBuf.data, SendBuf.data + bytes, SendBuf.len);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Accept new connection, handle the requests received from the
+ * connected client and inject its events due at this VBL.
+ * Called once a VBL.
+ */
+void ControlBin_Check(void)
+{
+	int sock, one = 1;
+
+	if (ListenSocket < 0)
+		return;
+
+	if (ClientSocket < 0)
+	{
+		sock = accept(ListenSocket, NULL, NULL);
+		if (sock < 0)
+			return;
+		fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+		setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+		ClientSocket = sock;
+		Log_Printf(LOG_INFO, "Binary control client connected.\n");
+	}
+
+	if (!ControlBin_Receive() || !ControlBin_HandleRequests() ||
+	    !ControlBin_Send())
+	{
+		ControlBin_Close();
+		return;
+	}
+	ControlBin_InjectDueEvents();
+}
+
+/**
+ * Start listening for binary control connections on given local
+ * TCP port.  Return NULL for success, otherwise an error string
+ */
+const char *ControlBin_SetPort(int port)
+{
+	struct sockaddr_in address;
+	int sock, one = 1;
+
+	if (port <= 0 || port > 0xffff)
+		return "Invalid TCP port number";
+
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0)
+	{
+		perror("socket creation");
+		return "Can't create TCP socket";
+	}
+	setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+	/* only local connections, the protocol has no authentication */
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+	if (bind(sock, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+	    listen(sock, 1) < 0)
+	{
+		perror("Binary control socket");
+		close(sock);
+		return "Can't listen on given TCP port";
+	}
+	fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+
+	if (ListenSocket >= 0)
+		close(ListenSocket);
+	ListenSocket = sock;
+	Log_Printf(LOG_INFO, "Waiting for binary control connections on port %d.\n", port);
+	return NULL;
+}
+
+#endif /* HAVE_TCP_SOCKETS */
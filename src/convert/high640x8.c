@@ -14,8 +14,9 @@ static void ConvertHighRes_640x8Bit(void)
 	Uint32 *esi;
 	Uint16 eax, ebx;
 	int y, x, update;
+	int first = -1, last = -1;
 
-	edi = (Uint16 *)pSTScreen;        /* ST format screen */
+	edi = (Uint16 *)pSTScreenSrc;     /* ST format screen */
 	ebp = (Uint16 *)pSTScreenCopy;    /* Previous ST format screen */
 	esi = (Uint32 *)pPCScreenDest;    /* PC format screen */
 
@@ -34,6 +35,9 @@ static void ConvertHighRes_640x8Bit(void)
 			if (update || ebx != *ebp)  /* Does differ? */
 			{
 				bScreenContentsChanged = true;
+				if (first < 0)
+					first = y;
+				last = y;
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 				/* Plot in 'right-order' on big endian systems */
@@ -65,4 +69,13 @@ static void ConvertHighRes_640x8Bit(void)
 
 		esi += PCScreenBytesPerLine/4 - 40*4;           /* advance to start of next line */
 	}
+
+	/* Mono isn't limited to changed lines before conversion, so limit
+	 * the host screen area to be updated to the lines that did change
+	 */
+	if (!update && first >= 0)
+	{
+		STDirtyRect.y = PCScreenOffsetY + first - STScreenStartHorizLine;
+		STDirtyRect.h = last + 1 - first;
+	}
 }
@@ -7,68 +7,87 @@
   Screen Conversion, Low Res to 320x16Bit
 */
 
-static void ConvertLowRes_320x16Bit(void)
+CONVERT_INLINE void Line_ConvertLowRes_320x16Bit_T(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax,
+                                                   int nWidthBytes)
 {
-	Uint32 *edi, *ebp;
-	Uint16 *esi;
-	Uint32 eax, edx;
+#ifndef CONVERT_LOW_SIMD
+	Uint32 edx;
+#endif
 	Uint32 ebx, ecx;
-	int y, x, update;
+	int x, update;
 
-	Convert_StartFrame();            /* Start frame, track palettes */
+	x = nWidthBytes>>3;        /* Amount to draw across in 16-pixels (8 bytes) */
+	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
 
-	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
+	do    /* x-loop */
 	{
+		/* Do 16 pixels at one time */
+		ebx = *edi;
+		ecx = *(edi+1);
 
-		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);       /* ST format screen 4-plane 16 colors */
-		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);   /* Previous ST format screen */
-		esi = (Uint16 *)pPCScreenDest;                    /* PC format screen */
-
-		update = AdjustLinePaletteRemap(y) & PALETTEMASK_UPDATEMASK;
-
-		x = STScreenWidthBytes>>3; /* Amount to draw across in 16-pixels (8 bytes) */
-
-		do    /* x-loop */
+		if (update || ebx!=*ebp || ecx!=*(ebp+1))    /* Does differ? */
 		{
-			/* Do 16 pixels at one time */
-			ebx = *edi;
-			ecx = *(edi+1);
+			/* copy word */
 
-			if (update || ebx!=*ebp || ecx!=*(ebp+1))    /* Does differ? */
-			{
-				/* copy word */
-
-				bScreenContentsChanged = true;
+			bScreenContentsChanged = true;
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
-				/* Plot pixels */
-				LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
-				PLOT_LOW_320_16BIT(12) ;
-				LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
-				PLOT_LOW_320_16BIT(4) ;
-				LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
-				PLOT_LOW_320_16BIT(8) ;
-				LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
-				PLOT_LOW_320_16BIT(0) ;
+			/* Plot pixels */
+			LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
+			PLOT_LOW_320_16BIT(12) ;
+			LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
+			PLOT_LOW_320_16BIT(4) ;
+			LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
+			PLOT_LOW_320_16BIT(8) ;
+			LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
+			PLOT_LOW_320_16BIT(0) ;
+#elif defined(CONVERT_LOW_SIMD)
+			Convert_Low_320x16Bit(edi, esi);
 #else
-				/* Plot pixels */
-				LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
-				PLOT_LOW_320_16BIT(4) ;
-				LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
-				PLOT_LOW_320_16BIT(12) ;
-				LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
-				PLOT_LOW_320_16BIT(0) ;
-				LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
-				PLOT_LOW_320_16BIT(8) ;
+			/* Plot pixels */
+			LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
+			PLOT_LOW_320_16BIT(4) ;
+			LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
+			PLOT_LOW_320_16BIT(12) ;
+			LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
+			PLOT_LOW_320_16BIT(0) ;
+			LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
+			PLOT_LOW_320_16BIT(8) ;
 #endif
-			}
-
-			esi += 16;                        /* Next PC pixels */
-			edi += 2;                         /* Next ST pixels */
-			ebp += 2;                         /* Next ST copy pixels */
 		}
-		while (--x);                      /* Loop on X */
+
+		esi += 16;                        /* Next PC pixels */
+		edi += 2;                         /* Next ST pixels */
+		ebp += 2;                         /* Next ST copy pixels */
+	}
+	while (--x);                      /* Loop on X */
+}
+
+static void Line_ConvertLowRes_320x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax)
+{
+	Line_ConvertLowRes_320x16Bit_T(edi, ebp, esi, eax, STScreenWidthBytes);
+}
+
+
+CONVERT_INLINE void ConvertLowRes_320x16Bit_T(int nWidthBytes)
+{
+	Uint32 *edi, *ebp;
+	Uint16 *esi;
+	Uint32 eax;
+	int y;
+
+	Convert_StartFrame();            /* Start frame, track palettes */
+
+	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
+	{
+
+		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);    /* ST format screen 4-plane 16 colors */
+		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);   /* Previous ST format screen */
+		esi = (Uint16 *)pPCScreenDest;                    /* PC format screen */
+
+		AdjustLinePaletteRemap(y);
+		Line_ConvertLowRes_320x16Bit_T(edi, ebp, esi, eax, nWidthBytes);
 
 		/* Offset to next line: */
 		pPCScreenDest = (((Uint8 *)pPCScreenDest)+PCScreenBytesPerLine);
@@ -29,12 +29,29 @@ static void ConvertLowRes_320x16Bit_Spec(void)
 
 		/* Get screen addresses, 'edi'-ST screen, 'ebp'-Previous ST screen, 'esi'-PC screen */
 		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);       /* ST format screen 4-plane 16 colors */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);    /* ST format screen 4-plane 16 colors */
 		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);   /* Previous ST format screen */
 		esi = (Uint16 *)pPCScreenDest;                    /* PC format screen */
 
 		x = STScreenWidthBytes >> 3;    /* Amount to draw across in 16-pixels (8 bytes) */
 
+		if (Convert_Spec512LineUnchanged(y, edi))
+		{
+			/* Still on the host screen from the previous frame */
+			Spec512_EndScanLine();
+			pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine);
+			continue;
+		}
+		if (!Spec512_LineChangesPalette(x * 4))
+		{
+			/* Palette changes only in the borders, convert as a normal line */
+			ScrUpdateFlag = PALETTEMASK_UPDATEFULL;
+			Line_ConvertLowRes_320x16Bit(edi, ebp, esi, eax);
+			Spec512_EndScanLine();
+			pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine);
+			continue;
+		}
+
 		do  /* x-loop */
 		{
 			ebx = *edi;                 /* Do 16 pixels at one time */
@@ -93,6 +110,4 @@ static void ConvertLowRes_320x16Bit_Spec(void)
 		/* Offset to next line */
 		pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine);
 	}
-
-	bScreenContentsChanged = true;
 }
@@ -7,13 +7,16 @@
   Screen Conversion, Low Res to 640x16Bit
 */
 
-static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax)
+CONVERT_INLINE void Line_ConvertLowRes_640x16Bit_T(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax,
+                                                   int nWidthBytes, bool bDoubleY)
 {
+#ifndef CONVERT_LOW_SIMD
 	Uint32 edx;
+#endif
 	Uint32 ebx, ecx;
 	int x, update, Screen4BytesPerLine;
 
-	x = STScreenWidthBytes>>3;   /* Amount to draw across in 16-pixels(8 bytes) */
+	x = nWidthBytes>>3;          /* Amount to draw across in 16-pixels(8 bytes) */
 	Screen4BytesPerLine = PCScreenBytesPerLine/4;
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
 
@@ -31,7 +34,7 @@ static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi,
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 			/* Plot in 'right-order' on big endian systems */
-			if (!bScrDoubleY)                     /* Double on Y? */
+			if (!bDoubleY)                        /* Double on Y? */
 			{
 				/* Plot pixels */
 				LOW_BUILD_PIXELS_0 ;              /* Generate 'ecx' as pixels [12,13,14,15] */
@@ -55,9 +58,13 @@ static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi,
 				LOW_BUILD_PIXELS_3 ;              /* Generate 'ecx' as pixels [0,1,2,3] */
 				PLOT_LOW_640_16BIT_DOUBLE_Y(0)
 			}
+#elif defined(CONVERT_LOW_SIMD)
+			Convert_Low_320x32Bit(edi, esi);
+			if (bDoubleY)                       /* Double on Y? */
+				memcpy(esi+Screen4BytesPerLine, esi, 16*sizeof(Uint32));
 #else
 			/* Plot in 'wrong-order', as ebx is 68000 endian */
-			if (!bScrDoubleY)                  /* Double on Y? */
+			if (!bDoubleY)                     /* Double on Y? */
 			{
 				/* Plot pixels */
 				LOW_BUILD_PIXELS_0 ;              /* Generate 'ecx' as pixels [4,5,6,7] */
@@ -93,7 +100,12 @@ static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi,
 
 }
 
-static void ConvertLowRes_640x16Bit(void)
+static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax)
+{
+	Line_ConvertLowRes_640x16Bit_T(edi, ebp, esi, eax, STScreenWidthBytes, bScrDoubleY);
+}
+
+CONVERT_INLINE void ConvertLowRes_640x16Bit_T(int nWidthBytes, bool bDoubleY)
 {
 	Uint32 *edi, *ebp;
 	Uint32 *esi;
@@ -107,14 +119,14 @@ static void ConvertLowRes_640x16Bit(void)
 
 		/* Get screen addresses */
 		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);        /* ST format screen 4-plane 16 colors */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);     /* ST format screen 4-plane 16 colors */
 		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);    /* Previous ST format screen */
 		esi = (Uint32 *)pPCScreenDest;                     /* PC format screen */
 
 		if (AdjustLinePaletteRemap(y) & 0x00030000)        /* Change palette table */
-			Line_ConvertMediumRes_640x16Bit(edi, ebp, (Uint16 *)esi, eax);
+			Line_ConvertMediumRes_640x16Bit_T(edi, ebp, (Uint16 *)esi, eax, nWidthBytes, bDoubleY);
 		else
-			Line_ConvertLowRes_640x16Bit(edi, ebp, esi, eax);
+			Line_ConvertLowRes_640x16Bit_T(edi, ebp, esi, eax, nWidthBytes, bDoubleY);
 
 		pPCScreenDest = (((Uint8 *)pPCScreenDest)+PCScreenBytesPerLine*2);  /* Offset to next line */
 	}
@@ -19,21 +19,19 @@ static void ConvertLowRes_640x32Bit_Spec(void)
 	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
 	{
 		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);        /* ST format screen 4-plane 16 colors */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);     /* ST format screen 4-plane 16 colors */
 		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);    /* Previous ST format screen */
 		esi = (Uint32 *)pPCScreenDest;                     /* PC format screen */
 
-		Line_ConvertLowRes_640x32Bit_Spec(edi, ebp, esi, eax);
+		Line_ConvertLowRes_640x32Bit_Spec(edi, ebp, esi, eax, y);
 
 		/* Offset to next line (double on Y) */
 		pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine * 2);
 	}
-
-        bScreenContentsChanged = true;
 }
 
 
-static void Line_ConvertLowRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax)
+static void Line_ConvertLowRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax, int y)
 {
 	Uint32 ebx, ecx, edx;
 	int x, Screen4BytesPerLine;
@@ -49,6 +47,22 @@ static void Line_ConvertLowRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *
 	x = STScreenWidthBytes >> 3;   /* Amount to draw across in 16-pixels (8 bytes) */
 	Screen4BytesPerLine = PCScreenBytesPerLine/4;
 
+	if (Convert_Spec512LineUnchanged(y, edi))
+	{
+		/* Still on the host screen from the previous frame */
+		Spec512_EndScanLine();
+		return;
+	}
+
+	if (!Spec512_LineChangesPalette(x * 4))
+	{
+		/* Palette changes only in the borders, convert as a normal line */
+		ScrUpdateFlag = PALETTEMASK_UPDATEFULL;
+		Line_ConvertLowRes_640x32Bit(edi, ebp, esi, eax);
+		Spec512_EndScanLine();
+		return;
+	}
+
 	do  /* x-loop */
 	{
 		ebx = *edi;                 /* Do 16 pixels at one time */
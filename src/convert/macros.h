@@ -546,4 +546,145 @@ static const Uint32 Remap_1_Plane[16] = {
 #endif /* __i386__ */
 
 
+/*----------------------------------------------------------------------*/
+/* Vector versions of the 16 and 32 bit low resolution conversion.
+ * The 4 planes of 16 pixels are turned into 16 bytes of colour indexes with
+ * vector compares instead of the Remap tables. Colours are then looked up
+ * with table lookup instructions on AArch64 NEON, or with scalar loads on
+ * x86 (SSE2 has no byte shuffle). SSE2 and NEON are always available on
+ * x86-64 and AArch64, so there's no need for runtime checks.
+ * (The 640x16 bit conversion uses the 320x32 bit one, as its palette
+ * entries are pairs of 16 bit pixels.)
+ */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN && (defined(__SSE2__) || (defined(__aarch64__) && defined(__ARM_NEON)))
+#define CONVERT_LOW_SIMD 1
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+/* Convert 16 pixels at 'pixels' (4 big endian planes) to colour indexes */
+static inline void Convert_LowIndexes(const Uint32 *pixels, Uint8 *idx)
+{
+	const __m128i bits = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, (char)128,
+	                                  1, 2, 4, 8, 16, 32, 64, (char)128);
+	__m128i v, b01, b23, plane, sum;
+
+	v = _mm_loadl_epi64((const __m128i *)pixels);
+	v = _mm_unpacklo_epi8(v, v);		/* each byte twice */
+	b01 = _mm_unpacklo_epi16(v, v);		/* bytes 0-3, 4 times */
+	b23 = _mm_unpackhi_epi16(v, v);		/* bytes 4-7, 4 times */
+
+	/* byte N of plane P gives the bit of pixel N */
+	plane = _mm_unpacklo_epi32(b01, b01);
+	sum = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(plane, bits), bits), _mm_set1_epi8(1));
+	plane = _mm_unpackhi_epi32(b01, b01);
+	sum = _mm_or_si128(sum, _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(plane, bits), bits), _mm_set1_epi8(2)));
+	plane = _mm_unpacklo_epi32(b23, b23);
+	sum = _mm_or_si128(sum, _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(plane, bits), bits), _mm_set1_epi8(4)));
+	plane = _mm_unpackhi_epi32(b23, b23);
+	sum = _mm_or_si128(sum, _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(plane, bits), bits), _mm_set1_epi8(8)));
+
+	_mm_storeu_si128((__m128i *)idx, sum);
+}
+
+static inline void Convert_Low_320x32Bit(const Uint32 *pixels, Uint32 *esi)
+{
+	Uint8 idx[16];
+	int i;
+
+	Convert_LowIndexes(pixels, idx);
+	for (i = 0; i < 16; i++)
+		esi[i] = STRGBPalette[idx[i]];
+}
+
+static inline void Convert_Low_320x16Bit(const Uint32 *pixels, Uint16 *esi)
+{
+	Uint8 idx[16];
+	int i;
+
+	Convert_LowIndexes(pixels, idx);
+	for (i = 0; i < 16; i++)
+		esi[i] = (Uint16)STRGBPalette[idx[i]];
+}
+
+static inline void Convert_Low_640x32Bit(const Uint32 *pixels, Uint32 *esi)
+{
+	Uint8 idx[16];
+	int i;
+
+	Convert_LowIndexes(pixels, idx);
+	for (i = 0; i < 16; i++)
+		esi[2*i] = esi[2*i+1] = STRGBPalette[idx[i]];
+}
+
+#else /* NEON */
+#include <arm_neon.h>
+
+/* Convert 16 pixels at 'pixels' (4 big endian planes) to colour indexes */
+static inline uint8x16_t Convert_LowIndexes(const Uint32 *pixels)
+{
+	static const Uint8 bits[16] = { 128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1 };
+	static const Uint8 planes[4][16] = {
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 },
+		{ 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 },
+		{ 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5 },
+		{ 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7 }
+	};
+	uint8x16_t v, mask, sum;
+
+	v = vcombine_u8(vld1_u8((const Uint8 *)pixels), vdup_n_u8(0));
+	mask = vld1q_u8(bits);
+
+	/* byte N of plane P gives the bit of pixel N */
+	sum = vandq_u8(vtstq_u8(vqtbl1q_u8(v, vld1q_u8(planes[0])), mask), vdupq_n_u8(1));
+	sum = vorrq_u8(sum, vandq_u8(vtstq_u8(vqtbl1q_u8(v, vld1q_u8(planes[1])), mask), vdupq_n_u8(2)));
+	sum = vorrq_u8(sum, vandq_u8(vtstq_u8(vqtbl1q_u8(v, vld1q_u8(planes[2])), mask), vdupq_n_u8(4)));
+	sum = vorrq_u8(sum, vandq_u8(vtstq_u8(vqtbl1q_u8(v, vld1q_u8(planes[3])), mask), vdupq_n_u8(8)));
+	return sum;
+}
+
+/* Look up the 4 bytes of the 16 palette colours for the indexes, and store them interleaved */
+static inline void Convert_Low_Store32(Uint32 *esi, uint8x16x4_t pal, uint8x16_t idx)
+{
+	uint8x16x4_t col;
+
+	col.val[0] = vqtbl1q_u8(pal.val[0], idx);
+	col.val[1] = vqtbl1q_u8(pal.val[1], idx);
+	col.val[2] = vqtbl1q_u8(pal.val[2], idx);
+	col.val[3] = vqtbl1q_u8(pal.val[3], idx);
+	vst4q_u8((Uint8 *)esi, col);
+}
+
+static inline void Convert_Low_Store16(Uint16 *esi, uint8x16x4_t pal, uint8x16_t idx)
+{
+	uint8x16x2_t col;
+
+	col.val[0] = vqtbl1q_u8(pal.val[0], idx);
+	col.val[1] = vqtbl1q_u8(pal.val[1], idx);
+	vst2q_u8((Uint8 *)esi, col);
+}
+
+static inline void Convert_Low_320x32Bit(const Uint32 *pixels, Uint32 *esi)
+{
+	Convert_Low_Store32(esi, vld4q_u8((const Uint8 *)STRGBPalette), Convert_LowIndexes(pixels));
+}
+
+static inline void Convert_Low_320x16Bit(const Uint32 *pixels, Uint16 *esi)
+{
+	Convert_Low_Store16(esi, vld4q_u8((const Uint8 *)STRGBPalette), Convert_LowIndexes(pixels));
+}
+
+static inline void Convert_Low_640x32Bit(const Uint32 *pixels, Uint32 *esi)
+{
+	uint8x16x4_t pal = vld4q_u8((const Uint8 *)STRGBPalette);
+	uint8x16_t idx = Convert_LowIndexes(pixels);
+
+	Convert_Low_Store32(esi, pal, vzip1q_u8(idx, idx));
+	Convert_Low_Store32(esi + 16, pal, vzip2q_u8(idx, idx));
+}
+
+#endif /* __SSE2__ */
+#endif /* CONVERT_LOW_SIMD */
+
+
 #endif /* HATARI_CONVERTMACROS_H */
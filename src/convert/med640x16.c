@@ -7,7 +7,7 @@
   Screen Conversion, Medium Res to 640x16Bit
 */
 
-static void ConvertMediumRes_640x16Bit(void)
+CONVERT_INLINE void ConvertMediumRes_640x16Bit_T(int nWidthBytes, bool bDoubleY)
 {
 	Uint32 *edi, *ebp;
 	Uint16 *esi;
@@ -20,14 +20,14 @@ static void ConvertMediumRes_640x16Bit(void)
 	{
 
 		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);        /* ST format screen 4-plane 16 colors */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);     /* ST format screen 4-plane 16 colors */
 		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);    /* Previous ST format screen */
 		esi = (Uint16 *)pPCScreenDest;                     /* PC format screen */
 
 		if (AdjustLinePaletteRemap(y) & 0x00030000)        /* Change palette table */
-			Line_ConvertMediumRes_640x16Bit(edi, ebp, esi, eax);
+			Line_ConvertMediumRes_640x16Bit_T(edi, ebp, esi, eax, nWidthBytes, bDoubleY);
 		else
-			Line_ConvertLowRes_640x16Bit(edi, ebp, (Uint32 *)esi, eax);
+			Line_ConvertLowRes_640x16Bit_T(edi, ebp, (Uint32 *)esi, eax, nWidthBytes, bDoubleY);
 
 		/* Offset to next line */
 		pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine * 2);
@@ -35,12 +35,13 @@ static void ConvertMediumRes_640x16Bit(void)
 }
 
 
-static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax)
+CONVERT_INLINE void Line_ConvertMediumRes_640x16Bit_T(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax,
+                                                      int nWidthBytes, bool bDoubleY)
 {
 	Uint32 ebx, ecx;
 	int x, update, Screen2BytesPerLine;
 
-	x = STScreenWidthBytes >> 2;   /* Amount to draw across in 16-pixels (4 bytes) */
+	x = nWidthBytes >> 2;          /* Amount to draw across in 16-pixels (4 bytes) */
 	Screen2BytesPerLine = PCScreenBytesPerLine/2;
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
 
@@ -58,7 +59,7 @@ static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *es
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 			/* Plot in 'right-order' on big endian systems */
-			if (!bScrDoubleY)                     /* Double on Y? */
+			if (!bDoubleY)                        /* Double on Y? */
 			{
 				MED_BUILD_PIXELS_0 ;              /* Generate 'ecx' as pixels [12,13,14,15] */
 				PLOT_MED_640_16BIT(12) ;
@@ -82,7 +83,7 @@ static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *es
 			}
 #else
 			/* Plot in 'wrong-order', as ebx is 68000 endian */
-			if (!bScrDoubleY)                     /* Double on Y? */
+			if (!bDoubleY)                        /* Double on Y? */
 			{
 				MED_BUILD_PIXELS_0 ;              /* Generate 'ecx' as pixels [4,5,6,7] */
 				PLOT_MED_640_16BIT(4) ;
@@ -114,3 +115,8 @@ static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *es
 	while (--x);                        /* Loop on X */
 
 }
+
+static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax)
+{
+	Line_ConvertMediumRes_640x16Bit_T(edi, ebp, esi, eax, STScreenWidthBytes, bScrDoubleY);
+}
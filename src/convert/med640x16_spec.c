@@ -19,24 +19,22 @@ static void ConvertMediumRes_640x16Bit_Spec(void)
 	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
 	{
 		eax = STScreenLineOffset[y] + STScreenLeftSkipBytes;  /* Offset for this line + Amount to skip on left hand side */
-		edi = (Uint32 *)((Uint8 *)pSTScreen + eax);        /* ST format screen 4-plane 16 colors */
+		edi = (Uint32 *)((Uint8 *)pSTScreenSrc + eax);     /* ST format screen 4-plane 16 colors */
 		ebp = (Uint32 *)((Uint8 *)pSTScreenCopy + eax);    /* Previous ST format screen */
 		esi = (Uint16 *)pPCScreenDest;                     /* PC format screen */
 
 		if (HBLPaletteMasks[y] & 0x00030000)               /* Test resolution */
-			Line_ConvertMediumRes_640x16Bit_Spec(edi, ebp, esi, eax);	/* med res line */
+			Line_ConvertMediumRes_640x16Bit_Spec(edi, ebp, esi, eax, y);	/* med res line */
 		else
-			Line_ConvertLowRes_640x16Bit_Spec(edi, ebp, (Uint32 *)esi, eax);	/* low res line (double on X) */
+			Line_ConvertLowRes_640x16Bit_Spec(edi, ebp, (Uint32 *)esi, eax, y);	/* low res line (double on X) */
 
 		/* Offset to next line (double on Y) */
 		pPCScreenDest = (((Uint8 *)pPCScreenDest) + PCScreenBytesPerLine * 2);
 	}
-
-        bScreenContentsChanged = true;
 }
 
 
-static void Line_ConvertMediumRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax)
+static void Line_ConvertMediumRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax, int y)
 {
 	Uint32 ebx, ecx;
 	int x, Screen4BytesPerLine;
@@ -52,6 +50,23 @@ static void Line_ConvertMediumRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint1
 	x = STScreenWidthBytes >> 2;   /* Amount to draw across in 16-pixels (4 bytes) */
 	Screen4BytesPerLine = PCScreenBytesPerLine/2;
 
+	if (Convert_Spec512LineUnchanged(y, edi))
+	{
+		/* Still on the host screen from the previous frame */
+		Spec512_EndScanLine();
+		return;
+	}
+
+	/* Palette is updated every 8 pixels in med res */
+	if (!Spec512_LineChangesPalette(x * 2))
+	{
+		/* Palette changes only in the borders, convert as a normal line */
+		ScrUpdateFlag = PALETTEMASK_UPDATEFULL;
+		Line_ConvertMediumRes_640x16Bit(edi, ebp, esi, eax);
+		Spec512_EndScanLine();
+		return;
+	}
+
 	do  /* x-loop */
 	{
 		/* Do 16 pixels at one time */
@@ -10,6 +10,50 @@
 #ifndef HATARI_CONVERTROUTINES_H
 #define HATARI_CONVERTROUTINES_H
 
+/* The *_T() converter templates take line width and Y doubling as
+ * arguments, so that calling them with constants gives variants with
+ * no parameter dependent branches or loop counts in the inner loops.
+ */
+#ifdef __GNUC__
+# define CONVERT_INLINE static inline __attribute__((always_inline))
+#else
+# define CONVERT_INLINE static inline
+#endif
+
+/* ST line widths with specialised variants, see Screen_ConvertVariant() */
+#define CONVERT_WIDTH_NOBORDER	SCREENBYTES_MIDDLE		/* 320 pixels */
+#define CONVERT_WIDTH_BORDER	(SCREENBYTES_MIDDLE + 2*32/2)	/* + 32 pixel borders */
+#define CONVERT_WIDTH_OVERSCAN	(SCREENBYTES_MIDDLE + 2*48/2)	/* + 48 pixel borders */
+#define CONVERT_VARIANTS_MAX	(3*2)				/* widths * Y doubling */
+
+/* Generic converter using the current settings, and its variants for
+ * above widths, indexed by width * 2 + Y doubling
+ */
+#define CONVERT_VARIANTS_320(name) \
+static void name(void) { name##_T(STScreenWidthBytes); } \
+static void name##_NoBorder(void) { name##_T(CONVERT_WIDTH_NOBORDER); } \
+static void name##_Border(void) { name##_T(CONVERT_WIDTH_BORDER); } \
+static void name##_Overscan(void) { name##_T(CONVERT_WIDTH_OVERSCAN); } \
+static void (* const name##_Variants[CONVERT_VARIANTS_MAX])(void) = { \
+	name##_NoBorder, name##_NoBorder, \
+	name##_Border, name##_Border, \
+	name##_Overscan, name##_Overscan \
+}
+
+#define CONVERT_VARIANTS_640(name) \
+static void name(void) { name##_T(STScreenWidthBytes, bScrDoubleY); } \
+static void name##_NoBorder(void) { name##_T(CONVERT_WIDTH_NOBORDER, false); } \
+static void name##_NoBorder_DoubleY(void) { name##_T(CONVERT_WIDTH_NOBORDER, true); } \
+static void name##_Border(void) { name##_T(CONVERT_WIDTH_BORDER, false); } \
+static void name##_Border_DoubleY(void) { name##_T(CONVERT_WIDTH_BORDER, true); } \
+static void name##_Overscan(void) { name##_T(CONVERT_WIDTH_OVERSCAN, false); } \
+static void name##_Overscan_DoubleY(void) { name##_T(CONVERT_WIDTH_OVERSCAN, true); } \
+static void (* const name##_Variants[CONVERT_VARIANTS_MAX])(void) = { \
+	name##_NoBorder, name##_NoBorder_DoubleY, \
+	name##_Border, name##_Border_DoubleY, \
+	name##_Overscan, name##_Overscan_DoubleY \
+}
+
 static void ConvertLowRes_320x8Bit(void);
 static void ConvertLowRes_640x8Bit(void);
 static void Line_ConvertMediumRes_640x8Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax);
@@ -19,21 +63,25 @@ static void ConvertHighRes_640x8Bit(void);
 static void ConvertLowRes_320x16Bit(void);
 static void ConvertLowRes_640x16Bit(void);
 static void ConvertLowRes_320x16Bit_Spec(void);
-static void Line_ConvertLowRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax);
+static void Line_ConvertLowRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax, int y);
 static void ConvertLowRes_640x16Bit_Spec(void);
 static void Line_ConvertMediumRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax);
+CONVERT_INLINE void Line_ConvertMediumRes_640x16Bit_T(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax,
+                                                      int nWidthBytes, bool bDoubleY);
 static void ConvertMediumRes_640x16Bit(void);
-static void Line_ConvertMediumRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax);
+static void Line_ConvertMediumRes_640x16Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint16 *esi, Uint32 eax, int y);
 static void ConvertMediumRes_640x16Bit_Spec(void);
 
 static void ConvertLowRes_320x32Bit(void);
 static void ConvertLowRes_640x32Bit(void);
 static void ConvertLowRes_320x32Bit_Spec(void);
-static void Line_ConvertLowRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax);
+static void Line_ConvertLowRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax, int y);
 static void ConvertLowRes_640x32Bit_Spec(void);
 static void Line_ConvertMediumRes_640x32Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax);
+CONVERT_INLINE void Line_ConvertMediumRes_640x32Bit_T(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax,
+                                                      int nWidthBytes, bool bDoubleY);
 static void ConvertMediumRes_640x32Bit(void);
-static void Line_ConvertMediumRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax);
+static void Line_ConvertMediumRes_640x32Bit_Spec(Uint32 *edi, Uint32 *ebp, Uint32 *esi, Uint32 eax, int y);
 static void ConvertMediumRes_640x32Bit_Spec(void);
 
 static void ConvertVDIRes_16Colour(void);
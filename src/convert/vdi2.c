@@ -15,11 +15,11 @@ static void ConvertVDIRes_2Colour(void)
 	Uint16 eax, ebx;
 	int y, x, update;
 
-	edi = (Uint16 *)pSTScreen;            /* ST format screen */
-	ebp = (Uint16 *)pSTScreenCopy;        /* Previous ST format screen */
+	edi = (Uint16 *)(pSTScreenSrc + STScreenStartHorizLine * STScreenWidthBytes);         /* ST format screen */
+	ebp = (Uint16 *)(pSTScreenCopy + STScreenStartHorizLine * STScreenWidthBytes);        /* Previous ST format screen */
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
 
-	for (y = 0; y < VDIHeight; y++)
+	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
 	{
 
 		esi = (Uint32 *)pPCScreenDest;  /* PC format screen, byte per pixel 256 colors */
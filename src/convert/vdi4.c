@@ -16,11 +16,11 @@ static void ConvertVDIRes_4Colour(void)
 	int y, x, update;
 
 	/* Get screen addresses, 'edi'-ST screen, 'ebp'-Previous ST screen, 'esi'-PC screen */
-	edi = (Uint32 *)pSTScreen;          /* ST format screen 2-plane 4 colors */
-	ebp = (Uint32 *)pSTScreenCopy;      /* Previous ST format screen */
+	edi = (Uint32 *)(pSTScreenSrc + STScreenStartHorizLine * STScreenWidthBytes);       /* ST format screen 2-plane 4 colors */
+	ebp = (Uint32 *)(pSTScreenCopy + STScreenStartHorizLine * STScreenWidthBytes);      /* Previous ST format screen */
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
 
-	for (y = 0; y < VDIHeight; y++)
+	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
 	{
 
 		esi = (Uint32 *)pPCScreenDest;  /* PC format screen, byte per pixel 256 colors */
@@ -112,6 +112,131 @@ struct {
 } mmu030;
 
 
+/* Software TLB in front of the ATC
+ *
+ * Direct mapped and indexed by the logical page number, each entry is
+ * tagged with the logical page and the function code. It caches the
+ * result of an ATC lookup (only when no transparent translation matched)
+ * together with a host pointer for RAM pages, so that most accesses
+ * don't need to search the ATC and to check the TT registers.
+ * An entry is only used while the ATC line it was created from still
+ * holds the same translation, so ATC flushes and replacements don't
+ * need to look at the TLB. It's flushed when TC or TT registers change.
+ * Reads and writes use separate tables, write entries are only created
+ * for modified and not write protected pages.
+ */
+#define MMU030_TLB_BITS     8
+#define MMU030_TLB_SIZE     (1 << MMU030_TLB_BITS)
+#define MMU030_TLB_VALID    0x08    /* tag bit, page addresses have at least 8 zero bits */
+
+typedef struct {
+    uaecptr tag;        /* logical page | fc | MMU030_TLB_VALID */
+    uaecptr physical;   /* physical page */
+    uae_u8 *host;       /* host address of physical page, NULL if not RAM */
+    int atc_line;
+} MMU030_TLB_ENTRY;
+
+static MMU030_TLB_ENTRY mmu030_tlb[2][MMU030_TLB_SIZE];
+
+static void mmu030_flush_tlb(void) {
+    memset(mmu030_tlb, 0, sizeof(mmu030_tlb));
+}
+
+static inline MMU030_TLB_ENTRY *mmu030_tlb_entry(uaecptr addr, int write) {
+    return &mmu030_tlb[write][(addr >> mmu030.translation.page.size) & (MMU030_TLB_SIZE - 1)];
+}
+
+/* Return the TLB entry for this access, or NULL if there's none */
+static inline MMU030_TLB_ENTRY *mmu030_tlb_lookup(uaecptr addr, uae_u32 fc, int write) {
+    uaecptr page = addr & ~mmu030.translation.page.mask;
+    MMU030_TLB_ENTRY *e = mmu030_tlb_entry(addr, write);
+    MMU030_ATC_LINE *l;
+
+    if (e->tag != (page | fc | MMU030_TLB_VALID))
+        return NULL;
+
+    l = &mmu030.atc[e->atc_line];
+    if (!l->logical.valid || l->logical.addr != page || l->logical.fc != fc ||
+        l->physical.addr != e->physical || l->physical.bus_error ||
+        (write && (!l->physical.modified || l->physical.write_protect))) {
+        e->tag = 0;
+        return NULL;
+    }
+    /* Same history bit handling as an ATC hit */
+    if (!l->mru)
+        mmu030_atc_handle_history_bit(e->atc_line);
+    return e;
+}
+
+/* Create a TLB entry for the translation in ATC line 'atc_line' */
+static void mmu030_tlb_fill(uaecptr addr, uae_u32 fc, int write, int atc_line) {
+    MMU030_ATC_LINE *l;
+    MMU030_TLB_ENTRY *e;
+    uae_u32 page_size = mmu030.translation.page.mask + 1;
+
+    if (atc_line >= ATC030_NUM_ENTRIES)
+        return;
+    l = &mmu030.atc[atc_line];
+    if (l->physical.bus_error || (write && (!l->physical.modified || l->physical.write_protect)))
+        return;
+
+    e = mmu030_tlb_entry(addr, write);
+    e->tag = l->logical.addr | fc | MMU030_TLB_VALID;
+    e->physical = l->physical.addr;
+    e->atc_line = atc_line;
+    e->host = NULL;
+    if ((get_mem_bank(e->physical).flags & ABFLAG_RAM) &&
+        &get_mem_bank(e->physical + page_size - 1) == &get_mem_bank(e->physical) &&
+        get_mem_bank(e->physical).check(e->physical, page_size)) {
+        e->host = get_mem_bank(e->physical).xlateaddr(e->physical);
+    }
+}
+
+/* Accesses through a TLB entry, the host pointer is only used when the
+ * access doesn't go beyond the end of the page */
+#define MMU030_TLB_INDEX(addr)  ((addr) & mmu030.translation.page.mask)
+
+static inline uae_u32 mmu030_tlb_get_long(MMU030_TLB_ENTRY *e, uaecptr addr) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host && idx + 3 <= mmu030.translation.page.mask)
+        return do_get_mem_long(e->host + idx);
+    return phys_get_long(e->physical + idx);
+}
+static inline uae_u16 mmu030_tlb_get_word(MMU030_TLB_ENTRY *e, uaecptr addr) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host && idx + 1 <= mmu030.translation.page.mask)
+        return do_get_mem_word(e->host + idx);
+    return phys_get_word(e->physical + idx);
+}
+static inline uae_u8 mmu030_tlb_get_byte(MMU030_TLB_ENTRY *e, uaecptr addr) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host)
+        return e->host[idx];
+    return phys_get_byte(e->physical + idx);
+}
+static inline void mmu030_tlb_put_long(MMU030_TLB_ENTRY *e, uaecptr addr, uae_u32 val) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host && idx + 3 <= mmu030.translation.page.mask)
+        do_put_mem_long(e->host + idx, val);
+    else
+        phys_put_long(e->physical + idx, val);
+}
+static inline void mmu030_tlb_put_word(MMU030_TLB_ENTRY *e, uaecptr addr, uae_u16 val) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host && idx + 1 <= mmu030.translation.page.mask)
+        do_put_mem_word(e->host + idx, val);
+    else
+        phys_put_word(e->physical + idx, val);
+}
+static inline void mmu030_tlb_put_byte(MMU030_TLB_ENTRY *e, uaecptr addr, uae_u8 val) {
+    uae_u32 idx = MMU030_TLB_INDEX(addr);
+    if (e->host)
+        e->host[idx] = val;
+    else
+        phys_put_byte(e->physical + idx, val);
+}
+
+
 
 /* MMU Status Register
  *
@@ -260,6 +385,10 @@ void mmu_op30_pmove (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
     if (!fd && !rw && !(preg==0x18)) {
         mmu030_flush_atc_all();
     }
+    /* Page size and TT registers are part of the TLB lookups */
+    if (!rw && (preg==0x10 || preg==0x02 || preg==0x03)) {
+        mmu030_flush_tlb();
+    }
 }
 
 void mmu_op30_ptest (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
@@ -442,6 +571,7 @@ void mmu030_flush_atc_all(void) {
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         mmu030.atc[i].logical.valid = false;
     }
+    mmu030_flush_tlb();
 }
 
 
@@ -1681,108 +1811,180 @@ void mmu030_atc_handle_history_bit(int entry_num) {
  */
 
 void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		phys_put_long(addr,val);
+		return;
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 1);
+    if (e) {
+        mmu030_tlb_put_long(e, addr, val);
+        return;
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr,fc,true)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,true)&TT_OK_MATCH) {
 		phys_put_long(addr,val);
 		return;
     }
 
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
 
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        mmu030_put_long_atc(addr, val, atc_line_num);
-    } else {
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
         mmu030_table_search(addr,fc,true,0);
-        mmu030_put_long_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true));
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,true);
     }
+    mmu030_tlb_fill(addr, fc, 1, atc_line_num);
+    mmu030_put_long_atc(addr, val, atc_line_num);
 }
 
 void mmu030_put_word(uaecptr addr, uae_u16 val, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		phys_put_word(addr,val);
+		return;
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 1);
+    if (e) {
+        mmu030_tlb_put_word(e, addr, val);
+        return;
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr,fc,true)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,true)&TT_OK_MATCH) {
 		phys_put_word(addr,val);
 		return;
     }
-    
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
-    
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        mmu030_put_word_atc(addr, val, atc_line_num);
-    } else {
-        mmu030_table_search(addr, fc, true, 0);
-        mmu030_put_word_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true));
+
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
+
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
+        mmu030_table_search(addr,fc,true,0);
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,true);
     }
+    mmu030_tlb_fill(addr, fc, 1, atc_line_num);
+    mmu030_put_word_atc(addr, val, atc_line_num);
 }
 
 void mmu030_put_byte(uaecptr addr, uae_u8 val, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		phys_put_byte(addr,val);
+		return;
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 1);
+    if (e) {
+        mmu030_tlb_put_byte(e, addr, val);
+        return;
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr, fc, true)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,true)&TT_OK_MATCH) {
 		phys_put_byte(addr,val);
 		return;
     }
-    
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
 
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        mmu030_put_byte_atc(addr, val, atc_line_num);
-    } else {
-        mmu030_table_search(addr, fc, true, 0);
-        mmu030_put_byte_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true));
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
+
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
+        mmu030_table_search(addr,fc,true,0);
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,true);
     }
+    mmu030_tlb_fill(addr, fc, 1, atc_line_num);
+    mmu030_put_byte_atc(addr, val, atc_line_num);
 }
 
 uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		return phys_get_long(addr);
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 0);
+    if (e) {
+        return mmu030_tlb_get_long(e, addr);
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) {
 		return phys_get_long(addr);
     }
-    
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        return mmu030_get_long_atc(addr, atc_line_num);
-    } else {
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
+
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_long_atc(addr, mmu030_logical_is_in_atc(addr,fc,false));
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,false);
     }
+    mmu030_tlb_fill(addr, fc, 0, atc_line_num);
+    return mmu030_get_long_atc(addr, atc_line_num);
 }
 
 uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		return phys_get_word(addr);
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 0);
+    if (e) {
+        return mmu030_tlb_get_word(e, addr);
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) {
 		return phys_get_word(addr);
     }
-    
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        return mmu030_get_word_atc(addr, atc_line_num);
-    } else {
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
+
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_word_atc(addr, mmu030_logical_is_in_atc(addr,fc,false));
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,false);
     }
+    mmu030_tlb_fill(addr, fc, 0, atc_line_num);
+    return mmu030_get_word_atc(addr, atc_line_num);
 }
 
 uae_u8 mmu030_get_byte(uaecptr addr, uae_u32 fc, int size) {
-    
+    MMU030_TLB_ENTRY *e;
+    int atc_line_num;
+
+	if ((!mmu030.enabled) || (fc==7)) {
+		return phys_get_byte(addr);
+    }
+
+    e = mmu030_tlb_lookup(addr, fc, 0);
+    if (e) {
+        return mmu030_tlb_get_byte(e, addr);
+    }
+
 	//                                        addr,super,write
-	if ((!mmu030.enabled) || (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) || (fc==7)) {
+	if (mmu030_match_ttr(addr,fc,false)&TT_OK_MATCH) {
 		return phys_get_byte(addr);
     }
-    
-    int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num<ATC030_NUM_ENTRIES) {
-        return mmu030_get_byte_atc(addr, atc_line_num);
-    } else {
+    atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
+
+    if (atc_line_num>=ATC030_NUM_ENTRIES) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_byte_atc(addr, mmu030_logical_is_in_atc(addr,fc,false));
+        atc_line_num = mmu030_logical_is_in_atc(addr,fc,false);
     }
+    mmu030_tlb_fill(addr, fc, 0, atc_line_num);
+    return mmu030_get_byte_atc(addr, atc_line_num);
 }
 
 
@@ -1896,6 +2098,7 @@ void mmu030_reset(int hardreset)
 	tc_030 &= ~TC_ENABLE_TRANSLATION;
 	tt0_030 &= ~TT_ENABLE;
 	tt1_030 &= ~TT_ENABLE;
+	mmu030_flush_tlb();
 	if (hardreset) {
 		srp_030 = crp_030 = 0;
 		tt0_030 = tt1_030 = tc_030 = 0;
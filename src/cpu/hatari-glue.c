@@ -118,7 +118,9 @@ int Init680x0(void)
 		default: fprintf (stderr, "Init680x0() : Error, cpu_level unknown\n");
 	}
 	
-	currprefs.cpu_compatible = changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu;
+	currprefs.cpu_compatible = changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu
+	                                                          && !ConfigureParams.System.bFastTiming;
+	bFastTiming = ConfigureParams.System.bFastTiming;
 	currprefs.address_space_24 = changed_prefs.address_space_24 = ConfigureParams.System.bAddressSpace24;
 	currprefs.cpu_cycle_exact = changed_prefs.cpu_cycle_exact = ConfigureParams.System.bCycleExactCpu;
 	currprefs.fpu_model = changed_prefs.fpu_model = ConfigureParams.System.n_FPUType;
@@ -219,6 +221,41 @@ unsigned long OpCode_VDI(uae_u32 opcode)
 	return 4 * CYCLE_UNIT / 2;
 }
 
+/**
+ * Relocate a program loaded by the cartridge Pexec code (see cart_asm.s).
+ * When GemDOS_PexecRelocate() doesn't do it, the 'move.l 8(a5),a3' which
+ * this opcode replaced is emulated and the following branch is skipped,
+ * so that the cartridge code relocates the program itself.
+ */
+unsigned long OpCode_Pexec(uae_u32 opcode)
+{
+	Uint32 pc = M68000_GetPC();
+
+	/* this is valid only when called from cartridge code */
+	if (pc >= 0xfa0000 && pc < 0xfc0000)
+	{
+		/* A5: basepage, A4: relocation table, D7: absflag */
+		if (GemDOS_PexecRelocate(Regs[REG_A5], Regs[REG_A4], Regs[REG_D7]))
+			m68k_incpc(2);
+		else
+		{
+			Regs[REG_A3] = STMemory_ReadLong(Regs[REG_A5] + 8);
+			m68k_incpc(4);
+		}
+	}
+	else
+	{
+		/* illegal instruction */
+		op_illg(opcode);
+	}
+
+	get_word_prefetch (0);
+	regs.ir = regs.irc;
+	get_word_prefetch(2);
+
+	return 4 * CYCLE_UNIT / 2;
+}
+
 
 /**
  * Emulator Native Features ID opcode interception.
@@ -44,6 +44,8 @@
 #include "debugui.h"
 #include "debugcpu.h"
 #include "stMemory.h"
+#include "perfcount.h"
+#include "timeline.h"
 //#include "falcon_cycle030.h"
 
 
@@ -1954,6 +1956,9 @@ void REGPARAM2 Exception (int nr, uaecptr oldpc, int ExceptionSource)
 		CPU_IACK = false;
 	}
 
+	if (unlikely(bTimelineEnabled) && ExceptionSource != M68000_EXC_SRC_CPU)
+		Timeline_AddInterrupt(nr, ExceptionSource);
+
 #ifdef CPUEMU_12
 	if (currprefs.cpu_cycle_exact && currprefs.cpu_model == 68000)
 		Exception_ce000 (nr, oldpc);
@@ -2830,8 +2835,10 @@ STATIC_INLINE int do_specialties (int cycles)
 
 		/* It is possible one or more ints happen at the same time */
 		/* We must process them during the same cpu cycle then choose the highest priority one */
+		PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 		while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
 		    CALL_VAR(PendingInterruptFunction);
+		PERFCOUNT_END(nPerfPrev);
 		if ( MFP_UpdateNeeded == true )
 		    MFP_UpdateIRQ ( 0 );
 
@@ -3065,8 +3072,10 @@ static void m68k_run_1 (void)
 		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	        if ( PendingInterruptCount <= 0 )
 		{
+			PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+			PERFCOUNT_END(nPerfPrev);
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3125,8 +3134,10 @@ static void m68k_run_1_ce (void)
 		M68000_AddCyclesWithPairing(currcycle * 2 / CYCLE_UNIT);
 	        if ( PendingInterruptCount <= 0 )
 		{
+			PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+			PERFCOUNT_END(nPerfPrev);
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3348,8 +3359,10 @@ static void m68k_run_mmu040 (void)
 			/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	        	if ( PendingInterruptCount <= 0 )
 			{
+				PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 				while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 					CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				PERFCOUNT_END(nPerfPrev);
 				if ( MFP_UpdateNeeded == true )
 					MFP_UpdateIRQ ( 0 );
 			}
@@ -3465,8 +3478,10 @@ static void m68k_run_2ce (void)
 		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	        if ( PendingInterruptCount <= 0 )
 		{
+			PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+			PERFCOUNT_END(nPerfPrev);
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3546,8 +3561,10 @@ static void m68k_run_2p (void)
 		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	        if ( PendingInterruptCount <= 0 )
 		{
+			PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+			PERFCOUNT_END(nPerfPrev);
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3617,8 +3634,10 @@ static void m68k_run_2 (void)
 		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	        if ( PendingInterruptCount <= 0 )
 		{
+			PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+			PERFCOUNT_END(nPerfPrev);
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3740,6 +3759,11 @@ void m68k_go (int may_quit)
 				currprefs.cpu_compatible ? m68k_run_2p : m68k_run_2;
 		}
 		run_func ();
+#ifdef __LIBRETRO__
+		/* Return to the frontend at the end of each frame */
+		if (bCpuEndFrame)
+			break;
+#endif
 	}
 	in_m68k_go--;
 }
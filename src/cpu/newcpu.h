@@ -455,6 +455,8 @@ extern const struct cputbl op_smalltbl_11_ff[];
 extern const struct cputbl op_smalltbl_12_ff[];
 
 extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
+#define cpufunctbl_get(opcode) (cpufunctbl[opcode])
+#define cpufunctbl_set(opcode, f) (cpufunctbl[opcode] = (f))
 
 /* Added for hatari_glue.c */
 extern void build_cpufunctbl(void);
@@ -6,9 +6,9 @@
 
   This code handles our table with callbacks for cycle accurate program
   interruption. We add any pending callback handler into a table so that we do
-  not need to test for every possible interrupt event. We then scan
-  the list if used entries in the table and copy the one with the least cycle
-  count into the global 'PendingInterruptCount' variable. This is then
+  not need to test for every possible interrupt event. The used entries are
+  kept in a heap ordered by their due time, and the one with the least cycle
+  count is copied into the global 'PendingInterruptCount' variable. This is then
   decremented by the execution loop - rather than decrement each and every
   entry (as the others cannot occur before this one).
   We have two methods of adding interrupts; Absolute and Relative.
@@ -31,6 +31,12 @@
   synchronisation between CPU and MFP, without the rounding errors of floating
   points math.
 
+  The time of the last update of the table is kept in 'nCyclesBase' : this
+  is the master clock in internal cycles, which never goes back (except when
+  restoring a snapshot). CycInt_GetClock() returns its current value, and
+  devices can use it to express their deadlines as absolute clock values with
+  CycInt_AddClockInterrupt(), instead of converting them to relative delays.
+
   Thanks to Arnaud Carre (Leonard / Oxygene) for sharing this method used in
   Saint (and also used in sc68).
 
@@ -66,6 +72,7 @@ const char CycInt_fileid[] = "Hatari cycInt.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "video.h"
 #include "acia.h"
+#include "sampler.h"
 
 
 void (*PendingInterruptFunction)(void);
@@ -94,11 +101,16 @@ static void (* const pIntHandlerFunctions[MAX_INTERRUPTS])(void) =
 	FDC_InterruptHandler_Update,
 	Blitter_InterruptHandler,
 	Midi_InterruptHandler_Update,
+	Sampler_InterruptHandler,
 
 };
 
 /* Event timer structure - keeps next timer to occur in structure so don't need
- * to check all entries */
+ * to check all entries.
+ * While an interrupt is used, 'Cycles' is its absolute due time in internal
+ * cycles, counted from 'nCyclesBase' (the time of the last update), so time
+ * passing only needs to move 'nCyclesBase' instead of adjusting each entry.
+ * When stopped, 'Cycles' keeps the (relative) count left, for resuming it */
 typedef struct
 {
 	bool bUsed;                   /* Is interrupt active? */
@@ -106,11 +118,118 @@ typedef struct
 	void (*pFunction)(void);
 } INTERRUPTHANDLER;
 
-static INTERRUPTHANDLER InterruptHandlers[MAX_INTERRUPTS];
+static INTERRUPTHANDLER InterruptHandlers[MAX_INTERRUPTS] CACHE_ALIGNED;
 static int ActiveInterrupt=0;
+static Sint64 nCyclesBase;
+
+/* Binary min-heap of the used interrupts, ordered by due time (and by ID
+ * for the same due time, like the former linear scan), with the position
+ * of each interrupt in the heap (-1 when not used) */
+static interrupt_id InterruptHeap[MAX_INTERRUPTS];
+static int InterruptHeapPos[MAX_INTERRUPTS];
+static int InterruptHeapSize;
 
 static void CycInt_SetNewInterrupt(void);
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if interrupt 'a' must happen before interrupt 'b'
+ */
+static inline bool CycInt_HeapBefore(interrupt_id a, interrupt_id b)
+{
+	if (InterruptHandlers[a].Cycles != InterruptHandlers[b].Cycles)
+		return InterruptHandlers[a].Cycles < InterruptHandlers[b].Cycles;
+	return a < b;
+}
+
+/**
+ * Store interrupt at given heap position
+ */
+static inline void CycInt_HeapSet(int pos, interrupt_id Handler)
+{
+	InterruptHeap[pos] = Handler;
+	InterruptHeapPos[Handler] = pos;
+}
+
+/**
+ * Move heap entry at 'pos' up or down to its place after its due time changed
+ */
+static void CycInt_HeapFix(int pos)
+{
+	interrupt_id Handler = InterruptHeap[pos];
+	int parent, child;
+
+	while (pos > 0)
+	{
+		parent = (pos - 1) / 2;
+		if (!CycInt_HeapBefore(Handler, InterruptHeap[parent]))
+			break;
+		CycInt_HeapSet(pos, InterruptHeap[parent]);
+		pos = parent;
+	}
+	while ((child = 2 * pos + 1) < InterruptHeapSize)
+	{
+		if (child + 1 < InterruptHeapSize
+		    && CycInt_HeapBefore(InterruptHeap[child + 1], InterruptHeap[child]))
+			child++;
+		if (!CycInt_HeapBefore(InterruptHeap[child], Handler))
+			break;
+		CycInt_HeapSet(pos, InterruptHeap[child]);
+		pos = child;
+	}
+	CycInt_HeapSet(pos, Handler);
+}
+
+/**
+ * Return interrupt's count of internal cycles left, from the last update
+ */
+static inline Sint64 CycInt_GetCycles(interrupt_id Handler)
+{
+	if (Handler == INTERRUPT_NULL)
+		return INT_MAX;
+	if (InterruptHandlers[Handler].bUsed)
+		return InterruptHandlers[Handler].Cycles - nCyclesBase;
+	return InterruptHandlers[Handler].Cycles;
+}
+
+/**
+ * Start interrupt (or change it when already used) to happen
+ * 'Cycles' internal cycles after the last update
+ */
+static void CycInt_Start(interrupt_id Handler, Sint64 Cycles)
+{
+	InterruptHandlers[Handler].Cycles = nCyclesBase + Cycles;
+	if (!InterruptHandlers[Handler].bUsed)
+	{
+		InterruptHandlers[Handler].bUsed = true;
+		CycInt_HeapSet(InterruptHeapSize++, Handler);
+	}
+	CycInt_HeapFix(InterruptHeapPos[Handler]);
+}
+
+/**
+ * Stop interrupt, keeping its count of cycles left for resuming it
+ */
+static void CycInt_Stop(interrupt_id Handler)
+{
+	int pos = InterruptHeapPos[Handler];
+
+	if (!InterruptHandlers[Handler].bUsed)
+		return;
+	InterruptHandlers[Handler].Cycles -= nCyclesBase;
+	InterruptHandlers[Handler].bUsed = false;
+	InterruptHeapPos[Handler] = -1;
+
+	/* Move last entry to the freed place */
+	if (--InterruptHeapSize > pos)
+	{
+		CycInt_HeapSet(pos, InterruptHeap[InterruptHeapSize]);
+		CycInt_HeapFix(pos);
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Reset interrupts, handlers
@@ -130,7 +249,9 @@ void CycInt_Reset(void)
 		InterruptHandlers[i].bUsed = false;
 		InterruptHandlers[i].Cycles = INT_MAX;
 		InterruptHandlers[i].pFunction = pIntHandlerFunctions[i];
+		InterruptHeapPos[i] = -1;
 	}
+	InterruptHeapSize = 0;
 }
 
 
@@ -172,16 +293,25 @@ static void ( *CycInt_IDToHandlerFunction(int ID) )( void )
 /*-----------------------------------------------------------------------*/
 /**
  * Save/Restore snapshot of local variables('MemorySnapShot_Store' handles type)
+ * Cycles are saved relative to the last update (the clock base).
  */
 void CycInt_MemorySnapShot_Capture(bool bSave)
 {
 	int i,ID;
+	bool bUsed;
+	Sint64 Cycles;
+
+	MemorySnapShot_Store(&nCyclesBase, sizeof(nCyclesBase));
+	if (!bSave)
+		InterruptHeapSize = 0;
 
 	/* Save/Restore details */
 	for (i=0; i<MAX_INTERRUPTS; i++)
 	{
-		MemorySnapShot_Store(&InterruptHandlers[i].bUsed, sizeof(InterruptHandlers[i].bUsed));
-		MemorySnapShot_Store(&InterruptHandlers[i].Cycles, sizeof(InterruptHandlers[i].Cycles));
+		bUsed = InterruptHandlers[i].bUsed;
+		Cycles = CycInt_GetCycles(i);
+		MemorySnapShot_Store(&bUsed, sizeof(bUsed));
+		MemorySnapShot_Store(&Cycles, sizeof(Cycles));
 		if (bSave)
 		{
 			/* Convert function to ID */
@@ -193,6 +323,13 @@ void CycInt_MemorySnapShot_Capture(bool bSave)
 			/* Convert ID to function */
 			MemorySnapShot_Store(&ID, sizeof(int));
 			InterruptHandlers[i].pFunction = CycInt_IDToHandlerFunction(ID);
+
+			/* Rebuild the heap with the restored counts */
+			InterruptHandlers[i].bUsed = false;
+			InterruptHandlers[i].Cycles = Cycles;
+			InterruptHeapPos[i] = -1;
+			if (bUsed && i != INTERRUPT_NULL)
+				CycInt_Start(i, Cycles);
 		}
 	}
 	MemorySnapShot_Store(&nCyclesOver, sizeof(nCyclesOver));
@@ -220,38 +357,27 @@ void CycInt_MemorySnapShot_Capture(bool bSave)
 /**
  * Find next interrupt to occur, and store to global variables for decrement
  * in instruction decode loop.
- * Note: Although InterruptHandlers.Cycles and LowestCycleCount are 64 bit
- * variables to get all the cycle counters right (e.g. the DMA sound counter
- * can get very high), PendingInterruptCount is still a 32 bit variable for
- * performance reasons (it's decremented after each CPU instruction).
- * So we have to initialize LowestCycleCount with INT_MAX, not with INT64_MAX!
+ * Note: Although InterruptHandlers.Cycles are 64 bit variables to get all
+ * the cycle counters right (e.g. the DMA sound counter can get very high),
+ * PendingInterruptCount is still a 32 bit variable for performance reasons
+ * (it's decremented after each CPU instruction).
+ * So interrupts INT_MAX or more cycles away are left for later updates!
  * Since there is always a VBL or HBL counter pending which fits fine into the
  * 32 bit variable, we can be sure that we don't run into problems here.
  */
 static void CycInt_SetNewInterrupt(void)
 {
-	Sint64 LowestCycleCount = INT_MAX;
-	interrupt_id LowestInterrupt = INTERRUPT_NULL, i;
+	interrupt_id LowestInterrupt = INTERRUPT_NULL;
 
 	LOG_TRACE(TRACE_INT, "int set new in video_cyc=%d active_int=%d pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, PendingInterruptCount);
 
-	/* Find next interrupt to go off */
-	for (i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS; i++)
-	{
-		/* Is interrupt pending? */
-		if (InterruptHandlers[i].bUsed)
-		{
-			if (InterruptHandlers[i].Cycles < LowestCycleCount)
-			{
-				LowestCycleCount = InterruptHandlers[i].Cycles;
-				LowestInterrupt = i;
-			}
-		}
-	}
+	/* Next interrupt to go off is at the top of the heap */
+	if (InterruptHeapSize > 0 && CycInt_GetCycles(InterruptHeap[0]) < INT_MAX)
+		LowestInterrupt = InterruptHeap[0];
 
 	/* Set new counts, active interrupt */
-	PendingInterruptCount = InterruptHandlers[LowestInterrupt].Cycles;
+	PendingInterruptCount = CycInt_GetCycles(LowestInterrupt);
 	PendingInterruptFunction = InterruptHandlers[LowestInterrupt].pFunction;
 	ActiveInterrupt = LowestInterrupt;
 
@@ -267,19 +393,14 @@ static void CycInt_SetNewInterrupt(void)
 static void CycInt_UpdateInterrupt(void)
 {
 	Sint64 CycleSubtract;
-	int i;
 
 	/* Find out how many cycles we went over (<=0) */
 	nCyclesOver = PendingInterruptCount;
 	/* Calculate how many cycles have passed, included time we went over */
-	CycleSubtract = InterruptHandlers[ActiveInterrupt].Cycles - nCyclesOver;
+	CycleSubtract = CycInt_GetCycles(ActiveInterrupt) - nCyclesOver;
 
-	/* Adjust table */
-	for (i = 0; i < MAX_INTERRUPTS; i++)
-	{
-		if (InterruptHandlers[i].bUsed)
-			InterruptHandlers[i].Cycles -= CycleSubtract;
-	}
+	/* Adjust time base of the used interrupts */
+	nCyclesBase += CycleSubtract;
 
 	LOG_TRACE(TRACE_INT, "int upd video_cyc=%d cycle_over=%d cycle_sub=%"PRId64"\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), nCyclesOver, CycleSubtract);
@@ -297,13 +418,13 @@ void CycInt_AcknowledgeInterrupt(void)
 	CycInt_UpdateInterrupt();
 
 	/* Disable interrupt entry which has just occurred */
-	InterruptHandlers[ActiveInterrupt].bUsed = false;
+	CycInt_Stop(ActiveInterrupt);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int ack video_cyc=%d active_int=%d active_cyc=%d pending_count=%d\n",
-	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, (int)InterruptHandlers[ActiveInterrupt].Cycles, PendingInterruptCount );
+	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, (int)CycInt_GetCycles(ActiveInterrupt), PendingInterruptCount );
 }
 
 
@@ -320,15 +441,14 @@ void CycInt_AddAbsoluteInterrupt(int CycleTime, int CycleType, interrupt_id Hand
 	if ( ActiveInterrupt > 0 )
 		CycInt_UpdateInterrupt();
 
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + nCyclesOver;
+	CycInt_Start(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + nCyclesOver);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add abs video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	          CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 
 
@@ -355,14 +475,13 @@ void CycInt_AddRelativeInterruptNoOffset(int CycleTime, int CycleType, interrupt
 		CycInt_UpdateInterrupt();
 
 //  nCyclesOver = 0;
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + PendingInterruptCount;
+	CycInt_Start(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + PendingInterruptCount);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add rel no_off video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
-	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler, InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler, CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 #endif
 
@@ -385,15 +504,14 @@ void CycInt_AddRelativeInterruptWithOffset(int CycleTime, int CycleType, interru
 	if ( ActiveInterrupt > 0 )
 		CycInt_UpdateInterrupt();
 
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + CycleOffset;
+	CycInt_Start(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + CycleOffset);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add rel offset video_cyc=%d handler=%d handler_cyc=%"PRId64" offset_cyc=%d pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, CycleOffset, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), CycleOffset, PendingInterruptCount);
 }
 
 
@@ -412,13 +530,15 @@ void CycInt_ModifyInterrupt(int CycleTime, int CycleType, interrupt_id Handler)
 		CycInt_UpdateInterrupt();
 
 	InterruptHandlers[Handler].Cycles += INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType);
+	if (InterruptHandlers[Handler].bUsed)
+		CycInt_HeapFix(InterruptHeapPos[Handler]);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int modify video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	          CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 
 
@@ -433,14 +553,14 @@ void CycInt_RemovePendingInterrupt(interrupt_id Handler)
 	CycInt_UpdateInterrupt();
 
 	/* Stop interrupt after CycInt_UpdateInterrupt, for CycInt_ResumeStoppedInterrupt */
-	InterruptHandlers[Handler].bUsed = false;
+	CycInt_Stop(Handler);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int remove pending video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), PendingInterruptCount);
 }
 
 
@@ -451,7 +571,8 @@ void CycInt_RemovePendingInterrupt(interrupt_id Handler)
 void CycInt_ResumeStoppedInterrupt(interrupt_id Handler)
 {
 	/* Restart interrupt */
-	InterruptHandlers[Handler].bUsed = true;
+	if (!InterruptHandlers[Handler].bUsed)
+		CycInt_Start(Handler, InterruptHandlers[Handler].Cycles);
 
 	/* Update list cycle counts */
 	CycInt_UpdateInterrupt();
@@ -460,7 +581,7 @@ void CycInt_ResumeStoppedInterrupt(interrupt_id Handler)
 
 	LOG_TRACE(TRACE_INT, "int resume stopped video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), PendingInterruptCount);
 }
 
 
@@ -486,8 +607,8 @@ int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType)
 {
 	Sint64 CyclesPassed, CyclesFromLastInterrupt;
 
-	CyclesFromLastInterrupt = InterruptHandlers[ActiveInterrupt].Cycles - PendingInterruptCount;
-	CyclesPassed = InterruptHandlers[Handler].Cycles - CyclesFromLastInterrupt;
+	CyclesFromLastInterrupt = CycInt_GetCycles(ActiveInterrupt) - PendingInterruptCount;
+	CyclesPassed = CycInt_GetCycles(Handler) - CyclesFromLastInterrupt;
 
 	LOG_TRACE(TRACE_INT, "int find passed cyc video_cyc=%d handler=%d last_cyc=%"PRId64" passed_cyc=%"PRId64"\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
@@ -495,3 +616,50 @@ int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType)
 
 	return INT_CONVERT_FROM_INTERNAL ( CyclesPassed , CycleType ) ;
 }
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the current master clock value, in internal cycles
+ */
+Uint64 CycInt_GetClock(void)
+{
+	return nCyclesBase + CycInt_GetCycles(ActiveInterrupt) - PendingInterruptCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the master clock value when an interrupt is due (it can be in the
+ * past if the interrupt is late), or when it was stopped for a stopped one.
+ */
+Uint64 CycInt_GetInterruptClock(interrupt_id Handler)
+{
+	if (InterruptHandlers[Handler].bUsed)
+		return InterruptHandlers[Handler].Cycles;
+	return nCyclesBase;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add interrupt to occur when the master clock reaches 'Clock' (in internal
+ * cycles). If 'Clock' is already in the past, interrupt occurs as soon as
+ * possible, as if it was late.
+ */
+void CycInt_AddClockInterrupt(Uint64 Clock, interrupt_id Handler)
+{
+	/* Update list cycle counts with current PendingInterruptCount before adding a new int, */
+	/* because CycInt_SetNewInterrupt can change the active int / PendingInterruptCount */
+	if ( ActiveInterrupt > 0 )
+		CycInt_UpdateInterrupt();
+
+	CycInt_Start(Handler, (Sint64)Clock - nCyclesBase);
+
+	/* Set new active int and compute a new value for PendingInterruptCount*/
+	CycInt_SetNewInterrupt();
+
+	LOG_TRACE(TRACE_INT, "int add clock video_cyc=%d handler=%d handler_cyc=%"PRId64" clock=%"PRIu64" pending_count=%d\n",
+	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
+	          CycInt_GetCycles(Handler), Clock, PendingInterruptCount);
+}
@@ -110,6 +110,41 @@ int Cycles_GetCounter(int nId)
 }
 
 
+/* Where the bus access happens inside an instruction, depending on OpcodeFamily */
+#define CYCLES_READ_END		0		/* read is done at the end of the instr */
+#define CYCLES_READ_MOVE	1		/* depends on the dst mode of the 'move' */
+#define CYCLES_READ_MOVEP	2		/* depends on the byte being transferred */
+
+#define CYCLES_WRITE_PREFETCH	0		/* write is done before the last 4 cycles of prefetch */
+#define CYCLES_WRITE_END	1		/* write is done during the last 4 cycles */
+
+/**
+ * Read/write access types for each OpcodeFamily, built at compile time
+ * like PairingArray, so the access cycle is a table lookup instead of a
+ * chain of tests on every IO register access. Families not listed here
+ * read at the end of the instruction and write like a 'move' (since this
+ * is the most common instr used when requiring cycle precise writes).
+ */
+static const Uint8 CyclesReadAccess[ MAX_OPCODE_FAMILY ] =
+{
+	[ i_MOVE ] = CYCLES_READ_MOVE,
+	[ i_MVPRM ] = CYCLES_READ_MOVEP,
+};
+
+/* Read-modify-write instructions, e.g i_CLR for bottom border removal in */
+/* No Scroll / Delirious Demo 4, or 'add d1,(a0)' in rasters.prg by TOS Crew */
+static const Uint8 CyclesWriteAccess[ MAX_OPCODE_FAMILY ] =
+{
+	[ i_CLR ] = CYCLES_WRITE_END, [ i_NEG ] = CYCLES_WRITE_END,
+	[ i_NEGX ] = CYCLES_WRITE_END, [ i_NOT ] = CYCLES_WRITE_END,
+	[ i_ADD ] = CYCLES_WRITE_END, [ i_SUB ] = CYCLES_WRITE_END,
+	[ i_AND ] = CYCLES_WRITE_END, [ i_OR ] = CYCLES_WRITE_END,
+	[ i_EOR ] = CYCLES_WRITE_END,
+	[ i_BCHG ] = CYCLES_WRITE_END, [ i_BCLR ] = CYCLES_WRITE_END,
+	[ i_BSET ] = CYCLES_WRITE_END,
+};
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Compute the cycles where a read actually happens inside a specific
@@ -122,30 +157,33 @@ static int Cycles_GetInternalCycleOnReadAccess(void)
 	int Opcode;
 
 	if ( BusMode == BUS_MODE_BLITTER )
+		return 4 + nWaitStateCycles;
+
+	/* BUS_MODE_CPU */
+	/* TODO: Find proper cycles count depending on the type of the current instruction */
+	/* (e.g. movem is not correctly handled) */
+	AddCycles = CurrentInstrCycles + nWaitStateCycles;		/* assume dest is reg : read is effective at the end of the instr */
+
+	switch ( CyclesReadAccess[ OpcodeFamily ] )
 	{
-		AddCycles = 4 + nWaitStateCycles;
-	}
-	else							/* BUS_MODE_CPU */
-	{
-		/* TODO: Find proper cycles count depending on the type of the current instruction */
-		/* (e.g. movem is not correctly handled) */
+	 case CYCLES_READ_MOVE:
+		/* Only 'move' needs the opcode itself, so it's not read for the other instructions. */
 		/* We don't read the opcode if PC is located in the IO region (rare cases */
 		/* used in some games/demos protections) as this can create recursive calls */
 		/* (protection of the "Union Demo" runs at $ff8240) */
 		if ( ( ( BusErrorPC & 0xffffff ) < 0xff0000 ) || ( ( BusErrorPC & 0xffffff ) > 0xffffff ) )
-			Opcode = get_word(BusErrorPC);					/* BusErrorPC points to the current opcode */
+			Opcode = get_word(BusErrorPC);			/* BusErrorPC points to the current opcode */
 		else
 			Opcode = -1;
-		//fprintf ( stderr , "opcode=%x\n" , Opcode );
 
 		/* Assume we use 'move src,dst' : access cycle depends on dst mode */
 		if ( Opcode == 0x11f8 )				/* move.b xxx.w,xxx.w (eg MOVE.B $ffff8209.w,$26.w in Bird Mad Girl Show) */
-			AddCycles = CurrentInstrCycles + nWaitStateCycles - 8;		/* read is effective before the 8 write cycles for dst */
-		else if ( OpcodeFamily == i_MVPRM )					/* eg movep.l d0,$ffc3(a1) in E605 (STE) */
-			AddCycles = 12 + MovepByteNbr * 4;				/* [NP] FIXME, it works with E605 but gives 20-32 cycles instead of 16-28 */
-											/* something must be wrong in video.c */
-		else
-			AddCycles = CurrentInstrCycles + nWaitStateCycles;		/* assume dest is reg : read is effective at the end of the instr */
+			AddCycles -= 8;				/* read is effective before the 8 write cycles for dst */
+		break;
+
+	 case CYCLES_READ_MOVEP:				/* eg movep.l d0,$ffc3(a1) in E605 (STE) */
+		AddCycles = 12 + MovepByteNbr * 4;		/* [NP] FIXME, it works with E605 but gives 20-32 cycles instead of 16-28 */
+		break;						/* something must be wrong in video.c */
 	}
 
 	return AddCycles;
@@ -164,37 +202,15 @@ static int Cycles_GetInternalCycleOnWriteAccess(void)
 	int AddCycles;
 
 	if ( BusMode == BUS_MODE_BLITTER )
-	{
-		AddCycles = 4 + nWaitStateCycles;
-	}
-	else							/* BUS_MODE_CPU */
-	{
-		/* TODO: Find proper cycles count depending on the type of the current instruction */
-		/* (e.g. movem is not correctly handled) */
-		AddCycles = CurrentInstrCycles + nWaitStateCycles;
+		return 4 + nWaitStateCycles;
 
-		if ( ( OpcodeFamily == i_CLR ) || ( OpcodeFamily == i_NEG ) || ( OpcodeFamily == i_NEGX ) || ( OpcodeFamily == i_NOT ) )
-			;						/* Do nothing, the write is done during the last 4 cycles */
-									/* (e.g i_CLR for bottom border removal in No Scroll / Delirious Demo 4) */
+	/* BUS_MODE_CPU */
+	/* TODO: Find proper cycles count depending on the type of the current instruction */
+	/* (e.g. movem is not correctly handled) */
+	AddCycles = CurrentInstrCycles + nWaitStateCycles;
 
-		else if ( ( OpcodeFamily == i_ADD ) || ( OpcodeFamily == i_SUB ) )
-			;						/* Do nothing, the write is done during the last 4 cycles */
-									/* (eg 'add d1,(a0)' in rasters.prg by TOS Crew */
-
-		else if ( ( OpcodeFamily == i_AND ) || ( OpcodeFamily == i_OR ) || ( OpcodeFamily == i_EOR ) )
-			;						/* Do nothing, the write is done during the last 4 cycles */
-
-		else if ( ( OpcodeFamily == i_BCHG ) || ( OpcodeFamily == i_BCLR ) || ( OpcodeFamily == i_BSET ) )
-			;						/* Do nothing, the write is done during the last 4 cycles */
-
-		else
-		{
-			/* assume the behaviour of a 'move' (since this is the most */
-			/* common instr used when requiring cycle precise writes) */
-			if ( AddCycles >= 8 )
-				AddCycles -= 4;			/* last 4 cycles are for prefetch */
-		}
-	}
+	if ( ( CyclesWriteAccess[ OpcodeFamily ] == CYCLES_WRITE_PREFETCH ) && ( AddCycles >= 8 ) )
+		AddCycles -= 4;					/* last 4 cycles are for prefetch */
 
 	return AddCycles;
 }
@@ -2436,6 +2436,102 @@ static void		Disass68kComposeStr(char *dbuf, const char *str, int position, int
 	dbuf[len+i] = 0;
 }
 
+/* Cache for the Disass68k() results, so that history, trace and the
+ * debugger views don't search the opcode table again for the same hot
+ * code. Entries are looked up by address and are valid only while the
+ * code words they were decoded from are unchanged in the emulated memory
+ * and the disassembly options stay the same (generation).
+ */
+#define DISASM_CACHE_SIZE	4096	/* power of 2 */
+#define DISASM_CACHE_WORDS	12	/* longest instruction is 11 words */
+#define DISASM_CACHE_TEXT	224
+
+typedef struct {
+	Uint32	addr;
+	Uint32	generation;		// 0 = unused entry
+	int	len;
+	Uint16	words[DISASM_CACHE_WORDS];
+	Uint8	offset[3];		// of opcode, operand and comment in text
+	char	text[DISASM_CACHE_TEXT];	// label, opcode, operand, comment
+} disCacheEntry;
+
+static disCacheEntry	*disCache;
+static Uint32		disCacheGeneration = 1;
+
+/**
+ * Forget all cached disassembly, after the options changed
+ */
+static void Disass68kCacheFlush(void)
+{
+	if (++disCacheGeneration == 0)
+		disCacheGeneration = 1;
+}
+
+/**
+ * Disass68k() with caching. All code words that the opcode table search
+ * may read (also for the rejected longer opcodes) are compared, so longer
+ * results like DC.x data lines aren't cached.
+ */
+static int Disass68kCached(Uint32 addr, char *labelBuffer, char *opcodeBuffer, char *operandBuffer, char *commentBuffer)
+{
+	Uint16 words[DISASM_CACHE_WORDS];
+	const char *strs[4];
+	disCacheEntry *entry;
+	size_t sizes[4], total;
+	int i, len;
+
+	if (!disCache)
+	{
+		disCache = calloc(DISASM_CACHE_SIZE, sizeof(*disCache));
+		if (!disCache)
+			return Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+	}
+	for (i = 0; i < DISASM_CACHE_WORDS; i++)
+		words[i] = Disass68kGetWord(addr + 2*i);
+
+	entry = &disCache[(addr >> 1) & (DISASM_CACHE_SIZE - 1)];
+	if (entry->generation == disCacheGeneration && entry->addr == addr &&
+	    memcmp(entry->words, words, sizeof(words)) == 0)
+	{
+		strcpy(labelBuffer, entry->text);
+		strcpy(opcodeBuffer, entry->text + entry->offset[0]);
+		strcpy(operandBuffer, entry->text + entry->offset[1]);
+		strcpy(commentBuffer, entry->text + entry->offset[2]);
+		return entry->len;
+	}
+
+	len = Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+	if (len <= 0 || len > 2 * DISASM_CACHE_WORDS)
+		return len;
+
+	strs[0] = labelBuffer;
+	strs[1] = opcodeBuffer;
+	strs[2] = operandBuffer;
+	strs[3] = commentBuffer;
+	total = 0;
+	for (i = 0; i < 4; i++)
+	{
+		sizes[i] = strlen(strs[i]) + 1;
+		total += sizes[i];
+	}
+	if (total > DISASM_CACHE_TEXT)
+		return len;
+
+	total = 0;
+	for (i = 0; i < 4; i++)
+	{
+		if (i)
+			entry->offset[i-1] = total;
+		memcpy(entry->text + total, strs[i], sizes[i]);
+		total += sizes[i];
+	}
+	memcpy(entry->words, words, sizeof(words));
+	entry->addr = addr;
+	entry->len = len;
+	entry->generation = disCacheGeneration;
+	return len;
+}
+
 static void Disass68k_loop (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt)
 {
 	static bool	isInit = false;
@@ -2457,7 +2553,7 @@ static void Disass68k_loop (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt)
 		char	commentBuffer[256];
 		int	plen, len, j;
 
-		len = Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+		len = Disass68kCached(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
 		if(!len) break;
 
 		sprintf(addressBuffer, "$%*.*x :", addrWidth,addrWidth, addr);
@@ -2641,6 +2737,7 @@ void Disasm_SetCPUType ( int CPU , int FPU )
 		case 4 :	optionCPUTypeMask |= MC68040 ; break;
 		default :	optionCPUTypeMask |= MC68000 ; break;
 	}	
+	Disass68kCacheFlush();
 }
 
 /**
@@ -2700,6 +2797,7 @@ const char *Disasm_ParseOption(const char *arg)
 		}
 		fprintf(stderr, "Changed CPU disassembly output flags from %d to %d.\n", options, newopt);
 		ConfigureParams.Debugger.nDisasmOptions = options = newopt;
+		Disass68kCacheFlush();
 		Disasm_CheckOptionEngine();
 		return NULL;
 	}
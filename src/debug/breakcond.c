@@ -104,12 +104,28 @@ typedef struct {
 	bc_condition_t *conditions;
 	int ccount;	/* condition count */
 	int hits;	/* how many times breakpoint hit */
+	bool has_pc;	/* whether (PC & pc_mask) == pc_value is required */
+	Uint32 pc_mask;
+	Uint32 pc_value;
 } bc_breakpoint_t;
 
+/* PC values of breakpoints, hashed into a bitmap so that
+ * for most instructions a single probe tells that none
+ * of the breakpoints can match
+ */
+#define BC_PCFILTER_BITS 4096
+
+typedef struct {
+	bool valid;	/* all breakpoints have a PC with the same mask */
+	Uint32 mask;
+	Uint32 bits[BC_PCFILTER_BITS/32];
+} bc_pcfilter_t;
+
 static bc_breakpoint_t *BreakPointsCpu;
 static bc_breakpoint_t *BreakPointsDsp;
 static int BreakPointCpuCount, BreakPointCpuAllocated;
 static int BreakPointDspCount, BreakPointDspAllocated;
+static bc_pcfilter_t PcFilterCpu, PcFilterDsp;
 
 
 /* forward declarations */
@@ -311,17 +327,43 @@ static bool BreakCond_MatchConditions(bc_condition_t *condition, int count)
 }
 
 
+/**
+ * Return PC filter bitmap index for given (masked) PC value
+ */
+static inline Uint32 BreakCond_PcHash(Uint32 pc)
+{
+	return (pc ^ (pc >> 12)) & (BC_PCFILTER_BITS-1);
+}
+
+/**
+ * Return false if none of the breakpoints in given filter
+ * can match at given PC
+ */
+static inline bool BreakCond_PcFilterMatch(const bc_pcfilter_t *filter, Uint32 pc)
+{
+	Uint32 idx;
+
+	if (!filter->valid) {
+		return true;
+	}
+	idx = BreakCond_PcHash(pc & filter->mask);
+	return filter->bits[idx >> 5] & (1U << (idx & 31));
+}
+
 /**
  * Show all breakpoints which conditions matched and return which matched
  * @return	index to last matching (non-tracing) breakpoint,
  *		or zero if none matched
  */
-static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char *name)
+static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char *name, Uint32 pc)
 {
 	int i, ret = 0;
 
 	for (i = 0; i < count; bp++, i++) {
 
+		if (bp->has_pc && (pc & bp->pc_mask) != bp->pc_value) {
+			continue;
+		}
 		if (BreakCond_MatchConditions(bp->conditions, bp->ccount)) {
 			bool for_dsp;
 
@@ -380,7 +422,12 @@ static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char
  */
 int BreakCond_MatchCpu(void)
 {
-	return BreakCond_MatchBreakPoints(BreakPointsCpu, BreakPointCpuCount, "CPU");
+	Uint32 pc = M68000_GetPC();
+
+	if (!BreakCond_PcFilterMatch(&PcFilterCpu, pc)) {
+		return 0;
+	}
+	return BreakCond_MatchBreakPoints(BreakPointsCpu, BreakPointCpuCount, "CPU", pc);
 }
 
 /**
@@ -388,7 +435,76 @@ int BreakCond_MatchCpu(void)
  */
 int BreakCond_MatchDsp(void)
 {
-	return BreakCond_MatchBreakPoints(BreakPointsDsp, BreakPointDspCount, "DSP");
+	Uint32 pc = DSP_GetPC();
+
+	if (!BreakCond_PcFilterMatch(&PcFilterDsp, pc)) {
+		return 0;
+	}
+	return BreakCond_MatchBreakPoints(BreakPointsDsp, BreakPointDspCount, "DSP", pc);
+}
+
+#if !ENABLE_WINUAE_CPU
+/**
+ * If given value is a number or a value at a fixed ST RAM address,
+ * mark the bank(s) of that address and return true, otherwise false.
+ */
+static bool BreakCond_WatchValue(const bc_value_t *bc_value, bool *banks)
+{
+	Uint32 addr, last;
+
+	if (bc_value->valuetype != VALUE_TYPE_NUMBER || bc_value->dsp_space) {
+		return false;
+	}
+	if (!bc_value->is_indirect) {
+		return true;
+	}
+	addr = bc_value->value.number & 0x00ffffff;
+	last = addr + bc_value->bits/8 - 1;
+	if (last >= STRamEnd) {
+		return false;
+	}
+	banks[addr >> 16] = true;
+	banks[last >> 16] = true;
+	return true;
+}
+#endif
+
+/**
+ * When all CPU breakpoint conditions depend only on values at fixed
+ * ST RAM addresses, they can change only when that RAM is written.
+ * In that case (and if 'enable' is set) watch writes to the memory
+ * banks containing those addresses instead of checking breakpoints
+ * after every instruction, otherwise remove the watches.
+ * Return true if the watches are in use.
+ */
+bool BreakCond_SetCpuWatches(bool enable)
+{
+#if ENABLE_WINUAE_CPU
+	return false;
+#else
+	bc_condition_t *condition;
+	bool banks[256];
+	int i, j;
+
+	memset(banks, 0, sizeof(banks));
+	if (!BreakPointCpuCount) {
+		enable = false;
+	}
+	for (i = 0; enable && i < BreakPointCpuCount; i++) {
+		condition = BreakPointsCpu[i].conditions;
+		for (j = 0; j < BreakPointsCpu[i].ccount; condition++, j++) {
+			if (!(BreakCond_WatchValue(&(condition->lvalue), banks) &&
+			      BreakCond_WatchValue(&(condition->rvalue), banks))) {
+				enable = false;
+				break;
+			}
+		}
+	}
+	for (i = 0; i < 256; i++) {
+		memory_watch_bank(i, MEMORY_WATCH_DEBUGGER, enable && banks[i]);
+	}
+	return enable;
+#endif
 }
 
 /**
@@ -1384,6 +1500,87 @@ static void BreakCond_CheckTracking(bc_breakpoint_t *bp)
 }
 
 
+/**
+ * Check whether the breakpoint has a "pc = <number>" condition and
+ * store it so that the breakpoint can be skipped without evaluating
+ * its other conditions when PC doesn't match.  Only conditions before
+ * the first tracked one qualify, as tracked values need to be updated
+ * whenever the conditions preceding them match.
+ */
+static void BreakCond_CheckPC(bc_breakpoint_t *bp, bool bForDsp)
+{
+	bc_condition_t *condition;
+	Uint32 *dsp_pc = NULL, mask;
+	int i;
+
+	if (bForDsp && !DSP_GetRegisterAddress("PC", &dsp_pc, &mask)) {
+		return;
+	}
+	condition = bp->conditions;
+	for (i = 0; i < bp->ccount && !condition->track; condition++, i++) {
+
+		if (condition->comparison != '=' ||
+		    condition->lvalue.is_indirect ||
+		    condition->rvalue.is_indirect ||
+		    condition->rvalue.valuetype != VALUE_TYPE_NUMBER) {
+			continue;
+		}
+		if (bForDsp) {
+			if (condition->lvalue.valuetype != VALUE_TYPE_REG16 ||
+			    condition->lvalue.value.reg16 != (Uint16 *)dsp_pc) {
+				continue;
+			}
+		} else {
+			if (condition->lvalue.valuetype != VALUE_TYPE_FUNCTION32 ||
+			    condition->lvalue.value.func32 != GetCpuPC) {
+				continue;
+			}
+		}
+		bp->has_pc = true;
+		bp->pc_mask = condition->lvalue.mask;
+		bp->pc_value = condition->rvalue.value.number & condition->rvalue.mask;
+		return;
+	}
+}
+
+
+/**
+ * Rebuild PC filter for the given breakpoint list.  Filter can
+ * be used only when all of the breakpoints have a PC condition
+ * with the same mask.
+ */
+static void BreakCond_UpdatePcFilter(bool bForDsp)
+{
+	bc_pcfilter_t *filter;
+	bc_breakpoint_t *bp;
+	int i, count;
+	Uint32 idx;
+
+	if (bForDsp) {
+		filter = &PcFilterDsp;
+		bp = BreakPointsDsp;
+		count = BreakPointDspCount;
+	} else {
+		filter = &PcFilterCpu;
+		bp = BreakPointsCpu;
+		count = BreakPointCpuCount;
+	}
+	memset(filter, 0, sizeof(*filter));
+	if (!count || !bp[0].has_pc) {
+		return;
+	}
+	filter->mask = bp[0].pc_mask;
+	for (i = 0; i < count; bp++, i++) {
+		if (!bp->has_pc || bp->pc_mask != filter->mask) {
+			return;
+		}
+		idx = BreakCond_PcHash(bp->pc_value);
+		filter->bits[idx >> 5] |= 1U << (idx & 31);
+	}
+	filter->valid = true;
+}
+
+
 /**
  * Parse given breakpoint expression and store it.
  * Return true for success and false for failure.
@@ -1447,6 +1644,8 @@ static bool BreakCond_Parse(const char *expression, bc_options_t *options, bool
 			}
 		}
 		BreakCond_CheckTracking(bp);
+		BreakCond_CheckPC(bp, bForDsp);
+		BreakCond_UpdatePcFilter(bForDsp);
 
 		bp->options.quiet = options->quiet;
 		bp->options.skip = options->skip;
@@ -1573,10 +1772,43 @@ static bool BreakCond_Remove(int position, bool bForDsp)
 			(*bcount-position)*sizeof(bc_breakpoint_t));
 	}
 	(*bcount)--;
+	BreakCond_UpdatePcFilter(bForDsp);
 	return true;
 }
 
 
+/**
+ * Remove breakpoint with given expression (without options),
+ * return true if there was one.
+ */
+bool BreakCond_RemoveExpression(const char *expression, bool bForDsp)
+{
+	parser_state_t pstate;
+	bc_breakpoint_t *bp;
+	const char *name;
+	char *normalized;
+	int *bcount, i;
+	bool ret = false;
+
+	normalized = BreakCond_TokenizeExpression(expression, &pstate);
+	if (pstate.argv) {
+		free(pstate.argv);
+	}
+	if (!normalized) {
+		return false;
+	}
+	bcount = BreakCond_GetListInfo(&bp, &name, bForDsp);
+	for (i = 0; i < *bcount; i++) {
+		if (strcmp(bp[i].expression, normalized) == 0) {
+			ret = BreakCond_Remove(i+1, bForDsp);
+			break;
+		}
+	}
+	free(normalized);
+	return ret;
+}
+
+
 /**
  * Remove all condition breakpoints
  */
@@ -23,7 +23,9 @@ extern const char BreakAddr_Description[];
 extern int BreakCond_MatchCpu(void);
 extern int BreakCond_MatchDsp(void);
 extern int BreakCond_BreakPointCount(bool bForDsp);
+extern bool BreakCond_SetCpuWatches(bool enable);
 extern bool BreakCond_Command(const char *expression, bool bForDsp);
+extern bool BreakCond_RemoveExpression(const char *expression, bool bForDsp);
 extern bool BreakAddr_Command(char *expression, bool bforDsp);
 
 /* extra functions exported for the test code */
@@ -12,6 +12,7 @@ const char DebugInfo_fileid[] = "Hatari debuginfo.c : " __DATE__ " " __TIME__;
 #include <stdio.h>
 #include <assert.h>
 #include <ctype.h>
+#include <zlib.h>
 
 #include "main.h"
 #include "bios.h"
@@ -30,6 +31,7 @@ const char DebugInfo_fileid[] = "Hatari debuginfo.c : " __DATE__ " " __TIME__;
 #include "history.h"
 #include "ioMem.h"
 #include "m68000.h"
+#include "perfcount.h"
 #include "psg.h"
 #include "stMemory.h"
 #include "tos.h"
@@ -560,6 +562,66 @@ static Uint32 DebugInfo_FileArgs(int argc, char *argv[])
 }
 
 
+/* ------------------------------------------------------------------
+ * Emulation state hash
+ */
+
+/**
+ * Add given values to the CRC in big endian byte order, so that
+ * the hash doesn't depend on the host endianness
+ */
+static Uint32 DebugInfo_HashValues(Uint32 crc, const Uint32 *values, int count)
+{
+	Uint8 buf[4];
+	int i;
+
+	for (i = 0; i < count; i++) {
+		buf[0] = values[i] >> 24;
+		buf[1] = values[i] >> 16;
+		buf[2] = values[i] >> 8;
+		buf[3] = values[i];
+		crc = crc32(crc, buf, sizeof(buf));
+	}
+	return crc;
+}
+
+/**
+ * Return CRC32 of the CPU registers, ST RAM, YM registers and
+ * (when enabled) DSP registers & memory.  Used to verify that
+ * emulation changes give bit-identical results at given checkpoints.
+ */
+Uint32 DebugInfo_StateHash(void)
+{
+	Uint32 crc, value;
+
+	crc = crc32(0, Z_NULL, 0);
+	crc = DebugInfo_HashValues(crc, (const Uint32 *)Regs, 16);
+	value = M68000_GetPC();
+	crc = DebugInfo_HashValues(crc, &value, 1);
+	value = M68000_GetSR();
+	crc = DebugInfo_HashValues(crc, &value, 1);
+
+	crc = crc32(crc, STRam, STRamEnd);
+	crc = crc32(crc, PSGRegisters, MAX_PSG_REGISTERS);
+#if ENABLE_DSP_EMU
+	if (bDspEnabled) {
+		crc = DebugInfo_HashValues(crc, dsp_core.registers, ARRAYSIZE(dsp_core.registers));
+		crc = DebugInfo_HashValues(crc, &dsp_core.ramint[0][0], 3*512);
+		crc = DebugInfo_HashValues(crc, dsp_core.ramext, DSP_RAMSIZE);
+	}
+#endif
+	return crc;
+}
+
+/**
+ * Show emulation state hash
+ */
+static void DebugInfo_Hash(Uint32 dummy)
+{
+	fprintf(stderr, "VBL %d: state hash $%08x\n", nVBLs, DebugInfo_StateHash());
+}
+
+
 /* ------------------------------------------------------------------
  * Debugger & readline TAB completion integration
  */
@@ -608,9 +670,11 @@ static const struct {
 #endif
 	{ true, "file",      DebugInfo_FileParse, DebugInfo_FileArgs, "Parse commands from given debugger input <file>" },
 	{ false,"gemdos",    GemDOS_Info,          NULL, "Show GEMDOS HDD emu information (with <value>, show opcodes)" },
+	{ false,"hash",      DebugInfo_Hash,       NULL, "Show CRC of CPU, DSP & YM registers and RAM, for comparing runs" },
 	{ true, "history",   History_Show,         NULL, "Show history of last <count> instructions" },
 	{ true, "memdump",   DebugInfo_CpuMemDump, NULL, "Dump CPU memory from given <address>" },
 	{ false,"osheader",  DebugInfo_OSHeader,   NULL, "Show TOS OS header contents" },
+	{ false,"perfcount", PerfCount_Info,       NULL, "Show host time per emulation subsystem, log it every <value> seconds (0=off)" },
 	{ true, "regaddr",   DebugInfo_RegAddr, DebugInfo_RegAddrArgs, "Show <disasm|memdump> from CPU/DSP address pointed by <register>" },
 	{ true, "registers", DebugInfo_CpuRegister,NULL, "Show CPU register contents" },
 	{ false,"vdi",       VDI_Info,             NULL, "Show VDI vector contents (with <value>, show opcodes)" },
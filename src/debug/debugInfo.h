@@ -16,6 +16,9 @@ extern Uint32 DebugInfo_GetTEXTEnd(void);
 extern Uint32 DebugInfo_GetDATA(void);
 extern Uint32 DebugInfo_GetBSS(void);
 
+/* for main.c */
+extern Uint32 DebugInfo_StateHash(void);
+
 /* for debugui.c */
 extern void DebugInfo_ShowSessionInfo(void);
 extern char *DebugInfo_MatchInfo(const char *text, int state);
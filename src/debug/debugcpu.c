@@ -27,6 +27,8 @@ const char DebugCpu_fileid[] = "Hatari debugcpu.c : " __DATE__ " " __TIME__;
 #include "m68000.h"
 #include "memorySnapShot.h"
 #include "profile.h"
+#include "sampler.h"
+#include "timeline.h"
 #include "stMemory.h"
 #include "str.h"
 #include "symbols.h"
@@ -44,6 +46,7 @@ static Uint32 memdump_addr;    /* memdump address */
 static bool bCpuProfiling;     /* Whether CPU profiling is activated */
 static int nCpuActiveCBs = 0;  /* Amount of active conditional breakpoints */
 static int nCpuSteps = 0;      /* Amount of steps for CPU single-stepping */
+static bool bCpuWatchOnly;     /* Whether breakpoints are checked only on watched memory writes */
 
 
 /**
@@ -477,6 +480,15 @@ static int DebugCpu_Continue(int nArgc, char *psArgv[])
 	return DEBUGGER_END;
 }
 
+/**
+ * Set how many CPU instructions to run before invoking the debugger
+ * again, 0 to run until a breakpoint is hit
+ */
+void DebugCpu_SetSteps(int steps)
+{
+	nCpuSteps = steps;
+}
+
 /**
  * Command: Single-step CPU
  */
@@ -642,6 +654,11 @@ void DebugCpu_Check(void)
 	{
 		Console_Check();
 	}
+	if (bCpuWatchOnly)
+	{
+		/* next check only after watched memory is written */
+		M68000_UnsetSpecial(SPCFLAG_DEBUGGER);
+	}
 }
 
 /**
@@ -654,6 +671,14 @@ void DebugCpu_SetDebugging(void)
 	bCpuProfiling = Profile_CpuStart();
 	nCpuActiveCBs = BreakCond_BreakPointCount(false);
 
+	/* breakpoints depending only on RAM values need to be checked
+	 * only after that RAM has been written, if nothing else needs
+	 * checks after every instruction
+	 */
+	bCpuWatchOnly = BreakCond_SetCpuWatches(!(nCpuSteps || bCpuProfiling || History_TrackCpu()
+	    || LOG_TRACE_LEVEL((TRACE_CPU_DISASM|TRACE_CPU_SYMBOLS))
+	    || ConOutDevice != CONOUT_DEVICE_NONE));
+
 	if (nCpuActiveCBs || nCpuSteps || bCpuProfiling || History_TrackCpu()
 	    || LOG_TRACE_LEVEL((TRACE_CPU_DISASM|TRACE_CPU_SYMBOLS))
 	    || ConOutDevice != CONOUT_DEVICE_NONE)
@@ -692,6 +717,16 @@ static const dbgcommand_t cpucommands[] =
 	  "profile CPU code",
 	  Profile_Description,
 	  false },
+	{ Sampler_Command, Sampler_Match,
+	  "sample", "",
+	  "sample CPU state periodically, for low overhead profiling",
+	  Sampler_Description,
+	  false },
+	{ Timeline_Command, Timeline_Match,
+	  "timeline", "",
+	  "record bus usage and interrupts per scanline",
+	  Timeline_Description,
+	  false },
 	{ DebugCpu_Register, DebugCpu_MatchRegister,
 	  "cpureg", "r",
 	  "dump register values or set register to value",
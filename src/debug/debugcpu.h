@@ -12,6 +12,7 @@
 
 extern void DebugCpu_Check(void);
 extern void DebugCpu_SetDebugging(void);
+extern void DebugCpu_SetSteps(int steps);
 extern Uint32 DebugCpu_InstrCount(void);
 extern Uint32 DebugCpu_OpcodeType(void);
 extern int DebugCpu_DisAsm(int nArgc, char *psArgs[]);
@@ -42,6 +42,7 @@ const char DebugUI_fileid[] = "Hatari debugui.c : " __DATE__ " " __TIME__;
 #include "debugInfo.h"
 #include "debugui.h"
 #include "evaluate.h"
+#include "gdbstub.h"
 #include "history.h"
 #include "symbols.h"
 
@@ -879,12 +880,15 @@ static const dbgcommand_t uicommand[] =
 	{ History_Parse, History_Match,
 	  "history", "hi",
 	  "show last CPU/DSP PC values & executed instructions",
-	  "cpu|dsp|on|off|<count> [limit]|save <file>\n"
+	  "cpu|dsp|on|off|<count> [limit]|save <file>|dump <file>|load <file>\n"
 	  "\t'cpu' and 'dsp' enable instruction history tracking for just given\n"
 	  "\tprocessor, 'on' tracks them both, 'off' will disable history.\n"
 	  "\tOptional 'limit' will set how many past instructions are tracked.\n"
 	  "\tGiving just count will show (at max) given number of last saved PC\n"
-	  "\tvalues and instructions currently at corresponding RAM addresses.",
+	  "\tvalues and instructions currently at corresponding RAM addresses.\n"
+	  "\t'save' writes them disassembled to a file, 'dump' writes just the\n"
+	  "\tPC values in a compact binary form which 'load' can read back\n"
+	  "\tfor showing them later.",
 	  false },
 	{ DebugInfo_Command, DebugInfo_MatchInfo,
 	  "info", "i",
@@ -1026,6 +1030,12 @@ void DebugUI(debug_reason_t reason)
 
 	History_Mark(reason);
 
+	if (GdbStub_Connected())
+	{
+		GdbStub_Stop(reason);
+		return;
+	}
+
 	if (bInFullScreen)
 		Screen_ReturnFromFullScreen();
 
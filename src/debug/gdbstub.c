@@ -0,0 +1,670 @@
+/*
+ * Hatari - gdbstub.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * gdbstub.c - GDB remote serial protocol server, so that GDB (or an IDE
+ * using it) can debug the emulated CPU code over TCP.  Memory is read
+ * directly from ST RAM in large blocks, and GDB breakpoints & write
+ * watchpoints are converted to (quiet) conditional breakpoints, so
+ * they use the same fast checks as the ones set from the debugger.
+ *
+ * While GDB is connected, it replaces the console debugger: breaks and
+ * steps stop the emulation and wait for GDB commands.  A connection
+ * is accepted, and interrupts (Ctrl-C) from GDB checked, once a VBL.
+ */
+const char GdbStub_fileid[] = "Hatari gdbstub.c : " __DATE__ " " __TIME__;
+
+#include "config.h"
+
+#if HAVE_TCP_SOCKETS
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <ctype.h>
+
+#include "main.h"
+#include "breakcond.h"
+#include "debugcpu.h"
+#include "debugdsp.h"
+#include "gdbstub.h"
+#include "log.h"
+#include "m68000.h"
+#include "stMemory.h"
+
+#define GDB_PACKET_MAX	4096	/* payload chars, i.e. 2KB of memory per 'm' */
+
+#define GDB_SIGINT	2
+#define GDB_SIGTRAP	5
+
+/* GDB m68k register numbers: d0-d7, a0-a7, then these */
+#define GDB_REG_SR	16
+#define GDB_REG_PC	17
+#define GDB_REGS	18
+
+typedef enum {
+	GDB_STAY,	/* stay stopped, wait for next packet */
+	GDB_CONTINUE,
+	GDB_STEP,
+	GDB_DETACH
+} gdb_action_t;
+
+static int ListenSocket = -1;
+static int GdbSocket = -1;
+static bool bNoAck;		/* GDB asked for no packet acknowledgements */
+
+static Uint8 RecvBuffer[GDB_PACKET_MAX];
+static int RecvPos, RecvLen;
+static char Packet[GDB_PACKET_MAX+1];
+static char Reply[GDB_PACKET_MAX+1];
+static char SendBuffer[GDB_PACKET_MAX+4];
+
+static const char HexChars[] = "0123456789abcdef";
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return value of given hex digit, or -1 if it isn't one
+ */
+static int GdbStub_HexValue(int c)
+{
+	const char *digit;
+
+	if (c <= 0 || !(digit = strchr(HexChars, tolower(c))))
+		return -1;
+	return digit - HexChars;
+}
+
+/**
+ * Close GDB connection
+ */
+static void GdbStub_Close(void)
+{
+	close(GdbSocket);
+	GdbSocket = -1;
+	RecvPos = RecvLen = 0;
+	bNoAck = false;
+	Log_Printf(LOG_INFO, "GDB disconnected.\n");
+}
+
+/**
+ * Return next character from GDB, or -1 if connection was closed
+ */
+static int GdbStub_GetChar(void)
+{
+	ssize_t bytes;
+
+	if (RecvPos == RecvLen)
+	{
+		bytes = read(GdbSocket, RecvBuffer, sizeof(RecvBuffer));
+		if (bytes <= 0)
+			return -1;
+		RecvPos = 0;
+		RecvLen = bytes;
+	}
+	return RecvBuffer[RecvPos++];
+}
+
+/**
+ * Write given data to GDB, return false on failure
+ */
+static bool GdbStub_Write(const char *data, size_t len)
+{
+	ssize_t bytes;
+
+	while (len)
+	{
+		bytes = write(GdbSocket, data, len);
+		if (bytes <= 0)
+			return false;
+		data += bytes;
+		len -= bytes;
+	}
+	return true;
+}
+
+/**
+ * Read next packet payload to Packet, acknowledging it unless
+ * GDB has disabled that.  Return false if connection was closed.
+ */
+static bool GdbStub_ReadPacket(void)
+{
+	Uint8 sum;
+	int c, len, hi, lo;
+
+	for (;;)
+	{
+		/* skip acks and interrupts, emulation is stopped already */
+		do {
+			if ((c = GdbStub_GetChar()) < 0)
+				return false;
+		} while (c != '$');
+
+		sum = len = 0;
+		while ((c = GdbStub_GetChar()) != '#')
+		{
+			if (c < 0)
+				return false;
+			if (len < GDB_PACKET_MAX)
+				Packet[len++] = c;
+			sum += c;
+		}
+		Packet[len] = '\0';
+		if ((hi = GdbStub_GetChar()) < 0 || (lo = GdbStub_GetChar()) < 0)
+			return false;
+		if (bNoAck)
+			return true;
+		if (GdbStub_HexValue(hi) * 16 + GdbStub_HexValue(lo) == sum)
+			return GdbStub_Write("+", 1);
+		if (!GdbStub_Write("-", 1))
+			return false;
+	}
+}
+
+/**
+ * Send given packet payload to GDB, and unless acknowledgements
+ * are disabled, resend it until GDB acknowledges it.
+ * Return false if connection was closed.
+ */
+static bool GdbStub_SendPacket(const char *data)
+{
+	Uint8 sum = 0;
+	int c, len = 0;
+
+	SendBuffer[len++] = '$';
+	while (*data && len < GDB_PACKET_MAX+1)
+	{
+		sum += *data;
+		SendBuffer[len++] = *data++;
+	}
+	SendBuffer[len++] = '#';
+	SendBuffer[len++] = HexChars[sum >> 4];
+	SendBuffer[len++] = HexChars[sum & 15];
+
+	do {
+		if (!GdbStub_Write(SendBuffer, len))
+			return false;
+		if (bNoAck)
+			return true;
+		do {
+			if ((c = GdbStub_GetChar()) < 0)
+				return false;
+		} while (c != '+' && c != '-');
+	} while (c == '-');
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Parse hex number from 'src' to 'value', return pointer to
+ * first character after it
+ */
+static const char *GdbStub_GetHex(const char *src, Uint32 *value)
+{
+	int digit;
+
+	*value = 0;
+	while ((digit = GdbStub_HexValue((unsigned char)*src)) >= 0)
+	{
+		*value = (*value << 4) | digit;
+		src++;
+	}
+	return src;
+}
+
+/**
+ * Write 'value' as 'digits' hex digits to 'dst', return end of it
+ */
+static char *GdbStub_PutHex(char *dst, Uint32 value, int digits)
+{
+	while (digits--)
+		*dst++ = HexChars[(value >> (digits * 4)) & 15];
+	*dst = '\0';
+	return dst;
+}
+
+/**
+ * Return value of given GDB register number
+ */
+static Uint32 GdbStub_GetRegister(int reg)
+{
+	if (reg == GDB_REG_SR)
+		return M68000_GetSR();
+	if (reg == GDB_REG_PC)
+		return M68000_GetPC();
+	return Regs[reg];
+}
+
+/**
+ * Set value of given GDB register number
+ */
+static void GdbStub_SetRegister(int reg, Uint32 value)
+{
+	if (reg == GDB_REG_SR)
+		M68000_SetSR(value);
+	else if (reg == GDB_REG_PC)
+		M68000_SetPC(value);
+	else
+		Regs[reg] = value;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Handle 'm<addr>,<len>': hex dump of memory, straight from ST RAM
+ * when possible, otherwise from ROM
+ */
+static void GdbStub_ReadMemory(const char *args)
+{
+	Uint32 addr, len, i;
+	char *dst = Reply;
+
+	args = GdbStub_GetHex(args, &addr);
+	if (*args++ != ',')
+	{
+		strcpy(Reply, "E01");
+		return;
+	}
+	GdbStub_GetHex(args, &len);
+	if (len > GDB_PACKET_MAX/2)
+		len = GDB_PACKET_MAX/2;
+
+	if (addr < STRamEnd && len <= STRamEnd - addr)
+	{
+		const Uint8 *src = &STRam[addr];
+		for (i = 0; i < len; i++)
+		{
+			*dst++ = HexChars[src[i] >> 4];
+			*dst++ = HexChars[src[i] & 15];
+		}
+		*dst = '\0';
+	}
+	else if (addr + len > addr && STMemory_ValidArea(addr, len))
+	{
+		for (i = 0; i < len; i++)
+			dst = GdbStub_PutHex(dst, STMemory_ReadByte(addr + i), 2);
+	}
+	else
+		strcpy(Reply, "E01");
+}
+
+/**
+ * Handle 'M<addr>,<len>:<hex data>': write to ST RAM
+ */
+static void GdbStub_WriteMemory(const char *args)
+{
+	Uint32 addr, len, i, value;
+	char byte[3];
+
+	args = GdbStub_GetHex(args, &addr);
+	if (*args++ != ',')
+	{
+		strcpy(Reply, "E01");
+		return;
+	}
+	args = GdbStub_GetHex(args, &len);
+	if (*args++ != ':' || strlen(args) < 2*len ||
+	    addr >= STRamEnd || len > STRamEnd - addr)
+	{
+		strcpy(Reply, "E01");
+		return;
+	}
+	byte[2] = '\0';
+	for (i = 0; i < len; i++)
+	{
+		byte[0] = *args++;
+		byte[1] = *args++;
+		GdbStub_GetHex(byte, &value);
+		STRam[addr + i] = value;
+	}
+	STMemory_SetDirtyArea(addr, len);
+	strcpy(Reply, "OK");
+}
+
+/**
+ * Handle 'Z<type>,<addr>,<kind>' and 'z<type>,<addr>,<kind>'
+ * for code breakpoints and write watchpoints
+ */
+static void GdbStub_Breakpoint(const char *args, bool bAdd)
+{
+	static const char sizes[] = { 0, 'b', 'w', 0, 'l' };
+	Uint32 type, addr, kind;
+	char expression[64];
+	bool ok;
+
+	args = GdbStub_GetHex(args, &type);
+	if (*args++ != ',')
+	{
+		strcpy(Reply, "E01");
+		return;
+	}
+	args = GdbStub_GetHex(args, &addr);
+	if (*args++ != ',')
+	{
+		strcpy(Reply, "E01");
+		return;
+	}
+	GdbStub_GetHex(args, &kind);
+
+	if (type == 0 || type == 1)
+	{
+		sprintf(expression, "pc=$%x", addr);
+	}
+	else if (type == 2 && kind < sizeof(sizes) && sizes[kind])
+	{
+		sprintf(expression, "($%x).%c ! ($%x).%c",
+			addr, sizes[kind], addr, sizes[kind]);
+	}
+	else
+	{
+		/* read & access watchpoints are not supported */
+		Reply[0] = '\0';
+		return;
+	}
+
+	if (bAdd)
+	{
+		strcat(expression, " :quiet");
+		ok = BreakCond_Command(expression, false);
+	}
+	else
+		ok = BreakCond_RemoveExpression(expression, false);
+	strcpy(Reply, ok ? "OK" : "E01");
+}
+
+/**
+ * Handle 'c/s[addr]' and 'C/S<sig>[;addr]' resume packets
+ */
+static gdb_action_t GdbStub_Resume(const char *args, bool bSignal, bool bStep)
+{
+	Uint32 addr;
+
+	if (bSignal)
+	{
+		/* signals aren't passed to emulated code */
+		args = strchr(args, ';');
+		args = args ? args + 1 : "";
+	}
+	if (*args)
+	{
+		GdbStub_GetHex(args, &addr);
+		M68000_SetPC(addr);
+	}
+	return bStep ? GDB_STEP : GDB_CONTINUE;
+}
+
+/**
+ * Handle packet in Packet, put reply to Reply and return
+ * what should be done next
+ */
+static gdb_action_t GdbStub_HandlePacket(const char *stop)
+{
+	const char *args = Packet + 1;
+	char *dst;
+	Uint32 reg, value;
+	int i;
+
+	Reply[0] = '\0';
+	switch (Packet[0])
+	{
+	case '?':
+		strcpy(Reply, stop);
+		break;
+	case 'g':
+		dst = Reply;
+		for (i = 0; i < GDB_REGS; i++)
+			dst = GdbStub_PutHex(dst, GdbStub_GetRegister(i), 8);
+		break;
+	case 'G':
+		if (strlen(args) < GDB_REGS*8)
+		{
+			strcpy(Reply, "E01");
+			break;
+		}
+		for (i = 0; i < GDB_REGS; i++)
+		{
+			char hex[9];
+			memcpy(hex, args + i*8, 8);
+			hex[8] = '\0';
+			GdbStub_GetHex(hex, &value);
+			GdbStub_SetRegister(i, value);
+		}
+		strcpy(Reply, "OK");
+		break;
+	case 'p':
+		GdbStub_GetHex(args, &reg);
+		if (reg < GDB_REGS)
+			GdbStub_PutHex(Reply, GdbStub_GetRegister(reg), 8);
+		else
+			strcpy(Reply, "E01");
+		break;
+	case 'P':
+		args = GdbStub_GetHex(args, &reg);
+		if (reg < GDB_REGS && *args++ == '=')
+		{
+			GdbStub_GetHex(args, &value);
+			GdbStub_SetRegister(reg, value);
+			strcpy(Reply, "OK");
+		}
+		else
+			strcpy(Reply, "E01");
+		break;
+	case 'm':
+		GdbStub_ReadMemory(args);
+		break;
+	case 'M':
+		GdbStub_WriteMemory(args);
+		break;
+	case 'Z':
+	case 'z':
+		GdbStub_Breakpoint(args, Packet[0] == 'Z');
+		break;
+	case 'c':
+	case 'C':
+		return GdbStub_Resume(args, Packet[0] == 'C', false);
+	case 's':
+	case 'S':
+		return GdbStub_Resume(args, Packet[0] == 'S', true);
+	case 'v':
+		if (strcmp(Packet, "vCont?") == 0)
+			strcpy(Reply, "vCont;c;C;s;S");
+		else if (strncmp(Packet, "vCont;", 6) == 0)
+		{
+			/* there's a single thread, use the first action */
+			if (Packet[6] == 's' || Packet[6] == 'S')
+				return GDB_STEP;
+			if (Packet[6] == 'c' || Packet[6] == 'C')
+				return GDB_CONTINUE;
+		}
+		break;
+	case 'D':
+		strcpy(Reply, "OK");
+		return GDB_DETACH;
+	case 'k':
+		return GDB_DETACH;
+	case 'H':
+	case 'T':
+		strcpy(Reply, "OK");
+		break;
+	case 'q':
+		if (strncmp(Packet, "qSupported", 10) == 0)
+			sprintf(Reply, "PacketSize=%x;QStartNoAckMode+;vContSupported+",
+				GDB_PACKET_MAX);
+		else if (strcmp(Packet, "qAttached") == 0)
+			strcpy(Reply, "1");
+		else if (strcmp(Packet, "qC") == 0)
+			strcpy(Reply, "QC1");
+		else if (strcmp(Packet, "qfThreadInfo") == 0)
+			strcpy(Reply, "m1");
+		else if (strcmp(Packet, "qsThreadInfo") == 0)
+			strcpy(Reply, "l");
+		break;
+	case 'Q':
+		if (strcmp(Packet, "QStartNoAckMode") == 0)
+			strcpy(Reply, "OK");
+		break;
+	}
+	return GDB_STAY;
+}
+
+/**
+ * Serve GDB requests until it resumes the emulation.  If 'bReply'
+ * is set, GDB is waiting for a stop reply with given signal.
+ */
+static void GdbStub_Session(int signal, bool bReply)
+{
+	gdb_action_t action = GDB_CONTINUE;
+	char stop[4];
+
+	sprintf(stop, "S%02x", signal);
+	if (!bReply || GdbStub_SendPacket(stop))
+	{
+		while (GdbStub_ReadPacket())
+		{
+			action = GdbStub_HandlePacket(stop);
+			if (action == GDB_CONTINUE || action == GDB_STEP)
+				break;
+			/* kill request has no reply */
+			if (Packet[0] != 'k' && !GdbStub_SendPacket(Reply))
+			{
+				action = GDB_DETACH;
+				break;
+			}
+			if (strcmp(Packet, "QStartNoAckMode") == 0)
+				bNoAck = true;
+			if (action == GDB_DETACH)
+				break;
+		}
+	}
+	if (action == GDB_CONTINUE || action == GDB_STEP)
+	{
+		DebugCpu_SetSteps(action == GDB_STEP ? 1 : 0);
+	}
+	else
+	{
+		GdbStub_Close();
+		DebugCpu_SetSteps(0);
+	}
+	DebugCpu_SetDebugging();
+	DebugDsp_SetDebugging();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Debugger entry while GDB is connected: tell GDB about
+ * the stop and wait for its commands
+ */
+void GdbStub_Stop(debug_reason_t reason)
+{
+	GdbStub_Session(reason == REASON_USER ? GDB_SIGINT : GDB_SIGTRAP, true);
+}
+
+/**
+ * Return true if GDB is connected
+ */
+bool GdbStub_Connected(void)
+{
+	return GdbSocket >= 0;
+}
+
+/**
+ * Accept new GDB connection, or check for interrupt request from
+ * the connected one.  Both stop the emulation until GDB resumes it.
+ */
+void GdbStub_Check(void)
+{
+	struct timeval tv;
+	fd_set readfds;
+	int sock, c, one = 1;
+
+	if (ListenSocket < 0)
+		return;
+
+	if (GdbSocket < 0)
+	{
+		sock = accept(ListenSocket, NULL, NULL);
+		if (sock < 0)
+			return;
+		fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) & ~O_NONBLOCK);
+		setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+		GdbSocket = sock;
+		Log_Printf(LOG_INFO, "GDB connected, emulation stopped.\n");
+		/* GDB asks for the stop reason itself */
+		GdbStub_Session(GDB_SIGTRAP, false);
+		return;
+	}
+
+	if (RecvPos == RecvLen)
+	{
+		tv.tv_usec = tv.tv_sec = 0;
+		FD_ZERO(&readfds);
+		FD_SET(GdbSocket, &readfds);
+		if (select(GdbSocket+1, &readfds, NULL, NULL, &tv) <= 0)
+			return;
+	}
+	/* while running, GDB sends only interrupt requests */
+	do {
+		if ((c = GdbStub_GetChar()) < 0)
+		{
+			GdbStub_Close();
+			return;
+		}
+		if (c == 0x03)
+		{
+			GdbStub_Session(GDB_SIGINT, true);
+			return;
+		}
+	} while (RecvPos < RecvLen);
+}
+
+/**
+ * Start listening for GDB connections on given local TCP port.
+ * Return NULL for success, otherwise an error string
+ */
+const char *GdbStub_SetPort(int port)
+{
+	struct sockaddr_in address;
+	int sock, one = 1;
+
+	if (port <= 0 || port > 0xffff)
+		return "Invalid TCP port number";
+
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0)
+	{
+		perror("socket creation");
+		return "Can't create TCP socket";
+	}
+	setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+	/* only local connections, the protocol has no authentication */
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+	if (bind(sock, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+	    listen(sock, 1) < 0)
+	{
+		perror("GDB socket");
+		close(sock);
+		return "Can't listen on given TCP port";
+	}
+	fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+
+	if (ListenSocket >= 0)
+		close(ListenSocket);
+	ListenSocket = sock;
+	Log_Printf(LOG_INFO, "Waiting for GDB connections on port %d.\n", port);
+	return NULL;
+}
+
+#endif /* HAVE_TCP_SOCKETS */
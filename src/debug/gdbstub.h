@@ -0,0 +1,26 @@
+/*
+ * Hatari - gdbstub.h
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ */
+
+#ifndef HATARI_GDBSTUB_H
+#define HATARI_GDBSTUB_H
+
+#include "debugui.h"
+
+/* supported only on systems with BSD compatible sockets */
+#if HAVE_TCP_SOCKETS
+extern const char *GdbStub_SetPort(int port);
+extern void GdbStub_Check(void);
+extern bool GdbStub_Connected(void);
+extern void GdbStub_Stop(debug_reason_t reason);
+#else
+#define GdbStub_SetPort(port) "GDB remote protocol is not supported on this platform."
+#define GdbStub_Check()
+#define GdbStub_Connected() false
+#define GdbStub_Stop(reason)
+#endif /* HAVE_TCP_SOCKETS */
+
+#endif
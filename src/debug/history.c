@@ -21,28 +21,38 @@ const char History_fileid[] = "Hatari history.c : " __DATE__ " " __TIME__;
 #include "file.h"
 #include "history.h"
 #include "m68000.h"
+#include "cycles.h"
 #include "68kDisass.h"
 
 #define HISTORY_ITEMS_MIN 64
+#define HISTORY_ITEMS_MAX (64*1024*1024)
+
+/* largest cycle count stored for an item */
+#define HISTORY_CYCLES_MAX 0xffffff
+
+/* binary history dump file header & version */
+#define HISTORY_DUMP_MAGIC "HATARIHI"
+#define HISTORY_DUMP_VERSION 1
 
 history_type_t HistoryTracking;
 
+/* 8 bytes per item, so that millions of them can be collected */
 typedef struct {
-	bool shown:1;
-	bool valid:1;
-	bool for_dsp:1;
+	Uint32 pc;
+	/* CPU cycles since previous item (saturated) */
+	unsigned cycles:24;
 	/* reason for debugger entry/breakpoint hit */
-	debug_reason_t reason:8;
-	union {
-		Uint16 dsp;
-		Uint32 cpu;
-	} pc;
+	unsigned reason:4;
+	unsigned for_dsp:1;
+	unsigned shown:1;
+	unsigned valid:1;
 } hist_item_t;
 
 static struct {
 	unsigned idx;      /* index to current history item */
 	unsigned count;    /* how many items of history are collected */
 	unsigned limit;    /* ring-buffer size */
+	Uint64 clock;      /* CPU cycles at previous item */
 	hist_item_t *item; /* ring-buffer */
 } History;
 
@@ -111,14 +121,26 @@ static void History_Enable(history_type_t track, unsigned limit)
 /**
  * Advance & initialize next history item in ring buffer
  */
-static void History_Advance(void)
+static inline hist_item_t *History_Advance(void)
 {
-	History.idx++;
-	History.idx %= History.limit;
-	History.item[History.idx].valid = true;
-	History.item[History.idx].shown = false;
-	History.item[History.idx].reason = REASON_NONE;
+	hist_item_t *item;
+	Uint64 cycles;
+
+	if (++History.idx >= History.limit) {
+		History.idx = 0;
+	}
+	cycles = CyclesGlobalClockCounter - History.clock;
+	History.clock = CyclesGlobalClockCounter;
+	if (cycles > HISTORY_CYCLES_MAX) {
+		cycles = HISTORY_CYCLES_MAX;
+	}
+	item = &History.item[History.idx];
+	item->cycles = cycles;
+	item->valid = true;
+	item->shown = false;
+	item->reason = REASON_NONE;
 	History.count++;
+	return item;
 }
 
 /**
@@ -126,11 +148,10 @@ static void History_Advance(void)
  */
 void History_AddCpu(void)
 {
-	Uint32 pc = M68000_GetPC();
+	hist_item_t *item = History_Advance();
 
-	History_Advance();
-	History.item[History.idx].for_dsp = false;
-	History.item[History.idx].pc.cpu = pc;
+	item->for_dsp = false;
+	item->pc = M68000_GetPC();
 }
 
 /**
@@ -138,11 +159,10 @@ void History_AddCpu(void)
  */
 void History_AddDsp(void)
 {
-	Uint16 pc = DSP_GetPC();
+	hist_item_t *item = History_Advance();
 
-	History_Advance();
-	History.item[History.idx].for_dsp = true;
-	History.item[History.idx].pc.dsp = pc;
+	item->for_dsp = true;
+	item->pc = DSP_GetPC();
 }
 
 /**
@@ -201,11 +221,11 @@ static Uint32 History_Output(Uint32 count, FILE *fp)
 		History.item[i].shown = true;
 
 		if (History.item[i].for_dsp) {
-			Uint16 pc = History.item[i].pc.dsp;
+			Uint16 pc = History.item[i].pc;
 			DSP_DisasmAddress(fp, pc, pc);
 		} else {
 			Uint32 dummy;
-			Disasm(fp, History.item[i].pc.cpu, &dummy, 1);
+			Disasm(fp, History.item[i].pc, &dummy, 1);
 		}
 		if (History.item[i].reason != REASON_NONE) {
 			fprintf(fp, "Debugger: *%s*\n", History_ReasonStr(History.item[i].reason));
@@ -240,12 +260,110 @@ static void History_Save(const char *name)
 	}
 }
 
+/*
+ * Write collected history in binary form to given file, oldest item
+ * first. Disassembly is done only when the history is loaded back and
+ * shown. All values are big endian:
+ * - header: "HATARIHI", version, item count (32-bit each)
+ * - items:  PC (32-bit), flags (32-bit: bits 0-23 cycles since previous
+ *   item, bits 24-27 debugger entry reason, bit 28 DSP item)
+ */
+static void History_Dump(const char *name)
+{
+	Uint8 buf[8];
+	Uint32 count, n;
+	unsigned i;
+	FILE *fp;
+
+	if (!History.count) {
+		fprintf(stderr, "No history items to dump.\n");
+		return;
+	}
+	if (File_Exists(name)) {
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", name);
+		return;
+	}
+	if (!(fp = fopen(name, "wb"))) {
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return;
+	}
+	count = History.count;
+	if (count > History.limit) {
+		count = History.limit;
+	}
+	fwrite(HISTORY_DUMP_MAGIC, 8, 1, fp);
+	do_put_mem_long(buf, HISTORY_DUMP_VERSION);
+	do_put_mem_long(buf + 4, count);
+	fwrite(buf, 8, 1, fp);
+
+	i = (History.idx + History.limit - count) % History.limit;
+	for (n = 0; n < count; n++) {
+		i++;
+		i %= History.limit;
+		do_put_mem_long(buf, History.item[i].pc);
+		do_put_mem_long(buf + 4, History.item[i].cycles
+				| History.item[i].reason << 24
+				| History.item[i].for_dsp << 28);
+		fwrite(buf, 8, 1, fp);
+	}
+	if (fclose(fp)) {
+		fprintf(stderr, "ERROR: writing '%s' failed (%d).\n", name, errno);
+		return;
+	}
+	fprintf(stderr, "%d history items dumped to '%s'.\n", count, name);
+}
+
+/*
+ * Replace current history with the one in given binary dump file
+ */
+static void History_Load(const char *name)
+{
+	Uint8 head[16], buf[8];
+	Uint32 count, flags;
+	unsigned i;
+	FILE *fp;
+
+	if (!(fp = fopen(name, "rb"))) {
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return;
+	}
+	if (fread(head, sizeof(head), 1, fp) != 1
+	    || memcmp(head, HISTORY_DUMP_MAGIC, 8) != 0
+	    || do_get_mem_long(head + 8) != HISTORY_DUMP_VERSION) {
+		fprintf(stderr, "ERROR: '%s' isn't a Hatari history dump!\n", name);
+		fclose(fp);
+		return;
+	}
+	count = do_get_mem_long(head + 12);
+	if (count < HISTORY_ITEMS_MIN || count > HISTORY_ITEMS_MAX) {
+		count = count < HISTORY_ITEMS_MIN ? HISTORY_ITEMS_MIN : HISTORY_ITEMS_MAX;
+	}
+	/* keep the current tracking type, but make the history fit the dump */
+	History_Enable(HistoryTracking, count);
+	memset(History.item, 0, count * sizeof(History.item[0]));
+	History.count = 0;
+	History.idx = count - 1;
+
+	for (i = 0; i < count && fread(buf, sizeof(buf), 1, fp) == 1; i++) {
+		flags = do_get_mem_long(buf + 4);
+		History.item[i].pc = do_get_mem_long(buf);
+		History.item[i].cycles = flags & HISTORY_CYCLES_MAX;
+		History.item[i].reason = (flags >> 24) & 0xf;
+		History.item[i].for_dsp = (flags >> 28) & 1;
+		History.item[i].valid = true;
+		History.idx = i;
+		History.count++;
+	}
+	fclose(fp);
+	fprintf(stderr, "%d history items loaded from '%s'.\n", History.count, name);
+}
+
 /*
  * Readline callback
  */
 char *History_Match(const char *text, int state)
 {
-	static const char* cmds[] = { "cpu", "dsp", "off", "save" };
+	static const char* cmds[] = { "cpu", "dsp", "dump", "load", "off", "save" };
 	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
 }
 
@@ -269,6 +387,9 @@ int History_Parse(int nArgc, char *psArgs[])
 	if (limit < HISTORY_ITEMS_MIN) {
 		limit = HISTORY_ITEMS_MIN;
 	}
+	if (limit > HISTORY_ITEMS_MAX) {
+		limit = HISTORY_ITEMS_MAX;
+	}
 	count = atoi(psArgs[1]);
 
 	if (count <= 0) {
@@ -293,6 +414,14 @@ int History_Parse(int nArgc, char *psArgs[])
 			History_Save(psArgs[2]);
 			return DEBUGGER_CMDDONE;
 		}
+		if (nArgc == 3 && strcmp(psArgs[1], "dump") == 0) {
+			History_Dump(psArgs[2]);
+			return DEBUGGER_CMDDONE;
+		}
+		if (nArgc == 3 && strcmp(psArgs[1], "load") == 0) {
+			History_Load(psArgs[2]);
+			return DEBUGGER_CMDDONE;
+		}
 		fprintf(stderr,  "History range is 1-<limit>\n");
 		return DebugUI_PrintCmdHelp(psArgs[0]);
 	}
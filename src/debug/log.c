@@ -28,6 +28,8 @@ const char Log_fileid[] = "Hatari log.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "file.h"
 #include "vdi.h"
+#include "cycles.h"
+#include "m68000.h"
 
 int ExceptionDebugMask;
 
@@ -147,6 +149,22 @@ static flagname_t TraceFlags[] = {
 
 Uint64	LogTraceFlags = TRACE_NONE;
 FILE *TraceFile = NULL;
+FILE *TraceBinFile = NULL;
+
+/* Binary trace file header & record format (all values big endian):
+ * - header: "HATARITR", version (32-bit), record size (32-bit)
+ * - record: type (8-bit), access size (8-bit), padding (16-bit),
+ *   PC (32-bit), CPU cycles (64-bit), address (32-bit), value (32-bit)
+ * Records are collected to a buffer which is written when it's full,
+ * so that tracing doesn't need formatting or system calls per record.
+ */
+#define TRACE_BIN_MAGIC		"HATARITR"
+#define TRACE_BIN_VERSION	1
+#define TRACE_RECORD_SIZE	24
+#define TRACE_RECORDS		4096
+
+static Uint8 TraceRecords[TRACE_RECORDS * TRACE_RECORD_SIZE];
+static int nTraceRecords;
 
 static FILE *hLogFile = NULL;
 static LOGTYPE TextLogLevel;
@@ -170,15 +188,61 @@ void Log_Default(void)
  */
 int Log_Init(void)
 {
+	Uint8 header[16];
+
 	TextLogLevel = ConfigureParams.Log.nTextLogLevel;
 	AlertDlgLogLevel = ConfigureParams.Log.nAlertDlgLogLevel;
 
 	hLogFile = File_Open(ConfigureParams.Log.sLogFileName, "w");
 	TraceFile = File_Open(ConfigureParams.Log.sTraceFileName, "w");
-   
+
+	nTraceRecords = 0;
+	TraceBinFile = File_Open(ConfigureParams.Log.sTraceBinFileName, "wb");
+	if (TraceBinFile)
+	{
+		memcpy(header, TRACE_BIN_MAGIC, 8);
+		do_put_mem_long(header + 8, TRACE_BIN_VERSION);
+		do_put_mem_long(header + 12, TRACE_RECORD_SIZE);
+		fwrite(header, sizeof(header), 1, TraceBinFile);
+	}
+	else if (ConfigureParams.Log.sTraceBinFileName[0])
+		return 0;
+
 	return (hLogFile && TraceFile);
 }
 
+/**
+ * Write collected binary trace records to the trace file
+ */
+static void Log_TraceFlush(void)
+{
+	if (nTraceRecords)
+		fwrite(TraceRecords, TRACE_RECORD_SIZE, nTraceRecords, TraceBinFile);
+	nTraceRecords = 0;
+}
+
+/**
+ * Add record of given type, access size, address and value,
+ * with the current PC & CPU cycles, to the binary trace file.
+ */
+void Log_TraceRecord(trace_record_t type, int size, Uint32 addr, Uint32 value)
+{
+	Uint8 *rec = TraceRecords + nTraceRecords * TRACE_RECORD_SIZE;
+	Uint64 cycles = CyclesGlobalClockCounter;
+
+	rec[0] = type;
+	rec[1] = size;
+	rec[2] = rec[3] = 0;
+	do_put_mem_long(rec + 4, M68000_GetPC());
+	do_put_mem_long(rec + 8, cycles >> 32);
+	do_put_mem_long(rec + 12, cycles);
+	do_put_mem_long(rec + 16, addr);
+	do_put_mem_long(rec + 20, value);
+
+	if (++nTraceRecords == TRACE_RECORDS)
+		Log_TraceFlush();
+}
+
 /**
  * Set Alert log level temporarily without config change.
  * 
@@ -200,6 +264,11 @@ void Log_UnInit(void)
 {
 	hLogFile = HFile_Close(hLogFile);
 	TraceFile = HFile_Close(TraceFile);
+	if (TraceBinFile)
+	{
+		Log_TraceFlush();
+		TraceBinFile = HFile_Close(TraceBinFile);
+	}
 }
 
 
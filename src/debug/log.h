@@ -196,11 +196,27 @@ extern char *Log_MatchTrace(const char *text, int state);
 extern FILE *TraceFile;
 extern Uint64 LogTraceFlags;
 
+/* Types of the fixed size records written to the binary trace file
+ * (instead of text) by the trace points which support that
+ */
+typedef enum {
+	TRACE_RECORD_CPU_PC = 1,	/* address = PC, value = opcode */
+	TRACE_RECORD_IO_READ,		/* address & value of IO access */
+	TRACE_RECORD_IO_WRITE
+} trace_record_t;
+
+extern FILE *TraceBinFile;
+extern void Log_TraceRecord(trace_record_t type, int size, Uint32 addr, Uint32 value);
+
 #if ENABLE_TRACING
 
 #ifndef _VCWIN_
 #define	LOG_TRACE(level, args...) \
 	if (unlikely(LogTraceFlags & level)) { fprintf(TraceFile, args); fflush(TraceFile); }
+#define	LOG_TRACE_RECORD(level, type, size, addr, value, args...) \
+	if (unlikely(LogTraceFlags & level)) { \
+		if (TraceBinFile) Log_TraceRecord(type, size, addr, value); \
+		else { fprintf(TraceFile, args); fflush(TraceFile); } }
 #endif
 #define LOG_TRACE_LEVEL( level )	(unlikely(LogTraceFlags & level))
 
@@ -208,6 +224,7 @@ extern Uint64 LogTraceFlags;
 
 #ifndef _VCWIN_
 #define LOG_TRACE(level, args...)	{}
+#define LOG_TRACE_RECORD(level, type, size, addr, value, args...)	{}
 #endif
 #define LOG_TRACE_LEVEL( level )	(0)
 
@@ -0,0 +1,244 @@
+/*
+ * Hatari - metrics.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * metrics.c - runtime metrics for monitoring (many) running instances:
+ * emulated speed, host time per emulated frame, VBL wait pacing drift,
+ * audio resyncs and underruns, skipped frames, FDC busy time and
+ * snapshot durations.
+ *
+ * With --metrics <seconds>, they're logged as one line of key=value
+ * pairs at that interval, followed by the perfcount.c subsystem shares
+ * when those are compiled in. Counters are cleared after each line.
+ */
+const char Metrics_fileid[] = "Hatari metrics.c : " __DATE__ " " __TIME__;
+
+#include <stdio.h>
+#include "main.h"
+#include "configuration.h"
+#include "clocks_timings.h"
+#include "cycles.h"
+#include "log.h"
+#include "metrics.h"
+#include "perfcount.h"
+#include "screen.h"
+#include "video.h"
+
+#define METRICS_MAX_FRAMES	4096	/* frame times kept for percentiles */
+
+Uint32 Metrics_Counts[METRICS_COUNT_MAX];
+
+static const char *Metrics_CountNames[METRICS_COUNT_MAX] = {
+	"audio_resyncs",
+	"audio_underruns",
+	"frames_skipped"
+};
+
+static Uint32 nInterval;		/* seconds between log lines, 0 = off */
+static Uint64 nIntervalStart;		/* host ns at start of interval */
+static Uint64 nEmulatedUs;		/* emulated time in interval */
+static Uint64 nFrameStart;		/* host ns when emulation of frame started */
+
+static Uint32 FrameUs[METRICS_MAX_FRAMES];	/* host us per emulated frame */
+static Uint32 nFrames;
+
+static Uint32 nPaced;			/* VBL waits in interval */
+static Sint64 nPaceLateUs;		/* sum of how late they ended */
+static Sint64 nPaceLateMaxUs;
+static Sint64 nPaceSpinUs;		/* time busy-waited in them */
+
+static bool bFdcBusy;
+static Uint64 nFdcBusyStart;		/* CPU cycle counter when FDC became busy */
+static Uint64 nFdcBusyCycles;
+static Uint64 nCyclesStart;		/* CPU cycle counter at start of interval */
+
+static struct {
+	Uint32 nCount;
+	Uint64 nMaxNs;
+} Snapshots[2];				/* restores, saves */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Clear counters for next interval
+ */
+static void Metrics_Reset(Uint64 now)
+{
+	memset(Metrics_Counts, 0, sizeof(Metrics_Counts));
+	memset(Snapshots, 0, sizeof(Snapshots));
+	nIntervalStart = now;
+	nEmulatedUs = 0;
+	nFrames = 0;
+	nPaced = 0;
+	nPaceLateUs = nPaceLateMaxUs = nPaceSpinUs = 0;
+	nFdcBusyCycles = 0;
+	nFdcBusyStart = nCyclesStart = CyclesGlobalClockCounter;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable logging every 'nSeconds' seconds, 0 disables it
+ */
+void Metrics_SetInterval(Uint32 nSeconds)
+{
+	nInterval = nSeconds;
+	nFrameStart = 0;
+	Metrics_Reset(PerfCount_Now());
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when emulation of a frame starts (after the VBL wait, or when
+ * the libretro frontend asks for the next frame)
+ */
+void Metrics_FrameStart(void)
+{
+	if (nInterval)
+		nFrameStart = PerfCount_Now();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when emulation of a frame is done, before waiting for the
+ * next one, to record the host time the frame took.
+ */
+void Metrics_FrameDone(void)
+{
+	if (!nInterval || !nFrameStart)
+		return;
+
+	FrameUs[nFrames % METRICS_MAX_FRAMES] = (PerfCount_Now() - nFrameStart) / 1000;
+	nFrames++;
+	nFrameStart = 0;
+	nEmulatedUs += ClocksTimings_GetVBLDuration_micro(ConfigureParams.System.nMachineType,
+	                                                  nScreenRefreshRate);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Record how late (negative if early) the standalone build's VBL wait
+ * ended compared to its target time, and how long it busy-waited
+ */
+void Metrics_FramePaced(Sint64 nLateUs, Sint64 nSpinUs)
+{
+	if (!nInterval)
+		return;
+
+	nPaced++;
+	nPaceLateUs += nLateUs;
+	if (nLateUs > nPaceLateMaxUs)
+		nPaceLateMaxUs = nLateUs;
+	nPaceSpinUs += nSpinUs;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Keep track of emulated FDC busy time, called when its busy bit changes
+ */
+void Metrics_FdcBusy(bool bBusy)
+{
+	if (bBusy == bFdcBusy)
+		return;
+	bFdcBusy = bBusy;
+	if (bBusy)
+		nFdcBusyStart = CyclesGlobalClockCounter;
+	else
+		nFdcBusyCycles += CyclesGlobalClockCounter - nFdcBusyStart;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Record duration of a memory snapshot save/restore started at 'nStartNs'
+ */
+void Metrics_Snapshot(bool bSave, Uint64 nStartNs)
+{
+	Uint64 nDuration = PerfCount_Now() - nStartNs;
+
+	Snapshots[bSave].nCount++;
+	if (nDuration > Snapshots[bSave].nMaxNs)
+		Snapshots[bSave].nMaxNs = nDuration;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * qsort() comparison for frame times
+ */
+static int Metrics_CompareUs(const void *p1, const void *p2)
+{
+	Uint32 a = *(const Uint32 *)p1, b = *(const Uint32 *)p2;
+
+	return (a > b) - (a < b);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on each VBL, logs the metrics line when the interval has passed
+ */
+void Metrics_Update(void)
+{
+	static Uint32 Sorted[METRICS_MAX_FRAMES];
+	char sLine[1024];
+	Uint64 now, nHostNs, nCycles, nBusy;
+	Uint32 nSorted;
+	int i, len;
+
+	if (!nInterval)
+		return;
+
+	now = PerfCount_Now();
+	nHostNs = now - nIntervalStart;
+	if (nHostNs < (Uint64)nInterval * 1000000000)
+		return;
+
+	nSorted = nFrames < METRICS_MAX_FRAMES ? nFrames : METRICS_MAX_FRAMES;
+	memcpy(Sorted, FrameUs, nSorted * sizeof(Sorted[0]));
+	qsort(Sorted, nSorted, sizeof(Sorted[0]), Metrics_CompareUs);
+
+	nCycles = CyclesGlobalClockCounter - nCyclesStart;
+	nBusy = nFdcBusyCycles;
+	if (bFdcBusy)
+		nBusy += CyclesGlobalClockCounter - nFdcBusyStart;
+
+	len = snprintf(sLine, sizeof(sLine),
+	               "vbls=%u speed=%.3f frame_ms_p50=%.2f frame_ms_p99=%.2f frame_ms_max=%.2f",
+	               nFrames, nEmulatedUs * 1000.0 / nHostNs,
+	               nSorted ? Sorted[nSorted / 2] / 1000.0 : 0.0,
+	               nSorted ? Sorted[nSorted * 99 / 100] / 1000.0 : 0.0,
+	               nSorted ? Sorted[nSorted - 1] / 1000.0 : 0.0);
+	for (i = 0; i < METRICS_COUNT_MAX && len < (int)sizeof(sLine); i++)
+	{
+		len += snprintf(sLine + len, sizeof(sLine) - len, " %s=%u",
+		                Metrics_CountNames[i], Metrics_Counts[i]);
+	}
+	if (len < (int)sizeof(sLine))
+	{
+		len += snprintf(sLine + len, sizeof(sLine) - len,
+		                " fdc_busy=%.3f snapshot_saves=%u snapshot_save_ms_max=%.1f"
+		                " snapshot_restores=%u snapshot_restore_ms_max=%.1f",
+		                nCycles ? (double)nBusy / nCycles : 0.0,
+		                Snapshots[1].nCount, Snapshots[1].nMaxNs / 1000000.0,
+		                Snapshots[0].nCount, Snapshots[0].nMaxNs / 1000000.0);
+	}
+	if (nPaced && len < (int)sizeof(sLine))
+	{
+		len += snprintf(sLine + len, sizeof(sLine) - len,
+		                " pace_late_us_avg=%.1f pace_late_us_max=%lld pace_spin_ms=%.1f",
+		                (double)nPaceLateUs / nPaced, (long long)nPaceLateMaxUs,
+		                nPaceSpinUs / 1000.0);
+	}
+	if (len < (int)sizeof(sLine))
+		PerfCount_AppendShares(sLine + len, sizeof(sLine) - len);
+
+	Log_Printf(LOG_INFO, "METRICS: %s\n", sLine);
+	Metrics_Reset(now);
+}
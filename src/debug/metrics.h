@@ -0,0 +1,34 @@
+/*
+  Hatari - metrics.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_METRICS_H
+#define HATARI_METRICS_H
+
+/* Event counters, reported and cleared on each metrics log line */
+typedef enum {
+	METRICS_AUDIO_RESYNC,		/* sound buffer index reset after a slowdown */
+	METRICS_AUDIO_UNDERRUN,		/* frontend reported a likely audio underrun */
+	METRICS_FRAME_SKIPPED,		/* emulated frame not drawn */
+	METRICS_COUNT_MAX
+} metrics_count_t;
+
+extern Uint32 Metrics_Counts[METRICS_COUNT_MAX];
+
+static inline void Metrics_Count(metrics_count_t id)
+{
+	Metrics_Counts[id]++;
+}
+
+extern void Metrics_SetInterval(Uint32 nSeconds);
+extern void Metrics_FrameStart(void);
+extern void Metrics_FrameDone(void);
+extern void Metrics_Update(void);
+extern void Metrics_FdcBusy(bool bBusy);
+extern void Metrics_FramePaced(Sint64 nLateUs, Sint64 nSpinUs);
+extern void Metrics_Snapshot(bool bSave, Uint64 nStartNs);
+
+#endif /* HATARI_METRICS_H */
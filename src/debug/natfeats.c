@@ -14,14 +14,18 @@
 const char Natfeats_fileid[] = "Hatari natfeats.c : " __DATE__ " " __TIME__;
 
 #include <stdio.h>
+#include <inttypes.h>
 #include "main.h"
 #include "version.h"
 #include "configuration.h"
 #include "stMemory.h"
 #include "m68000.h"
+#include "cycles.h"
 #include "natfeats.h"
 #include "control.h"
+#include "vdi.h"
 #include "log.h"
+#include "perfcount.h"
 
 
 /* whether to allow XBIOS(255) style
@@ -162,6 +166,254 @@ static bool nf_fastforward(Uint32 stack, Uint32 subid, Uint32 *retval)
 	return true;
 }
 
+/**
+ * NF_VDI - accelerated drawing for extended VDI resolutions
+ * Subid tells the operation, see VDI_NatFeat() for its arguments
+ */
+static bool nf_vdi(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	return VDI_NatFeat(stack, subid, retval);
+}
+
+/**
+ * NF_CYCLES - read emulated and host time counters
+ * Stack arguments are:
+ * - pointer to 16 byte buffer, or NULL
+ * Buffer is filled with 64-bit emulated CPU cycle count and
+ * 64-bit host time in nanoseconds (both big endian).
+ * Returns lower 32 bits of the emulated cycle count
+ */
+static bool nf_cycles(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint64 cycles = CyclesGlobalClockCounter;
+	Uint64 host = PerfCount_Now();
+	Uint32 ptr;
+
+	ptr = STMemory_ReadLong(stack);
+	LOG_TRACE(TRACE_NATFEATS, "NF_CYCLES(0x%x)\n", ptr);
+
+	if (ptr) {
+		if (!STMemory_ValidArea(ptr, 4 * SIZE_LONG)) {
+			M68000_BusError(ptr, BUS_ERROR_WRITE);
+			return false;
+		}
+		STMemory_WriteLong(ptr, cycles >> 32);
+		STMemory_WriteLong(ptr + SIZE_LONG, cycles);
+		STMemory_WriteLong(ptr + 2 * SIZE_LONG, host >> 32);
+		STMemory_WriteLong(ptr + 3 * SIZE_LONG, host);
+	}
+	*retval = (Uint32)cycles;
+	return true;
+}
+
+/* named profiling regions for NF_PROFILE */
+#define NF_PROFILE_REGIONS	32
+#define NF_PROFILE_NAMELEN	32
+
+enum {
+	NF_PROFILE_START,
+	NF_PROFILE_STOP,
+	NF_PROFILE_SHOW,
+	NF_PROFILE_RESET
+};
+
+static struct {
+	char name[NF_PROFILE_NAMELEN];
+	bool active;
+	Uint32 calls;
+	Uint64 startCycles, startHost;
+	Uint64 cycles, host;		/* totals for all the calls */
+} nf_regions[NF_PROFILE_REGIONS];
+static int nf_region_count;
+
+/**
+ * Return index of the profiling region with name at given ST address,
+ * add it if it's not yet known. Return -1 if region table is full.
+ */
+static int nf_region_find(Uint32 ptr)
+{
+	char name[NF_PROFILE_NAMELEN];
+	int i;
+
+	for (i = 0; i < NF_PROFILE_NAMELEN - 1; i++) {
+		name[i] = STMemory_ReadByte(ptr + i);
+		if (!name[i])
+			break;
+	}
+	name[i] = '\0';
+
+	for (i = 0; i < nf_region_count; i++) {
+		if (strcmp(nf_regions[i].name, name) == 0)
+			return i;
+	}
+	if (nf_region_count >= NF_PROFILE_REGIONS)
+		return -1;
+	memset(&nf_regions[i], 0, sizeof(nf_regions[i]));
+	strcpy(nf_regions[i].name, name);
+	return nf_region_count++;
+}
+
+/**
+ * NF_PROFILE - host-side profiling of named code regions
+ * Subid tells the operation:
+ * - 0: start region, 1: stop region
+ *   Stack arguments are:
+ *   - pointer to region name
+ *   Stop returns emulated CPU cycles since the region start
+ * - 2: show statistics for all regions on stderr
+ * - 3: reset all regions
+ */
+static bool nf_profile(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint64 cycles = CyclesGlobalClockCounter;
+	Uint64 host = PerfCount_Now();
+	Uint32 ptr;
+	int i;
+
+	if (subid == NF_PROFILE_SHOW) {
+		LOG_TRACE(TRACE_NATFEATS, "NF_PROFILE[show]()\n");
+		fprintf(stderr, "%-*s %8s %14s %12s %14s\n", NF_PROFILE_NAMELEN,
+			"Region:", "calls", "cycles", "cycles/call", "host usecs");
+		for (i = 0; i < nf_region_count; i++) {
+			fprintf(stderr, "%-*s %8u %14"PRIu64" %12"PRIu64" %14"PRIu64"\n",
+				NF_PROFILE_NAMELEN, nf_regions[i].name, nf_regions[i].calls,
+				nf_regions[i].cycles,
+				nf_regions[i].calls ? nf_regions[i].cycles / nf_regions[i].calls : 0,
+				nf_regions[i].host / 1000);
+		}
+		fflush(stderr);
+		return true;
+	}
+	if (subid == NF_PROFILE_RESET) {
+		LOG_TRACE(TRACE_NATFEATS, "NF_PROFILE[reset]()\n");
+		nf_region_count = 0;
+		return true;
+	}
+	if (subid != NF_PROFILE_START && subid != NF_PROFILE_STOP) {
+		LOG_TRACE(TRACE_NATFEATS, "ERROR: invalid NF_PROFILE subid %d\n", subid);
+		return true;
+	}
+
+	ptr = STMemory_ReadLong(stack);
+	if (!STMemory_ValidArea(ptr, 1)) {
+		M68000_BusError(ptr, BUS_ERROR_READ);
+		return false;
+	}
+	i = nf_region_find(ptr);
+	LOG_TRACE(TRACE_NATFEATS, "NF_PROFILE[%s](0x%x) -> region %d\n",
+		  subid == NF_PROFILE_START ? "start" : "stop", ptr, i);
+	if (i < 0)
+		return true;
+
+	if (subid == NF_PROFILE_START) {
+		nf_regions[i].active = true;
+		nf_regions[i].startCycles = cycles;
+		nf_regions[i].startHost = host;
+	} else if (nf_regions[i].active) {
+		nf_regions[i].active = false;
+		nf_regions[i].calls++;
+		nf_regions[i].cycles += cycles - nf_regions[i].startCycles;
+		nf_regions[i].host += host - nf_regions[i].startHost;
+		*retval = cycles - nf_regions[i].startCycles;
+	}
+	return true;
+}
+
+/**
+ * NF_DUMP - write ST memory area to a host file
+ * Stack arguments are:
+ * - pointer to file name, without path (file is in the current directory)
+ * - pointer to memory area
+ * - uint32_t for its size
+ * If subid is set, data is appended to the file instead
+ * Returns number of bytes written
+ */
+static bool nf_dump(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 name, ptr, len;
+	const char *fname;
+	FILE *fp;
+
+	name = STMemory_ReadLong(stack);
+	ptr = STMemory_ReadLong(stack + SIZE_LONG);
+	len = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "NF_DUMP[%d](0x%x, 0x%x, %d)\n", subid, name, ptr, len);
+
+	if (!STMemory_ValidArea(name, 1)) {
+		M68000_BusError(name, BUS_ERROR_READ);
+		return false;
+	}
+	if (!STMemory_ValidArea(ptr, len)) {
+		M68000_BusError(ptr, BUS_ERROR_READ);
+		return false;
+	}
+	fname = (const char *)STRAM_ADDR(name);
+	if (!*fname || *fname == '.' || strchr(fname, '/') || strchr(fname, '\\')) {
+		LOG_TRACE(TRACE_NATFEATS, "ERROR: invalid NF_DUMP file name '%s'\n", fname);
+		return true;
+	}
+	fp = fopen(fname, subid ? "ab" : "wb");
+	if (!fp) {
+		LOG_TRACE(TRACE_NATFEATS, "ERROR: can't open NF_DUMP file '%s'\n", fname);
+		return true;
+	}
+	*retval = fwrite((const void *)STRAM_ADDR(ptr), 1, len, fp);
+	fclose(fp);
+	return true;
+}
+
+/* 68000 cycles per long for an unrolled movem.l loop
+ * (12 registers, 48 bytes per iteration)
+ */
+#define NF_MEMOPS_COPY_CYCLES	18
+#define NF_MEMOPS_FILL_CYCLES	9
+
+/**
+ * NF_MEMOPS - native memory copy and fill for C libraries
+ * Subid tells the operation:
+ * - 0: memmove, stack arguments are:
+ *   - destination pointer, source pointer, uint32_t size
+ * - 1: memset, stack arguments are:
+ *   - destination pointer, int32_t byte value, uint32_t size
+ * Returns destination pointer, or zero if NF_MEMOPS is disabled
+ * (caller should then use its own implementation)
+ */
+static bool nf_memops(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 dst, arg, len, cycles;
+
+	dst = STMemory_ReadLong(stack);
+	arg = STMemory_ReadLong(stack + SIZE_LONG);
+	len = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "NF_MEMOPS[%d](0x%x, 0x%x, %d)\n", subid, dst, arg, len);
+
+	if (ConfigureParams.Log.nNatFeatsMemOps == NATFEATS_MEMOPS_OFF || subid > 1) {
+		*retval = 0;
+		return true;
+	}
+	if (!STMemory_ValidArea(dst, len) || dst >= 0xe00000) {
+		M68000_BusError(dst, BUS_ERROR_WRITE);
+		return false;
+	}
+	if (subid == 0) {
+		if (!STMemory_ValidArea(arg, len)) {
+			M68000_BusError(arg, BUS_ERROR_READ);
+			return false;
+		}
+		memmove((void *)STRAM_ADDR(dst), (const void *)STRAM_ADDR(arg), len);
+		cycles = NF_MEMOPS_COPY_CYCLES;
+	} else {
+		memset((void *)STRAM_ADDR(dst), arg, len);
+		cycles = NF_MEMOPS_FILL_CYCLES;
+	}
+	STMemory_SetDirtyArea(dst, len);
+	if (ConfigureParams.Log.nNatFeatsMemOps == NATFEATS_MEMOPS_CPU && len)
+		M68000_WaitState(((len + 3) / 4 * cycles + 3) & ~3);
+
+	*retval = dst;
+	return true;
+}
+
 #if NF_COMMAND
 /**
  * NF_COMMAND - execute Hatari (cli / debugger) command
@@ -205,7 +457,12 @@ static const struct {
 	{ "NF_SHUTDOWN", true,  nf_shutdown },
 	{ "NF_EXIT",     false, nf_exit },
 	{ "NF_DEBUGGER", false, nf_debugger },
-	{ "NF_FASTFORWARD", false,  nf_fastforward }
+	{ "NF_FASTFORWARD", false,  nf_fastforward },
+	{ "NF_VDI",      false, nf_vdi },
+	{ "NF_CYCLES",   false, nf_cycles },
+	{ "NF_PROFILE",  false, nf_profile },
+	{ "NF_DUMP",     false, nf_dump },
+	{ "NF_MEMOPS",   false, nf_memops }
 };
 
 /* macros from Aranym */
@@ -0,0 +1,170 @@
+/*
+ * Hatari - perfcount.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * perfcount.c - host time spent in the main emulation subsystems, for
+ * finding out where the frame time goes without an external profiler.
+ */
+const char PerfCount_fileid[] = "Hatari perfcount.c : " __DATE__ " " __TIME__;
+
+#include <stdio.h>
+#include "main.h"
+#include "log.h"
+#include "perfcount.h"
+
+Uint64 PerfCount_Time[PERFCOUNT_MAX];
+Uint32 PerfCount_Calls[PERFCOUNT_MAX];
+perfcount_t PerfCount_Current = PERFCOUNT_CPU;
+Uint64 PerfCount_Stamp;
+
+static Uint32 nPerfVBLs;		/* VBLs since last reset */
+static Uint32 nLogInterval;		/* seconds between log lines, 0 = off */
+static Uint64 nLogStamp;		/* host time of last log line */
+
+#if ENABLE_PERFCOUNT
+static const char *PerfCount_Names[PERFCOUNT_MAX] = {
+	"cpu",
+	"cycint",
+	"vidline",
+	"video",
+	"sound",
+	"dmasnd",
+	"dsp",
+	"fdc",
+	"wait"
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Charge time since last counter switch to the active counter
+ * and return the sum of all counters.
+ */
+static Uint64 PerfCount_Sync(void)
+{
+	Uint64 nTotal = 0;
+	int i;
+
+	PerfCount_Leave(PerfCount_Current);
+	for (i = 0; i < PERFCOUNT_MAX; i++)
+		nTotal += PerfCount_Time[i];
+	return nTotal;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Clear all counters
+ */
+void PerfCount_Reset(void)
+{
+	memset(PerfCount_Time, 0, sizeof(PerfCount_Time));
+	memset(PerfCount_Calls, 0, sizeof(PerfCount_Calls));
+	PerfCount_Stamp = PerfCount_Now();
+	nPerfVBLs = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show host time per VBL for each counter, over 'nVBLs' frames
+ */
+void PerfCount_Show(FILE *fp, Uint32 nVBLs)
+{
+#if ENABLE_PERFCOUNT
+	Uint64 nTotal = PerfCount_Sync();
+	int i;
+
+	if (!nVBLs || !nTotal)
+		return;
+
+	for (i = 0; i < PERFCOUNT_MAX; i++)
+	{
+		fprintf(fp, "  %-7s: %9.1f us/VBL (%5.1f%%), %u calls\n",
+			PerfCount_Names[i], PerfCount_Time[i] / 1000.0 / nVBLs,
+			100.0 * PerfCount_Time[i] / nTotal, PerfCount_Calls[i]);
+	}
+#else
+	fprintf(fp, "  (subsystem counters not compiled in, see ENABLE_PERFCOUNT)\n");
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on each VBL, log the counters when the log interval has passed
+ */
+void PerfCount_Update(void)
+{
+#if ENABLE_PERFCOUNT
+	char sLine[256];
+	Uint64 nTotal, now;
+	int i, len;
+
+	nPerfVBLs++;
+	if (!nLogInterval)
+		return;
+
+	now = PerfCount_Now();
+	if (now - nLogStamp < (Uint64)nLogInterval * 1000000000)
+		return;
+	nLogStamp = now;
+
+	nTotal = PerfCount_Sync();
+	if (!nTotal)
+		return;
+
+	len = snprintf(sLine, sizeof(sLine), "%u VBLs in %.2fs:",
+	               nPerfVBLs, nTotal / 1000000000.0);
+	for (i = 0; i < PERFCOUNT_MAX && len < (int)sizeof(sLine); i++)
+	{
+		len += snprintf(sLine + len, sizeof(sLine) - len, " %s %.1f%%",
+		                PerfCount_Names[i], 100.0 * PerfCount_Time[i] / nTotal);
+	}
+	Log_Printf(LOG_INFO, "PERF: %s\n", sLine);
+	PerfCount_Reset();
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Append " perf_<counter>=<percent>" for each counter to the given
+ * metrics line and clear the counters.
+ */
+void PerfCount_AppendShares(char *sLine, int size)
+{
+#if ENABLE_PERFCOUNT
+	Uint64 nTotal = PerfCount_Sync();
+	int i, len = 0;
+
+	if (!nTotal)
+		return;
+	for (i = 0; i < PERFCOUNT_MAX && len < size; i++)
+	{
+		len += snprintf(sLine + len, size - len, " perf_%s=%.1f",
+		                PerfCount_Names[i], 100.0 * PerfCount_Time[i] / nTotal);
+	}
+	PerfCount_Reset();
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Debugger "info" command: show counters since last reset. Given
+ * interval (in seconds) enables periodic logging, 0 disables it.
+ */
+void PerfCount_Info(Uint32 interval)
+{
+	fprintf(stderr, "Host time per emulated VBL, over %u VBLs:\n", nPerfVBLs);
+	PerfCount_Show(stderr, nPerfVBLs);
+
+	nLogInterval = interval;
+	nLogStamp = PerfCount_Now();
+	if (nLogInterval)
+		fprintf(stderr, "Logging counters every %u seconds.\n", nLogInterval);
+}
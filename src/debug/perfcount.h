@@ -0,0 +1,97 @@
+/*
+  Hatari - perfcount.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_PERFCOUNT_H
+#define HATARI_PERFCOUNT_H
+
+#if HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#endif
+
+/* Host time counters. Time is accounted exclusively to the innermost
+ * active counter, so nested ones (e.g. FDC in interrupt dispatch) are
+ * not counted twice and all counters add up to the total host time.
+ */
+typedef enum {
+	PERFCOUNT_CPU,		/* CPU core, and anything not accounted below */
+	PERFCOUNT_CYCINT,	/* rest of the cycle interrupt handler dispatch */
+	PERFCOUNT_VIDEOLINE,	/* shifter line copies to the ST screen buffer */
+	PERFCOUNT_VIDEO,	/* ST screen conversion to the host surface */
+	PERFCOUNT_SOUND,	/* YM sample generation */
+	PERFCOUNT_DMASND,	/* STE/TT DMA sound and Falcon crossbar mixing */
+	PERFCOUNT_DSP,		/* DSP 56k execution */
+	PERFCOUNT_FDC,		/* FDC command state machine */
+	PERFCOUNT_WAIT,		/* VBL wait, host frame pacing and frontend */
+	PERFCOUNT_MAX
+} perfcount_t;
+
+extern Uint64 PerfCount_Time[PERFCOUNT_MAX];
+extern Uint32 PerfCount_Calls[PERFCOUNT_MAX];
+extern perfcount_t PerfCount_Current;
+extern Uint64 PerfCount_Stamp;
+
+/**
+ * Return a host time stamp in nanoseconds
+ */
+static inline Uint64 PerfCount_Now(void)
+{
+#if defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (Uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#elif HAVE_GETTIMEOFDAY
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (Uint64)tv.tv_sec * 1000000000 + (Uint64)tv.tv_usec * 1000;
+#else
+	return (Uint64)SDL_GetTicks() * 1000000;
+#endif
+}
+
+/**
+ * Charge time so far to the active counter and switch to 'id'.
+ * @return  previously active counter, to be given to PerfCount_Leave()
+ */
+static inline perfcount_t PerfCount_Enter(perfcount_t id)
+{
+	perfcount_t prev = PerfCount_Current;
+	Uint64 now = PerfCount_Now();
+
+	PerfCount_Time[prev] += now - PerfCount_Stamp;
+	PerfCount_Stamp = now;
+	PerfCount_Current = id;
+	PerfCount_Calls[id]++;
+	return prev;
+}
+
+/**
+ * Charge time so far to the active counter and switch back to 'prev'
+ */
+static inline void PerfCount_Leave(perfcount_t prev)
+{
+	Uint64 now = PerfCount_Now();
+
+	PerfCount_Time[PerfCount_Current] += now - PerfCount_Stamp;
+	PerfCount_Stamp = now;
+	PerfCount_Current = prev;
+}
+
+#if ENABLE_PERFCOUNT
+# define PERFCOUNT_BEGIN(id, var)	perfcount_t var = PerfCount_Enter(id)
+# define PERFCOUNT_END(var)		PerfCount_Leave(var)
+#else
+# define PERFCOUNT_BEGIN(id, var)
+# define PERFCOUNT_END(var)
+#endif
+
+extern void PerfCount_Reset(void);
+extern void PerfCount_Show(FILE *fp, Uint32 nVBLs);
+extern void PerfCount_Update(void);
+extern void PerfCount_Info(Uint32 interval);
+extern void PerfCount_AppendShares(char *sLine, int size);
+
+#endif /* HATARI_PERFCOUNT_H */
@@ -0,0 +1,331 @@
+/*
+ * Hatari - sampler.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * sampler.c - low overhead statistical CPU profiler.  Unlike the profiler
+ * in profile.c, which accounts every executed instruction, this just takes
+ * a sample of the CPU state every N emulated cycles from a cycle interrupt,
+ * so it costs nothing when disabled and very little when enabled.
+ */
+const char Sampler_fileid[] = "Hatari sampler.c : " __DATE__ " " __TIME__;
+
+#include <stdio.h>
+#include "main.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "evaluate.h"
+#include "cycInt.h"
+#include "m68000.h"
+#include "sampler.h"
+#include "symbols.h"
+
+#define SAMPLES_MAX	(1 << 16)	/* ring buffer size, power of 2 */
+#define SAMPLE_CYCLES	1000		/* default sampling interval */
+
+typedef struct {
+	Uint32 pc;
+	Uint16 family;		/* OpcodeFamily of the last executed instruction */
+	Uint16 busmode;		/* BusMode at the time of the sample */
+} sample_t;
+
+/* aggregated sample, with symbol address instead of PC */
+typedef struct {
+	Uint32 addr;
+	const char *name;
+	Uint16 family;
+	Uint16 busmode;
+	bool shown;
+} sample_sym_t;
+
+static struct {
+	sample_t *samples;
+	Uint32 taken;		/* samples since last reset */
+	Uint32 interval;	/* in CPU cycles */
+	bool enabled;
+} sampler;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Cycle interrupt handler: store the current CPU state into the ring
+ * buffer and ask for the next interrupt.
+ */
+void Sampler_InterruptHandler(void)
+{
+	sample_t *sample;
+
+	CycInt_AcknowledgeInterrupt();
+	if (!sampler.enabled)
+		return;
+
+	sample = &sampler.samples[sampler.taken++ & (SAMPLES_MAX-1)];
+	sample->pc = M68000_GetPC();
+	sample->family = OpcodeFamily < MAX_OPCODE_FAMILY ? OpcodeFamily : 0;
+	sample->busmode = BusMode;
+
+	CycInt_AddRelativeInterrupt(sampler.interval, INT_CPU_CYCLE, INTERRUPT_SAMPLER);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start taking a sample every 'interval' CPU cycles, return success
+ */
+static bool Sampler_Start(Uint32 interval)
+{
+	if (!sampler.samples)
+	{
+		sampler.samples = malloc(SAMPLES_MAX * sizeof(sample_t));
+		if (!sampler.samples)
+		{
+			perror("ERROR, sample buffer allocation failed");
+			return false;
+		}
+	}
+	sampler.interval = interval;
+	sampler.taken = 0;
+	sampler.enabled = true;
+	/* still pending when re-enabled soon after 'off', removed on reset */
+	if (!CycInt_InterruptActive(INTERRUPT_SAMPLER))
+		CycInt_AddRelativeInterrupt(sampler.interval, INT_CPU_CYCLE, INTERRUPT_SAMPLER);
+	fprintf(stderr, "Sampling CPU every %u cycles.\n", sampler.interval);
+	return true;
+}
+
+
+/**
+ * Compare samples by symbol address, then bus mode and instruction
+ */
+static int Sampler_CompareSyms(const void *p1, const void *p2)
+{
+	const sample_sym_t *s1 = p1, *s2 = p2;
+
+	if (s1->addr != s2->addr)
+		return s1->addr < s2->addr ? -1 : 1;
+	if (s1->busmode != s2->busmode)
+		return s1->busmode - s2->busmode;
+	return s1->family - s2->family;
+}
+
+/**
+ * Return the collected samples mapped to their symbols and sorted,
+ * set collected samples count to 'count'.  Caller frees the array.
+ */
+static sample_sym_t *Sampler_GetSymbols(Uint32 *count)
+{
+	sample_sym_t *syms;
+	Uint32 i, addr;
+
+	*count = sampler.taken < SAMPLES_MAX ? sampler.taken : SAMPLES_MAX;
+	if (!*count)
+	{
+		fprintf(stderr, "No samples collected.\n");
+		return NULL;
+	}
+	syms = malloc(*count * sizeof(sample_sym_t));
+	if (!syms)
+	{
+		perror("ERROR, sample symbol allocation failed");
+		return NULL;
+	}
+	for (i = 0; i < *count; i++)
+	{
+		addr = sampler.samples[i].pc;
+		syms[i].name = Symbols_GetBeforeCpuAddress(&addr);
+		syms[i].addr = addr;
+		syms[i].family = sampler.samples[i].family;
+		syms[i].busmode = sampler.samples[i].busmode;
+		syms[i].shown = false;
+	}
+	qsort(syms, *count, sizeof(sample_sym_t), Sampler_CompareSyms);
+	return syms;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show how samples are distributed over the symbols (or addresses
+ * when there are no symbols), and over the instruction types.
+ */
+static void Sampler_Show(int show)
+{
+	static Uint32 families[MAX_OPCODE_FAMILY];
+	sample_sym_t *syms;
+	Uint32 count, i, start, shown, top;
+	int f;
+
+	syms = Sampler_GetSymbols(&count);
+	if (!syms)
+		return;
+
+	fprintf(stderr, "%u samples (%u taken), every %u CPU cycles.\n",
+		count, sampler.taken, sampler.interval);
+
+	/* symbols, largest first: select repeatedly the largest run */
+	fprintf(stderr, "Symbols:\n");
+	for (shown = 0; shown < (Uint32)show; shown++)
+	{
+		Uint32 best = 0, bestlen = 0;
+		for (start = 0; start < count; start = i)
+		{
+			for (i = start; i < count && syms[i].addr == syms[start].addr; i++)
+				;
+			if (i - start > bestlen && !syms[start].shown)
+			{
+				best = start;
+				bestlen = i - start;
+			}
+		}
+		if (!bestlen)
+			break;
+		if (syms[best].name)
+			fprintf(stderr, "- %5.2f%% %6u  %s\n", 100.0 * bestlen / count,
+				bestlen, syms[best].name);
+		else
+			fprintf(stderr, "- %5.2f%% %6u  0x%06x\n", 100.0 * bestlen / count,
+				bestlen, syms[best].addr);
+		syms[best].shown = true;
+	}
+	free(syms);
+
+	/* instruction types */
+	memset(families, 0, sizeof(families));
+	for (i = 0; i < count; i++)
+		families[sampler.samples[i].family]++;
+	fprintf(stderr, "Instructions:\n");
+	for (shown = 0; shown < (Uint32)show; shown++)
+	{
+		top = 0;
+		for (f = 1; f < MAX_OPCODE_FAMILY; f++)
+		{
+			if (families[f] > families[top])
+				top = f;
+		}
+		if (!families[top])
+			break;
+		fprintf(stderr, "- %5.2f%% %6u  %s\n", 100.0 * families[top] / count,
+			families[top], OpcodeName[top]);
+		families[top] = 0;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save samples in the "folded stacks" text format used by flamegraph
+ * tools: "<bus owner>;<symbol>;<instruction> <count>" per line.
+ */
+static void Sampler_Save(const char *fname)
+{
+	sample_sym_t *syms;
+	Uint32 count, i, start;
+	FILE *fp;
+
+	syms = Sampler_GetSymbols(&count);
+	if (!syms)
+		return;
+
+	fp = fopen(fname, "w");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: opening '%s' for writing failed!\n", fname);
+		free(syms);
+		return;
+	}
+	for (start = 0; start < count; start = i)
+	{
+		for (i = start; i < count && Sampler_CompareSyms(&syms[i], &syms[start]) == 0; i++)
+			;
+		fputs(syms[start].busmode == BUS_MODE_BLITTER ? "blitter;" : "cpu;", fp);
+		if (syms[start].name)
+			fprintf(fp, "%s;", syms[start].name);
+		else
+			fprintf(fp, "0x%06x;", syms[start].addr);
+		fprintf(fp, "%s %u\n", OpcodeName[syms[start].family], i - start);
+	}
+	fclose(fp);
+	free(syms);
+	fprintf(stderr, "%u samples saved to '%s'.\n", count, fname);
+}
+
+
+/* ------------------ debugger command parsing ----------------- */
+
+/**
+ * Readline match callback for sampler subcommand name completion.
+ * STATE = 0 -> different text from previous one.
+ * Return next match or NULL if no matches.
+ */
+char *Sampler_Match(const char *text, int state)
+{
+	static const char *names[] = {
+		"off", "on", "save", "show"
+	};
+	return DebugUI_MatchHelper(names, ARRAYSIZE(names), text, state);
+}
+
+const char Sampler_Description[] =
+	"<subcommand> [parameter]\n"
+	"\n"
+	"\tSubcommands:\n"
+	"\t- on [cycles]\n"
+	"\t- off\n"
+	"\t- show [count]\n"
+	"\t- save <file>\n"
+	"\n"
+	"\t'on' starts taking a sample of the CPU PC, bus owner and last\n"
+	"\tinstruction type every given number of CPU cycles (default 1000),\n"
+	"\tinto a buffer keeping the latest 65536 samples, 'off' stops it.\n"
+	"\tThis has a much smaller overhead than 'profile', so it can be\n"
+	"\tused on normal builds and content (e.g. from a --parse file).\n"
+	"\n"
+	"\t'show' lists the symbols (or addresses) and instruction types\n"
+	"\twith most samples.  'save' writes samples in the folded stacks\n"
+	"\tformat used by flamegraph tools.";
+
+/**
+ * Command: CPU sampling profiler control and result showing
+ */
+int Sampler_Command(int nArgc, char *psArgs[])
+{
+	static int show = 16;
+	Uint32 interval = SAMPLE_CYCLES;
+
+	if (nArgc < 2)
+	{
+		DebugUI_PrintCmdHelp(psArgs[0]);
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "on") == 0)
+	{
+		if (nArgc > 2 && (!Eval_Number(psArgs[2], &interval) || interval < 4))
+		{
+			fprintf(stderr, "Invalid sampling interval '%s'!\n", psArgs[2]);
+			return DEBUGGER_CMDDONE;
+		}
+		Sampler_Start(interval);
+	}
+	else if (strcmp(psArgs[1], "off") == 0)
+	{
+		/* the pending interrupt removes itself */
+		sampler.enabled = false;
+		fprintf(stderr, "Sampling disabled.\n");
+	}
+	else if (strcmp(psArgs[1], "show") == 0)
+	{
+		if (nArgc > 2)
+			show = atoi(psArgs[2]);
+		Sampler_Show(show);
+	}
+	else if (strcmp(psArgs[1], "save") == 0 && nArgc > 2)
+	{
+		Sampler_Save(psArgs[2]);
+	}
+	else
+	{
+		DebugUI_PrintCmdHelp(psArgs[0]);
+	}
+	return DEBUGGER_CMDDONE;
+}
@@ -0,0 +1,19 @@
+/*
+ * Hatari - sampler.h
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ */
+
+#ifndef HATARI_SAMPLER_H
+#define HATARI_SAMPLER_H
+
+/* sampler command parsing */
+extern const char Sampler_Description[];
+extern char *Sampler_Match(const char *text, int state);
+extern int Sampler_Command(int nArgc, char *psArgs[]);
+
+/* cycle interrupt handler taking the samples */
+extern void Sampler_InterruptHandler(void);
+
+#endif
@@ -43,6 +43,14 @@ typedef struct {
 	int symbols;		/* initial symbol count */
 	symbol_t *addresses;	/* items sorted by address */
 	symbol_t *names;	/* items sorted by symbol name */
+	/* address -> symbol index, for constant time address searches */
+	Uint32 page_base;	/* address of first symbol */
+	Uint32 pages;		/* page count */
+	int page_shift;		/* page size */
+	int *page_first;	/* index of first symbol at/after each page */
+	/* name -> symbol index hash, for constant time name searches */
+	Uint32 hash_mask;	/* hash table size - 1 */
+	int *hash;		/* indexes to names, -1 for unused */
 } symbol_list_t;
 
 typedef struct {
@@ -51,6 +59,13 @@ typedef struct {
 } prg_section_t;
 
 
+/* initial symbol count for ASCII symbol files */
+#define ASCII_SYMBOLS_MIN 1024
+
+/* address index page size and max. page count */
+#define PAGE_SHIFT_MIN	8
+#define PAGES_MAX	(1 << 20)
+
 /* how many characters the symbol name can have.
  * NOTE: change also sscanf width arg if you change this!!!
  */
@@ -397,27 +412,10 @@ static symbol_list_t* symbols_load_ascii(FILE *fp, Uint32 *offsets, Uint32 maxad
 	Uint32 address, offset;
 	symtype_t symtype;
 
-	/* count content lines */
-	symbols = 0;
-	while (fgets(buffer, sizeof(buffer), fp)) {
-		/* skip comments (AHCC SYM file comments start with '*') */
-		if (*buffer == '#' || *buffer == '*') {
-			continue;
-		}
-		/* skip empty lines */
-		for (buf = buffer; isspace((unsigned char)*buf); buf++);
-		if (!*buf) {
-			continue;
-		}
-		symbols++;
-	}
-	if (!symbols) {
-		fprintf(stderr, "ERROR: no symbols.\n");
-	}
-
-	fseek(fp, 0, SEEK_SET);
-
-	/* allocate space for symbol list & names */
+	/* allocate space for symbol list & names,
+	 * grown while reading the file in a single pass
+	 */
+	symbols = ASCII_SYMBOLS_MIN;
 	if (!(list = symbol_list_alloc(symbols))) {
 		return NULL;
 	}
@@ -434,7 +432,11 @@ static symbol_list_t* symbols_load_ascii(FILE *fp, Uint32 *offsets, Uint32 maxad
 		if (!*buf) {
 			continue;
 		}
-		assert(count < symbols); /* file not modified in meanwhile? */
+		if (count == symbols) {
+			symbols *= 2;
+			list->names = realloc(list->names, symbols * sizeof(symbol_t));
+			assert(list->names);
+		}
 		if (sscanf(buffer, "%x %c %32[0-9A-Za-z_.-]s", &address, &symchar, name) != 3) {
 			fprintf(stderr, "WARNING: syntax error on line %d, skipping.\n", line);
 			continue;
@@ -471,6 +473,9 @@ static symbol_list_t* symbols_load_ascii(FILE *fp, Uint32 *offsets, Uint32 maxad
 		assert(list->names[count].name);
 		count++;
 	}
+	if (!count) {
+		fprintf(stderr, "ERROR: no symbols.\n");
+	}
 	list->symbols = symbols;
 	list->count = count;
 	return list;
@@ -493,6 +498,77 @@ static bool is_atari_program(FILE *fp)
 	return (SDL_SwapBE16(magic) == 0x601A);
 }
 
+/**
+ * Build page index for searching symbols by their address
+ * from the list of symbols sorted by address.
+ */
+static void symbols_index_pages(symbol_list_t *list)
+{
+	Uint32 span, page;
+	Uint64 start;
+	int i, shift;
+
+	list->page_base = list->addresses[0].address;
+	span = list->addresses[list->count-1].address - list->page_base;
+	shift = PAGE_SHIFT_MIN;
+	while ((span >> shift) >= PAGES_MAX) {
+		shift++;
+	}
+	list->page_shift = shift;
+	list->pages = (span >> shift) + 1;
+	list->page_first = malloc((list->pages + 1) * sizeof(int));
+	assert(list->page_first);
+
+	i = 0;
+	for (page = 0; page <= list->pages; page++) {
+		start = (Uint64)page << shift;
+		while (i < list->count &&
+		       list->addresses[i].address - list->page_base < start) {
+			i++;
+		}
+		list->page_first[page] = i;
+	}
+}
+
+/**
+ * Return hash for given symbol name
+ */
+static Uint32 symbol_name_hash(const char *name)
+{
+	Uint32 hash = 2166136261u;	/* FNV-1a */
+
+	while (*name) {
+		hash ^= (unsigned char)*name++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Build hash index for searching symbols by their name
+ * from the list of symbols sorted by name.
+ */
+static void symbols_index_names(symbol_list_t *list)
+{
+	Uint32 size, h;
+	int i;
+
+	/* keep table at most half full */
+	for (size = 16; size < 2 * (Uint32)list->count; size *= 2);
+	list->hash_mask = size - 1;
+	list->hash = malloc(size * sizeof(int));
+	assert(list->hash);
+	memset(list->hash, -1, size * sizeof(int));
+
+	for (i = 0; i < list->count; i++) {
+		h = symbol_name_hash(list->names[i].name) & list->hash_mask;
+		while (list->hash[h] >= 0) {
+			h = (h + 1) & list->hash_mask;
+		}
+		list->hash[h] = i;
+	}
+}
+
 /**
  * Load symbols of given type and the symbol address addresses from
  * the given file and add given offsets to the addresses.
@@ -549,6 +625,8 @@ static symbol_list_t* Symbols_Load(const char *filename, Uint32 *offsets, Uint32
 	/* sort both lists, with different criteria */
 	qsort(list->addresses, list->count, sizeof(symbol_t), symbols_by_address);
 	qsort(list->names, list->count, sizeof(symbol_t), symbols_by_name);
+	symbols_index_pages(list);
+	symbols_index_names(list);
 
 	fprintf(stderr, "Loaded %d symbols from '%s'.\n", list->count, filename);
 	return list;
@@ -571,10 +649,14 @@ static void Symbols_Free(symbol_list_t* list)
 	}
 	free(list->addresses);
 	free(list->names);
+	free(list->page_first);
+	free(list->hash);
 
 	/* catch use of freed list */
 	list->addresses = NULL;
 	list->names = NULL;
+	list->page_first = NULL;
+	list->hash = NULL;
 	list->count = 0;
 	free(list);
 }
@@ -591,26 +673,38 @@ static char* Symbols_MatchByName(symbol_list_t* list, symtype_t symtype, const c
 {
 	static int i, len;
 	const symbol_t *entry;
+	/* left, right, middle */
+	int l, r, m;
 	
 	if (!list) {
 		return NULL;
 	}
+	entry = list->names;
 
 	if (!state) {
-		/* first match */
+		/* first match, names are sorted so bisect
+		 * for the first one not before given prefix
+		 */
 		len = strlen(text);
-		i = 0;
+		l = 0;
+		r = list->count;
+		while (l < r) {
+			m = (l+r) >> 1;
+			if (strncmp(entry[m].name, text, len) < 0) {
+				l = m+1;
+			} else {
+				r = m;
+			}
+		}
+		i = l;
 	}
 
-	/* next match */
-	entry = list->names;
-	while (i < list->count) {
-		if ((entry[i].type & symtype) &&
-		    strncmp(entry[i].name, text, len) == 0) {
+	/* next match, all of them follow each other */
+	while (i < list->count && strncmp(entry[i].name, text, len) == 0) {
+		if (entry[i].type & symtype) {
 			return strdup(entry[i++].name);
-		} else {
-			i++;
 		}
+		i++;
 	}
 	return NULL;
 }
@@ -661,29 +755,21 @@ char* Symbols_MatchDspDataAddress(const char *text, int state)
 static const symbol_t* Symbols_SearchByName(symbol_list_t* list, symtype_t symtype, const char *name)
 {
 	symbol_t *entries;
-	/* left, right, middle */
-        int l, r, m, dir;
+	Uint32 h;
+	int i;
 
 	if (!list) {
 		return NULL;
 	}
 	entries = list->names;
 
-	/* bisect */
-	l = 0;
-	r = list->count - 1;
-	do {
-		m = (l+r) >> 1;
-		dir = strcmp(entries[m].name, name);
-		if (dir == 0 && (entries[m].type & symtype)) {
-			return &(entries[m]);
-		}
-		if (dir > 0) {
-			r = m-1;
-		} else {
-			l = m+1;
+	h = symbol_name_hash(name) & list->hash_mask;
+	while ((i = list->hash[h]) >= 0) {
+		if ((entries[i].type & symtype) && strcmp(entries[i].name, name) == 0) {
+			return &(entries[i]);
 		}
-	} while (l <= r);
+		h = (h + 1) & list->hash_mask;
+	}
 	return NULL;
 }
 
@@ -725,30 +811,25 @@ bool Symbols_GetDspAddress(symtype_t symtype, const char *name, Uint32 *addr)
 static int Symbols_SearchByAddress(symbol_list_t* list, Uint32 addr)
 {
 	symbol_t *entries;
-	/* left, right, middle */
-        int l, r, m;
-	Uint32 curr;
+	Uint32 page;
+	int i, end;
 
-	if (!list) {
+	if (!list || addr < list->page_base) {
+		return -1;
+	}
+	page = (addr - list->page_base) >> list->page_shift;
+	if (page >= list->pages) {
 		return -1;
 	}
 	entries = list->addresses;
 
-	/* bisect */
-	l = 0;
-	r = list->count - 1;
-	do {
-		m = (l+r) >> 1;
-		curr = entries[m].address;
-		if (curr == addr) {
-			return m;
-		}
-		if (curr > addr) {
-			r = m-1;
-		} else {
-			l = m+1;
+	/* pages have only few symbols, if any */
+	end = list->page_first[page+1];
+	for (i = list->page_first[page]; i < end; i++) {
+		if (entries[i].address >= addr) {
+			return (entries[i].address == addr) ? i : -1;
 		}
-	} while (l <= r);
+	}
 	return -1;
 }
 
@@ -779,6 +860,42 @@ const char* Symbols_GetByDspAddress(Uint32 addr)
 	return DspSymbolsList->addresses[idx].name;
 }
 
+/**
+ * Search CPU symbol at or before given address.
+ * Return symbol name and set 'addr' to its address if one is found,
+ * otherwise return NULL and leave 'addr' as it is.
+ * Returned name is valid only until next Symbols_* function call.
+ */
+const char* Symbols_GetBeforeCpuAddress(Uint32 *addr)
+{
+	symbol_list_t *list = CpuSymbolsList;
+	symbol_t *entries;
+	Uint32 page;
+	int found;
+
+	if (!list || *addr < list->page_base) {
+		return NULL;
+	}
+	entries = list->addresses;
+
+	page = (*addr - list->page_base) >> list->page_shift;
+	if (page >= list->pages) {
+		found = list->count - 1;
+	} else {
+		/* last entry not above addr, in this or earlier pages */
+		found = list->page_first[page+1];
+		while (found > list->page_first[page] && entries[found-1].address > *addr) {
+			found--;
+		}
+		found--;
+	}
+	if (found < 0) {
+		return NULL;
+	}
+	*addr = entries[found].address;
+	return entries[found].name;
+}
+
 /**
  * Search CPU symbol by address.
  * Return symbol index if address matches, -1 otherwise.
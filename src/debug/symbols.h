@@ -31,6 +31,8 @@ extern bool Symbols_GetDspAddress(symtype_t symtype, const char *name, Uint32 *a
 /* symbol address -> name search */
 extern const char* Symbols_GetByCpuAddress(Uint32 addr);
 extern const char* Symbols_GetByDspAddress(Uint32 addr);
+/* nearest preceding symbol search */
+extern const char* Symbols_GetBeforeCpuAddress(Uint32 *addr);
 /* symbol address -> index */
 extern int Symbols_GetCpuAddressIndex(Uint32 addr);
 extern int Symbols_GetDspAddressIndex(Uint32 addr);
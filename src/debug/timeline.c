@@ -0,0 +1,377 @@
+/*
+ * Hatari - timeline.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * timeline.c - per scanline bus usage profiler.  Records for each HBL
+ * the CPU and blitter cycles, DMA sound and FDC DMA transfers and the
+ * interrupts taken, for the latest frames, to see what consumed each
+ * scanline in raster effects and other timing critical code.
+ */
+const char Timeline_fileid[] = "Hatari timeline.c : " __DATE__ " " __TIME__;
+
+#include <stdio.h>
+#include "main.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "evaluate.h"
+#include "m68000.h"
+#include "screen.h"
+#include "timeline.h"
+#include "video.h"
+
+#define TIMELINE_FRAMES	64	/* ring buffer size, power of 2 */
+#define TIMELINE_LINES	1024	/* more lines are added to the last one */
+#define TIMELINE_PPM_SCALE 4	/* heat map pixels per frame */
+
+typedef struct {
+	Uint32 vbl;		/* VBL count at the end of the frame */
+	Uint32 lines;
+	timeline_line_t line[TIMELINE_LINES];
+} timeline_frame_t;
+
+bool bTimelineEnabled;
+timeline_line_t TimelineLine;
+
+static struct {
+	timeline_frame_t *frames;
+	Uint32 done;		/* completed frames since enabling */
+	Uint64 clock;		/* CPU clock at the start of current line */
+	bool synced;		/* first VBL seen, i.e. frames are complete */
+} timeline;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store what was done on given scanline and start a new one.
+ * If bEndFrame is set, start also a new frame.
+ */
+void Timeline_EndLine(int line, bool bEndFrame)
+{
+	timeline_frame_t *frame;
+	timeline_line_t *l;
+
+	TimelineLine.cpu = CyclesGlobalClockCounter - timeline.clock;
+	timeline.clock = CyclesGlobalClockCounter;
+
+	if (!timeline.synced)
+	{
+		/* skip the partial frame before the first VBL */
+		memset(&TimelineLine, 0, sizeof(TimelineLine));
+		timeline.synced = bEndFrame;
+		return;
+	}
+
+	frame = &timeline.frames[timeline.done & (TIMELINE_FRAMES-1)];
+	if (line < 0)
+		line = 0;
+	if (line >= TIMELINE_LINES)
+		line = TIMELINE_LINES - 1;
+	l = &frame->line[line];
+	l->cpu += TimelineLine.cpu;
+	l->blitter += TimelineLine.blitter;
+	l->dmasnd += TimelineLine.dmasnd;
+	l->fdc += TimelineLine.fdc;
+	l->irqs |= TimelineLine.irqs;
+	if ((Uint32)line >= frame->lines)
+		frame->lines = line + 1;
+	memset(&TimelineLine, 0, sizeof(TimelineLine));
+
+	if (bEndFrame)
+	{
+		frame->vbl = nVBLs;
+		timeline.done++;
+		frame = &timeline.frames[timeline.done & (TIMELINE_FRAMES-1)];
+		memset(frame, 0, sizeof(*frame));
+	}
+}
+
+/**
+ * Mark interrupt exception 'nr' taken on the current line:
+ * bits 1-7 are auto-vectored interrupt levels, bit 8 is DSP
+ * and bits 16-31 are the MFP interrupt channels.
+ */
+void Timeline_AddInterrupt(int nr, int ExceptionSource)
+{
+	switch (ExceptionSource)
+	{
+	case M68000_EXC_SRC_AUTOVEC:
+		if (nr > 24 && nr < 32)
+			TimelineLine.irqs |= 1 << (nr - 24);
+		break;
+	case M68000_EXC_SRC_INT_DSP:
+		TimelineLine.irqs |= 1 << 8;
+		break;
+	case M68000_EXC_SRC_INT_MFP:
+		/* MFP vector base is a multiple of 16 */
+		TimelineLine.irqs |= 1u << (16 + (nr & 15));
+		break;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start recording the scanlines, return success
+ */
+static bool Timeline_Start(void)
+{
+	if (!timeline.frames)
+	{
+		timeline.frames = malloc(TIMELINE_FRAMES * sizeof(timeline_frame_t));
+		if (!timeline.frames)
+		{
+			perror("ERROR, timeline buffer allocation failed");
+			return false;
+		}
+	}
+	memset(timeline.frames, 0, sizeof(timeline_frame_t));
+	memset(&TimelineLine, 0, sizeof(TimelineLine));
+	timeline.done = 0;
+	timeline.synced = false;
+	timeline.clock = CyclesGlobalClockCounter;
+	bTimelineEnabled = true;
+	fprintf(stderr, "Recording scanline timeline from next VBL.\n");
+	return true;
+}
+
+/**
+ * Return number of recorded frames, set 'first' to the oldest one
+ */
+static Uint32 Timeline_Frames(Uint32 *first)
+{
+	Uint32 count = timeline.done;
+
+	if (count > TIMELINE_FRAMES - 1)
+		count = TIMELINE_FRAMES - 1;
+	*first = timeline.done - count;
+	if (!count)
+		fprintf(stderr, "No complete frames recorded.\n");
+	return count;
+}
+
+/**
+ * Return given interrupts bitmask as text
+ */
+static const char *Timeline_IrqNames(Uint32 irqs)
+{
+	static char names[128];
+	int i, len = 0;
+
+	names[0] = '\0';
+	for (i = 1; i < 32; i++)
+	{
+		if (!(irqs & (1u << i)))
+			continue;
+		if (i == 2)
+			len += sprintf(names + len, " HBL");
+		else if (i == 4)
+			len += sprintf(names + len, " VBL");
+		else if (i < 8)
+			len += sprintf(names + len, " L%d", i);
+		else if (i == 8)
+			len += sprintf(names + len, " DSP");
+		else if (i >= 16)
+			len += sprintf(names + len, " MFP%d", i - 16);
+	}
+	return names;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show frame totals and the lines where something else than
+ * the CPU was using the bus, or interrupts were taken.
+ * 'back' tells how many frames before the latest one to show.
+ */
+static void Timeline_Show(Uint32 back)
+{
+	timeline_frame_t *frame;
+	timeline_line_t *l, sum;
+	Uint32 first, count, i;
+
+	count = Timeline_Frames(&first);
+	if (!count)
+		return;
+	if (back >= count)
+	{
+		fprintf(stderr, "Only %u frames recorded.\n", count);
+		return;
+	}
+	frame = &timeline.frames[(timeline.done - 1 - back) & (TIMELINE_FRAMES-1)];
+
+	memset(&sum, 0, sizeof(sum));
+	fprintf(stderr, "line    CPU blitter DMAsnd FDC  interrupts\n");
+	for (i = 0; i < frame->lines; i++)
+	{
+		l = &frame->line[i];
+		sum.cpu += l->cpu;
+		sum.blitter += l->blitter;
+		sum.dmasnd += l->dmasnd;
+		sum.fdc += l->fdc;
+		if (!(l->blitter || l->dmasnd || l->fdc || l->irqs))
+			continue;
+		fprintf(stderr, "%4u %6u %7u %6u %3u %s\n", i, l->cpu, l->blitter,
+			l->dmasnd, l->fdc, Timeline_IrqNames(l->irqs));
+	}
+	fprintf(stderr, "Frame at VBL %u: %u lines, %u CPU + %u blitter cycles (%.1f%% blitter),\n"
+		"%u DMA sound bytes, %u FDC DMA bytes.\n",
+		frame->vbl, frame->lines, sum.cpu, sum.blitter,
+		sum.cpu + sum.blitter ? 100.0 * sum.blitter / (sum.cpu + sum.blitter) : 0.0,
+		sum.dmasnd, sum.fdc);
+}
+
+
+/**
+ * Save recorded frames as CSV, or if file name doesn't end with ".csv",
+ * as a PPM image heat map: a column per frame and a row per scanline,
+ * with the blitter bus share in red, and DMA sound and FDC DMA bytes
+ * (relative to their maximum) in green and blue.
+ */
+static void Timeline_Save(const char *fname)
+{
+	timeline_frame_t *frame;
+	timeline_line_t *l;
+	Uint32 first, count, f, i, x, lines = 0, maxsnd = 1, maxfdc = 1;
+	Uint8 rgb[3];
+	size_t len;
+	bool csv;
+	FILE *fp;
+
+	count = Timeline_Frames(&first);
+	if (!count)
+		return;
+
+	len = strlen(fname);
+	csv = (len > 4 && strcasecmp(fname + len - 4, ".csv") == 0);
+	fp = fopen(fname, csv ? "w" : "wb");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: opening '%s' for writing failed!\n", fname);
+		return;
+	}
+
+	if (csv)
+		fputs("vbl,line,cpu,blitter,dmasnd,fdc,irqs\n", fp);
+	for (f = first; f < first + count; f++)
+	{
+		frame = &timeline.frames[f & (TIMELINE_FRAMES-1)];
+		if (frame->lines > lines)
+			lines = frame->lines;
+		for (i = 0; i < frame->lines; i++)
+		{
+			l = &frame->line[i];
+			if (csv)
+				fprintf(fp, "%u,%u,%u,%u,%u,%u,0x%x\n",
+					frame->vbl, i, l->cpu, l->blitter,
+					l->dmasnd, l->fdc, l->irqs);
+			if (l->dmasnd > maxsnd)
+				maxsnd = l->dmasnd;
+			if (l->fdc > maxfdc)
+				maxfdc = l->fdc;
+		}
+	}
+
+	if (!csv)
+	{
+		fprintf(fp, "P6\n%u %u\n255\n", count * TIMELINE_PPM_SCALE, lines);
+		for (i = 0; i < lines; i++)
+		{
+			for (f = first; f < first + count; f++)
+			{
+				frame = &timeline.frames[f & (TIMELINE_FRAMES-1)];
+				l = &frame->line[i];
+				memset(rgb, 0, sizeof(rgb));
+				if (i < frame->lines)
+				{
+					if (l->cpu + l->blitter)
+						rgb[0] = 255 * l->blitter / (l->cpu + l->blitter);
+					rgb[1] = 255 * l->dmasnd / maxsnd;
+					rgb[2] = 255 * l->fdc / maxfdc;
+				}
+				for (x = 0; x < TIMELINE_PPM_SCALE; x++)
+					fwrite(rgb, sizeof(rgb), 1, fp);
+			}
+		}
+	}
+	fclose(fp);
+	fprintf(stderr, "%u frames saved to '%s'.\n", count, fname);
+}
+
+
+/* ------------------ debugger command parsing ----------------- */
+
+/**
+ * Readline match callback for timeline subcommand name completion.
+ * STATE = 0 -> different text from previous one.
+ * Return next match or NULL if no matches.
+ */
+char *Timeline_Match(const char *text, int state)
+{
+	static const char *names[] = {
+		"off", "on", "save", "show"
+	};
+	return DebugUI_MatchHelper(names, ARRAYSIZE(names), text, state);
+}
+
+const char Timeline_Description[] =
+	"<subcommand> [parameter]\n"
+	"\n"
+	"\tSubcommands:\n"
+	"\t- on\n"
+	"\t- off\n"
+	"\t- show [frame]\n"
+	"\t- save <file>\n"
+	"\n"
+	"\t'on' starts recording for every scanline the CPU and blitter\n"
+	"\tcycles, DMA sound and FDC DMA bytes, and the interrupts taken,\n"
+	"\tfor the latest 63 frames, 'off' stops it.\n"
+	"\n"
+	"\t'show' lists the frame totals and the scanlines with blitter,\n"
+	"\tDMA or interrupt activity for the latest frame, or given number\n"
+	"\tof frames before it.  'save' writes the recorded frames either\n"
+	"\tas CSV (when file name ends with '.csv') or as a PPM heat map\n"
+	"\timage with a column per frame and a row per scanline: blitter\n"
+	"\tbus share is shown in red, DMA sound in green and FDC DMA in blue.";
+
+/**
+ * Command: scanline timeline control and result showing
+ */
+int Timeline_Command(int nArgc, char *psArgs[])
+{
+	Uint32 back = 0;
+
+	if (nArgc < 2)
+	{
+		DebugUI_PrintCmdHelp(psArgs[0]);
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "on") == 0)
+	{
+		Timeline_Start();
+	}
+	else if (strcmp(psArgs[1], "off") == 0)
+	{
+		bTimelineEnabled = false;
+		fprintf(stderr, "Timeline recording disabled.\n");
+	}
+	else if (strcmp(psArgs[1], "show") == 0)
+	{
+		if (nArgc > 2 && !Eval_Number(psArgs[2], &back))
+		{
+			fprintf(stderr, "Invalid frame number '%s'!\n", psArgs[2]);
+			return DEBUGGER_CMDDONE;
+		}
+		Timeline_Show(back);
+	}
+	else if (strcmp(psArgs[1], "save") == 0 && nArgc > 2)
+	{
+		Timeline_Save(psArgs[2]);
+	}
+	else
+	{
+		DebugUI_PrintCmdHelp(psArgs[0]);
+	}
+	return DEBUGGER_CMDDONE;
+}
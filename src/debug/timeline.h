@@ -0,0 +1,50 @@
+/*
+ * Hatari - timeline.h
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ */
+
+#ifndef HATARI_TIMELINE_H
+#define HATARI_TIMELINE_H
+
+/* what was done on the current scanline */
+typedef struct {
+	Uint32 cpu;		/* CPU cycles */
+	Uint32 blitter;		/* blitter bus cycles */
+	Uint32 dmasnd;		/* bytes read by DMA sound */
+	Uint32 fdc;		/* bytes transferred by FDC DMA */
+	Uint32 irqs;		/* taken interrupts, see Timeline_AddInterrupt() */
+} timeline_line_t;
+
+extern bool bTimelineEnabled;
+extern timeline_line_t TimelineLine;
+
+/* timeline command parsing */
+extern const char Timeline_Description[];
+extern char *Timeline_Match(const char *text, int state);
+extern int Timeline_Command(int nArgc, char *psArgs[]);
+
+/* called from HBL and VBL handlers, and on interrupts */
+extern void Timeline_EndLine(int line, bool bEndFrame);
+extern void Timeline_AddInterrupt(int nr, int ExceptionSource);
+
+static inline void Timeline_AddBlitter(int cycles)
+{
+	if (unlikely(bTimelineEnabled))
+		TimelineLine.blitter += cycles;
+}
+
+static inline void Timeline_AddDmaSnd(int bytes)
+{
+	if (unlikely(bTimelineEnabled))
+		TimelineLine.dmasnd += bytes;
+}
+
+static inline void Timeline_AddFdc(int bytes)
+{
+	if (unlikely(bTimelineEnabled))
+		TimelineLine.fdc += bytes;
+}
+
+#endif
@@ -0,0 +1,349 @@
+/*
+  Hatari - diskPrefetch.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Background loading of the floppy images that are likely to be inserted
+  next, e.g. the next and previous disks of a multi-disk playlist.
+
+  DiskPrefetch_Set() gives the list of wanted images, and a loader thread
+  reads and uncompresses them into memory with the same functions as
+  Floppy_InsertDiskIntoDrive(). When one of them is then inserted,
+  Floppy_InsertDiskIntoDrive() gets its buffer from DiskPrefetch_Take()
+  instead of loading the file, so a disk swap does not stall the frontend.
+
+  Only the file loading is done in the thread: the STX structures are still
+  built at insert time, IPF images are not prefetched (they are parsed by
+  the capsimage library at insert time anyway), and neither are raw .ST
+  images that are memory-mapped with the disk overlay.
+
+  Without thread support, nothing is prefetched.
+*/
+const char DiskPrefetch_fileid[] = "Hatari diskPrefetch.c : " __DATE__ " " __TIME__;
+
+#include <sys/stat.h>
+
+#include "main.h"
+#include "configuration.h"
+#include "diskPrefetch.h"
+#include "dim.h"
+#include "floppy.h"
+#include "floppy_ipf.h"
+#include "floppy_stx.h"
+#include "msa.h"
+#include "st.h"
+#include "zip.h"
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+
+typedef struct {
+	char *filename;				/* NULL if slot is unused */
+	bool loaded;				/* loading done (buffer NULL on failure) */
+	Uint8 *pBuffer;
+	long nImageBytes;
+	int ImageType;
+	time_t mtime;				/* file state when it was loaded */
+	off_t size;
+} prefetch_slot_t;
+
+static struct {
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;				/* signaled when a slot is requested or loaded */
+	prefetch_slot_t slots[DISKPREFETCH_MAX];
+	int loading;				/* slot being loaded, -1 if none */
+	bool quit;
+	bool failedInit;			/* thread creation failed, don't retry */
+} prefetch;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Load image file like Floppy_InsertDiskIntoDrive() does, return the
+ * disk buffer or NULL. Called from the loader thread.
+ */
+static Uint8 *DiskPrefetch_ReadImage(const char *filename, long *pImageBytes, int *pImageType)
+{
+	if (MSA_FileNameIsMSA(filename, true))
+		return MSA_ReadDisk(0, filename, pImageBytes, pImageType);
+	if (ST_FileNameIsST(filename, true))
+		return ST_ReadDisk(0, filename, pImageBytes, pImageType);
+	if (DIM_FileNameIsDIM(filename, true))
+		return DIM_ReadDisk(0, filename, pImageBytes, pImageType);
+	if (STX_FileNameIsSTX(filename, true))
+		return STX_ReadDisk(0, filename, pImageBytes, pImageType);
+	if (ZIP_FileNameIsZIP(filename))
+		return ZIP_ReadDiskUncached(filename, NULL, pImageBytes, pImageType);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the buffer and name of a slot (called with the lock held)
+ */
+static void DiskPrefetch_ClearSlot(prefetch_slot_t *slot)
+{
+	free(slot->pBuffer);
+	free(slot->filename);
+	memset(slot, 0, sizeof(*slot));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Loader thread: load the requested slots one by one,
+ * until DiskPrefetch_UnInit() is called.
+ */
+static void DiskPrefetch_ThreadFunc(void *data)
+{
+	prefetch_slot_t *slot, result;
+	struct stat st;
+	char *filename;
+	int i;
+
+	slock_lock(prefetch.lock);
+	for (;;)
+	{
+		for (i = 0; i < DISKPREFETCH_MAX; i++)
+		{
+			if (prefetch.slots[i].filename && !prefetch.slots[i].loaded)
+				break;
+		}
+		if (prefetch.quit)
+			break;
+		if (i == DISKPREFETCH_MAX)
+		{
+			scond_wait(prefetch.cond, prefetch.lock);
+			continue;
+		}
+
+		/* The slot can be changed while the file is loaded */
+		filename = strdup(prefetch.slots[i].filename);
+		prefetch.loading = i;
+		slock_unlock(prefetch.lock);
+
+		memset(&result, 0, sizeof(result));
+		if (filename && stat(filename, &st) == 0)
+		{
+			result.pBuffer = DiskPrefetch_ReadImage(filename, &result.nImageBytes, &result.ImageType);
+			result.mtime = st.st_mtime;
+			result.size = st.st_size;
+		}
+
+		slock_lock(prefetch.lock);
+		slot = &prefetch.slots[i];
+		if (filename && slot->filename && strcmp(slot->filename, filename) == 0)
+		{
+			slot->pBuffer = result.pBuffer;
+			slot->nImageBytes = result.nImageBytes;
+			slot->ImageType = result.ImageType;
+			slot->mtime = result.mtime;
+			slot->size = result.size;
+			slot->loaded = true;
+		}
+		else
+		{
+			free(result.pBuffer);
+			if (!filename)
+				DiskPrefetch_ClearSlot(slot);
+		}
+		free(filename);
+		prefetch.loading = -1;
+		scond_broadcast(prefetch.cond);
+	}
+	slock_unlock(prefetch.lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the loader thread if not done yet, return true if it's available
+ */
+static bool DiskPrefetch_Start(void)
+{
+	if (prefetch.thread)
+		return true;
+	if (prefetch.failedInit)
+		return false;
+
+	prefetch.loading = -1;
+	prefetch.lock = slock_new();
+	prefetch.cond = scond_new();
+	if (prefetch.lock && prefetch.cond)
+		prefetch.thread = sthread_create(DiskPrefetch_ThreadFunc, NULL);
+
+	if (!prefetch.thread)
+	{
+		fprintf(stderr, "Failed to create disk prefetch thread, disks are loaded at insert.\n");
+		DiskPrefetch_UnInit();
+		prefetch.failedInit = true;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the image file is worth loading in advance
+ */
+static bool DiskPrefetch_IsWanted(const char *filename)
+{
+	if (!filename || !filename[0] || IPF_FileNameIsIPF(filename, true))
+		return false;
+	if (ConfigureParams.DiskImage.bDiskOverlay && ST_FileNameIsST(filename, false))
+		return false;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set the images to keep loaded in advance (at most DISKPREFETCH_MAX,
+ * NULL entries are ignored). Images that were loaded before but are
+ * not in the list anymore are freed.
+ */
+void DiskPrefetch_Set(const char * const ppszFileNames[], int nFiles)
+{
+	prefetch_slot_t *slot;
+	int i, j;
+
+	if (!DiskPrefetch_Start())
+		return;
+
+	slock_lock(prefetch.lock);
+
+	/* Drop the images not wanted anymore */
+	for (i = 0; i < DISKPREFETCH_MAX; i++)
+	{
+		slot = &prefetch.slots[i];
+		if (!slot->filename)
+			continue;
+		for (j = 0; j < nFiles; j++)
+		{
+			if (ppszFileNames[j] && strcmp(slot->filename, ppszFileNames[j]) == 0)
+				break;
+		}
+		if (j == nFiles)
+			DiskPrefetch_ClearSlot(slot);
+	}
+
+	/* And request the new ones */
+	for (j = 0; j < nFiles; j++)
+	{
+		if (!DiskPrefetch_IsWanted(ppszFileNames[j]))
+			continue;
+		for (i = 0; i < DISKPREFETCH_MAX; i++)
+		{
+			if (prefetch.slots[i].filename
+			    && strcmp(prefetch.slots[i].filename, ppszFileNames[j]) == 0)
+				break;
+		}
+		if (i < DISKPREFETCH_MAX)
+			continue;
+		for (i = 0; i < DISKPREFETCH_MAX && prefetch.slots[i].filename; i++)
+			;
+		if (i == DISKPREFETCH_MAX)
+			break;
+		prefetch.slots[i].filename = strdup(ppszFileNames[j]);
+	}
+
+	scond_broadcast(prefetch.cond);
+	slock_unlock(prefetch.lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * If image 'pszFileName' was requested with DiskPrefetch_Set(), wait for
+ * its loading to end if it is in progress, and return its disk buffer
+ * (to be freed by the caller) with its size and type. Return NULL if
+ * the image is not loaded, failed to load or changed since.
+ */
+Uint8 *DiskPrefetch_Take(const char *pszFileName, long *pImageSize, int *pImageType)
+{
+	prefetch_slot_t *slot = NULL;
+	Uint8 *pBuffer = NULL;
+	struct stat st;
+	int i;
+
+	if (!prefetch.thread)
+		return NULL;
+
+	slock_lock(prefetch.lock);
+	for (i = 0; i < DISKPREFETCH_MAX; i++)
+	{
+		if (prefetch.slots[i].filename && strcmp(prefetch.slots[i].filename, pszFileName) == 0)
+		{
+			slot = &prefetch.slots[i];
+			break;
+		}
+	}
+	if (slot)
+	{
+		while (prefetch.loading == i && !slot->loaded)
+			scond_wait(prefetch.cond, prefetch.lock);
+		if (slot->loaded && slot->pBuffer && stat(pszFileName, &st) == 0
+		    && st.st_mtime == slot->mtime && st.st_size == slot->size)
+		{
+			pBuffer = slot->pBuffer;
+			*pImageSize = slot->nImageBytes;
+			*pImageType = slot->ImageType;
+			slot->pBuffer = NULL;
+		}
+		DiskPrefetch_ClearSlot(slot);
+	}
+	slock_unlock(prefetch.lock);
+
+	return pBuffer;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the loader thread and free the prefetched images
+ */
+void DiskPrefetch_UnInit(void)
+{
+	int i;
+
+	if (prefetch.thread)
+	{
+		slock_lock(prefetch.lock);
+		prefetch.quit = true;
+		scond_broadcast(prefetch.cond);
+		slock_unlock(prefetch.lock);
+		sthread_join(prefetch.thread);
+		prefetch.thread = NULL;
+	}
+	if (prefetch.cond)
+		scond_free(prefetch.cond);
+	if (prefetch.lock)
+		slock_free(prefetch.lock);
+	prefetch.cond = NULL;
+	prefetch.lock = NULL;
+	for (i = 0; i < DISKPREFETCH_MAX; i++)
+		DiskPrefetch_ClearSlot(&prefetch.slots[i]);
+	prefetch.loading = -1;
+	prefetch.quit = false;
+}
+
+#else	/* no threads */
+
+void DiskPrefetch_Set(const char * const ppszFileNames[], int nFiles)
+{
+}
+
+Uint8 *DiskPrefetch_Take(const char *pszFileName, long *pImageSize, int *pImageType)
+{
+	return NULL;
+}
+
+void DiskPrefetch_UnInit(void)
+{
+}
+
+#endif
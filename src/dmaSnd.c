@@ -108,6 +108,7 @@ const char DmaSnd_fileid[] = "Hatari dmaSnd.c : " __DATE__ " " __TIME__;
 #include "stMemory.h"
 #include "crossbar.h"
 #include "screen.h"
+#include "timeline.h"
 #include "video.h"
 #include "m68000.h"
 
@@ -317,6 +318,7 @@ static void DmaSnd_FIFO_Refill(void)
 		dma.FIFO[ ( dma.FIFO_Pos+dma.FIFO_NbBytes+1 ) & DMASND_FIFO_SIZE_MASK ] = (Sint8)STRam[ dma.frameCounterAddr+1 ];	/* add lower byte of the word */
 
 		dma.FIFO_NbBytes += 2;				/* One word more in the FIFO */
+		Timeline_AddDmaSnd(2);
 
 		/* Increase current frame address and check if we reached frame's end */
 		dma.frameCounterAddr += 2;
@@ -475,139 +477,156 @@ static inline int DmaSnd_EndOfFrameReached(void)
  */
 
 
-void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
+#define DMASND_MIX_LEVEL	(-((256*3/4)/4)/4)
+
+/* DMA samples of the current update, before mixing with the YM2149 */
+static Sint16 DmaSnd_Buffer[ MIXBUFFER_SIZE ][ 2 ];
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Resample 'nSamples' mono 8-bit DMA samples from the FIFO to
+ * nAudioFrequency into DmaSnd_Buffer.
+ */
+static void DmaSnd_ResampleMono(int nSamples, Sint64 FreqRatio)
 {
 	int i;
-	int nBufIdx;
-	Sint8 MonoByte , LeftByte , RightByte;
 	unsigned n;
-	Sint64 FreqRatio;
-
+	Sint8 MonoByte;
 
-	/* DMA Audio OFF and FIFO empty : process YM2149's output */
-	if ( !(nDmaSoundControl & DMASNDCTRL_PLAY) && ( dma.FIFO_NbBytes == 0 ) )
+	for (i = 0; i < nSamples; i++)
 	{
-		for (i = 0; i < nSamplesToGenerate; i++)
+		if ( DmaInitSample )
 		{
-			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
-
-			switch (microwire.mixing) {
-				case 1:
-					/* DMA and YM2149 mixing */
-					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][1] + dma.FrameRight * -((256*3/4)/4)/4;
-					break;
-				default:
-					/* mixing=0 DMA only */
-					/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
-					/* mixing=3 DMA and input 3 -> DMA */
-					MixBuffer[nBufIdx][0] = dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = dma.FrameRight * -((256*3/4)/4)/4;
-					break;
-			}
+			MonoByte = DmaSnd_FIFO_PullByte ();
+			dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
+			dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
+			DmaInitSample = false;
 		}
 
-		/* Apply LMC1992 sound modifications (Bass and Treble) */
-		DmaSnd_Apply_LMC ( nMixBufIdx , nSamplesToGenerate );
+		DmaSnd_Buffer[i][0] = dma.FrameLeft;
+		DmaSnd_Buffer[i][1] = dma.FrameLeft;			/* right = left */
 
-		return;
+		/* Increase freq counter */
+		frameCounter_float += FreqRatio;
+		n = frameCounter_float >> 32;				/* number of samples to skip */
+		while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
+		{
+			MonoByte = DmaSnd_FIFO_PullByte ();
+			dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
+			dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
+			n--;
+		}
+		frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
 	}
+}
 
 
-	/* DMA Audio ON or FIFO not empty yet */
-
-	/* Compute ratio between DMA's sound frequency and host computer's sound frequency, */
-	/* use << 32 to simulate floating point precision */
-	FreqRatio = ( ((Sint64)DmaSnd_DetectSampleRate()) << 32 ) / nAudioFrequency;
+/**
+ * Resample 'nSamples' stereo 8-bit DMA samples from the FIFO to
+ * nAudioFrequency into DmaSnd_Buffer.
+ */
+static void DmaSnd_ResampleStereo(int nSamples, Sint64 FreqRatio)
+{
+	int i;
+	unsigned n;
+	Sint8 LeftByte , RightByte;
 
-	if (dma.soundMode & DMASNDMODE_MONO)
+	for (i = 0; i < nSamples; i++)
 	{
-		/* Mono 8-bit */
-		for (i = 0; i < nSamplesToGenerate; i++)
+		if ( DmaInitSample )
 		{
-			if ( DmaInitSample )
-			{
-				MonoByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
-				DmaInitSample = false;
-			}
+			LeftByte = DmaSnd_FIFO_PullByte ();
+			RightByte = DmaSnd_FIFO_PullByte ();
+			dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
+			dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
+			DmaInitSample = false;
+		}
 
-			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
-
-			switch (microwire.mixing) {
-				case 1:
-					/* DMA and YM2149 mixing */
-					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + dma.FrameLeft * -((256*3/4)/4)/4;
-					break;
-				default:
-					/* mixing=0 DMA only */
-					/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
-					/* mixing=3 DMA and input 3 -> DMA */
-					MixBuffer[nBufIdx][0] = dma.FrameLeft * -((256*3/4)/4)/4;
-					break;
-			}
+		DmaSnd_Buffer[i][0] = dma.FrameLeft;
+		DmaSnd_Buffer[i][1] = dma.FrameRight;
+
+		/* Increase freq counter */
+		frameCounter_float += FreqRatio;
+		n = frameCounter_float >> 32;				/* number of samples to skip */
+		while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
+		{
+			LeftByte = DmaSnd_FIFO_PullByte ();
+			RightByte = DmaSnd_FIFO_PullByte ();
+			dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
+			dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
+			n--;
+		}
+		frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
+	}
+}
 
-			MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][0];		/* right = left */
 
-			/* Increase freq counter */
-			frameCounter_float += FreqRatio;
-			n = frameCounter_float >> 32;				/* number of samples to skip */
-			while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
-			{
-				MonoByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
-				n--;
-			}
-			frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
+/**
+ * Mix 'nSamples' DMA samples with the YM2149 samples in pMix.
+ * The mixing mode is checked once for the whole block, so the compiler
+ * can vectorize these loops.
+ */
+static void DmaSnd_Mix(Sint16 (*pMix)[2], Sint16 (*pDma)[2], int nSamples)
+{
+	int i;
+
+	if (microwire.mixing == 1)
+	{
+		/* DMA and YM2149 mixing */
+		for (i = 0; i < nSamples; i++)
+		{
+			pMix[i][0] = pMix[i][0] + pDma[i][0] * DMASND_MIX_LEVEL;
+			pMix[i][1] = pMix[i][1] + pDma[i][1] * DMASND_MIX_LEVEL;
 		}
 	}
 	else
 	{
-		/* Stereo 8-bit */
-		for (i = 0; i < nSamplesToGenerate; i++)
+		/* mixing=0 DMA only */
+		/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
+		/* mixing=3 DMA and input 3 -> DMA */
+		for (i = 0; i < nSamples; i++)
 		{
-			if ( DmaInitSample )
-			{
-				LeftByte = DmaSnd_FIFO_PullByte ();
-				RightByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
-				DmaInitSample = false;
-			}
+			pMix[i][0] = pDma[i][0] * DMASND_MIX_LEVEL;
+			pMix[i][1] = pDma[i][1] * DMASND_MIX_LEVEL;
+		}
+	}
+}
 
-			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
-
-			switch (microwire.mixing) {
-				case 1:
-					/* DMA and YM2149 mixing */
-					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][1] + dma.FrameRight * -((256*3/4)/4)/4;
-					break;
-				default:
-					/* mixing=0 DMA only */
-					/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
-					/* mixing=3 DMA and input 3 -> DMA */
-					MixBuffer[nBufIdx][0] = dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = dma.FrameRight * -((256*3/4)/4)/4;
-					break;
-			}
 
-			/* Increase freq counter */
-			frameCounter_float += FreqRatio;
-			n = frameCounter_float >> 32;				/* number of samples to skip */
-			while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
-			{
-				LeftByte = DmaSnd_FIFO_PullByte ();
-				RightByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
-				n--;
-			}
-			frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
+void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
+{
+	int i, n1;
+
+	if ( !(nDmaSoundControl & DMASNDCTRL_PLAY) && ( dma.FIFO_NbBytes == 0 ) )
+	{
+		/* DMA Audio OFF and FIFO empty : keep latest DMA values */
+		for (i = 0; i < nSamplesToGenerate; i++)
+		{
+			DmaSnd_Buffer[i][0] = dma.FrameLeft;
+			DmaSnd_Buffer[i][1] = dma.FrameRight;
 		}
 	}
+	else
+	{
+		/* DMA Audio ON or FIFO not empty yet */
+
+		/* Compute ratio between DMA's sound frequency and host computer's sound frequency, */
+		/* use << 32 to simulate floating point precision */
+		Sint64 FreqRatio = ( ((Sint64)DmaSnd_DetectSampleRate()) << 32 ) / nAudioFrequency;
+
+		if (dma.soundMode & DMASNDMODE_MONO)
+			DmaSnd_ResampleMono(nSamplesToGenerate, FreqRatio);	/* Mono 8-bit */
+		else
+			DmaSnd_ResampleStereo(nSamplesToGenerate, FreqRatio);	/* Stereo 8-bit */
+	}
+
+	/* Mix with the YM2149's output, in 2 parts if MixBuffer wraps */
+	n1 = MIXBUFFER_SIZE - nMixBufIdx;
+	if (n1 > nSamplesToGenerate)
+		n1 = nSamplesToGenerate;
+	DmaSnd_Mix(&MixBuffer[nMixBufIdx], &DmaSnd_Buffer[0], n1);
+	DmaSnd_Mix(&MixBuffer[0], &DmaSnd_Buffer[n1], nSamplesToGenerate - n1);
 
 	/* Apply LMC1992 sound modifications (Bass and Treble) */
 	DmaSnd_Apply_LMC ( nMixBufIdx , nSamplesToGenerate );
@@ -622,27 +641,29 @@ void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
  */
 static void DmaSnd_Apply_LMC(int nMixBufIdx, int nSamplesToGenerate)
 {
-	int nBufIdx;
+	Sint16 (*pMix)[2] = &MixBuffer[nMixBufIdx];
+	int n = MIXBUFFER_SIZE - nMixBufIdx;
 	int i;
 	Sint32 sample;
 
 	/* Apply LMC1992 sound modifications (Left, Right and Master Volume) */
-	for (i = 0; i < nSamplesToGenerate; i++) {
-		nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
+	for (i = 0; i < nSamplesToGenerate; i++, pMix++) {
+		if (i == n)
+			pMix = &MixBuffer[0];			/* MixBuffer wraps */
 
-		sample = DmaSnd_IIRfilterL( Subsonic_IIR_HPF_Left( MixBuffer[nBufIdx][0]));
+		sample = DmaSnd_IIRfilterL( Subsonic_IIR_HPF_Left( pMix[0][0]));
 		if (sample<-32767)						/* check for overflow to clip waveform */
 			sample = -32767;
 		else if (sample>32767)
 			sample = 32767;
-		MixBuffer[nBufIdx][0] = sample;
+		pMix[0][0] = sample;
 
-		sample = DmaSnd_IIRfilterR( Subsonic_IIR_HPF_Right(MixBuffer[nBufIdx][1]));
+		sample = DmaSnd_IIRfilterR( Subsonic_IIR_HPF_Right(pMix[0][1]));
 		if (sample<-32767)						/* check for overflow to clip waveform */
 			sample = -32767;
 		else if (sample>32767)
 			sample = 32767;
-		MixBuffer[nBufIdx][1] = sample;
+		pMix[0][1] = sample;
  	}
 }
 
@@ -676,6 +697,21 @@ void DmaSnd_STE_HBL_Update(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if DmaSnd_STE_HBL_Update() has nothing to do on the coming
+ * HBLs (no STE, or DMA sound is OFF and the FIFO is empty).
+ */
+bool DmaSnd_STE_HBL_Idle(void)
+{
+	if ( ( ConfigureParams.System.nMachineType != MACHINE_STE )
+	  && ( ConfigureParams.System.nMachineType != MACHINE_MEGA_STE ) )
+		return true;
+
+	return ( ( nDmaSoundControl & DMASNDCTRL_PLAY ) == 0 ) && ( dma.FIFO_NbBytes == 0 );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return current frame counter address (value is always even)
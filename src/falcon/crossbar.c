@@ -108,6 +108,7 @@ const char crossbar_fileid[] = "Hatari Crossbar.c : " __DATE__ " " __TIME__;
 
 #define DACBUFFER_SIZE    2048
 #define DECIMAL_PRECISION 65536
+#define BATCH_CYCLES      512		/* max. cycles per batched clock interrupt (~1 scanline) */
 
 
 /* Crossbar internal functions */
@@ -243,15 +244,18 @@ struct crossbar_s {
 	Uint16 attenuationSettingLeft;	/* Left channel attenuation for DAC */
 	Uint16 attenuationSettingRight;	/* Right channel attenuation for DAC */
 	Uint16 microphone_ADC_is_started;
+	Sint64 microphone_pos;		/* position between 2 ADC samples for microphone frames, 32.32 */
 	
 	Uint32 clock25_cycles;		/* cycles for 25 Mzh interrupt */
 	Uint32 clock25_cycles_decimal;  /* decimal part of cycles counter for 25 Mzh interrupt (*DECIMAL_PRECISION) */
 	Uint32 clock25_cycles_counter;  /* Cycle counter for 25 Mhz interrupts */
 	Uint32 pendingCyclesOver25;	/* Number of delayed cycles for the interrupt */
+	Uint32 clock25_batch;		/* Number of 25 Mhz clock periods handled by next interrupt */
 	Uint32 clock32_cycles;		/* cycles for 32 Mzh interrupt */
 	Uint32 clock32_cycles_decimal;  /* decimal part of cycles counter for 32 Mzh interrupt (*DECIMAL_PRECISION) */
 	Uint32 clock32_cycles_counter;  /* Cycle counter for 32 Mhz interrupts */
 	Uint32 pendingCyclesOver32;	/* Number of delayed cycles for the interrupt */
+	Uint32 clock32_batch;		/* Number of 32 Mhz clock periods handled by next interrupt */
 	Sint64 frequence_ratio;		/* Ratio between host computer's sound frequency and hatari's sound frequency */
 	Sint64 frequence_ratio2;	/* Ratio between hatari's sound frequency and host computer's sound frequency */
 	
@@ -1182,20 +1186,43 @@ static int Crossbar_DetectSampleRate(Uint16 clock)
 	return Falcon_SampleRates_32Mhz[crossbar.int_freq_divider - 1];
 }
 
+/**
+ * Check if several clock periods can be processed in one interrupt :
+ * only when enabled and when the DSP isn't connected to the matrix, as
+ * its SSI has to see each frame at the right time.
+ */
+static bool Crossbar_CanBatch(void)
+{
+	if (!ConfigureParams.Sound.bCrossbarBatch)
+		return false;
+
+	if (!dspXmit.isTristated && (dmaRecord.isConnectedToDspInHandShakeMode ||
+	    dspXmit.isConnectedToCodec || dspXmit.isConnectedToDma || dspXmit.isConnectedToDsp))
+		return false;
+
+	return !dmaPlay.isConnectedToDsp && !adc.isConnectedToDsp;
+}
+
 /**
  * Start internal 25 Mhz clock interrupt.
+ * In batch mode, it is set for as many clock periods as fit in BATCH_CYCLES.
  */
 static void Crossbar_Start_InterruptHandler_25Mhz(void)
 {
-	Uint32 cycles_25;
-	
-	cycles_25 = crossbar.clock25_cycles;
-	crossbar.clock25_cycles_counter += crossbar.clock25_cycles_decimal;
-	
-	if (crossbar.clock25_cycles_counter >= DECIMAL_PRECISION) {
-		crossbar.clock25_cycles_counter -= DECIMAL_PRECISION;
-		cycles_25 ++;
-	}
+	Uint32 cycles_25 = 0;
+	Uint32 batch_max = Crossbar_CanBatch() ? BATCH_CYCLES : 0;
+
+	crossbar.clock25_batch = 0;
+	do {
+		cycles_25 += crossbar.clock25_cycles;
+		crossbar.clock25_cycles_counter += crossbar.clock25_cycles_decimal;
+
+		if (crossbar.clock25_cycles_counter >= DECIMAL_PRECISION) {
+			crossbar.clock25_cycles_counter -= DECIMAL_PRECISION;
+			cycles_25 ++;
+		}
+		crossbar.clock25_batch++;
+	} while (cycles_25 + crossbar.clock25_cycles < batch_max);
 
 	if (crossbar.pendingCyclesOver25 >= cycles_25) {
 		crossbar.pendingCyclesOver25 -= cycles_25;
@@ -1211,18 +1238,24 @@ static void Crossbar_Start_InterruptHandler_25Mhz(void)
 
 /**
  * Start internal 32 Mhz clock interrupt.
+ * In batch mode, it is set for as many clock periods as fit in BATCH_CYCLES.
  */
 static void Crossbar_Start_InterruptHandler_32Mhz(void)
 {
-	Uint32 cycles_32;
-	
-	cycles_32 = crossbar.clock32_cycles;
-	crossbar.clock32_cycles_counter += crossbar.clock32_cycles_decimal;
+	Uint32 cycles_32 = 0;
+	Uint32 batch_max = Crossbar_CanBatch() ? BATCH_CYCLES : 0;
 
-	if (crossbar.clock32_cycles_counter >= DECIMAL_PRECISION) {
-		crossbar.clock32_cycles_counter -= DECIMAL_PRECISION;
-		cycles_32 ++;
-	}
+	crossbar.clock32_batch = 0;
+	do {
+		cycles_32 += crossbar.clock32_cycles;
+		crossbar.clock32_cycles_counter += crossbar.clock32_cycles_decimal;
+
+		if (crossbar.clock32_cycles_counter >= DECIMAL_PRECISION) {
+			crossbar.clock32_cycles_counter -= DECIMAL_PRECISION;
+			cycles_32 ++;
+		}
+		crossbar.clock32_batch++;
+	} while (cycles_32 + crossbar.clock32_cycles < batch_max);
 
 	if (crossbar.pendingCyclesOver32 >= cycles_32){
 		crossbar.pendingCyclesOver32 -= cycles_32;
@@ -1238,24 +1271,15 @@ static void Crossbar_Start_InterruptHandler_32Mhz(void)
 
 
 /**
- * Execute transfers for internal 25 Mhz clock.
+ * Execute transfers for one period of the internal 25 Mhz clock.
  */
-void Crossbar_InterruptHandler_25Mhz(void)
+static void Crossbar_Process_25Mhz(void)
 {
-	/* How many cycle was this sound interrupt delayed (>= 0) */
-	crossbar.pendingCyclesOver25 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
-
-	/* Remove this interrupt from list and re-order */
-	CycInt_AcknowledgeInterrupt();
-
 	/* If transfer mode is in Ste mode, use only this clock for all the transfers */
 	if (crossbar.isInSteFreqMode) {
 		Crossbar_Process_DSPXmit_Transfer();
 		Crossbar_Process_DMAPlay_Transfer();
 		Crossbar_Process_ADCXmit_Transfer();
-		
-		/* Restart the 25 Mhz clock interrupt */
-		Crossbar_Start_InterruptHandler_25Mhz();
 		return;
 	}
 
@@ -1270,28 +1294,36 @@ void Crossbar_InterruptHandler_25Mhz(void)
 	if (crossbar.dmaPlay_freq == CROSSBAR_FREQ_25MHZ) {
 		Crossbar_Process_DMAPlay_Transfer();
 	}
-
-	/* Restart the 25 Mhz clock interrupt */
-	Crossbar_Start_InterruptHandler_25Mhz();
 }
 
 /**
- * Execute transfers for internal 32 Mhz clock.
+ * Execute transfers for internal 25 Mhz clock.
  */
-void Crossbar_InterruptHandler_32Mhz(void)
+void Crossbar_InterruptHandler_25Mhz(void)
 {
+	Uint32 i;
+
 	/* How many cycle was this sound interrupt delayed (>= 0) */
-	crossbar.pendingCyclesOver32 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
+	crossbar.pendingCyclesOver25 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
 
 	/* Remove this interrupt from list and re-order */
 	CycInt_AcknowledgeInterrupt();
 
+	for (i = 0; i < crossbar.clock25_batch; i++)
+		Crossbar_Process_25Mhz();
+
+	/* Restart the 25 Mhz clock interrupt */
+	Crossbar_Start_InterruptHandler_25Mhz();
+}
+
+/**
+ * Execute transfers for one period of the internal 32 Mhz clock.
+ */
+static void Crossbar_Process_32Mhz(void)
+{
 	/* If transfer mode is in Ste mode, don't use this clock for all the transfers */
-	if (crossbar.isInSteFreqMode) {
-		/* Restart the 32 Mhz clock interrupt */
-		Crossbar_Start_InterruptHandler_32Mhz();
+	if (crossbar.isInSteFreqMode)
 		return;
-	}
 	
 	/* DSP Play transfer ? */
 	if (crossbar.dspXmit_freq == CROSSBAR_FREQ_32MHZ) {
@@ -1302,6 +1334,23 @@ void Crossbar_InterruptHandler_32Mhz(void)
 	if (crossbar.dmaPlay_freq == CROSSBAR_FREQ_32MHZ) {
 		Crossbar_Process_DMAPlay_Transfer();
 	}
+}
+
+/**
+ * Execute transfers for internal 32 Mhz clock.
+ */
+void Crossbar_InterruptHandler_32Mhz(void)
+{
+	Uint32 i;
+
+	/* How many cycle was this sound interrupt delayed (>= 0) */
+	crossbar.pendingCyclesOver32 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
+
+	/* Remove this interrupt from list and re-order */
+	CycInt_AcknowledgeInterrupt();
+
+	for (i = 0; i < crossbar.clock32_batch; i++)
+		Crossbar_Process_32Mhz();
 
 	/* Restart the 32 Mhz clock interrupt */
 	Crossbar_Start_InterruptHandler_32Mhz();
@@ -1591,6 +1640,7 @@ void Crossbar_SendDataToDmaRecord(Sint16 value)
 	}
 	
 	pFrameStart = (Sint8 *)&STRam[dmaRecord.frameStartAddr];
+	STMemory_SetDirtyArea(dmaRecord.frameStartAddr + dmaRecord.frameCounter, 2);
 
 	/* 16 bits stereo mode ? */
 	if (crossbar.is16Bits) {
@@ -1684,29 +1734,26 @@ void Crossbar_DmaRecordInHandShakeMode_Frame(Uint32 frame)
 /*----------------------------------------------------------------------*/
 
 /**
- * Get datas recorded by the microphone and convert them into falcon internal frequency
- *    - micro_bufferL : left track recorded by the microphone
- *    - micro_bufferR : right track recorded by the microphone
- *    - microBuffer_size : buffers size
+ * Get the frames recorded by the microphone since the last call and convert
+ * them into falcon internal frequency, straight into the ADC buffer.
+ * The position between two ADC samples is kept from one call to the next,
+ * so the conversion doesn't glitch at the microphone buffer boundaries.
  */
-void Crossbar_GetMicrophoneDatas(Sint16 *micro_bufferL, Sint16 *micro_bufferR, Uint32 microBuffer_size)
+static void Crossbar_ReadMicrophone(void)
 {
-	Uint32 i, size, bufferIndex;
-	Sint64 idxPos;
-
-	size = (microBuffer_size * crossbar.frequence_ratio>>32);
-	bufferIndex = 0;
-	idxPos = 0;
-
-	for (i = 0; i < size; i++) {
-		adc.writePosition = (adc.writePosition + 1) % DACBUFFER_SIZE;
-
-		adc.buffer_left[adc.writePosition] = micro_bufferL[bufferIndex];
-		adc.buffer_right[adc.writePosition] = micro_bufferR[bufferIndex]; 
-
-		idxPos += crossbar.frequence_ratio2;
-		bufferIndex += idxPos>>32;	
-		idxPos  &= 0xffffffff;			/* only keep the fractional part */
+	Sint16 frames[256][2];
+	int i, n;
+
+	while ((n = Microphone_Read(frames, 256)) > 0) {
+		for (i = 0; i < n; i++) {
+			crossbar.microphone_pos += crossbar.frequence_ratio;
+			while (crossbar.microphone_pos >= ((Sint64)1 << 32)) {
+				crossbar.microphone_pos -= (Sint64)1 << 32;
+				adc.writePosition = (adc.writePosition + 1) % DACBUFFER_SIZE;
+				adc.buffer_left[adc.writePosition] = frames[i][0];
+				adc.buffer_right[adc.writePosition] = frames[i][1];
+			}
+		}
 	}
 }
 
@@ -1783,6 +1830,10 @@ void Crossbar_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 	int i, j, nBufIdx;
 	int n;
 	Sint16 adc_leftData, adc_rightData, dac_LeftData, dac_RightData;
+
+	/* Get the new microphone frames */
+	if (crossbar.microphone_ADC_is_started)
+		Crossbar_ReadMicrophone();
 	
 	if (crossbar.isDacMuted) {
 		/* Output sound = 0 */
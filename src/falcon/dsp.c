@@ -32,6 +32,7 @@
 #include "configuration.h"
 #include "cycInt.h"
 #include "m68000.h"
+#include "perfcount.h"
 
 #if ENABLE_DSP_EMU
 #include "debugdsp.h"
@@ -59,13 +60,15 @@ static const char* x_ext_memory_addr_name[] = {
 	"", "", "", "", "", "", "BCR", "IPR"
 };
 
-static Sint32 save_cycles;
+Sint32 nDspPendingCycles;		/* DSP cycles owed to the DSP by the CPU */
+Sint32 nDspSliceCycles;			/* pending cycles before DSP_Run executes */
 #endif
 
 static bool bDspDebugging;
 
 bool bDspEnabled = false;
 bool bDspHostInterruptPending = false;
+bool bDspLockstep = false;		/* verify fast DSP execution paths */
 
 
 /**
@@ -101,6 +104,17 @@ bool	DSP_ProcessIRQ(void)
 #endif
 
 
+#if ENABLE_DSP_EMU
+/**
+ * Update how many cycles DSP_Run() may accumulate before running the DSP
+ */
+static void DSP_UpdateSlice(void)
+{
+	nDspSliceCycles = bDspDebugging ? 0 : ConfigureParams.System.nDSPSkew;
+}
+#endif
+
+
 /**
  * Initialize the DSP emulation
  */
@@ -112,7 +126,8 @@ void DSP_Init(void)
 	dsp_core_init(DSP_TriggerHostInterrupt);
 	dsp56k_init_cpu();
 	bDspEnabled = true;
-	save_cycles = 0;
+	nDspPendingCycles = 0;
+	DSP_UpdateSlice();
 #endif
 }
 
@@ -139,7 +154,8 @@ void DSP_Reset(void)
 #if ENABLE_DSP_EMU
 	dsp_core_reset();
 	bDspHostInterruptPending = false;
-	save_cycles = 0;
+	nDspPendingCycles = 0;
+	DSP_UpdateSlice();
 #endif
 }
 
@@ -155,42 +171,52 @@ void DSP_MemorySnapShot_Capture(bool bSave)
 
 	MemorySnapShot_Store(&bDspEnabled, sizeof(bDspEnabled));
 	MemorySnapShot_Store(&dsp_core, sizeof(dsp_core));
-	MemorySnapShot_Store(&save_cycles, sizeof(save_cycles));
+	MemorySnapShot_Store(&nDspPendingCycles, sizeof(nDspPendingCycles));
+	if (!bSave)
+		dsp56k_decode_cache_flush();
 #endif
 }
 
+#if ENABLE_DSP_EMU
 /**
- * Run DSP for certain cycles
+ * Execute the DSP instructions owed to it by the host CPU.
+ * This is called from DSP_Run() once a slice is complete, and as
+ * a synchronization point before the CPU side touches the DSP state
+ * (host port, SSI), so that a DSP lagging behind within the configured
+ * skew budget catches up first.
  */
-void DSP_Run(int nHostCycles)
+void DSP_RunPending(void)
 {
-#if ENABLE_DSP_EMU
-        save_cycles += nHostCycles * 2;
+	static bool bInRun;
 
-        if (dsp_core.running == 0)
-                return;
+	if (dsp_core.running == 0 || nDspPendingCycles <= 0 || bInRun)
+		return;
 
-        if (save_cycles <= 0)
-                return;
+	/* SSI transmits from the DSP may call back into the crossbar */
+	bInRun = true;
 
+        PERFCOUNT_BEGIN(PERFCOUNT_DSP, nPerfPrev);
         if (unlikely(bDspDebugging)) {
-                while (save_cycles > 0)
+                while (nDspPendingCycles > 0)
                 {
                         dsp56k_execute_instruction();
-                        save_cycles -= dsp_core.instr_cycle;
+                        nDspPendingCycles -= dsp_core.instr_cycle;
                         DebugDsp_Check();
                 }
         } else {
-		//	fprintf(stderr, "--> %d\n", save_cycles);
-                while (save_cycles > 0)
-                {
-                        dsp56k_execute_instruction();
-                        save_cycles -= dsp_core.instr_cycle;
-                }
+                if (unlikely(bDspLockstep))
+                        nDspPendingCycles = dsp56k_execute_slice_checked(nDspPendingCycles);
+                else
+                        nDspPendingCycles = dsp56k_execute_slice(nDspPendingCycles);
         }
+        PERFCOUNT_END(nPerfPrev);
+
+	bInRun = false;
 
+	/* pick up skew changes done at run-time */
+	DSP_UpdateSlice();
+}
 #endif
-} 
 
 /**
  * Enable/disable DSP debugging mode
@@ -198,6 +224,9 @@ void DSP_Run(int nHostCycles)
 void DSP_SetDebugging(bool enabled)
 {
 	bDspDebugging = enabled;
+#if ENABLE_DSP_EMU
+	DSP_UpdateSlice();
+#endif
 }
 
 /**
@@ -673,6 +702,7 @@ bool DSP_Disasm_SetRegister(const char *arg, Uint32 value)
 Uint32 DSP_SsiReadTxValue(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	return dsp_core.ssi.transmit_value;
 #else
 	return 0;
@@ -685,6 +715,7 @@ Uint32 DSP_SsiReadTxValue(void)
 void DSP_SsiWriteRxValue(Uint32 value)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	dsp_core.ssi.received_value = value & 0xffffff;
 #endif
 }
@@ -696,6 +727,7 @@ void DSP_SsiWriteRxValue(Uint32 value)
 void DSP_SsiReceive_SC0(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	dsp_core_ssi_Receive_SC0();
 #endif
 }
@@ -709,6 +741,7 @@ void DSP_SsiTransmit_SC0(void)
 void DSP_SsiReceive_SC1(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	dsp_core_ssi_Receive_SC1(FrameCounter);
 #endif
 }
@@ -723,6 +756,7 @@ void DSP_SsiTransmit_SC1(void)
 void DSP_SsiReceive_SC2(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	dsp_core_ssi_Receive_SC2(FrameCounter);
 #endif
 }
@@ -737,6 +771,7 @@ void DSP_SsiTransmit_SC2(Uint32 frame)
 void DSP_SsiReceive_SCK(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_RunPending();
 	dsp_core_ssi_Receive_SCK();
 #endif
 }
@@ -757,7 +792,10 @@ void DSP_HandleReadAccess(void)
 	Uint32 addr;
 	Uint8 value;
 	bool multi_access = false; 
-	
+
+#if ENABLE_DSP_EMU
+	DSP_RunPending();
+#endif
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -785,6 +823,9 @@ void DSP_HandleWriteAccess(void)
 	Uint32 addr;
 	bool multi_access = false; 
 
+#if ENABLE_DSP_EMU
+	DSP_RunPending();
+#endif
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -31,13 +31,35 @@
 
 extern bool bDspEnabled;
 extern bool bDspHostInterruptPending;
+extern bool bDspLockstep;
 
 /* Dsp commands */
 extern bool DSP_ProcessIRQ(void);
 extern void DSP_Init(void);
 extern void DSP_UnInit(void);
 extern void DSP_Reset(void);
-extern void DSP_Run(int nHostCycles);
+
+#if ENABLE_DSP_EMU
+extern Sint32 nDspPendingCycles;
+extern Sint32 nDspSliceCycles;
+extern void DSP_RunPending(void);
+
+/**
+ * Run DSP for certain cycles.
+ * This is called after every CPU instruction, so only the cycles are
+ * accumulated here. The DSP itself is run once they exceed the slice
+ * set with the DSP skew option (each instruction when it's 0), or
+ * earlier when the CPU accesses the DSP host port or the SSI.
+ */
+static inline void DSP_Run(int nHostCycles)
+{
+	nDspPendingCycles += nHostCycles * 2;
+	if (nDspPendingCycles > nDspSliceCycles)
+		DSP_RunPending();
+}
+#else
+static inline void DSP_Run(int nHostCycles) { }
+#endif
 
 /* Save Dsp state to snapshot */
 extern void DSP_MemorySnapShot_Capture(bool bSave);
@@ -146,6 +146,7 @@ void dsp_core_reset(void)
 	dsp_core.dsp_host_htx = 0;
 
 	dsp_core.bootstrap_pos = 0;
+	dsp56k_decode_cache_flush();
 	
 	/* Registers */
 	dsp_core.pc = 0x0000;
@@ -660,6 +661,7 @@ void dsp_core_write_host(int addr, Uint8 value)
 				LOG_TRACE(TRACE_DSP_STATE, "Dsp: bootstrap p:0x%04x = 0x%06x\n",
 								dsp_core.bootstrap_pos,
 								dsp_core.ramint[DSP_SPACE_P][dsp_core.bootstrap_pos]);
+				dsp56k_decode_cache_invalidate(dsp_core.bootstrap_pos);
 
 				if (++dsp_core.bootstrap_pos == 0x200) {
 					LOG_TRACE(TRACE_DSP_STATE, "Dsp: wait bootstrap done\n");
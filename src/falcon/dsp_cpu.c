@@ -116,6 +116,18 @@ static Uint32 cur_inst;
 /* Counts the number of access to the external memory for one instruction */
 static Uint16 access_to_ext_memory;
 
+/* Decoded instructions of the internal and external P memory, so that
+ * the instruction word and its handler don't need to be looked up again
+ * each time it's executed. Entries are cleared when the memory changes.
+ */
+typedef struct {
+	void (*func)(void);	/* handler, NULL if not decoded */
+	Uint32 inst;
+} dsp_decoded_t;
+
+static dsp_decoded_t decoded_int[0x200];
+static dsp_decoded_t decoded_ext[DSP_RAMSIZE];
+
 /* DSP is in disasm mode ? */
 /* If yes, stack overflow, underflow and illegal instructions messages are not displayed */
 static bool isDsp_in_disasm_mode;
@@ -742,6 +754,7 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 
 	/* Restore DSP context after executing instruction */
 	memcpy(ptr1, ptr2, sizeof(dsp_core));
+	dsp56k_decode_cache_flush();
 	
 	/* Unset DSP in disasm mode */
 	isDsp_in_disasm_mode = false;
@@ -749,17 +762,95 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 	return instruction_length;
 }
 
-void dsp56k_execute_instruction(void)
+/**
+ * Forget all decoded instructions, after the P memory was changed
+ * (or restored) as a whole.
+ */
+void dsp56k_decode_cache_flush(void)
+{
+	memset(decoded_int, 0, sizeof(decoded_int));
+	memset(decoded_ext, 0, sizeof(decoded_ext));
+}
+
+/**
+ * Forget the decoded instruction at given P memory address. External
+ * addresses are for the whole external RAM, where X and Y are mapped too.
+ */
+void dsp56k_decode_cache_invalidate(Uint16 address)
+{
+	if (address < 0x200)
+		decoded_int[address].func = NULL;
+	else
+		decoded_ext[address & (DSP_RAMSIZE-1)].func = NULL;
+}
+
+/**
+ * Return handler for given instruction word
+ */
+static inline void (*dsp_opcode_handler(Uint32 inst))(void)
 {
 	Uint32 value;
+
+	if (inst < 0x100000) {
+		value = (inst >> 11) & (BITMASK(6) << 3);
+		value += (inst >> 5) & BITMASK(3);
+		return opcodes8h[value];
+	}
+	/* Do parallel move read */
+	return opcodes_parmove[(inst>>20) & BITMASK(4)];
+}
+
+/**
+ * Return decoded instruction for given P memory address
+ */
+static inline dsp_decoded_t *dsp_decode_instruction(Uint16 address)
+{
+	dsp_decoded_t *decoded;
+	Uint32 inst;
+
+	if (address < 0x200) {
+		decoded = &decoded_int[address];
+	} else {
+		decoded = &decoded_ext[address & (DSP_RAMSIZE-1)];
+		/* fetch is still an external memory access */
+		access_to_ext_memory |= 1 << EXT_P_MEMORY;
+	}
+	if (decoded->func)
+		return decoded;
+
+	inst = read_memory_p(address);
+	decoded->inst = inst;
+	decoded->func = dsp_opcode_handler(inst);
+	return decoded;
+}
+
+/**
+ * Extra cycles due to external memory access (2 extra cycles per extra
+ * access to the external memory after the first one)
+ */
+static inline Uint32 dsp_ext_memory_waitstates(void)
+{
+	Uint32 value;
+
+	value = access_to_ext_memory & 1;
+	value += (access_to_ext_memory & 2) >> 1;
+	value += (access_to_ext_memory & 4) >> 2;
+
+	return value > 1 ? (value - 1) * 2 : 0;
+}
+
+void dsp56k_execute_instruction(void)
+{
 	Uint32 disasm_return = 0;
+	dsp_decoded_t *decoded;
 	disasm_memory_ptr = 0;
 
 	/* Initialise the number of access to the external memory for this instruction */
 	access_to_ext_memory = 0;
 	
-	/* Decode and execute current instruction */
-	cur_inst = read_memory_p(dsp_core.pc);
+	/* Decode current instruction */
+	decoded = dsp_decode_instruction(dsp_core.pc);
+	cur_inst = decoded->inst;
 	
 	/* Initialize instruction size and cycle counter */
 	cur_inst_len = 1;
@@ -778,25 +869,12 @@ void dsp56k_execute_instruction(void)
 		}
 	}
 			
-	if (cur_inst < 0x100000) {
-		value = (cur_inst >> 11) & (BITMASK(6) << 3);
-		value += (cur_inst >> 5) & BITMASK(3);
-		opcodes8h[value]();
-	} else {
-		/* Do parallel move read */
-		opcodes_parmove[(cur_inst>>20) & BITMASK(4)]();
-	}
+	/* Execute it */
+	decoded->func();
 
 	/* Add the waitstate due to external memory access */
-	/* (2 extra cycles per extra access to the external memory after the first one */
-	if (access_to_ext_memory != 0) {
-		value = access_to_ext_memory & 1;
-		value += (access_to_ext_memory & 2) >> 1;
-		value += (access_to_ext_memory & 4) >> 2;
-		
-		if (value > 1)
-			dsp_core.instr_cycle += (value - 1) * 2;
-	}
+	if (access_to_ext_memory != 0)
+		dsp_core.instr_cycle += dsp_ext_memory_waitstates();
 
 	/* Disasm current instruction ? (trace mode only) */
 	if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM)) {
@@ -843,6 +921,158 @@ void dsp56k_execute_instruction(void)
 #endif
 }
 
+/**
+ * Check whether the instruction just executed is a "jclr/jset #n,pp,*"
+ * that polls a peripheral register without side effects, in a state
+ * where nothing but the host CPU can make it leave the loop.
+ */
+static bool dsp_is_idle_loop(dsp_decoded_t *decoded, Uint16 pc)
+{
+	Uint32 addr;
+
+	if (dsp_core.pc != pc || (decoded->func != dsp_jclr_pp && decoded->func != dsp_jset_pp))
+		return false;
+
+	/* REP, DO loop end, trace or interrupt processing could change the flow */
+	if (dsp_core.loop_rep || dsp_core.interrupt_counter != 0
+	    || dsp_core.interrupt_state != DSP_INTERRUPT_NONE
+	    || (dsp_core.registers[DSP_REG_SR] & ((1<<DSP_SR_LF)|(1<<DSP_SR_T))))
+		return false;
+
+	/* Reading the host or SSI receive register acknowledges it */
+	addr = (cur_inst>>8) & BITMASK(6);
+	if (((cur_inst>>6) & 1) == DSP_SPACE_X && (addr == DSP_HOST_HRX || addr == DSP_SSI_RX))
+		return false;
+
+	return true;
+}
+
+/**
+ * Execute instructions until the given number of DSP cycles is used up,
+ * and return the (zero or negative) cycles left.
+ * This does the same as calling dsp56k_execute_instruction() in a loop,
+ * but the trace checks are done once per slice and the PC, loop and
+ * interrupt handling is inlined into the loop.  Tight DO/REP loops thus
+ * only cost the decoded cache lookup and the instruction itself.
+ *
+ * The host CPU doesn't run during a slice, so a DSP spinning on a host
+ * port or SSI status bit can't see it change before the slice ends.
+ * Such wait loops are detected and the rest of the slice is accounted
+ * as further iterations of the loop without executing them.
+ */
+Sint32 dsp56k_execute_slice(Sint32 cycles)
+{
+	dsp_decoded_t *decoded;
+	Uint16 pc;
+
+	if (LOG_TRACE_LEVEL(TRACE_DSP_DISASM) || DSP_COUNT_IPS) {
+		while (cycles > 0) {
+			dsp56k_execute_instruction();
+			cycles -= dsp_core.instr_cycle;
+		}
+		return cycles;
+	}
+
+	while (cycles > 0) {
+		access_to_ext_memory = 0;
+
+		pc = dsp_core.pc;
+		decoded = dsp_decode_instruction(pc);
+		cur_inst = decoded->inst;
+		cur_inst_len = 1;
+		dsp_core.instr_cycle = 2;
+
+		decoded->func();
+
+		if (access_to_ext_memory != 0)
+			dsp_core.instr_cycle += dsp_ext_memory_waitstates();
+
+		dsp_postexecute_update_pc();
+		dsp_postexecute_interrupts();
+
+		cycles -= dsp_core.instr_cycle;
+
+		if (cycles > 0 && dsp_is_idle_loop(decoded, pc)) {
+			/* same as running the loop until the slice is over */
+			cycles -= (cycles + dsp_core.instr_cycle - 1)
+				/ dsp_core.instr_cycle * dsp_core.instr_cycle;
+		}
+	}
+	return cycles;
+}
+
+/**
+ * Report lock-step check divergence at given PC and enter the debugger
+ */
+static void dsp_lockstep_failed(const char *what, Uint16 pc)
+{
+	fprintf(stderr, "Dsp: lock-step check failed, %s at $%04x:\n", what, pc);
+	dsp56k_execute_one_disasm_instruction(stderr, pc);
+	DebugUI(REASON_DSP_EXCEPTION);
+}
+
+/**
+ * Same as dsp56k_execute_slice(), but for verifying it: instructions
+ * are executed with the reference dsp56k_execute_instruction(), and
+ * what the fast slice loop would use instead of that is checked
+ * against it in lock-step:
+ * - decoded instruction cache entries must match the P memory contents
+ * - wait loops which the slice loop would skip must really leave the
+ *   DSP registers unchanged until the end of the slice
+ * On divergence the debugger is entered.
+ */
+Sint32 dsp56k_execute_slice_checked(Sint32 cycles)
+{
+	Uint32 saved_regs[64], saved_periph[2][64], inst;
+	dsp_decoded_t *decoded;
+	Uint16 saved_access;
+	Uint16 pc;
+	int i;
+
+	while (cycles > 0) {
+		pc = dsp_core.pc;
+
+		/* lookup must not add external memory accesses to current instruction */
+		saved_access = access_to_ext_memory;
+		decoded = dsp_decode_instruction(pc);
+		inst = pc < 0x200 ? dsp_core.ramint[DSP_SPACE_P][pc] : dsp_core.ramext[pc & (DSP_RAMSIZE-1)];
+		access_to_ext_memory = saved_access;
+
+		if (decoded->inst != (inst & BITMASK(24)) || decoded->func != dsp_opcode_handler(inst & BITMASK(24))) {
+			dsp56k_decode_cache_invalidate(pc);
+			dsp_lockstep_failed("stale decoded instruction", pc);
+		}
+
+		dsp56k_execute_instruction();
+		cycles -= dsp_core.instr_cycle;
+
+		if (cycles <= 0 || !dsp_is_idle_loop(decoded, pc))
+			continue;
+
+		/* run the iterations the slice loop would skip */
+		memcpy(saved_regs, dsp_core.registers, sizeof(saved_regs));
+		for (i = 0; i < 64; i++) {
+			saved_periph[0][i] = dsp_core.periph[0][i];
+			saved_periph[1][i] = dsp_core.periph[1][i];
+		}
+		while (cycles > 0) {
+			dsp56k_execute_instruction();
+			cycles -= dsp_core.instr_cycle;
+			for (i = 0; i < 64; i++) {
+				if (saved_periph[0][i] != dsp_core.periph[0][i]
+				    || saved_periph[1][i] != dsp_core.periph[1][i])
+					break;
+			}
+			if (dsp_core.pc != pc || i < 64
+			    || memcmp(saved_regs, dsp_core.registers, sizeof(saved_regs))) {
+				dsp_lockstep_failed("skipped wait loop changed state", pc);
+				break;
+			}
+		}
+	}
+	return cycles;
+}
+
 /**********************************
  *	Update the PC
 **********************************/
@@ -1327,6 +1557,8 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 	/* Internal RAM ? */
 	if (address < 0x100) {
 		dsp_core.ramint[space][address] = value;
+		if (space == DSP_SPACE_P)
+			decoded_int[address].func = NULL;
 		return;
 	}
 
@@ -1341,6 +1573,7 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 		else {
 			/* Space P RAM */
 			dsp_core.ramint[DSP_SPACE_P][address] = value;
+			decoded_int[address].func = NULL;
 			return;
 		}
 	}
@@ -1368,6 +1601,7 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 
 	/* Falcon: External RAM, map X,Y to P */
 	dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+	decoded_ext[address & (DSP_RAMSIZE-1)].func = NULL;
 }
 
 static void write_memory_disasm(int space, Uint16 address, Uint32 value)
@@ -4042,6 +4276,25 @@ static void dsp_pm_8(void)
 /* source,dest[1] is 47:24 */
 /* source,dest[2] is 23:00 */
 
+/* The helpers below do the arithmetic on the host in a 64-bit integer */
+/* holding the 56 bit value, and split it again into the 3 words. */
+
+#define DSP_MASK56	((((Uint64)1)<<56)-1)
+
+static inline Uint64 dsp_pack56(const Uint32 *src)
+{
+	return ((Uint64)(src[0] & BITMASK(8))<<48)
+		| ((Uint64)(src[1] & BITMASK(24))<<24)
+		| (src[2] & BITMASK(24));
+}
+
+static inline void dsp_unpack56(Uint64 value, Uint32 *dest)
+{
+	dest[0] = (value>>48) & BITMASK(8);
+	dest[1] = (value>>24) & BITMASK(24);
+	dest[2] = value & BITMASK(24);
+}
+
 static Uint16 dsp_abs56(Uint32 *dest)
 {
 	Uint32 zerodest[3];
@@ -4066,161 +4319,91 @@ static Uint16 dsp_abs56(Uint32 *dest)
 
 static Uint16 dsp_asl56(Uint32 *dest)
 {
+	Uint64 value;
 	Uint16 overflow, carry;
 
 	/* Shift left dest 1 bit: D<<=1 */
+	value = dsp_pack56(dest);
 
-	carry = (dest[0]>>7) & 1;
-
-	dest[0] <<= 1;
-	dest[0] |= (dest[1]>>23) & 1;
-	dest[0] &= BITMASK(8);
-
-	dest[1] <<= 1;
-	dest[1] |= (dest[2]>>23) & 1;
-	dest[1] &= BITMASK(24);
-	
-	dest[2] <<= 1;
-	dest[2] &= BITMASK(24);
+	carry = (value>>55) & 1;
+	value = (value<<1) & DSP_MASK56;
+	overflow = carry ^ ((value>>55) & 1);
 
-	overflow = (carry != ((dest[0]>>7) & 1));
+	dsp_unpack56(value, dest);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_asr56(Uint32 *dest)
 {
+	Uint64 value;
 	Uint16 carry;
 
-	/* Shift right dest 1 bit: D>>=1 */
-
-	carry = dest[2] & 1;
+	/* Shift right dest 1 bit, keeping the sign: D>>=1 */
+	value = dsp_pack56(dest);
 
-	dest[2] >>= 1;
-	dest[2] |= (dest[1] & 1)<<23;
+	carry = value & 1;
+	value = (value>>1) | (value & (((Uint64)1)<<55));
 
-	dest[1] >>= 1;
-	dest[1] |= (dest[0] & 1)<<23;
-
-	dest[0] >>= 1;
-	dest[0] |= (dest[0] & (1<<6))<<1;
+	dsp_unpack56(value, dest);
 
 	return (carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_add56(Uint32 *source, Uint32 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r;
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest[0]>>7) & 1;
+	Uint64 src, dst, result;
+	Uint16 overflow, carry;
 
 	/* Add source to dest: D = D+S */
-	dest[2] += source[2];
-	dest[1] += source[1]+((dest[2]>>24) & 1);
-	dest[0] += source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
+	src = dsp_pack56(source);
+	dst = dsp_pack56(dest);
+	result = dst + src;
 
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
+	carry = (result>>56) & 1;
+	result &= DSP_MASK56;
 
-	flg_r = (dest[0]>>7) & 1;
+	/* set overflow */
+	overflow = (((src ^ result) & (dst ^ result))>>55) & 1;
 
-	/*set overflow*/
-	overflow = (flg_s ^ flg_r) & (flg_d ^ flg_r);
+	dsp_unpack56(result, dest);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_sub56(Uint32 *source, Uint32 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r, dest_save;
-
-	dest_save = dest[0];
+	Uint64 src, dst, result;
+	Uint16 overflow, carry;
 
 	/* Subtract source from dest: D = D-S */
-	dest[2] -= source[2];
-	dest[1] -= source[1]+((dest[2]>>24) & 1);
-	dest[0] -= source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
+	src = dsp_pack56(source);
+	dst = dsp_pack56(dest);
+	result = dst - src;
 
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest_save>>7) & 1;
-	flg_r = (dest[0]>>7) & 1;
+	/* borrow out of bit 55 */
+	carry = (result>>56) & 1;
+	result &= DSP_MASK56;
 
 	/* set overflow */
-	overflow = (flg_s ^ flg_d) & (flg_r ^ flg_d);
+	overflow = (((src ^ dst) & (result ^ dst))>>55) & 1;
+
+	dsp_unpack56(result, dest);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static void dsp_mul56(Uint32 source1, Uint32 source2, Uint32 *dest, Uint8 signe)
 {
-	Uint32 part[4], zerodest[3], value;
-
-	/* Multiply: D = S1*S2 */
-	if (source1 & (1<<23)) {
-		signe ^= 1;
-		source1 = (1<<24) - source1;
-	}
-	if (source2 & (1<<23)) {
-		signe ^= 1;
-		source2 = (1<<24) - source2;
-	}
-
-	/* bits 0-11 * bits 0-11 */
-	part[0]=(source1 & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 12-23 * bits 0-11 */
-	part[1]=((source1>>12) & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 0-11 * bits 12-23 */
-	part[2]=(source1 & BITMASK(12))*((source2>>12)  & BITMASK(12));
-	/* bits 12-23 * bits 12-23 */
-	part[3]=((source1>>12) & BITMASK(12))*((source2>>12) & BITMASK(12));
-
-	/* Calc dest 2 */
-	dest[2] = part[0];
-	dest[2] += (part[1] & BITMASK(12)) << 12;
-	dest[2] += (part[2] & BITMASK(12)) << 12;
-
-	/* Calc dest 1 */
-	dest[1] = (part[1]>>12) & BITMASK(12);
-	dest[1] += (part[2]>>12) & BITMASK(12);
-	dest[1] += part[3];
-
-	/* Calc dest 0 */
-	dest[0] = 0;
-
-	/* Add carries */
-	value = (dest[2]>>24) & BITMASK(8);
-	if (value) {
-		dest[1] += value;
-		dest[2] &= BITMASK(24);
-	}
-	value = (dest[1]>>24) & BITMASK(8);
-	if (value) {
-		dest[0] += value;
-		dest[1] &= BITMASK(24);
-	}
-
-	/* Get rid of extra sign bit */
-	dsp_asl56(dest);
+	Sint64 product;
 
+	/* Multiply: D = S1*S2, fractional so shifted left to drop the extra sign bit */
+	product = (Sint64)((Sint32)(source1<<8)>>8) * ((Sint32)(source2<<8)>>8) * 2;
 	if (signe) {
-		zerodest[0] = zerodest[1] = zerodest[2] = 0;
-
-		dsp_sub56(dest, zerodest);
-
-		dest[0] = zerodest[0];
-		dest[1] = zerodest[1];
-		dest[2] = zerodest[2];
+		product = -product;
 	}
+
+	dsp_unpack56((Uint64)product & DSP_MASK56, dest);
 }
 
 static void dsp_rnd56(Uint32 *dest)
@@ -113,7 +113,11 @@ extern "C" {
 /* Functions */
 extern void dsp56k_init_cpu(void);		/* Set dsp_core to use */
 extern void dsp56k_execute_instruction(void);	/* Execute 1 instruction */
+extern Sint32 dsp56k_execute_slice(Sint32 cycles);	/* Execute instructions for given cycles */
+extern Sint32 dsp56k_execute_slice_checked(Sint32 cycles);	/* Same, verifying the fast paths */
 extern Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc);	/* Execute 1 instruction in disasm mode */
+extern void dsp56k_decode_cache_flush(void);	/* P memory was changed */
+extern void dsp56k_decode_cache_invalidate(Uint16 address);	/* P memory word was changed */
 
 /* Interrupt relative functions */
 void dsp_add_interrupt(Uint16 inter);
@@ -53,14 +53,25 @@ const char HostScreen_fileid[] = "Hatari hostscreen.c : " __DATE__ " " __TIME__;
 static SDL_Rect hs_rect;
 static int hs_width_req, hs_height_req, hs_bpp;
 static bool   doUpdate; // the HW surface is available -> the SDL need not to update the surface after ->pixel access
+static int hs_dirtyFirst, hs_dirtyLast; // host lines changed by rendering, last excluded
+static bool hs_dirtyKnown;	// whether renderer told them, otherwise whole screen changed
 
 static void HostScreen_remapPalette(void);
 
 static struct { // TOS palette (bpp < 16) to SDL color mapping
 	SDL_Color	standard[256];
 	Uint32		native[256];
+	Uint32		changed[256/32];	// entries not yet given to SDL_SetColors()
 } palette;
 
+static struct { // RGB to host pixel mapping, instead of SDL_MapRGB() calls
+	const SDL_PixelFormat *fmt;	// format for which this was set up
+	bool indexed;			// palettized format, use SDL_MapRGB()
+	Uint8 rloss, gloss, bloss;
+	Uint8 rshift, gshift, bshift;
+	Uint32 amask;
+} colormap;
+
 
 static const Uint32 default_palette[] = {
     RGB_WHITE, RGB_RED, RGB_GREEN, RGB_YELLOW,
@@ -79,6 +90,7 @@ void HostScreen_Init(void)
 		palette.standard[i].g = (color >> 16) & 0xff;
 		palette.standard[i].b = color & 0xff;
 	}
+	memset(palette.changed, 0xff, sizeof(palette.changed));
 }
 
 void HostScreen_UnInit(void)
@@ -142,11 +154,11 @@ void HostScreen_setWindowSize(int width, int height, int bpp)
 	}
 
 	/* then select scale as close to target size as possible
-	 * without having larger size than it
+	 * without having larger size than it, unless host scales
 	 */
 	scalex = maxw/(nScreenZoomX*width);
 	scaley = maxh/(nScreenZoomY*height);
-	if (scalex > 1 && scaley > 1) {
+	if (scalex > 1 && scaley > 1 && !ConfigureParams.Screen.bNativeRes) {
 		/* keep aspect ratio */
 		if (scalex < scaley) {
 			nScreenZoomX *= scalex;
@@ -211,6 +223,7 @@ void HostScreen_setWindowSize(int width, int height, int bpp)
 	}
 
 	// In case surface format changed, update SDL palette & remap the native palette
+	memset(palette.changed, 0xff, sizeof(palette.changed));
 	HostScreen_updatePalette(256);
 	HostScreen_remapPalette();
 
@@ -242,17 +255,59 @@ void HostScreen_setWindowSize(int width, int height, int bpp)
 void HostScreen_update1(SDL_Rect *extra, bool forced)
 {
 	SDL_Rect rects[2];
-	int count = 1;
+	int count = 0;
+	bool known = hs_dirtyKnown;
 
+	hs_dirtyKnown = false;
 	if ( !forced && !doUpdate ) // the HW surface is available
 		return;
 
 	rects[0] = hs_rect;
+	if (forced || !known) {
+		count = 1;
+	} else if (hs_dirtyFirst < hs_dirtyLast) {
+		// only the lines changed by rendering
+		rects[0].y = hs_dirtyFirst;
+		rects[0].h = hs_dirtyLast - hs_dirtyFirst;
+		count = 1;
+	}
 	if (extra) {
-		rects[1] = *extra;
-		count = 2;
+		rects[count++] = *extra;
 	}
-	SDL_UpdateRects(sdlscrn, count, rects);
+	if (!count)	// nothing changed, frame can be skipped
+		return;
+	if (!bBenchmarkMode)
+		SDL_UpdateRects(sdlscrn, count, rects);
+	Screen_SetUpdated();
+}
+
+/**
+ * Tell which host screen lines ('first' to 'last' excluded) rendering
+ * changed, so that only they need to be updated.  Can be called several
+ * times (or with empty range if nothing changed) between
+ * HostScreen_renderBegin() and HostScreen_update1(), if this isn't called,
+ * whole screen is updated.
+ */
+void HostScreen_setDirtyLines(int first, int last)
+{
+	if (first < (int)hs_rect.y)
+		first = hs_rect.y;
+	if (last > (int)(hs_rect.y + hs_rect.h))
+		last = hs_rect.y + hs_rect.h;
+	if (first >= last) {
+		hs_dirtyKnown = true;
+		return;
+	}
+	if (!hs_dirtyKnown || hs_dirtyFirst >= hs_dirtyLast) {
+		hs_dirtyFirst = first;
+		hs_dirtyLast = last;
+	} else {
+		if (first < hs_dirtyFirst)
+			hs_dirtyFirst = first;
+		if (last > hs_dirtyLast)
+			hs_dirtyLast = last;
+	}
+	hs_dirtyKnown = true;
 }
 
 
@@ -286,14 +341,53 @@ SDL_PixelFormat *HostScreen_getFormat(void)
 	return sdlscrn->format;
 }
 
+/**
+ * Set up RGB to host pixel mapping for the current screen surface format
+ */
+static void HostScreen_initColorMap(void)
+{
+	const SDL_PixelFormat *fmt = sdlscrn->format;
+
+	colormap.fmt = fmt;
+	colormap.indexed = fmt->BytesPerPixel == 1;
+	colormap.rloss = fmt->Rloss;
+	colormap.gloss = fmt->Gloss;
+	colormap.bloss = fmt->Bloss;
+	colormap.rshift = fmt->Rshift;
+	colormap.gshift = fmt->Gshift;
+	colormap.bshift = fmt->Bshift;
+	colormap.amask = fmt->Amask;
+}
+
+/**
+ * Convert color to host pixel format, like SDL_MapRGB() does
+ */
+static Uint32 HostScreen_mapColor(Uint8 red, Uint8 green, Uint8 blue)
+{
+	if (colormap.indexed)
+		return SDL_MapRGB(sdlscrn->format, red, green, blue);
+	return (red >> colormap.rloss) << colormap.rshift
+		| (green >> colormap.gloss) << colormap.gshift
+		| (blue >> colormap.bloss) << colormap.bshift
+		| colormap.amask;
+}
+
 void HostScreen_setPaletteColor(Uint8 idx, Uint8 red, Uint8 green, Uint8 blue)
 {
+	SDL_Color *color = &palette.standard[idx];
+
+	// surface format changed without going through HostScreen_setWindowSize()?
+	if (colormap.fmt != sdlscrn->format)
+		HostScreen_remapPalette();
+	if (color->r == red && color->g == green && color->b == blue)
+		return;
 	// set the SDL standard RGB palette settings
-	palette.standard[idx].r = red;
-	palette.standard[idx].g = green;
-	palette.standard[idx].b = blue;
+	color->r = red;
+	color->g = green;
+	color->b = blue;
+	palette.changed[idx >> 5] |= 1u << (idx & 31);
 	// convert the color to native
-	palette.native[idx] = SDL_MapRGB( sdlscrn->format, red, green, blue );
+	palette.native[idx] = HostScreen_mapColor(red, green, blue);
 }
 
 Uint32 HostScreen_getPaletteColor(Uint8 idx)
@@ -301,9 +395,25 @@ Uint32 HostScreen_getPaletteColor(Uint8 idx)
 	return palette.native[idx];
 }
 
+/**
+ * Give palette entries changed since previous call, out of the first
+ * 'colorCount' ones, to SDL
+ */
 void HostScreen_updatePalette(int colorCount)
 {
-	SDL_SetColors( sdlscrn, palette.standard, 0, colorCount );
+	int i, first = -1, last = -1;
+
+	for (i = 0; i < colorCount; i++) {
+		Uint32 bit = 1u << (i & 31);
+		if (palette.changed[i >> 5] & bit) {
+			palette.changed[i >> 5] &= ~bit;
+			if (first < 0)
+				first = i;
+			last = i;
+		}
+	}
+	if (first >= 0)
+		SDL_SetColors( sdlscrn, palette.standard + first, first, last - first + 1 );
 }
 
 static void HostScreen_remapPalette(void)
@@ -311,15 +421,22 @@ static void HostScreen_remapPalette(void)
 	int i;
 	Uint32 *native = palette.native;
 	SDL_Color *standard = palette.standard;
-	SDL_PixelFormat *fmt = sdlscrn->format;
 
+	HostScreen_initColorMap();
 	for(i = 0; i < 256; i++, native++, standard++) {
-		*native = SDL_MapRGB(fmt, standard->r, standard->g, standard->b);
+		*native = HostScreen_mapColor(standard->r, standard->g, standard->b);
 	}
 }
 
 bool HostScreen_renderBegin(void)
 {
+	hs_dirtyKnown = false;
+
+	/* restore area potentially left under overlay led, as
+	 * rendering can leave unchanged lines as they were
+	 */
+	Statusbar_OverlayRestore(sdlscrn);
+
 	if (SDL_MUSTLOCK(sdlscrn))
 		if (SDL_LockSurface(sdlscrn) < 0) {
 			printf("Couldn't lock surface to refresh!\n");
@@ -338,5 +455,6 @@ SDL_Rect* HostScreen_renderEnd(void)
 {
 	if (SDL_MUSTLOCK(sdlscrn))
 		SDL_UnlockSurface(sdlscrn);
+	Statusbar_OverlayBackup(sdlscrn);
 	return Statusbar_Update(sdlscrn, false);
 }
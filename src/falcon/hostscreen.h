@@ -14,6 +14,7 @@ extern void HostScreen_toggleFullScreen(void);
 extern bool HostScreen_renderBegin(void);
 extern SDL_Rect* HostScreen_renderEnd(void);
 extern void HostScreen_update1(SDL_Rect* extra, bool forced);
+extern void HostScreen_setDirtyLines(int first, int last);
 extern Uint32 HostScreen_getBpp(void);	/* Bytes per pixel */
 extern Uint32 HostScreen_getPitch(void);
 extern Uint32 HostScreen_getWidth(void);
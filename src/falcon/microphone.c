@@ -5,6 +5,13 @@
   This file is distributed under the GNU General Public License, version 2
   or at your option any later version. Read the file gpl.txt for details.
 
+  The recorded frames go through a single producer / single consumer ring,
+  so the audio thread never touches the crossbar state : the crossbar pulls
+  them from the emulation thread with Microphone_Read() and converts them
+  to the ADC frequency itself.
+  With PortAudio, the ring is filled by the PortAudio callback.  In the
+  libretro core, it's filled from the frontend's microphone interface.
+
   This program uses the PortAudio Portable Audio Library.
   For more information see: http://www.portaudio.com
   Copyright (c) 1999-2000 Ross Bencina and Phil Burk
@@ -12,14 +19,73 @@
 
 #include "main.h"
 
-#if HAVE_PORTAUDIO
+#if HAVE_PORTAUDIO || defined(__LIBRETRO__)
 
-#include <portaudio.h>
 #include "microphone.h"
 #include "configuration.h"
-#include "crossbar.h"
 #include "log.h"
 
+#define MICRO_RING_SIZE		8192			/* stereo frames, must be a power of 2 */
+#define MICRO_RING_MASK		(MICRO_RING_SIZE - 1)
+
+static Sint16	MicroRing[ MICRO_RING_SIZE ][ 2 ];
+static Uint32	MicroRingHead;				/* written frames, producer only */
+static Uint32	MicroRingTail;				/* read frames, consumer only */
+
+/**
+ * Producer : add recorded frames to the ring ('in' NULL for silence).
+ * 'channels' is 1 for mono input, which is copied to both tracks, or 2.
+ * Frames which don't fit (consumer isn't reading) are dropped.
+ */
+static void Microphone_RingWrite(const Sint16 *in, int nFrames, int channels)
+{
+	Uint32 head = MicroRingHead;
+	Uint32 tail = __atomic_load_n(&MicroRingTail, __ATOMIC_ACQUIRE);
+	int i;
+
+	if (nFrames > (int)(MICRO_RING_SIZE - (head - tail)))
+		nFrames = MICRO_RING_SIZE - (head - tail);
+	for (i = 0; i < nFrames; i++, head++)
+	{
+		if (!in) {
+			MicroRing[head & MICRO_RING_MASK][0] = 0;
+			MicroRing[head & MICRO_RING_MASK][1] = 0;
+		} else {
+			MicroRing[head & MICRO_RING_MASK][0] = in[0];
+			MicroRing[head & MICRO_RING_MASK][1] = in[channels - 1];
+			in += channels;
+		}
+	}
+	__atomic_store_n(&MicroRingHead, head, __ATOMIC_RELEASE);
+}
+
+/**
+ * Consumer : copy at most 'nFrames' recorded frames to 'frames'.
+ * Return the number of frames copied.
+ */
+static int Microphone_RingRead(Sint16 frames[][2], int nFrames)
+{
+	Uint32 tail = MicroRingTail;
+	Uint32 count = __atomic_load_n(&MicroRingHead, __ATOMIC_ACQUIRE) - tail;
+	int i;
+
+	if (nFrames > (int)count)
+		nFrames = count;
+	for (i = 0; i < nFrames; i++, tail++)
+	{
+		frames[i][0] = MicroRing[tail & MICRO_RING_MASK][0];
+		frames[i][1] = MicroRing[tail & MICRO_RING_MASK][1];
+	}
+	__atomic_store_n(&MicroRingTail, tail, __ATOMIC_RELEASE);
+	return nFrames;
+}
+
+#endif
+
+#if HAVE_PORTAUDIO
+
+#include <portaudio.h>
+
 #define FRAMES_PER_BUFFER (64)
 
 /* Static functions */
@@ -38,8 +104,6 @@ static PaStream *micro_stream;
 static PaError  micro_err;
 
 static int   micro_sampleRate;
-static Sint16 micro_buffer_L[FRAMES_PER_BUFFER];	/* left buffer */
-static Sint16 micro_buffer_R[FRAMES_PER_BUFFER];	/* right buffer */
 
 
 /* This routine will be called by the PortAudio engine when audio is needed.
@@ -52,26 +116,9 @@ static int Microphone_Callback (const void *inputBuffer, void *outputBuffer,
                            PaStreamCallbackFlags statusFlags,
                            void *userData)
 {
-	unsigned int i;
-	const Sint16 *in = inputBuffer;
-	
-	Sint16 *out_L = (Sint16*)micro_buffer_L;
-	Sint16 *out_R = (Sint16*)micro_buffer_R;
+	/* hand the frames to the emulation thread */
+	Microphone_RingWrite(inputBuffer, framesPerBuffer, 2);
 
-	if (inputBuffer == NULL) {
-		memset(micro_buffer_L, 0, sizeof(micro_buffer_L));
-		memset(micro_buffer_R, 0, sizeof(micro_buffer_R));
-	}
-	else {
-		for (i=0; i<framesPerBuffer; i++) {
-			*out_L ++ = *in++;	/* left data */
-			*out_R ++ = *in++;	/* right data */
-		}
-	}
-
-	/* send buffer to crossbar */
-	Crossbar_GetMicrophoneDatas(micro_buffer_L, micro_buffer_R, framesPerBuffer);
-	
 	/* get Next Microphone datas */
 	return paContinue;
 }
@@ -92,6 +139,7 @@ bool Microphone_Start(int sampleRate)
 	}
 
 	micro_sampleRate = sampleRate;
+	MicroRingTail = MicroRingHead;				/* forget frames from a previous run */
 
 	/* Initialize portaudio */
 	micro_err = Pa_Initialize();
@@ -180,4 +228,87 @@ bool Microphone_Stop(void)
 	return Microphone_Terminate();
 }
 
+/**
+ * Microphone (jack) read : get at most 'nFrames' stereo frames recorded
+ * since the previous call, at the sample rate given to Microphone_Start().
+ * Called from the emulation thread, return the number of frames read.
+ */
+int Microphone_Read(Sint16 frames[][2], int nFrames)
+{
+	return Microphone_RingRead(frames, nFrames);
+}
+
+#elif defined(__LIBRETRO__)
+
+#include <libretro.h>
+
+#define MICRO_READ_FRAMES 512
+
+/* set by the libretro core when the frontend has a microphone interface */
+struct retro_microphone_interface *MicrophoneRetroInterface;
+
+static retro_microphone_t *micro_retro;
+
+/**
+ * Microphone (jack) inits : open the frontend's microphone
+ *   - sampleRate : system sound frequency
+ * return true on success, false on error or if mic disabled
+ */
+bool Microphone_Start(int sampleRate)
+{
+	retro_microphone_params_t params;
+
+	if (!ConfigureParams.Sound.bEnableMicrophone || !MicrophoneRetroInterface) {
+		Log_Printf(LOG_DEBUG, "Microphone: Disabled\n");
+		return false;
+	}
+
+	MicroRingTail = MicroRingHead;				/* forget frames from a previous run */
+	params.rate = sampleRate;
+	micro_retro = MicrophoneRetroInterface->open_mic(&params);
+	if (!micro_retro) {
+		Log_Printf(LOG_WARN, "Microphone: No input device found.\n");
+		return false;
+	}
+	if (!MicrophoneRetroInterface->set_mic_state(micro_retro, true)) {
+		Microphone_Stop();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Microphone (jack) stop : close the frontend's microphone
+ * return true for success
+ */
+bool Microphone_Stop(void)
+{
+	if (micro_retro && MicrophoneRetroInterface)
+		MicrophoneRetroInterface->close_mic(micro_retro);
+	micro_retro = NULL;
+	return true;
+}
+
+/**
+ * Microphone (jack) read : get at most 'nFrames' stereo frames recorded
+ * since the previous call, at the sample rate given to Microphone_Start().
+ * The frontend is polled from the emulation thread, so the ring only
+ * smooths its reads and the crossbar's ones.
+ */
+int Microphone_Read(Sint16 frames[][2], int nFrames)
+{
+	Sint16 mono[MICRO_READ_FRAMES];
+	int n;
+
+	if (micro_retro)
+	{
+		do {
+			n = MicrophoneRetroInterface->read_mic(micro_retro, mono, MICRO_READ_FRAMES);
+			if (n > 0)
+				Microphone_RingWrite(mono, n, 1);
+		} while (n == MICRO_READ_FRAMES);
+	}
+	return Microphone_RingRead(frames, nFrames);
+}
+
 #endif /* HAVE PORTAUDIO */
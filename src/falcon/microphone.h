@@ -8,13 +8,15 @@
 #ifndef HATARI_MICROPHONE_H
 #define HATARI_MICROPHONE_H
 
-#if HAVE_PORTAUDIO
+#if HAVE_PORTAUDIO || defined(__LIBRETRO__)
 extern bool Microphone_Start (int sampleRate);
 extern bool Microphone_Stop (void);
+extern int Microphone_Read (Sint16 frames[][2], int nFrames);
 #else
 /* replace function calls with NOPs (could also be empty static inlines) */
 #define Microphone_Start(rate) false
 #define Microphone_Stop() false
+#define Microphone_Read(frames, nFrames) 0
 #endif
 
 
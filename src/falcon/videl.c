@@ -79,6 +79,19 @@ const char VIDEL_fileid[] = "Hatari videl.c : " __DATE__ " " __TIME__;
 #include "video.h"				/* for bUseHighRes variable, maybe unuseful (Laurent) */
 #include "vdi.h"				/* for bUseVDIRes variable,  maybe unuseful (Laurent) */
 
+#if ENABLE_CONVERT_THREAD
+#include <rthreads/rthreads.h>
+#endif
+
+/* SSE2 and NEON are always available on x86-64 and AArch64 */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN && defined(__SSE2__)
+#include <emmintrin.h>
+#define VIDEL_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VIDEL_NEON 1
+#endif
+
 #define Atari2HostAddr(a) (&STRam[a])
 #define VIDEL_COLOR_REGS_BEGIN	0xff9800
 
@@ -112,9 +125,64 @@ struct videl_zoom_s {
 	int *zoomytable;
 };
 
+/* Graphical area rendering parameters, shared by the rendering bands */
+typedef struct videl_lines_s videl_lines_t;
+struct videl_lines_s {
+	void (*render)(const videl_lines_t *l, int first, int last);
+	Uint16 *fvram;				/* Atari screen, first line of the graphical area */
+	Uint8 *hvram;				/* Host screen, first line of the graphical area */
+	int nextline;				/* Offset to next Atari line, in words */
+	int scrpitch;				/* Host screen pitch, in bytes */
+	int scrbpp;				/* Host screen bytes per pixel */
+	int scrwidth;				/* Host line width, borders included */
+	int vw;					/* Graphical area width, in Atari pixels */
+	int vbpp;				/* Atari bits per pixel */
+	int hscrolloffset;			/* Fine scrolling offset, in pixels */
+	int leftBorderSize;			/* Left border, in host pixels */
+	int rightBorderSize;			/* Right border, in host pixels */
+	int coefx;				/* Horizontal zoom coefficient */
+	SDL_PixelFormat *scrfmt;
+	Uint32 palette[256];			/* Host colors, read once per frame */
+	const Uint8 *dirty;			/* Lines needing rendering, NULL for all */
+};
+
 static struct videl_s videl;
 static struct videl_zoom_s videl_zoom;
 
+/* Palette entries written since they were given to the host screen */
+static struct {
+	Uint32 changed[256/32];
+	bool bUseSTShifter;			/* Shifter and bpp for which */
+	Uint16 scrBpp;				/* host colors were last set */
+} videl_colors;
+
+/* Previous unzoomed frame, for rendering only its changed lines */
+static struct {
+	videl_lines_t lines;			/* Its rendering parameters */
+	Uint32 base;				/* Its Atari screen address */
+	int vh;					/* Its height, -1 if not valid */
+	int lowBorderSize;
+	bool sampleHold;
+	Uint8 *dirty;				/* Changed lines of current frame */
+	int dirtysize;
+} videl_prev = { .vh = -1 };
+
+#if ENABLE_CONVERT_THREAD
+#define VIDEL_BANDS	4			/* Number of bands, one for each thread */
+
+static struct {
+	sthread_t *thread[VIDEL_BANDS-1];	/* Workers for bands 1 and up */
+	slock_t *lock;
+	scond_t *cond;
+	const videl_lines_t *lines;		/* Frame being rendered */
+	int count;				/* Its number of lines */
+	Uint32 frame;				/* Incremented for each new frame */
+	int done;				/* Bands done by the workers */
+	bool quit;
+	bool failed;				/* Thread creation failed, don't retry */
+} videl_bands;
+#endif
+
 Uint16 vfc_counter;			/* counter for VFC register $ff82a0 (to be internalized when VIDEL emulation is complete) */
 
 static void VIDEL_memset_uint32(Uint32 *addr, Uint32 color, int count);
@@ -133,6 +201,7 @@ void VIDEL_reset(void)
 	videl.monitor_type = videl.reg_ffff8006_save & 0xc0;
 	
 	videl.hostColorsSync = false; 
+	memset(videl_colors.changed, 0xff, sizeof(videl_colors.changed));
 
 	vfc_counter = 0;
 	
@@ -166,6 +235,28 @@ void VIDEL_MemorySnapShot_Capture(bool bSave)
 	/* Save/Restore details */
 	MemorySnapShot_Store(&videl, sizeof(videl));
 	MemorySnapShot_Store(&vfc_counter, sizeof(vfc_counter));
+
+	if (!bSave)
+	{
+		videl.hostColorsSync = false;
+		memset(videl_colors.changed, 0xff, sizeof(videl_colors.changed));
+	}
+}
+
+/**
+ * Mark palette entries written by current IO access as changed,
+ * for registers starting at 'regs' with (1 << 'shift') bytes per entry
+ */
+static void VIDEL_ColorsChanged(Uint32 regs, int shift)
+{
+	int i = (IoAccessCurrentAddress - regs) >> shift;
+	int last = (IoAccessBaseAddress + nIoMemAccessSize - 1 - regs) >> shift;
+
+	if (last > 255)
+		last = 255;
+	for (; i <= last; i++)
+		videl_colors.changed[i >> 5] |= 1u << (i & 31);
+	videl.hostColorsSync = false;
 }
 
 /**
@@ -176,7 +267,7 @@ void VIDEL_FalconColorRegsWrite(void)
 	uint32_t color = IoMem_ReadLong(IoAccessBaseAddress & ~3);
 	color &= 0xfcfc00fc;	/* Unused bits have to be set to 0 */
 	IoMem_WriteLong(IoAccessBaseAddress & ~3, color);
-	videl.hostColorsSync = false;
+	VIDEL_ColorsChanged(VIDEL_COLOR_REGS_BEGIN, 2);
 }
 
 /**
@@ -317,6 +408,7 @@ void VIDEL_ST_ShiftModeWriteByte(void)
 
 	/* Activate STE palette */
 	videl.bUseSTShifter = true;
+	videl.hostColorsSync = false;
 
 	/*  Compute line width and video mode */
 	switch (st_shiftMode & 0x3) {
@@ -405,6 +497,7 @@ void VIDEL_Falcon_ShiftMode_WriteWord(void)
 	          IoMem_ReadWord(0xff8266));
 
 	videl.bUseSTShifter = false;
+	videl.hostColorsSync = false;
 }
 
 /**
@@ -846,18 +939,32 @@ static void VIDEL_getMonitorScale(int *sx, int *sy)
 #endif
 
 
-/** map the correct colortable into the correct pixel format
+/** map the correct colortable into the correct pixel format,
+ * for the entries changed since previous call
  */
 static void VIDEL_updateColors(void)
 {
 	int i, r, g, b, colors = 1 << videl.save_scrBpp;
+	Uint32 *changed = videl_colors.changed;
 
 #define F_COLORS(i) IoMem_ReadByte(VIDEL_COLOR_REGS_BEGIN + (i))
 #define STE_COLORS(i)	IoMem_ReadByte(0xff8240 + (i))
+#define COLOR_CHANGED(i)	(changed[(i) >> 5] & (1u << ((i) & 31)))
+
+	/* other palette or other entries in use -> all need updating */
+	if (videl.bUseSTShifter != videl_colors.bUseSTShifter ||
+	    videl.save_scrBpp != videl_colors.scrBpp) {
+		memset(changed, 0xff, sizeof(videl_colors.changed));
+		videl_colors.bUseSTShifter = videl.bUseSTShifter;
+		videl_colors.scrBpp = videl.save_scrBpp;
+	}
 
 	if (!videl.bUseSTShifter) {
 		for (i = 0; i < colors; i++) {
 			int offset = i << 2;
+			if (!COLOR_CHANGED(i))
+				continue;
+			changed[i >> 5] &= ~(1u << (i & 31));
 			r = F_COLORS(offset) & 0xfc;
 			r |= r>>6;
 			g = F_COLORS(offset + 1) & 0xfc;
@@ -870,6 +977,9 @@ static void VIDEL_updateColors(void)
 	} else {
 		for (i = 0; i < colors; i++) {
 			int offset = i << 1;
+			if (!COLOR_CHANGED(i))
+				continue;
+			changed[i >> 5] &= ~(1u << (i & 31));
 			r = STE_COLORS(offset) & 0x0f;
 			r = ((r & 7)<<1)|(r>>3);
 			r |= r<<4;
@@ -972,8 +1082,48 @@ bool VIDEL_renderScreen(void)
 /**
  * Performs conversion from the TOS's bitplane word order (big endian) data
  * into the native chunky color index.
+ *
+ * The vector versions test the bits of each plane with byte compares, and
+ * handle any number of planes the same way.
  */
-static void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
+#if defined(VIDEL_SSE2)
+static inline void VIDEL_bitplaneToChunky(const Uint16 *atariBitplaneData, Uint16 bpp,
+                                          Uint8 colorValues[16])
+{
+	/* pixels 0-7 are in the first byte of the plane words, from bit 7 */
+	const __m128i bits = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, (char)128,
+	                                  1, 2, 4, 8, 16, 32, 64, (char)128);
+	__m128i plane, sum = _mm_setzero_si128();
+	int i;
+
+	for (i = 0; i < bpp; i++) {
+		/* both bytes of the plane word, 8 times each */
+		plane = _mm_cvtsi32_si128(atariBitplaneData[i]);
+		plane = _mm_unpacklo_epi8(plane, plane);
+		plane = _mm_unpacklo_epi16(plane, plane);
+		plane = _mm_unpacklo_epi32(plane, plane);
+		plane = _mm_cmpeq_epi8(_mm_and_si128(plane, bits), bits);
+		sum = _mm_or_si128(sum, _mm_and_si128(plane, _mm_set1_epi8((char)(1 << i))));
+	}
+	_mm_storeu_si128((__m128i *)colorValues, sum);
+}
+#elif defined(VIDEL_NEON)
+static inline void VIDEL_bitplaneToChunky(const Uint16 *atariBitplaneData, Uint16 bpp,
+                                          Uint8 colorValues[16])
+{
+	static const Uint8 bits[16] = { 128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1 };
+	const Uint8 *planes = (const Uint8 *)atariBitplaneData;
+	uint8x16_t mask = vld1q_u8(bits), plane, sum = vdupq_n_u8(0);
+	int i;
+
+	for (i = 0; i < bpp; i++) {
+		plane = vcombine_u8(vdup_n_u8(planes[2*i]), vdup_n_u8(planes[2*i+1]));
+		sum = vorrq_u8(sum, vandq_u8(vtstq_u8(plane, mask), vdupq_n_u8(1 << i)));
+	}
+	vst1q_u8(colorValues, sum);
+}
+#else
+static void VIDEL_bitplaneToChunky(const Uint16 *atariBitplaneData, Uint16 bpp,
                                    Uint8 colorValues[16])
 {
 	Uint32 a, b, c, d, x;
@@ -988,18 +1138,18 @@ static void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
 	 * this code, though, so it would be nice to do something about it.
 	 */
 	if (bpp >= 4) {
-		d = *(Uint32 *)&atariBitplaneData[0];
-		c = *(Uint32 *)&atariBitplaneData[2];
+		d = *(const Uint32 *)&atariBitplaneData[0];
+		c = *(const Uint32 *)&atariBitplaneData[2];
 		if (bpp == 4) {
 			a = b = 0;
 		} else {
-			b = *(Uint32 *)&atariBitplaneData[4];
-			a = *(Uint32 *)&atariBitplaneData[6];
+			b = *(const Uint32 *)&atariBitplaneData[4];
+			a = *(const Uint32 *)&atariBitplaneData[6];
 		}
 	} else {
 		a = b = c = 0;
 		if (bpp == 2) {
-			d = *(Uint32 *)&atariBitplaneData[0];
+			d = *(const Uint32 *)&atariBitplaneData[0];
 		} else {
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 			d = atariBitplaneData[0]<<16;
@@ -1099,16 +1249,569 @@ static void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
 	colorValues[14] = d;
 #endif
 }
+#endif /* VIDEL_SSE2 */
+
+
+/**
+ * Convert the 16-pixel blocks of a bitplane line (one more with fine
+ * scrolling) into color indexes at 'idx'.  The pixels to show start
+ * at 'idx' + hscrolloffset.
+ */
+static void VIDEL_planarLineToChunky(const videl_lines_t *l, const Uint16 *fvram_column, Uint8 *idx)
+{
+	int w, blocks = (l->vw+15)>>4;
+
+	/* Last pixels of the line for fine scrolling */
+	if (l->hscrolloffset)
+		blocks++;
+
+	for (w = 0; w < blocks; w++) {
+		VIDEL_bitplaneToChunky(fvram_column, l->vbpp, idx);
+		fvram_column += l->vbpp;
+		idx += 16;
+	}
+}
+
+
+/**
+ * Copy 'count' high color pixels (big endian) to a 16-bit host line
+ */
+static void VIDEL_copyHicolorLine(Uint16 *hvram_column, const Uint16 *fvram_column, int count)
+{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+	/* FIXME: here might be a runtime little/big video endian switch like:
+		if ( " videocard memory in Motorola endian format " false)
+	*/
+	memcpy(hvram_column, fvram_column, count<<1);
+#else
+	int w = 0;
+
+#if defined(VIDEL_SSE2)
+	for (; w + 8 <= count; w += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)&fvram_column[w]);
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		_mm_storeu_si128((__m128i *)&hvram_column[w], v);
+	}
+#elif defined(VIDEL_NEON)
+	for (; w + 8 <= count; w += 8)
+		vst1q_u8((Uint8 *)&hvram_column[w], vrev16q_u8(vld1q_u8((const Uint8 *)&fvram_column[w])));
+#endif
+	for (; w < count; w++)
+		hvram_column[w] = SDL_SwapBE16(fvram_column[w]);
+#endif /* SDL_BYTEORDER == SDL_BIG_ENDIAN */
+}
+
+
+/**
+ * Fill 'count' host pixels with 'color', return the address after them
+ */
+static Uint8 *VIDEL_fillPixels(Uint8 *hvram, int scrbpp, Uint32 color, int count)
+{
+	if (count <= 0)
+		return hvram;
+
+	switch (scrbpp) {
+		case 1:
+			VIDEL_memset_uint8(hvram, color, count);
+			break;
+		case 2:
+			VIDEL_memset_uint16((Uint16 *)hvram, color, count);
+			break;
+		case 4:
+			VIDEL_memset_uint32((Uint32 *)hvram, color, count);
+			break;
+	}
+	return hvram + count * scrbpp;
+}
+
+
+/**
+ * Fill 'count' host lines of 'width' pixels with the border color,
+ * return the address of the line after them
+ */
+static Uint8 *VIDEL_fillLines(Uint8 *hvram, int scrpitch, int scrbpp, int width, int count)
+{
+	Uint32 color = HostScreen_getPaletteColor(0);
+
+	for (; count > 0; count--) {
+		VIDEL_fillPixels(hvram, scrbpp, color, width);
+		hvram += scrpitch;
+	}
+	return hvram;
+}
+
+
+/**
+ * TT sample & hold mode: pixels with color 0 repeat the previous color
+ */
+static void VIDEL_sampleHold(Uint8 *hvram_line, int count)
+{
+	Uint8 TMPPixel = 0;
+	int w;
+
+	for (w = 0; w < count; w++) {
+		if (hvram_line[w] == 0) {
+			hvram_line[w] = TMPPixel;
+		} else {
+			TMPPixel = hvram_line[w];
+		}
+	}
+}
+
+
+/**
+ * Set the graphical area parameters common to all rendering modes
+ */
+static void VIDEL_initLines(videl_lines_t *l, Uint16 *fvram, Uint8 *hvram,
+                            int nextline, int vw, int vbpp, int hscrolloffset)
+{
+	int i;
+
+	l->fvram = fvram;
+	l->hvram = hvram;
+	l->nextline = nextline;
+	l->scrpitch = HostScreen_getPitch();
+	l->scrbpp = HostScreen_getBpp();
+	l->scrfmt = HostScreen_getFormat();
+	l->vw = vw;
+	l->vbpp = vbpp;
+	l->hscrolloffset = hscrolloffset;
+	for (i = 0; i < 256; i++)
+		l->palette[i] = HostScreen_getPaletteColor(i);
+	l->dirty = NULL;
+}
+
+
+/**
+ * Find the graphical area lines whose Atari screen memory at 'base' was
+ * written since previous frame, and tell them to the host screen.
+ * Return true if instead everything, borders included, needs to be
+ * redrawn because rendering parameters changed.
+ */
+static bool VIDEL_setDirtyLines(videl_lines_t *l, Uint32 base, int vh, int lowBorderSize)
+{
+	Uint8 *dirty;
+	int stride = l->nextline * 2;
+	int linesize = ((l->vw + 15) & ~15) * l->vbpp / 8 + (l->hscrolloffset ? l->vbpp * 2 : 0);
+	int h, first, last, y;
+	bool full;
+
+	full = Screen_CheckFullUpdate() || vh != videl_prev.vh || base != videl_prev.base
+		|| lowBorderSize != videl_prev.lowBorderSize
+		|| bTTSampleHold != videl_prev.sampleHold
+		|| memcmp(l, &videl_prev.lines, sizeof(*l)) != 0;
+	videl_prev.lines = *l;
+	videl_prev.vh = vh;
+	videl_prev.base = base;
+	videl_prev.lowBorderSize = lowBorderSize;
+	videl_prev.sampleHold = bTTSampleHold;
+
+	if (!full && vh > videl_prev.dirtysize) {
+		dirty = realloc(videl_prev.dirty, vh);
+		if (dirty) {
+			videl_prev.dirty = dirty;
+			videl_prev.dirtysize = vh;
+		} else {
+			full = true;
+		}
+	}
+	if (!full) {
+		dirty = videl_prev.dirty;
+		first = vh;
+		last = -1;
+		for (h = 0; h < vh; h++) {
+			dirty[h] = STMemory_IsDirtyScreen(base + h * stride, linesize);
+			if (dirty[h]) {
+				if (h < first)
+					first = h;
+				last = h;
+			}
+		}
+		l->dirty = dirty;
+		y = (l->hvram - HostScreen_getVideoramAddress()) / l->scrpitch;
+		HostScreen_setDirtyLines(y + first, y + last + 1);
+	}
+	if (vh > 0)
+		STMemory_ClearDirtyScreen(base, (vh - 1) * stride + linesize);
+	return full;
+}
+
+
+/**
+ * Render graphical area lines 'first' to 'last' (excluded) in bitplane
+ * modes, without zoom
+ */
+static void VIDEL_renderPlanarLines(const videl_lines_t *l, int first, int last)
+{
+	int count = (l->vw+15) & ~15;		/* pixels per line */
+	Uint32 border = l->palette[0];
+	Uint8 *p2cline, *hvram_column;
+	const Uint8 *color;
+	int h, w;
+
+	/* One complete 16-pixel aligned planar 2 chunky line */
+	p2cline = malloc(count + 16);
+	if (!p2cline)
+		return;
+	color = p2cline + l->hscrolloffset;
+
+	for (h = first; h < last; h++) {
+		Uint8 *hvram_line = l->hvram + h * l->scrpitch;
+
+		if (l->dirty && !l->dirty[h])
+			continue;
+
+		VIDEL_planarLineToChunky(l, l->fvram + h * l->nextline, p2cline);
+
+		/* Left border first */
+		hvram_column = VIDEL_fillPixels(hvram_line, l->scrbpp, border, l->leftBorderSize);
+
+		/* Graphical area */
+		switch (l->scrbpp) {
+			case 1:
+				memcpy(hvram_column, color, count);
+				break;
+			case 2:
+				for (w = 0; w < count; w++)
+					((Uint16 *)hvram_column)[w] = l->palette[color[w]];
+				break;
+			case 4:
+				for (w = 0; w < count; w++)
+					((Uint32 *)hvram_column)[w] = l->palette[color[w]];
+				break;
+		}
+		hvram_column += count * l->scrbpp;
+
+		/* Right border */
+		VIDEL_fillPixels(hvram_column, l->scrbpp, border, l->rightBorderSize);
+
+		if (bTTSampleHold && l->scrbpp == 1)
+			VIDEL_sampleHold(hvram_line, l->vw);
+	}
+
+	free(p2cline);
+}
+
+
+/**
+ * Render graphical area lines 'first' to 'last' (excluded) in the Falcon
+ * high color mode, without zoom
+ */
+static void VIDEL_renderHicolorLines(const videl_lines_t *l, int first, int last)
+{
+	Uint32 border = l->palette[0];
+	Uint8 *hvram_column;
+	int h, w;
+
+	for (h = first; h < last; h++) {
+		const Uint16 *fvram_column = l->fvram + h * l->nextline;
+
+		if (l->dirty && !l->dirty[h])
+			continue;
+
+		/* Left border first */
+		hvram_column = VIDEL_fillPixels(l->hvram + h * l->scrpitch, l->scrbpp,
+		                                border, l->leftBorderSize);
+
+		/* Graphical area */
+		switch (l->scrbpp) {
+			case 1:
+				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
+				for (w = 0; w < l->vw; w++) {
+					int tmp = SDL_SwapBE16(fvram_column[w]);
+					hvram_column[w] = (((tmp>>13) & 7) << 5) + (((tmp>>8) & 7) << 2) + (((tmp>>2) & 3));
+				}
+				break;
+			case 2:
+				VIDEL_copyHicolorLine((Uint16 *)hvram_column, fvram_column, l->vw);
+				break;
+			case 4:
+				for (w = 0; w < l->vw; w++) {
+					Uint16 srcword = fvram_column[w];
+					((Uint32 *)hvram_column)[w] = SDL_MapRGB(l->scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
+				}
+				break;
+		}
+		hvram_column += l->vw * l->scrbpp;
+
+		/* Right border */
+		VIDEL_fillPixels(hvram_column, l->scrbpp, border, l->rightBorderSize);
+	}
+}
+
+
+/**
+ * Render zoomed graphical area lines 'first' to 'last' (excluded)
+ * in bitplane modes
+ */
+static void VIDEL_renderPlanarZoomLines(const videl_lines_t *l, int first, int last)
+{
+	const int *zoomxtable = videl_zoom.zoomxtable;
+	int count = l->vw * l->coefx;		/* host pixels per line */
+	int cursrcline = -1;
+	Uint32 border = l->palette[0];
+	Uint8 *p2cline, *hvram_column;
+	const Uint8 *color;
+	int h, w;
+
+	/* One complete 16-pixel aligned planar 2 chunky line */
+	p2cline = malloc(((l->vw+15) & ~15) + 16);
+	if (!p2cline)
+		return;
+	color = p2cline + l->hscrolloffset;
+
+	for (h = first; h < last; h++) {
+		Uint8 *hvram_line = l->hvram + h * l->scrpitch;
+
+		/* Recopy the same line ? */
+		if (videl_zoom.zoomytable[h] == cursrcline) {
+			memcpy(hvram_line, hvram_line - l->scrpitch, l->scrwidth * l->scrbpp);
+			continue;
+		}
+		cursrcline = videl_zoom.zoomytable[h];
+
+		VIDEL_planarLineToChunky(l, l->fvram + cursrcline * l->nextline, p2cline);
+
+		/* Display the Left border */
+		hvram_column = VIDEL_fillPixels(hvram_line, l->scrbpp, border, l->leftBorderSize);
+
+		/* Display the Graphical area */
+		switch (l->scrbpp) {
+			case 1:
+				for (w = 0; w < count; w++)
+					hvram_column[w] = color[zoomxtable[w]];
+				break;
+			case 2:
+				for (w = 0; w < count; w++)
+					((Uint16 *)hvram_column)[w] = l->palette[color[zoomxtable[w]]];
+				break;
+			case 4:
+				for (w = 0; w < count; w++)
+					((Uint32 *)hvram_column)[w] = l->palette[color[zoomxtable[w]]];
+				break;
+		}
+		hvram_column += count * l->scrbpp;
+
+		/* Display the Right border */
+		VIDEL_fillPixels(hvram_column, l->scrbpp, border, l->rightBorderSize);
+
+		if (bTTSampleHold && l->scrbpp == 1)
+			VIDEL_sampleHold(hvram_line, count);
+	}
+
+	free(p2cline);
+}
+
+
+/**
+ * Render zoomed graphical area lines 'first' to 'last' (excluded)
+ * in the Falcon high color mode
+ */
+static void VIDEL_renderHicolorZoomLines(const videl_lines_t *l, int first, int last)
+{
+	const int *zoomxtable = videl_zoom.zoomxtable;
+	int count = l->vw * l->coefx;		/* host pixels per line */
+	int cursrcline = -1;
+	Uint32 border = l->palette[0];
+	Uint8 *hvram_column;
+	int h, w;
+
+	for (h = first; h < last; h++) {
+		Uint8 *hvram_line = l->hvram + h * l->scrpitch;
+		const Uint16 *fvram_column;
+
+		/* Recopy the same line ? */
+		if (videl_zoom.zoomytable[h] == cursrcline) {
+			memcpy(hvram_line, hvram_line - l->scrpitch, l->scrwidth * l->scrbpp);
+			continue;
+		}
+		cursrcline = videl_zoom.zoomytable[h];
+		fvram_column = l->fvram + cursrcline * l->nextline;
+
+		/* Display the Left border */
+		hvram_column = VIDEL_fillPixels(hvram_line, l->scrbpp, border, l->leftBorderSize);
+
+		/* Display the Graphical area */
+		switch (l->scrbpp) {
+			case 1:
+				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
+				for (w = 0; w < count; w++) {
+					Uint16 srcword = SDL_SwapBE16(fvram_column[zoomxtable[w]]);
+					Uint8 dstbyte;
+
+					dstbyte = ((srcword>>13) & 7) << 5;
+					dstbyte |= ((srcword>>8) & 7) << 2;
+					dstbyte |= ((srcword>>2) & 3);
+					hvram_column[w] = dstbyte;
+				}
+				break;
+			case 2:
+				for (w = 0; w < count; w++)
+					((Uint16 *)hvram_column)[w] = SDL_SwapBE16(fvram_column[zoomxtable[w]]);
+				break;
+			case 4:
+				for (w = 0; w < count; w++) {
+					Uint16 srcword = fvram_column[zoomxtable[w]];
+					((Uint32 *)hvram_column)[w] = SDL_MapRGB(l->scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
+				}
+				break;
+		}
+		hvram_column += count * l->scrbpp;
+
+		/* Display the Right border */
+		VIDEL_fillPixels(hvram_column, l->scrbpp, border, l->rightBorderSize);
+	}
+}
+
+
+#if ENABLE_CONVERT_THREAD
+/**
+ * Band worker thread: render its band of each new frame given
+ * to VIDEL_renderLines(), until VIDEL_stopBands() is called.
+ */
+static void VIDEL_bandThread(void *data)
+{
+	int band = (int)(intptr_t)data;
+	const videl_lines_t *l;
+	Uint32 frame = 0;
+	int count;
+
+	slock_lock(videl_bands.lock);
+	for (;;) {
+		while (videl_bands.frame == frame && !videl_bands.quit)
+			scond_wait(videl_bands.cond, videl_bands.lock);
+		if (videl_bands.quit)
+			break;
+		frame = videl_bands.frame;
+		l = videl_bands.lines;
+		count = videl_bands.count;
+		slock_unlock(videl_bands.lock);
+
+		l->render(l, count * band / VIDEL_BANDS, count * (band+1) / VIDEL_BANDS);
+
+		slock_lock(videl_bands.lock);
+		videl_bands.done++;
+		scond_broadcast(videl_bands.cond);
+	}
+	slock_unlock(videl_bands.lock);
+}
+
+
+/**
+ * Stop the band worker threads and free their resources
+ */
+static void VIDEL_stopBands(void)
+{
+	int i;
+
+	if (videl_bands.lock && videl_bands.cond) {
+		slock_lock(videl_bands.lock);
+		videl_bands.quit = true;
+		scond_broadcast(videl_bands.cond);
+		slock_unlock(videl_bands.lock);
+	}
+	for (i = 0; i < VIDEL_BANDS-1; i++) {
+		if (videl_bands.thread[i])
+			sthread_join(videl_bands.thread[i]);
+		videl_bands.thread[i] = NULL;
+	}
+	if (videl_bands.cond)
+		scond_free(videl_bands.cond);
+	if (videl_bands.lock)
+		slock_free(videl_bands.lock);
+	videl_bands.cond = NULL;
+	videl_bands.lock = NULL;
+	videl_bands.quit = false;
+	videl_bands.frame = 0;
+}
+
+
+/**
+ * Create the band worker threads if they don't exist yet,
+ * return true if they're available
+ */
+static bool VIDEL_startBands(void)
+{
+	int i;
+
+	if (videl_bands.lock)
+		return true;
+	if (videl_bands.failed)
+		return false;
+
+	videl_bands.lock = slock_new();
+	videl_bands.cond = scond_new();
+	for (i = 0; i < VIDEL_BANDS-1 && videl_bands.lock && videl_bands.cond; i++) {
+		videl_bands.thread[i] = sthread_create(VIDEL_bandThread, (void *)(intptr_t)(i+1));
+		if (!videl_bands.thread[i])
+			break;
+	}
+	if (i < VIDEL_BANDS-1) {
+		Log_Printf(LOG_WARN, "Failed to create Videl rendering threads.\n");
+		VIDEL_stopBands();
+		videl_bands.failed = true;
+		return false;
+	}
+	return true;
+}
+#endif /* ENABLE_CONVERT_THREAD */
+
+
+/**
+ * Render the 'count' lines of the graphical area.  When the frontend
+ * converts frames in a thread, the lines are split in bands rendered
+ * in parallel by the worker threads and this one.
+ */
+static void VIDEL_renderLines(const videl_lines_t *l, int count)
+{
+#if ENABLE_CONVERT_THREAD
+	if (count >= VIDEL_BANDS && Screen_ConvertThreaded() && VIDEL_startBands()) {
+		slock_lock(videl_bands.lock);
+		videl_bands.lines = l;
+		videl_bands.count = count;
+		videl_bands.done = 0;
+		videl_bands.frame++;
+		scond_broadcast(videl_bands.cond);
+		slock_unlock(videl_bands.lock);
+
+		l->render(l, 0, count / VIDEL_BANDS);
+
+		slock_lock(videl_bands.lock);
+		while (videl_bands.done < VIDEL_BANDS-1)
+			scond_wait(videl_bands.cond, videl_bands.lock);
+		slock_unlock(videl_bands.lock);
+		return;
+	}
+#endif
+	l->render(l, 0, count);
+}
+
+
+/**
+ * Free the Videl rendering resources
+ */
+void VIDEL_UnInit(void)
+{
+#if ENABLE_CONVERT_THREAD
+	VIDEL_stopBands();
+#endif
+	free(videl_prev.dirty);
+	videl_prev.dirty = NULL;
+	videl_prev.dirtysize = 0;
+	videl_prev.vh = -1;
+}
+
 
 void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 {
 	int scrpitch = HostScreen_getPitch();
-	int h, w, j;
+	int scrbpp = HostScreen_getBpp();
 
-	Uint16 *fvram = (Uint16 *) Atari2HostAddr(videl.videoBaseAddr);
-	Uint16 *fvram_line;
+	Uint32 base = videl.videoBaseAddr;
+	Uint16 *fvram = (Uint16 *) Atari2HostAddr(base);
 	Uint8 *hvram = HostScreen_getVideoramAddress();
-	SDL_PixelFormat *scrfmt = HostScreen_getFormat();
+	videl_lines_t lines;
+	bool full;
 
 	Uint16 lowBorderSize, rightBorderSize;
 	int scrwidth, scrheight;
@@ -1128,7 +1831,8 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 		videl.rightBorderSize = 0;
 		videl.upperBorderSize = 0;
 		videl.lowerBorderSize = 0;
-		fvram = (Uint16 *) Atari2HostAddr(VIDEL_getVideoramAddress());
+		base = VIDEL_getVideoramAddress();
+		fvram = (Uint16 *) Atari2HostAddr(base);
 	} else {
 		bTTSampleHold = false;
 	}
@@ -1139,7 +1843,7 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 	vw_clip = vw;
 	vh_clip = vh;
 	if (vw>scrwidth) vw_clip = scrwidth;
-	if (vh>scrheight) vh_clip = scrheight;	
+	if (vh>scrheight) vh_clip = scrheight;
 
 	/* If emulated computer is the FALCON, we must take :
 	 * vw = X area display size and not all the X screen with the borders into account
@@ -1153,7 +1857,7 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 	/* If there's not enough space to display the left border, just return */
 	if (vw_clip < videl.leftBorderSize)
 		return;
-	/* If there's not enough space for the left border + the graphic area, we clip */ 
+	/* If there's not enough space for the left border + the graphic area, we clip */
 	if (vw_clip < vw + videl.leftBorderSize) {
 		vw = vw_clip - videl.leftBorderSize;
 		rightBorderSize = 0;
@@ -1168,7 +1872,7 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 	if (vh_clip < videl.upperBorderSize)
 		return;
 
-	/* If there's not enough space for the upper border + the graphic area, we clip */ 
+	/* If there's not enough space for the upper border + the graphic area, we clip */
 	if (vh_clip < vh + videl.upperBorderSize) {
 		vh = vh_clip - videl.upperBorderSize;
 		lowBorderSize = 0;
@@ -1181,339 +1885,52 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 
 	/* Center screen */
 	hvram += ((scrheight-vh_clip)>>1)*scrpitch;
-	hvram += ((scrwidth-vw_clip)>>1)*HostScreen_getBpp();
+	hvram += ((scrwidth-vw_clip)>>1)*scrbpp;
 
-	fvram_line = fvram;
 	scrwidth = videl.leftBorderSize + vw + videl.rightBorderSize;
 
-	/* render the graphic area */
-	if (vbpp < 16) {
-		/* Bitplanes modes */
-
-		/* The SDL colors blitting... */
-		Uint8 color[16];
-
-		/* FIXME: The byte swap could be done here by enrolling the loop into 2 each by 8 pixels */
-		switch ( HostScreen_getBpp() ) {
-			case 1:
-			{
-				Uint8 *hvram_line = hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint8 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					memcpy(hvram_column, color+hscrolloffset, 16-hscrolloffset);
-					hvram_column += 16-hscrolloffset;
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						memcpy(hvram_column, color, 16);
-						hvram_column += 16;
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						memcpy(hvram_column, color, hscrolloffset);
-					}
-					/* Right border */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					if (bTTSampleHold) {
-						Uint8 TMPPixel = 0;
-						for (w=0; w < (vw); w++) {
-							if (hvram_line[w] == 0) {
-								hvram_line[w] = TMPPixel;
-							} else {
-								TMPPixel = hvram_line[w];
-							}
-						}
-					}
-
-					fvram_line += nextline;
-					hvram_line += scrpitch;
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint16 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					for (j = 0; j < 16 - hscrolloffset; j++) {
-						*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-					}
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						for (j=0; j<16; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-						}
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-						}
-					}
-					/* Right border */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint32 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					for (j = 0; j < 16 - hscrolloffset; j++) {
-						*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-					}
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						for (j=0; j<16; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-						}
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-						}
-					}
-					/* Right border */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
-		}
-
-	} else {
-
-		/* Falcon TC (High Color) */
-		switch ( HostScreen_getBpp() )  {
-			case 1:
-			{
-				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
-				Uint8 *hvram_line = hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint8 *hvram_column = hvram_line;
-					int tmp;
-
-					/* Left border first */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-
-					/* Graphical area */
-					for (w = 0; w < vw; w++) {
-						tmp = SDL_SwapBE16(*fvram_column++);
-						*hvram_column++ = (((tmp>>13) & 7) << 5) + (((tmp>>8) & 7) << 2) + (((tmp>>2) & 3));
-					}
-
-					/* Right border */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch;
-				}
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *hvram_column = hvram_line;
-#if SDL_BYTEORDER != SDL_BIG_ENDIAN
-					Uint16 *fvram_column;
-#endif
-					/* Left border first */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-					/* FIXME: here might be a runtime little/big video endian switch like:
-						if ( " videocard memory in Motorola endian format " false)
-					*/
-					memcpy(hvram_column, fvram_line, vw<<1);
-					hvram_column += vw<<1;
-#else
-					fvram_column = fvram_line;
-					/* Graphical area */
-					for (w = 0; w < vw; w++)
-						*hvram_column ++ = SDL_SwapBE16(*fvram_column++);
-#endif /* SDL_BYTEORDER == SDL_BIG_ENDIAN */
-
-					/* Right border */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint32 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
+	/* Set up the graphical area, zeroed for comparing with previous frame */
+	memset(&lines, 0, sizeof(lines));
+	VIDEL_initLines(&lines, fvram, hvram + videl.upperBorderSize * scrpitch,
+	                nextline, vw, vbpp, hscrolloffset);
+	lines.render = vbpp < 16 ? VIDEL_renderPlanarLines : VIDEL_renderHicolorLines;
+	lines.leftBorderSize = videl.leftBorderSize;
+	lines.rightBorderSize = rightBorderSize;
+	lines.coefx = 1;
+	lines.scrwidth = scrwidth;
+
+	/* Unless something else changed, render only the lines
+	 * whose screen memory was written to
+	 */
+	full = VIDEL_setDirtyLines(&lines, base, vh, lowBorderSize);
 
-					/* Graphical area */
-					for (w = 0; w < vw; w++) {
-						Uint16 srcword = *fvram_column++;
-						*hvram_column ++ = SDL_MapRGB(scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
-					}
+	/* Render the upper border */
+	if (full)
+		VIDEL_fillLines(hvram, scrpitch, scrbpp, scrwidth, videl.upperBorderSize);
 
-					/* Right border */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-				}
+	/* Render the graphical area */
+	VIDEL_renderLines(&lines, vh);
 
-				fvram_line += nextline;
-				hvram_line += scrpitch>>2;
-
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
-		}
-	}
+	/* Render the lower border */
+	if (full)
+		VIDEL_fillLines(lines.hvram + vh * scrpitch, scrpitch, scrbpp, scrwidth, lowBorderSize);
 }
 
 
 void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 {
-	int i, j, w, h, cursrcline;
+	int i;
 
 	Uint16 *fvram = (Uint16 *) Atari2HostAddr(videl.videoBaseAddr);
-	Uint16 *fvram_line;
-	Uint16 scrIdx = 0;
+	videl_lines_t lines;
 
 	int coefx = 1;
 	int coefy = 1;
 	int scrpitch, scrwidth, scrheight, scrbpp, hscrolloffset;
 	Uint8 *hvram;
-	SDL_PixelFormat *scrfmt;
+
+	/* Zoomed frames are always rendered fully, and so is the next unzoomed one */
+	videl_prev.vh = -1;
 
 	/* If emulated computer is the TT, we use the same rendering for display, but without the borders */
 	if (ConfigureParams.System.nMachineType == MACHINE_TT) {
@@ -1533,7 +1950,6 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 	scrwidth = HostScreen_getWidth();
 	scrheight = HostScreen_getHeight();
 	scrbpp = HostScreen_getBpp();
-	scrfmt = HostScreen_getFormat();
 	hvram = (Uint8 *) HostScreen_getVideoramAddress();
 
 	hscrolloffset = IoMem_ReadByte(0xff8265) & 0x0f;
@@ -1581,8 +1997,6 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 		videl_zoom.prev_scrheight = scrheight;
 	}
 
-	cursrcline = -1;
-
 	/* We reuse the following values to compute the display area size in zoom mode */
 	/* scrwidth must not change */
 	if (ConfigureParams.System.nMachineType == MACHINE_FALCON) {
@@ -1591,420 +2005,20 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 		scrheight = vh * coefy;
 	}
 
-	if (vbpp<16) {
-		Uint8 color[16];
-
-		/* Bitplanes modes */
-		switch(scrbpp) {
-			case 1:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint8 *p2cline = malloc(sizeof(Uint8) * ((vw+15) & ~15));
-				Uint8 *hvram_line = hvram;
-				Uint8 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-scrpitch, scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						memcpy(hvram_column, color+hscrolloffset, 16-hscrolloffset);
-						hvram_column += 16-hscrolloffset;
-						fvram_column += vbpp;
-						/* Convert main part of the new line */
-						for (w=1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							memcpy(hvram_column, color, 16);
-							hvram_column += 16;
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							memcpy(hvram_column, color, hscrolloffset);
-						}
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w - videl.leftBorderSize * coefx]];
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-
-						if (bTTSampleHold) {
-							Uint8 TMPPixel = 0;
-							for (w=0; w < (vw*coefx); w++) {
-								if (hvram_line[w] == 0) {
-									hvram_line[w] = TMPPixel;
-								} else {
-									TMPPixel = hvram_line[w];
-								}
-							}
-						}
-
-					}
-
-					hvram_line += scrpitch;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				free(p2cline);
-			}
-			break;
-			case 2:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint16 *p2cline = malloc(sizeof(Uint16) * ((vw+15) & ~15));
-				Uint16 *hvram_line = (Uint16 *)hvram;
-				Uint16 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>1), scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < 16 - hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-						}
-						fvram_column += vbpp;
-						/* Convert the main part of the new line */
-						for (w = 1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							for (j=0; j<16; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-							}
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the new line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							for (j = 0; j < hscrolloffset; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-							}
-						}
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w]];
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>1;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				free(p2cline);
-			}
-			break;
-			case 4:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint32 *p2cline = malloc(sizeof(Uint32) * ((vw+15) & ~15));
-				Uint32 *hvram_line = (Uint32 *)hvram;
-				Uint32 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>2), scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < 16 - hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-						}
-						fvram_column += vbpp;
-						/* Convert the main part of the new line */
-						for (w = 1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							for (j=0; j<16; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-							}
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the new line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							for (j = 0; j < hscrolloffset; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-							}
-						}
-
-						hvram_column = hvram_line;
-						/* Display the Left border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++) {
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w]];
-						}
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>2;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				free(p2cline);
-			}
-			break;
-		}
-	} else {
-		/* Falcon high-color (16-bit) mode */
-
-		switch(scrbpp) {
-			case 1:
-			{
-				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
-				Uint8 *hvram_line = hvram;
-				Uint8 *hvram_column = hvram_line;
+	/* Render the upper border */
+	hvram = VIDEL_fillLines(hvram, scrpitch, scrbpp, scrwidth, videl.upperBorderSize * coefy);
 
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
+	/* Render the graphical area */
+	VIDEL_initLines(&lines, fvram, hvram, nextline, vw, vbpp, hscrolloffset);
+	lines.render = vbpp < 16 ? VIDEL_renderPlanarZoomLines : VIDEL_renderHicolorZoomLines;
+	lines.leftBorderSize = videl.leftBorderSize * coefx;
+	lines.rightBorderSize = videl.rightBorderSize * coefx;
+	lines.coefx = coefx;
+	lines.scrwidth = scrwidth;
+	VIDEL_renderLines(&lines, scrheight);
 
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-scrpitch, scrwidth*scrbpp);
-					} else {
-
-						hvram_column = hvram_line;
-						/* Display the Left border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w = 0; w<(vw*coefx); w++) {
-							Uint16 srcword;
-							Uint8 dstbyte;
-							
-							srcword = SDL_SwapBE16(fvram_column[videl_zoom.zoomxtable[w - videl.leftBorderSize * coefx]]);
-
-							dstbyte = ((srcword>>13) & 7) << 5;
-							dstbyte |= ((srcword>>8) & 7) << 2;
-							dstbyte |= ((srcword>>2) & 3);
-							*hvram_column++ = dstbyte;
-						}
-
-						/* Display the Right border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-				Uint16 *hvram_column = hvram_line;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>1), scrwidth*scrbpp);
-					} else {
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							*hvram_column++ = SDL_SwapBE16(fvram_column[videl_zoom.zoomxtable[w]]);
-
-
-						/* Display the Right border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>1;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
-				Uint32 *hvram_column = hvram_line;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>2), scrwidth*scrbpp);
-						hvram_line += scrpitch>>2;
-					} else {
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w = 0; w<(vw*coefx); w++) {
-							Uint16 srcword;
-
-							srcword = fvram_column[videl_zoom.zoomxtable[w]];
-							*hvram_column++ = SDL_MapRGB(scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
-						}
-
-						/* Display the Right border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>2;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
-		}
-	}
+	/* Render the lower border */
+	VIDEL_fillLines(hvram + scrheight * scrpitch, scrpitch, scrbpp, scrwidth, videl.lowerBorderSize * coefy);
 }
 
 static void VIDEL_memset_uint32(Uint32 *addr, Uint32 color, int count)
@@ -2048,7 +2062,7 @@ void Videl_ColorReg_WriteWord(void)
 	Uint16 col;
 	Uint32 addr = IoAccessCurrentAddress;
 
-	videl.hostColorsSync = false;
+	VIDEL_ColorsChanged(0xff8240, 1);
 
 	if (bUseHighRes || bUseVDIRes)               /* Don't store if hi-res or VDI resolution */
 		return;
@@ -16,6 +16,7 @@ extern int nFrameSkips;
 extern bool VIDEL_renderScreen(void);
 
 extern void VIDEL_reset(void);
+extern void VIDEL_UnInit(void);
 
 extern void VIDEL_ZoomModeChanged(void);
 extern void VIDEL_ConvertScreenNoZoom(int vw, int vh, int bpp, int nextline);
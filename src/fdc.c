@@ -24,6 +24,7 @@ const char FDC_fileid[] = "Hatari fdc.c : " __DATE__ " " __TIME__;
 #include "fdc.h"
 #include "hdc.h"
 #include "floppy.h"
+#include "floppyJournal.h"
 #include "floppy_ipf.h"
 #include "floppy_stx.h"
 #include "ioMem.h"
@@ -34,10 +35,13 @@ const char FDC_fileid[] = "Hatari fdc.c : " __DATE__ " " __TIME__;
 #include "psg.h"
 #include "stMemory.h"
 #include "screen.h"
+#include "timeline.h"
 #include "video.h"
 #include "clocks_timings.h"
 #include "utils.h"
 #include "statusbar.h"
+#include "perfcount.h"
+#include "metrics.h"
 
 
 /*
@@ -439,6 +443,7 @@ static int FDC_StepRate_ms[] = { 6 , 12 , 2 , 3 };		/* Controlled by bits 1 and
 
 
 #define	FDC_FAST_FDC_FACTOR			10		/* Divide all delays by this value when --fastfdc is used */
+#define	FDC_TURBO_FDC_CYCLES			64		/* Max delay between 2 states when --turbo-fdc is used */
 
 /* Standard ST floppies are double density ; to simulate HD or ED floppies, we use */
 /* a density factor to have x2 or x4 bytes more during 1 FDC cycle */
@@ -542,6 +547,25 @@ static Uint8 DMADiskWorkSpace[ FDC_TRACK_BYTES_STANDARD*4+1000 ];/* Workspace us
 								/* We use a x4 factor when we need to simulate HD and ED too */
 
 
+/**
+ * Raw bytes of the tracks built by FDC_ReadTrack_ST() for ST/MSA images,
+ * so reading the same track again doesn't need to build all the gaps,
+ * ID fields and CRCs again.
+ * An entry is freed when a sector/track is written to this track, and
+ * all the entries of a drive are freed when a floppy is inserted/ejected.
+ */
+#define	FDC_TRACK_CACHE_TRACKS		256			/* Track numbers are 8 bits */
+
+typedef struct {
+	Uint8		*pData;					/* Bytes of the track, or NULL if not built yet */
+	int		Size;					/* Number of bytes in pData */
+	int		BytesPerTrack;				/* FDC_GetBytesPerTrack() when the track was built */
+} FDC_TRACK_CACHE_STRUCT;
+
+static FDC_TRACK_CACHE_STRUCT	FDC_TrackCache[ MAX_FLOPPYDRIVES ][ FDC_TRACK_CACHE_TRACKS ][ 2 ];
+static Uint8 FDC_TrackCache_WorkSpace[ FDC_TRACK_BYTES_STANDARD*4+1000 ];	/* To build a track before storing it in the cache */
+
+
 
 /*--------------------------------------------------------------*/
 /* Local functions prototypes					*/
@@ -550,13 +574,16 @@ static Uint8 DMADiskWorkSpace[ FDC_TRACK_BYTES_STANDARD*4+1000 ];/* Workspace us
 static Uint32	FDC_DelayToFdcCycles ( Uint32 Delay_micro );
 static Uint32	FDC_FdcCyclesToCpuCycles ( Uint32 FdcCycles );
 static Uint32	FDC_CpuCyclesToFdcCycles ( Uint32 CpuCycles );
-static void	FDC_StartTimer_FdcCycles ( int FdcCycles , int InternalCycleOffset );
+static void	FDC_StartTimer_FdcCycles ( int FdcCycles , Uint64 StartClock );
 static int	FDC_TransferByte_FdcCycles ( int NbBytes );
 static void	FDC_CRC16 ( Uint8 *buf , int nb , Uint16 *pCRC );
+static void	FDC_TrackCache_Free ( int Drive , int Track , int Side );
+static void	FDC_TrackCache_FreeDrive ( int Drive );
 
 static void	FDC_ResetDMA ( void );
 
 static int	FDC_GetEmulationMode ( void );
+static bool	FDC_TurboMode ( void );
 static void	FDC_UpdateAll ( void );
 static int	FDC_GetSectorsPerTrack ( int Drive , int Track , int Side );
 static int	FDC_GetSidesPerDisk ( int Drive , int Track );
@@ -628,6 +655,14 @@ void	FDC_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&FDC_BUFFER, sizeof(FDC_BUFFER_STRUCT));
 
 	MemorySnapShot_Store(DMADiskWorkSpace, sizeof(DMADiskWorkSpace));
+
+	if ( !bSave )
+	{
+		int	i;
+
+		for ( i=0 ; i<MAX_FLOPPYDRIVES ; i++ )
+			FDC_TrackCache_FreeDrive ( i );
+	}
 }
 
 
@@ -643,7 +678,10 @@ void	FDC_Drive_Set_BusyLed ( Uint8 STR )
 		return;						/* no drive selected */
 
 	if ( STR & FDC_STR_BIT_BUSY )
+	{
 		Statusbar_SetFloppyLed ( FDC.DriveSelSignal , LED_STATE_ON_BUSY );
+		M68000_TurboDiskAccess ();
+	}
 	else
 		Statusbar_SetFloppyLed ( FDC.DriveSelSignal , LED_STATE_ON );
 }
@@ -779,18 +817,23 @@ static Uint32	FDC_CpuCyclesToFdcCycles ( Uint32 CpuCycles )
 
 /*-----------------------------------------------------------------------*/
 /**
- * Start an internal timer to handle the FDC's events.
+ * Start an internal timer to handle the FDC's events, FdcCycles after
+ * the master clock value StartClock.
  * If "fast floppy" mode is used, we speed up the timer by dividing
  * the number of cycles by a fixed number.
  */
-static void	FDC_StartTimer_FdcCycles ( int FdcCycles , int InternalCycleOffset )
+static void	FDC_StartTimer_FdcCycles ( int FdcCycles , Uint64 StartClock )
 {
 //fprintf ( stderr , "fdc start timer %d cycles\n" , FdcCycles );
 
 	if ( ( ConfigureParams.DiskImage.FastFloppy ) && ( FdcCycles > FDC_FAST_FDC_FACTOR ) )
 		FdcCycles /= FDC_FAST_FDC_FACTOR;
 
-	CycInt_AddRelativeInterruptWithOffset ( FDC_FdcCyclesToCpuCycles ( FdcCycles ) , INT_CPU_CYCLE , INTERRUPT_FDC , InternalCycleOffset );
+	/* Don't shorten the motor stop sequence, it only counts index pulses */
+	if ( ( FdcCycles > FDC_TURBO_FDC_CYCLES ) && ( FDC.Command != FDCEMU_CMD_MOTOR_STOP ) && FDC_TurboMode() )
+		FdcCycles = FDC_TURBO_FDC_CYCLES;
+
+	CycInt_AddClockInterrupt ( StartClock + INT_CONVERT_TO_INTERNAL ( (Uint64)FDC_FdcCyclesToCpuCycles ( FdcCycles ) , INT_CPU_CYCLE ) , INTERRUPT_FDC );
 }
 
 
@@ -826,6 +869,40 @@ static void FDC_CRC16 ( Uint8 *buf , int nb , Uint16 *pCRC )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the cached bytes of a track built by FDC_ReadTrack_ST()
+ */
+static void FDC_TrackCache_Free ( int Drive , int Track , int Side )
+{
+	FDC_TRACK_CACHE_STRUCT	*pCache;
+
+	if ( ( Track < 0 ) || ( Track >= FDC_TRACK_CACHE_TRACKS ) || ( Side < 0 ) || ( Side > 1 ) )
+		return;
+
+	pCache = &FDC_TrackCache[ Drive ][ Track ][ Side ];
+	free ( pCache->pData );
+	pCache->pData = NULL;
+	pCache->Size = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the cached bytes of all the tracks of a drive
+ */
+static void FDC_TrackCache_FreeDrive ( int Drive )
+{
+	int	Track;
+
+	for ( Track=0 ; Track<FDC_TRACK_CACHE_TRACKS ; Track++ )
+	{
+		FDC_TrackCache_Free ( Drive , Track , 0 );
+		FDC_TrackCache_Free ( Drive , Track , 1 );
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Init variables used in FDC and DMA emulation
@@ -1018,6 +1095,7 @@ void	FDC_DMA_FIFO_Push ( Uint8 Byte )
 	Address = FDC_GetDMAAddress();
 	STMemory_SafeCopy ( Address , FDC_DMA.FIFO , FDC_DMA_FIFO_SIZE , "FDC DMA push to fifo" );
 	FDC_WriteDMAAddress ( Address + FDC_DMA_FIFO_SIZE );
+	Timeline_AddFdc ( FDC_DMA_FIFO_SIZE );
 	FDC_DMA.FIFO_Size = 0;						/* FIFO is now empty again */
 
 	/* Store the last word that was just transferred by the DMA */
@@ -1069,6 +1147,7 @@ Uint8	FDC_DMA_FIFO_Pull ( void )
 		Address = FDC_GetDMAAddress();
 		memcpy ( FDC_DMA.FIFO , &STRam[ Address ] , FDC_DMA_FIFO_SIZE );/* TODO : check we read from a valid RAM location ? */
 		FDC_WriteDMAAddress ( Address + FDC_DMA_FIFO_SIZE );
+		Timeline_AddFdc ( FDC_DMA_FIFO_SIZE );
 		FDC_DMA.FIFO_Size = FDC_DMA_FIFO_SIZE - 1;			/* FIFO is now full again (minus the byte we will return below) */
 
 		/* Store the last word that was just transferred by the DMA */
@@ -1222,6 +1301,29 @@ static int FDC_GetEmulationMode ( void )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if --turbo-fdc is enabled and the selected drive contains
+ * a disk image without any timing information (ST, MSA or DIM).
+ * In that case, we skip the spin up and search of the sector's ID field,
+ * we transfer each sector at once and all the other delays are limited
+ * to FDC_TURBO_FDC_CYCLES.
+ * STX and IPF images always use the accurate emulation, as they are mostly
+ * used for protected disks which depend on the real timings.
+ */
+static bool FDC_TurboMode ( void )
+{
+	int	ImageType;
+
+	if ( !ConfigureParams.DiskImage.TurboFloppy || ( FDC.DriveSelSignal < 0 )
+	  || ( !FDC_DRIVES[ FDC.DriveSelSignal ].DiskInserted ) )
+		return false;
+
+	ImageType = EmulationDrives[ FDC.DriveSelSignal ].ImageType;
+	return ( ImageType != FLOPPY_IMAGE_TYPE_STX ) && ( ImageType != FLOPPY_IMAGE_TYPE_IPF );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Update the FDC's internal variables on a regular basis.
@@ -1280,6 +1382,7 @@ void	FDC_InsertFloppy ( int Drive )
 
 	if ( ( Drive >= 0 ) && ( Drive < MAX_FLOPPYDRIVES ) )
 	{
+		FDC_TrackCache_FreeDrive ( Drive );
 		FDC_DRIVES[ Drive ].DiskInserted = true;
 		if ( ( FDC.STR & FDC_STR_BIT_MOTOR_ON ) != 0 )		/* If we insert a floppy while motor is already on, we must */
 			FDC_IndexPulse_Init ( Drive );			/* init the index pulse's position */
@@ -1301,6 +1404,7 @@ void	FDC_EjectFloppy ( int Drive )
 
 	if ( ( Drive >= 0 ) && ( Drive < MAX_FLOPPYDRIVES ) )
 	{
+		FDC_TrackCache_FreeDrive ( Drive );
 		FDC_DRIVES[ Drive ].DiskInserted = false;
 		FDC_DRIVES[ Drive ].IndexPulse_Time = 0;		/* Stop counting index pulses on an empty drive */
 	}
@@ -1371,20 +1475,15 @@ void	FDC_SetDriveSide ( Uint8 io_porta_old , Uint8 io_porta_new )
 /*-----------------------------------------------------------------------*/
 /**
  * Return the number of sectors for track/side for the current floppy in a drive
- * TODO [NP] : this function calls Floppy_FindDiskDetails which handles only ST/MSA
- * disk images so far, so this implies all tracks have in fact the same number
+ * TODO [NP] : this function uses the geometry from Floppy_UpdateDiskDetails which handles
+ * only ST/MSA disk images so far, so this implies all tracks have in fact the same number
  * of sectors (we don't use Track and Side for now)
  * Drive should be a valid drive (0 or 1)
  */
 static int FDC_GetSectorsPerTrack ( int Drive , int Track , int Side )
 {
-	Uint16	SectorsPerTrack;
-
 	if (EmulationDrives[ Drive ].bDiskInserted)
-	{
-		Floppy_FindDiskDetails ( EmulationDrives[ Drive ].pBuffer , EmulationDrives[ Drive ].nImageBytes , &SectorsPerTrack , NULL );
-		return SectorsPerTrack;
-	}
+		return EmulationDrives[ Drive ].nSectorsPerTrack;
 	else
 		return 0;
 }
@@ -1397,13 +1496,8 @@ static int FDC_GetSectorsPerTrack ( int Drive , int Track , int Side )
  */
 static int FDC_GetSidesPerDisk ( int Drive , int Track )
 {
-	Uint16	SidesPerDisk;
-
 	if (EmulationDrives[ Drive ].bDiskInserted)
-	{
-		Floppy_FindDiskDetails ( EmulationDrives[ Drive ].pBuffer , EmulationDrives[ Drive ].nImageBytes , NULL , &SidesPerDisk );
-		return SidesPerDisk;					/* 1 or 2 */
-	}
+		return EmulationDrives[ Drive ].nSides;			/* 1 or 2 */
 	else
 		return 0;
 }
@@ -1743,13 +1837,15 @@ void FDC_ClearIRQ ( void )
 void FDC_InterruptHandler_Update ( void )
 {
 	int	FdcCycles = 0;
-	int	PendingCyclesOver;
+	Uint64	EventClock;
 
-	/* Number of internal cycles we went over for this timer ( <= 0 ) */
+	/* Clock value when this timer was due (we can be late) */
 	/* Used to restart the next timer and keep a constant rate (important for DMA transfers) */
-	PendingCyclesOver = -PendingInterruptCount;			/* >= 0 */
+	EventClock = CycInt_GetInterruptClock ( INTERRUPT_FDC );
+
+	PERFCOUNT_BEGIN(PERFCOUNT_FDC, nPerfPrev);
 
-//fprintf ( stderr , "fdc int handler %lld delay %d\n" , CyclesGlobalClockCounter, PendingCyclesOver );
+//fprintf ( stderr , "fdc int handler %lld delay %d\n" , CyclesGlobalClockCounter, -PendingInterruptCount );
 
 	CycInt_AcknowledgeInterrupt();
 
@@ -1803,8 +1899,10 @@ void FDC_InterruptHandler_Update ( void )
 
 	if ( FDC.Command != FDCEMU_CMD_NULL )
 	{
-		FDC_StartTimer_FdcCycles ( FdcCycles , -PendingCyclesOver );
+		FDC_StartTimer_FdcCycles ( FdcCycles , EventClock );
 	}
+
+	PERFCOUNT_END(nPerfPrev);
 }
 
 
@@ -1837,6 +1935,7 @@ static void FDC_Update_STR ( Uint8 DisableBits , Uint8 EnableBits )
 	FDC.STR |= EnableBits;						/* Set bits in EnableBits */
 
 	FDC_Drive_Set_BusyLed ( FDC.STR );
+	Metrics_FdcBusy ( FDC.STR & FDC_STR_BIT_BUSY );
 //fprintf ( stderr , "fdc str 0x%x\n" , FDC.STR );
 }
 
@@ -1959,6 +2058,8 @@ static int FDC_UpdateMotorStop ( void )
 
 		FDC_Update_STR ( FDC_STR_BIT_MOTOR_ON , 0 );		/* Unset motor bit and keep spin up bit */
 		FDC.Command = FDCEMU_CMD_NULL;				/* Motor stopped, this is the last state */
+
+		FloppyJournal_FlushAll();				/* Disk access is over, journal the written sectors */
 		FdcCycles = 0;
 		break;
 	}
@@ -2527,6 +2628,9 @@ static int FDC_UpdateReadSectorsCmd ( void )
 	 case FDCEMU_RUN_READSECTORS_READDATA_TRANSFER_LOOP:
 		/* Transfer the sector 1 byte at a time using DMA */
 		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );		/* Add 1 byte to the DMA FIFO */
+		if ( FDC_TurboMode() )					/* Transfer the whole sector at once */
+			while ( FDC_BUFFER.PosRead < FDC_Buffer_Get_Size () )
+				FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );
 		if ( FDC_BUFFER.PosRead < FDC_Buffer_Get_Size () )
 		{
 			FdcCycles = FDC_Buffer_Read_Timing ();		/* Delay to transfer the next byte */
@@ -2726,6 +2830,12 @@ static int FDC_UpdateWriteSectorsCmd ( void )
 			Byte = FDC_DMA_FIFO_Pull ();			/* Get 1 byte from the DMA FIFO */
 //fprintf ( stderr , "byte %d %x\n" , FDC_DMA.BytesToTransfer , Byte );
 			FDC_Buffer_Add ( Byte );
+			if ( FDC_TurboMode() )				/* Transfer the whole sector at once */
+				while ( FDC_DMA.BytesToTransfer > 0 )
+				{
+					FDC_DMA.BytesToTransfer--;
+					FDC_Buffer_Add ( FDC_DMA_FIFO_Pull () );
+				}
 			FdcCycles = FDC_TransferByte_FdcCycles ( 1 );
 		}
 		else							/* Sector transferred, add the CRC */
@@ -2978,7 +3088,7 @@ static int FDC_UpdateReadTrackCmd ( void )
 				  nVBLs, FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC());
 
 			for ( i=0 ; i<FDC_GetBytesPerTrack ( FDC.DriveSelSignal ) ; i++ )
-				FDC_Buffer_Add ( rand() & 0xff );	/* Fill the track buffer with random bytes */
+				FDC_Buffer_Add ( Utils_Rand() & 0xff );	/* Fill the track buffer with random bytes */
 		}
 		else if ( EmulationDrives[ FDC.DriveSelSignal ].ImageType == FLOPPY_IMAGE_TYPE_STX )
 		{
@@ -3149,6 +3259,8 @@ static bool FDC_Set_MotorON ( Uint8 FDC_CR )
 
 		FDC_Update_STR ( FDC_STR_BIT_SPIN_UP , 0 );		/* Unset spin up bit */
 		FDC.IndexPulse_Counter = 0;				/* Reset counter to measure the spin up sequence */
+		if ( FDC_TurboMode() )
+			FDC.IndexPulse_Counter = FDC_DELAY_IP_SPIN_UP;	/* Spin up is already complete */
 		SpinUp = true;
 	}
 	else								/* No spin up : don't add delay to start the motor */
@@ -3544,6 +3656,8 @@ static int FDC_ExecuteTypeIICommands ( void )
 	FDC.CommandType = 2;
 	FDC.StatusTypeI = false;
 
+	Main_TurboBootEnd();			/* TOS reads the boot sector */
+
 	/* Check Type II Command */
 	switch ( FDC.CR & 0xf0 )
 	{
@@ -3655,7 +3769,7 @@ static void FDC_ExecuteCommand ( void )
 		FdcCycles = FDC_ExecuteTypeIVCommands();
 
 	FDC.ReplaceCommandPossible = true;				/* This new command can be replaced during the prepare+spinup phase */
-	FDC_StartTimer_FdcCycles ( FdcCycles , 0 );
+	FDC_StartTimer_FdcCycles ( FdcCycles , CycInt_GetClock() );
 }
 
 
@@ -4271,6 +4385,27 @@ static int	FDC_NextSectorID_FdcCycles_ST ( Uint8 Drive , Uint8 NumberOfHeads , U
 		NextSector = i+1;
 	}
 
+	if ( FDC_TurboMode() )
+	{
+		/* Don't wait for the disk to rotate : the next ID field is the sector */
+		/* we're looking for, if it exists. If the search/verify can't succeed, */
+		/* act as if the 5 revolutions were already done to abort with RNF */
+		if ( ( FDC.Command == FDCEMU_CMD_READSECTORS ) || ( FDC.Command == FDCEMU_CMD_WRITESECTORS ) )
+		{
+			if ( ( FDC.SR >= 1 ) && ( FDC.SR <= MaxSector ) && ( FDC.TR == Track ) )
+				NextSector = FDC.SR;
+			else
+				FDC.IndexPulse_Counter = FDC_DELAY_IP_ADDRESS_ID;
+			NbBytes = 0;
+		}
+		else if ( FDC.Command != FDCEMU_CMD_READADDRESS )	/* Type I verify */
+		{
+			if ( !FDC_VerifyTrack () )
+				FDC.IndexPulse_Counter = FDC_DELAY_IP_ADDRESS_ID;
+			NbBytes = 0;
+		}
+	}
+
 //fprintf ( stderr , "fdc bytes next sector pos=%d trpos=%d nbbytes=%d maxsr=%d nextsr=%d\n" , CurrentPos, TrackPos, NbBytes, MaxSector, NextSector );
 	FDC.NextSector_ID_Field_TR = Track;
 	FDC.NextSector_ID_Field_SR = NextSector;
@@ -4389,6 +4524,7 @@ static Uint8 FDC_WriteSector_ST ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 		SectorData[ i ] = FDC_Buffer_Read_Byte_pos ( i );
 
 	/* Write the sector's data */
+	FDC_TrackCache_Free ( Drive , Track , Side );
 	if ( Floppy_WriteSectors ( Drive, SectorData, Sector, Track, Side, 1, NULL, NULL ) )
 		return 0;						/* No error */
 
@@ -4448,97 +4584,140 @@ static Uint8 FDC_ReadAddress_ST ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 
 /*-----------------------------------------------------------------------*/
 /**
- * Read a track from a floppy image in ST format (used in type III command)
- * As ST images don't have gaps,sync,..., we compute a standard track based
- * on the current track/side.
- * Each byte of the track is added to the FDC buffer with a default timing
- * (32 microsec)
- * Always return 0 = OK (we fill the track buffer in all cases)
+ * Build the bytes of a standard track for a floppy image in ST format
+ * (gaps, sync, ID fields, sectors data and CRCs) into pBuf.
+ * Return the number of bytes in the track.
  */
-static Uint8 FDC_ReadTrack_ST ( Uint8 Drive , Uint8 Track , Uint8 Side )
+static int FDC_ReadTrack_ST_Build ( Uint8 Drive , Uint8 Track , Uint8 Side , Uint8 *pBuf )
 {
-	int	FrameCycles, HblCounterVideo, LineCycles;
-	Uint8	buf_id[ 10 ];						/* 3 SYNC + IAM + TR + SIDE + SECTOR + SIZE + CRC1 + CRC2 */
 	Uint8	*p;
+	Uint8	*pCRC;
 	Uint16	CRC;
 	int	Sector;
-	Uint8	*pSectorData;
+	Uint8	*pTrackData;
 	int	SectorSize;
+	int	BytesPerTrack;
 	int	i;
-	
-	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	bool	TrackOK;
 
-	LOG_TRACE(TRACE_FDC, "fdc type III read track drive=%d track=%d side=%d VBL=%d video_cyc=%d %d@%d pc=%x\n" ,
-		Drive, Track, Side, nVBLs , FrameCycles, LineCycles, HblCounterVideo , M68000_GetPC() );
+	/* Get the whole track at once, sectors are contiguous in ST images */
+	TrackOK = Floppy_ReadSectors ( Drive, &pTrackData, 1, Track, Side, -1, NULL, &SectorSize );
 
+	p = pBuf;
 
 	for ( i=0 ; i<FDC_TRACK_LAYOUT_STANDARD_GAP1 ; i++ )		/* GAP1 */
-		FDC_Buffer_Add ( 0x4e );
+		*p++ = 0x4e;
 
 	for ( Sector=1 ; Sector <= FDC_GetSectorsPerTrack ( Drive , Track , Side ) ; Sector++ )
 	{
 		for ( i=0 ; i<FDC_TRACK_LAYOUT_STANDARD_GAP2 ; i++ )	/* GAP2 */
-			FDC_Buffer_Add ( 0x00 );
+			*p++ = 0x00;
 
 		/* Add the ID field for the sector */
-		p = buf_id;
+		pCRC = p;
 		for ( i=0 ; i<3 ; i++ )		*p++ = 0xa1;		/* SYNC (write $F5) */
 		*p++ = 0xfe;						/* Index Address Mark */
 		*p++ = Track;						/* Track */
 		*p++ = Side;						/* Side */
 		*p++ = Sector;						/* Sector */
 		*p++ = FDC_SECTOR_SIZE_512;				/* 512 bytes/sector for ST/MSA */
-		FDC_CRC16 ( buf_id , 8 , &CRC );
+		FDC_CRC16 ( pCRC , 8 , &CRC );
 		*p++ = CRC >> 8;					/* CRC1 (write $F7) */
 		*p++ = CRC & 0xff;					/* CRC2 */
 
-		for ( i=0 ; i<10 ; i++ )				/* Add the ID field to the track data */
-			FDC_Buffer_Add ( buf_id[ i ] );
-
 		for ( i=0 ; i<FDC_TRACK_LAYOUT_STANDARD_GAP3a ; i++ )	/* GAP3a */
-			FDC_Buffer_Add ( 0x4e );
+			*p++ = 0x4e;
 		for ( i=0 ; i<FDC_TRACK_LAYOUT_STANDARD_GAP3b ; i++ )	/* GAP3b */
-			FDC_Buffer_Add ( 0x00 );
+			*p++ = 0x00;
 
 		/* Add the data for the sector + build the CRC */
-		crc16_reset ( &CRC );
+		pCRC = p;
 		for ( i=0 ; i<3 ; i++ )
-		{
-			FDC_Buffer_Add ( 0xa1 );			/* SYNC (write $F5) */
-			crc16_add_byte ( &CRC , 0xa1 );
-		}
-
-		FDC_Buffer_Add ( 0xfb );				/* Data Address Mark */
-		crc16_add_byte ( &CRC , 0xfb );
+			*p++ = 0xa1;					/* SYNC (write $F5) */
+		*p++ = 0xfb;						/* Data Address Mark */
 
-		if ( Floppy_ReadSectors ( Drive, &pSectorData, Sector, Track, Side, 1, NULL, &SectorSize ) )
+		if ( TrackOK )
 		{
-			for ( i=0 ; i<SectorSize ; i++ )
-			{
-				FDC_Buffer_Add ( pSectorData[ i ] );
-				crc16_add_byte ( &CRC , pSectorData[ i ] );
-			}
+			memcpy ( p , pTrackData + ( Sector - 1 ) * SectorSize , SectorSize );
+			p += SectorSize;
 		}
 		else
 		{
 			/* In case of error, we put some 0x00 bytes, but this case should */
 			/* not happen with ST/MSA disk images, all sectors should be present on each track */
-			for ( i=0 ; i<512 ; i++ )
-			{
-				FDC_Buffer_Add ( 0x00 );
-				crc16_add_byte ( &CRC , 0x00 );
-			}
+			memset ( p , 0x00 , 512 );
+			p += 512;
 		}
 
-		FDC_Buffer_Add ( CRC >> 8 );				/* CRC1 (write $F7) */
-		FDC_Buffer_Add ( CRC & 0xff );				/* CRC2 */
+		FDC_CRC16 ( pCRC , p - pCRC , &CRC );
+		*p++ = CRC >> 8;					/* CRC1 (write $F7) */
+		*p++ = CRC & 0xff;					/* CRC2 */
 
 		for ( i=0 ; i<FDC_TRACK_LAYOUT_STANDARD_GAP4 ; i++ )	/* GAP4 */
-			FDC_Buffer_Add ( 0x4e );
+			*p++ = 0x4e;
 	}
 
-	while ( FDC_Buffer_Get_Size () < FDC_GetBytesPerTrack ( Drive ) )	/* Complete the track buffer */
-	      FDC_Buffer_Add ( 0x4e );					/* GAP5 */
+	BytesPerTrack = FDC_GetBytesPerTrack ( Drive );
+	while ( p - pBuf < BytesPerTrack )				/* Complete the track buffer */
+		*p++ = 0x4e;						/* GAP5 */
+
+	return p - pBuf;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read a track from a floppy image in ST format (used in type III command)
+ * As ST images don't have gaps,sync,..., we compute a standard track based
+ * on the current track/side.
+ * The track's bytes are kept in FDC_TrackCache, so they're built only
+ * the first time the track is read (or after it was written).
+ * Each byte of the track is added to the FDC buffer with a default timing
+ * (32 microsec)
+ * Always return 0 = OK (we fill the track buffer in all cases)
+ */
+static Uint8 FDC_ReadTrack_ST ( Uint8 Drive , Uint8 Track , Uint8 Side )
+{
+	int	FrameCycles, HblCounterVideo, LineCycles;
+	FDC_TRACK_CACHE_STRUCT	*pCache;
+	Uint8	*pTrackBytes;
+	int	TrackSize;
+	Uint16	Timing;
+	int	i;
+
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+
+	LOG_TRACE(TRACE_FDC, "fdc type III read track drive=%d track=%d side=%d VBL=%d video_cyc=%d %d@%d pc=%x\n" ,
+		Drive, Track, Side, nVBLs , FrameCycles, LineCycles, HblCounterVideo , M68000_GetPC() );
+
+	pCache = ( Side <= 1 ) ? &FDC_TrackCache[ Drive ][ Track ][ Side ] : NULL;
+
+	if ( pCache && pCache->pData && ( pCache->BytesPerTrack == FDC_GetBytesPerTrack ( Drive ) ) )
+	{
+		pTrackBytes = pCache->pData;
+		TrackSize = pCache->Size;
+	}
+	else
+	{
+		pTrackBytes = FDC_TrackCache_WorkSpace;
+		TrackSize = FDC_ReadTrack_ST_Build ( Drive , Track , Side , pTrackBytes );
+
+		if ( pCache )
+		{
+			FDC_TrackCache_Free ( Drive , Track , Side );
+			pCache->pData = malloc ( TrackSize );
+			if ( pCache->pData )
+			{
+				memcpy ( pCache->pData , pTrackBytes , TrackSize );
+				pCache->Size = TrackSize;
+				pCache->BytesPerTrack = FDC_GetBytesPerTrack ( Drive );
+			}
+		}
+	}
+
+	Timing = FDC_TransferByte_FdcCycles ( 1 );
+	for ( i=0 ; i<TrackSize ; i++ )
+		FDC_Buffer_Add_Timing ( pTrackBytes[ i ] , Timing );
 
 	return 0;							/* No error */
 }
@@ -4568,6 +4747,8 @@ static Uint8 FDC_WriteTrack_ST ( Uint8 Drive , Uint8 Track , Uint8 Side , int Tr
 
 	Log_Printf(LOG_TODO, "FDC type III command 'write track' is not supported with ST/MSA files\n");
 
+	FDC_TrackCache_Free ( Drive , Track , Side );		/* Don't keep the bytes of a track being rewritten */
+
 	/* TODO : "Write track" should write all the sectors after extracting them from the track data ? */
 
 	/* Failed */
@@ -31,25 +31,31 @@ const char Floppy_fileid[] = "Hatari floppy.c : " __DATE__ " " __TIME__;
 #include "configuration.h"
 #include "file.h"
 #include "floppy.h"
+#include "floppyJournal.h"
 #include "gemdos.h"
 #include "hdc.h"
+#include "imageMap.h"
 #include "log.h"
 #include "memorySnapShot.h"
 #include "st.h"
 #include "msa.h"
 #include "dim.h"
+#include "diskPrefetch.h"
 #include "floppy_ipf.h"
 #include "floppy_stx.h"
 #include "zip.h"
 #include "screen.h"
 #include "video.h"
 #include "fdc.h"
+#include "stMemory.h"
 
 
 /* Emulation drive details, eg FileName, Inserted, Changed etc... */
 EMULATION_DRIVE EmulationDrives[MAX_FLOPPYDRIVES];
 /* Drive A is the default */
 int nBootDrive = 0;
+/* Last EMULATION_DRIVE.nImageId given to an inserted image */
+static Uint32 nLastImageId;
 
 
 /* Possible disk image file extensions to scan for */
@@ -97,6 +103,8 @@ void Floppy_Init(void)
 void Floppy_UnInit(void)
 {
 	Floppy_EjectBothDrives();
+	FloppyJournal_UnInit();
+	DiskPrefetch_UnInit();
 }
 
 
@@ -123,15 +131,45 @@ void Floppy_Reset(void)
  */
 void Floppy_MemorySnapShot_Capture(bool bSave)
 {
+	bool bLight = MemorySnapShot_IsLightweight();
+	Uint32 nImageId;
+	Uint8 bRefOnly;
 	int i;
 
 	/* If restoring then eject old drives first! */
-	if (!bSave)
+	if (!bSave && !bLight)
 		Floppy_EjectBothDrives();
 
 	/* Save/Restore details */
 	for (i = 0; i < MAX_FLOPPYDRIVES; i++)
 	{
+		/* Lightweight snapshots only refer to the inserted ST/MSA/DIM
+		 * image, like with hard disks its contents aren't rolled back.
+		 * IPF & STX keep part of their state in the image buffer */
+		if (bLight)
+		{
+			bRefOnly = EmulationDrives[i].ImageType != FLOPPY_IMAGE_TYPE_IPF
+				&& EmulationDrives[i].ImageType != FLOPPY_IMAGE_TYPE_STX;
+			MemorySnapShot_Store(&bRefOnly, sizeof(bRefOnly));
+			if (bRefOnly)
+			{
+				nImageId = EmulationDrives[i].nImageId;
+				MemorySnapShot_Store(&nImageId, sizeof(nImageId));
+				if (!bSave && nImageId != EmulationDrives[i].nImageId)
+				{
+					Log_Printf(LOG_WARN, "Floppy %c: image changed after the memory state was saved.\n", 'A'+i);
+					MemorySnapShot_SetError();
+				}
+				MemorySnapShot_Store(&EmulationDrives[i].TransitionState1,sizeof(EmulationDrives[i].TransitionState1));
+				MemorySnapShot_Store(&EmulationDrives[i].TransitionState1_VBL,sizeof(EmulationDrives[i].TransitionState1_VBL));
+				MemorySnapShot_Store(&EmulationDrives[i].TransitionState2,sizeof(EmulationDrives[i].TransitionState2));
+				MemorySnapShot_Store(&EmulationDrives[i].TransitionState2_VBL,sizeof(EmulationDrives[i].TransitionState2_VBL));
+				continue;
+			}
+			if (!bSave)
+				Floppy_EjectDiskFromDrive(i);
+		}
+
 		MemorySnapShot_Store(&EmulationDrives[i].ImageType, sizeof(EmulationDrives[i].ImageType));
 		MemorySnapShot_Store(&EmulationDrives[i].bDiskInserted, sizeof(EmulationDrives[i].bDiskInserted));
 		MemorySnapShot_Store(&EmulationDrives[i].nImageBytes, sizeof(EmulationDrives[i].nImageBytes));
@@ -140,7 +178,11 @@ void Floppy_MemorySnapShot_Capture(bool bSave)
 			EmulationDrives[i].pBuffer = malloc(EmulationDrives[i].nImageBytes);
 			if (!EmulationDrives[i].pBuffer)
 				perror("Floppy_MemorySnapShot_Capture");
+			EmulationDrives[i].nImageId = ++nLastImageId;
 		}
+		/* Lazily uncompressed MSA tracks must all be in the buffer */
+		if (bSave && EmulationDrives[i].ImageType == FLOPPY_IMAGE_TYPE_MSA)
+			MSA_AccessTracks(i, 0, EmulationDrives[i].nImageBytes, false);
 		if (EmulationDrives[i].pBuffer)
 			MemorySnapShot_Store(EmulationDrives[i].pBuffer, EmulationDrives[i].nImageBytes);
 		MemorySnapShot_Store(EmulationDrives[i].sFileName, sizeof(EmulationDrives[i].sFileName));
@@ -151,6 +193,10 @@ void Floppy_MemorySnapShot_Capture(bool bSave)
 		MemorySnapShot_Store(&EmulationDrives[i].TransitionState2,sizeof(EmulationDrives[i].TransitionState2));
 		MemorySnapShot_Store(&EmulationDrives[i].TransitionState2_VBL,sizeof(EmulationDrives[i].TransitionState2_VBL));
 
+		/* Geometry is not saved, compute it again from the restored image */
+		if ( !bSave && EmulationDrives[i].pBuffer )
+			Floppy_UpdateDiskDetails ( i );
+
 		/* Because Floppy_EjectBothDrives() was called above before restoring (which cleared */
 		/* FDC_DRIVES[].DiskInserted that was restored just before), we must call FDC_InsertFloppy */
 		/* for each restored drive with an inserted disk to set FDC_DRIVES[].DiskInserted=true */
@@ -496,7 +542,8 @@ int	Floppy_DriveTransitionUpdateState ( int Drive )
 /**
  * Insert previously set disk file image into floppy drive.
  * The WHOLE image is copied into Hatari drive buffers, and
- * uncompressed if necessary.
+ * uncompressed if necessary (tracks of .MSA files are uncompressed
+ * on first access).
  * Return TRUE on success, false otherwise.
  */
 bool Floppy_InsertDiskIntoDrive(int Drive)
@@ -520,11 +567,37 @@ bool Floppy_InsertDiskIntoDrive(int Drive)
 		return false;
 	}
 
+	/* Image may have been loaded in advance (only done for files, not for zip paths), */
+	/* but this copy is outdated if the image was saved in the background since */
+	if (FloppyJournal_WaitFile(filename))
+	{
+		free(DiskPrefetch_Take(filename, &nImageBytes, &ImageType));
+		nImageBytes = 0;
+		ImageType = FLOPPY_IMAGE_TYPE_NONE;
+	}
+	else if (!ConfigureParams.DiskImage.szDiskZipPath[Drive][0])
+		EmulationDrives[Drive].pBuffer = DiskPrefetch_Take(filename, &nImageBytes, &ImageType);
+
 	/* Check disk image type and read the file: */
-	if (MSA_FileNameIsMSA(filename, true))
-		EmulationDrives[Drive].pBuffer = MSA_ReadDisk(Drive, filename, &nImageBytes, &ImageType);
+	if (EmulationDrives[Drive].pBuffer)
+		Log_Printf(LOG_DEBUG, "Using disk image '%s' loaded in advance.\n", filename);
+	else if (MSA_FileNameIsMSA(filename, true))
+		EmulationDrives[Drive].pBuffer = MSA_Insert(Drive, filename, &nImageBytes, &ImageType);
 	else if (ST_FileNameIsST(filename, true))
-		EmulationDrives[Drive].pBuffer = ST_ReadDisk(Drive, filename, &nImageBytes, &ImageType);
+	{
+		/* Map raw images with the overlay, writes then stay in memory */
+		if (ConfigureParams.DiskImage.bDiskOverlay && ST_FileNameIsST(filename, false))
+		{
+			EmulationDrives[Drive].pBuffer = ImageMap_MapFile(filename, &nImageBytes);
+			if (EmulationDrives[Drive].pBuffer)
+			{
+				EmulationDrives[Drive].bMapped = true;
+				ImageType = FLOPPY_IMAGE_TYPE_ST;
+			}
+		}
+		if (!EmulationDrives[Drive].pBuffer)
+			EmulationDrives[Drive].pBuffer = ST_ReadDisk(Drive, filename, &nImageBytes, &ImageType);
+	}
 	else if (DIM_FileNameIsDIM(filename, true))
 		EmulationDrives[Drive].pBuffer = DIM_ReadDisk(Drive, filename, &nImageBytes, &ImageType);
 	else if (IPF_FileNameIsIPF(filename, true))
@@ -570,6 +643,8 @@ bool Floppy_InsertDiskIntoDrive(int Drive)
 	EmulationDrives[Drive].nImageBytes = nImageBytes;
 	EmulationDrives[Drive].bDiskInserted = true;
 	EmulationDrives[Drive].bContentsChanged = false;
+	EmulationDrives[Drive].nImageId = ++nLastImageId;
+	Floppy_UpdateDiskDetails(Drive);
 
 	if ( ( ImageType == FLOPPY_IMAGE_TYPE_ST ) || ( ImageType == FLOPPY_IMAGE_TYPE_MSA )
 	  || ( ImageType == FLOPPY_IMAGE_TYPE_DIM ) )
@@ -581,6 +656,9 @@ bool Floppy_InsertDiskIntoDrive(int Drive)
 	else
 		EmulationDrives[Drive].bOKToSave = false;
 
+	/* Journal the writes, and apply the ones left by a previous session */
+	FloppyJournal_Open(Drive);
+
 	Floppy_DriveTransitionSetState ( Drive , FLOPPY_DRIVE_TRANSITION_STATE_INSERT );
 	FDC_InsertFloppy ( Drive );
 
@@ -604,16 +682,25 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 	if (EmulationDrives[Drive].bDiskInserted)
 	{
 		bool bSaved = false;
+		bool bSaving = false;
 		char *psFileName = EmulationDrives[Drive].sFileName;
 
 		/* OK, has contents changed? If so, need to save */
-		if (EmulationDrives[Drive].bContentsChanged)
+		if (EmulationDrives[Drive].bContentsChanged && ConfigureParams.DiskImage.bDiskOverlay
+		    && ST_FileNameIsST(psFileName, false))
+		{
+			Log_Printf(LOG_INFO, "Disk overlay in use, discarded the contents of floppy image\n '%s'.", psFileName);
+		}
+		else if (EmulationDrives[Drive].bContentsChanged)
 		{
 			/* Is OK to save image (if boot-sector is bad, don't allow a save) */
 			if (EmulationDrives[Drive].bOKToSave)
 			{
+				/* Images with a journal are saved in the background */
+				if (FloppyJournal_SaveImage(Drive))
+					bSaving = true;
 				/* Save as .MSA, .ST, .DIM, .IPF or .STX image? */
-				if (MSA_FileNameIsMSA(psFileName, true))
+				else if (MSA_FileNameIsMSA(psFileName, true))
 					bSaved = MSA_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
 				else if (ST_FileNameIsST(psFileName, true))
 					bSaved = ST_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
@@ -627,12 +714,16 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 					bSaved = ZIP_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
 				if (bSaved)
 					Log_Printf(LOG_INFO, "Updated the contents of floppy image '%s'.", psFileName);
-				else
+				else if (!bSaving)
 					Log_Printf(LOG_INFO, "Writing of this format failed or not supported, discarded the contents\n of floppy image '%s'.", psFileName);
 			} else
 				Log_Printf(LOG_INFO, "Writing not possible, discarded the contents of floppy image\n '%s'.", psFileName);
 		}
 
+		/* Journal is not needed anymore once the image is saved (the background */
+		/* save removes it itself), but it's kept if the image could not be saved */
+		FloppyJournal_Close(Drive, !EmulationDrives[Drive].bContentsChanged || bSaved);
+
 		/* Inform user that disk has been ejected! */
 		Log_Printf(LOG_INFO, "Floppy %c: has been removed from drive.",
 			   'A'+Drive);
@@ -648,14 +739,21 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 	/* Free data used by this STX image */
 	else if ( EmulationDrives[Drive].ImageType == FLOPPY_IMAGE_TYPE_STX )
 		STX_Eject ( Drive );
+	/* Free compressed data kept for this MSA image */
+	else if ( EmulationDrives[Drive].ImageType == FLOPPY_IMAGE_TYPE_MSA )
+		MSA_Eject ( Drive );
 
 
 	/* Drive is now empty */
 	if (EmulationDrives[Drive].pBuffer != NULL)
 	{
-		free(EmulationDrives[Drive].pBuffer);
+		if (EmulationDrives[Drive].bMapped)
+			ImageMap_UnmapFile(EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
+		else
+			free(EmulationDrives[Drive].pBuffer);
 		EmulationDrives[Drive].pBuffer = NULL;
 	}
+	EmulationDrives[Drive].bMapped = false;
 
 	EmulationDrives[Drive].sFileName[0] = '\0';
 	EmulationDrives[Drive].ImageType = FLOPPY_IMAGE_TYPE_NONE;
@@ -663,6 +761,8 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 	EmulationDrives[Drive].bDiskInserted = false;
 	EmulationDrives[Drive].bContentsChanged = false;
 	EmulationDrives[Drive].bOKToSave = false;
+	EmulationDrives[Drive].nImageId = 0;
+	Floppy_UpdateDiskDetails(Drive);
 
 	return bEjected;
 }
@@ -778,10 +878,39 @@ void Floppy_FindDiskDetails(const Uint8 *pBuffer, int nImageBytes,
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Compute the geometry of the image in a drive once, instead of parsing the
+ * boot sector on each access. This must be called again each time the image
+ * or its boot sector changes (insert/eject, snapshot restore, write to the
+ * boot sector).
+ */
+void Floppy_UpdateDiskDetails(int Drive)
+{
+	EMULATION_DRIVE *pDrive = &EmulationDrives[Drive];
+
+	pDrive->nSectorsPerTrack = 0;
+	pDrive->nSides = 0;
+	pDrive->nImageTracks = 0;
+	pDrive->nBytesPerTrack = 0;
+
+	if (!pDrive->bDiskInserted || !pDrive->pBuffer || pDrive->nImageBytes < NUMBYTESPERSECTOR)
+		return;
+
+	if (pDrive->ImageType == FLOPPY_IMAGE_TYPE_MSA)
+		MSA_AccessTracks(Drive, 0, NUMBYTESPERSECTOR, false);
+	Floppy_FindDiskDetails(pDrive->pBuffer, pDrive->nImageBytes, &pDrive->nSectorsPerTrack, &pDrive->nSides);
+	pDrive->nBytesPerTrack = NUMBYTESPERSECTOR * pDrive->nSectorsPerTrack;
+	if (pDrive->nSectorsPerTrack && pDrive->nSides)
+		pDrive->nImageTracks = ((pDrive->nImageBytes / NUMBYTESPERSECTOR) / pDrive->nSectorsPerTrack) / pDrive->nSides;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Read sectors from floppy disk image, return TRUE if all OK
- * NOTE Pass -ve as Count to read whole track
+ * NOTE Pass -ve as Count to read whole track ; as sectors are stored
+ * contiguously, *pBuffer then points to the whole track (starting at Sector)
  */
 bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector,
                         Uint16 Track, Uint16 Side, short Count,
@@ -798,9 +927,10 @@ bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector,
 		/* Looks good */
 		pDiskBuffer = EmulationDrives[Drive].pBuffer;
 
-		/* Find #sides and #sectors per track */
-		Floppy_FindDiskDetails(EmulationDrives[Drive].pBuffer,EmulationDrives[Drive].nImageBytes,&nSectorsPerTrack,&nSides);
-		nImageTracks = ((EmulationDrives[Drive].nImageBytes / NUMBYTESPERSECTOR) / nSectorsPerTrack) / nSides;
+		/* Get #sides and #sectors per track */
+		nSectorsPerTrack = EmulationDrives[Drive].nSectorsPerTrack;
+		nSides = EmulationDrives[Drive].nSides;
+		nImageTracks = EmulationDrives[Drive].nImageTracks;
 
 		/* Need to read whole track? */
 		if (Count<0)
@@ -845,10 +975,13 @@ bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector,
 		}
 
 		/* Seek to sector */
-		nBytesPerTrack = NUMBYTESPERSECTOR*nSectorsPerTrack;
-		Offset = nBytesPerTrack*Side;                 /* First seek to side */
-		Offset += (nBytesPerTrack*nSides)*Track;      /* Then seek to track */
-		Offset += (NUMBYTESPERSECTOR*(Sector-1));     /* And finally to sector */
+		nBytesPerTrack = EmulationDrives[Drive].nBytesPerTrack;
+		Offset = nBytesPerTrack*(Track*nSides+Side);  /* First seek to track/side */
+		Offset += (NUMBYTESPERSECTOR*(Sector-1));     /* And then to sector */
+
+		/* MSA tracks are only uncompressed when first accessed */
+		if (EmulationDrives[Drive].ImageType == FLOPPY_IMAGE_TYPE_MSA)
+			MSA_AccessTracks(Drive, Offset, (long)Count*NUMBYTESPERSECTOR, false);
 
 		/* Return a pointer to the sectors data (usually 512 bytes per sector) */
 		*pBuffer = pDiskBuffer+Offset;
@@ -880,9 +1013,10 @@ bool Floppy_WriteSectors(int Drive, Uint8 *pBuffer, Uint16 Sector,
 		/* Looks good */
 		pDiskBuffer = EmulationDrives[Drive].pBuffer;
 
-		/* Find #sides and #sectors per track */
-		Floppy_FindDiskDetails(EmulationDrives[Drive].pBuffer,EmulationDrives[Drive].nImageBytes,&nSectorsPerTrack,&nSides);
-		nImageTracks = ((EmulationDrives[Drive].nImageBytes / NUMBYTESPERSECTOR) / nSectorsPerTrack) / nSides;
+		/* Get #sides and #sectors per track */
+		nSectorsPerTrack = EmulationDrives[Drive].nSectorsPerTrack;
+		nSides = EmulationDrives[Drive].nSides;
+		nImageTracks = EmulationDrives[Drive].nImageTracks;
 
 		/* Need to write whole track? */
 		if (Count<0)
@@ -925,18 +1059,83 @@ bool Floppy_WriteSectors(int Drive, Uint8 *pBuffer, Uint16 Sector,
 		}
 
 		/* Seek to sector */
-		nBytesPerTrack = NUMBYTESPERSECTOR*nSectorsPerTrack;
-		Offset = nBytesPerTrack*Side;               /* First seek to side */
-		Offset += (nBytesPerTrack*nSides)*Track;    /* Then seek to track */
-		Offset += (NUMBYTESPERSECTOR*(Sector-1));   /* And finally to sector */
+		nBytesPerTrack = EmulationDrives[Drive].nBytesPerTrack;
+		Offset = nBytesPerTrack*(Track*nSides+Side);  /* First seek to track/side */
+		Offset += (NUMBYTESPERSECTOR*(Sector-1));     /* And then to sector */
+
+		/* Partly written MSA tracks must be uncompressed first */
+		if (EmulationDrives[Drive].ImageType == FLOPPY_IMAGE_TYPE_MSA)
+			MSA_AccessTracks(Drive, Offset, (long)Count*NUMBYTESPERSECTOR, true);
 
 		/* Write sectors (usually 512 bytes per sector) */
 		memcpy(pDiskBuffer+Offset, pBuffer, (int)Count*NUMBYTESPERSECTOR);
 		/* And set 'changed' flag */
 		EmulationDrives[Drive].bContentsChanged = true;
+		FloppyJournal_MarkDirty(Drive, Offset, (long)Count*NUMBYTESPERSECTOR);
+
+		/* Geometry comes from the boot sector, update it if it was written */
+		if (Offset == 0)
+			Floppy_UpdateDiskDetails(Drive);
 
 		return true;
 	}
 
 	return false;
 }
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Serve a floppy sector read or write requested through the BIOS/XBIOS
+ * directly between the disk image and ST RAM at 'Addr', when --floppy-hle
+ * is enabled. This is done only for ST, MSA and DIM images and for
+ * requests that TOS would complete without error ; anything else returns
+ * false and is left to TOS, which drives the emulated FDC and produces
+ * the real error codes. The sectors have to be within one track.
+ */
+bool Floppy_AccessSectorsHLE(int Drive, bool bWrite, Uint32 Addr, Uint16 Sector,
+                             Uint16 Track, Uint16 Side, int Count)
+{
+	EMULATION_DRIVE *pDrive;
+	Uint8 *pSectors;
+	Uint32 nBytes;
+
+	if (!ConfigureParams.DiskImage.bFloppyHLE || Drive < 0 || Drive >= MAX_FLOPPYDRIVES)
+		return false;
+	if (!(Drive == 0 ? ConfigureParams.DiskImage.EnableDriveA : ConfigureParams.DiskImage.EnableDriveB))
+		return false;
+
+	pDrive = &EmulationDrives[Drive];
+	if (!pDrive->bDiskInserted
+	    || (pDrive->ImageType != FLOPPY_IMAGE_TYPE_ST && pDrive->ImageType != FLOPPY_IMAGE_TYPE_MSA
+	        && pDrive->ImageType != FLOPPY_IMAGE_TYPE_DIM))
+		return false;
+
+	/* Only requests which succeed on a real drive */
+	if (Count <= 0 || Sector == 0 || Sector + Count - 1 > pDrive->nSectorsPerTrack
+	    || Side >= pDrive->nSides || Track >= pDrive->nImageTracks
+	    || Side >= (Drive == 0 ? ConfigureParams.DiskImage.DriveA_NumberOfHeads
+	                           : ConfigureParams.DiskImage.DriveB_NumberOfHeads))
+		return false;
+	nBytes = Count * NUMBYTESPERSECTOR;
+	if (Addr >= STRamEnd || nBytes > STRamEnd - Addr)
+		return false;
+
+	if (bWrite)
+	{
+		if (!Floppy_WriteSectors(Drive, &STRam[Addr], Sector, Track, Side, Count, NULL, NULL))
+			return false;
+		FloppyJournal_FlushAll();
+	}
+	else
+	{
+		if (!Floppy_ReadSectors(Drive, &pSectors, Sector, Track, Side, Count, NULL, NULL))
+			return false;
+		memcpy(&STRam[Addr], pSectors, nBytes);
+		STMemory_SetDirtyArea(Addr, nBytes);
+	}
+
+	LOG_TRACE(TRACE_FDC, "fdc hle %s drive=%d track=%d side=%d sector=%d count=%d addr=0x%x\n",
+	          bWrite ? "write" : "read", Drive, Track, Side, Sector, Count, Addr);
+	return true;
+}
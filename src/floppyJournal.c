@@ -0,0 +1,850 @@
+/*
+  Hatari - floppyJournal.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Journal of the sectors written to floppy images, and background saving
+  of the modified images.
+
+  Floppy_WriteSectors() marks the written sectors in a bitmap, and each
+  time the FDC stops the drive motor (the emulated program is done with
+  the disk), the dirty sectors are appended as one batch to a journal file
+  next to the image ("<image>.journal"). If a journal is found when the
+  image is inserted again (Hatari did not exit cleanly), its batches are
+  applied to the image in memory, which is then marked as changed.
+
+  Modified images are written in the background when they are ejected,
+  and also while they are inserted when the journal gets bigger than the
+  image. The journal is removed once the image is saved.
+
+  All the file writes are done in order by a single writer thread, or
+  directly without thread support.
+
+  Journal format (values are 32 bit big endian) :
+    header : "HJNL" , version , size and mtime of the image file
+    batch  : "BTCH" , nb of sectors , { sector number , 512 bytes } , CRC32
+  A batch with a bad CRC (incomplete write) and the ones after it are
+  ignored.
+
+  Only .ST and .MSA images (not in a ZIP file, not mapped with the disk
+  overlay) use a journal, as the other formats can't be written back.
+*/
+const char FloppyJournal_fileid[] = "Hatari floppyJournal.c : " __DATE__ " " __TIME__;
+
+#include <sys/stat.h>
+
+#include "main.h"
+#include "configuration.h"
+#include "file.h"
+#include "floppy.h"
+#include "floppyJournal.h"
+#include "log.h"
+#include "msa.h"
+#include "st.h"
+#include "utils.h"
+
+#if HAVE_FSYNC
+#include <unistd.h>
+#endif
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+#define JOURNAL_THREAD 1
+#endif
+
+#define JOURNAL_VERSION		1
+#define JOURNAL_HEADER_SIZE	16
+#define JOURNAL_BATCH_HEADER_SIZE	8
+#define JOURNAL_RECORD_SIZE	(4 + NUMBYTESPERSECTOR)
+
+enum
+{
+	JOURNAL_JOB_APPEND,			/* append a batch to the journal */
+	JOURNAL_JOB_SAVE,			/* save the image, then remove the journal */
+	JOURNAL_JOB_REMOVE			/* remove the journal */
+};
+
+typedef struct journal_job
+{
+	struct journal_job *next;
+	int Type;
+	int Drive;
+	char *pszImageName;
+	char *pszJournalName;
+	Uint8 *pData;				/* batch to append, or image to save */
+	long nDataSize;
+} journal_job_t;
+
+typedef struct journal_name
+{
+	struct journal_name *next;
+	char *name;
+} journal_name_t;
+
+typedef struct
+{
+	char *pszJournalName;			/* NULL if the drive has no journal */
+	Uint8 *pDirty;				/* bitmap of the sectors written since last flush */
+	int nSectors;
+	long nJournalBytes;			/* journal size since the image was saved */
+	bool bFailed;				/* writing the journal failed */
+} JOURNAL_DRIVE;
+
+static JOURNAL_DRIVE JournalDrives[MAX_FLOPPYDRIVES];
+
+static struct
+{
+#if JOURNAL_THREAD
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;				/* signaled when a job is queued or done */
+	bool busy;				/* a job is running */
+	bool quit;
+	bool failedInit;			/* thread creation failed, don't retry */
+#endif
+	journal_job_t *pFirst, *pLast;		/* jobs waiting for the thread */
+	journal_name_t *pSaved;			/* images saved by a job, see FloppyJournal_WaitFile() */
+} writer;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Lock/unlock the variables shared with the writer thread
+ */
+static void FloppyJournal_Lock(void)
+{
+#if JOURNAL_THREAD
+	if (writer.lock)
+		slock_lock(writer.lock);
+#endif
+}
+
+static void FloppyJournal_Unlock(void)
+{
+#if JOURNAL_THREAD
+	if (writer.lock)
+		slock_unlock(writer.lock);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read/write 32 bit big endian values
+ */
+static Uint32 FloppyJournal_GetU32(const Uint8 *p)
+{
+	return ((Uint32)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void FloppyJournal_PutU32(Uint8 *p, Uint32 val)
+{
+	p[0] = val >> 24;
+	p[1] = val >> 16;
+	p[2] = val >> 8;
+	p[3] = val;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compute the CRC32 of 'nb' bytes
+ */
+static Uint32 FloppyJournal_CRC32(const Uint8 *buf, long nb)
+{
+	Uint32 CRC;
+	long i;
+
+	crc32_reset(&CRC);
+	for (i = 0; i < nb; i++)
+		crc32_add_byte(&CRC, buf[i]);
+	return CRC;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Fill the journal header for the image file 'pszImageName'
+ */
+static void FloppyJournal_BuildHeader(Uint8 *pHeader, const char *pszImageName)
+{
+	struct stat st;
+
+	if (stat(pszImageName, &st) != 0)
+		memset(&st, 0, sizeof(st));
+
+	memcpy(pHeader, "HJNL", 4);
+	FloppyJournal_PutU32(pHeader + 4, JOURNAL_VERSION);
+	FloppyJournal_PutU32(pHeader + 8, st.st_size);
+	FloppyJournal_PutU32(pHeader + 12, st.st_mtime);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Append a batch to the journal file (and create it if needed), and wait
+ * until it is written to the disk. On error, the journal is removed and
+ * its drive stops using it.
+ */
+static void FloppyJournal_Append(journal_job_t *job)
+{
+	Uint8 Header[JOURNAL_HEADER_SIZE];
+	Uint8 CRC[4];
+	bool bNew, bOK;
+	FILE *fp;
+	int i;
+
+	/* Don't add batches after a failed one, they would be ignored anyway */
+	FloppyJournal_Lock();
+	bOK = !JournalDrives[job->Drive].bFailed || !JournalDrives[job->Drive].pszJournalName
+	      || strcmp(JournalDrives[job->Drive].pszJournalName, job->pszJournalName) != 0;
+	FloppyJournal_Unlock();
+	if (!bOK)
+		return;
+
+	bNew = !File_Exists(job->pszJournalName);
+	fp = fopen(job->pszJournalName, "ab");
+	bOK = (fp != NULL);
+	if (bOK && bNew)
+	{
+		FloppyJournal_BuildHeader(Header, job->pszImageName);
+		bOK = (fwrite(Header, sizeof(Header), 1, fp) == 1);
+	}
+	if (bOK)
+	{
+		/* CRC covers all the batch after its "BTCH" id */
+		FloppyJournal_PutU32(CRC, FloppyJournal_CRC32(job->pData + 4, job->nDataSize - 4));
+		bOK = (fwrite(job->pData, job->nDataSize, 1, fp) == 1
+		       && fwrite(CRC, sizeof(CRC), 1, fp) == 1 && fflush(fp) == 0);
+#if HAVE_FSYNC
+		if (bOK)
+			fsync(fileno(fp));
+#endif
+	}
+	if (fp && fclose(fp) != 0)
+		bOK = false;
+
+	if (bOK)
+		return;
+
+	Log_Printf(LOG_WARN, "Can't write floppy journal '%s', the changes are only kept in memory.\n",
+		   job->pszJournalName);
+	remove(job->pszJournalName);
+
+	FloppyJournal_Lock();
+	for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+	{
+		if (JournalDrives[i].pszJournalName
+		    && strcmp(JournalDrives[i].pszJournalName, job->pszJournalName) == 0)
+			JournalDrives[i].bFailed = true;
+	}
+	FloppyJournal_Unlock();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save the image from the job buffer, and remove its journal which is
+ * not needed anymore
+ */
+static void FloppyJournal_Save(journal_job_t *job)
+{
+	journal_name_t *pSaved;
+	bool bSaved;
+
+	if (MSA_FileNameIsMSA(job->pszImageName, true))
+		bSaved = MSA_WriteDisk(-1, job->pszImageName, job->pData, job->nDataSize);
+	else
+		bSaved = ST_WriteDisk(-1, job->pszImageName, job->pData, job->nDataSize);
+
+	if (!bSaved)
+	{
+		Log_Printf(LOG_WARN, "Writing floppy image '%s' failed, its changes are kept in '%s'.\n",
+			   job->pszImageName, job->pszJournalName);
+		return;
+	}
+
+	remove(job->pszJournalName);
+	Log_Printf(LOG_INFO, "Updated the contents of floppy image '%s'.", job->pszImageName);
+
+	pSaved = malloc(sizeof(*pSaved));
+	if (pSaved)
+	{
+		pSaved->name = strdup(job->pszImageName);
+		FloppyJournal_Lock();
+		pSaved->next = writer.pSaved;
+		writer.pSaved = pSaved;
+		FloppyJournal_Unlock();
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Run a job and free it
+ */
+static void FloppyJournal_RunJob(journal_job_t *job)
+{
+	switch (job->Type)
+	{
+	 case JOURNAL_JOB_APPEND:
+		FloppyJournal_Append(job);
+		break;
+	 case JOURNAL_JOB_SAVE:
+		FloppyJournal_Save(job);
+		break;
+	 case JOURNAL_JOB_REMOVE:
+		remove(job->pszJournalName);
+		break;
+	}
+
+	free(job->pszImageName);
+	free(job->pszJournalName);
+	free(job->pData);
+	free(job);
+}
+
+
+#if JOURNAL_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Writer thread: run the queued jobs in order, until
+ * FloppyJournal_UnInit() is called and all the jobs are done.
+ */
+static void FloppyJournal_ThreadFunc(void *data)
+{
+	journal_job_t *job;
+
+	slock_lock(writer.lock);
+	for (;;)
+	{
+		if (!writer.pFirst)
+		{
+			if (writer.quit)
+				break;
+			scond_wait(writer.cond, writer.lock);
+			continue;
+		}
+
+		job = writer.pFirst;
+		writer.pFirst = job->next;
+		if (!writer.pFirst)
+			writer.pLast = NULL;
+		writer.busy = true;
+		slock_unlock(writer.lock);
+
+		FloppyJournal_RunJob(job);
+
+		slock_lock(writer.lock);
+		writer.busy = false;
+		scond_broadcast(writer.cond);
+	}
+	slock_unlock(writer.lock);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the writer thread if not done yet
+ */
+static void FloppyJournal_Start(void)
+{
+#if JOURNAL_THREAD
+	if (writer.thread || writer.failedInit)
+		return;
+
+	writer.lock = slock_new();
+	writer.cond = scond_new();
+	if (writer.lock && writer.cond)
+		writer.thread = sthread_create(FloppyJournal_ThreadFunc, NULL);
+
+	if (!writer.thread)
+	{
+		fprintf(stderr, "Failed to create floppy journal thread, images are saved at eject.\n");
+		if (writer.cond)
+			scond_free(writer.cond);
+		if (writer.lock)
+			slock_free(writer.lock);
+		writer.cond = NULL;
+		writer.lock = NULL;
+		writer.failedInit = true;
+	}
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue a new job for the writer thread (or run it now without thread).
+ * 'pData' is then owned by the job. Return false if the job could not be
+ * created (pData is not freed in that case).
+ */
+static bool FloppyJournal_Queue(int Type, int Drive, const char *pszImageName,
+                                const char *pszJournalName, Uint8 *pData, long nDataSize)
+{
+	journal_job_t *job;
+
+	job = calloc(1, sizeof(*job));
+	if (job)
+	{
+		job->pszImageName = strdup(pszImageName ? pszImageName : "");
+		job->pszJournalName = strdup(pszJournalName);
+	}
+	if (!job || !job->pszImageName || !job->pszJournalName)
+	{
+		perror("FloppyJournal_Queue");
+		if (job)
+		{
+			free(job->pszImageName);
+			free(job->pszJournalName);
+			free(job);
+		}
+		return false;
+	}
+	job->Type = Type;
+	job->Drive = Drive;
+	job->pData = pData;
+	job->nDataSize = nDataSize;
+
+#if JOURNAL_THREAD
+	if (writer.thread)
+	{
+		slock_lock(writer.lock);
+		if (writer.pLast)
+			writer.pLast->next = job;
+		else
+			writer.pFirst = job;
+		writer.pLast = job;
+		scond_broadcast(writer.cond);
+		slock_unlock(writer.lock);
+		return true;
+	}
+#endif
+	FloppyJournal_RunJob(job);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until all the queued jobs are done
+ */
+static void FloppyJournal_WaitJobs(void)
+{
+#if JOURNAL_THREAD
+	if (!writer.thread)
+		return;
+
+	slock_lock(writer.lock);
+	while (writer.pFirst || writer.busy)
+		scond_wait(writer.cond, writer.lock);
+	slock_unlock(writer.lock);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue the saving of the image in 'Drive' from 'pData' (a buffer owned
+ * by the job). The journal is removed after the image is written.
+ */
+static bool FloppyJournal_QueueSave(int Drive, Uint8 *pData)
+{
+	return FloppyJournal_Queue(JOURNAL_JOB_SAVE, Drive, EmulationDrives[Drive].sFileName,
+	                           JournalDrives[Drive].pszJournalName,
+	                           pData, EmulationDrives[Drive].nImageBytes);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Apply the batches of an existing journal to the image in 'Drive'
+ */
+static void FloppyJournal_Replay(int Drive)
+{
+	EMULATION_DRIVE *pDrv = &EmulationDrives[Drive];
+	JOURNAL_DRIVE *pJnl = &JournalDrives[Drive];
+	Uint8 Header[JOURNAL_HEADER_SIZE];
+	Uint8 *pJournal, *pRecord;
+	long nSize, Pos, End;
+	Uint32 nRecords, i, Sector;
+	int nReplayed = 0;
+	char *pszTmpName;
+	FILE *fp;
+
+	fp = fopen(pJnl->pszJournalName, "rb");
+	if (!fp)
+		return;					/* No journal */
+
+	fseek(fp, 0, SEEK_END);
+	nSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	pJournal = malloc(nSize > 0 ? nSize : 1);
+	if (!pJournal || fread(pJournal, 1, nSize, fp) != (size_t)nSize)
+	{
+		perror("FloppyJournal_Replay");
+		free(pJournal);
+		fclose(fp);
+		return;
+	}
+	fclose(fp);
+
+	/* The journal is only valid for the image file it was created with */
+	FloppyJournal_BuildHeader(Header, pDrv->sFileName);
+	if (nSize < JOURNAL_HEADER_SIZE || memcmp(pJournal, Header, JOURNAL_HEADER_SIZE) != 0)
+	{
+		Log_Printf(LOG_WARN, "Floppy journal '%s' does not match its image, ignoring it.\n",
+			   pJnl->pszJournalName);
+		remove(pJnl->pszJournalName);
+		free(pJournal);
+		return;
+	}
+
+	Pos = JOURNAL_HEADER_SIZE;
+	while (Pos + JOURNAL_BATCH_HEADER_SIZE <= nSize && memcmp(pJournal + Pos, "BTCH", 4) == 0)
+	{
+		nRecords = FloppyJournal_GetU32(pJournal + Pos + 4);
+		if (nRecords > (Uint32)((nSize - Pos) / JOURNAL_RECORD_SIZE))
+			break;
+		End = Pos + JOURNAL_BATCH_HEADER_SIZE + (long)nRecords * JOURNAL_RECORD_SIZE;
+		if (End + 4 > nSize || FloppyJournal_GetU32(pJournal + End)
+		    != FloppyJournal_CRC32(pJournal + Pos + 4, End - Pos - 4))
+			break;
+
+		pRecord = pJournal + Pos + JOURNAL_BATCH_HEADER_SIZE;
+		for (i = 0; i < nRecords; i++, pRecord += JOURNAL_RECORD_SIZE)
+		{
+			Sector = FloppyJournal_GetU32(pRecord);
+			if (Sector >= (Uint32)pJnl->nSectors)
+				continue;
+			if (pDrv->ImageType == FLOPPY_IMAGE_TYPE_MSA)
+				MSA_AccessTracks(Drive, (long)Sector * NUMBYTESPERSECTOR, NUMBYTESPERSECTOR, true);
+			memcpy(pDrv->pBuffer + (long)Sector * NUMBYTESPERSECTOR, pRecord + 4, NUMBYTESPERSECTOR);
+			nReplayed++;
+		}
+		Pos = End + 4;
+	}
+
+	/* Drop an incomplete batch at the end, so new batches can be added after the valid ones */
+	if (Pos < nSize)
+	{
+		pszTmpName = malloc(strlen(pJnl->pszJournalName) + 5);
+		if (pszTmpName)
+		{
+			sprintf(pszTmpName, "%s.tmp", pJnl->pszJournalName);
+			if (File_Save(pszTmpName, pJournal, Pos, false))
+			{
+				remove(pJnl->pszJournalName);
+				rename(pszTmpName, pJnl->pszJournalName);
+			}
+			free(pszTmpName);
+		}
+	}
+	free(pJournal);
+
+	pJnl->nJournalBytes = Pos;
+	if (nReplayed > 0)
+	{
+		pDrv->bContentsChanged = true;
+		Floppy_UpdateDiskDetails(Drive);
+		Log_Printf(LOG_INFO, "Applied %d sectors from floppy journal '%s'.", nReplayed, pJnl->pszJournalName);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start journaling the writes to the image just inserted in 'Drive', after
+ * applying the journal left by a previous session (if any)
+ */
+void FloppyJournal_Open(int Drive)
+{
+	EMULATION_DRIVE *pDrv = &EmulationDrives[Drive];
+	JOURNAL_DRIVE *pJnl = &JournalDrives[Drive];
+	char *pszJournalName;
+
+	FloppyJournal_Close(Drive, false);
+
+	if (!ConfigureParams.DiskImage.bDiskJournal || !pDrv->bDiskInserted
+	    || !pDrv->bOKToSave || pDrv->bMapped || pDrv->nImageBytes < NUMBYTESPERSECTOR)
+		return;
+	/* Writes to the disk overlay are discarded at eject anyway */
+	if (ConfigureParams.DiskImage.bDiskOverlay && ST_FileNameIsST(pDrv->sFileName, false))
+		return;
+	/* Images in a ZIP file can't be written back */
+	if ((pDrv->ImageType != FLOPPY_IMAGE_TYPE_MSA || !MSA_FileNameIsMSA(pDrv->sFileName, true))
+	    && (pDrv->ImageType != FLOPPY_IMAGE_TYPE_ST || !ST_FileNameIsST(pDrv->sFileName, true)))
+		return;
+
+	pJnl->nSectors = pDrv->nImageBytes / NUMBYTESPERSECTOR;
+	pJnl->pDirty = calloc((pJnl->nSectors + 7) / 8, 1);
+	pszJournalName = malloc(strlen(pDrv->sFileName) + 9);
+	if (!pJnl->pDirty || !pszJournalName)
+	{
+		perror("FloppyJournal_Open");
+		free(pJnl->pDirty);
+		free(pszJournalName);
+		pJnl->pDirty = NULL;
+		return;
+	}
+	sprintf(pszJournalName, "%s.journal", pDrv->sFileName);
+
+	FloppyJournal_Start();
+
+	FloppyJournal_Lock();
+	pJnl->pszJournalName = pszJournalName;
+	pJnl->bFailed = false;
+	FloppyJournal_Unlock();
+	pJnl->nJournalBytes = 0;
+
+	FloppyJournal_Replay(Drive);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Mark the sectors covering 'nBytes' bytes at 'Offset' in the disk buffer
+ * of 'Drive' as written
+ */
+void FloppyJournal_MarkDirty(int Drive, long Offset, long nBytes)
+{
+	JOURNAL_DRIVE *pJnl = &JournalDrives[Drive];
+	long Sector, LastSector;
+
+	if (!pJnl->pDirty || Offset < 0 || nBytes <= 0)
+		return;
+
+	LastSector = (Offset + nBytes - 1) / NUMBYTESPERSECTOR;
+	if (LastSector >= pJnl->nSectors)
+		LastSector = pJnl->nSectors - 1;
+	for (Sector = Offset / NUMBYTESPERSECTOR; Sector <= LastSector; Sector++)
+		pJnl->pDirty[Sector >> 3] |= 1 << (Sector & 7);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Append the sectors written in 'Drive' since the last flush to its journal.
+ * When the journal gets bigger than the image, the image is saved in
+ * the background, which restarts the journal.
+ */
+static void FloppyJournal_Flush(int Drive)
+{
+	EMULATION_DRIVE *pDrv = &EmulationDrives[Drive];
+	JOURNAL_DRIVE *pJnl = &JournalDrives[Drive];
+	Uint8 *pBatch, *pRecord, *pCopy;
+	long nBatchSize;
+	int Sector, nDirty = 0;
+	bool bFailed;
+
+	if (!pJnl->pszJournalName)
+		return;
+
+	FloppyJournal_Lock();
+	bFailed = pJnl->bFailed;
+	FloppyJournal_Unlock();
+	if (bFailed)
+	{
+		FloppyJournal_Close(Drive, true);	/* also removes batches queued before the failure */
+		return;
+	}
+
+	for (Sector = 0; Sector < pJnl->nSectors; Sector++)
+	{
+		if (pJnl->pDirty[Sector >> 3] & (1 << (Sector & 7)))
+			nDirty++;
+	}
+	if (nDirty == 0)
+		return;
+
+	nBatchSize = JOURNAL_BATCH_HEADER_SIZE + (long)nDirty * JOURNAL_RECORD_SIZE;
+	pBatch = malloc(nBatchSize);
+	if (!pBatch)
+	{
+		perror("FloppyJournal_Flush");
+		return;
+	}
+	memcpy(pBatch, "BTCH", 4);
+	FloppyJournal_PutU32(pBatch + 4, nDirty);
+	pRecord = pBatch + JOURNAL_BATCH_HEADER_SIZE;
+	for (Sector = 0; Sector < pJnl->nSectors; Sector++)
+	{
+		if (!(pJnl->pDirty[Sector >> 3] & (1 << (Sector & 7))))
+			continue;
+		FloppyJournal_PutU32(pRecord, Sector);
+		memcpy(pRecord + 4, pDrv->pBuffer + (long)Sector * NUMBYTESPERSECTOR, NUMBYTESPERSECTOR);
+		pRecord += JOURNAL_RECORD_SIZE;
+	}
+	memset(pJnl->pDirty, 0, (pJnl->nSectors + 7) / 8);
+
+	if (!FloppyJournal_Queue(JOURNAL_JOB_APPEND, Drive, pDrv->sFileName,
+	                         pJnl->pszJournalName, pBatch, nBatchSize))
+	{
+		free(pBatch);
+		return;
+	}
+	pJnl->nJournalBytes += nBatchSize + 4;
+
+	/* Journal is getting big, save the image from a copy of the buffer */
+	/* (bContentsChanged is kept, so it's saved again at eject if this fails) */
+	if (pJnl->nJournalBytes > pDrv->nImageBytes)
+	{
+		if (pDrv->ImageType == FLOPPY_IMAGE_TYPE_MSA)
+			MSA_AccessTracks(Drive, 0, pDrv->nImageBytes, false);
+		pCopy = malloc(pDrv->nImageBytes);
+		if (pCopy)
+		{
+			memcpy(pCopy, pDrv->pBuffer, pDrv->nImageBytes);
+			if (FloppyJournal_QueueSave(Drive, pCopy))
+				pJnl->nJournalBytes = 0;
+			else
+				free(pCopy);
+		}
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Flush the journal of all the drives. Called when the FDC stops the
+ * motor, as the emulated program is then done with the disk for now.
+ */
+void FloppyJournal_FlushAll(void)
+{
+	int i;
+
+	for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+		FloppyJournal_Flush(i);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save the modified image in 'Drive' in the background when it is ejected.
+ * The disk buffer is then owned by the writer (EmulationDrives[].pBuffer
+ * is set to NULL). Return false if the drive has no journal, in which case
+ * the image must be saved by the caller.
+ */
+bool FloppyJournal_SaveImage(int Drive)
+{
+	EMULATION_DRIVE *pDrv = &EmulationDrives[Drive];
+
+	FloppyJournal_Flush(Drive);
+	if (!JournalDrives[Drive].pszJournalName)
+		return false;
+
+	if (pDrv->ImageType == FLOPPY_IMAGE_TYPE_MSA)
+		MSA_AccessTracks(Drive, 0, pDrv->nImageBytes, false);
+	if (!FloppyJournal_QueueSave(Drive, pDrv->pBuffer))
+		return false;
+	pDrv->pBuffer = NULL;
+
+	Log_Printf(LOG_INFO, "Updating the contents of floppy image '%s' in the background.",
+		   pDrv->sFileName);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop journaling the writes to 'Drive'. If 'bRemove' is set, the
+ * journal file is also removed (after the pending writes).
+ */
+void FloppyJournal_Close(int Drive, bool bRemove)
+{
+	JOURNAL_DRIVE *pJnl = &JournalDrives[Drive];
+	char *pszJournalName = pJnl->pszJournalName;
+
+	if (!pszJournalName)
+		return;
+
+	if (bRemove)
+		FloppyJournal_Queue(JOURNAL_JOB_REMOVE, Drive, NULL, pszJournalName, NULL, 0);
+
+	FloppyJournal_Lock();
+	pJnl->pszJournalName = NULL;
+	FloppyJournal_Unlock();
+
+	free(pszJournalName);
+	free(pJnl->pDirty);
+	pJnl->pDirty = NULL;
+	pJnl->nSectors = 0;
+	pJnl->nJournalBytes = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until all the pending writes are done, before 'pszFileName' is
+ * inserted. Return true if this image was saved in the background since
+ * the last call (so a copy loaded before is outdated).
+ */
+bool FloppyJournal_WaitFile(const char *pszFileName)
+{
+	journal_name_t **ppSaved, *pSaved;
+	bool bSaved = false;
+
+	FloppyJournal_WaitJobs();
+
+	FloppyJournal_Lock();
+	ppSaved = &writer.pSaved;
+	while (*ppSaved)
+	{
+		pSaved = *ppSaved;
+		if (pSaved->name && strcmp(pSaved->name, pszFileName) == 0)
+		{
+			*ppSaved = pSaved->next;
+			free(pSaved->name);
+			free(pSaved);
+			bSaved = true;
+		}
+		else
+			ppSaved = &pSaved->next;
+	}
+	FloppyJournal_Unlock();
+
+	return bSaved;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish the pending writes and stop the writer thread
+ */
+void FloppyJournal_UnInit(void)
+{
+	journal_name_t *pSaved;
+	int i;
+
+	for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+		FloppyJournal_Close(i, false);
+
+#if JOURNAL_THREAD
+	if (writer.thread)
+	{
+		slock_lock(writer.lock);
+		writer.quit = true;
+		scond_broadcast(writer.cond);
+		slock_unlock(writer.lock);
+		sthread_join(writer.thread);
+		writer.thread = NULL;
+	}
+	if (writer.cond)
+		scond_free(writer.cond);
+	if (writer.lock)
+		slock_free(writer.lock);
+	writer.cond = NULL;
+	writer.lock = NULL;
+	writer.quit = false;
+#endif
+
+	while (writer.pSaved)
+	{
+		pSaved = writer.pSaved;
+		writer.pSaved = pSaved->next;
+		free(pSaved->name);
+		free(pSaved);
+	}
+}
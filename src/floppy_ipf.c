@@ -11,6 +11,13 @@
 
   RAW files made with KryoFlux board or CT RAW dumped with an Amiga are also handled
   by the capsimage library.
+
+  Decoded IPF tracks are copied into a small LRU cache per drive, so stepping
+  back and forth between tracks doesn't decode them again with CAPSLockTrack.
+  Tracks with weak bits ("flakey" tracks) are not cached, as each lock must
+  return new random bits, and neither are RAW/CTR images that have several
+  revolutions per track. When the heads step in one direction, the next
+  track is decoded in advance by a worker thread (libretro with threads only).
 */
 const char floppy_ipf_fileid[] = "Hatari floppy_ipf.c : " __DATE__ " " __TIME__;
 
@@ -35,6 +42,11 @@ const char floppy_ipf_fileid[] = "Hatari floppy_ipf.c : " __DATE__ " " __TIME__;
 #endif
 /* Macro to check release and revision */
 #define	CAPS_LIB_REL_REV	( CAPS_LIB_RELEASE * 100 + CAPS_LIB_REVISION )
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+#define	IPF_PREFETCH_THREAD
+#endif
 #endif
 
 
@@ -62,11 +74,55 @@ typedef struct
 static IPF_STRUCT	IPF_State;			/* All variables related to the IPF support */
 
 
+#ifdef HAVE_CAPSIMAGE
+#define	IPF_TRACK_CACHE_SIZE	8			/* Number of decoded tracks kept per drive */
+#define	IPF_PREFETCH_MAX	3			/* Number of tracks that can be requested per drive */
+
+#define	IPF_LOCK_FLAGS		( DI_LOCK_DENALT | DI_LOCK_DENVAR | DI_LOCK_UPDATEFD | DI_LOCK_TYPE )
+
+typedef struct
+{
+	int			Track;				/* -1 if entry is not used */
+	int			Side;
+	bool			Flakey;				/* Track has weak bits, it must be locked each time */
+	CapsULong		Type;
+	void			*pTrackBuf;			/* Copy of cti.trackbuf */
+	CapsULong		TrackLen;
+	void			*pTimeBuf;			/* Copy of cti.timebuf (density), NULL if none */
+	CapsULong		Overlap;
+	Uint32			LastUsed;
+} IPF_TRACK_CACHE_ENTRY;
+
+typedef struct
+{
+	IPF_TRACK_CACHE_ENTRY	Entry[ MAX_FLOPPYDRIVES ][ IPF_TRACK_CACHE_SIZE ];
+	bool			Enabled[ MAX_FLOPPYDRIVES ];	/* Cache can be used for the image in this drive */
+	int			InUse[ MAX_FLOPPYDRIVES ];	/* Entry given to the FDC with IPF_CallBack_Trk, -1 if none */
+	int			LastTrack[ MAX_FLOPPYDRIVES ];	/* To detect sequential steps */
+	Uint32			UseCounter;
+
+	int			PrefetchTrack[ MAX_FLOPPYDRIVES ][ IPF_PREFETCH_MAX ];	/* -1 if no request */
+	int			PrefetchSide[ MAX_FLOPPYDRIVES ][ IPF_PREFETCH_MAX ];
+#ifdef IPF_PREFETCH_THREAD
+	sthread_t		*Thread;
+	slock_t			*Lock;				/* Protects the cache and the capsimage track functions */
+	scond_t			*Cond;				/* Signaled when a track is requested */
+	bool			Quit;
+	bool			FailedInit;
+#endif
+} IPF_TRACK_CACHE;
+
+static IPF_TRACK_CACHE	IPF_Cache;			/* Not part of IPF_State, it's not saved in snapshots */
+#endif
+
+
 #ifdef HAVE_CAPSIMAGE
 static void	IPF_CallBack_Trk ( struct CapsFdc *pc , CapsULong State );
 static void	IPF_CallBack_Irq ( struct CapsFdc *pc , CapsULong State );
 static void	IPF_CallBack_Drq ( struct CapsFdc *pc , CapsULong State );
 static void	IPF_Drive_Update_Enable_Side ( void );
+static void	IPF_Cache_Init ( int Drive , bool Enabled );
+static void	IPF_Prefetch_Stop ( void );
 #endif
 
 
@@ -116,6 +172,11 @@ fprintf ( stderr , "ipf load %d\n" , StructSize );
 
 		if ( StructSize > 0 )
 		{
+#ifdef HAVE_CAPSIMAGE
+			/* Cached tracks are for the previous images, they're rebuilt by IPF_Insert */
+			for ( Drive=0 ; Drive < MAX_FLOPPYDRIVES ; Drive++ )
+				IPF_Cache_Init ( Drive , false );
+#endif
 			MemorySnapShot_Store(&IPF_State, sizeof(IPF_State));
 
 #ifdef HAVE_CAPSIMAGE
@@ -287,6 +348,9 @@ bool	IPF_Init ( void )
 
 	CAPSFdcReset ( &IPF_State.Fdc );
 
+	for ( i=0 ; i < MAX_FLOPPYDRIVES ; i++ )
+		IPF_Cache_Init ( i , false );
+
 	return true;
 #endif
 }
@@ -301,6 +365,12 @@ void	IPF_Exit ( void )
 {
 #ifndef HAVE_CAPSIMAGE
 #else
+	int	Drive;
+
+	IPF_Prefetch_Stop ();
+	for ( Drive=0 ; Drive < MAX_FLOPPYDRIVES ; Drive++ )
+		IPF_Cache_Init ( Drive , false );
+
 	CAPSExit();
 #endif
 }
@@ -319,6 +389,7 @@ bool	IPF_Insert ( int Drive , Uint8 *pImageBuffer , long ImageSize )
 #else
 	CapsLong	ImageId;
 	CapsLong	ImageType;
+	bool		CacheEnabled = true;
 
 	ImageId = CAPSAddImage();
 	if ( ImageId < 0 )
@@ -349,6 +420,10 @@ bool	IPF_Insert ( int Drive , Uint8 *pImageBuffer , long ImageSize )
 		default :		fprintf ( stderr , "NOT SUPPORTED\n" );
 					return false;
 	}
+
+	/* RAW/CTR tracks have several revolutions, each lock gives the next one */
+	if ( ImageType != citIPF )
+		CacheEnabled = false;
 #endif
 
 	if ( CAPSLockImageMemory ( ImageId , pImageBuffer , (CapsULong)ImageSize , DI_LOCK_MEMREF ) == imgeOk )
@@ -395,7 +470,9 @@ bool	IPF_Insert ( int Drive , Uint8 *pImageBuffer , long ImageSize )
 	}
 
 	
+	IPF_Cache_Init ( Drive , false );						/* Tracks of the previous image (if any) are not valid anymore */
 	IPF_State.CapsImage[ Drive ] = ImageId;
+	IPF_Cache_Init ( Drive , CacheEnabled );
 
 	IPF_State.Drive[ Drive ].diskattr |= CAPSDRIVE_DA_IN;				/* Disk inserted, keep the value for "write protect" */
 
@@ -423,6 +500,7 @@ bool	IPF_Eject ( int Drive )
 	fprintf ( stderr , "IPF : IPF_Eject drive=%d imageid=%d\n" , Drive , IPF_State.CapsImage[ Drive ] );
 
 	CAPSFdcInvalidateTrack ( &IPF_State.Fdc , Drive );				/* Invalidate previous buffered track data for drive, if any */
+	IPF_Cache_Init ( Drive , false );						/* Free the cached tracks and pending requests */
 
 	if ( CAPSUnlockImage ( IPF_State.CapsImage[ Drive ] ) < 0 )
 	{
@@ -461,6 +539,332 @@ void IPF_Reset ( void )
 
 
 
+#ifdef HAVE_CAPSIMAGE
+/*
+ * Lock/unlock the track cache, when the prefetch thread is used
+ */
+static void	IPF_Cache_Lock ( void )
+{
+#ifdef IPF_PREFETCH_THREAD
+	if ( IPF_Cache.Lock )
+		slock_lock ( IPF_Cache.Lock );
+#endif
+}
+
+static void	IPF_Cache_Unlock ( void )
+{
+#ifdef IPF_PREFETCH_THREAD
+	if ( IPF_Cache.Lock )
+		slock_unlock ( IPF_Cache.Lock );
+#endif
+}
+
+
+/*
+ * Free the cached tracks of a drive and cancel its prefetch requests.
+ * If Enabled is true, tracks of the image in this drive can then be cached.
+ */
+static void	IPF_Cache_Init ( int Drive , bool Enabled )
+{
+	IPF_TRACK_CACHE_ENTRY	*pEntry;
+	int	i;
+
+	IPF_Cache_Lock ();
+	for ( i=0 ; i < IPF_TRACK_CACHE_SIZE ; i++ )
+	{
+		pEntry = &IPF_Cache.Entry[ Drive ][ i ];
+		free ( pEntry->pTrackBuf );
+		free ( pEntry->pTimeBuf );
+		memset ( pEntry , 0 , sizeof ( *pEntry ) );
+		pEntry->Track = -1;
+	}
+	for ( i=0 ; i < IPF_PREFETCH_MAX ; i++ )
+		IPF_Cache.PrefetchTrack[ Drive ][ i ] = -1;
+
+	IPF_Cache.Enabled[ Drive ] = Enabled;
+	IPF_Cache.InUse[ Drive ] = -1;
+	IPF_Cache.LastTrack[ Drive ] = -1;
+	IPF_Cache_Unlock ();
+}
+
+
+/*
+ * Return the cache entry for Track/Side, or NULL if it's not cached yet
+ */
+static IPF_TRACK_CACHE_ENTRY	*IPF_Cache_Find ( int Drive , int Track , int Side )
+{
+	int	i;
+
+	for ( i=0 ; i < IPF_TRACK_CACHE_SIZE ; i++ )
+		if ( ( IPF_Cache.Entry[ Drive ][ i ].Track == Track ) && ( IPF_Cache.Entry[ Drive ][ i ].Side == Side ) )
+			return &IPF_Cache.Entry[ Drive ][ i ];
+	return NULL;
+}
+
+
+/*
+ * Decode Track/Side with CAPSLockTrack and store a copy of it in the cache,
+ * replacing the least recently used entry (but not the one used by the FDC).
+ * Flakey tracks are only recorded as such, without their data.
+ * Return the new entry, or NULL on error. Called with the cache lock held.
+ */
+static IPF_TRACK_CACHE_ENTRY	*IPF_Cache_Decode ( int Drive , int Track , int Side , struct CapsTrackInfoT1 *pcti )
+{
+	IPF_TRACK_CACHE_ENTRY	*pEntry = NULL;
+	int	i;
+
+	pcti->type = 1;
+	if ( CAPSLockTrack ( pcti , IPF_State.CapsImage[ Drive ] , Track , Side , IPF_LOCK_FLAGS ) != imgeOk )
+		return NULL;
+
+	for ( i=0 ; i < IPF_TRACK_CACHE_SIZE ; i++ )
+	{
+		if ( i == IPF_Cache.InUse[ Drive ] )
+			continue;
+		if ( ( pEntry == NULL ) || ( IPF_Cache.Entry[ Drive ][ i ].LastUsed < pEntry->LastUsed ) )
+			pEntry = &IPF_Cache.Entry[ Drive ][ i ];
+	}
+
+	free ( pEntry->pTrackBuf );
+	free ( pEntry->pTimeBuf );
+	memset ( pEntry , 0 , sizeof ( *pEntry ) );
+	pEntry->Track = Track;
+	pEntry->Side = Side;
+	pEntry->LastUsed = ++IPF_Cache.UseCounter;
+	pEntry->Type = pcti->type;
+
+	if ( pcti->type & CTIT_FLAG_FLAKEY )
+	{
+		pEntry->Flakey = true;					/* Keep it locked in the library, like without cache */
+		return pEntry;
+	}
+
+	pEntry->pTrackBuf = malloc ( pcti->tracklen * sizeof ( *pcti->trackbuf ) );
+	if ( pcti->timebuf )
+		pEntry->pTimeBuf = malloc ( pcti->timelen * sizeof ( *pcti->timebuf ) );
+	if ( ( pEntry->pTrackBuf == NULL ) || ( pcti->timebuf && ( pEntry->pTimeBuf == NULL ) ) )
+	{
+		free ( pEntry->pTrackBuf );				/* Use the library's buffers instead */
+		free ( pEntry->pTimeBuf );
+		memset ( pEntry , 0 , sizeof ( *pEntry ) );
+		pEntry->Track = -1;
+		return NULL;
+	}
+
+	memcpy ( pEntry->pTrackBuf , pcti->trackbuf , pcti->tracklen * sizeof ( *pcti->trackbuf ) );
+	if ( pcti->timebuf )
+		memcpy ( pEntry->pTimeBuf , pcti->timebuf , pcti->timelen * sizeof ( *pcti->timebuf ) );
+	pEntry->TrackLen = pcti->tracklen;
+	pEntry->Overlap = pcti->overlap;
+
+	CAPSUnlockTrack ( IPF_State.CapsImage[ Drive ] , Track , Side );	/* Free the library's copy */
+	return pEntry;
+}
+
+
+/*
+ * Get the data of Track/Side to give to the FDC, from the cache if possible.
+ * Return false if the track can't be locked. Called with the cache lock held.
+ */
+static bool	IPF_Cache_GetTrack ( int Drive , int Track , int Side , IPF_TRACK_CACHE_ENTRY *pTrk )
+{
+	IPF_TRACK_CACHE_ENTRY	*pEntry;
+	struct CapsTrackInfoT1	cti;
+	bool	Locked = false;
+
+	IPF_Cache.InUse[ Drive ] = -1;
+
+	if ( IPF_Cache.Enabled[ Drive ] )
+	{
+		pEntry = IPF_Cache_Find ( Drive , Track , Side );
+		if ( pEntry )
+			pEntry->LastUsed = ++IPF_Cache.UseCounter;
+		else
+		{
+			pEntry = IPF_Cache_Decode ( Drive , Track , Side , &cti );
+			Locked = ( pEntry != NULL );
+		}
+
+		if ( pEntry && !pEntry->Flakey )
+		{
+			IPF_Cache.InUse[ Drive ] = pEntry - IPF_Cache.Entry[ Drive ];
+			*pTrk = *pEntry;
+			return true;
+		}
+	}
+
+	/* Track is not cached : use the buffers of the library, locking it again */
+	/* for each access (this gives new weak bits / the next revolution) */
+	if ( !Locked )
+	{
+		cti.type = 1;
+		if ( CAPSLockTrack ( &cti , IPF_State.CapsImage[ Drive ] , Track , Side , IPF_LOCK_FLAGS ) != imgeOk )
+			return false;
+	}
+
+	memset ( pTrk , 0 , sizeof ( *pTrk ) );
+	pTrk->Type = cti.type;
+	pTrk->pTrackBuf = cti.trackbuf;
+	pTrk->pTimeBuf = cti.timebuf;
+	pTrk->TrackLen = cti.tracklen;
+	pTrk->Overlap = cti.overlap;
+	return true;
+}
+
+
+#ifdef IPF_PREFETCH_THREAD
+/*
+ * Take the next prefetch request, return false if there's none.
+ * Called with the cache lock held.
+ */
+static bool	IPF_Prefetch_Next ( int *pDrive , int *pTrack , int *pSide )
+{
+	int	Drive , i;
+
+	for ( Drive=0 ; Drive < MAX_FLOPPYDRIVES ; Drive++ )
+		for ( i=0 ; i < IPF_PREFETCH_MAX ; i++ )
+			if ( IPF_Cache.PrefetchTrack[ Drive ][ i ] >= 0 )
+			{
+				*pDrive = Drive;
+				*pTrack = IPF_Cache.PrefetchTrack[ Drive ][ i ];
+				*pSide = IPF_Cache.PrefetchSide[ Drive ][ i ];
+				IPF_Cache.PrefetchTrack[ Drive ][ i ] = -1;
+				return true;
+			}
+	return false;
+}
+
+
+/*
+ * Worker thread : decode the requested tracks into the cache,
+ * until IPF_Prefetch_Stop() is called.
+ */
+static void	IPF_Prefetch_ThreadFunc ( void *data )
+{
+	struct CapsTrackInfoT1	cti;
+	int	Drive , Track , Side;
+
+	slock_lock ( IPF_Cache.Lock );
+	while ( !IPF_Cache.Quit )
+	{
+		if ( !IPF_Prefetch_Next ( &Drive , &Track , &Side ) )
+		{
+			scond_wait ( IPF_Cache.Cond , IPF_Cache.Lock );
+			continue;
+		}
+
+		if ( IPF_Cache.Enabled[ Drive ] && !IPF_Cache_Find ( Drive , Track , Side ) )
+			IPF_Cache_Decode ( Drive , Track , Side , &cti );
+	}
+	slock_unlock ( IPF_Cache.Lock );
+}
+
+
+/*
+ * Start the worker thread if not done yet, return true if it's available
+ */
+static bool	IPF_Prefetch_Start ( void )
+{
+	if ( IPF_Cache.Thread )
+		return true;
+	if ( IPF_Cache.FailedInit )
+		return false;
+
+	/* Lock and cond are created before the thread, while the FDC doesn't use the cache */
+	IPF_Cache.Lock = slock_new ();
+	IPF_Cache.Cond = scond_new ();
+	if ( IPF_Cache.Lock && IPF_Cache.Cond )
+		IPF_Cache.Thread = sthread_create ( IPF_Prefetch_ThreadFunc , NULL );
+
+	if ( IPF_Cache.Thread == NULL )
+	{
+		fprintf ( stderr , "IPF : failed to create track prefetch thread\n" );
+		IPF_Prefetch_Stop ();
+		IPF_Cache.FailedInit = true;
+		return false;
+	}
+	return true;
+}
+#endif
+
+
+/*
+ * Stop the worker thread
+ */
+static void	IPF_Prefetch_Stop ( void )
+{
+#ifdef IPF_PREFETCH_THREAD
+	if ( IPF_Cache.Thread )
+	{
+		slock_lock ( IPF_Cache.Lock );
+		IPF_Cache.Quit = true;
+		scond_signal ( IPF_Cache.Cond );
+		slock_unlock ( IPF_Cache.Lock );
+		sthread_join ( IPF_Cache.Thread );
+		IPF_Cache.Thread = NULL;
+	}
+	if ( IPF_Cache.Cond )
+		scond_free ( IPF_Cache.Cond );
+	if ( IPF_Cache.Lock )
+		slock_free ( IPF_Cache.Lock );
+	IPF_Cache.Cond = NULL;
+	IPF_Cache.Lock = NULL;
+	IPF_Cache.Quit = false;
+#endif
+}
+
+
+/*
+ * After the FDC moved to Track/Side, request the tracks likely to be
+ * accessed next : the other side of this track, and the next track in
+ * the same direction if the heads are stepping sequentially.
+ */
+static void	IPF_Prefetch_Request ( int Drive , int Track , int Side )
+{
+#ifdef IPF_PREFETCH_THREAD
+	int	Step;
+	int	n = 0;
+
+	if ( !IPF_Cache.Enabled[ Drive ] )
+		return;
+
+	Step = Track - IPF_Cache.LastTrack[ Drive ];
+	IPF_Cache.LastTrack[ Drive ] = Track;
+	if ( ( Step != 1 ) && ( Step != -1 ) )
+		return;
+
+	if ( IPF_Cache.Thread == NULL )
+	{
+		if ( !IPF_Prefetch_Start () )
+			return;
+	}
+
+	slock_lock ( IPF_Cache.Lock );
+	if ( IPF_State.DoubleSided[ Drive ] )
+	{
+		IPF_Cache.PrefetchTrack[ Drive ][ n ] = Track;
+		IPF_Cache.PrefetchSide[ Drive ][ n++ ] = 1 - Side;
+	}
+	if ( Track + Step >= 0 )
+	{
+		IPF_Cache.PrefetchTrack[ Drive ][ n ] = Track + Step;
+		IPF_Cache.PrefetchSide[ Drive ][ n++ ] = Side;
+		if ( IPF_State.DoubleSided[ Drive ] )
+		{
+			IPF_Cache.PrefetchTrack[ Drive ][ n ] = Track + Step;
+			IPF_Cache.PrefetchSide[ Drive ][ n++ ] = 1 - Side;
+		}
+	}
+	while ( n < IPF_PREFETCH_MAX )
+		IPF_Cache.PrefetchTrack[ Drive ][ n++ ] = -1;
+	scond_signal ( IPF_Cache.Cond );
+	slock_unlock ( IPF_Cache.Lock );
+#endif
+}
+#endif
+
+
+
 
 /*
  * Callback function used when track is changed.
@@ -471,21 +875,26 @@ static void	IPF_CallBack_Trk ( struct CapsFdc *pc , CapsULong State )
 {
 	int	Drive = State;				/* State is the drive number in that case */
 	struct CapsDrive *pd = pc->drive+Drive;		/* Current drive where the track change occurred */
-	struct CapsTrackInfoT1 cti;
+	IPF_TRACK_CACHE_ENTRY Trk;
 
-	cti.type=1;
-	if ( CAPSLockTrack ( &cti , IPF_State.CapsImage[ Drive ] , pd->buftrack , pd->bufside ,
-			DI_LOCK_DENALT|DI_LOCK_DENVAR|DI_LOCK_UPDATEFD|DI_LOCK_TYPE ) != imgeOk )
+	IPF_Cache_Lock ();
+	if ( !IPF_Cache_GetTrack ( Drive , pd->buftrack , pd->bufside , &Trk ) )
+	{
+		IPF_Cache_Unlock ();
 		return;
+	}
+	IPF_Cache_Unlock ();
 
 	LOG_TRACE(TRACE_FDC, "fdc ipf callback trk drive=%d buftrack=%d bufside=%d VBL=%d HBL=%d\n" , Drive ,
 		  (int)pd->buftrack , (int)pd->bufside , nVBLs , nHBL );
 
-	pd->ttype	= cti.type;
-	pd->trackbuf	= cti.trackbuf;
-	pd->timebuf	= cti.timebuf;
-	pd->tracklen	= cti.tracklen;
-	pd->overlap	= cti.overlap;
+	pd->ttype	= Trk.Type;
+	pd->trackbuf	= Trk.pTrackBuf;
+	pd->timebuf	= Trk.pTimeBuf;
+	pd->tracklen	= Trk.TrackLen;
+	pd->overlap	= Trk.Overlap;
+
+	IPF_Prefetch_Request ( Drive , pd->buftrack , pd->bufside );
 }
 #endif
 
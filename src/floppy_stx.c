@@ -108,6 +108,7 @@ static void	STX_FreeSaveTracksStructAll ( STX_SAVE_TRACK_STRUCT *pSaveTracksStru
 static void	STX_FreeSaveTracksStruct ( STX_SAVE_TRACK_STRUCT *pSaveTracksStruct , int Nb );
 
 static void	STX_BuildSectorsSimple ( STX_TRACK_STRUCT *pStxTrack , Uint8 *p );
+static void	STX_BuildSectorsOrder ( STX_TRACK_STRUCT *pStxTrack );
 static Uint16	STX_BuildSectorID_CRC ( STX_SECTOR_STRUCT *pStxSector );
 static STX_TRACK_STRUCT	*STX_FindTrack ( Uint8 Drive , Uint8 Track , Uint8 Side );
 static STX_SECTOR_STRUCT *STX_FindSector ( Uint8 Drive , Uint8 Track , Uint8 Side , Uint8 SectorStruct_Nb );
@@ -916,20 +917,10 @@ static void	STX_WriteU32_BE ( Uint8 *p , Uint32 val )
 /*-----------------------------------------------------------------------*/
 /**
  * Free all the memory allocated to store an STX file
+ * (main, tracks and sectors structures are in the same block, see STX_BuildStruct)
  */
 static void	STX_FreeStruct ( STX_MAIN_STRUCT *pStxMain )
 {
-	int			Track;
-
-	if ( !pStxMain )
-		return;
-
-	for ( Track = 0 ; Track < pStxMain->TracksCount ; Track++ )
-	{
-		free ( (pStxMain->pTracksStruct[ Track ]).pSectorsStruct );
-	}
-
-	free ( pStxMain->pTracksStruct );
 	free ( pStxMain );
 }
 
@@ -1028,8 +1019,9 @@ static void	STX_FreeSaveTracksStruct ( STX_SAVE_TRACK_STRUCT *pSaveTracksStruct
 /*-----------------------------------------------------------------------*/
 /**
  * Parse an STX file.
- * The file is in pFileBuffer and we dynamically allocate memory to store
- * the components (main header, tracks, sectors).
+ * The file is in pFileBuffer and we allocate a single block of memory to store
+ * the components (main header, tracks, sectors, sorted sectors positions) ;
+ * fuzzy, timing and sector data are not copied, they point into pFileBuffer.
  * Some internal variables/pointers are also computed, to speed up
  * data access when the FDC emulates an STX file.
  */
@@ -1047,11 +1039,35 @@ STX_MAIN_STRUCT	*STX_BuildStruct ( Uint8 *pFileBuffer , int Debug )
 	Uint8			*pTimingData;
 	Uint32			MaxOffsetSectorEnd;
 	int			VariableTimings;
+	int			TracksCount;
+	int			SectorsTotal;
+	size_t			ArenaSize;
+	STX_SECTOR_STRUCT	*pNextSectors;
+	Sint32			*pNextPosition;
+	Uint16			*pNextOrder;
+
+	/* Count the sectors in all the track blocks, to allocate all the structures at once */
+	TracksCount = pFileBuffer[ 10 ];
+	SectorsTotal = 0;
+	p = pFileBuffer + STX_MAIN_BLOCK_SIZE;
+	for ( Track = 0 ; Track < TracksCount ; Track++ )
+	{
+		SectorsTotal += STX_ReadU16_LE ( p + 8 );
+		p += STX_ReadU32_LE ( p );
+	}
 
-	pStxMain = malloc ( sizeof ( STX_MAIN_STRUCT ) );
+	ArenaSize = sizeof ( STX_MAIN_STRUCT ) + sizeof ( STX_TRACK_STRUCT ) * TracksCount
+		+ ( sizeof ( STX_SECTOR_STRUCT ) + sizeof ( Sint32 ) + sizeof ( Uint16 ) ) * SectorsTotal;
+	pStxMain = malloc ( ArenaSize );
 	if ( !pStxMain )
 		return NULL;
-	memset ( pStxMain , 0 , sizeof ( STX_MAIN_STRUCT ) );
+	memset ( pStxMain , 0 , ArenaSize );
+	memset ( pStxMain->TrackIndex , 0xff , sizeof ( pStxMain->TrackIndex ) );	/* -1 for all tracks */
+
+	pStxTrack = (STX_TRACK_STRUCT *)( pStxMain + 1 );
+	pNextSectors = (STX_SECTOR_STRUCT *)( pStxTrack + TracksCount );
+	pNextPosition = (Sint32 *)( pNextSectors + SectorsTotal );
+	pNextOrder = (Uint16 *)( pNextPosition + SectorsTotal );
 
 	p = pFileBuffer;
 
@@ -1073,13 +1089,6 @@ STX_MAIN_STRUCT	*STX_BuildStruct ( Uint8 *pFileBuffer , int Debug )
 	pStxMain->WarnedWriteSector = false;
 	pStxMain->WarnedWriteTrack = false;
 
-	pStxTrack = malloc ( sizeof ( STX_TRACK_STRUCT ) * pStxMain->TracksCount );
-	if ( !pStxTrack )
-	{
-		STX_FreeStruct ( pStxMain );
-		return NULL;
-	}
-	memset ( pStxTrack , 0 , sizeof ( STX_TRACK_STRUCT ) * pStxMain->TracksCount );
 	pStxMain->pTracksStruct = pStxTrack;
 
 	/* Parse all the track blocks */
@@ -1104,14 +1113,12 @@ STX_MAIN_STRUCT	*STX_BuildStruct ( Uint8 *pFileBuffer , int Debug )
 		else
 		{
 			/* Track contains some sectors */
-			pStxSector = malloc ( sizeof ( STX_SECTOR_STRUCT ) * pStxTrack->SectorsCount );
-			if ( !pStxSector )
-			{
-				STX_FreeStruct ( pStxMain );
-				return NULL;
-			}
-			memset ( pStxSector , 0 , sizeof ( STX_SECTOR_STRUCT ) * pStxTrack->SectorsCount );
-			pStxTrack->pSectorsStruct = pStxSector;
+			pStxTrack->pSectorsStruct = pNextSectors;
+			pStxTrack->pSectorsPosition = pNextPosition;
+			pStxTrack->pSectorsOrder = pNextOrder;
+			pNextSectors += pStxTrack->SectorsCount;
+			pNextPosition += pStxTrack->SectorsCount;
+			pNextOrder += pStxTrack->SectorsCount;
 
 			/* Do we have some sector infos after the track header or only sector data ? */
 			if ( ( pStxTrack->Flags & STX_TRACK_FLAG_SECTOR_BLOCK ) == 0 )
@@ -1240,6 +1247,12 @@ STX_MAIN_STRUCT	*STX_BuildStruct ( Uint8 *pFileBuffer , int Debug )
 		}
 
 next_track:
+		STX_BuildSectorsOrder ( pStxTrack );
+
+		/* If the same track/side is present several times, keep the first one */
+		if ( pStxMain->TrackIndex[ ( pStxTrack->TrackNumber >> 7 ) & 0x01 ][ pStxTrack->TrackNumber & 0x7f ] < 0 )
+			pStxMain->TrackIndex[ ( pStxTrack->TrackNumber >> 7 ) & 0x01 ][ pStxTrack->TrackNumber & 0x7f ] = Track;
+
 		if ( Debug & STX_DEBUG_FLAG_STRUCTURE )
 		{
 			fprintf ( stderr , "  track %3d BlockSize=%d FuzzySize=%d Sectors=%4.4x Flags=%4.4x"
@@ -1349,6 +1362,36 @@ static void	STX_BuildSectorsSimple ( STX_TRACK_STRUCT *pStxTrack , Uint8 *p )
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Fill pSectorsPosition with the position in FDC cycles of each sector of
+ * the track, sorted in ascending order, and pSectorsOrder with the matching
+ * index in pSectorsStruct. Sectors at the same position keep the order
+ * of the STX file.
+ */
+static void	STX_BuildSectorsOrder ( STX_TRACK_STRUCT *pStxTrack )
+{
+	int	Sector;
+	int	i;
+	Sint32	Pos;
+
+	for ( Sector = 0 ; Sector < pStxTrack->SectorsCount ; Sector++ )
+	{
+		Pos = (Sint32)pStxTrack->pSectorsStruct[ Sector ].BitPosition * FDC_DELAY_CYCLE_MFM_BIT;
+
+		/* Insertion sort, sectors are nearly always already sorted in the file */
+		for ( i = Sector ; ( i > 0 ) && ( pStxTrack->pSectorsPosition[ i-1 ] > Pos ) ; i-- )
+		{
+			pStxTrack->pSectorsPosition[ i ] = pStxTrack->pSectorsPosition[ i-1 ];
+			pStxTrack->pSectorsOrder[ i ] = pStxTrack->pSectorsOrder[ i-1 ];
+		}
+		pStxTrack->pSectorsPosition[ i ] = Pos;
+		pStxTrack->pSectorsOrder[ i ] = Sector;
+	}
+}
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Compute the CRC of the Address Field for a given sector.
@@ -1380,14 +1423,14 @@ static STX_TRACK_STRUCT	*STX_FindTrack ( Uint8 Drive , Uint8 Track , Uint8 Side
 {
 	int	i;
 
-	if ( STX_State.ImageBuffer[ Drive ] == NULL )
+	if ( ( STX_State.ImageBuffer[ Drive ] == NULL ) || ( Side > 1 ) )
 		return NULL;
 
-	for ( i=0 ; i<STX_State.ImageBuffer[ Drive ]->TracksCount ; i++ )
-		if ( STX_State.ImageBuffer[ Drive ]->pTracksStruct[ i ].TrackNumber == ( ( Track & 0x7f ) | ( Side << 7 ) ) )
-			return &(STX_State.ImageBuffer[ Drive ]->pTracksStruct[ i ]);
+	i = STX_State.ImageBuffer[ Drive ]->TrackIndex[ Side ][ Track & 0x7f ];
+	if ( i < 0 )
+		return NULL;
 
-	return NULL;
+	return &(STX_State.ImageBuffer[ Drive ]->pTracksStruct[ i ]);
 }
 
 
@@ -1424,7 +1467,8 @@ static STX_SECTOR_STRUCT	*STX_FindSector ( Uint8 Drive , Uint8 Track , Uint8 Sid
 static STX_SECTOR_STRUCT	*STX_FindSector_By_Position ( Uint8 Drive , Uint8 Track , Uint8 Side , Uint16 BitPosition )
 {
 	STX_TRACK_STRUCT	*pStxTrack;
-	int			Sector;
+	Sint32			Pos;
+	int			Min , Max , i;
 
 	if ( STX_State.ImageBuffer[ Drive ] == NULL )
 		return NULL;
@@ -1436,10 +1480,22 @@ static STX_SECTOR_STRUCT	*STX_FindSector_By_Position ( Uint8 Drive , Uint8 Track
 	if ( pStxTrack->pSectorsStruct == NULL )
 		return NULL;
 
-	for ( Sector=0 ; Sector<pStxTrack->SectorsCount ; Sector++ )
-		if ( pStxTrack->pSectorsStruct[ Sector ].BitPosition == BitPosition )
-			return &(pStxTrack->pSectorsStruct[ Sector ]);
-	
+	/* Binary search of the 1st sector at this position */
+	Pos = (Sint32)BitPosition * FDC_DELAY_CYCLE_MFM_BIT;
+	Min = 0;
+	Max = pStxTrack->SectorsCount;
+	while ( Min < Max )
+	{
+		i = ( Min + Max ) / 2;
+		if ( pStxTrack->pSectorsPosition[ i ] < Pos )
+			Min = i + 1;
+		else
+			Max = i;
+	}
+
+	if ( ( Min < pStxTrack->SectorsCount ) && ( pStxTrack->pSectorsPosition[ Min ] == Pos ) )
+		return &(pStxTrack->pSectorsStruct[ pStxTrack->pSectorsOrder[ Min ] ]);
+
 	return NULL;
 }
 
@@ -1483,15 +1539,16 @@ extern Uint32	FDC_GetCyclesPerRev_FdcCycles_STX ( Uint8 Drive , Uint8 Track , Ui
  * the next sector's number into NextSector_ID_Field_SR, the next track's number
  * into NextSector_ID_Field_TR, the next sector's lenght into
  * NextSector_ID_Field_LEN and if the CRC is correct or not into NextSector_ID_Field_CRC_OK.
- * This function assumes the sectors of each track are sorted in ascending order
- * using BitPosition.
+ * The sectors are searched in pSectorsPosition, which is sorted in ascending
+ * order when the STX file is parsed.
  * If there's no available drive/floppy or no ID field in the track, we return -1
  */
 extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads , Uint8 Track , Uint8 Side )
 {
 	STX_TRACK_STRUCT	*pStxTrack;
+	STX_SECTOR_STRUCT	*pStxSector;
 	int			CurrentPos_FdcCycles;
-	int			i;
+	int			Min , Max , i;
 	int			Delay_FdcCycles;
 	int			TrackSize;
 
@@ -1509,12 +1566,18 @@ extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads ,
 	if ( pStxTrack->SectorsCount == 0 )				/* No sector (track image only, or empty / non formatted track) */
 		return -1;
 
-	/* Compare CurrentPos_FdcCycles with each sector's position in ascending order */
-	for ( i=0 ; i<pStxTrack->SectorsCount ; i++ )
+	/* Binary search of the 1st sector's position after CurrentPos_FdcCycles (1 bit = 32 cycles at 8 MHz) */
+	Min = 0;
+	Max = pStxTrack->SectorsCount;
+	while ( Min < Max )
 	{
-		if ( CurrentPos_FdcCycles < (int)pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT )	/* 1 bit = 32 cycles at 8 MHz */
-			break;						/* We found the next sector */
+		i = ( Min + Max ) / 2;
+		if ( CurrentPos_FdcCycles < pStxTrack->pSectorsPosition[ i ] )
+			Max = i;
+		else
+			Min = i + 1;
 	}
+	i = Min;
 
 	if ( i == pStxTrack->SectorsCount )				/* CurrentPos_FdcCycles is after the last ID Field of this track */
 	{
@@ -1527,25 +1590,26 @@ extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads ,
 			TrackSize = pStxTrack->MFMSize;
 
 		Delay_FdcCycles = TrackSize * FDC_DELAY_CYCLE_MFM_BYTE - CurrentPos_FdcCycles
-				+ pStxTrack->pSectorsStruct[ 0 ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT;
-		STX_State.NextSectorStruct_Nbr = 0;
-//fprintf ( stderr , "size=%d pos=%d pos0=%d delay=%d\n" , TrackSize, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ 0 ].BitPosition , Delay_FdcCycles );
+				+ pStxTrack->pSectorsPosition[ 0 ];
+		STX_State.NextSectorStruct_Nbr = pStxTrack->pSectorsOrder[ 0 ];
+//fprintf ( stderr , "size=%d pos=%d pos0=%d delay=%d\n" , TrackSize, CurrentPos_FdcCycles, pStxTrack->pSectorsPosition[ 0 ] , Delay_FdcCycles );
 	}
 	else								/* There's an ID Field before end of track */
 	{
-		Delay_FdcCycles = (int)pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT - CurrentPos_FdcCycles;
-		STX_State.NextSectorStruct_Nbr = i;
-//fprintf ( stderr , "i=%d pos=%d posi=%d delay=%d\n" , i, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT , Delay_FdcCycles );
+		Delay_FdcCycles = pStxTrack->pSectorsPosition[ i ] - CurrentPos_FdcCycles;
+		STX_State.NextSectorStruct_Nbr = pStxTrack->pSectorsOrder[ i ];
+//fprintf ( stderr , "i=%d pos=%d posi=%d delay=%d\n" , i, CurrentPos_FdcCycles, pStxTrack->pSectorsPosition[ i ] , Delay_FdcCycles );
 	}
 
 	/* Store the value of the track/sector numbers in the next ID field */
-	STX_State.NextSector_ID_Field_TR = pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].ID_Track;
-	STX_State.NextSector_ID_Field_SR = pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].ID_Sector;
-	STX_State.NextSector_ID_Field_LEN = pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].ID_Size;
+	pStxSector = &(pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ]);
+	STX_State.NextSector_ID_Field_TR = pStxSector->ID_Track;
+	STX_State.NextSector_ID_Field_SR = pStxSector->ID_Sector;
+	STX_State.NextSector_ID_Field_LEN = pStxSector->ID_Size;
 
 	/* If RNF is set and CRC error is set, then this ID field has a CRC error */
-	if ( ( pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].FDC_Status & STX_SECTOR_FLAG_RNF )
-	  && ( pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].FDC_Status & STX_SECTOR_FLAG_CRC ) )
+	if ( ( pStxSector->FDC_Status & STX_SECTOR_FLAG_RNF )
+	  && ( pStxSector->FDC_Status & STX_SECTOR_FLAG_CRC ) )
 		STX_State.NextSector_ID_Field_CRC_OK = 0;		/* CRC bad */
 	else
 		STX_State.NextSector_ID_Field_CRC_OK = 1;		/* CRC correct */
@@ -1672,7 +1736,7 @@ extern Uint8	FDC_ReadSector_STX ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 		{
 			Byte = pStxSector->pData[ i ];
 			if ( pStxSector->pFuzzyData )
-				Byte = ( Byte & pStxSector->pFuzzyData[ i ] ) | ( rand() & ~pStxSector->pFuzzyData[ i ] );
+				Byte = ( Byte & pStxSector->pFuzzyData[ i ] ) | ( Utils_Rand() & ~pStxSector->pFuzzyData[ i ] );
 		}
 
 		else							/* Use data from 'write sector' */
@@ -1905,7 +1969,7 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 	{
 		fprintf ( stderr , "fdc stx : track info not found for read track drive=%d track=%d side=%d, returning random bytes\n" , Drive , Track , Side );
  		for ( i=0 ; i<FDC_GetBytesPerTrack ( Drive ) ; i++ )
-			FDC_Buffer_Add ( rand() & 0xff );		/* Fill the track buffer with random bytes */
+			FDC_Buffer_Add ( Utils_Rand() & 0xff );		/* Fill the track buffer with random bytes */
 		return 0;
 	}
 
@@ -1943,7 +2007,7 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 		{
 			fprintf ( stderr , "fdc stx : no track image and no sector for read track drive=%d track=%d side=%d, building an unformatted track\n" , Drive , Track , Side );
 			for ( i=0 ; i<TrackSize ; i++ )
-				FDC_Buffer_Add ( rand() & 0xff );	/* Fill the track buffer with random bytes */
+				FDC_Buffer_Add ( Utils_Rand() & 0xff );	/* Fill the track buffer with random bytes */
 			return 0;
 		}
 
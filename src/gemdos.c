@@ -15,6 +15,12 @@
   host names is slower and may match several such filenames (of which
   first one will be returned), so using them should be avoided.
 
+  Host directory listings are cached (see GemDOS_DirCache_Get()), so
+  path matching and Fsfirst() don't need to read the host directory
+  each time. A cached listing is used only while the directory
+  modification time is unchanged, and is dropped when Hatari itself
+  creates, deletes or renames something in it.
+
   Bugs/things to fix:
   * Host filenames are in many places limited to 255 chars (same as
     on TOS), FILENAME_MAX should be used if that's a problem.
@@ -43,6 +49,7 @@ const char Gemdos_fileid[] = "Hatari gemdos.c : " __DATE__ " " __TIME__;
 #include "file.h"
 #include "floppy.h"
 #include "ide.h"
+#include "imageMap.h"
 #include "hdc.h"
 #include "gemdos.h"
 #include "gemdos_defines.h"
@@ -55,9 +62,12 @@ const char Gemdos_fileid[] = "Hatari gemdos.c : " __DATE__ " " __TIME__;
 #include "scandir.h"
 #include "stMemory.h"
 #include "str.h"
+#include "utils.h"
 #include "hatari-glue.h"
 #include "maccess.h"
 #include "symbols.h"
+#include "paths.h"
+#include "zip.h"
 
 /* Maximum supported length of a GEMDOS path: */
 #define MAX_GEMDOS_PATH 256
@@ -95,6 +105,8 @@ typedef struct {
 
 #define  BASE_FILEHANDLE     64    /* Our emulation handles - MUST not be valid TOS ones, but MUST be <256 */
 #define  MAX_FILE_HANDLES    32    /* We can allow 32 files open at once */
+#define  GEMDOS_WRITE_BUFFER (64*1024)  /* host buffer of written files, see --gemdos-flush */
+#define  MMAP_MIN_FILESIZE   65536 /* Smaller read-only files are not mapped */
 
 /*
    DateTime structure used by TOS call $57 f_dtatime
@@ -116,6 +128,10 @@ typedef struct
 	bool bUsed;
 	Uint32 Basepage;
 	FILE *FileHandle;
+	long nFileSize;                     /* file size and position, kept in */
+	long nFilePos;                      /* step by Fread/Fwrite/Fseek */
+	Uint8 *pMapped;                     /* contents of mapped read-only file, or NULL */
+	bool bDirty;                        /* written data not yet flushed */
 	/* TODO: host path might not fit into this */
 	char szActualName[MAX_GEMDOS_PATH];        /* used by F_DATIME (0x57) */
 } FILE_HANDLE;
@@ -125,7 +141,7 @@ typedef struct
 	bool bUsed;
 	int  nentries;                      /* number of entries in fs directory */
 	int  centry;                        /* current entry # */
-	struct dirent **found;              /* legal files */
+	char **found;                       /* legal files (host names) */
 	char path[MAX_GEMDOS_PATH];                /* sfirst path */
 } INTERNAL_DTA;
 
@@ -162,8 +178,12 @@ static void GemDOS_DateTime2Tos(time_t t, DATETIME *DateTime, const char *fname)
 {
 	struct tm *x;
 
+	/* host file times would make deterministic runs depend on the host */
+	if (ConfigureParams.System.bDeterministic)
+		t = UTILS_DETERMINISTIC_EPOCH;
+
 	/* localtime takes DST into account */
-	x = localtime(&t);
+	x = Utils_LocalTime(&t);
 
 	if (x == NULL)
 	{
@@ -180,6 +200,27 @@ static void GemDOS_DateTime2Tos(time_t t, DATETIME *DateTime, const char *fname)
 		| (((x->tm_year-80 > 0) ? x->tm_year-80 : 0) << 9);
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Flush buffered writes of the handles open to the given host file,
+ * or of all handles if it's NULL, so that reading the file through
+ * another handle or looking at it on the host gives the written data
+ */
+static void GemDOS_FlushWrites(const char *pszActualName)
+{
+	int i;
+
+	for (i = 0; i < MAX_FILE_HANDLES; i++)
+	{
+		if (!FileHandles[i].bDirty)
+			continue;
+		if (pszActualName && strcmp(FileHandles[i].szActualName, pszActualName) != 0)
+			continue;
+		fflush(FileHandles[i].FileHandle);
+		FileHandles[i].bDirty = false;
+	}
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Populate a DATETIME structure with file info.  Handle needs to be
@@ -190,6 +231,7 @@ static bool GemDOS_GetFileInformation(int Handle, DATETIME *DateTime)
 	const char *fname = FileHandles[Handle].szActualName;
 	struct stat fstat;
 
+	GemDOS_FlushWrites(fname);
 	if (stat(fname, &fstat) == 0)
 	{
 		GemDOS_DateTime2Tos(fstat.st_mtime, DateTime, fname);
@@ -213,8 +255,8 @@ static bool GemDOS_SetFileInformation(int Handle, DATETIME *DateTime)
 	/* make sure Hatari itself doesn't need to write/modify
 	 * the file after it's modification time is changed.
 	 */
-	fflush(FileHandles[Handle].FileHandle);
 	filename = FileHandles[Handle].szActualName;
+	GemDOS_FlushWrites(filename);
 	
 	/* Bits: 0-4 = secs/2, 5-10 = mins, 11-15 = hours (24-hour format) */
 	timespec.tm_sec  = (DateTime->timeword & 0x1F) << 1;
@@ -267,12 +309,351 @@ static Uint8 GemDOS_ConvertAttribute(mode_t mode)
 }
 
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * ZIP archive drives. The archive contents are shown through the drive's
+ * writable overlay directory: directory listings merge the archive entries
+ * with the overlay ones, and archive files and directories are copied to
+ * the overlay only when they're accessed, so that all the host file code
+ * below works on them as is. The overlay keeps the changes, and acts as
+ * a cache of the decompressed files. Archive entries deleted or renamed
+ * on the drive are listed in the overlay's ZIP_DELETED_LIST file.
+ */
+#define ZIP_DELETED_LIST ".hatari-zip-deleted"
+
+/**
+ * Return ZIP archive drive whose overlay contains given host path and
+ * set 'zippath' to the path within the archive ('/' separators, empty
+ * for root), or return NULL if it's not on such a drive.
+ */
+static EMULATEDDRIVE *GemDOS_ZipDrive(const char *path, char *zippath, int len)
+{
+	EMULATEDDRIVE *drv;
+	int i, rootlen;
+	char *s;
+
+	if (!GEMDOS_EMU_ON)
+		return NULL;
+
+	for (i = 0; i < MAX_HARDDRIVES; i++)
+	{
+		drv = emudrives[i];
+		if (!drv || !drv->zip_file)
+			continue;
+		rootlen = strlen(drv->hd_emulation_dir);
+		if (strncmp(path, drv->hd_emulation_dir, rootlen) != 0
+		    || (path[rootlen] && path[rootlen] != PATHSEP))
+			continue;
+
+		path += rootlen;
+		while (*path == PATHSEP)
+			path++;
+		snprintf(zippath, len, "%s", path);
+		for (s = zippath; *s; s++)
+		{
+			if (*s == PATHSEP)
+				*s = '/';
+		}
+		while (s > zippath && *(s-1) == '/')
+			*--s = '\0';
+		return drv;
+	}
+	return NULL;
+}
+
+/**
+ * Return true if given archive path was removed from the drive
+ */
+static bool GemDOS_ZipIsDeleted(const EMULATEDDRIVE *drv, const char *zippath)
+{
+	int i;
+
+	for (i = 0; i < drv->zip_ndeleted; i++)
+	{
+		if (strcasecmp(drv->zip_deleted[i], zippath) == 0)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Add archive path to the list of removed ones
+ */
+static bool GemDOS_ZipAddDeleted(EMULATEDDRIVE *drv, const char *zippath)
+{
+	char **deleted;
+
+	deleted = realloc(drv->zip_deleted, (drv->zip_ndeleted + 1) * sizeof(char *));
+	if (!deleted)
+		return false;
+	drv->zip_deleted = deleted;
+	deleted[drv->zip_ndeleted] = strdup(zippath);
+	if (!deleted[drv->zip_ndeleted])
+		return false;
+	drv->zip_ndeleted++;
+	return true;
+}
+
+/**
+ * Read the list of archive paths removed from the drive in earlier sessions
+ */
+static void GemDOS_ZipLoadDeleted(EMULATEDDRIVE *drv)
+{
+	char listname[FILENAME_MAX], line[FILENAME_MAX];
+	FILE *fp;
+	int len;
+
+	snprintf(listname, sizeof(listname), "%s%c%s", drv->hd_emulation_dir, PATHSEP, ZIP_DELETED_LIST);
+	fp = fopen(listname, "r");
+	if (!fp)
+		return;
+	while (fgets(line, sizeof(line), fp))
+	{
+		len = strlen(line);
+		while (len > 0 && (line[len-1] == '\n' || line[len-1] == '\r'))
+			line[--len] = '\0';
+		if (len > 0 && !GemDOS_ZipAddDeleted(drv, line))
+			break;
+	}
+	fclose(fp);
+}
+
+/**
+ * Host file or directory was deleted or renamed. If it came from
+ * the archive, make sure it's not shown on the drive anymore.
+ */
+static void GemDOS_ZipDelete(const char *path)
+{
+	char zippath[FILENAME_MAX], listname[FILENAME_MAX];
+	EMULATEDDRIVE *drv;
+	long size;
+	time_t mtime;
+	bool isdir;
+	FILE *fp;
+
+	drv = GemDOS_ZipDrive(path, zippath, sizeof(zippath));
+	if (!drv || !zippath[0] || GemDOS_ZipIsDeleted(drv, zippath)
+	    || !ZIP_GetFileInfo(drv->zip_file, zippath, &size, &mtime, &isdir))
+		return;
+
+	snprintf(listname, sizeof(listname), "%s%c%s", drv->hd_emulation_dir, PATHSEP, ZIP_DELETED_LIST);
+	fp = fopen(listname, "a");
+	if (!fp || fprintf(fp, "%s\n", zippath) < 0 || !GemDOS_ZipAddDeleted(drv, zippath))
+		Log_Printf(LOG_WARN, "GEMDOS: failed to record removal of '%s' from '%s'\n",
+			   zippath, drv->zip_file);
+	if (fp)
+		fclose(fp);
+}
+
+/**
+ * Get host file information for an archive entry not copied to the overlay.
+ * Return false if given host path isn't in an archive.
+ */
+static bool GemDOS_ZipStat(const char *path, struct stat *filestat)
+{
+	char zippath[FILENAME_MAX];
+	EMULATEDDRIVE *drv;
+	long size;
+	time_t mtime;
+	bool isdir;
+
+	drv = GemDOS_ZipDrive(path, zippath, sizeof(zippath));
+	if (!drv || GemDOS_ZipIsDeleted(drv, zippath)
+	    || !ZIP_GetFileInfo(drv->zip_file, zippath, &size, &mtime, &isdir))
+		return false;
+
+	memset(filestat, 0, sizeof(*filestat));
+	filestat->st_mode = isdir ? (S_IFDIR | 0755) : (S_IFREG | 0644);
+	filestat->st_size = size;
+	filestat->st_mtime = mtime;
+	return true;
+}
+
+/**
+ * Copy given archive file or directory, and its parent directories,
+ * to the overlay unless it's already there. Return false if given path
+ * isn't on host nor in an archive, or if copying it failed.
+ */
+static bool GemDOS_ZipMaterialize(const char *path)
+{
+	char zippath[FILENAME_MAX], parent[FILENAME_MAX];
+	struct utimbuf timebuf;
+	EMULATEDDRIVE *drv;
+	struct stat filestat;
+	long size;
+	time_t mtime;
+	bool isdir, ok;
+	char *sep;
+
+	drv = GemDOS_ZipDrive(path, zippath, sizeof(zippath));
+	if (!drv)
+		return false;
+	if (stat(path, &filestat) == 0)
+		return true;
+	if (!zippath[0] || GemDOS_ZipIsDeleted(drv, zippath)
+	    || !ZIP_GetFileInfo(drv->zip_file, zippath, &size, &mtime, &isdir))
+		return false;
+
+	snprintf(parent, sizeof(parent), "%s", path);
+	sep = strrchr(parent, PATHSEP);
+	if (sep)
+	{
+		*sep = '\0';
+		if (!GemDOS_ZipMaterialize(parent))
+			return false;
+	}
+
+	if (isdir)
+		ok = (mkdir(path, 0755) == 0);
+	else
+		ok = ZIP_ExtractFileTo(drv->zip_file, zippath, path);
+	if (!ok)
+	{
+		Log_Printf(LOG_WARN, "GEMDOS: copying '%s' from '%s' to overlay failed\n",
+			   zippath, drv->zip_file);
+		return false;
+	}
+	timebuf.actime = timebuf.modtime = mtime;
+	utime(path, &timebuf);
+
+	LOG_TRACE(TRACE_OS_GEMDOS, "GEMDOS: '%s' copied from %s\n", path, drv->zip_file);
+	return true;
+}
+
+/**
+ * Compare directory entries like alphasort()
+ */
+static int GemDOS_ZipCompareEntries(const void *a, const void *b)
+{
+	const struct dirent *da = *(const struct dirent * const *)a;
+	const struct dirent *db = *(const struct dirent * const *)b;
+
+	return strcoll(da->d_name, db->d_name);
+}
+
+/**
+ * Add the archive entries of given overlay directory which aren't on host
+ * to its scandir() 'files' listing, keeping it in alphasort order.
+ * Return the new number of entries.
+ */
+static int GemDOS_ZipListDir(const char *path, struct dirent ***pfiles, int count)
+{
+	char zippath[FILENAME_MAX], fullpath[FILENAME_MAX];
+	struct dirent **zfiles, **files;
+	EMULATEDDRIVE *drv;
+	zip_dir *zd;
+	int i, j, nz, len, added = 0;
+	bool keep;
+
+	drv = GemDOS_ZipDrive(path, zippath, sizeof(zippath) - 1);
+	if (!drv)
+		return count;
+	if (zippath[0])
+		strcat(zippath, "/");
+
+	zd = ZIP_GetFiles(drv->zip_file);
+	if (!zd)
+		return count;
+	zfiles = ZIP_GetFilesDir(zd, zippath, &nz);
+	ZIP_FreeZipDir(zd);
+	if (!zfiles)
+		return count;
+
+	files = realloc(*pfiles, (count + nz) * sizeof(struct dirent *));
+	if (!files)
+	{
+		for (i = 0; i < nz; i++)
+			free(zfiles[i]);
+		free(zfiles);
+		return count;
+	}
+
+	for (i = 0; i < nz; i++)
+	{
+		char *name = zfiles[i]->d_name;
+
+		/* subdirectories end with '/' */
+		len = strlen(name);
+		if (len > 0 && name[len-1] == '/')
+			name[--len] = '\0';
+		keep = (len > 0 && strcmp(name, "..") != 0);
+
+		for (j = 0; keep && j < count + added; j++)
+		{
+			if (strcasecmp(files[j]->d_name, name) == 0)
+				keep = false;
+		}
+		if (keep)
+		{
+			snprintf(fullpath, sizeof(fullpath), "%s%s", zippath, name);
+			keep = !GemDOS_ZipIsDeleted(drv, fullpath);
+		}
+
+		if (keep)
+			files[count + added++] = zfiles[i];
+		else
+			free(zfiles[i]);
+	}
+	free(zfiles);
+
+	count += added;
+	qsort(files, count, sizeof(struct dirent *), GemDOS_ZipCompareEntries);
+	*pfiles = files;
+	return count;
+}
+
+/**
+ * Set up given drive to show the ZIP archive given as GEMDOS HD
+ * through its overlay directory, creating that if needed.
+ */
+static void GemDOS_ZipInitDrive(EMULATEDDRIVE *drv, const char *zipfile)
+{
+	char dir[FILENAME_MAX], name[FILENAME_MAX], ext[FILENAME_MAX];
+
+	drv->zip_file = strdup(zipfile);
+
+	if (ConfigureParams.HardDisk.szGemdosOverlayDir[0])
+	{
+		strcpy(drv->hd_emulation_dir, ConfigureParams.HardDisk.szGemdosOverlayDir);
+	}
+	else
+	{
+		/* default is a directory named by the archive in Hatari's home */
+		File_SplitPath(zipfile, dir, name, ext);
+		snprintf(drv->hd_emulation_dir, sizeof(drv->hd_emulation_dir),
+			 "%s%cgemdos-overlay", Paths_GetHatariHome(), PATHSEP);
+		mkdir(drv->hd_emulation_dir, 0755);
+		File_AddSlashToEndFileName(drv->hd_emulation_dir);
+		strncat(drv->hd_emulation_dir, name,
+			sizeof(drv->hd_emulation_dir) - strlen(drv->hd_emulation_dir) - 1);
+	}
+	File_CleanFileName(drv->hd_emulation_dir);
+	mkdir(drv->hd_emulation_dir, 0755);
+
+	GemDOS_ZipLoadDeleted(drv);
+}
+
+/**
+ * Free given drive
+ */
+static void GemDOS_FreeDrive(EMULATEDDRIVE *drv)
+{
+	int i;
+
+	for (i = 0; i < drv->zip_ndeleted; i++)
+		free(drv->zip_deleted[i]);
+	free(drv->zip_deleted);
+	free(drv->zip_file);
+	free(drv);
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Populate the DTA buffer with file info.
  * @return   0 if entry is ok, 1 if entry should be skipped, < 0 for errors.
  */
-static int PopulateDTA(char *path, struct dirent *file)
+static int PopulateDTA(char *path, const char *name)
 {
 	/* TODO: host file path can be longer than MAX_GEMDOS_PATH */
 	char tempstr[MAX_GEMDOS_PATH];
@@ -280,9 +661,9 @@ static int PopulateDTA(char *path, struct dirent *file)
 	DATETIME DateTime;
 	int nFileAttr, nAttrMask;
 
-	snprintf(tempstr, sizeof(tempstr), "%s%c%s", path, PATHSEP, file->d_name);
+	snprintf(tempstr, sizeof(tempstr), "%s%c%s", path, PATHSEP, name);
 
-	if (stat(tempstr, &filestat) != 0)
+	if (stat(tempstr, &filestat) != 0 && !GemDOS_ZipStat(tempstr, &filestat))
 	{
 		perror(tempstr);
 		return -1;   /* return on error */
@@ -298,12 +679,13 @@ static int PopulateDTA(char *path, struct dirent *file)
 		return 1;
 
 	GemDOS_DateTime2Tos(filestat.st_mtime, &DateTime, tempstr);
+	STMemory_SetDirtyArea((Uint8 *)pDTA - STRam, sizeof(DTA));
 
 	/* convert to atari-style uppercase */
-	Str_Filename2TOSname(file->d_name, pDTA->dta_name);
+	Str_Filename2TOSname(name, pDTA->dta_name);
 #if DEBUG_PATTERN_MATCH
 	fprintf(stderr, "GEMDOS: host: %s -> GEMDOS: %s\n",
-		file->d_name, pDTA->dta_name);
+		name, pDTA->dta_name);
 #endif
 	do_put_mem_long(pDTA->dta_size, filestat.st_size);
 	do_put_mem_word(pDTA->dta_time, DateTime.timeword);
@@ -419,6 +801,273 @@ static const char* fsfirst_dirmask(const char *string)
 		return string;
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Host directory cache
+ */
+#define DIRCACHE_MAX_DIRS 16      /* Number of host directories kept in the cache */
+
+typedef struct
+{
+	char *path;                 /* host directory path, NULL if slot is unused */
+	time_t mtime;               /* directory state when it was read */
+	ino_t ino;
+	bool racy;                  /* modified too recently, mtime can't be trusted */
+	Uint32 lastused;
+	int nentries;
+	char **names;               /* host names (precomposed UTF-8), in alphasort order */
+	char **folded;              /* same in lower case, for case insensitive lookups */
+	int *hash;                  /* index+1 of the entries, by hash of the folded name */
+	int hashmask;
+} DIRCACHE_DIR;
+
+static DIRCACHE_DIR DirCache[DIRCACHE_MAX_DIRS];
+static Uint32 DirCacheCounter;
+
+
+/**
+ * Hash of a lower case name
+ */
+static Uint32 GemDOS_DirCache_Hash(const char *name)
+{
+	Uint32 hash = 2166136261u;
+
+	while (*name)
+		hash = (hash ^ (Uint8)*name++) * 16777619u;
+	return hash;
+}
+
+/**
+ * Copy host path without trailing path separators
+ */
+static char *GemDOS_DirCache_Key(const char *path)
+{
+	char *key = strdup(path);
+	int len;
+
+	if (!key)
+		return NULL;
+	len = strlen(key);
+	while (len > 1 && key[len-1] == PATHSEP)
+		key[--len] = '\0';
+	return key;
+}
+
+/**
+ * Free given cache slot
+ */
+static void GemDOS_DirCache_Free(DIRCACHE_DIR *dir)
+{
+	free(dir->path);
+	if (dir->names)
+		free(dir->names[0]);    /* names and folded names are in one block */
+	free(dir->names);
+	free(dir->hash);
+	memset(dir, 0, sizeof(*dir));
+}
+
+/**
+ * Read host directory 'path' into given (free) cache slot.
+ * Return false on error.
+ */
+static bool GemDOS_DirCache_Read(DIRCACHE_DIR *dir, const char *path)
+{
+	struct dirent **files;
+	char *text;
+	size_t textlen = 0;
+	int i, count, hashsize;
+	Uint32 h;
+
+	count = scandir(path, &files, 0, alphasort);
+	if (count < 0)
+		return false;
+	count = GemDOS_ZipListDir(path, &files, count);
+
+	for (i = 0; i < count; i++)
+	{
+		Str_DecomposedToPrecomposedUtf8(files[i]->d_name, files[i]->d_name);   /* for OSX */
+		textlen += strlen(files[i]->d_name) + 1;
+	}
+	for (hashsize = 16; hashsize < 2*count; hashsize *= 2)
+		;
+
+	dir->names = malloc(2 * (count+1) * sizeof(char *));
+	dir->hash = calloc(hashsize, sizeof(int));
+	text = malloc(2 * textlen + 1);
+	if (!dir->names || !dir->hash || !text)
+	{
+		perror("GemDOS_DirCache_Read");
+		for (i = 0; i < count; i++)
+			free(files[i]);
+		free(files);
+		free(text);
+		free(dir->names);
+		free(dir->hash);
+		dir->names = NULL;
+		dir->hash = NULL;
+		return false;
+	}
+	dir->folded = dir->names + count + 1;
+	dir->nentries = count;
+	dir->hashmask = hashsize - 1;
+	dir->names[0] = text;           /* also when directory is empty, for freeing */
+
+	for (i = 0; i < count; i++)
+	{
+		int len = strlen(files[i]->d_name) + 1, j;
+
+		dir->names[i] = text;
+		memcpy(text, files[i]->d_name, len);
+		text += len;
+		dir->folded[i] = text;
+		for (j = 0; j < len; j++)
+			text[j] = tolower((unsigned char)dir->names[i][j]);
+		text += len;
+		free(files[i]);
+
+		/* several host names can fold to the same name, keep first one */
+		h = GemDOS_DirCache_Hash(dir->folded[i]) & dir->hashmask;
+		while (dir->hash[h] && strcmp(dir->folded[dir->hash[h]-1], dir->folded[i]) != 0)
+			h = (h + 1) & dir->hashmask;
+		if (!dir->hash[h])
+			dir->hash[h] = i + 1;
+	}
+	free(files);
+	return true;
+}
+
+/**
+ * Return cached listing of given host directory, reading it if it's
+ * not in the cache or changed since. Return NULL if directory can't
+ * be read. The returned listing is valid until the next call.
+ */
+static DIRCACHE_DIR *GemDOS_DirCache_Get(const char *path)
+{
+	DIRCACHE_DIR *dir = NULL;
+	struct stat st;
+	char *key;
+	time_t now;
+	int i;
+
+	key = GemDOS_DirCache_Key(path);
+	if (!key)
+		return NULL;
+	now = time(NULL);
+	if ((stat(key, &st) != 0 && !(GemDOS_ZipMaterialize(key) && stat(key, &st) == 0))
+	    || !S_ISDIR(st.st_mode))
+	{
+		free(key);
+		return NULL;
+	}
+
+	for (i = 0; i < DIRCACHE_MAX_DIRS; i++)
+	{
+		if (DirCache[i].path && strcmp(DirCache[i].path, key) == 0)
+		{
+			dir = &DirCache[i];
+			break;
+		}
+	}
+	if (dir && !dir->racy && dir->mtime == st.st_mtime && dir->ino == st.st_ino)
+	{
+		free(key);
+		dir->lastused = ++DirCacheCounter;
+		return dir;
+	}
+
+	/* (re-)read it, replacing the least recently used directory */
+	if (!dir)
+	{
+		dir = &DirCache[0];
+		for (i = 1; i < DIRCACHE_MAX_DIRS; i++)
+		{
+			if (DirCache[i].lastused < dir->lastused)
+				dir = &DirCache[i];
+		}
+	}
+	GemDOS_DirCache_Free(dir);
+	if (!GemDOS_DirCache_Read(dir, key))
+	{
+		free(key);
+		return NULL;
+	}
+	dir->path = key;
+	dir->mtime = st.st_mtime;
+	dir->ino = st.st_ino;
+	/* later changes within the same mtime granularity wouldn't be seen */
+	dir->racy = (st.st_mtime + 2 >= now);
+	dir->lastused = ++DirCacheCounter;
+	return dir;
+}
+
+/**
+ * Return host name matching given name case insensitively, or NULL
+ */
+static const char *GemDOS_DirCache_Lookup(DIRCACHE_DIR *dir, const char *name)
+{
+	char folded[FILENAME_MAX];
+	Uint32 h;
+	int i;
+
+	for (i = 0; name[i] && i < FILENAME_MAX-1; i++)
+		folded[i] = tolower((unsigned char)name[i]);
+	folded[i] = '\0';
+
+	h = GemDOS_DirCache_Hash(folded) & dir->hashmask;
+	while (dir->hash[h])
+	{
+		if (strcmp(dir->folded[dir->hash[h]-1], folded) == 0)
+			return dir->names[dir->hash[h]-1];
+		h = (h + 1) & dir->hashmask;
+	}
+	return NULL;
+}
+
+/**
+ * Empty the host directory cache
+ */
+static void GemDOS_DirCache_UnInit(void)
+{
+	int i;
+
+	for (i = 0; i < DIRCACHE_MAX_DIRS; i++)
+		GemDOS_DirCache_Free(&DirCache[i]);
+}
+
+
+/**
+ * Drop given host path and its parent directory from the cache,
+ * after a file or directory was created, removed or renamed there.
+ */
+static void GemDOS_DirCache_Invalidate(const char *path)
+{
+	char *key, *sep;
+	int i;
+
+	key = GemDOS_DirCache_Key(path);
+	if (!key)
+	{
+		GemDOS_DirCache_UnInit();
+		return;
+	}
+	for (i = 0; i < DIRCACHE_MAX_DIRS; i++)
+	{
+		if (DirCache[i].path && strcmp(DirCache[i].path, key) == 0)
+			GemDOS_DirCache_Free(&DirCache[i]);
+	}
+	sep = strrchr(key, PATHSEP);
+	if (sep)
+	{
+		sep[sep == key] = '\0';         /* keep root directory separator */
+		for (i = 0; i < DIRCACHE_MAX_DIRS; i++)
+		{
+			if (DirCache[i].path && strcmp(DirCache[i].path, key) == 0)
+				GemDOS_DirCache_Free(&DirCache[i]);
+		}
+	}
+	free(key);
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Close given internal file handle if it's still in use
@@ -426,13 +1075,99 @@ static const char* fsfirst_dirmask(const char *string)
  */
 static void GemDOS_CloseFileHandle(int i)
 {
+	if (FileHandles[i].pMapped)
+		ImageMap_UnmapFile(FileHandles[i].pMapped, FileHandles[i].nFileSize);
 	if (FileHandles[i].bUsed)
 		fclose(FileHandles[i].FileHandle);
 	FileHandles[i].FileHandle = NULL;
+	FileHandles[i].pMapped = NULL;
+	FileHandles[i].bDirty = false;
 	FileHandles[i].Basepage = 0;
 	FileHandles[i].bUsed = false;
 }
 
+/**
+ * Set the file size and position of a newly opened file handle,
+ * and map the file if 'bMap' is set and file is big enough
+ */
+static void GemDOS_InitFileHandle(int i, bool bMap)
+{
+	FILE *fp = FileHandles[i].FileHandle;
+	struct stat FileStat;
+	long nMappedSize;
+
+	/* buffer writes unless each one needs to be flushed,
+	 * must be done before anything else on the stream */
+	if (!bMap && ConfigureParams.HardDisk.nGemdosFlush != GEMDOS_FLUSH_WRITE)
+		setvbuf(fp, NULL, _IOFBF, GEMDOS_WRITE_BUFFER);
+
+	FileHandles[i].pMapped = NULL;
+	FileHandles[i].bDirty = false;
+	FileHandles[i].nFilePos = ftell(fp);
+	if (fstat(fileno(fp), &FileStat) == 0 && S_ISREG(FileStat.st_mode))
+		FileHandles[i].nFileSize = FileStat.st_size;
+	else
+	{
+		/* not a regular host file, e.g. autostart one */
+		fseek(fp, 0, SEEK_END);
+		FileHandles[i].nFileSize = ftell(fp);
+		fseek(fp, FileHandles[i].nFilePos, SEEK_SET);
+	}
+
+	if (!bMap || !ConfigureParams.HardDisk.bGemdosMmap
+	    || FileHandles[i].nFileSize < MMAP_MIN_FILESIZE)
+		return;
+	FileHandles[i].pMapped = ImageMap_MapFile(FileHandles[i].szActualName, &nMappedSize);
+	if (FileHandles[i].pMapped && nMappedSize != FileHandles[i].nFileSize)
+	{
+		/* file changed in between */
+		ImageMap_UnmapFile(FileHandles[i].pMapped, nMappedSize);
+		FileHandles[i].pMapped = NULL;
+	}
+}
+
+/**
+ * Stop using the mapping of given file handle, and continue
+ * from the same position with the stdio file
+ */
+static void GemDOS_UnmapFileHandle(int i)
+{
+	ImageMap_UnmapFile(FileHandles[i].pMapped, FileHandles[i].nFileSize);
+	FileHandles[i].pMapped = NULL;
+	fseek(FileHandles[i].FileHandle, FileHandles[i].nFilePos, SEEK_SET);
+}
+
+/**
+ * Update the size of the other handles open to the given host file
+ * after it was written ('bTruncated' = false) or truncated. Mappings
+ * that don't match the new size anymore are dropped.
+ */
+static void GemDOS_UpdateFileSize(int Handle, const char *pszActualName, long nFileSize, bool bTruncated)
+{
+	int i;
+
+	for (i = 0; i < MAX_FILE_HANDLES; i++)
+	{
+		if (i == Handle || !FileHandles[i].bUsed
+		    || strcmp(FileHandles[i].szActualName, pszActualName) != 0)
+			continue;
+		if (!bTruncated && nFileSize <= FileHandles[i].nFileSize)
+			continue;
+		if (FileHandles[i].pMapped)
+			GemDOS_UnmapFileHandle(i);
+		FileHandles[i].nFileSize = nFileSize;
+	}
+}
+
+/**
+ * Flush buffered writes on VBL, if that's what user asked for
+ */
+void GemDOS_FlushFiles(void)
+{
+	if (ConfigureParams.HardDisk.nGemdosFlush == GEMDOS_FLUSH_VBL)
+		GemDOS_FlushWrites(NULL);
+}
+
 /**
  * Un-force given file handle
  */
@@ -508,6 +1243,7 @@ void GemDOS_Reset(void)
 		ClearInternalDTA();
 	}
 	DTAIndex = 0;
+	GemDOS_DirCache_UnInit();
 
 	/* Reset */
 	bInitGemDOS = false;
@@ -522,38 +1258,32 @@ void GemDOS_Reset(void)
  */
 static bool GEMDOS_DoesHostDriveFolderExist(char* lpstrPath, int iDrive)
 {
-	bool bExist = false;
+	struct stat status;
 
-	if (access(lpstrPath, F_OK) != 0 )
+	/* Only HDD identifiers (or other emulated devices) */
+	if (iDrive <= 1)
+		return false;
+
+	if (stat(lpstrPath, &status) != 0)
 	{
 		/* Try lower case drive letter instead */
 		int	iIndex = strlen(lpstrPath)-1;
 		lpstrPath[iIndex] = tolower((unsigned char)lpstrPath[iIndex]);
+		if (stat(lpstrPath, &status) != 0)
+			return false;
 	}
-
-	/* Check the file/folder is accessible (security basis) */
-	if (access(lpstrPath, F_OK) == 0 )
-	{
-		 /* If its a HDD identifier (or other emulated device) */
-		if (iDrive > 1)
-		{
-			struct stat status;
-			stat( lpstrPath, &status );
-			if ( status.st_mode & S_IFDIR )
-				bExist = true;
-		}
-	}
-
-	return bExist;
+	return S_ISDIR(status.st_mode);
 }
 
 
 /**
  * Determine upper limit of partitions that should be emulated.
+ * In multi-partition mode, the drive letter folders found are stored
+ * (in their host case) to pFolders, so that other drives need no probing.
  *
  * @return true if multiple GEMDOS partitions should be emulated, false otherwise
  */
-static bool GemDOS_DetermineMaxPartitions(int *pnMaxDrives)
+static bool GemDOS_DetermineMaxPartitions(int *pnMaxDrives, char pFolders[MAX_HARDDRIVES])
 {
 	struct dirent **files;
 	int count, i, last;
@@ -561,6 +1291,7 @@ static bool GemDOS_DetermineMaxPartitions(int *pnMaxDrives)
 	bool bMultiPartitions;
 
 	*pnMaxDrives = 0;
+	memset(pFolders, 0, MAX_HARDDRIVES);
 
 	/* Scan through the main directory to see whether there are just single
 	 * letter sub-folders there (then use multi-partition mode) or if
@@ -606,6 +1337,8 @@ static bool GemDOS_DetermineMaxPartitions(int *pnMaxDrives)
 			letter = letter - 'C' + 1;
 			if (letter > last)
 				last = letter;
+			if (letter <= MAX_HARDDRIVES)
+				pFolders[letter - 1] = files[i]->d_name[0];
 		}
 	}
 
@@ -635,8 +1368,20 @@ void GemDOS_InitDrives(void)
 	int SkipPartitions;
 	int ImagePartitions;
 	bool bMultiPartitions;
+	bool bZipArchive;
+	char Folders[MAX_HARDDRIVES];
 
-	bMultiPartitions = GemDOS_DetermineMaxPartitions(&nMaxDrives);
+	/* ZIP archive contents are emulated as a single partition */
+	bZipArchive = ZIP_FileNameIsZIP(ConfigureParams.HardDisk.szHardDiskDirectories[0])
+	              && File_Exists(ConfigureParams.HardDisk.szHardDiskDirectories[0]);
+	if (bZipArchive)
+	{
+		nMaxDrives = 1;
+		bMultiPartitions = false;
+		memset(Folders, 0, sizeof(Folders));
+	}
+	else
+		bMultiPartitions = GemDOS_DetermineMaxPartitions(&nMaxDrives, Folders);
 
 	/* intialize data for harddrive emulation: */
 	if (nMaxDrives > 0 && !emudrives)
@@ -666,7 +1411,7 @@ void GemDOS_InitDrives(void)
 		}
 
 		/* Allocate emudrives entry for this drive */
-		emudrives[i] = malloc(sizeof(EMULATEDDRIVE));
+		emudrives[i] = calloc(1, sizeof(EMULATEDDRIVE));
 		if (!emudrives[i])
 		{
 			perror("GemDOS_InitDrives");
@@ -674,7 +1419,10 @@ void GemDOS_InitDrives(void)
 		}
 
 		/* set emulation directory string */
-		strcpy(emudrives[i]->hd_emulation_dir, ConfigureParams.HardDisk.szHardDiskDirectories[0]);
+		if (bZipArchive)
+			GemDOS_ZipInitDrive(emudrives[i], ConfigureParams.HardDisk.szHardDiskDirectories[0]);
+		else
+			strcpy(emudrives[i]->hd_emulation_dir, ConfigureParams.HardDisk.szHardDiskDirectories[0]);
 
 		/* remove trailing slash, if any in the directory name */
 		File_CleanFileName(emudrives[i]->hd_emulation_dir);
@@ -683,22 +1431,30 @@ void GemDOS_InitDrives(void)
 		if (bMultiPartitions)
 		{
 			char sDriveLetter[] = { PATHSEP, (char)('C' + i), '\0' };
+			if (Folders[i])
+				sDriveLetter[1] = Folders[i];
 			strcat(emudrives[i]->hd_emulation_dir, sDriveLetter);
 		}
 		/* drive number (C: = 2, D: = 3, etc.) */
 		DriveNumber = 2 + i;
 
 		// Check host file system to see if the drive folder for THIS
-		// drive letter/number exists...
-		if (GEMDOS_DoesHostDriveFolderExist(emudrives[i]->hd_emulation_dir, DriveNumber))
+		// drive letter/number exists (no need to probe the ones which
+		// weren't in the directory listing)...
+		if ((!bMultiPartitions || Folders[i])
+		    && GEMDOS_DoesHostDriveFolderExist(emudrives[i]->hd_emulation_dir, DriveNumber))
 		{
 			/* initialize current directory string, too (initially the same as hd_emulation_dir) */
 			strcpy(emudrives[i]->fs_currpath, emudrives[i]->hd_emulation_dir);
 			File_AddSlashToEndFileName(emudrives[i]->fs_currpath);    /* Needs trailing slash! */
 
 			/* map drive */
-			Log_Printf(LOG_INFO, "GEMDOS HDD emulation, %c: <-> %s.\n",
-				   'A'+DriveNumber, emudrives[i]->hd_emulation_dir);
+			if (emudrives[i]->zip_file)
+				Log_Printf(LOG_INFO, "GEMDOS HDD emulation, %c: <-> %s (overlay %s).\n",
+					   'A'+DriveNumber, emudrives[i]->zip_file, emudrives[i]->hd_emulation_dir);
+			else
+				Log_Printf(LOG_INFO, "GEMDOS HDD emulation, %c: <-> %s.\n",
+					   'A'+DriveNumber, emudrives[i]->hd_emulation_dir);
 			emudrives[i]->drive_number = DriveNumber;
 			nNumDrives = i + 3;
 
@@ -711,7 +1467,7 @@ void GemDOS_InitDrives(void)
 		}
 		else
 		{
-			free(emudrives[i]);	// Deallocate Memory (save space)
+			GemDOS_FreeDrive(emudrives[i]);	// Deallocate Memory (save space)
 			emudrives[i] = NULL;
 		}
 	}
@@ -734,7 +1490,7 @@ void GemDOS_UnInitDrives(void)
 		{
 			if (emudrives[i])
 			{
-				free(emudrives[i]);    /* Release memory */
+				GemDOS_FreeDrive(emudrives[i]);    /* Release memory */
 				emudrives[i] = NULL;
 				nNumDrives -= 1;
 			}
@@ -756,6 +1512,10 @@ void GemDOS_MemorySnapShot_Capture(bool bSave)
 	int i;
 	bool bEmudrivesAvailable;
 
+	/* Files saved with the snapshot should be complete */
+	if (bSave)
+		GemDOS_FlushWrites(NULL);
+
 	/* Save/Restore the emudrives structure */
 	bEmudrivesAvailable = (emudrives != NULL);
 	MemorySnapShot_Store(&bEmudrivesAvailable, sizeof(bEmudrivesAvailable));
@@ -983,15 +1743,16 @@ static int GemDOS_FileName2HardDriveID(char *pszFileName)
 static char* match_host_dir_entry(const char *path, const char *name, bool pattern)
 {
 #define MAX_UTF8_NAME_LEN (3*(8+1+3)+1) /* UTF-8 can have up to 3 bytes per character */
-	struct dirent *entry;
+	DIRCACHE_DIR *dir;
+	const char *found = NULL;
 	char *match = NULL;
-	DIR *dir;
 	char nameHost[MAX_UTF8_NAME_LEN];
+	int i;
 
 	Str_AtariToHost(name, nameHost, MAX_UTF8_NAME_LEN, INVALID_CHAR);
 	name = nameHost;
 	
-	dir = opendir(path);
+	dir = GemDOS_DirCache_Get(path);
 	if (!dir)
 		return NULL;
 
@@ -1000,29 +1761,21 @@ static char* match_host_dir_entry(const char *path, const char *name, bool patte
 #endif
 	if (pattern)
 	{
-		while ((entry = readdir(dir)))
+		for (i = 0; i < dir->nentries; i++)
 		{
-			Str_DecomposedToPrecomposedUtf8(entry->d_name, entry->d_name);   /* for OSX */
-			if (fsfirst_match(name, entry->d_name))
+			if (fsfirst_match(name, dir->names[i]))
 			{
-				match = strdup(entry->d_name);
+				found = dir->names[i];
 				break;
 			}
 		}
 	}
 	else
 	{
-		while ((entry = readdir(dir)))
-		{
-			Str_DecomposedToPrecomposedUtf8(entry->d_name, entry->d_name);   /* for OSX */
-			if (strcasecmp(name, entry->d_name) == 0)
-			{
-				match = strdup(entry->d_name);
-				break;
-			}
-		}
+		found = GemDOS_DirCache_Lookup(dir, name);
 	}
-	closedir(dir);
+	if (found)
+		match = strdup(found);
 #if DEBUG_PATTERN_MATCH
 	fprintf(stderr, "-> '%s'\n", match);
 #endif
@@ -1384,6 +2137,11 @@ void GemDOS_CreateHardDriveFileName(int Drive, const char *pszFileName,
 			return;
 		}
 	}
+
+	/* copy a found archive file/dir to the drive overlay for the host file code */
+	if (emudrives[Drive-2]->zip_file && !strpbrk(filename, "?*"))
+		GemDOS_ZipMaterialize(pszDestName);
+
 	LOG_TRACE(TRACE_OS_GEMDOS, "GEMDOS: %s -> host: %s\n", pszFileName, pszDestName);
 }
 
@@ -1601,6 +2359,7 @@ static bool GemDOS_MkDir(Uint32 Params)
 		Regs[REG_D0] = GEMDOS_EOK;
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_PATH);
+	GemDOS_DirCache_Invalidate(psDirPath);
 	free(psDirPath);
 	return true;
 }
@@ -1650,9 +2409,13 @@ static bool GemDOS_RmDir(Uint32 Params)
 
 	/* Attempt to remove directory */
 	if (rmdir(psDirPath) == 0)
+	{
+		GemDOS_ZipDelete(psDirPath);
 		Regs[REG_D0] = GEMDOS_EOK;
+	}
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_PATH);
+	GemDOS_DirCache_Invalidate(psDirPath);
 	free(psDirPath);
 	return true;
 }
@@ -1804,6 +2567,9 @@ static bool GemDOS_Create(Uint32 Params)
 	
 	/* truncate and open for reading & writing */
 	FileHandles[Index].FileHandle = fopen(szActualFileName, "wb+");
+	GemDOS_DirCache_Invalidate(szActualFileName);
+	if (FileHandles[Index].FileHandle != NULL)
+		GemDOS_UpdateFileSize(Index, szActualFileName, 0, true);
 
 	if (FileHandles[Index].FileHandle != NULL)
 	{
@@ -1825,6 +2591,7 @@ static bool GemDOS_Create(Uint32 Params)
 		snprintf(FileHandles[Index].szActualName,
 			 sizeof(FileHandles[Index].szActualName),
 			 "%s", szActualFileName);
+		GemDOS_InitFileHandle(Index, false);
 
 		/* Return valid ST file handle from our range (from BASE_FILEHANDLE upwards) */
 		Regs[REG_D0] = Index+BASE_FILEHANDLE;
@@ -1874,6 +2641,7 @@ static bool GemDOS_Open(Uint32 Params)
 	};
 	int Drive, Index, Mode;
 	FILE *AutostartHandle;
+	bool bMap = false;
 
 	/* Find filename */
 	pszFileName = (char *)STRAM_ADDR(STMemory_ReadLong(Params));
@@ -1941,6 +2709,7 @@ static bool GemDOS_Open(Uint32 Params)
 		{
 			ModeStr = "rb";
 			RealMode = "read-only";
+			bMap = true;
 		}
 		else
 		{
@@ -1960,6 +2729,7 @@ static bool GemDOS_Open(Uint32 Params)
 			 "%s", szActualFileName);
 
 		GemDOS_UpdateCurrentProgram(Index);
+		GemDOS_InitFileHandle(Index, bMap);
 
 		/* Return valid ST file handle from our range (BASE_FILEHANDLE upwards) */
 		Regs[REG_D0] = Index+BASE_FILEHANDLE;
@@ -2037,7 +2807,7 @@ static bool GemDOS_Close(Uint32 Params)
 static bool GemDOS_Read(Uint32 Params)
 {
 	char *pBuffer;
-	long CurrentPos, FileSize, nBytesRead, nBytesLeft;
+	long nBytesRead, nBytesLeft;
 	Uint32 Addr;
 	Uint32 Size;
 	int Handle;
@@ -2058,6 +2828,7 @@ static bool GemDOS_Read(Uint32 Params)
 		/* assume it was TOS one -> redirect */
 		return false;
 	}
+	GemDOS_FlushWrites(FileHandles[Handle].szActualName);
 
 	/* Old TOS versions treat the Size parameter as signed */
 	if (TosVersion < 0x400 && (Size & 0x80000000))
@@ -2067,13 +2838,7 @@ static bool GemDOS_Read(Uint32 Params)
 		return true;
 	}
 	
-	/* To quick check to see where our file pointer is and how large the file is */
-	CurrentPos = ftell(FileHandles[Handle].FileHandle);
-	fseek(FileHandles[Handle].FileHandle, 0, SEEK_END);
-	FileSize = ftell(FileHandles[Handle].FileHandle);
-	fseek(FileHandles[Handle].FileHandle, CurrentPos, SEEK_SET);
-
-	nBytesLeft = FileSize-CurrentPos;
+	nBytesLeft = FileHandles[Handle].nFileSize - FileHandles[Handle].nFilePos;
 	
 	/* Check for bad size and End Of File */
 	if (Size <= 0 || nBytesLeft <= 0)
@@ -2094,14 +2859,27 @@ static bool GemDOS_Read(Uint32 Params)
 		Regs[REG_D0] = GEMDOS_ERANGE;
 		return true;
 	}
+	/* Mapped file is just copied */
+	if (FileHandles[Handle].pMapped)
+	{
+		memcpy(pBuffer, FileHandles[Handle].pMapped + FileHandles[Handle].nFilePos, Size);
+		STMemory_SetDirtyArea(Addr, Size);
+		FileHandles[Handle].nFilePos += Size;
+		Regs[REG_D0] = Size;
+		return true;
+	}
+
 	/* And read data in */
 	nBytesRead = fread(pBuffer, 1, Size, FileHandles[Handle].FileHandle);
+	STMemory_SetDirtyArea(Addr, nBytesRead);
+	FileHandles[Handle].nFilePos += nBytesRead;
 	
 	if (ferror(FileHandles[Handle].FileHandle))
 	{
 		Log_Printf(LOG_WARN, "GEMDOS failed to read from '%s'\n",
 			   FileHandles[Handle].szActualName );
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+		FileHandles[Handle].nFilePos = ftell(FileHandles[Handle].FileHandle);
 	} else
 		/* Return number of bytes read */
 		Regs[REG_D0] = nBytesRead;
@@ -2157,17 +2935,30 @@ static bool GemDOS_Write(Uint32 Params)
 	}
 
 	fp = FileHandles[Handle].FileHandle;
+	if (FileHandles[Handle].pMapped)
+		GemDOS_UnmapFileHandle(Handle);
 	nBytesWritten = fwrite(pBuffer, 1, Size, fp);
 	if (ferror(fp))
 	{
 		Log_Printf(LOG_WARN, "GEMDOS failed to write to '%s'\n",
 			   FileHandles[Handle].szActualName );
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+		FileHandles[Handle].nFilePos = ftell(fp);
 	}
 	else
 	{
-		fflush(fp);
+		if (ConfigureParams.HardDisk.nGemdosFlush == GEMDOS_FLUSH_WRITE)
+			fflush(fp);
+		else
+			FileHandles[Handle].bDirty = true;
 		Regs[REG_D0] = nBytesWritten;      /* OK */
+		FileHandles[Handle].nFilePos += nBytesWritten;
+	}
+	if (FileHandles[Handle].nFilePos > FileHandles[Handle].nFileSize)
+	{
+		FileHandles[Handle].nFileSize = FileHandles[Handle].nFilePos;
+		GemDOS_UpdateFileSize(Handle, FileHandles[Handle].szActualName,
+		                      FileHandles[Handle].nFileSize, false);
 	}
 	return true;
 }
@@ -2218,9 +3009,13 @@ static bool GemDOS_FDelete(Uint32 Params)
 
 	/* Now delete file?? */
 	if (unlink(psActualFileName) == 0)
+	{
+		GemDOS_ZipDelete(psActualFileName);
 		Regs[REG_D0] = GEMDOS_EOK;          /* OK */
+	}
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+	GemDOS_DirCache_Invalidate(psActualFileName);
 
 	free(psActualFileName);
 	return true;
@@ -2238,6 +3033,7 @@ static bool GemDOS_LSeek(Uint32 Params)
 	int Handle, Mode;
 	long nFileSize;
 	long nOldPos, nDestPos;
+	struct stat FileStat;
 	FILE *fhndl;
 
 	/* Read details from stack */
@@ -2256,13 +3052,21 @@ static bool GemDOS_LSeek(Uint32 Params)
 	}
 
 	fhndl = FileHandles[Handle].FileHandle;
+	GemDOS_FlushWrites(FileHandles[Handle].szActualName);
 
-	/* Save old position in file */
-	nOldPos = ftell(fhndl);
+	/* Old position in file */
+	nOldPos = FileHandles[Handle].nFilePos;
 
-	/* Determine the size of the file */
-	fseek(fhndl, 0L, SEEK_END);
-	nFileSize = ftell(fhndl);
+	/* Seeking from the end gets the current size of the file,
+	 * as it may have been changed by other host programs */
+	if (Mode == 2 && fstat(fileno(fhndl), &FileStat) == 0 && S_ISREG(FileStat.st_mode)
+	    && FileStat.st_size != FileHandles[Handle].nFileSize)
+	{
+		if (FileHandles[Handle].pMapped)
+			GemDOS_UnmapFileHandle(Handle);
+		FileHandles[Handle].nFileSize = FileStat.st_size;
+	}
+	nFileSize = FileHandles[Handle].nFileSize;
 
 	switch (Mode)
 	{
@@ -2270,23 +3074,26 @@ static bool GemDOS_LSeek(Uint32 Params)
 	 case 1: nDestPos = nOldPos + Offset; break;
 	 case 2: nDestPos = nFileSize + Offset; break; /* negative offset */
 	 default:
-		/* Restore old position and return error */
-		fseek(fhndl, nOldPos, SEEK_SET);
+		/* Keep old position and return error */
 		Regs[REG_D0] = GEMDOS_EINVFN;
 		return true;
 	}
 
 	if (nDestPos < 0 || nDestPos > nFileSize)
 	{
-		/* Restore old position and return error */
-		fseek(fhndl, nOldPos, SEEK_SET);
+		/* Keep old position and return error */
 		Regs[REG_D0] = GEMDOS_ERANGE;
 		return true;
 	}
 
 	/* Seek to new position and return offset from start of file */
-	fseek(fhndl, nDestPos, SEEK_SET);
-	Regs[REG_D0] = ftell(fhndl);
+	if (!FileHandles[Handle].pMapped && nDestPos != nOldPos)
+	{
+		if (fseek(fhndl, nDestPos, SEEK_SET) != 0)
+			nDestPos = ftell(fhndl);
+	}
+	FileHandles[Handle].nFilePos = nDestPos;
+	Regs[REG_D0] = nDestPos;
 
 	return true;
 }
@@ -2566,6 +3373,97 @@ static int GemDOS_Pexec(Uint32 Params)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Go through the relocation table of a program, like the cartridge code
+ * does, and when 'bApply' is set, relocate the program and clear the
+ * table bytes (some programs like GFA-Basic expect a clear memory).
+ * Return false if the table or a relocated long isn't within the TPA.
+ */
+static bool GemDOS_PexecWalkReloc(Uint32 Text, Uint32 Table, Uint32 HiTpa, bool bApply)
+{
+	Uint32 Addr, Offset;
+	Uint8 Byte;
+	int i;
+
+	if (Table < Text || Table > HiTpa - 4)
+		return false;
+
+	/* first offset is not necessarily word aligned */
+	Offset = 0;
+	for (i = 0; i < 4; i++)
+	{
+		Offset = (Offset << 8) | STMemory_ReadByte(Table);
+		if (bApply)
+			STMemory_WriteByte(Table, 0);
+		Table++;
+	}
+	if (!Offset)
+		return true;
+
+	Addr = Text + Offset;
+	for (;;)
+	{
+		if (Addr < Text || Addr > HiTpa - 4)
+			return false;
+		if (bApply)
+			STMemory_WriteLong(Addr, STMemory_ReadLong(Addr) + Text);
+		do
+		{
+			if (Table >= HiTpa)
+				return false;
+			Byte = STMemory_ReadByte(Table);
+			if (bApply)
+				STMemory_WriteByte(Table, 0);
+			Table++;
+			if (!Byte)
+				return true;
+			if (Byte == 1)
+				Addr += 254;
+		} while (Byte == 1);
+		Addr += Byte;
+	}
+}
+
+/**
+ * Relocate the program loaded by the cartridge Pexec code, and clear its
+ * BSS, instead of the slow 68k loops doing that in the cartridge.
+ * Called from OpCode_Pexec() with the basepage address, the relocation
+ * table address and the PRG header absflag. Return false if this isn't
+ * enabled or the program isn't fully within ST RAM, nothing is then
+ * changed and the cartridge code does the work.
+ */
+bool GemDOS_PexecRelocate(Uint32 Basepage, Uint32 RelocTable, Uint16 AbsFlag)
+{
+	Uint32 HiTpa, Text, BssStart, BssLen;
+
+	if (!ConfigureParams.HardDisk.bGemdosFastPexec)
+		return false;
+
+	HiTpa = STMemory_ReadLong(Basepage + 4);
+	Text = STMemory_ReadLong(Basepage + 8);
+	BssStart = STMemory_ReadLong(Basepage + 24);
+	BssLen = STMemory_ReadLong(Basepage + 28);
+	if (HiTpa <= Basepage || !STMemory_ValidArea(Basepage, HiTpa - Basepage)
+	    || Text < Basepage || BssStart < Text || BssStart > HiTpa
+	    || BssLen > HiTpa - BssStart)
+		return false;
+
+	if (!AbsFlag)
+	{
+		if (!GemDOS_PexecWalkReloc(Text, RelocTable, HiTpa, false))
+			return false;
+		GemDOS_PexecWalkReloc(Text, RelocTable, HiTpa, true);
+	}
+
+	memset((void *)STRAM_ADDR(BssStart), 0, BssLen);
+	STMemory_SetDirtyArea(BssStart, BssLen);
+
+	LOG_TRACE(TRACE_OS_GEMDOS, "GEMDOS Pexec: relocated program at 0x%x\n", Text);
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * GEMDOS Search Next
@@ -2573,7 +3471,7 @@ static int GemDOS_Pexec(Uint32 Params)
  */
 static bool GemDOS_SNext(void)
 {
-	struct dirent **temp;
+	char **temp;
 	Uint32 nDTA;
 	int Index;
 	int ret;
@@ -2645,11 +3543,11 @@ static bool GemDOS_SFirst(Uint32 Params)
 	char szActualFileName[MAX_GEMDOS_PATH];
 	char *pszFileName;
 	const char *dirmask;
-	struct dirent **files;
+	DIRCACHE_DIR *dir;
+	char **files;
 	Uint32 nDTA;
 	int Drive;
-	DIR *fsdir;
-	int i,j,count;
+	int i,j;
 
 	/* Find filename to search for */
 	pszFileName = (char *)STRAM_ADDR(STMemory_ReadLong(Params));
@@ -2680,6 +3578,7 @@ static bool GemDOS_SFirst(Uint32 Params)
 		return true;
 	}
 	pDTA = (DTA *)STRAM_ADDR(nDTA);
+	STMemory_SetDirtyArea(nDTA, sizeof(DTA));
 
 	/* Populate DTA, set index for our use */
 	do_put_mem_word(pDTA->index, DTAIndex);
@@ -2704,42 +3603,35 @@ static bool GemDOS_SFirst(Uint32 Params)
 	 * TODO: host path may not fit into InternalDTA
 	 */
 	fsfirst_dirname(szActualFileName, InternalDTAs[DTAIndex].path);
-	fsdir = opendir(InternalDTAs[DTAIndex].path);
+	dir = GemDOS_DirCache_Get(InternalDTAs[DTAIndex].path);
 
-	if (fsdir == NULL)
+	if (dir == NULL)
 	{
 		Regs[REG_D0] = GEMDOS_EPTHNF;        /* Path not found */
 		return true;
 	}
-	/* close directory */
-	closedir(fsdir);
 
-	count = scandir(InternalDTAs[DTAIndex].path, &files, 0, alphasort);
-	/* File (directory actually) not found */
-	if (count < 0)
+	InternalDTAs[DTAIndex].centry = 0;          /* current entry is 0 */
+	dirmask = fsfirst_dirmask(szActualFileName);/* directory mask part */
+
+	/* copy the entries that match our mask (cached names can change
+	 * before the Fsnext() calls) */
+	files = malloc((dir->nentries + 1) * sizeof(char *));
+	if (!files)
 	{
-		Regs[REG_D0] = GEMDOS_EFILNF;
+		Regs[REG_D0] = GEMDOS_ENSMEM;
 		return true;
 	}
-
-	InternalDTAs[DTAIndex].centry = 0;          /* current entry is 0 */
-	dirmask = fsfirst_dirmask(szActualFileName);/* directory mask part */
 	InternalDTAs[DTAIndex].found = files;       /* get files */
 
-	/* count & copy the entries that match our mask and discard the rest */
 	j = 0;
-	for (i=0; i < count; i++)
+	for (i=0; i < dir->nentries; i++)
 	{
-		Str_DecomposedToPrecomposedUtf8(files[i]->d_name, files[i]->d_name);   /* for OSX */
-		if (fsfirst_match(dirmask, files[i]->d_name))
-		{
-			InternalDTAs[DTAIndex].found[j] = files[i];
-			j++;
-		}
-		else
+		if (fsfirst_match(dirmask, dir->names[i]))
 		{
-			free(files[i]);
-			files[i] = NULL;
+			files[j] = strdup(dir->names[i]);
+			if (files[j])
+				j++;
 		}
 	}
 	InternalDTAs[DTAIndex].nentries = j; /* set number of legal entries */
@@ -2807,9 +3699,14 @@ static bool GemDOS_Rename(Uint32 Params)
 
 	/* Rename files */
 	if (rename(szOldActualFileName,szNewActualFileName) == 0)
+	{
+		GemDOS_ZipDelete(szOldActualFileName);
 		Regs[REG_D0] = GEMDOS_EOK;
+	}
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+	GemDOS_DirCache_Invalidate(szOldActualFileName);
+	GemDOS_DirCache_Invalidate(szNewActualFileName);
 	return true;
 }
 
@@ -3118,7 +4015,7 @@ void GemDOS_Info(Uint32 bShowOpcodes)
 		for (j = 0; j < entries; j++)
 		{
 			fprintf(stderr, "  - %d: %s%s\n",
-				j, InternalDTAs[i].found[j]->d_name,
+				j, InternalDTAs[i].found[j],
 				j == centry ? " *" : "");
 		}
 		fprintf(stderr, "  Fsnext entry = %d.\n", centry);
@@ -3198,6 +4095,20 @@ void GemDOS_OpCode(void)
 	GemDOSCall = STMemory_ReadWord(Params);
 	Params += SIZE_WORD;
 
+	/* Calls accessing host files by name need the buffered writes */
+	switch(GemDOSCall)
+	{
+	 case 0x3c:	/* Fcreate */
+	 case 0x3d:	/* Fopen */
+	 case 0x41:	/* Fdelete */
+	 case 0x43:	/* Fattrib */
+	 case 0x4b:	/* Pexec */
+	 case 0x4e:	/* Fsfirst */
+	 case 0x56:	/* Frename */
+		GemDOS_FlushWrites(NULL);
+		break;
+	}
+
 	/* Intercept call */
 	switch(GemDOSCall)
 	{
@@ -3399,6 +4310,7 @@ void GemDOS_OpCode(void)
 void GemDOS_Boot(void)
 {
 	bInitGemDOS = true;
+	Main_TurboBootEnd();
 
 	LOG_TRACE(TRACE_OS_GEMDOS, "Gemdos_Boot() at PC 0x%X\n", M68000_GetPC() );
 
@@ -17,6 +17,9 @@
 #include <stdlib.h>
 #include <SDL.h>
 
+#include "main.h"
+#include "log.h"
+#include "memorySnapShot.h"
 #include "hd6301_cpu.h"
 
 
@@ -611,6 +614,13 @@ static Uint8	hd6301_intREG[32];
 static Uint8	hd6301_intRAM[128];
 static Uint8	hd6301_intROM[4096];
 
+static bool	hd6301_halted;
+static Uint16	hd6301_counter;			/* Free running counter ($09-$0a) */
+
+/* Internal registers handled outside of the cpu core (ports, SCI, ...) */
+static int	(*hd6301_read_register)(Uint8 reg);
+static void	(*hd6301_write_register)(Uint8 reg, Uint8 value);
+
 
 /**********************************
  *	Emulator kernel
@@ -622,6 +632,83 @@ static Uint8	hd6301_intROM[4096];
 void hd6301_init_cpu(void)
 {
 	hd6301_reg_CCR = 0xc0;
+	hd6301_halted = false;
+}
+
+/**
+ * Set the functions handling the internal registers ($00-$1f).
+ * read_reg returns -1 for registers it doesn't handle, which are then
+ * read from hd6301_intREG[].
+ */
+void hd6301_set_register_handlers(int (*read_reg)(Uint8 reg), void (*write_reg)(Uint8 reg, Uint8 value))
+{
+	hd6301_read_register = read_reg;
+	hd6301_write_register = write_reg;
+}
+
+/**
+ * Start executing code at 'pc', as if it was called from the ROM :
+ * a return address in the ROM is pushed on the stack, so a final 'rts'
+ * ends the execution (see hd6301_stopped).
+ */
+void hd6301_start(Uint16 pc)
+{
+	hd6301_init_cpu();
+	hd6301_reg_SP = 0xff;
+	hd6301_write_memory(hd6301_reg_SP--, 0x00);
+	hd6301_write_memory(hd6301_reg_SP--, 0xf0);
+	hd6301_reg_PC = pc;
+}
+
+/**
+ * Write a byte to the internal RAM (used for the IKBD's memory load command)
+ */
+void hd6301_write_ram(Uint16 addr, Uint8 value)
+{
+	if ((addr >= 0x80) && (addr <= 0xff))
+		hd6301_intRAM[addr-0x80] = value;
+}
+
+/**
+ * Return true if the cpu can't execute code anymore : an unknown
+ * instruction was found, or the code jumped to the (not emulated) ROM.
+ */
+bool hd6301_stopped(void)
+{
+	return hd6301_halted || hd6301_reg_PC >= 0xf000;
+}
+
+/**
+ * Execute instructions for 'cycles' clock cycles.
+ * Return the number of cycles executed above 'cycles' (<= 0), to be
+ * removed from the next call.
+ */
+int hd6301_run(int cycles)
+{
+	while (cycles > 0 && !hd6301_stopped())
+	{
+		hd6301_execute_one_instruction();
+		cycles -= hd6301_opcode.op_n_cycles;
+		hd6301_counter += hd6301_opcode.op_n_cycles;
+	}
+	return cycles > 0 ? 0 : cycles;
+}
+
+/**
+ * Save/Restore snapshot of the cpu state
+ */
+void hd6301_MemorySnapShot_Capture(bool bSave)
+{
+	MemorySnapShot_Store(&hd6301_reg_A, sizeof(hd6301_reg_A));
+	MemorySnapShot_Store(&hd6301_reg_B, sizeof(hd6301_reg_B));
+	MemorySnapShot_Store(&hd6301_reg_X, sizeof(hd6301_reg_X));
+	MemorySnapShot_Store(&hd6301_reg_SP, sizeof(hd6301_reg_SP));
+	MemorySnapShot_Store(&hd6301_reg_PC, sizeof(hd6301_reg_PC));
+	MemorySnapShot_Store(&hd6301_reg_CCR, sizeof(hd6301_reg_CCR));
+	MemorySnapShot_Store(&hd6301_intREG, sizeof(hd6301_intREG));
+	MemorySnapShot_Store(&hd6301_intRAM, sizeof(hd6301_intRAM));
+	MemorySnapShot_Store(&hd6301_halted, sizeof(hd6301_halted));
+	MemorySnapShot_Store(&hd6301_counter, sizeof(hd6301_counter));
 }
 
 /**
@@ -636,13 +723,15 @@ void hd6301_execute_one_instruction(void)
 
 	/* disasm opcode ? */
 #ifdef HD6301_DISASM
-	hd6301_disasm();
+	if (LOG_TRACE_LEVEL(TRACE_IKBD_EXEC))
+		hd6301_disasm();
 #endif
 	/* execute opcode  */
 	hd6301_opcode.op_func();
 
 #ifdef HD6301_DISPLAY_REGS
-	hd6301_display_registers();
+	if (LOG_TRACE_LEVEL(TRACE_IKBD_EXEC))
+		hd6301_display_registers();
 #endif
 
 	/* Increment instruction cycles */
@@ -665,6 +754,14 @@ static Uint8 hd6301_read_memory(Uint16 addr)
 {
 	/* Internal registers */
 	if (addr <= 0x1f) {
+		int value = hd6301_read_register ? hd6301_read_register(addr) : -1;
+
+		if (value >= 0)
+			return value;
+		if (addr == 0x09)
+			return hd6301_counter >> 8;
+		if (addr == 0x0a)
+			return hd6301_counter & 0xff;
 		return hd6301_intREG[addr];
 	}
 
@@ -678,8 +775,8 @@ static Uint8 hd6301_read_memory(Uint16 addr)
 		return hd6301_intROM[addr-0xf000];
 	}
 
-	fprintf(stderr, "hd6301: 0x%04x: 0x%04x illegal memory address\n", hd6301_reg_PC, addr);
-	exit(-1);
+	LOG_TRACE(TRACE_IKBD_EXEC, "hd6301: 0x%04x: 0x%04x illegal memory address\n", hd6301_reg_PC, addr);
+	return 0xff;
 }
 
 /**
@@ -690,6 +787,8 @@ static void hd6301_write_memory (Uint16 addr, Uint8 value)
 	/* Internal registers */
 	if (addr <= 0x1f) {
 		hd6301_intREG[addr] = value;
+		if (hd6301_write_register)
+			hd6301_write_register(addr, value);
 	}
 
 	/* Internal RAM */
@@ -699,13 +798,12 @@ static void hd6301_write_memory (Uint16 addr, Uint8 value)
 
 	/* Internal ROM */
 	else if (addr >= 0xf000) {
-		fprintf(stderr, "hd6301: 0x%04x: attempt to write to rom\n", addr);
+		LOG_TRACE(TRACE_IKBD_EXEC, "hd6301: 0x%04x: attempt to write to rom\n", addr);
 	}
 
 	/* Illegal address */
 	else {
-		fprintf(stderr, "hd6301: 0x%04x: write to illegal address\n", addr);
-		exit(-1);
+		LOG_TRACE(TRACE_IKBD_EXEC, "hd6301: 0x%04x: write to illegal address\n", addr);
 	}
 }
 
@@ -726,8 +824,8 @@ static Uint16 hd6301_get_memory_ext(void)
  */
 static void hd6301_undefined(void)
 {
-	fprintf(stderr, "hd6301: 0x%04x: 0x%02x unknown instruction\n", hd6301_reg_PC, hd6301_cur_inst);
-	exit(-1);  /* TODO: Trap the error correctly */
+	LOG_TRACE(TRACE_IKBD_EXEC, "hd6301: 0x%04x: 0x%02x unknown instruction\n", hd6301_reg_PC, hd6301_cur_inst);
+	hd6301_halted = true;
 }
 
 /**
@@ -2249,12 +2347,10 @@ static void hd6301_tst_ind(void)
  */
 static void hd6301_jmp_ind(void)
 {
-	Uint8  value;
 	Uint16 addr;
 
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
-	value = hd6301_read_memory(addr);
-	hd6301_reg_PC = value;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -2594,13 +2690,10 @@ static void hd6301_tst_ext(void)
  */
 static void hd6301_jmp_ext(void)
 {
-	Uint8  value;
 	Uint16 addr;
 
 	addr = hd6301_get_memory_ext();
-	value = hd6301_read_memory(addr);
-
-	hd6301_reg_PC = value;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3139,7 +3232,7 @@ static void hd6301_jsr_dir(void)
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
 
 	addr = hd6301_read_memory(hd6301_reg_PC + 1);
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3446,7 +3539,7 @@ static void hd6301_jsr_ind(void)
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
 
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3749,11 +3842,11 @@ static void hd6301_jsr_ext(void)
 {
 	Uint16 addr;
 
-	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) & 0xff);
-	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
+	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 3) & 0xff);
+	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 3) >> 8);
 
 	addr = hd6301_get_memory_ext();
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -34,7 +34,13 @@ struct hd6301_opcode_t {
 
 /* Functions */
 extern void hd6301_init_cpu(void);
+extern void hd6301_set_register_handlers(int (*read_reg)(Uint8 reg), void (*write_reg)(Uint8 reg, Uint8 value));
+extern void hd6301_start(Uint16 pc);
+extern void hd6301_write_ram(Uint16 addr, Uint8 value);
+extern bool hd6301_stopped(void);
+extern int hd6301_run(int cycles);
 extern void hd6301_execute_one_instruction(void);
+extern void hd6301_MemorySnapShot_Capture(bool bSave);
 
 /* HF6301 Disasm and debug code */
 extern void hd6301_disasm(void);
@@ -14,10 +14,14 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
 #include "file.h"
 #include "fdc.h"
 #include "hdc.h"
+#include "imageMap.h"
+#include "blockCache.h"
 #include "ioMem.h"
 #include "log.h"
+#include "m68000.h"
 #include "memorySnapShot.h"
 #include "mfp.h"
+#include "sparseImage.h"
 #include "stMemory.h"
 #include "tos.h"
 #include "statusbar.h"
@@ -55,6 +59,9 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
 typedef struct {
 	bool enabled;
 	FILE *image_file;
+	IMAGEMAP map;               /* mapping used with the disk overlay */
+	BLOCKCACHE *cache;          /* sector cache, NULL if disabled */
+	SPARSEIMAGE sparse;         /* index and clusters of sparse images */
 	Uint32 nLastBlockAddr;      /* The specified sector number */
 	bool bSetLastBlockAddr;
 	Uint8 nLastError;
@@ -156,6 +163,20 @@ static inline char *HDC_CmdInfoStr(SCSI_CTRLR *ctr)
 }
 
 
+/**
+ * Check the current sector number and move the file position there.
+ * Return false if the sector is not valid.
+ */
+static bool HDC_SeekSector(SCSI_DEV *dev)
+{
+	if (dev->nLastBlockAddr >= dev->hdSize)
+		return false;
+	/* Mapped, cached and sparse images don't use the file position */
+	if (ImageMap_IsOpen(&dev->map) || dev->cache || SparseImage_IsOpen(&dev->sparse))
+		return true;
+	return fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) == 0;
+}
+
 /**
  * Seek - move to a sector
  */
@@ -168,8 +189,7 @@ static void HDC_Cmd_Seek(SCSI_CTRLR *ctr)
 	LOG_TRACE(TRACE_SCSI_CMD, "HDC: SEEK (%s), LBA=%i",
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr);
 
-	if (dev->nLastBlockAddr < dev->hdSize &&
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) == 0)
+	if (HDC_SeekSector(dev))
 	{
 		LOG_TRACE(TRACE_SCSI_CMD, " -> OK\n");
 		ctr->returnCode = HD_STATUS_OK;
@@ -364,6 +384,7 @@ static void HDC_Cmd_ModeSense(SCSI_CTRLR *ctr)
 		STRam[nDmaAddr+13] = 0;
 		STRam[nDmaAddr+14] = 0;
 		STRam[nDmaAddr+15] = 0;
+		STMemory_SetDirtyArea(nDmaAddr, 16);
 
 		FDC_WriteDMAAddress(nDmaAddr + 16);
 
@@ -413,6 +434,7 @@ static void HDC_Cmd_ReadCapacity(SCSI_CTRLR *ctr)
 	if (STMemory_ValidArea(nDmaAddr, 8))
 	{
 		int nSectors = dev->hdSize - 1;
+		STMemory_SetDirtyArea(nDmaAddr, 8);
 		STRam[nDmaAddr++] = (nSectors >> 24) & 0xFF;
 		STRam[nDmaAddr++] = (nSectors >> 16) & 0xFF;
 		STRam[nDmaAddr++] = (nSectors >> 8) & 0xFF;
@@ -455,8 +477,7 @@ static void HDC_Cmd_WriteSector(SCSI_CTRLR *ctr)
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr, nDmaAddr);
 
 	/* seek to the position */
-	if (dev->nLastBlockAddr >= dev->hdSize ||
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) != 0)
+	if (!HDC_SeekSector(dev))
 	{
 		ctr->returnCode = HD_STATUS_ERROR;
 		dev->nLastError = HD_REQSENS_INVADDR;
@@ -467,8 +488,18 @@ static void HDC_Cmd_WriteSector(SCSI_CTRLR *ctr)
 #ifndef DISALLOW_HDC_WRITE
 		if (STMemory_ValidArea(nDmaAddr, 512 * HDC_GetCount(ctr)))
 		{
-			n = fwrite(&STRam[nDmaAddr], 512,
-				   HDC_GetCount(ctr), dev->image_file);
+			if (ImageMap_IsOpen(&dev->map))
+				n = ImageMap_Write(&dev->map, &STRam[nDmaAddr],
+				                   dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else if (SparseImage_IsOpen(&dev->sparse))
+				n = SparseImage_Write(&dev->sparse, &STRam[nDmaAddr],
+				                      dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else if (dev->cache)
+				n = BlockCache_Write(dev->cache, &STRam[nDmaAddr],
+				                     dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else
+				n = fwrite(&STRam[nDmaAddr], 512,
+					   HDC_GetCount(ctr), dev->image_file);
 		}
 		else
 		{
@@ -514,8 +545,7 @@ static void HDC_Cmd_ReadSector(SCSI_CTRLR *ctr)
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr, nDmaAddr);
 
 	/* seek to the position */
-	if (dev->nLastBlockAddr >= dev->hdSize ||
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) != 0)
+	if (!HDC_SeekSector(dev))
 	{
 		ctr->returnCode = HD_STATUS_ERROR;
 		dev->nLastError = HD_REQSENS_INVADDR;
@@ -524,8 +554,19 @@ static void HDC_Cmd_ReadSector(SCSI_CTRLR *ctr)
 	{
 		if (STMemory_ValidArea(nDmaAddr, 512 * HDC_GetCount(ctr)))
 		{
-			n = fread(&STRam[nDmaAddr], 512,
-				   HDC_GetCount(ctr), dev->image_file);
+			if (ImageMap_IsOpen(&dev->map))
+				n = ImageMap_Read(&dev->map, &STRam[nDmaAddr],
+				                  dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else if (SparseImage_IsOpen(&dev->sparse))
+				n = SparseImage_Read(&dev->sparse, &STRam[nDmaAddr],
+				                     dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else if (dev->cache)
+				n = BlockCache_Read(dev->cache, &STRam[nDmaAddr],
+				                    dev->nLastBlockAddr, HDC_GetCount(ctr));
+			else
+				n = fread(&STRam[nDmaAddr], 512,
+					   HDC_GetCount(ctr), dev->image_file);
+			STMemory_SetDirtyArea(nDmaAddr, 512 * n);
 		}
 		else
 		{
@@ -573,6 +614,8 @@ static void HDC_EmulateCommandPacket(SCSI_CTRLR *ctr)
 {
 	SCSI_DEV *dev = &ctr->devs[ctr->target];
 
+	Main_TurboBootEnd();
+
 	switch (ctr->opcode)
 	{
 	 case HD_TEST_UNIT_RDY:
@@ -640,6 +683,7 @@ static void HDC_EmulateCommandPacket(SCSI_CTRLR *ctr)
 
 	/* Update the led each time a command is processed */
 	Statusbar_EnableHDLed( LED_STATE_ON );
+	M68000_TurboDiskAccess();
 }
 
 
@@ -663,13 +707,24 @@ int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel)
 	Uint32 start, sectors, total = 0;
 	int i, parts = 0;
 	long offset;
+	SPARSEIMAGE sparse;
+	bool ok;
 
 	if (!fp)
 		return 0;
 	offset = ftell(fp);
 
-	fseek(fp, 0, SEEK_SET);
-	if (fread(bootsector, sizeof(bootsector), 1, fp) != 1)
+	if (SparseImage_Open(&sparse, fp, true))
+	{
+		ok = SparseImage_Read(&sparse, bootsector, 0, 1) == 1;
+		SparseImage_Close(&sparse);
+	}
+	else
+	{
+		fseek(fp, 0, SEEK_SET);
+		ok = fread(bootsector, sizeof(bootsector), 1, fp) == 1;
+	}
+	if (!ok)
 	{
 		perror("HDC_PartitionCount");
 		return 0;
@@ -742,6 +797,7 @@ int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel)
 bool HDC_Init(void)
 {
 	off_t filesize;
+	bool bSparse;
 	int i;
 
 	memset(&AcsiBus, 0, sizeof(AcsiBus));
@@ -766,19 +822,63 @@ bool HDC_Init(void)
 			continue;
 		}
 
-		fp = fopen(filename, "rb+");
-		if (fp == NULL)
+		/* With the overlay, the image is only read, writes go to the delta.
+		 * Sparse images can't be mapped, they're opened read-only instead.
+		 */
+		fp = NULL;
+		bSparse = SparseImage_Check(filename);
+		if (bSparse && ConfigureParams.DiskImage.bDiskOverlay)
 		{
-			Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
-			continue;
+			Log_Printf(LOG_WARN, "Disk overlay not supported for sparse images, HD is read-only.\n");
+			fp = fopen(filename, "rb");
+			if (fp == NULL || !SparseImage_Open(&AcsiBus.devs[i].sparse, fp, true))
+			{
+				Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
+				if (fp)
+					fclose(fp);
+				continue;
+			}
 		}
-		if (!File_Lock(fp))
+		else if (ConfigureParams.DiskImage.bDiskOverlay)
 		{
-			Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
-			continue;
+			fp = fopen(filename, "rb");
+			if (fp && !ImageMap_Open(&AcsiBus.devs[i].map, fp, filesize))
+			{
+				Log_Printf(LOG_WARN, "Cannot map HD file, disk overlay disabled.\n");
+				fclose(fp);
+				fp = NULL;
+			}
+		}
+		if (fp == NULL)
+		{
+			fp = fopen(filename, "rb+");
+			if (fp == NULL)
+			{
+				Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
+				continue;
+			}
+			if (!File_Lock(fp))
+			{
+				Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
+				continue;
+			}
+			if (bSparse && !SparseImage_Open(&AcsiBus.devs[i].sparse, fp, false))
+			{
+				Log_Printf(LOG_ERROR, "ERROR: invalid sparse HD file!\n");
+				File_UnLock(fp);
+				fclose(fp);
+				continue;
+			}
 		}
 		nAcsiPartitions += HDC_PartitionCount(fp, TRACE_SCSI_CMD);
-		AcsiBus.devs[i].hdSize = filesize / 512;
+		if (SparseImage_IsOpen(&AcsiBus.devs[i].sparse))
+			AcsiBus.devs[i].hdSize = AcsiBus.devs[i].sparse.nSectors;
+		else
+		{
+			if (!ImageMap_IsOpen(&AcsiBus.devs[i].map))
+				AcsiBus.devs[i].cache = BlockCache_Open(fp, filesize / 512, false);
+			AcsiBus.devs[i].hdSize = filesize / 512;
+		}
 		AcsiBus.devs[i].image_file = fp;
 		AcsiBus.devs[i].enabled = true;
 		bAcsiEmuOn = true;
@@ -807,7 +907,18 @@ void HDC_UnInit(void)
 	{
 		if (!AcsiBus.devs[i].enabled)
 			continue;
-		File_UnLock(AcsiBus.devs[i].image_file);
+		if (ImageMap_IsOpen(&AcsiBus.devs[i].map))
+		{
+			Log_Printf(LOG_INFO, "Discarding the writes to ACSI hard drive image %d.\n", i);
+			ImageMap_Close(&AcsiBus.devs[i].map);
+		}
+		else
+		{
+			SparseImage_Close(&AcsiBus.devs[i].sparse);
+			BlockCache_Close(AcsiBus.devs[i].cache);
+			AcsiBus.devs[i].cache = NULL;
+			File_UnLock(AcsiBus.devs[i].image_file);
+		}
 		fclose(AcsiBus.devs[i].image_file);
 		AcsiBus.devs[i].image_file = NULL;
 		AcsiBus.devs[i].enabled = false;
@@ -9,6 +9,7 @@
 
 #include <SDL_endian.h>
 #include <errno.h>
+#include <inttypes.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -18,9 +19,12 @@
 #include "configuration.h"
 #include "file.h"
 #include "ide.h"
+#include "imageMap.h"
+#include "blockCache.h"
 #include "hdc.h" /* for partition counting */
 #include "m68000.h"
 #include "mfp.h"
+#include "sparseImage.h"
 #include "stMemory.h"
 #include "sysdeps.h"
 
@@ -317,6 +321,9 @@ struct BlockDriverState {
     void *change_opaque;
 
     FILE *fhndl;
+    IMAGEMAP map; /* mapping used with the disk overlay */
+    BLOCKCACHE *cache; /* sector cache, NULL if disabled */
+    SPARSEIMAGE sparse; /* index and clusters of sparse images */
     void *opaque;
 
     char filename[1024];
@@ -404,6 +411,12 @@ static void *qemu_memalign(size_t alignment, size_t size)
 static void bdrv_get_geometry(BlockDriverState *bs, uint64_t *nb_sectors_ptr)
 {
 	int64_t length;
+
+	if (SparseImage_IsOpen(&bs->sparse))
+	{
+		*nb_sectors_ptr = bs->sparse.nSectors;
+		return;
+	}
 	length = File_Length(bs->filename);
 
 	if (length < 0)
@@ -488,8 +501,17 @@ static int bdrv_read(BlockDriverState *bs, int64_t sector_num,
 
 	len = nb_sectors * 512;
 
-	fseeko(bs->fhndl, sector_num*512, SEEK_SET);
-	ret = fread(buf, 1, len, bs->fhndl);
+	if (ImageMap_IsOpen(&bs->map))
+		ret = ImageMap_Read(&bs->map, buf, sector_num, nb_sectors) * 512;
+	else if (SparseImage_IsOpen(&bs->sparse))
+		ret = SparseImage_Read(&bs->sparse, buf, sector_num, nb_sectors) * 512;
+	else if (bs->cache)
+		ret = BlockCache_Read(bs->cache, buf, sector_num, nb_sectors) * 512;
+	else
+	{
+		fseeko(bs->fhndl, sector_num*512, SEEK_SET);
+		ret = fread(buf, 1, len, bs->fhndl);
+	}
 	if (ret != len)
 	{
 		fprintf(stderr,"IDE: bdrv_read error (%d != %d length) at sector %lu!\n", ret, len, (unsigned long)sector_num);
@@ -522,8 +544,17 @@ static int bdrv_write(BlockDriverState *bs, int64_t sector_num,
 
 	len = nb_sectors * 512;
 
-	fseeko(bs->fhndl, sector_num*512, SEEK_SET);
-	ret = fwrite(buf, 1, len, bs->fhndl);
+	if (ImageMap_IsOpen(&bs->map))
+		ret = ImageMap_Write(&bs->map, buf, sector_num, nb_sectors) * 512;
+	else if (SparseImage_IsOpen(&bs->sparse))
+		ret = SparseImage_Write(&bs->sparse, buf, sector_num, nb_sectors) * 512;
+	else if (bs->cache)
+		ret = BlockCache_Write(bs->cache, buf, sector_num, nb_sectors) * 512;
+	else
+	{
+		fseeko(bs->fhndl, sector_num*512, SEEK_SET);
+		ret = fwrite(buf, 1, len, bs->fhndl);
+	}
 	if (ret != len)
 	{
 		fprintf(stderr,"IDE: bdrv_write error (%d != %d length) at sector %lu!\n", ret, len,  (unsigned long)sector_num);
@@ -546,6 +577,47 @@ static int bdrv_open(BlockDriverState *bs, const char *filename, int flags)
 
 	bs->read_only = 0;
 
+	/* Sparse images can't be mapped for the overlay, use them read-only */
+	if (SparseImage_Check(filename))
+	{
+		if (ConfigureParams.DiskImage.bDiskOverlay)
+		{
+			Log_Printf(LOG_WARN, "Disk overlay not supported for sparse images, HD is read-only.\n");
+			bs->fhndl = fopen(filename, "rb");
+			bs->read_only = 1;
+		}
+		else
+		{
+			bs->fhndl = fopen(filename, "rb+");
+			if (bs->fhndl && !File_Lock(bs->fhndl))
+			{
+				Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
+				fclose(bs->fhndl);
+				bs->fhndl = NULL;
+			}
+		}
+		if (bs->fhndl && !SparseImage_Open(&bs->sparse, bs->fhndl, bs->read_only))
+		{
+			Log_Printf(LOG_ERROR, "ERROR: invalid sparse HD file!\n");
+			if (!bs->read_only)
+				File_UnLock(bs->fhndl);
+			fclose(bs->fhndl);
+			bs->fhndl = NULL;
+		}
+		goto opened;
+	}
+
+	/* With the overlay, the image is only read, writes go to the delta */
+	if (ConfigureParams.DiskImage.bDiskOverlay)
+	{
+		bs->fhndl = fopen(filename, "rb");
+		if (bs->fhndl && ImageMap_Open(&bs->map, bs->fhndl, File_Length(filename)))
+			goto opened;
+		Log_Printf(LOG_WARN, "Cannot map HD file, disk overlay disabled.\n");
+		if (bs->fhndl)
+			fclose(bs->fhndl);
+	}
+
 	bs->fhndl = fopen(filename, "rb+");
 
 	if (!bs->fhndl) {
@@ -562,6 +634,11 @@ static int bdrv_open(BlockDriverState *bs, const char *filename, int flags)
 		bs->fhndl = NULL;
 	}
 
+	if (bs->fhndl)
+		bs->cache = BlockCache_Open(bs->fhndl, File_Length(filename) / 512,
+		                            bs->read_only);
+
+opened:
 	/* call the change callback */
 	bs->media_changed = 1;
 	if (bs->change_cb)
@@ -572,12 +649,28 @@ static int bdrv_open(BlockDriverState *bs, const char *filename, int flags)
 
 static void bdrv_flush(BlockDriverState *bs)
 {
-	fflush(bs->fhndl);
+	if (SparseImage_IsOpen(&bs->sparse))
+		SparseImage_Flush(&bs->sparse);
+	else if (bs->cache)
+		BlockCache_Flush(bs->cache);
+	else if (!ImageMap_IsOpen(&bs->map))
+		fflush(bs->fhndl);
 }
 
 static void bdrv_close(BlockDriverState *bs)
 {
-	File_UnLock(bs->fhndl);
+	if (ImageMap_IsOpen(&bs->map))
+	{
+		Log_Printf(LOG_INFO, "Discarding the writes to IDE hard drive image %s\n", bs->filename);
+		ImageMap_Close(&bs->map);
+	}
+	else
+	{
+		SparseImage_Close(&bs->sparse);
+		BlockCache_Close(bs->cache);
+		bs->cache = NULL;
+		File_UnLock(bs->fhndl);
+	}
 	fclose(bs->fhndl);
 	bs->fhndl = NULL;
 }
@@ -902,10 +995,14 @@ typedef struct IDEState
 	int io_buffer_index;
 	int lba;
 	int cd_sector_size;
+	int cd_buffer_end;	/* end of the CD sectors read in io_buffer */
+	int cd_raw_slots;	/* raw sector slots of io_buffer with sync/ECC set */
 	/* ATA DMA state */
 	int io_buffer_size;
 	/* PIO transfer handling */
 	int req_nb_sectors; /* number of sectors per interrupt */
+	uint8_t *read_ptr;  /* sectors already read in io_buffer ... */
+	int read_count;     /* ... and their number */
 	EndTransferFunc *end_transfer_func;
 	uint8_t *data_ptr;
 	uint8_t *data_end;
@@ -1212,14 +1309,26 @@ static void ide_sector_read(IDEState *s)
 
 		if (n > s->req_nb_sectors)
 			n = s->req_nb_sectors;
-		ret = bdrv_read(s->bs, sector_num, s->io_buffer, n);
-		if (ret != 0)
+		/* Read as many sectors of the command as fit in io_buffer
+		 * at once, next transfers then take them from there */
+		if (s->read_count < n)
 		{
-			ide_abort_command(s);
-			ide_set_irq(s);
-			return;
+			s->read_count = s->nsector;
+			if (s->read_count > MAX_MULT_SECTORS)
+				s->read_count = MAX_MULT_SECTORS / n * n;
+			ret = bdrv_read(s->bs, sector_num, s->io_buffer, s->read_count);
+			if (ret != 0)
+			{
+				s->read_count = 0;
+				ide_abort_command(s);
+				ide_set_irq(s);
+				return;
+			}
+			s->read_ptr = s->io_buffer;
 		}
-		ide_transfer_start(s, s->io_buffer, 512 * n, ide_sector_read);
+		ide_transfer_start(s, s->read_ptr, 512 * n, ide_sector_read);
+		s->read_ptr += 512 * n;
+		s->read_count -= n;
 		ide_set_irq(s);
 		ide_set_sector(s, sector_num + n);
 		s->nsector -= n;
@@ -1334,21 +1443,36 @@ static void cd_data_to_raw(uint8_t *buf, int lba)
 	memset(buf, 0, 288);
 }
 
-static int cd_read_sector(BlockDriverState *bs, int lba, uint8_t *buf,
-                          int sector_size)
+/* Read 'count' sectors at once into io_buffer */
+static int cd_read_sectors(IDEState *s, int lba, int count)
 {
-	int ret;
+	uint8_t *buf;
+	int ret, i;
 
-	switch (sector_size)
+	switch (s->cd_sector_size)
 	{
 	case 2048:
-		ret = bdrv_read(bs, (int64_t)lba << 2, buf, 4);
+		ret = bdrv_read(s->bs, (int64_t)lba << 2, s->io_buffer, 4 * count);
 		break;
 	case 2352:
-		ret = bdrv_read(bs, (int64_t)lba << 2, buf + 16, 4);
-		if (ret < 0)
-			return ret;
-		cd_data_to_raw(buf, lba);
+		for (i = 0; i < count; i++)
+		{
+			buf = s->io_buffer + i * 2352;
+			ret = bdrv_read(s->bs, (int64_t)(lba + i) << 2, buf + 16, 4);
+			if (ret < 0)
+				return ret;
+			/* Sync and ECC areas stay valid until the end of the
+			 * command, only the header needs to be updated after */
+			if (i >= s->cd_raw_slots)
+			{
+				cd_data_to_raw(buf, lba + i);
+				s->cd_raw_slots = i + 1;
+			}
+			else
+			{
+				lba_to_msf(buf + 12, lba + i);
+			}
+		}
 		break;
 	default:
 		ret = -EIO;
@@ -1375,7 +1499,7 @@ static void ide_atapi_io_error(IDEState *s, int ret)
 /* The whole ATAPI transfer logic is handled in this function */
 static void ide_atapi_cmd_reply_end(IDEState *s)
 {
-	int byte_count_limit, size, ret;
+	int byte_count_limit, size, ret, n;
 
 	LOG_TRACE(TRACE_IDE, "IDE: ATAPI reply tx_size=%d elem_tx_size=%d index=%d\n",
 	       s->packet_transfer_size,
@@ -1393,24 +1517,31 @@ static void ide_atapi_cmd_reply_end(IDEState *s)
 	}
 	else
 	{
-		/* see if a new sector must be read */
-		if (s->lba != -1 && s->io_buffer_index >= s->cd_sector_size)
+		/* see if new sectors must be read: read as many sectors
+		 * of the command as fit in io_buffer at once */
+		if (s->lba != -1 && s->io_buffer_index >= s->cd_buffer_end)
 		{
-			ret = cd_read_sector(s->bs, s->lba, s->io_buffer, s->cd_sector_size);
+			n = s->packet_transfer_size / s->cd_sector_size;
+			if (n > MAX_MULT_SECTORS * 512 / s->cd_sector_size)
+				n = MAX_MULT_SECTORS * 512 / s->cd_sector_size;
+			if (n < 1)
+				n = 1;
+			ret = cd_read_sectors(s, s->lba, n);
 			if (ret < 0)
 			{
 				ide_transfer_stop(s);
 				ide_atapi_io_error(s, ret);
 				return;
 			}
-			s->lba++;
+			s->lba += n;
 			s->io_buffer_index = 0;
+			s->cd_buffer_end = n * s->cd_sector_size;
 		}
 		if (s->elementary_transfer_size > 0)
 		{
 			/* there are some data left to transmit in this elementary
 			   transfer */
-			size = s->cd_sector_size - s->io_buffer_index;
+			size = s->cd_buffer_end - s->io_buffer_index;
 			if (size > s->elementary_transfer_size)
 				size = s->elementary_transfer_size;
 			ide_transfer_start(s, s->io_buffer + s->io_buffer_index,
@@ -1439,11 +1570,11 @@ static void ide_atapi_cmd_reply_end(IDEState *s)
 			s->lcyl = size;
 			s->hcyl = size >> 8;
 			s->elementary_transfer_size = size;
-			/* we cannot transmit more than one sector at a time */
+			/* we cannot transmit more than the read sectors at a time */
 			if (s->lba != -1)
 			{
-				if (size > (s->cd_sector_size - s->io_buffer_index))
-					size = (s->cd_sector_size - s->io_buffer_index);
+				if (size > (s->cd_buffer_end - s->io_buffer_index))
+					size = (s->cd_buffer_end - s->io_buffer_index);
 			}
 			ide_transfer_start(s, s->io_buffer + s->io_buffer_index,
 			                   size, ide_atapi_cmd_reply_end);
@@ -1467,6 +1598,7 @@ static void ide_atapi_cmd_reply(IDEState *s, int size, int max_size)
 	s->io_buffer_size = size;    /* dma: send the reply data as one chunk */
 	s->elementary_transfer_size = 0;
 	s->io_buffer_index = 0;
+	s->cd_buffer_end = s->cd_sector_size;
 
 	s->status = READY_STAT;
 	ide_atapi_cmd_reply_end(s);
@@ -1481,8 +1613,10 @@ static void ide_atapi_cmd_read(IDEState *s, int lba, int nb_sectors,
 	s->lba = lba;
 	s->packet_transfer_size = nb_sectors * sector_size;
 	s->elementary_transfer_size = 0;
-	s->io_buffer_index = sector_size;
+	s->io_buffer_index = 0;
+	s->cd_buffer_end = 0;
 	s->cd_sector_size = sector_size;
+	s->cd_raw_slots = 0;	/* the packet was written to io_buffer */
 
 	s->status = READY_STAT;
 	ide_atapi_cmd_reply_end(s);
@@ -2005,6 +2139,7 @@ static void ide_ioport_write(void *opaque, uint32_t addr, uint32_t val)
 	case 7:
 		/* command */
 		LOG_TRACE(TRACE_IDE, "IDE: CMD=%02x\n", val);
+		Main_TurboBootEnd();
 
 		s = ide_if->cur_drive;
 		/* ignore commands to non existent slave */
@@ -2081,6 +2216,7 @@ static void ide_ioport_write(void *opaque, uint32_t addr, uint32_t val)
 				goto abort_cmd;
 			ide_cmd_lba48_transform(s, lba48);
 			s->req_nb_sectors = 1;
+			s->read_count = 0;
 			ide_sector_read(s);
 			break;
 		case WIN_WRITE_EXT:
@@ -2103,6 +2239,7 @@ static void ide_ioport_write(void *opaque, uint32_t addr, uint32_t val)
 				goto abort_cmd;
 			ide_cmd_lba48_transform(s, lba48);
 			s->req_nb_sectors = s->mult_sectors;
+			s->read_count = 0;
 			ide_sector_read(s);
 			break;
 		case WIN_MULTWRITE_EXT:
@@ -80,9 +80,12 @@ const char IKBD_fileid[] = "Hatari ikbd.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "video.h"
 #include "utils.h"
+#include "inputMovie.h"
 #include "acia.h"
 #include "configuration.h"
 #include "clocks_timings.h"
+#include "cycles.h"
+#include "hd6301_cpu.h"
 
 
 #define DBL_CLICK_HISTORY  0x07     /* Number of frames since last click to see if need to send one or two clicks */
@@ -119,6 +122,14 @@ static bool bMouseDisabled, bJoystickDisabled;
 static bool bDuringResetCriticalTime, bBothMouseAndJoy;
 static bool bMouseEnabledDuringReset;
 
+/* Keys injected by the host (pasted text, remote control), fed to the IKBD */
+/* one by one as soon as the guest has read the previous byte from the ACIA */
+#define	KEY_QUEUE_SIZE		65536			/* Must be a power of 2 */
+#define	KEY_QUEUE_MASK		( KEY_QUEUE_SIZE - 1 )
+static Uint8	KeyQueue[ KEY_QUEUE_SIZE ];		/* ST scancodes, bit 7 set for release */
+static int	KeyQueueHead, KeyQueueCount;
+static int	KeyQueueLastVBL;
+
 
 
 
@@ -309,7 +320,8 @@ typedef struct {
 	/* Clock is cleared on cold reset, but keeps its values on warm reset */
 	/* Original RAM location :  $82=year $83=month $84=day $85=hour $86=minute $87=second */
 	Uint8		Clock[ 6 ];
-	Sint64		Clock_micro;				/* Incremented every VBL to update Clock[] every second */
+	Sint64		Clock_micro;				/* Emulated time not yet added to Clock[] */
+	Uint64		Clock_Cycles;				/* CyclesGlobalClockCounter when Clock[] was last updated */
 
 } IKBD_STRUCT;
 
@@ -337,7 +349,8 @@ static void	IKBD_Send_Byte_Delay ( Uint8 Data , int Delay_Cycles );
 
 static bool	IKBD_BCD_Check ( Uint8 val );
 static Uint8	IKBD_BCD_Adjust ( Uint8 val );
-void		IKBD_UpdateClockOnVBL ( void );
+static void	IKBD_Clock_AddSecond ( void );
+void		IKBD_UpdateClock ( void );
 
 
 
@@ -359,6 +372,11 @@ static void IKBD_CustomCodeHandler_DragonnelsMenu_Write ( Uint8 aciabyte );
 static void IKBD_CustomCodeHandler_ChaosAD_Read ( void );
 static void IKBD_CustomCodeHandler_ChaosAD_Write ( Uint8 aciabyte );
 
+static int	IKBD_HD6301_Read_Register ( Uint8 reg );
+static void	IKBD_HD6301_Write_Register ( Uint8 reg , Uint8 value );
+static void	IKBD_HD6301_Write ( Uint8 aciabyte );
+static void	IKBD_HD6301_Run ( void );
+
 
 static int	MemoryLoadNbBytesTotal = 0;		/* total number of bytes to send with the command 0x20 */
 static int	MemoryLoadNbBytesLeft = 0;		/* number of bytes that remain to be sent  */
@@ -369,6 +387,11 @@ static void	(*pIKBD_CustomCodeHandler_Read) ( void );
 static void	(*pIKBD_CustomCodeHandler_Write) ( Uint8 );
 static bool	IKBD_ExeMode = false;
 
+static Uint16	MemoryLoadAddr = 0;			/* address in the IKBD's RAM of the bytes sent with the command 0x20 */
+static bool	IKBD_HD6301_Mode = false;		/* true when unknown custom code is executed by the emulated HD6301 */
+static Uint64	IKBD_HD6301_Clock;			/* CPU clock of the last HD6301 update */
+static int	IKBD_HD6301_CyclesOver;			/* HD6301 cycles executed in advance during the last update */
+
 static Uint8	ScanCodeState[ 128 ];			/* state of each key : 0=released 1=pressed */
 
 /* This array contains all known custom 6301 programs, with their CRC */
@@ -438,6 +461,9 @@ void	IKBD_Init ( void )
 
 	/* Set the callback functions for RX/TX line */
 	IKBD_Init_Pointers ( pACIA_IKBD );
+
+	/* Connect the HD6301's ports and SCI registers, used when running unknown custom code */
+	hd6301_set_register_handlers ( IKBD_HD6301_Read_Register , IKBD_HD6301_Write_Register );
 }
 
 
@@ -483,6 +509,8 @@ void	IKBD_Reset ( bool bCold )
 	pIKBD->RSR = 0;
 	pIKBD->SCI_RX_Size = 0;
 
+	KeyQueueHead = KeyQueueCount = 0;			/* Forget keys queued before the reset */
+
 
 	/* On cold reset, clear the whole RAM (including clock data) */
 	/* On warm reset, the clock data should be kept */
@@ -514,6 +542,7 @@ static void	IKBD_Boot_ROM ( bool ClearAllRAM )
 		for ( i=0 ; i<6 ; i++ )
 			pIKBD->Clock[ i ] = 0;
 		pIKBD->Clock_micro = 0;
+		pIKBD->Clock_Cycles = CyclesGlobalClockCounter;
 	}
 
 // pIKBD->Clock[ 0 ] = 0x99;
@@ -576,6 +605,7 @@ static void	IKBD_Boot_ROM ( bool ClearAllRAM )
 		pIKBD_CustomCodeHandler_Read = NULL;
 		pIKBD_CustomCodeHandler_Write = NULL;
 		IKBD_ExeMode = false;
+		IKBD_HD6301_Mode = false;
 	}
 	
 
@@ -588,6 +618,7 @@ static void	IKBD_Boot_ROM ( bool ClearAllRAM )
 
 	/* Add auto-update function to the queue */
 	Keyboard.AutoSendCycles = 150000;				/* approx every VBL */
+	Keyboard.bInputChanged = true;
 	CycInt_AddRelativeInterrupt ( Keyboard.AutoSendCycles, INT_CPU_CYCLE, INTERRUPT_IKBD_AUTOSEND );
 	LOG_TRACE ( TRACE_IKBD_ALL , "ikbd reset done, starting reset timer\n" );
 }
@@ -638,7 +669,16 @@ void IKBD_MemorySnapShot_Capture(bool bSave)
 	/* restore custom 6301 program if needed */
 	MemorySnapShot_Store(&IKBD_ExeMode, sizeof(IKBD_ExeMode));
 	MemorySnapShot_Store(&MemoryLoadCrc, sizeof(MemoryLoadCrc));
-	if ((bSave == false) && (IKBD_ExeMode == true)) 	/* restoring a snapshot with active 6301 emulation */
+	MemorySnapShot_Store(&IKBD_HD6301_Mode, sizeof(IKBD_HD6301_Mode));
+	MemorySnapShot_Store(&IKBD_HD6301_Clock, sizeof(IKBD_HD6301_Clock));
+	MemorySnapShot_Store(&IKBD_HD6301_CyclesOver, sizeof(IKBD_HD6301_CyclesOver));
+	hd6301_MemorySnapShot_Capture ( bSave );
+	if ((bSave == false) && (IKBD_ExeMode == true) && (IKBD_HD6301_Mode == true))	/* restoring a snapshot with code running on the HD6301 */
+	{
+		pIKBD_CustomCodeHandler_Read = NULL;
+		pIKBD_CustomCodeHandler_Write = IKBD_HD6301_Write;
+	}
+	else if ((bSave == false) && (IKBD_ExeMode == true)) 	/* restoring a snapshot with active 6301 emulation */
 	{
 		for ( i = 0 ; i < sizeof ( CustomCodeDefinitions ) / sizeof ( CustomCodeDefinitions[0] ); i++ )
 			if ( CustomCodeDefinitions[ i ].MainProgCrc == MemoryLoadCrc )
@@ -801,6 +841,9 @@ static Uint8	IKBD_SCI_Set_Line_TX ( void )
 	LOG_TRACE ( TRACE_IKBD_ACIA, "ikbd acia tx_state=%d tx_delay=%d VBL=%d HBL=%d\n" , pIKBD->SCI_TX_State , pIKBD->SCI_TX_Delay ,
 		nVBLs , nHBL );
 
+	if ( IKBD_HD6301_Mode )
+		IKBD_HD6301_Run ();					/* Let the HD6301 catch up with the serial line */
+
 	StateNext = -1;
 	switch ( pIKBD->SCI_TX_State )
 	{
@@ -848,6 +891,33 @@ static Uint8	IKBD_SCI_Set_Line_TX ( void )
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the IKBD's SCI is not sending nor receiving a byte and has
+ * no pending byte to send. In that case, the ACIA's timer can be stopped
+ * until a new byte is sent (see ACIA_IKBD_Wakeup).
+ * The HD6301 emulation relies on this timer too, so it's never idle.
+ */
+bool	IKBD_SCI_Is_Idle ( void )
+{
+	if ( IKBD_HD6301_Mode )						/* The HD6301 is run at each bit */
+		return false;
+
+	if ( KeyQueueCount > 0 )					/* Keep checking when the next key can be sent */
+		return false;
+
+	if ( ( pIKBD->SCI_TX_State != IKBD_SCI_STATE_IDLE ) || ( pIKBD->SCI_RX_State != IKBD_SCI_STATE_IDLE ) )
+		return false;
+
+	if ( ( pIKBD->SCI_TX_Delay > 0 ) || ( ( pIKBD->TRCSR & IKBD_TRCSR_BIT_TDRE ) == 0 ) )
+		return false;
+
+	return ( Keyboard.NbBytesInOutputBuffer == 0 ) || Keyboard.PauseOutput;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Handle the byte that was received in the RDR from the ACIA.
@@ -876,6 +946,43 @@ static void	IKBD_Process_RDR ( Uint8 RDR )
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Send the next queued key if the guest is ready for it : the previous byte
+ * was completely transferred and the CPU read it from the ACIA's RDR.
+ * This gives the fastest rate at which the guest accepts keys without
+ * losing any, instead of relying on a fixed delay between keys.
+ * With the real HD6301 ROM, keys are seen by scanning the keyboard matrix,
+ * so we change at most one key per VBL to be sure each state is scanned.
+ */
+static void	IKBD_KeyQueue_Feed ( void )
+{
+	Uint8	ScanCode;
+
+	if ( KeyQueueCount == 0 )
+		return;
+
+	if ( !ACIA_RX_Is_Empty ( pACIA_IKBD ) )
+		return;
+
+	if ( IKBD_HD6301_Mode )
+	{
+		if ( KeyQueueLastVBL == nVBLs )
+			return;
+	}
+	else if ( ( Keyboard.NbBytesInOutputBuffer > 0 ) || Keyboard.PauseOutput
+	  || ( ( pIKBD->TRCSR & IKBD_TRCSR_BIT_TDRE ) == 0 ) )
+		return;
+
+	ScanCode = KeyQueue[ KeyQueueHead++ ];
+	KeyQueueHead &= KEY_QUEUE_MASK;
+	KeyQueueCount--;
+	KeyQueueLastVBL = nVBLs;
+
+	IKBD_PressSTKey ( ScanCode & 0x7f , ( ScanCode & 0x80 ) == 0 );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Check if we have a byte to copy to the IKBD's TDR, to send it to the ACIA.
@@ -883,6 +990,8 @@ static void	IKBD_Process_RDR ( Uint8 RDR )
  */
 static void	IKBD_Check_New_TDR ( void )
 {
+	IKBD_KeyQueue_Feed ();
+
 //  fprintf(stderr , "check new tdr %d %d\n", Keyboard.BufferHead , Keyboard.BufferTail );
 
 	if ( ( Keyboard.NbBytesInOutputBuffer > 0 )
@@ -936,7 +1045,7 @@ static bool	IKBD_OutputBuffer_CheckFreeCount ( int Nb )
  */
 static int	IKBD_Delay_Random ( int min , int max )
 {
-	return min + rand() % ( max - min );
+	return min + Utils_Rand() % ( max - min );
 }
 
 
@@ -1008,6 +1117,7 @@ static void	IKBD_Send_Byte_Delay ( Uint8 Data , int Delay_Cycles )
 		Keyboard.Buffer[Keyboard.BufferTail++] = Data;
 		Keyboard.BufferTail &= KEYBOARD_BUFFER_MASK;
 		Keyboard.NbBytesInOutputBuffer++;
+		ACIA_IKBD_Wakeup ();					/* Restart the serial line if it was idle */
 	}
 	else
 	{
@@ -1061,9 +1171,46 @@ static Uint8	IKBD_BCD_Adjust ( Uint8 val )
 /**
  * Update the IKBD's internal clock.
  *
- * This function is called on every VBL and we add the number of microseconds
- * per VBL. When we reach 1000000 microseconds (1 sec), we update the Clock[]
- * array by incrementing the 'second' byte.
+ * Instead of adding the VBL duration on every VBL, we only do it when the
+ * clock is accessed (or when the VBL duration is about to change) : the
+ * number of complete frames since the last update is computed from
+ * CyclesGlobalClockCounter and each frame adds the same number of
+ * microseconds as before. When we reach 1000000 microseconds (1 sec), we
+ * update the Clock[] array by incrementing the 'second' byte.
+ * As this only depends on the emulated time, the clock is also deterministic.
+ */
+void	IKBD_UpdateClock ( void )
+{
+	Sint64	FrameDuration_micro;
+	Uint64	FrameCycles;
+	Uint64	Frames;
+
+	/* Use the nominal frame size, nCyclesPerLine can change in the middle of a frame */
+	if ( nScreenRefreshRate == 71 )
+		FrameCycles = SCANLINES_PER_FRAME_71HZ * CYCLES_PER_LINE_71HZ;
+	else if ( nScreenRefreshRate == 60 )
+		FrameCycles = SCANLINES_PER_FRAME_60HZ * CYCLES_PER_LINE_60HZ;
+	else
+		FrameCycles = SCANLINES_PER_FRAME_50HZ * CYCLES_PER_LINE_50HZ;
+	Frames = ( CyclesGlobalClockCounter - pIKBD->Clock_Cycles ) / FrameCycles;
+	if ( Frames == 0 )
+		return;
+	pIKBD->Clock_Cycles += Frames * FrameCycles;
+
+	FrameDuration_micro = ClocksTimings_GetVBLDuration_micro ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
+	pIKBD->Clock_micro += Frames * FrameDuration_micro;
+
+	/* Increment date/time for each second that passed since the last update */
+	while ( pIKBD->Clock_micro >= 1000000 )
+	{
+		pIKBD->Clock_micro -= 1000000;
+		IKBD_Clock_AddSecond ();
+	}
+}
+
+
+/**
+ * Increment the IKBD's internal clock by 1 second.
  *
  * This code uses the same logic as the ROM version in the IKBD,
  * don't try to optimise/rewrite it in a different way, as the TOS
@@ -1081,9 +1228,8 @@ static Uint8	IKBD_BCD_Adjust ( Uint8 val )
  *    (used in the game 'Captain Blood' which sets clock to "99 12 31 00 00 00"
  *    and ends the game when clock reaches "00 01 01 00 00 00")
  */
-void	IKBD_UpdateClockOnVBL ( void )
+static void	IKBD_Clock_AddSecond ( void )
 {
-	Sint64	FrameDuration_micro;
 	int	i;
 	Uint8	val;
 	Uint8	max;
@@ -1096,15 +1242,6 @@ void	IKBD_UpdateClockOnVBL ( void )
 	Uint8	day_max[ 18 ] = { 0x32, 0x29, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x31, 0,0,0,0,0,0, 0x32, 0x31, 0x32 };
 
 
-	/* Check if more than 1 second passed since last increment of date/time */
-        FrameDuration_micro = ClocksTimings_GetVBLDuration_micro ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
-	pIKBD->Clock_micro += FrameDuration_micro;
-	if ( pIKBD->Clock_micro < 1000000 )
-		return;						/* Less than 1 second, don't increment date/time yet */
-	pIKBD->Clock_micro -= 1000000;
-
-
-	/* 1 second passed, we can increment the clock data */
 // 	LOG_TRACE(TRACE_IKBD_CMDS,
 // 		  "IKBD_UpdateClock: %02x %02x %02x %02x %02x %02x -> ", pIKBD->Clock[ 0 ] ,pIKBD->Clock[ 1 ] , pIKBD->Clock[ 2 ] ,
 // 		  pIKBD->Clock[ 3 ] , pIKBD->Clock[ 4 ] , pIKBD->Clock[ 5 ] );
@@ -1640,6 +1777,56 @@ static void IKBD_SendCursorMousePacket(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when the mouse or a joystick changed, so that the IKBD
+ * generates the corresponding packets on the next auto-send.
+ */
+void IKBD_InputChanged(void)
+{
+	Keyboard.bInputChanged = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if calling IKBD_SendAutoKeyboardCommands() would not
+ * produce any packet nor change the IKBD's state : no input changed and
+ * there's no pending mouse delta, button change, double-click sequence
+ * or joystick space bar. Joystick monitoring mode and custom IKBD programs
+ * need to be called on every auto-send, so they are never idle.
+ */
+static bool IKBD_AutoSendIsIdle(void)
+{
+#ifndef __LIBRETRO__
+	/* SDL joysticks are polled, we don't get notified when they change */
+	Keyboard.bInputChanged = true;
+#endif
+	if ( Keyboard.bInputChanged )
+		return false;
+
+	if ( KeyboardProcessor.JoystickMode == AUTOMODE_JOYSTICK_MONITORING
+	  || ( IKBD_ExeMode && pIKBD_CustomCodeHandler_Read ) || JoystickSpaceBar )
+		return false;
+
+	if ( KeyboardProcessor.Mouse.dx || KeyboardProcessor.Mouse.dy
+	  || KeyboardProcessor.Mouse.DeltaX || KeyboardProcessor.Mouse.DeltaY )
+		return false;
+
+	if ( Keyboard.LButtonDblClk || Keyboard.RButtonDblClk
+	  || !IKBD_ButtonsEqual ( Keyboard.bOldLButtonDown , Keyboard.bLButtonDown )
+	  || !IKBD_ButtonsEqual ( Keyboard.bOldRButtonDown , Keyboard.bRButtonDown ) )
+		return false;
+
+	/* The double-click history must already be stable for the current buttons */
+	if ( ( Keyboard.LButtonHistory & 0x3f ) != ( Keyboard.bLButtonDown ? 0x3f : 0 )
+	  || ( Keyboard.RButtonHistory & 0x3f ) != ( Keyboard.bRButtonDown ? 0x3f : 0 ) )
+		return false;
+
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return packets from keyboard for auto, rel mouse, joystick etc...
@@ -1650,6 +1837,11 @@ static void IKBD_SendAutoKeyboardCommands(void)
 	if ( bDuringResetCriticalTime )
 		return;
 
+	/* Nothing to report if no input changed since the last call */
+	if ( IKBD_AutoSendIsIdle () )
+		return;
+	Keyboard.bInputChanged = false;
+
 	/* Read joysticks for this frame */
 	IKBD_GetJoystickData();
 
@@ -1709,12 +1901,45 @@ static void IKBD_SendAutoKeyboardCommands(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue a key press/release, to be sent by IKBD_KeyQueue_Feed as soon as
+ * the guest has read the previous keys.
+ * Return false if the queue is full.
+ */
+bool IKBD_QueueSTKey(Uint8 ScanCode, bool bPress)
+{
+	if ( KeyQueueCount == KEY_QUEUE_SIZE )
+		return false;
+
+	if ( !bPress )
+		ScanCode |= 0x80;
+	KeyQueue[ ( KeyQueueHead + KeyQueueCount++ ) & KEY_QUEUE_MASK ] = ScanCode;
+
+	ACIA_IKBD_Wakeup ();				/* Restart the serial line if it was idle */
+	return true;
+}
+
+
+/**
+ * Return how many more keys can be queued with IKBD_QueueSTKey
+ */
+int IKBD_QueueFreeCount(void)
+{
+	return KEY_QUEUE_SIZE - KeyQueueCount;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * When press/release key under host OS, execute this function.
  */
 void IKBD_PressSTKey(Uint8 ScanCode, bool bPress)
 {
+	/* Record key event, or ignore it when keys come from an input movie */
+	if ( !InputMovie_KeyEvent ( ScanCode , bPress ) )
+		return;
+
 	/* If IKBD is monitoring only joysticks, don't report key */
 	if ( KeyboardProcessor.JoystickMode == AUTOMODE_JOYSTICK_MONITORING )
 		return;
@@ -1833,9 +2058,11 @@ static void IKBD_RunKeyboardCommand(Uint8 aciabyte)
 			{
 				/* Any new valid command will unpause the output (if command 0x13 was used) */
 				Keyboard.PauseOutput = false;
+				ACIA_IKBD_Wakeup ();
 
 				CALL_VAR(KeyboardCommands[i].pCallFunction);
 				Keyboard.nBytesInInputBuffer = 0;	/* Clear input buffer after processing a command */
+				Keyboard.bInputChanged = true;		/* Mouse/joystick modes may have changed */
 			}
 
 			return;
@@ -2120,6 +2347,7 @@ static void IKBD_Cmd_StartKeyboardTransfer(void)
 {
 	LOG_TRACE(TRACE_IKBD_CMDS, "IKBD_Cmd_StartKeyboardTransfer\n");
 	Keyboard.PauseOutput = false;
+	ACIA_IKBD_Wakeup ();
 }
 
 
@@ -2350,7 +2578,7 @@ static void IKBD_Cmd_DisableJoysticks(void)
  * but we process the rest of the bytes.
  * Note that the IKBD doesn't check that month/day/hour/second/minute are in
  * their correct range, just that they're BCD encoded (so you can store 0x30 in hour
- * for example, see IKBD_UpdateClockOnVBL())
+ * for example, see IKBD_Clock_AddSecond())
  */
 static void IKBD_Cmd_SetClock(void)
 {
@@ -2363,6 +2591,9 @@ static void IKBD_Cmd_SetClock(void)
 		  Keyboard.InputBuffer[3], Keyboard.InputBuffer[4],
 		  Keyboard.InputBuffer[5], Keyboard.InputBuffer[6]);
 
+	/* Keep the time elapsed before this command in the old date/time */
+	IKBD_UpdateClock ();
+
 	for ( i=1 ; i<=6 ; i++ )
 	{
 		val = Keyboard.InputBuffer[ i ];
@@ -2387,12 +2618,14 @@ static void IKBD_Cmd_SetClock(void)
  *     ss    ; second
  *
  * All bytes are stored/returned in BCD format.
- * Date/Time is updated in IKBD_UpdateClockOnVBL()
+ * Date/Time is updated in IKBD_UpdateClock()
  */
 static void IKBD_Cmd_ReadClock(void)
 {
 	int	i;
 
+	IKBD_UpdateClock ();
+
 	LOG_TRACE(TRACE_IKBD_CMDS,
 		"IKBD_Cmd_ReadClock: %02x %02x %02x %02x %02x %02x\n",
 		pIKBD->Clock[ 0 ] ,pIKBD->Clock[ 1 ] , pIKBD->Clock[ 2 ] ,
@@ -2425,6 +2658,7 @@ static void IKBD_Cmd_LoadMemory(void)
 	LOG_TRACE(TRACE_IKBD_CMDS, "IKBD_Cmd_LoadMemory addr 0x%x count %d\n",
 		  (Keyboard.InputBuffer[1] << 8) + Keyboard.InputBuffer[2], Keyboard.InputBuffer[3]);
 
+	MemoryLoadAddr = (Keyboard.InputBuffer[1] << 8) + Keyboard.InputBuffer[2];
 	MemoryLoadNbBytesTotal = Keyboard.InputBuffer[3];
 	MemoryLoadNbBytesLeft = MemoryLoadNbBytesTotal;
 	crc32_reset ( &MemoryLoadCrc );
@@ -2486,6 +2720,21 @@ static void IKBD_Cmd_Execute(void)
 
 		IKBD_ExeMode = true;				/* turn 6301's custom mode ON */
 	}
+	else if ( ConfigureParams.Keyboard.bIkbdCpu )		/* unknown code, run it on the emulated HD6301 */
+	{
+		LOG_TRACE(TRACE_IKBD_EXEC, "ikbd execute addr 0x%x using hd6301 emulation\n",
+			  (Keyboard.InputBuffer[1] << 8) + Keyboard.InputBuffer[2]);
+
+		hd6301_start ( (Keyboard.InputBuffer[1] << 8) + Keyboard.InputBuffer[2] );
+		IKBD_HD6301_Clock = CyclesGlobalClockCounter;
+		IKBD_HD6301_CyclesOver = 0;
+
+		pIKBD_CustomCodeHandler_Read = NULL;
+		pIKBD_CustomCodeHandler_Write = IKBD_HD6301_Write;
+		IKBD_ExeMode = true;
+		IKBD_HD6301_Mode = true;
+		ACIA_IKBD_Wakeup ();				/* The HD6301 is run by the ACIA's timer */
+	}
 	else							/* unknown code uploaded to ikbd RAM */
 	{
 		LOG_TRACE(TRACE_IKBD_EXEC, "ikbd execute addr 0x%x ignored, no custom handler found\n",
@@ -2797,6 +3046,9 @@ static void IKBD_LoadMemoryByte ( Uint8 aciabyte )
 
 	crc32_add_byte ( &MemoryLoadCrc , aciabyte );
 
+	/* Keep a copy in the HD6301's RAM, in case this code can't be handled by a custom handler */
+	hd6301_write_ram ( MemoryLoadAddr + MemoryLoadNbBytesTotal - MemoryLoadNbBytesLeft , aciabyte );
+
 	MemoryLoadNbBytesLeft--;
 	if ( MemoryLoadNbBytesLeft == 0 )				/* all bytes were received */
 	{
@@ -3056,3 +3308,101 @@ static void IKBD_CustomCodeHandler_ChaosAD_Write ( Uint8 aciabyte )
 	}
 }
 
+
+
+/*----------------------------------------------------------------------*/
+/* HD6301 emulation for unknown custom programs.			*/
+/* When a program uploads some code that matches none of the custom	*/
+/* handlers above, this code is executed by the HD6301 cpu core instead	*/
+/* of being ignored. The ROM is not emulated, so execution stops (and	*/
+/* we go back to the high level IKBD emulation) when the code returns	*/
+/* or jumps to the ROM.							*/
+/* The HD6301 is run in small slices, each time the ACIA's timer clocks	*/
+/* a new bit on the serial line.					*/
+/* Only the SCI registers, the joysticks' ports and the free running	*/
+/* counter are connected ; the keyboard matrix always reads as no key	*/
+/* pressed.								*/
+/*----------------------------------------------------------------------*/
+
+static int	IKBD_HD6301_Read_Register ( Uint8 reg )
+{
+	Uint8	joy0 , joy1;
+	Uint8	value;
+
+	switch ( reg )
+	{
+	  case 0x03 :						/* Port 2 : fire buttons (active low) */
+		value = 0xff;
+		if ( Joy_GetStickData ( 0 ) & ATARIJOY_BITMASK_FIRE )	value &= ~0x02;
+		if ( Joy_GetStickData ( 1 ) & ATARIJOY_BITMASK_FIRE )	value &= ~0x04;
+		return value;
+
+	  case 0x07 :						/* Port 4 : joysticks' directions (active low) */
+		joy0 = Joy_GetStickData ( 0 ) & 0x0f;
+		joy1 = Joy_GetStickData ( 1 ) & 0x0f;
+		return (Uint8)~( joy0 | ( joy1 << 4 ) );
+
+	  case 0x11 :						/* TRCSR */
+		value = pIKBD->TRCSR & ~IKBD_TRCSR_BIT_TDRE;
+		if ( Keyboard.NbBytesInOutputBuffer < SIZE_KEYBOARD_BUFFER )
+			value |= IKBD_TRCSR_BIT_TDRE;		/* Bytes are queued in the output buffer */
+		return value;
+
+	  case 0x12 :						/* RDR */
+		pIKBD->TRCSR &= ~( IKBD_TRCSR_BIT_RDRF | IKBD_TRCSR_BIT_ORFE );
+		return pIKBD->RDR;
+	}
+
+	return -1;						/* Use the cpu core's default */
+}
+
+
+static void	IKBD_HD6301_Write_Register ( Uint8 reg , Uint8 value )
+{
+	switch ( reg )
+	{
+	  case 0x11 :						/* TRCSR : only the control bits can be written */
+		pIKBD->TRCSR = ( pIKBD->TRCSR & 0xe0 ) | ( value & 0x1f );
+		break;
+
+	  case 0x13 :						/* TDR : send a byte to the ACIA */
+		IKBD_Send_Byte_Delay ( value , 0 );
+		break;
+	}
+}
+
+
+/**
+ * Byte received by the SCI : keep it in RDR until the HD6301 reads it
+ */
+static void	IKBD_HD6301_Write ( Uint8 aciabyte )
+{
+	pIKBD->RDR = aciabyte;
+	pIKBD->TRCSR |= IKBD_TRCSR_BIT_RDRF;
+}
+
+
+/**
+ * Run the HD6301 up to the current CPU clock. The HD6301 runs at 1 MHz,
+ * which is 8 cycles of a 68000 at 8 MHz.
+ */
+static void	IKBD_HD6301_Run ( void )
+{
+	int	Cycles;
+
+	Cycles = (int)( ( CyclesGlobalClockCounter - IKBD_HD6301_Clock ) >> nCpuFreqShift ) / 8;
+	IKBD_HD6301_Clock += (Uint64)( Cycles * 8 ) << nCpuFreqShift;
+
+	IKBD_HD6301_CyclesOver = hd6301_run ( Cycles + IKBD_HD6301_CyclesOver );
+
+	if ( hd6301_stopped () )
+	{
+		LOG_TRACE ( TRACE_IKBD_EXEC , "ikbd hd6301 code stopped, back to rom VBL=%d HBL=%d\n" , nVBLs , nHBL );
+
+		pIKBD_CustomCodeHandler_Read = NULL;
+		pIKBD_CustomCodeHandler_Write = NULL;
+		IKBD_ExeMode = false;
+		IKBD_HD6301_Mode = false;
+	}
+}
+
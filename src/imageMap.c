@@ -0,0 +1,231 @@
+/*
+  Hatari - imageMap.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Memory-mapped disk images with a copy-on-write overlay.
+
+  With the "disk overlay" option, hard disk images are mapped read-only,
+  so several emulator instances booting the same master image share the
+  host page cache, and nothing is read before the emulated system asks
+  for it. Sector writes go to a sparse delta file of the same size that
+  only gets disk blocks for the sectors actually written, and a bitmap
+  tells which sectors must be read back from the delta. The delta file
+  is a temporary file, so the changes are dropped at the end of the
+  session and the image itself is never modified.
+
+  Raw .ST floppy images use a private mapping of the whole file instead,
+  where the host kernel does the copy-on-write of the modified pages.
+
+  Without mmap() support, the functions fail and the callers fall back
+  to their normal file I/O.
+*/
+const char ImageMap_fileid[] = "Hatari imageMap.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "imageMap.h"
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Map the image file 'fp' of 'nSize' bytes read-only and create its
+ * (empty) delta file. Return false if mapping is not possible.
+ */
+bool ImageMap_Open(IMAGEMAP *pMap, FILE *fp, off_t nSize)
+{
+	size_t nSectors = nSize / IMAGEMAP_SECTOR_SIZE;
+
+	memset(pMap, 0, sizeof(*pMap));
+	if (nSize <= 0 || (off_t)(size_t)nSize != nSize)
+		return false;
+
+	pMap->nSize = nSize;
+	pMap->pImage = mmap(NULL, pMap->nSize, PROT_READ, MAP_SHARED, fileno(fp), 0);
+	if (pMap->pImage == MAP_FAILED)
+	{
+		perror("ImageMap_Open");
+		pMap->pImage = NULL;
+		return false;
+	}
+
+	/* Delta file is sparse, blocks are only allocated for written sectors */
+	pMap->fpDelta = tmpfile();
+	if (!pMap->fpDelta || ftruncate(fileno(pMap->fpDelta), nSize) != 0)
+		goto failed;
+	pMap->pDelta = mmap(NULL, pMap->nSize, PROT_READ|PROT_WRITE, MAP_SHARED,
+	                    fileno(pMap->fpDelta), 0);
+	if (pMap->pDelta == MAP_FAILED)
+	{
+		pMap->pDelta = NULL;
+		goto failed;
+	}
+	pMap->pWritten = calloc((nSectors + 7) / 8, 1);
+	if (!pMap->pWritten)
+		goto failed;
+
+	return true;
+
+failed:
+	perror("ImageMap_Open");
+	ImageMap_Close(pMap);
+	return false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Unmap the image and drop the delta file with all the written sectors
+ */
+void ImageMap_Close(IMAGEMAP *pMap)
+{
+	if (pMap->pImage)
+		munmap(pMap->pImage, pMap->nSize);
+	if (pMap->pDelta)
+		munmap(pMap->pDelta, pMap->nSize);
+	if (pMap->fpDelta)
+		fclose(pMap->fpDelta);
+	free(pMap->pWritten);
+	memset(pMap, 0, sizeof(*pMap));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Clip 'nCount' sectors starting at 'nSector' to the image size
+ */
+static int ImageMap_ClipCount(IMAGEMAP *pMap, Uint32 nSector, int nCount)
+{
+	size_t nSectors = pMap->nSize / IMAGEMAP_SECTOR_SIZE;
+
+	if (nCount < 0 || nSector >= nSectors)
+		return 0;
+	if ((size_t)nCount > nSectors - nSector)
+		nCount = nSectors - nSector;
+	return nCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy 'nCount' sectors starting at 'nSector' to 'pDst', taking the
+ * written ones from the delta. Return the number of sectors read.
+ */
+int ImageMap_Read(IMAGEMAP *pMap, Uint8 *pDst, Uint32 nSector, int nCount)
+{
+	size_t nOffset;
+	int i;
+
+	nCount = ImageMap_ClipCount(pMap, nSector, nCount);
+	for (i = 0; i < nCount; i++, nSector++)
+	{
+		nOffset = (size_t)nSector * IMAGEMAP_SECTOR_SIZE;
+		if (pMap->pWritten[nSector >> 3] & (1 << (nSector & 7)))
+			memcpy(pDst, pMap->pDelta + nOffset, IMAGEMAP_SECTOR_SIZE);
+		else
+			memcpy(pDst, pMap->pImage + nOffset, IMAGEMAP_SECTOR_SIZE);
+		pDst += IMAGEMAP_SECTOR_SIZE;
+	}
+	return nCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store 'nCount' sectors from 'pSrc' starting at 'nSector' into the
+ * delta. Return the number of sectors written.
+ */
+int ImageMap_Write(IMAGEMAP *pMap, const Uint8 *pSrc, Uint32 nSector, int nCount)
+{
+	int i;
+
+	nCount = ImageMap_ClipCount(pMap, nSector, nCount);
+	memcpy(pMap->pDelta + (size_t)nSector * IMAGEMAP_SECTOR_SIZE, pSrc,
+	       (size_t)nCount * IMAGEMAP_SECTOR_SIZE);
+	for (i = 0; i < nCount; i++, nSector++)
+		pMap->pWritten[nSector >> 3] |= 1 << (nSector & 7);
+	return nCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Map a whole file privately: the pages are shared with the host page
+ * cache until written, and the writes never reach the file.
+ * Return pointer to the data (to release with ImageMap_UnmapFile())
+ * and set 'pFileSize', or return NULL if mapping is not possible.
+ */
+Uint8 *ImageMap_MapFile(const char *pszFileName, long *pFileSize)
+{
+	struct stat st;
+	void *pData;
+	int fd;
+
+	fd = open(pszFileName, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0 || (off_t)(long)st.st_size != st.st_size)
+	{
+		close(fd);
+		return NULL;
+	}
+	pData = mmap(NULL, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (pData == MAP_FAILED)
+	{
+		perror("ImageMap_MapFile");
+		return NULL;
+	}
+	*pFileSize = st.st_size;
+	return pData;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Release a mapping done with ImageMap_MapFile()
+ */
+void ImageMap_UnmapFile(Uint8 *pData, long nFileSize)
+{
+	munmap(pData, nFileSize);
+}
+
+#else	/* !HAVE_SYS_MMAN_H */
+
+bool ImageMap_Open(IMAGEMAP *pMap, FILE *fp, off_t nSize)
+{
+	memset(pMap, 0, sizeof(*pMap));
+	return false;
+}
+
+void ImageMap_Close(IMAGEMAP *pMap)
+{
+}
+
+int ImageMap_Read(IMAGEMAP *pMap, Uint8 *pDst, Uint32 nSector, int nCount)
+{
+	return 0;
+}
+
+int ImageMap_Write(IMAGEMAP *pMap, const Uint8 *pSrc, Uint32 nSector, int nCount)
+{
+	return 0;
+}
+
+Uint8 *ImageMap_MapFile(const char *pszFileName, long *pFileSize)
+{
+	return NULL;
+}
+
+void ImageMap_UnmapFile(Uint8 *pData, long nFileSize)
+{
+}
+
+#endif
@@ -51,6 +51,7 @@ typedef struct {
 
 	/* Other variables */
 	char		ACIA_Name[ 10 ];			/* IKBD or MIDI */
+	Uint64		Last_Bit_Clock;				/* Master clock of the last RX/TX bit, to restart the timer in phase */
 
 } ACIA_STRUCT;
 
@@ -68,9 +69,11 @@ void	ACIA_Reset ( ACIA_STRUCT *pAllACIA );
 void	ACIA_MemorySnapShot_Capture ( bool bSave );
 
 void	ACIA_InterruptHandler_IKBD ( void );
+void	ACIA_IKBD_Wakeup ( void );
 void	ACIA_InterruptHandler_MIDI ( void );
 
 void	ACIA_AddWaitCycles ( void );
+bool	ACIA_RX_Is_Empty ( ACIA_STRUCT *pACIA );
 
 void	ACIA_IKBD_Read_SR ( void );
 void	ACIA_IKBD_Read_RDR ( void );
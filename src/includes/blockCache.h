@@ -0,0 +1,19 @@
+/*
+  Hatari - blockCache.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_BLOCKCACHE_H
+#define HATARI_BLOCKCACHE_H
+
+typedef struct BLOCKCACHE BLOCKCACHE;
+
+extern BLOCKCACHE *BlockCache_Open(FILE *fp, Uint32 nSectors, bool bReadOnly);
+extern void BlockCache_Close(BLOCKCACHE *pCache);
+extern int BlockCache_Read(BLOCKCACHE *pCache, Uint8 *pDst, Uint32 nSector, int nCount);
+extern int BlockCache_Write(BLOCKCACHE *pCache, const Uint8 *pSrc, Uint32 nSector, int nCount);
+extern void BlockCache_Flush(BLOCKCACHE *pCache);
+
+#endif
@@ -0,0 +1,18 @@
+/*
+  Hatari - bootSnapshot.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_BOOTSNAPSHOT_H
+#define HATARI_BOOTSNAPSHOT_H
+
+#define BOOTSNAPSHOT_INTERVAL	8	/* VBLs between boot state captures */
+
+extern void BootSnapshot_ColdReset(void);
+extern void BootSnapshot_Cancel(void);
+extern void BootSnapshot_Vbl(void);
+extern void BootSnapshot_DiskAccess(void);
+
+#endif
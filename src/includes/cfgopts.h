@@ -26,7 +26,14 @@ struct Config_Tag
   void       *buf;                 /* Storage location     */
 };
 
+struct Config_Section
+{
+  const char *header;              /* INI header, e.g. "[Sound]" */
+  const struct Config_Tag *configs;
+};
+
 int input_config(const char *, const struct Config_Tag *, const char *);
+int input_config_sections(const char *, const struct Config_Section *);
 int update_config(const char *, const struct Config_Tag *, const char *);
 
 #endif
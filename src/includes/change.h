@@ -9,6 +9,15 @@
 
 #include "configuration.h"
 
+/* What it takes to apply a configuration change */
+typedef enum
+{
+	CHANGE_HOT,	/* applied while running */
+	CHANGE_WARM,	/* needs a warm reset */
+	CHANGE_COLD	/* needs a cold reset (TOS reload) */
+} CHANGE_TIER;
+
+extern CHANGE_TIER Change_GetResetTier(CNF_PARAMS *current, CNF_PARAMS *changed);
 extern bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed);
 extern void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *changed, bool bForceReset);
 extern bool Change_ApplyCommandline(char *cmdline);
@@ -8,16 +8,26 @@
 #ifndef HATARI_CONFIGURATION_H
 #define HATARI_CONFIGURATION_H
 
+/* Cycles charged for the NF_MEMOPS native feature */
+typedef enum
+{
+  NATFEATS_MEMOPS_OFF,		/* NF_MEMOPS not available */
+  NATFEATS_MEMOPS_FREE,		/* only the NatFeats call itself */
+  NATFEATS_MEMOPS_CPU		/* cost of the equivalent 68k loop */
+} NATFEATS_MEMOPS_MODE;
+
 /* Logging and tracing */
 typedef struct
 {
   char sLogFileName[FILENAME_MAX];
   char sTraceFileName[FILENAME_MAX];
+  char sTraceBinFileName[FILENAME_MAX];
   int nExceptionDebugMask;
   int nTextLogLevel;
   int nAlertDlgLogLevel;
   bool bConfirmQuit;
   bool bNatFeats;
+  NATFEATS_MEMOPS_MODE nNatFeatsMemOps;
   bool bConsoleWindow;	/* for now, used just for Windows */
 } CNF_LOG;
 
@@ -52,6 +62,9 @@ typedef struct
   int SdlAudioBufferSize;
   char szYMCaptureFileName[FILENAME_MAX];
   int YmVolumeMixing;
+  bool bYmHighQuality;            /* YM at its own clock, with FIR decimation */
+  bool bCrossbarBatch;            /* Falcon crossbar clocks handled per scanline */
+  bool bYmCompactVolume;          /* smaller YM volume table, with sorted volumes */
 } CNF_SOUND;
 
 
@@ -76,6 +89,7 @@ typedef enum
 typedef struct
 {
   bool bDisableKeyRepeat;
+  bool bIkbdCpu;
   KEYMAPTYPE nKeymapType;
   char szMappingFileName[FILENAME_MAX];
 } CNF_KEYBOARD;
@@ -121,6 +135,8 @@ typedef struct
   bool bAutoSave;
   char szMemoryCaptureFileName[FILENAME_MAX];
   char szAutoSaveFileName[FILENAME_MAX];
+  int nSnapshotCompression;       /* zlib level for memory snapshot files, 0-9 */
+  int nAutoSaveInterval;          /* seconds between background auto-saves, 0 = off */
 } CNF_MEMORY;
 
 
@@ -165,6 +181,10 @@ typedef struct
 {
   bool bAutoInsertDiskB;
   bool FastFloppy;			/* true to speed up FDC emulation */
+  bool TurboFloppy;			/* true to complete FDC commands at once for ST/MSA/DIM */
+  bool bFloppyHLE;			/* true to serve BIOS/XBIOS sector calls from ST/MSA/DIM images */
+  bool bDiskOverlay;			/* true to map .ST/HD images and discard their writes */
+  bool bDiskJournal;			/* true to journal floppy writes and save images in background */
   bool EnableDriveA;
   bool EnableDriveB;
   int  DriveA_NumberOfHeads;
@@ -188,6 +208,13 @@ typedef enum
   GEMDOS_LOWER
 } GEMDOS_CHR_CONV;
 
+typedef enum
+{
+  GEMDOS_FLUSH_WRITE,
+  GEMDOS_FLUSH_VBL,
+  GEMDOS_FLUSH_CLOSE
+} GEMDOS_FLUSH_MODE;
+
 typedef struct
 {
   int nHardDiskDrive;
@@ -196,8 +223,13 @@ typedef struct
   bool bUseIdeSlaveHardDiskImage;
   WRITEPROTECTION nWriteProtection;
   GEMDOS_CHR_CONV nGemdosCase;
+  bool bGemdosMmap;
+  bool bGemdosFastPexec;      /* Relocate programs natively */
+  GEMDOS_FLUSH_MODE nGemdosFlush;  /* When Fwrite data is flushed to host */
+  int nHdCacheSize;           /* ACSI/IDE image cache size in MiB, 0 = off */
   bool bBootFromHardDisk;
   char szHardDiskDirectories[MAX_HARDDRIVES][FILENAME_MAX];
+  char szGemdosOverlayDir[FILENAME_MAX];  /* writable dir for a ZIP archive drive, "" = default */
   char szIdeMasterHardDiskImage[FILENAME_MAX];
   char szIdeSlaveHardDiskImage[FILENAME_MAX];
 } CNF_HARDDISK;
@@ -250,6 +282,9 @@ typedef struct
   bool bShowDriveLed;
   bool bCrop;
   bool bForceMax;
+  bool bNativeRes;
+  bool bHeadless;                 /* render only frames to be hashed */
+  int nFrameHash;                 /* hash every Nth frame, 0 = none */
   int nMaxWidth;
   int nMaxHeight;
 } CNF_SCREEN;
@@ -304,13 +339,21 @@ typedef struct
   int nCpuLevel;
   int nCpuFreq;
   bool bCompatibleCpu;            /* Prefetch mode */
+  bool bFastTiming;               /* No prefetch, pairing or wait states */
+  bool bAutoPrefetch;             /* Prefetch only after self-modifying code */
+  bool bCpuTurbo;                 /* Raise CPU clock while disks are busy */
+  bool bBatchHbl;                 /* One interrupt for runs of identical HBLs */
   MACHINETYPE nMachineType;
   bool bBlitter;                  /* TRUE if Blitter is enabled */
   DSPTYPE nDSPType;               /* how to "emulate" DSP */
+  int nDSPSkew;                   /* DSP cycles the DSP may lag the CPU */
   bool bRealTimeClock;
   bool bPatchTimerD;
   bool bFastBoot;                 /* Enable to patch TOS for fast boot */
+  bool bTurboBoot;                /* Run the boot unthrottled until a disk access */
+  bool bBootSnapshot;             /* Restore saved state instead of booting TOS */
   bool bFastForward;
+  bool bDeterministic;            /* Derive randomness and RTC from emulated state */
 
 #if ENABLE_WINUAE_CPU
   bool bAddressSpace24;
@@ -326,6 +369,8 @@ typedef struct
   int AviRecordVcodec;
   int AviRecordFps;
   char AviRecordFile[FILENAME_MAX];
+  int ScreenShotCompression;      /* zlib level for PNG screenshots, 0-9 */
+  char FramePipeFile[FILENAME_MAX];
 } CNF_VIDEO;
 
 /* State of system is stored in this structure */
@@ -0,0 +1,19 @@
+/*
+  Hatari - controlBin.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+#ifndef HATARI_CONTROLBIN_H
+#define HATARI_CONTROLBIN_H
+
+/* supported only on systems with BSD compatible sockets */
+#if HAVE_TCP_SOCKETS
+extern const char *ControlBin_SetPort(int port);
+extern void ControlBin_Check(void);
+#else
+#define ControlBin_SetPort(port) "Binary control protocol is not supported on this platform."
+#define ControlBin_Check()
+#endif /* HAVE_TCP_SOCKETS */
+
+#endif /* HATARI_CONTROLBIN_H */
@@ -28,6 +28,7 @@ typedef enum
   INTERRUPT_FDC,
   INTERRUPT_BLITTER,
   INTERRUPT_MIDI,
+  INTERRUPT_SAMPLER,
 
   MAX_INTERRUPTS
 } interrupt_id;
@@ -69,5 +70,8 @@ extern void CycInt_RemovePendingInterrupt(interrupt_id Handler);
 extern void CycInt_ResumeStoppedInterrupt(interrupt_id Handler);
 extern bool CycInt_InterruptActive(interrupt_id Handler);
 extern int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType);
+extern Uint64 CycInt_GetClock(void);
+extern Uint64 CycInt_GetInterruptClock(interrupt_id Handler);
+extern void CycInt_AddClockInterrupt(Uint64 Clock, interrupt_id Handler);
 
 #endif /* ifndef HATARI_CYCINT_H */
@@ -0,0 +1,17 @@
+/*
+  Hatari - diskPrefetch.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_DISKPREFETCH_H
+#define HATARI_DISKPREFETCH_H
+
+#define DISKPREFETCH_MAX	3	/* Max number of images loaded in advance */
+
+extern void DiskPrefetch_Set(const char * const ppszFileNames[], int nFiles);
+extern Uint8 *DiskPrefetch_Take(const char *pszFileName, long *pImageSize, int *pImageType);
+extern void DiskPrefetch_UnInit(void);
+
+#endif
@@ -36,6 +36,14 @@ typedef struct
 	bool bDiskInserted;
 	bool bContentsChanged;
 	bool bOKToSave;
+	bool bMapped;				/* pBuffer is a private mapping of the image (disk overlay) */
+	Uint32 nImageId;			/* unique for each inserted image, 0 when empty */
+
+	/* Geometry of ST/MSA/DIM images, set by Floppy_UpdateDiskDetails() */
+	Uint16 nSectorsPerTrack;
+	Uint16 nSides;
+	int nImageTracks;
+	int nBytesPerTrack;
 
 	/* For the emulation of the WPRT bit when a disk is changed */
 	int TransitionState1;
@@ -60,7 +68,9 @@ extern int Floppy_DriveTransitionUpdateState ( int Drive );
 extern bool Floppy_InsertDiskIntoDrive(int Drive);
 extern bool Floppy_EjectDiskFromDrive(int Drive);
 extern void Floppy_FindDiskDetails(const Uint8 *pBuffer, int nImageBytes, Uint16 *pnSectorsPerTrack, Uint16 *pnSides);
+extern void Floppy_UpdateDiskDetails(int Drive);
 extern bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector, Uint16 Track, Uint16 Side, short Count, int *pnSectorsPerTrack, int *pSectorSize);
 extern bool Floppy_WriteSectors(int Drive, Uint8 *pBuffer, Uint16 Sector, Uint16 Track, Uint16 Side, short Count, int *pnSectorsPerTrack, int *pSectorSize);
+extern bool Floppy_AccessSectorsHLE(int Drive, bool bWrite, Uint32 Addr, Uint16 Sector, Uint16 Track, Uint16 Side, int Count);
 
 #endif
@@ -0,0 +1,19 @@
+/*
+  Hatari - floppyJournal.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_FLOPPYJOURNAL_H
+#define HATARI_FLOPPYJOURNAL_H
+
+extern void FloppyJournal_Open(int Drive);
+extern void FloppyJournal_MarkDirty(int Drive, long Offset, long nBytes);
+extern void FloppyJournal_FlushAll(void);
+extern bool FloppyJournal_SaveImage(int Drive);
+extern void FloppyJournal_Close(int Drive, bool bRemove);
+extern bool FloppyJournal_WaitFile(const char *pszFileName);
+extern void FloppyJournal_UnInit(void);
+
+#endif
@@ -59,6 +59,8 @@ typedef struct {
 
 	/* Other internal variables */
 	STX_SECTOR_STRUCT	*pSectorsStruct;		/* All the sectors struct for this track or null */
+	Sint32			*pSectorsPosition;		/* Position in FDC cycles of each sector, in ascending order */
+	Uint16			*pSectorsOrder;			/* Index in pSectorsStruct for each entry of pSectorsPosition */
 
 	Uint8			*pFuzzyData;			/* Fuzzy mask data for all the fuzzy sectors of the track */
 
@@ -99,6 +101,7 @@ typedef struct {
 
 	/* Other internal variables */
 	STX_TRACK_STRUCT	*pTracksStruct;
+	Sint16			TrackIndex[ 2 ][ 128 ];	/* Index in pTracksStruct for each side/track or -1 */
 
 	/* These variable are used to warn the user only one time if a write command is made */
 	bool		WarnedWriteSector;			/* True if a 'write sector' command was made and user was warned */
@@ -12,6 +12,9 @@ typedef struct {
   char hd_emulation_dir[FILENAME_MAX];     /* hd emulation directory (Host OS) */
   char fs_currpath[FILENAME_MAX];          /* current path (Host OS) */
   int drive_number;                        /* drive number (C: = 2, D: = 3...) */
+  char *zip_file;                          /* ZIP archive shown through hd_emulation_dir, or NULL */
+  char **zip_deleted;                      /* archive paths removed from the drive */
+  int zip_ndeleted;
 } EMULATEDDRIVE;
 
 extern EMULATEDDRIVE **emudrives;
@@ -29,5 +32,7 @@ extern bool GemDOS_IsDriveEmulated(int drive);
 extern void GemDOS_Info(Uint32 bShowOpcodes);
 extern void GemDOS_OpCode(void);
 extern void GemDOS_Boot(void);
+extern void GemDOS_FlushFiles(void);
+extern bool GemDOS_PexecRelocate(Uint32 Basepage, Uint32 RelocTable, Uint16 AbsFlag);
 
 #endif /* HATARI_GEMDOS_H */
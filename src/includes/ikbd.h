@@ -61,6 +61,7 @@ typedef struct {
   int LButtonHistory,RButtonHistory;
 
   int AutoSendCycles;				/* Number of cpu cycles to call INTERRUPT_IKBD_AUTOSEND */
+  bool bInputChanged;				/* Mouse/joystick/IKBD mode changed since last auto packets */
 } KEYBOARD;
 
 /* Button states, a bit mask so can mimick joystick/right mouse button duplication */
@@ -91,10 +92,14 @@ extern void IKBD_MemorySnapShot_Capture(bool bSave);
 
 extern void IKBD_InterruptHandler_ResetTimer(void);
 extern void IKBD_InterruptHandler_AutoSend(void);
+extern void IKBD_InputChanged(void);
 
-extern void IKBD_UpdateClockOnVBL ( void );
+extern void IKBD_UpdateClock ( void );
+extern bool IKBD_SCI_Is_Idle ( void );
 
 
 extern void IKBD_PressSTKey(Uint8 ScanCode, bool bPress);
+extern bool IKBD_QueueSTKey(Uint8 ScanCode, bool bPress);
+extern int IKBD_QueueFreeCount(void);
 
 #endif  /* HATARI_IKBD_H */
@@ -0,0 +1,31 @@
+/*
+  Hatari - imageMap.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_IMAGEMAP_H
+#define HATARI_IMAGEMAP_H
+
+#define IMAGEMAP_SECTOR_SIZE	512
+
+typedef struct
+{
+	Uint8 *pImage;			/* read-only mapping of the image file */
+	Uint8 *pDelta;			/* mapping of the sparse delta file */
+	Uint8 *pWritten;		/* bitmap of the sectors stored in the delta */
+	FILE *fpDelta;
+	size_t nSize;			/* image size in bytes */
+} IMAGEMAP;
+
+#define ImageMap_IsOpen(pMap)	((pMap)->pImage != NULL)
+
+extern bool ImageMap_Open(IMAGEMAP *pMap, FILE *fp, off_t nSize);
+extern void ImageMap_Close(IMAGEMAP *pMap);
+extern int ImageMap_Read(IMAGEMAP *pMap, Uint8 *pDst, Uint32 nSector, int nCount);
+extern int ImageMap_Write(IMAGEMAP *pMap, const Uint8 *pSrc, Uint32 nSector, int nCount);
+extern Uint8 *ImageMap_MapFile(const char *pszFileName, long *pFileSize);
+extern void ImageMap_UnmapFile(Uint8 *pData, long nFileSize);
+
+#endif
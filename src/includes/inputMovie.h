@@ -0,0 +1,33 @@
+/*
+  Hatari - inputMovie.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_INPUTMOVIE_H
+#define HATARI_INPUTMOVIE_H
+
+/* INPUTMOVIE_INPUT.nButtons bits */
+#define INPUTMOVIE_LBUTTON	0x01	/* left mouse button */
+#define INPUTMOVIE_RBUTTON	0x02	/* right mouse button */
+#define INPUTMOVIE_JOY0		0x04	/* joystick also in port 0 */
+
+/* Input given to the emulated machine on one input update */
+typedef struct
+{
+	Uint8 nJoy;		/* IKBD joystick bits */
+	Uint8 nButtons;
+	Sint16 nMouseX;		/* relative mouse motion */
+	Sint16 nMouseY;
+} INPUTMOVIE_INPUT;
+
+extern void InputMovie_SetRecord(const char *pszFileName);
+extern void InputMovie_SetPlayback(const char *pszFileName);
+extern bool InputMovie_IsPlaying(void);
+extern void InputMovie_Vbl(void);
+extern bool InputMovie_KeyEvent(Uint8 ScanCode, bool bPress);
+extern void InputMovie_Update(INPUTMOVIE_INPUT *pInput, bool bLate);
+extern void InputMovie_UnInit(void);
+
+#endif
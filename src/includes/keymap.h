@@ -38,5 +38,6 @@ extern void Keymap_DebounceAllKeys(void);
 extern void Keymap_KeyDown(SDL_keysym *sdlkey);
 extern void Keymap_KeyUp(SDL_keysym *sdlkey);
 extern void Keymap_SimulateCharacter(char asckey, bool press);
+extern int Keymap_QueueString(const char *text);
 
 #endif
@@ -98,6 +98,7 @@ enum {
 #define  GEMDOS_OPCODE        8  /* Free op-code to intercept GemDOS trap */
 #define  SYSINIT_OPCODE      10  /* Free op-code to initialize system (connected drives etc.) */
 #define  VDI_OPCODE          12  /* Free op-code to call VDI handlers AFTER Trap#2 */
+#define  PEXEC_OPCODE        14  /* Free op-code to relocate programs loaded by cartridge Pexec */
 
 /* Illegal opcodes used for Native Features emulation:
  * http://wiki.aranym.org/natfeats/proposal#special_opcodes
@@ -169,13 +170,18 @@ extern Uint32 BusErrorPC;
 extern bool bBusErrorReadWrite;
 extern int nCpuFreqShift;
 extern int nWaitStateCycles;
+extern bool bFastTiming;
+extern bool bPrefetchAuto;
 extern int BusMode;
 extern bool	CPU_IACK;
+#ifdef __LIBRETRO__
+extern bool	bCpuEndFrame;
+#endif
 
 extern int	LastOpcodeFamily;
 extern int	LastInstrCycles;
 extern int	Pairing;
-extern char	PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
+extern const char	PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 extern const char *OpcodeName[];
 
 
@@ -293,7 +299,15 @@ static inline void M68000_AddCyclesWithPairing(int cycles)
 extern void M68000_Init(void);
 extern void M68000_Reset(bool bCold);
 extern void M68000_Start(void);
+#ifdef __LIBRETRO__
+extern void M68000_RunFrame(void);
+extern void M68000_EndFrame(void);
+#endif
 extern void M68000_CheckCpuSettings(void);
+extern void M68000_PrefetchNeeded(void);
+extern void M68000_TurboDiskAccess(void);
+extern void M68000_TurboTimingAccess(void);
+extern void M68000_TurboUpdate(void);
 extern void M68000_MemorySnapShot_Capture(bool bSave);
 extern void M68000_BusError(Uint32 addr, bool bReadWrite);
 extern void M68000_Exception(Uint32 ExceptionVector , int ExceptionSource);
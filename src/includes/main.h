@@ -27,6 +27,13 @@
 # define unlikely(x)    (x)
 #endif
 
+/* Start hot emulation state on its own host cache line */
+#if __GNUC__ >= 3
+# define CACHE_ALIGNED  __attribute__((aligned(64)))
+#else
+# define CACHE_ALIGNED
+#endif
+
 #ifdef WIN32
 #define PATHSEP '\\'
 #else
@@ -44,17 +51,29 @@
 #define SIZE_WORD  2
 #define SIZE_LONG  4
 
+/* Longest turbo boot, in VBLs (20 seconds at 50 Hz) */
+#define TURBOBOOT_MAX_VBLS	(50 * 20)
+
 /* The 8 MHz CPU frequency */
 #define CPU_FREQ   8012800
 
 extern bool bQuitProgram;
+extern bool bBenchmarkMode;
+extern Uint32 nTurboBootVBLs;
 
 extern bool Main_PauseEmulation(bool visualize);
 extern bool Main_UnPauseEmulation(void);
 extern void Main_RequestQuit(int exitval);
 extern void Main_SetRunVBLs(Uint32 vbls);
+extern void Main_SetBenchmark(Uint32 vbls);
+extern void Main_SetStateHash(Uint32 vbls);
+extern void Main_TurboBootStart(void);
+extern void Main_TurboBootEnd(void);
 extern bool Main_SetVBLSlowdown(int factor);
 extern void Main_WaitOnVbl(void);
+#ifdef __LIBRETRO__
+extern bool Main_RunFrame(void);
+#endif
 extern void Main_WarpMouse(int x, int y);
 extern void Main_EventHandler(void);
 extern void Main_SetTitle(const char *title);
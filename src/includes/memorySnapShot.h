@@ -7,6 +7,20 @@
 
 
 extern void MemorySnapShot_Skip(int Nb);
+extern void MemorySnapShot_SetError(void);
 extern void MemorySnapShot_Store(void *pData, int Size);
+extern void MemorySnapShot_StorePacked(void *pData, int Size);
+extern bool MemorySnapShot_RamInChunks(void);
 extern void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm);
 extern void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm);
+extern void MemorySnapShot_CaptureAsync(const char *pszFileName);
+extern void MemorySnapShot_AutoSaveCheck(void);
+extern void MemorySnapShot_UnInit(void);
+extern size_t MemorySnapShot_MemorySize(bool bLight);
+extern bool MemorySnapShot_CaptureMemory(void *pBuffer, size_t nSize, bool bLight);
+extern bool MemorySnapShot_RestoreMemory(const void *pBuffer, size_t nSize);
+extern bool MemorySnapShot_IsLightweight(void);
+extern bool MemorySnapShot_CaptureDeltaBase(void *pBuffer, size_t nSize);
+extern size_t MemorySnapShot_CaptureDelta(void *pBuffer, size_t nSize);
+extern bool MemorySnapShot_RestoreDelta(const void *pBase, size_t nBaseSize,
+                                        const void *pDelta, size_t nDeltaSize);
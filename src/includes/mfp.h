@@ -73,6 +73,7 @@ extern void MFP_UpdateIRQ ( Uint64 Event_Time );
 extern void MFP_InputOnChannel ( int Interrupt , int Interrupt_Delayed_Cycles );
 extern void MFP_TimerA_EventCount_Interrupt(void);
 extern void MFP_TimerB_EventCount_Interrupt( int Delayed_Cycles );
+extern bool MFP_TimerB_EventCount_Expires( void );
 extern void MFP_InterruptHandler_TimerA(void);
 extern void MFP_InterruptHandler_TimerB(void);
 extern void MFP_InterruptHandler_TimerC(void);
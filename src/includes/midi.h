@@ -16,5 +16,6 @@ extern void Midi_Data_ReadByte(void);
 extern void Midi_Control_WriteByte(void);
 extern void Midi_Data_WriteByte(void);
 extern void Midi_InterruptHandler_Update(void);
+extern void Midi_UpdateFrame(void);
 
 #endif
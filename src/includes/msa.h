@@ -8,4 +8,7 @@
 extern bool MSA_FileNameIsMSA(const char *pszFileName, bool bAllowGZ);
 extern Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize);
 extern Uint8 *MSA_ReadDisk(int Drive, const char *pszFileName, long *pImageSize, int *pImageType);
+extern Uint8 *MSA_Insert(int Drive, const char *pszFileName, long *pImageSize, int *pImageType);
+extern void MSA_AccessTracks(int Drive, long Offset, long nBytes, bool bWrite);
+extern void MSA_Eject(int Drive);
 extern bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int ImageSize);
@@ -0,0 +1,15 @@
+/*
+  Hatari - recWriter.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_RECWRITER_H
+#define HATARI_RECWRITER_H
+
+extern bool RecWriter_Write(FILE *fp, const void *pData, size_t nSize);
+extern bool RecWriter_Flush(FILE *fp);
+extern void RecWriter_UnInit(void);
+
+#endif
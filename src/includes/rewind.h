@@ -0,0 +1,17 @@
+/*
+  Hatari - rewind.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_REWIND_H
+#define HATARI_REWIND_H
+
+#define REWIND_SEGMENT_FRAMES	50	/* frames captured against one base */
+
+extern void Rewind_SetLength(int nLength);
+extern void Rewind_Capture(void);
+extern bool Rewind_Step(void);
+
+#endif
@@ -8,11 +8,9 @@
 #ifndef HATARI_RS232_H
 #define HATARI_RS232_H
 
-
-#define  MAX_RS232INPUT_BUFFER    2048  /* Must be ^2 */
-
 extern void RS232_Init(void);
 extern void RS232_UnInit(void);
+extern void RS232_Update(void);
 extern void RS232_HandleUCR(Sint16 ucr);
 extern bool RS232_SetBaudRate(int nBaud);
 extern void RS232_SetBaudRateFromTimerD(void);
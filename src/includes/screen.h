@@ -116,12 +116,31 @@ extern void Screen_Init(void);
 extern void Screen_UnInit(void);
 extern void Screen_Reset(void);
 extern void Screen_SetFullUpdate(void);
+extern bool Screen_CheckFullUpdate(void);
+extern void Screen_SetUpdated(void);
+extern bool Screen_CheckUpdated(void);
 extern void Screen_EnterFullScreen(void);
 extern void Screen_ReturnFromFullScreen(void);
 extern void Screen_ModeChanged(void);
 extern bool Screen_Draw(void);
+extern bool Screen_FrameWanted(void);
+extern Uint64 Screen_GetFrameHash(int *pWidth, int *pHeight);
+extern void Screen_HashFrame(void);
 extern bool Screen_SetSDLVideoSize(int width, int height, int bitdepth);
 
+/* libretro frontend can convert frames in a thread, while next one is emulated */
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+# define ENABLE_CONVERT_THREAD 1
+extern void Screen_ConvertThread(bool bEnable);
+extern void Screen_ConvertWait(void);
+extern bool Screen_ConvertThreaded(void);
+#else
+# define ENABLE_CONVERT_THREAD 0
+static inline void Screen_ConvertThread(bool bEnable) { }
+static inline void Screen_ConvertWait(void) { }
+static inline bool Screen_ConvertThreaded(void) { return false; }
+#endif
+
 extern bool bTTSampleHold;      /* TT special video mode */
 
 #endif  /* ifndef HATARI_SCREEN_H */
@@ -13,7 +13,11 @@
 
 extern int ScreenSnapShot_SavePNG_ToFile(SDL_Surface *surface, FILE *fp, int png_compression_level, int png_filter ,
 		int CropLeft , int CropRight , int CropTop , int CropBottom );
+extern int ScreenSnapShot_SavePNG_ToMemory(const Uint8 *rgb, int w, int h, int png_compression_level, int png_filter,
+		Uint8 **pData, size_t *pAlloc, size_t offset);
 extern void ScreenSnapShot_SaveScreen(void);
+extern void ScreenSnapShot_PipeFrame(void);
+extern void ScreenSnapShot_UnInit(void);
 
 #endif /* ifndef HATARI_SCREENSNAPSHOT_H */
 
@@ -0,0 +1,21 @@
+/*
+  Hatari - serialIO.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_SERIALIO_H
+#define HATARI_SERIALIO_H
+
+typedef struct serialio_s serialio_t;
+
+extern serialio_t *SerialIO_Open(const char *pszInName, const char *pszOutName, bool bAppend);
+extern void SerialIO_Close(serialio_t *dev);
+extern bool SerialIO_Write(serialio_t *dev, const Uint8 *pData, int nSize);
+extern int SerialIO_Read(serialio_t *dev, Uint8 *pData, int nSize);
+extern int SerialIO_Available(serialio_t *dev);
+extern int SerialIO_GetFd(serialio_t *dev, bool bOutput);
+extern void SerialIO_UnInit(void);
+
+#endif
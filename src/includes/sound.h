@@ -29,6 +29,7 @@ extern bool	Sound_BufferIndexNeedReset;
 /* Internal data types */
 
 typedef         Sint64			yms64;
+typedef         Uint64			ymu64;
 
 typedef		Sint8			yms8;
 typedef		Sint16			yms16;
@@ -54,7 +55,13 @@ extern void Sound_ResetBufferIndex(void);
 extern void Sound_MemorySnapShot_Capture(bool bSave);
 extern void Sound_Update(bool FillFrame);
 extern void Sound_Update_VBL(void);
+#ifdef __LIBRETRO__
+extern void Sound_RetroRingSetOutput(int nOutputFreq, bool bSinc);
+extern void Sound_RetroRingRead(Sint16 *pBuffer, int nSamples);
+extern void Sound_RetroRingFlush(void);
+#endif
 extern void Sound_WriteReg( int reg , Uint8 data );
+extern void Sound_QueueReg(int reg, Uint8 data);
 extern bool Sound_BeginRecording(char *pszCaptureFileName);
 extern void Sound_EndRecording(void);
 extern bool Sound_AreWeRecording(void);
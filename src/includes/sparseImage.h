@@ -0,0 +1,47 @@
+/*
+  Hatari - sparseImage.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_SPARSEIMAGE_H
+#define HATARI_SPARSEIMAGE_H
+
+#define SPARSEIMAGE_SECTOR_SIZE		512
+#define SPARSEIMAGE_CACHE		8	/* Number of decoded clusters kept */
+
+typedef struct
+{
+	Uint32 nCluster;		/* cluster number, 0xffffffff if unused */
+	Uint32 nLastUsed;
+	bool bDirty;
+	Uint8 *pData;
+} SPARSEIMAGE_CLUSTER;
+
+typedef struct
+{
+	FILE *fp;
+	bool bReadOnly;
+	Uint32 nSectors;		/* emulated disk size */
+	Uint32 nClusterSize;		/* in bytes */
+	Uint32 nClusters;
+	Uint32 *pOffset;		/* cluster positions in sectors, 0 = empty */
+	Uint32 *pLength;		/* stored (compressed) cluster lengths */
+	off_t nIndexOffset;
+	off_t nEnd;			/* where new clusters are appended */
+	Uint32 nUseCounter;
+	Uint8 *pPacked;			/* compression buffer */
+	SPARSEIMAGE_CLUSTER Cache[SPARSEIMAGE_CACHE];
+} SPARSEIMAGE;
+
+#define SparseImage_IsOpen(pImg)	((pImg)->fp != NULL)
+
+extern bool SparseImage_Check(const char *pszFileName);
+extern bool SparseImage_Open(SPARSEIMAGE *pImg, FILE *fp, bool bReadOnly);
+extern void SparseImage_Close(SPARSEIMAGE *pImg);
+extern int SparseImage_Read(SPARSEIMAGE *pImg, Uint8 *pDst, Uint32 nSector, int nCount);
+extern int SparseImage_Write(SPARSEIMAGE *pImg, const Uint8 *pSrc, Uint32 nSector, int nCount);
+extern void SparseImage_Flush(SPARSEIMAGE *pImg);
+
+#endif
@@ -14,6 +14,8 @@ extern void Spec512_StoreCyclePalette(Uint16 col, Uint32 addr);
 extern void Spec512_StartFrame(void);
 extern void Spec512_ScanWholeLine(void);
 extern void Spec512_StartScanLine(void);
+extern bool Spec512_LineChangesPalette(int nSpans);
+extern Uint64 Spec512_LineHash(const Uint8 *pSTLine, int nBytes, Uint32 nSeed);
 extern void Spec512_EndScanLine(void);
 extern void Spec512_UpdatePaletteSpan(void);
 
@@ -23,6 +23,23 @@ extern Uint8 STRam[16*1024*1024];
 
 extern Uint32 STRamEnd;
 
+/* ST memory space is tracked in 4 KiB pages for delta memory snapshots
+ * and screen updates.  Code writing directly to STRam, instead of using
+ * the functions below, should mark the written area with
+ * STMemory_SetDirtyArea().
+ */
+#define STRAM_PAGE_SHIFT	12
+#define STRAM_PAGE_SIZE		(1 << STRAM_PAGE_SHIFT)
+#define STRAM_PAGES		(0x1000000 >> STRAM_PAGE_SHIFT)
+
+/* STRamDirty[] bits, writes set all of them and each user clears its own */
+#define STRAM_DIRTY_DELTA	0x01	/* changed since delta snapshot base */
+#define STRAM_DIRTY_SCREEN	0x02	/* changed since screen was last converted */
+#define STRAM_DIRTY_ALL		0xff
+
+/* one extra entry for accesses crossing the end of the address space */
+extern Uint8 STRamDirty[STRAM_PAGES+1];
+
 /* TODO: when Hatari will support TT/fast-RAM, take it into account
  * in STRAM_ADDR() and STMemory_ValidArea().
  */
@@ -57,6 +74,78 @@ static inline bool STMemory_ValidArea(Uint32 addr, int size)
 }
 
 
+/**
+ * Mark page containing given address as changed since last full
+ * memory snapshot.
+ */
+static inline void STMemory_SetDirty(Uint32 Address)
+{
+	STRamDirty[(Address & 0xffffff) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+}
+
+/**
+ * Mark all pages of given memory area as changed.
+ */
+static inline void STMemory_SetDirtyArea(Uint32 Address, Uint32 Size)
+{
+	Uint32 page, last;
+
+	if (!Size)
+		return;
+	Address &= 0xffffff;
+	last = (Address + Size - 1) >> STRAM_PAGE_SHIFT;
+	if (last >= STRAM_PAGES)
+		last = STRAM_PAGES - 1;
+	for (page = Address >> STRAM_PAGE_SHIFT; page <= last; page++)
+		STRamDirty[page] = STRAM_DIRTY_ALL;
+}
+
+
+/**
+ * Return true if any page of given screen memory area was changed since
+ * STMemory_ClearDirtyScreen() was called for it.  Only the UAE CPU core
+ * tracks its writes, with the WinUAE one the area is always changed.
+ */
+static inline bool STMemory_IsDirtyScreen(Uint32 Address, Uint32 Size)
+{
+#if ENABLE_WINUAE_CPU
+	return true;
+#else
+	Uint32 page, last;
+
+	if (!Size)
+		return false;
+	Address &= 0xffffff;
+	last = (Address + Size - 1) >> STRAM_PAGE_SHIFT;
+	if (last >= STRAM_PAGES)
+		last = STRAM_PAGES - 1;
+	for (page = Address >> STRAM_PAGE_SHIFT; page <= last; page++)
+	{
+		if (STRamDirty[page] & STRAM_DIRTY_SCREEN)
+			return true;
+	}
+	return false;
+#endif
+}
+
+/**
+ * Forget screen changes in given memory area, called after converting it.
+ */
+static inline void STMemory_ClearDirtyScreen(Uint32 Address, Uint32 Size)
+{
+	Uint32 page, last;
+
+	if (!Size)
+		return;
+	Address &= 0xffffff;
+	last = (Address + Size - 1) >> STRAM_PAGE_SHIFT;
+	if (last >= STRAM_PAGES)
+		last = STRAM_PAGES - 1;
+	for (page = Address >> STRAM_PAGE_SHIFT; page <= last; page++)
+		STRamDirty[page] &= ~STRAM_DIRTY_SCREEN;
+}
+
+
 /**
  * Write 32-bit word into ST memory space.
  * NOTE - value will be convert to 68000 endian
@@ -64,6 +153,8 @@ static inline bool STMemory_ValidArea(Uint32 addr, int size)
 static inline void STMemory_WriteLong(Uint32 Address, Uint32 Var)
 {
 	Address &= 0xffffff;
+	STRamDirty[Address >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+	STRamDirty[(Address + 3) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		do_put_mem_long(&ROMmemory[Address-0xe00000], Var);
@@ -82,6 +173,8 @@ static inline void STMemory_WriteLong(Uint32 Address, Uint32 Var)
 static inline void STMemory_WriteWord(Uint32 Address, Uint16 Var)
 {
 	Address &= 0xffffff;
+	STRamDirty[Address >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+	STRamDirty[(Address + 1) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		do_put_mem_word(&ROMmemory[Address-0xe00000], Var);
@@ -99,6 +192,7 @@ static inline void STMemory_WriteWord(Uint32 Address, Uint16 Var)
 static inline void STMemory_WriteByte(Uint32 Address, Uint8 Var)
 {
 	Address &= 0xffffff;
+	STRamDirty[Address >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		ROMmemory[Address-0xe00000] = Var;
@@ -163,8 +257,11 @@ static inline Uint8 STMemory_ReadByte(Uint32 Address)
 }
 
 
+extern void STMemory_AdviseHugePages(void *pMem, size_t nSize);
 extern bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *name);
 extern void STMemory_MemorySnapShot_Capture(bool bSave);
+extern void STMemory_MemorySnapShot_CaptureDelta(bool bSave);
+extern void STMemory_ClearDirtyDelta(void);
 extern void STMemory_SetDefaultConfig(void);
 
 #endif
@@ -197,6 +197,27 @@ extern int ZEXPORT unzLocateFile (unzFile file,
 */
 
 
+/* Position of a file in the central directory, to go back to it later */
+typedef struct unz_file_pos_s
+{
+	uLong pos_in_zip_directory;   /* offset in zip file directory */
+	uLong num_of_file;            /* # of file */
+} unz_file_pos;
+
+extern int ZEXPORT unzGetFilePos (unzFile file, unz_file_pos *file_pos);
+/*
+  Get the position of the current file in the central directory
+  return UNZ_OK if there is no problem
+*/
+
+extern int ZEXPORT unzGoToFilePos (unzFile file, const unz_file_pos *file_pos);
+/*
+  Set the current file of the zipfile to the one at file_pos, as got
+  from unzGetFilePos() on the same zipfile, without scanning for it
+  return UNZ_OK if there is no problem
+*/
+
+
 extern int ZEXPORT unzGetCurrentFileInfo (unzFile file,
 					  unz_file_info *pfile_info,
 					  char *szFileName,
@@ -8,6 +8,7 @@
 #define HATARI_UTILS_H
 
 #include <SDL_types.h>
+#include <time.h>
 
 
 #define CRC32_POLY	0x04c11db7	/* IEEE 802.3 recommandation */
@@ -20,5 +21,14 @@ extern void    crc32_add_byte ( Uint32 *crc , Uint8 c );
 extern void    crc16_reset ( Uint16 *crc );
 extern void    crc16_add_byte ( Uint16 *crc , Uint8 c );
 
+/* Date returned by Utils_Time() at emulation start in deterministic mode */
+#define UTILS_DETERMINISTIC_EPOCH	946684800	/* 2000-01-01 00:00:00 UTC */
+
+extern void    Utils_RandSeed ( void );
+extern int     Utils_Rand ( void );
+extern time_t  Utils_Time ( void );
+extern struct tm *Utils_LocalTime ( const time_t *t );
+extern void    Utils_MemorySnapShot_Capture ( bool bSave );
+
 
 #endif		/* HATARI_UTILS_H */
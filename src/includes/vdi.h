@@ -34,6 +34,16 @@
 #define MIN_VDI_HEIGHT  208
 
 
+/* NF_VDI Native Feature subids */
+enum
+{
+  NF_VDI_INIT,
+  NF_VDI_FILL,
+  NF_VDI_COPY,
+  NF_VDI_EXPAND,
+  NF_VDI_DIRTY
+};
+
 enum
 {
   GEMCOLOR_2,
@@ -54,5 +64,7 @@ extern bool VDI_AES_Entry(void);
 extern void VDI_LineA(Uint32 LineABase, Uint32 FontBase);
 extern void VDI_Complete(void);
 extern void VDI_Reset(void);
+extern bool VDI_GetDirtyLines(int *first, int *last);
+extern bool VDI_NatFeat(Uint32 stack, Uint32 subid, Uint32 *retval);
 
 #endif  /* HATARI_VDI_H */
@@ -8,6 +8,8 @@
 #ifndef HATARI_VIDEO_H
 #define HATARI_VIDEO_H
 
+#include "cycles.h"
+
 /*
   All the following processor timings are based on a bog standard 8MHz 68000 as
   found in all standard STs:
@@ -113,6 +115,7 @@
 extern int STRes;
 extern int TTRes;
 extern int nFrameSkips;
+extern bool bSkipNextFrame;
 extern bool bUseHighRes;
 extern int nVBLs;
 extern int nHBL;
@@ -128,6 +131,8 @@ extern int nScreenRefreshRate;
 
 extern int nScanlinesPerFrame;
 extern int nCyclesPerLine;
+extern int VideoLineStartCycle;
+extern int VideoPrevLineStartCycle;
 
 extern int LineTimerBCycle;
 extern int TimerBEventCountCycleStart;
@@ -151,16 +156,62 @@ extern void	Video_MemorySnapShot_Capture(bool bSave);
 extern void 	Video_Reset(void);
 extern void	Video_Reset_Glue(void);
 
-extern void	Video_ConvertPosition( int FrameCycles , int *pHBL , int *pLineCycles );
-extern void	Video_GetPosition( int *pFrameCycles , int *pHBL , int *pLineCycles );
-extern void	Video_GetPosition_OnWriteAccess( int *pFrameCycles , int *pHBL , int *pLineCycles );
-extern void	Video_GetPosition_OnReadAccess( int *pFrameCycles , int *pHBL , int *pLineCycles );
+/**
+ * Convert the elapsed number of cycles since the start of the VBL
+ * into the corresponding HBL number and the cycle position in the current
+ * HBL. We use the starting cycle position of the closest HBL to compute
+ * the cycle position on the line (this allows to mix lines with different
+ * values for nCyclesPerLine).
+ * We can have 2 cases on the limit where the real video line count can be
+ * different from nHBL :
+ * - when reading video address between cycle 0 and 12, LineCycle will be <0,
+ *   so we need to use the data from line nHBL-1
+ * - if LineCycle >= nCyclesPerLine, this means the HBL int was not processed
+ *   yet, so the video line number is in fact nHBL+1
+ * This is called by many IO handlers, so start cycles of the current and
+ * previous lines are kept up to date by the HBL handler.
+ */
+static inline void Video_ConvertPosition ( int FrameCycles , int *pHBL , int *pLineCycles )
+{
+	*pHBL = nHBL;
+	*pLineCycles = FrameCycles - VideoLineStartCycle;
+
+	if ( *pLineCycles < 0 )					/* reading from the previous video line */
+	{
+		*pHBL = nHBL-1;
+		*pLineCycles = FrameCycles - VideoPrevLineStartCycle;
+	}
+	else if ( *pLineCycles >= nCyclesPerLine )		/* reading on the next line, but HBL int was delayed */
+	{							/* (or several lines with batched HBLs) */
+		*pHBL = nHBL + *pLineCycles / nCyclesPerLine;
+		*pLineCycles %= nCyclesPerLine;
+	}
+}
+
+static inline void Video_GetPosition ( int *pFrameCycles , int *pHBL , int *pLineCycles )
+{
+	*pFrameCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
+	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
+}
+
+static inline void Video_GetPosition_OnWriteAccess ( int *pFrameCycles , int *pHBL , int *pLineCycles )
+{
+	*pFrameCycles = Cycles_GetCounterOnWriteAccess(CYCLES_COUNTER_VIDEO);
+	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
+}
+
+static inline void Video_GetPosition_OnReadAccess ( int *pFrameCycles , int *pHBL , int *pLineCycles )
+{
+	*pFrameCycles = Cycles_GetCounterOnReadAccess(CYCLES_COUNTER_VIDEO);
+	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
+}
 
 extern void 	Video_Sync_WriteByte(void);
 
 extern int	Video_TimerB_GetPos( int LineNumber );
 
 extern void	Video_InterruptHandler_HBL(void);
+extern void	Video_HBL_Sync(void);
 extern void	Video_InterruptHandler_EndLine(void);
 
 extern void	Video_SetScreenRasters(void);
@@ -168,6 +219,8 @@ extern void	Video_GetTTRes(int *width, int *height, int *bpp);
 extern bool	Video_RenderTTScreen(void);
 
 extern void	Video_AddInterruptTimerB ( int Pos );
+extern void	Video_TimerB_Sync ( void );
+extern void	Video_TimerB_Update ( void );
 
 extern void	Video_StartInterrupts ( int PendingCyclesOver );
 extern void	Video_InterruptHandler_VBL(void);
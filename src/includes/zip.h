@@ -22,7 +22,10 @@ extern struct dirent **ZIP_GetFilesDir(const zip_dir *files, const char *dir, in
 extern void ZIP_FreeZipDir(zip_dir *zd);
 extern zip_dir *ZIP_GetFiles(const char *pszFileName);
 extern Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath, long *pImageSize, int *pImageType);
+extern Uint8 *ZIP_ReadDiskUncached(const char *pszFileName, const char *pszZipPath, long *pImageSize, int *pImageType);
 extern bool ZIP_WriteDisk(int Drive, const char *pszFileName, unsigned char *pBuffer, int ImageSize);
+extern bool ZIP_GetFileInfo(const char *pszFileName, const char *pszPath, long *pSize, time_t *pTime, bool *pbDir);
+extern bool ZIP_ExtractFileTo(const char *pszFileName, const char *pszPath, const char *pszDestFile);
 extern Uint8 *ZIP_ReadFirstFile(const char *pszFileName, long *pImageSize, const char * const ppszExts[]);
 
 
@@ -0,0 +1,495 @@
+/*
+  Hatari - inputMovie.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Input movies: record the input given to the emulated machine (IKBD key
+  events, joystick bits, mouse buttons and motion) into a compressed log,
+  and play it back later instead of the host input.
+
+  The log starts with a memory snapshot of the emulation state at the
+  start of the recording, taken at the VBL boundary like boot snapshots.
+  It's followed by one record for each input update which changed
+  something, indexed by the number of VBLs since the start. Together with
+  the deterministic mode (--deterministic), playback reproduces the
+  recorded session bit-exactly, so with --benchmark it can be used to
+  measure and check emulator performance on real sessions.
+
+  Only the input is recorded: host actions like resets, disk changes and
+  option changes in the middle of a recording are not, and the late
+  input polling setting needs to be the same for playback.
+*/
+const char InputMovie_fileid[] = "Hatari inputMovie.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "ikbd.h"
+#include "inputMovie.h"
+#include "log.h"
+#include "memorySnapShot.h"
+
+#if HAVE_LIBZ
+/* Remove possible conflicting mkdir declaration from cpu/sysdeps.h */
+#undef mkdir
+#include <zlib.h>
+typedef gzFile IM_File;
+#define InputMovie_fopen(name, mode)	gzopen(name, mode)
+#define InputMovie_fclose(fp)		gzclose(fp)
+#define InputMovie_fgetc(fp)		gzgetc(fp)
+#define InputMovie_fread(fp, buf, len)	gzread(fp, buf, len)
+#define InputMovie_fwrite(fp, buf, len)	gzwrite(fp, buf, len)
+#else
+typedef FILE* IM_File;
+#define InputMovie_fopen(name, mode)	fopen(name, mode)
+#define InputMovie_fclose(fp)		fclose(fp)
+#define InputMovie_fgetc(fp)		fgetc(fp)
+#define InputMovie_fread(fp, buf, len)	fread(buf, 1, len, fp)
+#define InputMovie_fwrite(fp, buf, len)	fwrite(buf, 1, len, fp)
+#endif
+
+#define INPUTMOVIE_MAGIC	"HATARIIM"
+#define INPUTMOVIE_VERSION	1
+#define INPUTMOVIE_MAX_KEYS	64	/* key events per input update */
+
+/* Record flags, followed by the VBL delta to the previous record and
+ * the data for the set flags in this order: key events (count and
+ * scancodes with bit 7 set on release), state (joystick bits and
+ * buttons) and mouse motion (zigzag encoded X and Y).
+ */
+#define INPUTMOVIE_REC_LATE	0x01	/* from the late input polling */
+#define INPUTMOVIE_REC_KEYS	0x02
+#define INPUTMOVIE_REC_STATE	0x04
+#define INPUTMOVIE_REC_MOUSE	0x08
+#define INPUTMOVIE_REC_END	0x80
+
+typedef struct
+{
+	char sMagic[8];
+	Uint32 nVersion;
+	Uint32 nStateSize;	/* size of the snapshot following the header */
+} INPUTMOVIE_HEADER;
+
+typedef struct
+{
+	Uint8 nFlags;
+	Uint32 nVBL;
+	int nKeys;
+	Uint8 aKeys[INPUTMOVIE_MAX_KEYS];
+	INPUTMOVIE_INPUT Input;
+} INPUTMOVIE_RECORD;
+
+typedef enum
+{
+	INPUTMOVIE_IDLE,
+	INPUTMOVIE_START_RECORD,	/* start recording on next VBL */
+	INPUTMOVIE_START_PLAYBACK,	/* start playback on next VBL */
+	INPUTMOVIE_RECORDING,
+	INPUTMOVIE_PLAYING
+} INPUTMOVIE_STATE;
+
+static INPUTMOVIE_STATE nState;
+static char sFileName[FILENAME_MAX];
+static IM_File MovieFile;
+static Uint32 nMovieVBLs;		/* VBLs since the start of the movie */
+static Uint32 nLastVBL;			/* VBL of the last record */
+static INPUTMOVIE_RECORD Record;	/* pending (recording) or next (playback) record */
+static INPUTMOVIE_INPUT LastInput;	/* joystick & buttons of the last record */
+static bool bHaveLastInput;
+static bool bApplying;			/* key events are from the movie */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Record the input to given file, starting from the next VBL.
+ */
+void InputMovie_SetRecord(const char *pszFileName)
+{
+	strncpy(sFileName, pszFileName, sizeof(sFileName) - 1);
+	nState = INPUTMOVIE_START_RECORD;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Play back the input from given file, starting from the next VBL.
+ */
+void InputMovie_SetPlayback(const char *pszFileName)
+{
+	strncpy(sFileName, pszFileName, sizeof(sFileName) - 1);
+	nState = INPUTMOVIE_START_PLAYBACK;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true while the host input is replaced by a movie.
+ */
+bool InputMovie_IsPlaying(void)
+{
+	return nState == INPUTMOVIE_PLAYING;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop recording or playback, and finish the log when recording.
+ */
+static void InputMovie_Stop(void)
+{
+	Uint8 nEnd = INPUTMOVIE_REC_END;
+
+	if (nState == INPUTMOVIE_RECORDING)
+	{
+		InputMovie_fwrite(MovieFile, &nEnd, 1);
+		Log_Printf(LOG_INFO, "Input movie '%s' recorded, %u VBLs.\n", sFileName, nMovieVBLs);
+	}
+	else if (nState == INPUTMOVIE_PLAYING)
+	{
+		Log_Printf(LOG_INFO, "Input movie '%s' played back, %u VBLs.\n", sFileName, nMovieVBLs);
+	}
+	if (MovieFile)
+	{
+		InputMovie_fclose(MovieFile);
+		MovieFile = NULL;
+	}
+	nState = INPUTMOVIE_IDLE;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add unsigned value to given buffer in LEB128 format, return the
+ * number of bytes used.
+ */
+static int InputMovie_PutVarint(Uint8 *p, Uint32 nValue)
+{
+	int n = 0;
+
+	while (nValue >= 0x80)
+	{
+		p[n++] = (nValue & 0x7f) | 0x80;
+		nValue >>= 7;
+	}
+	p[n++] = nValue;
+	return n;
+}
+
+/**
+ * Read LEB128 value from the movie file. Return false on error.
+ */
+static bool InputMovie_GetVarint(Uint32 *pValue)
+{
+	Uint32 nValue = 0;
+	int nShift, c;
+
+	for (nShift = 0; nShift < 32; nShift += 7)
+	{
+		c = InputMovie_fgetc(MovieFile);
+		if (c < 0)
+			return false;
+		nValue |= (Uint32)(c & 0x7f) << nShift;
+		if (!(c & 0x80))
+		{
+			*pValue = nValue;
+			return true;
+		}
+	}
+	return false;
+}
+
+#define InputMovie_ZigZag(v)	(((Uint32)(v) << 1) ^ (Uint32)((v) < 0 ? -1 : 0))
+#define InputMovie_UnZigZag(v)	((Sint32)((v) >> 1) ^ -(Sint32)((v) & 1))
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture the emulation state and write it as the start of the log.
+ */
+static void InputMovie_StartRecord(void)
+{
+	INPUTMOVIE_HEADER header;
+	size_t nSize = MemorySnapShot_MemorySize(false);
+	void *pState = malloc(nSize);
+	bool ok = false;
+
+	nState = INPUTMOVIE_IDLE;
+	if (!ConfigureParams.System.bDeterministic)
+		Log_Printf(LOG_WARN, "Input movie recorded without --deterministic, playback can diverge.\n");
+
+	MovieFile = InputMovie_fopen(sFileName, "wb");
+	if (pState && MovieFile && MemorySnapShot_CaptureMemory(pState, nSize, false))
+	{
+		memset(&header, 0, sizeof(header));
+		memcpy(header.sMagic, INPUTMOVIE_MAGIC, sizeof(header.sMagic));
+		header.nVersion = INPUTMOVIE_VERSION;
+		header.nStateSize = nSize;
+		ok = InputMovie_fwrite(MovieFile, &header, sizeof(header)) == (int)sizeof(header)
+		     && InputMovie_fwrite(MovieFile, pState, nSize) == (int)nSize;
+	}
+	free(pState);
+	if (!ok)
+	{
+		Log_AlertDlg(LOG_ERROR, "Can't record input movie '%s'.", sFileName);
+		InputMovie_Stop();
+		return;
+	}
+
+	memset(&Record, 0, sizeof(Record));
+	bHaveLastInput = false;
+	nMovieVBLs = nLastVBL = 0;
+	nState = INPUTMOVIE_RECORDING;
+	Log_Printf(LOG_INFO, "Recording input movie '%s'.\n", sFileName);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the next record from the log. Return false at its end.
+ */
+static bool InputMovie_ReadRecord(void)
+{
+	Uint32 nValue;
+	int c;
+
+	c = InputMovie_fgetc(MovieFile);
+	if (c < 0 || (c & INPUTMOVIE_REC_END))
+		return false;
+	Record.nFlags = c;
+
+	if (!InputMovie_GetVarint(&nValue))
+		return false;
+	Record.nVBL = nLastVBL + nValue;
+	nLastVBL = Record.nVBL;
+
+	Record.nKeys = 0;
+	if (Record.nFlags & INPUTMOVIE_REC_KEYS)
+	{
+		c = InputMovie_fgetc(MovieFile);
+		if (c < 0 || c > INPUTMOVIE_MAX_KEYS
+		    || InputMovie_fread(MovieFile, Record.aKeys, c) != c)
+			return false;
+		Record.nKeys = c;
+	}
+	if (Record.nFlags & INPUTMOVIE_REC_STATE)
+	{
+		c = InputMovie_fgetc(MovieFile);
+		Record.Input.nJoy = c;
+		c = InputMovie_fgetc(MovieFile);
+		Record.Input.nButtons = c;
+		if (c < 0)
+			return false;
+	}
+	if (Record.nFlags & INPUTMOVIE_REC_MOUSE)
+	{
+		if (!InputMovie_GetVarint(&nValue))
+			return false;
+		Record.Input.nMouseX = InputMovie_UnZigZag(nValue);
+		if (!InputMovie_GetVarint(&nValue))
+			return false;
+		Record.Input.nMouseY = InputMovie_UnZigZag(nValue);
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore the emulation state from the start of the log.
+ */
+static void InputMovie_StartPlayback(void)
+{
+	INPUTMOVIE_HEADER header;
+	void *pState = NULL;
+	bool ok = false;
+
+	nState = INPUTMOVIE_IDLE;
+	MovieFile = InputMovie_fopen(sFileName, "rb");
+	if (MovieFile
+	    && InputMovie_fread(MovieFile, &header, sizeof(header)) == (int)sizeof(header)
+	    && memcmp(header.sMagic, INPUTMOVIE_MAGIC, sizeof(header.sMagic)) == 0
+	    && header.nVersion == INPUTMOVIE_VERSION
+	    && (pState = malloc(header.nStateSize)) != NULL
+	    && InputMovie_fread(MovieFile, pState, header.nStateSize) == (int)header.nStateSize)
+	{
+		ok = MemorySnapShot_RestoreMemory(pState, header.nStateSize);
+	}
+	free(pState);
+	if (!ok)
+	{
+		Log_AlertDlg(LOG_ERROR, "Can't play back input movie '%s'.", sFileName);
+		InputMovie_Stop();
+		return;
+	}
+
+	memset(&LastInput, 0, sizeof(LastInput));
+	nMovieVBLs = nLastVBL = 0;
+	nState = INPUTMOVIE_PLAYING;
+	Log_Printf(LOG_INFO, "Playing back input movie '%s'.\n", sFileName);
+	if (!InputMovie_ReadRecord())
+		InputMovie_Stop();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called at the VBL boundary: start a pending recording or playback,
+ * otherwise count the VBLs used for indexing the records.
+ */
+void InputMovie_Vbl(void)
+{
+	switch (nState)
+	{
+	case INPUTMOVIE_START_RECORD:
+		InputMovie_StartRecord();
+		break;
+	case INPUTMOVIE_START_PLAYBACK:
+		InputMovie_StartPlayback();
+		break;
+	case INPUTMOVIE_RECORDING:
+	case INPUTMOVIE_PLAYING:
+		nMovieVBLs++;
+		break;
+	default:
+		break;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called for each key event sent to the IKBD. While recording, the event
+ * is added to the next record. Return false if the event should be
+ * ignored, because the keyboard input comes from a movie.
+ */
+bool InputMovie_KeyEvent(Uint8 ScanCode, bool bPress)
+{
+	if (nState == INPUTMOVIE_RECORDING)
+	{
+		if (Record.nKeys < INPUTMOVIE_MAX_KEYS)
+			Record.aKeys[Record.nKeys++] = (ScanCode & 0x7f) | (bPress ? 0 : 0x80);
+		else
+			Log_Printf(LOG_WARN, "Too many key events for input movie, event dropped.\n");
+		return true;
+	}
+	return nState != INPUTMOVIE_PLAYING || bApplying;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write a record of given input update, if it changed something.
+ */
+static void InputMovie_WriteRecord(const INPUTMOVIE_INPUT *pInput, bool bLate)
+{
+	Uint8 aBuf[2 + 5 + INPUTMOVIE_MAX_KEYS + 2 + 2*5];
+	Uint8 nFlags = bLate ? INPUTMOVIE_REC_LATE : 0;
+	int n = 1;
+
+	if (Record.nKeys)
+		nFlags |= INPUTMOVIE_REC_KEYS;
+	if (!bHaveLastInput || pInput->nJoy != LastInput.nJoy
+	    || pInput->nButtons != LastInput.nButtons)
+		nFlags |= INPUTMOVIE_REC_STATE;
+	if (pInput->nMouseX || pInput->nMouseY)
+		nFlags |= INPUTMOVIE_REC_MOUSE;
+	if (!(nFlags & ~INPUTMOVIE_REC_LATE))
+		return;
+
+	aBuf[0] = nFlags;
+	n += InputMovie_PutVarint(aBuf + n, nMovieVBLs - nLastVBL);
+	if (nFlags & INPUTMOVIE_REC_KEYS)
+	{
+		aBuf[n++] = Record.nKeys;
+		memcpy(aBuf + n, Record.aKeys, Record.nKeys);
+		n += Record.nKeys;
+		Record.nKeys = 0;
+	}
+	if (nFlags & INPUTMOVIE_REC_STATE)
+	{
+		aBuf[n++] = pInput->nJoy;
+		aBuf[n++] = pInput->nButtons;
+		LastInput = *pInput;
+		bHaveLastInput = true;
+	}
+	if (nFlags & INPUTMOVIE_REC_MOUSE)
+	{
+		n += InputMovie_PutVarint(aBuf + n, InputMovie_ZigZag(pInput->nMouseX));
+		n += InputMovie_PutVarint(aBuf + n, InputMovie_ZigZag(pInput->nMouseY));
+	}
+	nLastVBL = nMovieVBLs;
+
+	if (InputMovie_fwrite(MovieFile, aBuf, n) != n)
+	{
+		Log_AlertDlg(LOG_ERROR, "Error writing input movie '%s'.", sFileName);
+		InputMovie_Stop();
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Replace given input update with the records for the current VBL (and
+ * any earlier ones not applied yet). Records of the late input polling
+ * are only applied by a late update, or by the next normal one.
+ */
+static void InputMovie_ReadInput(INPUTMOVIE_INPUT *pInput, bool bLate)
+{
+	int i;
+
+	pInput->nJoy = LastInput.nJoy;
+	pInput->nButtons = LastInput.nButtons;
+	pInput->nMouseX = pInput->nMouseY = 0;
+
+	while (Record.nVBL < nMovieVBLs
+	       || (Record.nVBL == nMovieVBLs && (bLate || !(Record.nFlags & INPUTMOVIE_REC_LATE))))
+	{
+		bApplying = true;
+		for (i = 0; i < Record.nKeys; i++)
+			IKBD_PressSTKey(Record.aKeys[i] & 0x7f, !(Record.aKeys[i] & 0x80));
+		bApplying = false;
+
+		if (Record.nFlags & INPUTMOVIE_REC_STATE)
+		{
+			LastInput.nJoy = pInput->nJoy = Record.Input.nJoy;
+			LastInput.nButtons = pInput->nButtons = Record.Input.nButtons;
+		}
+		if (Record.nFlags & INPUTMOVIE_REC_MOUSE)
+		{
+			pInput->nMouseX += Record.Input.nMouseX;
+			pInput->nMouseY += Record.Input.nMouseY;
+		}
+
+		if (!InputMovie_ReadRecord())
+		{
+			InputMovie_Stop();
+			break;
+		}
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the frontend with the input it's about to give to the
+ * emulated machine, after the key events. While recording, the input
+ * is logged, and during playback it's replaced by the logged input.
+ * Late updates come from the late input polling within a frame.
+ */
+void InputMovie_Update(INPUTMOVIE_INPUT *pInput, bool bLate)
+{
+	if (nState == INPUTMOVIE_RECORDING)
+		InputMovie_WriteRecord(pInput, bLate);
+	else if (nState == INPUTMOVIE_PLAYING)
+		InputMovie_ReadInput(pInput, bLate);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish the log of a running recording.
+ */
+void InputMovie_UnInit(void)
+{
+	InputMovie_Stop();
+}
@@ -27,6 +27,11 @@
   to cope with all type of handlers in a straight forward way.
   Also note the 'mirror' (or shadow) registers of the PSG - this is used by most
   games.
+  The intercept tables with one function pointer per address are only used to
+  set up the handlers. For the accesses, they are compacted into one table of
+  16 bit handler indexes per 256 bytes page, pages with the same content (e.g.
+  bus error and void regions) sharing the same table, so that the tables used
+  at run time fit in a few KB of cache instead of 512 KB.
 */
 const char IoMem_fileid[] = "Hatari ioMem.c : " __DATE__ " " __TIME__;
 
@@ -36,12 +41,27 @@ const char IoMem_fileid[] = "Hatari ioMem.c : " __DATE__ " " __TIME__;
 #include "ioMemTables.h"
 #include "memorySnapShot.h"
 #include "m68000.h"
+#include "screen.h"
+#include "video.h"
 #include "sysdeps.h"
 
 
 static void (*pInterceptReadTable[0x8000])(void);     /* Table with read access handlers */
 static void (*pInterceptWriteTable[0x8000])(void);    /* Table with write access handlers */
 
+#define IOMEM_PAGES		(0x8000 >> 8)
+#define IOMEM_HANDLERS_MAX	1024
+
+static void (*pIoMemHandlers[IOMEM_HANDLERS_MAX])(void); /* Distinct handlers of the tables above */
+static int nIoMemHandlers;
+static Uint16 IoMemPagePool[2*IOMEM_PAGES][256];      /* Handler indexes for distinct pages */
+static Uint16 *pIoMemReadPages[IOMEM_PAGES];          /* Compacted read table, per page */
+static Uint16 *pIoMemWritePages[IOMEM_PAGES];         /* Compacted write table, per page */
+
+/* Handler index in compacted tables for an address offset from 0xff8000 */
+#define IOMEM_READ_INDEX(idx)	pIoMemReadPages[(idx) >> 8][(idx) & 0xff]
+#define IOMEM_WRITE_INDEX(idx)	pIoMemWritePages[(idx) >> 8][(idx) & 0xff]
+
 int nIoMemAccessSize;                                 /* Set to 1, 2 or 4 according to byte, word or long word access */
 Uint32 IoAccessBaseAddress;                           /* Stores the base address of the IO mem access */
 Uint32 IoAccessCurrentAddress;                        /* Current byte address while handling WORD and LONG accesses */
@@ -87,6 +107,75 @@ static void IoMem_SetBusErrorRegion(Uint32 startaddr, Uint32 endaddr)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return index of given handler in pIoMemHandlers, add it if needed.
+ */
+static Uint16 IoMem_HandlerIndex(void (*pFunc)(void))
+{
+	int i;
+
+	for (i = 0; i < nIoMemHandlers; i++)
+	{
+		if (pIoMemHandlers[i] == pFunc)
+			return i;
+	}
+	if (nIoMemHandlers == IOMEM_HANDLERS_MAX)
+	{
+		fprintf(stderr, "IoMem_Init: too many IO handlers!\n");
+		abort();
+	}
+	pIoMemHandlers[nIoMemHandlers] = pFunc;
+	return nIoMemHandlers++;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Build the compacted read and write tables from the intercept tables.
+ */
+static void IoMem_CompactTables(void)
+{
+	void (**pTable)(void);
+	void (*pLastFunc)(void) = NULL;
+	Uint16 **pPages;
+	Uint16 Page[256], nLast = 0;
+	int nPages = 0;
+	int t, p, i, j;
+
+	nIoMemHandlers = 0;
+	for (t = 0; t < 2; t++)
+	{
+		pTable = t ? pInterceptWriteTable : pInterceptReadTable;
+		pPages = t ? pIoMemWritePages : pIoMemReadPages;
+
+		for (p = 0; p < IOMEM_PAGES; p++)
+		{
+			for (i = 0; i < 256; i++)
+			{
+				/* Neighbour addresses mostly use the same handler */
+				if (pTable[p*256 + i] != pLastFunc || nIoMemHandlers == 0)
+				{
+					pLastFunc = pTable[p*256 + i];
+					nLast = IoMem_HandlerIndex(pLastFunc);
+				}
+				Page[i] = nLast;
+			}
+
+			/* Share page table with an identical one */
+			for (j = 0; j < nPages; j++)
+			{
+				if (memcmp(IoMemPagePool[j], Page, sizeof(Page)) == 0)
+					break;
+			}
+			if (j == nPages)
+				memcpy(IoMemPagePool[nPages++], Page, sizeof(Page));
+			pPages[p] = IoMemPagePool[j];
+		}
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Create 'intercept' tables for hardware address access. Each 'intercept
@@ -143,8 +232,10 @@ void IoMem_Init(void)
 	{
 		case MACHINE_ST:  pInterceptAccessFuncs = IoMemTable_ST; break;
 		case MACHINE_STE: pInterceptAccessFuncs = IoMemTable_STE; break;
+#if !ENABLE_ST_ONLY
 		case MACHINE_TT: pInterceptAccessFuncs = IoMemTable_TT; break;
 		case MACHINE_FALCON: pInterceptAccessFuncs = IoMemTable_Falcon; break;
+#endif
 		default: abort(); /* bug */
 	}
 
@@ -170,6 +261,7 @@ void IoMem_Init(void)
 		}
 	}
 
+#if !ENABLE_ST_ONLY
 	/* Set registers for Falcon DSP emulation */
 	if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
 	{
@@ -191,6 +283,7 @@ void IoMem_Init(void)
 					       pInterceptWriteTable);
 		}
 	}
+#endif
 
 	/* Disable blitter? */
 	if (!ConfigureParams.System.bBlitter && ConfigureParams.System.nMachineType == MACHINE_ST)
@@ -228,6 +321,8 @@ void IoMem_Init(void)
 
 		}
 	}
+
+	IoMem_CompactTables();
 }
 
 /*-----------------------------------------------------------------------*/
@@ -254,6 +349,18 @@ void IoMem_UnInit(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Bring batched HBLs up to date before accessing the video or DMA sound
+ * registers, which depend on them.
+ */
+static inline void IoMem_SyncVideo(uaecptr addr)
+{
+	if ((addr & 0xffff00) == 0xff8200 || (addr & 0xffff00) == 0xff8900)
+		Video_HBL_Sync();
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Handle byte read access from IO memory.
@@ -271,12 +378,14 @@ uae_u32 IoMem_bget(uaecptr addr)
 		return -1;
 	}
 
+	IoMem_SyncVideo(addr);
+
 	IoAccessBaseAddress = addr;                   /* Store access location */
 	nIoMemAccessSize = SIZE_BYTE;
 	nBusErrorAccesses = 0;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[addr-0xff8000]();         /* Call handler */
+	pIoMemHandlers[IOMEM_READ_INDEX(addr-0xff8000)](); /* Call handler */
 
 	/* Check if we read from a bus-error region */
 	if (nBusErrorAccesses == 1)
@@ -287,7 +396,8 @@ uae_u32 IoMem_bget(uaecptr addr)
 
 	val = IoMem[addr];
 
-	LOG_TRACE(TRACE_IOMEM_RD, "IO read.b $%06x = $%02x pc=%x\n", addr, val, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_RD, TRACE_RECORD_IO_READ, 1, addr, val,
+	                 "IO read.b $%06x = $%02x pc=%x\n", addr, val, M68000_GetPC());
 
 	return val;
 }
@@ -310,6 +420,9 @@ uae_u32 IoMem_wget(uaecptr addr)
 		M68000_BusError(addr, BUS_ERROR_READ);
 		return -1;
 	}
+
+	IoMem_SyncVideo(addr);
+
 	if (addr > 0xfffffe)
 	{
 		fprintf(stderr, "Illegal IO memory access: IoMem_wget($%x)\n", addr);
@@ -322,12 +435,12 @@ uae_u32 IoMem_wget(uaecptr addr)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[idx]();                   /* Call 1st handler */
+	pIoMemHandlers[IOMEM_READ_INDEX(idx)]();        /* Call 1st handler */
 
-	if (pInterceptReadTable[idx+1] != pInterceptReadTable[idx])
+	if (IOMEM_READ_INDEX(idx+1) != IOMEM_READ_INDEX(idx))
 	{
 		IoAccessCurrentAddress = addr + 1;
-		pInterceptReadTable[idx+1]();             /* Call 2nd handler */
+		pIoMemHandlers[IOMEM_READ_INDEX(idx+1)](); /* Call 2nd handler */
 	}
 
 	/* Check if we completely read from a bus-error region */
@@ -339,7 +452,8 @@ uae_u32 IoMem_wget(uaecptr addr)
 
 	val = IoMem_ReadWord(addr);
 
-	LOG_TRACE(TRACE_IOMEM_RD, "IO read.w $%06x = $%04x pc=%x\n", addr, val, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_RD, TRACE_RECORD_IO_READ, 2, addr, val,
+	                 "IO read.w $%06x = $%04x pc=%x\n", addr, val, M68000_GetPC());
 
 	return val;
 }
@@ -363,6 +477,9 @@ uae_u32 IoMem_lget(uaecptr addr)
 		M68000_BusError(addr, BUS_ERROR_READ);
 		return -1;
 	}
+
+	IoMem_SyncVideo(addr);
+
 	if (addr > 0xfffffc)
 	{
 		fprintf(stderr, "Illegal IO memory access: IoMem_lget($%x)\n", addr);
@@ -375,14 +492,14 @@ uae_u32 IoMem_lget(uaecptr addr)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[idx]();                   /* Call 1st handler */
+	pIoMemHandlers[IOMEM_READ_INDEX(idx)]();        /* Call 1st handler */
 
 	for (n = 1; n < nIoMemAccessSize; n++)
 	{
-		if (pInterceptReadTable[idx+n] != pInterceptReadTable[idx+n-1])
+		if (IOMEM_READ_INDEX(idx+n) != IOMEM_READ_INDEX(idx+n-1))
 		{
 			IoAccessCurrentAddress = addr + n;
-			pInterceptReadTable[idx+n]();     /* Call n-th handler */
+			pIoMemHandlers[IOMEM_READ_INDEX(idx+n)](); /* Call n-th handler */
 		}
 	}
 
@@ -395,7 +512,8 @@ uae_u32 IoMem_lget(uaecptr addr)
 
 	val = IoMem_ReadLong(addr);
 
-	LOG_TRACE(TRACE_IOMEM_RD, "IO read.l $%06x = $%08x pc=%x\n", addr, val, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_RD, TRACE_RECORD_IO_READ, 4, addr, val,
+	                 "IO read.l $%06x = $%08x pc=%x\n", addr, val, M68000_GetPC());
 
 	return val;
 }
@@ -409,7 +527,8 @@ void IoMem_bput(uaecptr addr, uae_u32 val)
 {
 	addr &= 0x00ffffff;                           /* Use a 24 bit address */
 
-	LOG_TRACE(TRACE_IOMEM_WR, "IO write.b $%06x = $%02x pc=%x\n", addr, val&0x0ff, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_WR, TRACE_RECORD_IO_WRITE, 1, addr, val&0x0ff,
+	                 "IO write.b $%06x = $%02x pc=%x\n", addr, val&0x0ff, M68000_GetPC());
 
 	if (addr < 0xff8000 || !regs.s)
 	{
@@ -418,6 +537,8 @@ void IoMem_bput(uaecptr addr, uae_u32 val)
 		return;
 	}
 
+	IoMem_SyncVideo(addr);
+
 	IoAccessBaseAddress = addr;                   /* Store for exception frame, just in case */
 	nIoMemAccessSize = SIZE_BYTE;
 	nBusErrorAccesses = 0;
@@ -425,7 +546,7 @@ void IoMem_bput(uaecptr addr, uae_u32 val)
 	IoMem[addr] = val;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[addr-0xff8000]();        /* Call handler */
+	pIoMemHandlers[IOMEM_WRITE_INDEX(addr-0xff8000)](); /* Call handler */
 
 	/* Check if we wrote to a bus-error region */
 	if (nBusErrorAccesses == 1)
@@ -445,7 +566,8 @@ void IoMem_wput(uaecptr addr, uae_u32 val)
 
 	addr &= 0x00ffffff;                           /* Use a 24 bit address */
 
-	LOG_TRACE(TRACE_IOMEM_WR, "IO write.w $%06x = $%04x pc=%x\n", addr, val&0x0ffff, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_WR, TRACE_RECORD_IO_WRITE, 2, addr, val&0x0ffff,
+	                 "IO write.w $%06x = $%04x pc=%x\n", addr, val&0x0ffff, M68000_GetPC());
 
 	if (addr < 0x00ff8000 || !regs.s)
 	{
@@ -453,6 +575,9 @@ void IoMem_wput(uaecptr addr, uae_u32 val)
 		M68000_BusError(addr, BUS_ERROR_WRITE);
 		return;
 	}
+
+	IoMem_SyncVideo(addr);
+
 	if (addr > 0xfffffe)
 	{
 		fprintf(stderr, "Illegal IO memory access: IoMem_wput($%x)\n", addr);
@@ -467,12 +592,12 @@ void IoMem_wput(uaecptr addr, uae_u32 val)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[idx]();                  /* Call 1st handler */
+	pIoMemHandlers[IOMEM_WRITE_INDEX(idx)]();       /* Call 1st handler */
 
-	if (pInterceptWriteTable[idx+1] != pInterceptWriteTable[idx])
+	if (IOMEM_WRITE_INDEX(idx+1) != IOMEM_WRITE_INDEX(idx))
 	{
 		IoAccessCurrentAddress = addr + 1;
-		pInterceptWriteTable[idx+1]();            /* Call 2nd handler */
+		pIoMemHandlers[IOMEM_WRITE_INDEX(idx+1)](); /* Call 2nd handler */
 	}
 
 	/* Check if we wrote to a bus-error region */
@@ -494,7 +619,8 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 
 	addr &= 0x00ffffff;                           /* Use a 24 bit address */
 
-	LOG_TRACE(TRACE_IOMEM_WR, "IO write.l $%06x = $%08x pc=%x\n", addr, val, M68000_GetPC());
+	LOG_TRACE_RECORD(TRACE_IOMEM_WR, TRACE_RECORD_IO_WRITE, 4, addr, val,
+	                 "IO write.l $%06x = $%08x pc=%x\n", addr, val, M68000_GetPC());
 
 	if (addr < 0xff8000 || !regs.s)
 	{
@@ -502,6 +628,9 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 		M68000_BusError(addr, BUS_ERROR_WRITE);
 		return;
 	}
+
+	IoMem_SyncVideo(addr);
+
 	if (addr > 0xfffffc)
 	{
 		fprintf(stderr, "Illegal IO memory access: IoMem_lput($%x)\n", addr);
@@ -516,14 +645,14 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[idx]();                  /* Call first handler */
+	pIoMemHandlers[IOMEM_WRITE_INDEX(idx)]();       /* Call first handler */
 
 	for (n = 1; n < nIoMemAccessSize; n++)
 	{
-		if (pInterceptWriteTable[idx+n] != pInterceptWriteTable[idx+n-1])
+		if (IOMEM_WRITE_INDEX(idx+n) != IOMEM_WRITE_INDEX(idx+n-1))
 		{
 			IoAccessCurrentAddress = addr + n;
-			pInterceptWriteTable[idx+n]();   /* Call n-th handler */
+			pIoMemHandlers[IOMEM_WRITE_INDEX(idx+n)](); /* Call n-th handler */
 		}
 	}
 
@@ -592,7 +721,7 @@ void IoMem_VoidRead(void)
 	/* handler is probably called only once, so we have to take care of the neighbour "void IO registers" */
 	for (a = IoAccessBaseAddress; a < IoAccessBaseAddress + nIoMemAccessSize; a++)
 	{
-		if (pInterceptReadTable[a - 0xff8000] == IoMem_VoidRead)
+		if (pIoMemHandlers[IOMEM_READ_INDEX(a - 0xff8000)] == IoMem_VoidRead)
 		{
 			IoMem[a] = 0xff;
 		}
@@ -612,7 +741,7 @@ void IoMem_VoidRead_00(void)
 	/* handler is probably called only once, so we have to take care of the neighbour "void IO registers" */
 	for (a = IoAccessBaseAddress; a < IoAccessBaseAddress + nIoMemAccessSize; a++)
 	{
-		if (pInterceptReadTable[a - 0xff8000] == IoMem_VoidRead_00)
+		if (pIoMemHandlers[IOMEM_READ_INDEX(a - 0xff8000)] == IoMem_VoidRead_00)
 		{
 			IoMem[a] = 0x00;
 		}
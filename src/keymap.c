@@ -809,6 +809,57 @@ void Keymap_KeyUp(SDL_keysym *sdlkey)
 	}
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue press and release of the keys for given text. Keys are sent to the
+ * emulated machine as fast as it reads them, see IKBD_QueueSTKey.
+ * Upper case letters are typed with left shift, '\n' with return and
+ * '\t' with tab, other characters use the symbolic mapping, as the text
+ * doesn't come from host key presses.
+ * Return the number of characters queued, which is less than the text
+ * length if the queue got full.  Characters without an ST key are skipped.
+ */
+int Keymap_QueueString(const char *text)
+{
+	SDL_keysym sdlkey;
+	char STScanCode, ShiftScanCode;
+	bool shift;
+	int count;
+
+	sdlkey.scancode = 0;
+	sdlkey.mod = KMOD_NONE;
+	sdlkey.sym = SDLK_LSHIFT;
+	ShiftScanCode = Keymap_SymbolicToStScanCode(&sdlkey);
+
+	for (count = 0; text[count]; count++)
+	{
+		/* shift press + key press/release + shift release */
+		if (IKBD_QueueFreeCount() < 4)
+			break;
+
+		shift = isupper((unsigned char)text[count]);
+		sdlkey.mod = shift ? KMOD_LSHIFT : KMOD_NONE;
+		if (text[count] == '\n')
+			sdlkey.sym = SDLK_RETURN;
+		else if (text[count] == '\t')
+			sdlkey.sym = SDLK_TAB;
+		else
+			sdlkey.sym = tolower((unsigned char)text[count]);
+
+		STScanCode = Keymap_SymbolicToStScanCode(&sdlkey);
+		if (STScanCode == -1)
+			continue;
+
+		if (shift)
+			IKBD_QueueSTKey(ShiftScanCode, true);
+		IKBD_QueueSTKey(STScanCode, true);
+		IKBD_QueueSTKey(STScanCode, false);
+		if (shift)
+			IKBD_QueueSTKey(ShiftScanCode, false);
+	}
+	return count;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Simulate press or release of a key corresponding to given character
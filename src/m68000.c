@@ -89,13 +89,61 @@ Uint32 BusErrorPC;              /* Value of the PC when bus error occurs */
 bool bBusErrorReadWrite;        /* 0 for write error, 1 for read error */
 int nCpuFreqShift;              /* Used to emulate higher CPU frequencies: 0=8MHz, 1=16MHz, 2=32Mhz */
 int nWaitStateCycles;           /* Used to emulate the wait state cycles of certain IO registers */
+bool bFastTiming;               /* No prefetch, pairing, wait states or E Clock sync */
+bool bPrefetchAuto;             /* No prefetch until self-modifying code is seen */
+static bool bPrefetchNeeded;    /* Self-modifying code seen since last reset */
+static bool bCpuTurboOn;        /* CPU clock currently raised by the CPU turbo mode */
+static int nCpuTurboBaseShift;  /* nCpuFreqShift to restore when leaving turbo */
+static int nCpuTurboIoVbls;     /* VBLs left to keep the turbo after a disk access */
+static int nCpuTurboBlockVbls;  /* VBLs left without turbo after raster tricks */
 int BusMode = BUS_MODE_CPU;	/* Used to tell which part is owning the bus (cpu, blitter, ...) */
 bool CPU_IACK = false;		/* Set to true during an exception when getting the interrupt's vector number */
+#ifdef __LIBRETRO__
+bool bCpuEndFrame;		/* Set at the end of a frame to leave m68k_go() */
+#endif
 
 int LastOpcodeFamily = i_NOP;	/* see the enum in readcpu.h i_XXX */
 int LastInstrCycles = 0;	/* number of cycles for previous instr. (not rounded to 4) */
 int Pairing = 0;		/* set to 1 if the latest 2 intr paired */
-char PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
+
+/* Pairing between all the bit shifting instructions and a given Opcode */
+#define PAIRING_BITSHIFT \
+	[ i_DBcc ] = 1, [ i_MOVE ] = 1, [ i_MOVEA ] = 1, [ i_LEA ] = 1, [ i_JMP ] = 1, \
+	[ i_ADD ] = 1, [ i_SUB ] = 1, [ i_OR ] = 1, [ i_AND ] = 1, [ i_EOR ] = 1, \
+	[ i_NOT ] = 1, [ i_CLR ] = 1, [ i_NEG ] = 1, \
+	[ i_ADDX ] = 1, [ i_SUBX ] = 1, [ i_ABCD ] = 1, [ i_SBCD ] = 1
+
+/* Pairing after MULU/MULS */
+#define PAIRING_MUL \
+	[ i_MOVEA ] = 1, [ i_MOVE ] = 1, [ i_DIVU ] = 1, [ i_DIVS ] = 1, [ i_JSR ] = 1
+
+/**
+ * The pairing matrix, built at compile time so that it's shared read-only
+ * data. Two instructions can pair if PairingArray[ LastOpcodeFamily ][ OpcodeFamily ] == 1
+ */
+const char PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ] =
+{
+	[  i_EXG ] = { [ i_DBcc ] = 1, [ i_MOVE ] = 1, [ i_MOVEA ] = 1 },
+
+	[ i_CMPA ] = { [ i_Bcc ] = 1 },
+	[  i_CMP ] = { [ i_Bcc ] = 1 },
+	[ i_BTST ] = { [ i_Bcc ] = 1 },
+
+	[ i_MULU ] = { PAIRING_MUL },
+	[ i_MULS ] = { PAIRING_MUL },
+
+	[  i_ADD ] = { [ i_MOVE ] = 1 },		/* when using xx(an,dn) addr mode */
+	[  i_SUB ] = { [ i_MOVE ] = 1 },
+
+	[  i_ASR ] = { PAIRING_BITSHIFT },
+	[  i_ASL ] = { PAIRING_BITSHIFT },
+	[  i_LSR ] = { PAIRING_BITSHIFT },
+	[  i_LSL ] = { PAIRING_BITSHIFT },
+	[  i_ROL ] = { PAIRING_BITSHIFT },
+	[  i_ROR ] = { PAIRING_BITSHIFT },
+	[ i_ROXR ] = { PAIRING_BITSHIFT },
+	[ i_ROXL ] = { PAIRING_BITSHIFT },
+};
 
 
 /* to convert the enum from OpcodeFamily to a readable value for pairing's debug */
@@ -126,80 +174,6 @@ const char *OpcodeName[] = { "ILLG",
 };
 
 
-/*-----------------------------------------------------------------------*/
-/**
- * Add pairing between all the bit shifting instructions and a given Opcode
- */
-
-static void M68000_InitPairing_BitShift ( int OpCode )
-{
-	PairingArray[  i_ASR ][ OpCode ] = 1; 
-	PairingArray[  i_ASL ][ OpCode ] = 1; 
-	PairingArray[  i_LSR ][ OpCode ] = 1; 
-	PairingArray[  i_LSL ][ OpCode ] = 1; 
-	PairingArray[  i_ROL ][ OpCode ] = 1; 
-	PairingArray[  i_ROR ][ OpCode ] = 1; 
-	PairingArray[ i_ROXR ][ OpCode ] = 1; 
-	PairingArray[ i_ROXL ][ OpCode ] = 1; 
-}
-
-
-/**
- * Init the pairing matrix
- * Two instructions can pair if PairingArray[ LastOpcodeFamily ][ OpcodeFamily ] == 1
- */
-static void M68000_InitPairing(void)
-{
-	/* First, clear the matrix (pairing is false) */
-	memset(PairingArray , 0 , MAX_OPCODE_FAMILY * MAX_OPCODE_FAMILY);
-
-	/* Set all valid pairing combinations to 1 */
-	PairingArray[  i_EXG ][ i_DBcc ] = 1;
-	PairingArray[  i_EXG ][ i_MOVE ] = 1;
-	PairingArray[  i_EXG ][ i_MOVEA] = 1;
-
-	PairingArray[ i_CMPA ][  i_Bcc ] = 1;
-	PairingArray[  i_CMP ][  i_Bcc ] = 1;
-
-	M68000_InitPairing_BitShift ( i_DBcc );
-	M68000_InitPairing_BitShift ( i_MOVE );
-	M68000_InitPairing_BitShift ( i_MOVEA );
-	M68000_InitPairing_BitShift ( i_LEA );
-	M68000_InitPairing_BitShift ( i_JMP );
-
-	PairingArray[ i_MULU ][ i_MOVEA] = 1; 
-	PairingArray[ i_MULS ][ i_MOVEA] = 1; 
-	PairingArray[ i_MULU ][ i_MOVE ] = 1; 
-	PairingArray[ i_MULS ][ i_MOVE ] = 1; 
-
-	PairingArray[ i_MULU ][ i_DIVU ] = 1;
-	PairingArray[ i_MULU ][ i_DIVS ] = 1;
-	PairingArray[ i_MULS ][ i_DIVU ] = 1;
-	PairingArray[ i_MULS ][ i_DIVS ] = 1;
-
-	PairingArray[ i_MULU ][ i_JSR ] = 1;
-	PairingArray[ i_MULS ][ i_JSR ] = 1;
-
-	PairingArray[ i_BTST ][  i_Bcc ] = 1;
-
-	M68000_InitPairing_BitShift ( i_ADD );
-	M68000_InitPairing_BitShift ( i_SUB );
-	M68000_InitPairing_BitShift ( i_OR );
-	M68000_InitPairing_BitShift ( i_AND );
-	M68000_InitPairing_BitShift ( i_EOR );
-	M68000_InitPairing_BitShift ( i_NOT );
-	M68000_InitPairing_BitShift ( i_CLR );
-	M68000_InitPairing_BitShift ( i_NEG );
-	M68000_InitPairing_BitShift ( i_ADDX );
-	M68000_InitPairing_BitShift ( i_SUBX );
-	M68000_InitPairing_BitShift ( i_ABCD );
-	M68000_InitPairing_BitShift ( i_SBCD );
-
-	PairingArray[ i_ADD ][ i_MOVE ] = 1;		/* when using xx(an,dn) addr mode */
-	PairingArray[ i_SUB ][ i_MOVE ] = 1;
-}
-
-
 /**
  * One-time CPU initialization.
  */
@@ -207,9 +181,6 @@ void M68000_Init(void)
 {
 	/* Init UAE CPU core */
 	Init680x0();
-
-	/* Init the pairing matrix */
-	M68000_InitPairing();
 }
 
 
@@ -237,6 +208,13 @@ void M68000_Reset(bool bCold)
 	}
 	/* Now reset the UAE CPU core */
 	m68k_reset();
+
+	/* Give the auto prefetch mode a new chance with the next program */
+	if (bPrefetchNeeded)
+	{
+		bPrefetchNeeded = false;
+		M68000_CheckCpuSettings();
+	}
 #endif
 	BusMode = BUS_MODE_CPU;
 	CPU_IACK = false;
@@ -263,6 +241,33 @@ void M68000_Start(void)
 }
 
 
+#ifdef __LIBRETRO__
+/*-----------------------------------------------------------------------*/
+/**
+ * Continue 680x0 emulation until the end of the current frame. The
+ * libretro core emulates one frame at a time, returning to the frontend
+ * in between.
+ */
+void M68000_RunFrame(void)
+{
+	bCpuEndFrame = false;
+	m68k_go(true);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * End the frame : M68000_Start() / M68000_RunFrame() return after the
+ * current instruction.
+ */
+void M68000_EndFrame(void)
+{
+	bCpuEndFrame = true;
+	M68000_SetSpecial(SPCFLAG_BRK);
+}
+#endif
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Check whether CPU settings have been changed.
@@ -284,8 +289,25 @@ void M68000_CheckCpuSettings(void)
 		ConfigureParams.System.nCpuFreq = 16;
 		nCpuFreqShift = 1;
 	}
+	bCpuTurboOn = false;
 	changed_prefs.cpu_level = ConfigureParams.System.nCpuLevel;
-	changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu;
+#if !ENABLE_WINUAE_CPU
+	/* The auto prefetch CPU loop is for the 68000 and doesn't run the DSP */
+	bPrefetchAuto = ConfigureParams.System.bAutoPrefetch && !bPrefetchNeeded
+	                && ConfigureParams.System.bCompatibleCpu
+	                && !ConfigureParams.System.bFastTiming
+	                && ConfigureParams.System.nCpuLevel == 0
+	                && ConfigureParams.System.nMachineType != MACHINE_FALCON;
+#endif
+	changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu
+	                               && !ConfigureParams.System.bFastTiming
+	                               && !bPrefetchAuto;
+	if (bFastTiming != ConfigureParams.System.bFastTiming)
+	{
+		bFastTiming = ConfigureParams.System.bFastTiming;
+		if (table68k)
+			M68000_SetSpecial(SPCFLAG_MODE_CHANGE);	/* pick the CPU loop again */
+	}
 
 #if ENABLE_WINUAE_CPU
 	/* WinUAE core uses cpu_model instead of cpu_level, so we've got to
@@ -312,6 +334,96 @@ void M68000_CheckCpuSettings(void)
 }
 
 
+#if !ENABLE_WINUAE_CPU
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the CPU core when the program wrote into the prefetch window
+ * of the executing code in auto prefetch mode: use the prefetch CPU mode
+ * until the next reset.
+ */
+void M68000_PrefetchNeeded(void)
+{
+	Log_Printf(LOG_DEBUG, "Self-modifying code at $%x, enabling CPU prefetch\n",
+	           BusErrorPC);
+	bPrefetchNeeded = true;
+	M68000_CheckCpuSettings();
+}
+#endif
+
+
+/* Keep the turbo for 1/2 sec after the last disk access, so that a loader
+ * unpacking data between two reads doesn't drop back to 8 MHz every time */
+#define CPU_TURBO_IO_VBLS	25
+/* Don't use the turbo for 5 sec after the program touched the sync/shifter
+ * registers while the screen is displayed (borders, sync scrolling...) */
+#define CPU_TURBO_BLOCK_VBLS	250
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when the FDC or the ACSI bus are busy : allow the CPU turbo
+ * during the next VBLs.
+ */
+void M68000_TurboDiskAccess(void)
+{
+	nCpuTurboIoVbls = CPU_TURBO_IO_VBLS;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when the program changes the video timings in the middle of the
+ * screen : such code is cycle exact, so go back to the normal CPU clock
+ * immediately and stay there for a while.
+ */
+void M68000_TurboTimingAccess(void)
+{
+	nCpuTurboBlockVbls = CPU_TURBO_BLOCK_VBLS;
+	if (bCpuTurboOn)
+	{
+		bCpuTurboOn = false;
+		nCpuFreqShift = nCpuTurboBaseShift;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on each VBL : raise the CPU clock to 32 MHz while a disk is busy
+ * (loaders and depackers then run faster), restore it otherwise.
+ * Falcon is left alone, its bus control register sets the CPU clock.
+ */
+void M68000_TurboUpdate(void)
+{
+	bool bTurbo;
+
+	if (nCpuTurboIoVbls > 0)
+		nCpuTurboIoVbls--;
+	if (nCpuTurboBlockVbls > 0)
+		nCpuTurboBlockVbls--;
+
+	bTurbo = ConfigureParams.System.bCpuTurbo
+	         && ConfigureParams.System.nMachineType != MACHINE_FALCON
+	         && nCpuTurboIoVbls > 0 && nCpuTurboBlockVbls == 0;
+
+	if (bTurbo == bCpuTurboOn)
+		return;
+
+	if (bTurbo)
+	{
+		if (nCpuFreqShift >= 2)
+			return;				/* already at 32 MHz */
+		nCpuTurboBaseShift = nCpuFreqShift;
+		nCpuFreqShift = 2;
+	}
+	else
+	{
+		nCpuFreqShift = nCpuTurboBaseShift;
+	}
+	bCpuTurboOn = bTurbo;
+	Log_Printf(LOG_DEBUG, "CPU turbo %s\n", bTurbo ? "on" : "off");
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save/Restore snapshot of CPU variables ('MemorySnapShot_Store' handles type)
@@ -512,6 +624,9 @@ void M68000_Exception(Uint32 ExceptionVector , int ExceptionSource)
  */
 void M68000_WaitState(int nCycles)
 {
+	if (bFastTiming)
+		return;
+
 	M68000_SetSpecial(SPCFLAG_EXTRA_CYCLES);
 
 	nWaitStateCycles += nCycles;	/* add all the wait states for this instruction */
@@ -531,6 +646,9 @@ int	M68000_WaitEClock ( void )
 {
 	int	CyclesToNextE;
 
+	if ( bFastTiming )
+		return 0;
+
 	/* We must wait for the next multiple of 10 cycles to be synchronised with E Clock */
 	CyclesToNextE = 10 - CyclesGlobalClockCounter % 10;
 	if ( CyclesToNextE == 10 )		/* we're already synchronised with E Clock */
@@ -19,6 +19,7 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "options.h"
 #include "dialog.h"
 #include "audio.h"
+#include "bootSnapshot.h"
 #include "joy.h"
 #include "floppy.h"
 #include "floppy_ipf.h"
@@ -28,6 +29,7 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "ide.h"
 #include "acia.h"
 #include "ikbd.h"
+#include "inputMovie.h"
 #include "ioMem.h"
 #include "keymap.h"
 #include "log.h"
@@ -37,10 +39,13 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "nvram.h"
 #include "paths.h"
 #include "printer.h"
+#include "recWriter.h"
 #include "reset.h"
 #include "resolution.h"
 #include "rs232.h"
+#include "serialIO.h"
 #include "screen.h"
+#include "screenSnapShot.h"
 #include "sdlgui.h"
 #include "shortcut.h"
 #include "sound.h"
@@ -52,11 +57,17 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "video.h"
 #include "avi_record.h"
 #include "debugui.h"
+#include "debugInfo.h"
+#include "controlBin.h"
+#include "gdbstub.h"
 #include "clocks_timings.h"
+#include "perfcount.h"
+#include "metrics.h"
 
 #include "hatari-glue.h"
 
 #include "falcon/hostscreen.h"
+#include "falcon/videl.h"
 #include "falcon/dsp.h"
 
 #ifdef __LIBRETRO__
@@ -72,11 +83,15 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #endif
 
 bool bQuitProgram = false;                /* Flag to quit program cleanly */
+bool bBenchmarkMode = false;              /* Run unthrottled without host output */
+Uint32 nTurboBootVBLs;                    /* VBLs left to run the boot at full speed */
 static int nQuitValue;                    /* exit value */
 
 static Uint32 nRunVBLs;                   /* Whether and how many VBLS to run before exit */
 static Uint32 nFirstMilliTick;            /* Ticks when VBL counting started */
 static Uint32 nVBLCount;                  /* Frame count */
+static Sint64 nBenchmarkStart;            /* Host time when benchmark started */
+static Uint32 nStateHashVBLs;             /* Show state hash every this many VBLs */
 static int nVBLSlowdown = 1;		  /* host VBL wait multiplier */
 
 static bool bEmulationActive = true;      /* Run emulation when started */
@@ -121,18 +136,32 @@ static Uint32 Main_GetTicks(void)
 //#undef HAVE_GETTIMEOFDAY
 //#undef HAVE_NANOSLEEP
 
+/* Sleeping until an absolute time of the monotonic clock doesn't add
+ * the wake-up latency of each sleep to the next one
+ */
+#if defined(CLOCK_MONOTONIC) && defined(TIMER_ABSTIME) && !defined(__APPLE__)
+# define TIME_ABS_SLEEP	1
+#else
+# define TIME_ABS_SLEEP	0
+#endif
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return a time counter in micro seconds.
- * If gettimeofday is available, we use it directly, else we convert the
- * return of SDL_GetTicks in micro sec.
+ * The monotonic clock is used when it's available (so that system clock
+ * changes don't affect it), else gettimeofday or SDL_GetTicks converted
+ * to micro sec.
  */
 
 static Sint64	Time_GetTicks ( void )
 {
 	Sint64	ticks_micro;
 
-#if HAVE_GETTIMEOFDAY
+#if TIME_ABS_SLEEP
+	struct timespec	now;
+	clock_gettime ( CLOCK_MONOTONIC , &now );
+	ticks_micro = (Sint64)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#elif HAVE_GETTIMEOFDAY
 	struct timeval	now;
 	gettimeofday ( &now , NULL );
 	ticks_micro = (Sint64)now.tv_sec * 1000000 + now.tv_usec;
@@ -144,6 +173,7 @@ static Sint64	Time_GetTicks ( void )
 }
 
 
+#if !TIME_ABS_SLEEP
 /*-----------------------------------------------------------------------*/
 /**
  * Sleep for a given number of micro seconds.
@@ -168,6 +198,29 @@ static void	Time_Delay ( Sint64 ticks_micro )
 	SDL_Delay ( (Uint32)(ticks_micro / 1000) ) ;	/* micro sec -> milli sec */
 #endif
 }
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Sleep until given Time_GetTicks() time.
+ */
+
+static void	Time_SleepUntil ( Sint64 dest_micro )
+{
+#if TIME_ABS_SLEEP
+	struct timespec	ts;
+	ts.tv_sec = dest_micro / 1000000;
+	ts.tv_nsec = (dest_micro % 1000000) * 1000;	/* micro sec -> nano sec */
+	/* returns the error instead of setting errno, EINTR if interrupted by signals */
+	while ( clock_nanosleep ( CLOCK_MONOTONIC , TIMER_ABSTIME , &ts , NULL ) == EINTR )
+		;
+#else
+	Sint64	delay = dest_micro - Time_GetTicks();
+	if ( delay > 0 )
+		Time_Delay ( delay );
+#endif
+}
 
 
 /*-----------------------------------------------------------------------*/
@@ -279,6 +332,79 @@ void Main_SetRunVBLs(Uint32 vbls)
 	nVBLCount = 0;
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the turbo boot after a cold reset, if enabled: the VBLs are then
+ * run without waiting and without showing them, until TOS accesses a
+ * disk to boot from it (Main_TurboBootEnd) or TURBOBOOT_MAX_VBLS passed.
+ * The emulated timings are unchanged.
+ */
+void Main_TurboBootStart(void)
+{
+	if (ConfigureParams.System.bTurboBoot && !bBenchmarkMode)
+		nTurboBootVBLs = TURBOBOOT_MAX_VBLS;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * End the turbo boot, called on the first boot disk access
+ */
+void Main_TurboBootEnd(void)
+{
+	BootSnapshot_DiskAccess();
+	if (nTurboBootVBLs)
+	{
+		Log_Printf(LOG_DEBUG, "Turbo boot done after %d VBLs.\n",
+		           TURBOBOOT_MAX_VBLS - nTurboBootVBLs);
+		nTurboBootVBLs = 0;
+	}
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Run given number of VBLs as fast as possible, without host sound
+ * output or screen updates, then show host timings and exit.
+ */
+void Main_SetBenchmark(Uint32 vbls)
+{
+	bBenchmarkMode = true;
+	ConfigureParams.System.bFastForward = true;
+	ConfigureParams.Sound.bEnableSound = false;
+	ConfigureParams.Screen.nFrameSkips = 0;
+	Main_SetRunVBLs(vbls);
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show emulation state hash every given number of VBLs (0 = never),
+ * for verifying that emulation changes keep results bit-identical.
+ */
+void Main_SetStateHash(Uint32 vbls)
+{
+	nStateHashVBLs = vbls;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show host time used per emulated VBL since benchmark started
+ */
+static void Main_ShowBenchmark(void)
+{
+	Uint32 nFrames = nVBLCount - 1;
+	Sint64 nHostMicro = Time_GetTicks() - nBenchmarkStart;
+	Sint64 nEmuMicro = ClocksTimings_GetVBLDuration_micro(ConfigureParams.System.nMachineType, nScreenRefreshRate);
+	double fHostMicro;
+
+	if (!nFrames || nHostMicro <= 0)
+		return;
+
+	fHostMicro = (double)nHostMicro / nFrames;
+	fprintf(stderr, "BENCHMARK: %u VBLs in %.3fs, %.1f us/VBL host, %.1f us/VBL emulated (%.1f%% speed)\n",
+	        nFrames, nHostMicro / 1000000.0, fHostMicro, (double)nEmuMicro,
+	        100.0 * nEmuMicro / fHostMicro);
+	PerfCount_Show(stderr, nFrames);
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Set VBL wait slowdown factor/multiplayer
@@ -294,39 +420,59 @@ bool Main_SetVBLSlowdown(int factor)
 	return true;
 }
 
+#define SLEEP_MARGIN_MIN	100	/* least VBL wait wake-up margin, micro seconds */
+
 /*-----------------------------------------------------------------------*/
 /**
  * This function waits on each emulated VBL to synchronize the real time
  * with the emulated ST.
  * Unfortunately SDL_Delay and other sleep functions like usleep or nanosleep
  * are very inaccurate on some systems like Linux 2.4 or Mac OS X (they can only
- * wait for a multiple of 10ms due to the scheduler on these systems), so we have
- * to "busy wait" there to get an accurate timing.
+ * wait for a multiple of 10ms due to the scheduler on these systems), so we
+ * sleep until a margin before the right time, calibrated from how late the
+ * sleeps wake up, and "busy wait" only for the rest to get an accurate timing.
  * All times are expressed as micro seconds, to avoid too much rounding error.
  */
-void Main_WaitOnVbl(void)
+static void Main_WaitOnVblDelay(void)
 {
-	Sint64 CurrentTicks;
+	Sint64 CurrentTicks, SpinStart;
 	static Sint64 DestTicks = 0;
+	static Sint64 nSleepMargin;		/* how early to wake up, calibrated */
 	Sint64 FrameDuration_micro;
-	Sint64 nDelay;
+	Sint64 nDelay, nLate;
 
-#ifdef __LIBRETRO__
-if(pauseg==1)pause_select();
-co_switch(mainThread);
-#ifdef WIIU
-return;
-#endif
-#endif
+	if (nTurboBootVBLs)
+		nTurboBootVBLs--;
+	BootSnapshot_Vbl();
+	InputMovie_Vbl();
 
 	nVBLCount++;
+	if (bBenchmarkMode && nVBLCount == 1)
+	{
+		/* measure from first VBL on, boot setup is not included */
+		nBenchmarkStart = Time_GetTicks();
+		PerfCount_Reset();
+	}
+	if (nStateHashVBLs && nVBLCount % nStateHashVBLs == 0)
+	{
+		fprintf(stderr, "STATEHASH: VBL %u $%08x\n", nVBLCount, DebugInfo_StateHash());
+	}
 	if (nRunVBLs &&	nVBLCount >= nRunVBLs)
 	{
+		if (bBenchmarkMode)
+			Main_ShowBenchmark();
 		/* show VBLs/s */
 		Main_PauseEmulation(true);
+		InputMovie_UnInit();
 		exit(0);
 	}
 
+#ifdef __LIBRETRO__
+	/* Return to the frontend, which takes care of the frame timing */
+	M68000_EndFrame();
+	return;
+#endif
+
 //	FrameDuration_micro = (Sint64) ( 1000000.0 / nScreenRefreshRate + 0.5 );	/* round to closest integer */
 	FrameDuration_micro = ClocksTimings_GetVBLDuration_micro ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
 	FrameDuration_micro *= nVBLSlowdown;
@@ -342,7 +488,7 @@ return;
 	nDelay = DestTicks - CurrentTicks;
 
 	/* Do not wait if we are in fast forward mode or if we are totally out of sync */
-	if (ConfigureParams.System.bFastForward == true
+	if (ConfigureParams.System.bFastForward == true || nTurboBootVBLs
 	    || nDelay < -4*FrameDuration_micro || nDelay > 50*FrameDuration_micro)
 	{
 		if (ConfigureParams.System.bFastForward == true)
@@ -370,20 +516,30 @@ return;
 		// Log_Printf(LOG_DEBUG, "Decreased frameskip to %d\n", nFrameSkips);
 	}
 
-	if (bAccurateDelays)
-	{
-		/* Accurate sleeping is possible -> use SDL_Delay to free the CPU */
-		if (nDelay > 1000)
-			Time_Delay(nDelay - 1000);
-	}
-	else
+	/* Sleep until the wake-up margin before the right tick, so that
+	 * the busy-wait below is short. The margin follows how late the
+	 * sleeps wake up: it's raised quickly after late wake-ups, and
+	 * lowered slowly while they're earlier than it.
+	 */
+	if (!nSleepMargin)
+		nSleepMargin = bAccurateDelays ? 1000 : 10000;
+	if (nDelay > nSleepMargin)
 	{
-		/* No accurate SDL_Delay -> only wait if more than 5ms to go... */
-		if (nDelay > 5000)
-			Time_Delay(nDelay<10000 ? nDelay-1000 : 9000);
+		Time_SleepUntil(DestTicks - nSleepMargin);
+		nLate = Time_GetTicks() - (DestTicks - nSleepMargin);
+		if (nLate + SLEEP_MARGIN_MIN > nSleepMargin)
+			nSleepMargin += (nLate + SLEEP_MARGIN_MIN - nSleepMargin + 1) / 2;
+		else
+			nSleepMargin -= nSleepMargin / 64;
+		if (nSleepMargin > FrameDuration_micro / 2)
+			nSleepMargin = FrameDuration_micro / 2;
+		if (nSleepMargin < SLEEP_MARGIN_MIN)
+			nSleepMargin = SLEEP_MARGIN_MIN;
 	}
 
 	/* Now busy-wait for the right tick: */
+	SpinStart = CurrentTicks = Time_GetTicks();
+	nDelay = DestTicks - CurrentTicks;
 	while (nDelay > 0)
 	{
 		CurrentTicks = Time_GetTicks();
@@ -393,6 +549,7 @@ return;
 		if (nDelay > FrameDuration_micro)
 			break;
 	}
+	Metrics_FramePaced(CurrentTicks - DestTicks, CurrentTicks - SpinStart);
 
 //printf ( "tick %lld\n" , CurrentTicks );
 	/* Update DestTicks for next VBL */
@@ -400,6 +557,27 @@ return;
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait on each emulated VBL, host time spent here is accounted separately
+ * from the emulation.
+ */
+void Main_WaitOnVbl(void)
+{
+#ifndef __LIBRETRO__
+	Metrics_FrameDone();
+#endif
+	PERFCOUNT_BEGIN(PERFCOUNT_WAIT, nPerfPrev);
+	Main_WaitOnVblDelay();
+	PERFCOUNT_END(nPerfPrev);
+	PerfCount_Update();
+	Metrics_Update();
+#ifndef __LIBRETRO__
+	Metrics_FrameStart();
+#endif
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Since SDL_Delay and friends are very inaccurate on some systems, we have
@@ -498,6 +676,8 @@ dy = fmousey;
 
 	KeyboardProcessor.Mouse.dx += dx;
 	KeyboardProcessor.Mouse.dy += dy;
+	if (dx || dy)
+		IKBD_InputChanged();
 }
 
 
@@ -509,6 +689,13 @@ dy = fmousey;
  */
 void Main_EventHandler(void)
 {
+	/* check remote debugger connection */
+	GdbStub_Check();
+	/* check binary control protocol requests */
+	ControlBin_Check();
+	/* periodic background memory snapshot */
+	MemorySnapShot_AutoSaveCheck();
+
 #ifdef __LIBRETRO__
 if (ConfigureParams.Sound.bEnableSound)SND=1;
 else SND=-1;
@@ -673,6 +860,7 @@ static void Main_Init(void)
 #endif
 	}
 	Log_Printf(LOG_INFO, PROG_NAME ", compiled on:  " __DATE__ ", " __TIME__ "\n");
+	PerfCount_Reset();
 
 	/* Init SDL's video subsystem. Note: Audio and joystick subsystems
 	   will be initialized later (failures there are not fatal). */
@@ -761,6 +949,7 @@ void Main_UnInit(void)
 #endif
 {
 	Screen_ReturnFromFullScreen();
+	InputMovie_UnInit();
 	Floppy_UnInit();
 	HDC_UnInit();
 	Midi_UnInit();
@@ -773,9 +962,14 @@ void Main_UnInit(void)
 	Joy_UnInit();
 	if (Sound_AreWeRecording())
 		Sound_EndRecording();
+	MemorySnapShot_UnInit();
+	ScreenSnapShot_UnInit();
+	RecWriter_UnInit();
+	SerialIO_UnInit();
 	Audio_UnInit();
 	SDLGui_UnInit();
 	DSP_UnInit();
+	VIDEL_UnInit();
 	HostScreen_UnInit();
 	Screen_UnInit();
 	Exit680x0();
@@ -853,6 +1047,48 @@ static void Main_StatusbarSetup(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Clean up after the emulation has quit
+ */
+static void Main_Finish(void)
+{
+	if (bRecordingAvi)
+	{
+		/* cleanly close the avi file */
+		Statusbar_AddMessage("Finishing AVI file...", 100);
+		Statusbar_Update(sdlscrn, true);
+		Avi_StopRecording();
+	}
+	/* Un-init emulation system */
+	Main_UnInit();
+#ifdef __LIBRETRO__
+pauseg=-1;
+#endif
+}
+
+
+#ifdef __LIBRETRO__
+/*-----------------------------------------------------------------------*/
+/**
+ * Emulate the next frame. The libretro core returns to the frontend
+ * after each frame instead of running the emulation in a loop.
+ * Return false once the emulation has quit.
+ */
+bool Main_RunFrame(void)
+{
+	Metrics_FrameStart();
+	M68000_RunFrame();
+	Metrics_FrameDone();
+	if (!bQuitProgram)
+		return true;
+
+	Main_Finish();
+	return false;
+}
+#endif
+
+
 /**
  * Main
  * 
@@ -935,17 +1171,11 @@ int main(int argc, char *argv[])
 	Main_UnPauseEmulation();
 	M68000_Start();                 /* Start emulation */
 
-	if (bRecordingAvi)
-	{
-		/* cleanly close the avi file */
-		Statusbar_AddMessage("Finishing AVI file...", 100);
-		Statusbar_Update(sdlscrn, true);
-		Avi_StopRecording();
-	}
-	/* Un-init emulation system */
-	Main_UnInit();
 #ifdef __LIBRETRO__
-pauseg=-1;
+	/* First frame is done, the next ones are run by Main_RunFrame() */
+	if (!bQuitProgram)
+		return 0;
 #endif
+	Main_Finish();
 	return nQuitValue;
 }
@@ -23,6 +23,7 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 
 #include "main.h"
 #include "blitter.h"
+#include "bootSnapshot.h"
 #include "configuration.h"
 #include "debugui.h"
 #include "dmaSnd.h"
@@ -47,6 +48,7 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 #include "str.h"
 #include "stMemory.h"
 #include "tos.h"
+#include "utils.h"
 #include "screen.h"
 #include "video.h"
 #include "falcon/dsp.h"
@@ -55,8 +57,18 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 #include "statusbar.h"
 
 
-#define VERSION_STRING      "1.8.1"   /* Version number of compatible memory snapshots - Always 6 bytes (inc' NULL) */
+#define VERSION_STRING      "1.8.2"   /* Version number of compatible memory snapshots - Always 6 bytes (inc' NULL) */
 #define SNAPSHOT_MAGIC      0xDeadBeef
+#define SNAPSHOT_DELTA_MAGIC 0xDe17aBed	/* delta memory snapshot marker */
+
+/* In snapshot files, zeroed pages of big blocks (RAM) are left out */
+#define SNAPSHOT_FLAG_ZERO_PAGES 0x01
+/* File contains an in-memory snapshot, written in the background */
+#define SNAPSHOT_FLAG_IMAGE      0x02
+/* ST RAM is stored in separately compressed chunks */
+#define SNAPSHOT_FLAG_RAM_CHUNKS 0x04
+#define SNAPSHOT_PAGE_SIZE  4096
+#define SNAPSHOT_SPARSE_MIN (16 * SNAPSHOT_PAGE_SIZE)
 
 #if HAVE_LIBZ
 #define COMPRESS_MEMORYSNAPSHOT       /* Compress snapshots to reduce disk space used */
@@ -75,9 +87,109 @@ typedef FILE* MSS_File;
 
 #endif
 
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+# include <rthreads/rthreads.h>
+# define SNAPSHOT_THREAD	1
+#else
+# define SNAPSHOT_THREAD	0
+#endif
+
 
 static MSS_File CaptureFile;
 static bool bCaptureSave, bCaptureError;
+static bool bZeroPages;		/* file uses SNAPSHOT_FLAG_ZERO_PAGES */
+static bool bImageFile;		/* file uses SNAPSHOT_FLAG_IMAGE */
+static bool bRamChunks;		/* file uses SNAPSHOT_FLAG_RAM_CHUNKS */
+
+/* Memory buffer backend, used instead of CaptureFile when bCaptureMemory
+ * is set. With a NULL pBuffer nothing is copied and only the size of the
+ * snapshot is computed.
+ */
+typedef struct
+{
+	Uint8 *pBuffer;
+	size_t nSize;
+	size_t nPos;
+} MSS_Memory;
+
+static MSS_Memory CaptureMemory;
+static bool bCaptureMemory;
+
+/* Lightweight memory snapshots (for run-ahead and netplay) are only
+ * restored within the same session: host side state, like configuration
+ * and inserted floppy image contents, is left out of them.
+ */
+static bool bLightweight;
+
+/* Delta memory snapshots store only the RAM pages changed since their
+ * base snapshot.  Each base gets its own ID, stored in it and in the
+ * deltas taken against it, so that a delta is never restored on top of
+ * some other state.  Only MemorySnapShot_CaptureDeltaBase() and
+ * MemorySnapShot_RestoreDelta() change the base pages are tracked
+ * against, other snapshots don't affect it.
+ */
+static Uint32 nDeltaBase;	/* ID of current base, 0 if there's none */
+static Uint32 nDeltaBases;	/* last ID given to a base */
+
+/* Snapshot sections, in the order they're saved/restored */
+typedef struct
+{
+	void (*Capture)(bool bSave);
+	bool bVariableSize;	/* size can change during emulation */
+	bool bHostOnly;		/* left out of lightweight snapshots */
+} MSS_SECTION;
+
+static const MSS_SECTION MemorySnapShot_Sections[] =
+{
+	{ Configuration_MemorySnapShot_Capture, false, true },
+	{ TOS_MemorySnapShot_Capture, false, false },
+	/* emulator is reset here on restore */
+	{ STMemory_MemorySnapShot_Capture, false, false },
+	{ Cycles_MemorySnapShot_Capture, false, false },	/* Before fdc (for CyclesGlobalClockCounter) */
+	{ FDC_MemorySnapShot_Capture, false, false },
+	{ Floppy_MemorySnapShot_Capture, true, false },
+	{ IPF_MemorySnapShot_Capture, false, false },		/* After fdc/floppy, as IPF depends on them */
+	{ STX_MemorySnapShot_Capture, true, false },		/* After fdc/floppy, as STX depends on them */
+	{ GemDOS_MemorySnapShot_Capture, true, false },
+	{ ACIA_MemorySnapShot_Capture, false, false },
+	{ IKBD_MemorySnapShot_Capture, false, false },		/* After ACIA */
+	{ CycInt_MemorySnapShot_Capture, false, false },
+	{ M68000_MemorySnapShot_Capture, false, false },
+	{ MFP_MemorySnapShot_Capture, false, false },
+	{ PSG_MemorySnapShot_Capture, false, false },
+	{ Sound_MemorySnapShot_Capture, false, false },
+	{ Video_MemorySnapShot_Capture, false, false },
+	{ Blitter_MemorySnapShot_Capture, false, false },
+	{ DmaSnd_MemorySnapShot_Capture, false, false },
+	{ Crossbar_MemorySnapShot_Capture, false, false },
+	{ VIDEL_MemorySnapShot_Capture, false, false },
+	{ DSP_MemorySnapShot_Capture, false, false },
+	{ IoMem_MemorySnapShot_Capture, false, false },
+	{ Utils_MemorySnapShot_Capture, false, false }
+};
+
+#define MSS_SECTIONS		ARRAYSIZE(MemorySnapShot_Sections)
+#define MSS_RESET_SECTION	2	/* first section restored after reset */
+
+/* Memory snapshots use a fixed layout: header, section offset table
+ * and each section in its own slot at a known offset. Slots are sized
+ * so that the total stays the same for a given machine config, for
+ * frontends doing rewind / run-ahead.
+ */
+#define MSS_SLOT_ALIGN		0x1000
+#define MSS_SLOT_ALIGN_LIGHT	0x10	/* lightweight snapshots are packed */
+#define MSS_SLOT_HEADROOM	0x10000	/* extra space for variable size sections */
+
+typedef struct
+{
+	Uint32 nCount;			/* number of sections */
+	Uint32 nLightweight;		/* lightweight snapshot? */
+	Uint32 nDeltaBase;		/* delta base ID, 0 if not a base */
+	Uint32 nOffset[MSS_SECTIONS+1];	/* last one is the snapshot end */
+} MSS_LAYOUT;
+
+/* Full and lightweight layouts, nCount = 0 until computed */
+static MSS_LAYOUT MemoryLayouts[2];
 
 
 /*-----------------------------------------------------------------------*/
@@ -87,7 +199,22 @@ static bool bCaptureSave, bCaptureError;
 static MSS_File MemorySnapShot_fopen(const char *pszFileName, const char *pszMode)
 {
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	return gzopen(pszFileName, pszMode);
+	char szMode[8];
+	gzFile fhndl;
+
+	/* level 1 deflates several times faster than the zlib default,
+	 * while restoring doesn't care about the level
+	 */
+	if (pszMode[0] == 'w')
+	{
+		snprintf(szMode, sizeof(szMode), "%s%d", pszMode,
+		         ConfigureParams.Memory.nSnapshotCompression);
+		pszMode = szMode;
+	}
+	fhndl = gzopen(pszFileName, pszMode);
+	if (fhndl)
+		gzbuffer(fhndl, 256 * 1024);	/* fewer, bigger file accesses */
+	return fhndl;
 #else
 	return fopen(pszFileName, pszMode);
 #endif
@@ -150,6 +277,69 @@ static int MemorySnapShot_fseek(MSS_File fhndl, int pos)
 }
 
 
+#if ENABLE_WINUAE_CPU
+# define CORE_VERSION 1
+#else
+# define CORE_VERSION 0
+#endif
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore and check the snapshot header (version string and
+ * CPU core version). Return false if restored header doesn't match.
+ */
+static bool MemorySnapShot_StoreHeader(bool bSave)
+{
+	char VersionString[] = VERSION_STRING;
+	Uint8 CpuCore = CORE_VERSION;
+	Uint8 Flags = bCaptureMemory ? 0 : SNAPSHOT_FLAG_ZERO_PAGES | SNAPSHOT_FLAG_RAM_CHUNKS;
+
+	bZeroPages = bImageFile = bRamChunks = false;
+	if (bSave)
+	{
+		/* Store version string */
+		MemorySnapShot_Store(VersionString, sizeof(VersionString));
+		/* Store CPU core version */
+		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
+		/* Store how the rest is encoded */
+		MemorySnapShot_Store(&Flags, sizeof(Flags));
+		bZeroPages = Flags & SNAPSHOT_FLAG_ZERO_PAGES;
+		bRamChunks = Flags & SNAPSHOT_FLAG_RAM_CHUNKS;
+		return true;
+	}
+
+	/* Restore version string */
+	MemorySnapShot_Store(VersionString, sizeof(VersionString));
+	/* Does match current version? */
+	if (strcmp(VersionString, VERSION_STRING))
+	{
+		/* No, inform user and error */
+		Log_AlertDlg(LOG_ERROR,
+			     "Unable to restore Hatari memory state.\n"
+			     "Given state file is compatible only with\n"
+			     "Hatari version " VERSION_STRING ".");
+		bCaptureError = true;
+		return false;
+	}
+	/* Check CPU core version */
+	MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
+	if (CpuCore != CORE_VERSION)
+	{
+		Log_AlertDlg(LOG_ERROR,
+			     "Unable to restore Hatari memory state.\n"
+			     "Given state file is for different Hatari\n"
+			     "CPU core version.");
+		bCaptureError = true;
+		return false;
+	}
+	MemorySnapShot_Store(&Flags, sizeof(Flags));
+	bZeroPages = Flags & SNAPSHOT_FLAG_ZERO_PAGES;
+	bImageFile = Flags & SNAPSHOT_FLAG_IMAGE;
+	bRamChunks = Flags & SNAPSHOT_FLAG_RAM_CHUNKS;
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Open/Create snapshot file, and set flag so 'MemorySnapShot_Store' knows
@@ -157,16 +347,9 @@ static int MemorySnapShot_fseek(MSS_File fhndl, int pos)
  */
 static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 {
-	char VersionString[] = VERSION_STRING;
-#if ENABLE_WINUAE_CPU
-# define CORE_VERSION 1
-#else
-# define CORE_VERSION 0
-#endif
-	Uint8 CpuCore;
-
 	/* Set error */
 	bCaptureError = false;
+	bCaptureMemory = false;
 
 	/* after opening file, set bCaptureSave to indicate whether
 	 * 'MemorySnapShot_Store' should load from or save to a file
@@ -186,11 +369,6 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 			return false;
 		}
 		bCaptureSave = true;
-		/* Store version string */
-		MemorySnapShot_Store(VersionString, sizeof(VersionString));
-		/* Store CPU core version */
-		CpuCore = CORE_VERSION;
-		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
 	}
 	else
 	{
@@ -204,34 +382,9 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 			return false;
 		}
 		bCaptureSave = false;
-		/* Restore version string */
-		MemorySnapShot_Store(VersionString, sizeof(VersionString));
-		/* Does match current version? */
-		if (strcmp(VersionString, VERSION_STRING))
-		{
-			/* No, inform user and error */
-			Log_AlertDlg(LOG_ERROR,
-				     "Unable to restore Hatari memory state.\n"
-				     "Given state file is compatible only with\n"
-				     "Hatari version " VERSION_STRING ".");
-			bCaptureError = true;
-			return false;
-		}
-		/* Check CPU core version */
-		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
-		if (CpuCore != CORE_VERSION)
-		{
-			Log_AlertDlg(LOG_ERROR,
-				     "Unable to restore Hatari memory state.\n"
-				     "Given state file is for different Hatari\n"
-				     "CPU core version.");
-			bCaptureError = true;
-			return false;
-		}
 	}
 
-	/* All OK */
-	return true;
+	return MemorySnapShot_StoreHeader(bSave);
 }
 
 
@@ -242,6 +395,36 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 static void MemorySnapShot_CloseFile(void)
 {
 	MemorySnapShot_fclose(CaptureFile);
+	CaptureFile = NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set up memory buffer as snapshot target/source, instead of a file.
+ * With NULL pBuffer, snapshot data is only counted, not copied.
+ */
+static bool MemorySnapShot_OpenMemory(void *pBuffer, size_t nSize, bool bSave)
+{
+	bCaptureError = false;
+	bCaptureMemory = true;
+	bCaptureSave = bSave;
+	CaptureMemory.pBuffer = pBuffer;
+	CaptureMemory.nSize = nSize;
+	CaptureMemory.nPos = 0;
+
+	return MemorySnapShot_StoreHeader(bSave);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop using memory buffer for snapshots.
+ */
+static void MemorySnapShot_CloseMemory(void)
+{
+	bCaptureMemory = false;
+	CaptureMemory.pBuffer = NULL;
 }
 
 
@@ -253,8 +436,15 @@ void MemorySnapShot_Skip(int Nb)
 {
 	int res;
 
+	if (bCaptureMemory)
+	{
+		if (Nb < 0 || CaptureMemory.nPos + Nb > CaptureMemory.nSize)
+			bCaptureError = true;
+		else
+			CaptureMemory.nPos += Nb;
+	}
 	/* Check no file errors */
-	if (CaptureFile != NULL)
+	else if (CaptureFile != NULL)
 	{
 		res = MemorySnapShot_fseek(CaptureFile, Nb);
 
@@ -265,6 +455,95 @@ void MemorySnapShot_Skip(int Nb)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if ST RAM is stored in separately compressed chunks,
+ * which STMemory_MemorySnapShot_Capture() compresses on several threads.
+ */
+bool MemorySnapShot_RamInChunks(void)
+{
+	return bRamChunks;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Flag snapshot as invalid, for sections detecting bad data on restore.
+ */
+void MemorySnapShot_SetError(void)
+{
+	bCaptureError = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore big data block to/from given file, leaving out its zeroed
+ * pages. A bitmap of the non-zero pages is followed by their contents,
+ * and the consecutive non-zero pages are read/written at once.
+ * Return false on error.
+ */
+static bool MemorySnapShot_StoreSparse(MSS_File fhndl, bool bSave, Uint8 *pData, int Size)
+{
+	static const Uint8 ZeroPage[SNAPSHOT_PAGE_SIZE];
+	int nPages = (Size + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE;
+	int nMapSize = (nPages + 7) / 8;
+	int i, nStart, nLen, nBytes;
+	bool bOk = true;
+	Uint8 *pMap;
+
+	pMap = calloc(nMapSize, 1);
+	if (!pMap)
+		return false;
+
+	if (bSave)
+	{
+		for (i = 0; i < nPages; i++)
+		{
+			nLen = Size - i * SNAPSHOT_PAGE_SIZE;
+			if (nLen > SNAPSHOT_PAGE_SIZE)
+				nLen = SNAPSHOT_PAGE_SIZE;
+			if (memcmp(pData + i * SNAPSHOT_PAGE_SIZE, ZeroPage, nLen))
+				pMap[i / 8] |= 1 << (i & 7);
+		}
+		nBytes = MemorySnapShot_fwrite(fhndl, (char *)pMap, nMapSize);
+	}
+	else
+		nBytes = MemorySnapShot_fread(fhndl, (char *)pMap, nMapSize);
+	if (nBytes != nMapSize)
+		bOk = false;
+
+	for (i = 0; i < nPages && bOk; )
+	{
+		bool bUsed = pMap[i / 8] & (1 << (i & 7));
+
+		/* find the run of pages of the same kind */
+		nStart = i;
+		while (i < nPages && bUsed == !!(pMap[i / 8] & (1 << (i & 7))))
+			i++;
+		nLen = i * SNAPSHOT_PAGE_SIZE;
+		if (nLen > Size)
+			nLen = Size;
+		nLen -= nStart * SNAPSHOT_PAGE_SIZE;
+
+		if (!bUsed)
+		{
+			if (!bSave)
+				memset(pData + nStart * SNAPSHOT_PAGE_SIZE, 0, nLen);
+			continue;
+		}
+		if (bSave)
+			nBytes = MemorySnapShot_fwrite(fhndl, (char *)pData + nStart * SNAPSHOT_PAGE_SIZE, nLen);
+		else
+			nBytes = MemorySnapShot_fread(fhndl, (char *)pData + nStart * SNAPSHOT_PAGE_SIZE, nLen);
+		if (nBytes != nLen)
+			bOk = false;
+	}
+	free(pMap);
+	return bOk;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save/Restore data to/from file.
@@ -273,9 +552,35 @@ void MemorySnapShot_Store(void *pData, int Size)
 {
 	long nBytes;
 
+	if (bCaptureMemory)
+	{
+		if (!CaptureMemory.pBuffer)
+		{
+			/* Only computing the snapshot size */
+			CaptureMemory.nPos += Size;
+		}
+		else if (CaptureMemory.nPos + Size > CaptureMemory.nSize)
+		{
+			bCaptureError = true;
+		}
+		else
+		{
+			if (bCaptureSave)
+				memcpy(CaptureMemory.pBuffer + CaptureMemory.nPos, pData, Size);
+			else
+				memcpy(pData, CaptureMemory.pBuffer + CaptureMemory.nPos, Size);
+			CaptureMemory.nPos += Size;
+		}
+	}
 	/* Check no file errors */
-	if (CaptureFile != NULL)
+	else if (CaptureFile != NULL)
 	{
+		if (bZeroPages && Size >= SNAPSHOT_SPARSE_MIN)
+		{
+			if (!MemorySnapShot_StoreSparse(CaptureFile, bCaptureSave, pData, Size))
+				bCaptureError = true;
+			return;
+		}
 		/* Saving or Restoring? */
 		if (bCaptureSave)
 			nBytes = MemorySnapShot_fwrite(CaptureFile, (char *)pData, Size);
@@ -291,42 +596,363 @@ void MemorySnapShot_Store(void *pData, int Size)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Save 'snapshot' of memory/chips/emulation variables
+ * Save/Restore already compressed data to/from file. It's written
+ * as is, without compressing it again or looking for zeroed pages.
  */
-void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
+void MemorySnapShot_StorePacked(void *pData, int Size)
+{
+	long nBytes;
+
+	if (bCaptureMemory || CaptureFile == NULL)
+	{
+		MemorySnapShot_Store(pData, Size);
+		return;
+	}
+
+	if (bCaptureSave)
+	{
+#ifdef COMPRESS_MEMORYSNAPSHOT
+		gzsetparams(CaptureFile, Z_NO_COMPRESSION, Z_DEFAULT_STRATEGY);
+#endif
+		nBytes = MemorySnapShot_fwrite(CaptureFile, (char *)pData, Size);
+#ifdef COMPRESS_MEMORYSNAPSHOT
+		gzsetparams(CaptureFile, ConfigureParams.Memory.nSnapshotCompression,
+		            Z_DEFAULT_STRATEGY);
+#endif
+	}
+	else
+		nBytes = MemorySnapShot_fread(CaptureFile, (char *)pData, Size);
+
+	if (nBytes != Size)
+		bCaptureError = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore given snapshot section.
+ */
+static void MemorySnapShot_StoreSection(int nSection, bool bSave)
+{
+	if (bLightweight && MemorySnapShot_Sections[nSection].bHostOnly)
+		return;
+	/* Saved state must not depend on batched HBLs */
+	if (bSave && nSection == 0)
+		Video_HBL_Sync();
+	if (!bSave && nSection == MSS_RESET_SECTION)
+	{
+		/* Reset emulator to get things running */
+		IoMem_UnInit();  IoMem_Init();
+		Reset_Cold();
+		/* restored state doesn't continue the boot which reset started */
+		BootSnapshot_Cancel();
+	}
+	MemorySnapShot_Sections[nSection].Capture(bSave);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore end marker. On restore, version string check catches
+ * release-to-release state changes, bCaptureError catches too short
+ * state file, this check a too long state file.
+ */
+static void MemorySnapShot_StoreMagic(bool bSave)
 {
 	Uint32 magic = SNAPSHOT_MAGIC;
 
+	MemorySnapShot_Store(&magic, sizeof(magic));
+	if (!bSave && !bCaptureError && magic != SNAPSHOT_MAGIC)
+		bCaptureError = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore each files details, sequentially. pszFileName is used for
+ * storing debugger state next to the snapshot file.
+ */
+static void MemorySnapShot_StoreSections(const char *pszFileName, bool bSave)
+{
+	unsigned int i;
+
+	for (i = 0; i < MSS_SECTIONS; i++)
+		MemorySnapShot_StoreSection(i, bSave);
+
+	DebugUI_MemorySnapShot_Capture(pszFileName, bSave);
+
+	MemorySnapShot_StoreMagic(bSave);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write given in-memory snapshot to a file, after a header telling that
+ * it's an image. Called from the writer thread, so this uses only the
+ * file functions and the image. Return false on error.
+ */
+#if SNAPSHOT_THREAD
+static bool MemorySnapShot_WriteImage(const char *pszFileName, Uint8 *pImage, Uint32 nSize)
+{
+	char VersionString[] = VERSION_STRING;
+	Uint8 CpuCore = CORE_VERSION;
+	Uint8 Flags = SNAPSHOT_FLAG_ZERO_PAGES | SNAPSHOT_FLAG_IMAGE;
+	MSS_File fhndl;
+	bool bOk;
+
+	fhndl = MemorySnapShot_fopen(pszFileName, "wb");
+	if (!fhndl)
+		return false;
+	bOk = MemorySnapShot_fwrite(fhndl, VersionString, sizeof(VersionString)) == sizeof(VersionString)
+	      && MemorySnapShot_fwrite(fhndl, (char *)&CpuCore, sizeof(CpuCore)) == sizeof(CpuCore)
+	      && MemorySnapShot_fwrite(fhndl, (char *)&Flags, sizeof(Flags)) == sizeof(Flags)
+	      && MemorySnapShot_fwrite(fhndl, (char *)&nSize, sizeof(nSize)) == sizeof(nSize)
+	      && MemorySnapShot_StoreSparse(fhndl, true, pImage, nSize);
+	MemorySnapShot_fclose(fhndl);
+	return bOk;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore the in-memory snapshot stored in the opened file, after its
+ * header, and close the file.
+ */
+static void MemorySnapShot_RestoreImage(const char *pszFileName, bool bConfirm)
+{
+	Uint32 nSize = 0;
+	Uint8 *pImage = NULL;
+	bool bOk;
+
+	MemorySnapShot_Store(&nSize, sizeof(nSize));
+	if (!bCaptureError && nSize > 0)
+		pImage = malloc(nSize);
+	bOk = pImage && MemorySnapShot_StoreSparse(CaptureFile, false, pImage, nSize);
+	MemorySnapShot_CloseFile();
+	if (!bOk)
+	{
+		free(pImage);
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory state from file.");
+		return;
+	}
+
+	bOk = MemorySnapShot_RestoreMemory(pImage, nSize);
+	free(pImage);
+	if (!bOk)
+		return;
+	DebugUI_MemorySnapShot_Capture(pszFileName, false);
+	if (bConfirm)
+		Log_AlertDlg(LOG_INFO, "Memory state file restored.");
+}
+
+
+#if SNAPSHOT_THREAD
+static struct {
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;			/* signaled when an image is queued or written */
+	Uint8 *pImage;			/* preallocated, reused by each save */
+	size_t nImageSize;		/* allocated image size */
+	size_t nSize;			/* size of the queued image */
+	char szFileName[FILENAME_MAX];
+	bool bBusy;			/* image queued or being written */
+	bool bQuit;
+	bool bFailedInit;		/* thread creation failed, don't retry */
+} AsyncSave;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Writer thread: compress and write the queued snapshot image
+ * until MemorySnapShot_UnInit() is called
+ */
+static void MemorySnapShot_ThreadFunc(void *data)
+{
+	slock_lock(AsyncSave.lock);
+	for (;;)
+	{
+		if (!AsyncSave.bBusy)
+		{
+			if (AsyncSave.bQuit)
+				break;
+			scond_wait(AsyncSave.cond, AsyncSave.lock);
+			continue;
+		}
+		slock_unlock(AsyncSave.lock);
+
+		if (MemorySnapShot_WriteImage(AsyncSave.szFileName, AsyncSave.pImage, AsyncSave.nSize))
+			Log_Printf(LOG_DEBUG, "Memory state saved to '%s'.\n", AsyncSave.szFileName);
+		else
+			Log_Printf(LOG_ERROR, "Unable to save memory state to '%s'.\n", AsyncSave.szFileName);
+
+		slock_lock(AsyncSave.lock);
+		AsyncSave.bBusy = false;
+		scond_broadcast(AsyncSave.cond);
+	}
+	slock_unlock(AsyncSave.lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the writer thread if it isn't running yet.
+ * Return false if it can't be started.
+ */
+static bool MemorySnapShot_StartThread(void)
+{
+	if (AsyncSave.thread)
+		return true;
+	if (AsyncSave.bFailedInit)
+		return false;
+	AsyncSave.lock = slock_new();
+	AsyncSave.cond = scond_new();
+	if (AsyncSave.lock && AsyncSave.cond)
+		AsyncSave.thread = sthread_create(MemorySnapShot_ThreadFunc, NULL);
+	if (!AsyncSave.thread)
+	{
+		Log_Printf(LOG_WARN, "Memory snapshot thread creation failed, saving them directly.\n");
+		if (AsyncSave.cond)
+			scond_free(AsyncSave.cond);
+		if (AsyncSave.lock)
+			slock_free(AsyncSave.lock);
+		AsyncSave.cond = NULL;
+		AsyncSave.lock = NULL;
+		AsyncSave.bFailedInit = true;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the previous background save isn't written yet
+ */
+static bool MemorySnapShot_AsyncBusy(void)
+{
+	bool bBusy = false;
+
+	if (AsyncSave.thread)
+	{
+		slock_lock(AsyncSave.lock);
+		bBusy = AsyncSave.bBusy;
+		slock_unlock(AsyncSave.lock);
+	}
+	return bBusy;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save 'snapshot' in the background. The state is copied at once to a
+ * preallocated in-memory snapshot, which a writer thread then compresses
+ * and writes to the file, so the emulation doesn't wait for them.
+ * Without thread support, this saves the snapshot directly.
+ */
+void MemorySnapShot_CaptureAsync(const char *pszFileName)
+{
+#if SNAPSHOT_THREAD
+	size_t nSize;
+
+	if (MemorySnapShot_StartThread())
+	{
+		/* image buffer is reused, wait until the previous one is written */
+		slock_lock(AsyncSave.lock);
+		while (AsyncSave.bBusy)
+			scond_wait(AsyncSave.cond, AsyncSave.lock);
+		slock_unlock(AsyncSave.lock);
+
+		nSize = MemorySnapShot_MemorySize(false);
+		if (nSize > AsyncSave.nImageSize)
+		{
+			free(AsyncSave.pImage);
+			AsyncSave.pImage = malloc(nSize);
+			AsyncSave.nImageSize = AsyncSave.pImage ? nSize : 0;
+		}
+		if (AsyncSave.pImage && MemorySnapShot_CaptureMemory(AsyncSave.pImage, nSize, false))
+		{
+			DebugUI_MemorySnapShot_Capture(pszFileName, true);
+
+			slock_lock(AsyncSave.lock);
+			snprintf(AsyncSave.szFileName, sizeof(AsyncSave.szFileName), "%s", pszFileName);
+			AsyncSave.nSize = nSize;
+			AsyncSave.bBusy = true;
+			scond_broadcast(AsyncSave.cond);
+			slock_unlock(AsyncSave.lock);
+			return;
+		}
+	}
+#endif
+	MemorySnapShot_Capture(pszFileName, false);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save the auto-save snapshot in the background every
+ * Memory.nAutoSaveInterval seconds of emulated time. Called each VBL.
+ * A save is postponed while the previous one is still being written.
+ */
+void MemorySnapShot_AutoSaveCheck(void)
+{
+	static int nVBLCount;
+
+	if (ConfigureParams.Memory.nAutoSaveInterval <= 0)
+	{
+		nVBLCount = 0;
+		return;
+	}
+	if (++nVBLCount < ConfigureParams.Memory.nAutoSaveInterval * nScreenRefreshRate)
+		return;
+#if SNAPSHOT_THREAD
+	if (MemorySnapShot_AsyncBusy())
+		return;
+#endif
+	nVBLCount = 0;
+	MemorySnapShot_CaptureAsync(ConfigureParams.Memory.szAutoSaveFileName);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish the pending background save and free its resources
+ */
+void MemorySnapShot_UnInit(void)
+{
+#if SNAPSHOT_THREAD
+	if (AsyncSave.thread)
+	{
+		slock_lock(AsyncSave.lock);
+		AsyncSave.bQuit = true;
+		scond_broadcast(AsyncSave.cond);
+		slock_unlock(AsyncSave.lock);
+		sthread_join(AsyncSave.thread);
+		scond_free(AsyncSave.cond);
+		slock_free(AsyncSave.lock);
+		AsyncSave.thread = NULL;
+		AsyncSave.cond = NULL;
+		AsyncSave.lock = NULL;
+		AsyncSave.bQuit = false;
+	}
+	free(AsyncSave.pImage);
+	AsyncSave.pImage = NULL;
+	AsyncSave.nImageSize = 0;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save 'snapshot' of memory/chips/emulation variables
+ */
+void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
+{
 	/* Set to 'saving' */
 	if (MemorySnapShot_OpenFile(pszFileName, true))
 	{
-		/* Capture each files details */
-		Configuration_MemorySnapShot_Capture(true);
-		TOS_MemorySnapShot_Capture(true);
-		STMemory_MemorySnapShot_Capture(true);
-		Cycles_MemorySnapShot_Capture(true);			/* Before fdc (for CyclesGlobalClockCounter) */
-		FDC_MemorySnapShot_Capture(true);
-		Floppy_MemorySnapShot_Capture(true);
-		IPF_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
-		STX_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
-		GemDOS_MemorySnapShot_Capture(true);
-		ACIA_MemorySnapShot_Capture(true);
-		IKBD_MemorySnapShot_Capture(true);
-		CycInt_MemorySnapShot_Capture(true);
-		M68000_MemorySnapShot_Capture(true);
-		MFP_MemorySnapShot_Capture(true);
-		PSG_MemorySnapShot_Capture(true);
-		Sound_MemorySnapShot_Capture(true);
-		Video_MemorySnapShot_Capture(true);
-		Blitter_MemorySnapShot_Capture(true);
-		DmaSnd_MemorySnapShot_Capture(true);
-		Crossbar_MemorySnapShot_Capture(true);
-		VIDEL_MemorySnapShot_Capture(true);
-		DSP_MemorySnapShot_Capture(true);
-		DebugUI_MemorySnapShot_Capture(pszFileName, true);
-		IoMem_MemorySnapShot_Capture(true);
-		/* end marker */
-		MemorySnapShot_Store(&magic, sizeof(magic));
+		MemorySnapShot_StoreSections(pszFileName, true);
 		/* And close */
 		MemorySnapShot_CloseFile();
 	} else {
@@ -349,49 +975,15 @@ void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
  */
 void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm)
 {
-	Uint32 magic;
-
 	/* Set to 'restore' */
 	if (MemorySnapShot_OpenFile(pszFileName, false))
 	{
-		Configuration_MemorySnapShot_Capture(false);
-		TOS_MemorySnapShot_Capture(false);
-
-		/* Reset emulator to get things running */
-		IoMem_UnInit();  IoMem_Init();
-		Reset_Cold();
-
-		/* Capture each files details */
-		STMemory_MemorySnapShot_Capture(false);
-		Cycles_MemorySnapShot_Capture(false);			/* Before fdc (for CyclesGlobalClockCounter) */
-		FDC_MemorySnapShot_Capture(false);
-		Floppy_MemorySnapShot_Capture(false);
-		IPF_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as IPF depends on them */
-		STX_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as STX depends on them */
-		GemDOS_MemorySnapShot_Capture(false);
-		ACIA_MemorySnapShot_Capture(false);
-		IKBD_MemorySnapShot_Capture(false);			/* After ACIA */
-		CycInt_MemorySnapShot_Capture(false);
-		M68000_MemorySnapShot_Capture(false);
-		MFP_MemorySnapShot_Capture(false);
-		PSG_MemorySnapShot_Capture(false);
-		Sound_MemorySnapShot_Capture(false);
-		Video_MemorySnapShot_Capture(false);
-		Blitter_MemorySnapShot_Capture(false);
-		DmaSnd_MemorySnapShot_Capture(false);
-		Crossbar_MemorySnapShot_Capture(false);
-		VIDEL_MemorySnapShot_Capture(false);
-		DSP_MemorySnapShot_Capture(false);
-		DebugUI_MemorySnapShot_Capture(pszFileName, false);
-		IoMem_MemorySnapShot_Capture(false);
-
-		/* version string check catches release-to-release
-		 * state changes, bCaptureError catches too short
-		 * state file, this check a too long state file.
-		 */
-		MemorySnapShot_Store(&magic, sizeof(magic));
-		if (!bCaptureError && magic != SNAPSHOT_MAGIC)
-			bCaptureError = true;
+		if (bImageFile)
+		{
+			MemorySnapShot_RestoreImage(pszFileName, bConfirm);
+			return;
+		}
+		MemorySnapShot_StoreSections(pszFileName, false);
 
 		/* And close */
 		MemorySnapShot_CloseFile();
@@ -414,6 +1006,371 @@ void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of bytes given section currently takes in a snapshot.
+ * Nothing is copied, data is only counted.
+ */
+static size_t MemorySnapShot_SectionSize(int nSection)
+{
+	MemorySnapShot_OpenMemory(NULL, 0, true);
+	MemorySnapShot_StoreSection(nSection, true);
+	MemorySnapShot_CloseMemory();
+
+	return CaptureMemory.nPos;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compute memory snapshot layout for current emulation state, unless
+ * all sections still fit into the slots of the previously computed one.
+ * Return total snapshot size.
+ */
+static size_t MemorySnapShot_UpdateLayout(void)
+{
+	MSS_LAYOUT *pLayout = &MemoryLayouts[bLightweight];
+	size_t nHeaderSize, nSize, nSlot, nOffset, nAlign;
+	bool bFits = (pLayout->nCount == MSS_SECTIONS);
+	unsigned int i;
+	size_t nSizes[MSS_SECTIONS];
+
+	for (i = 0; i < MSS_SECTIONS; i++)
+	{
+		nSizes[i] = MemorySnapShot_SectionSize(i);
+		if (bFits && nSizes[i] > pLayout->nOffset[i+1] - pLayout->nOffset[i])
+			bFits = false;
+	}
+	if (bFits)
+		return pLayout->nOffset[MSS_SECTIONS];
+
+	/* header with version strings, then layout table */
+	MemorySnapShot_OpenMemory(NULL, 0, true);
+	MemorySnapShot_CloseMemory();
+	nHeaderSize = CaptureMemory.nPos + sizeof(*pLayout);
+
+	nAlign = bLightweight ? MSS_SLOT_ALIGN_LIGHT : MSS_SLOT_ALIGN;
+	nOffset = (nHeaderSize + nAlign - 1) & ~(nAlign - 1);
+	for (i = 0; i < MSS_SECTIONS; i++)
+	{
+		nSlot = nSizes[i];
+		if (MemorySnapShot_Sections[i].bVariableSize)
+			nSlot += MSS_SLOT_HEADROOM;
+		if (i == MSS_SECTIONS - 1)
+			nSlot += sizeof(Uint32);	/* end marker */
+		nSlot = (nSlot + nAlign - 1) & ~(nAlign - 1);
+
+		pLayout->nOffset[i] = nOffset;
+		nOffset += nSlot;
+	}
+	pLayout->nOffset[MSS_SECTIONS] = nOffset;
+	pLayout->nLightweight = bLightweight;
+	pLayout->nCount = MSS_SECTIONS;
+
+	nSize = nOffset;
+	Log_Printf(LOG_DEBUG, "%s memory snapshot layout: %d bytes.\n",
+		   bLightweight ? "Lightweight" : "Full", (int)nSize);
+	return nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of bytes needed for an in-memory snapshot of the
+ * current emulation state. Nothing is copied, sections are only counted.
+ * Size stays the same while sections fit to their slots, i.e. normally
+ * for the whole session with a given machine config.
+ */
+size_t MemorySnapShot_MemorySize(bool bLight)
+{
+	size_t nSize;
+
+	bLightweight = bLight;
+	nSize = MemorySnapShot_UpdateLayout();
+	bLightweight = false;
+	return nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save memory snapshot with given delta base ID into given buffer.
+ * Return false if buffer was too small.
+ */
+static bool MemorySnapShot_CaptureLayout(void *pBuffer, size_t nSize, bool bLight, Uint32 nBase)
+{
+	MSS_LAYOUT *pLayout = &MemoryLayouts[bLight];
+	Uint8 *pData = pBuffer;
+	size_t nEnd;
+	unsigned int i;
+
+	bLightweight = bLight;
+	if (MemorySnapShot_UpdateLayout() > nSize)
+	{
+		bLightweight = false;
+		Log_Printf(LOG_WARN, "Memory state doesn't fit to %d bytes.\n", (int)nSize);
+		return false;
+	}
+	pLayout->nDeltaBase = nBase;
+
+	MemorySnapShot_OpenMemory(pBuffer, pLayout->nOffset[0], true);
+	MemorySnapShot_Store(pLayout, sizeof(*pLayout));
+	memset(pData + CaptureMemory.nPos, 0, pLayout->nOffset[0] - CaptureMemory.nPos);
+
+	for (i = 0; i < MSS_SECTIONS && !bCaptureError; i++)
+	{
+		/* limit each section to its own slot */
+		nEnd = pLayout->nOffset[i+1];
+		CaptureMemory.nPos = pLayout->nOffset[i];
+		CaptureMemory.nSize = nEnd;
+		MemorySnapShot_StoreSection(i, true);
+		if (i == MSS_SECTIONS - 1)
+			MemorySnapShot_StoreMagic(true);
+		if (!bCaptureError)
+			memset(pData + CaptureMemory.nPos, 0, nEnd - CaptureMemory.nPos);
+	}
+	MemorySnapShot_CloseMemory();
+	bLightweight = false;
+
+	if (bCaptureError)
+	{
+		Log_Printf(LOG_WARN, "Memory state section %d doesn't fit to its slot.\n", i - 1);
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save 'snapshot' of memory/chips/emulation variables into given buffer,
+ * without any file system access or compression. Each section is stored
+ * at the offset given in the layout table following the header, unused
+ * slot space is cleared. Lightweight snapshot leaves out the host side
+ * state, it can be restored only within the same session.
+ * Return false if buffer was too small.
+ */
+bool MemorySnapShot_CaptureMemory(void *pBuffer, size_t nSize, bool bLight)
+{
+	return MemorySnapShot_CaptureLayout(pBuffer, nSize, bLight, 0);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save lightweight memory snapshot into given buffer, as the base for
+ * following delta snapshots.  It can be restored also on its own, with
+ * MemorySnapShot_RestoreMemory().
+ * Return false if buffer was too small.
+ */
+bool MemorySnapShot_CaptureDeltaBase(void *pBuffer, size_t nSize)
+{
+	if (!MemorySnapShot_CaptureLayout(pBuffer, nSize, true, nDeltaBases + 1))
+		return false;
+	nDeltaBase = ++nDeltaBases;
+	STMemory_ClearDirtyDelta();
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore 'snapshot' of memory/chips/emulation variables from given buffer.
+ * Section offsets are taken from the layout table stored in the buffer.
+ */
+bool MemorySnapShot_RestoreMemory(const void *pBuffer, size_t nSize)
+{
+	MSS_LAYOUT Layout;
+	unsigned int i;
+
+	/* Buffer is only read from when restoring */
+	if (!MemorySnapShot_OpenMemory((void *)pBuffer, nSize, false))
+	{
+		MemorySnapShot_CloseMemory();
+		return false;
+	}
+
+	MemorySnapShot_Store(&Layout, sizeof(Layout));
+	if (bCaptureError || Layout.nCount != MSS_SECTIONS
+	    || Layout.nOffset[MSS_SECTIONS] > nSize)
+	{
+		MemorySnapShot_CloseMemory();
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory state, invalid state layout.");
+		return false;
+	}
+	bLightweight = (Layout.nLightweight != 0);
+
+	for (i = 0; i < MSS_SECTIONS && !bCaptureError; i++)
+	{
+		if (Layout.nOffset[i] > Layout.nOffset[i+1])
+		{
+			bCaptureError = true;
+			break;
+		}
+		CaptureMemory.nPos = Layout.nOffset[i];
+		CaptureMemory.nSize = Layout.nOffset[i+1];
+		MemorySnapShot_StoreSection(i, false);
+	}
+	MemorySnapShot_StoreMagic(false);
+	MemorySnapShot_CloseMemory();
+
+	/* changes may affect also info shown in statusbar */
+	if (!bLightweight)
+		Statusbar_UpdateInfo();
+
+	if (bCaptureError)
+	{
+		if (bLightweight)
+			Log_AlertDlg(LOG_ERROR, "Lightweight memory state restore failed!\nPlease reboot emulation.");
+		else
+			Log_AlertDlg(LOG_ERROR, "Full memory state restore failed!\nPlease reboot emulation.");
+		bLightweight = false;
+		return false;
+	}
+	bLightweight = false;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Whether the snapshot being saved/restored is a lightweight one.
+ */
+bool MemorySnapShot_IsLightweight(void)
+{
+	return bLightweight;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save delta snapshot into given buffer. Instead of whole RAM / ROM,
+ * only the memory pages changed since the current delta base was
+ * captured / restored are saved, other sections are saved like in
+ * lightweight snapshots, so deltas are restored only within the same
+ * session.  Return number of bytes used, or zero if buffer was too small
+ * or there's no base.
+ */
+size_t MemorySnapShot_CaptureDelta(void *pBuffer, size_t nSize)
+{
+	Uint32 marker = SNAPSHOT_DELTA_MAGIC;
+	unsigned int i;
+	size_t nUsed;
+
+	if (!nDeltaBase)
+	{
+		Log_Printf(LOG_WARN, "No base for delta memory state.\n");
+		return 0;
+	}
+	bLightweight = true;
+	MemorySnapShot_OpenMemory(pBuffer, nSize, true);
+	MemorySnapShot_Store(&marker, sizeof(marker));
+	MemorySnapShot_Store(&nDeltaBase, sizeof(nDeltaBase));
+	for (i = 0; i < MSS_SECTIONS && !bCaptureError; i++)
+	{
+		if (MemorySnapShot_Sections[i].Capture == STMemory_MemorySnapShot_Capture)
+			STMemory_MemorySnapShot_CaptureDelta(true);
+		else
+			MemorySnapShot_StoreSection(i, true);
+	}
+	MemorySnapShot_StoreMagic(true);
+	nUsed = CaptureMemory.nPos;
+	MemorySnapShot_CloseMemory();
+	bLightweight = false;
+
+	if (bCaptureError)
+	{
+		/* caller can take a new base instead */
+		Log_Printf(LOG_DEBUG, "Delta memory state doesn't fit to %d bytes.\n", (int)nSize);
+		return 0;
+	}
+	return nUsed;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore delta snapshot on top of the base memory snapshot it was
+ * captured against, which then becomes the current delta base.
+ */
+bool MemorySnapShot_RestoreDelta(const void *pBase, size_t nBaseSize,
+                                 const void *pDelta, size_t nDeltaSize)
+{
+	MSS_Memory DeltaMemory;
+	MSS_LAYOUT Layout;
+	Uint32 marker, nBase = 0;
+	unsigned int i;
+
+	/* Buffers are only read from when restoring */
+	if (!MemorySnapShot_OpenMemory((void *)pBase, nBaseSize, false))
+	{
+		MemorySnapShot_CloseMemory();
+		return false;
+	}
+	MemorySnapShot_Store(&Layout, sizeof(Layout));
+	if (bCaptureError || Layout.nCount != MSS_SECTIONS
+	    || Layout.nOffset[MSS_SECTIONS] > nBaseSize)
+	{
+		MemorySnapShot_CloseMemory();
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory state, invalid state layout.");
+		return false;
+	}
+
+	if (!MemorySnapShot_OpenMemory((void *)pDelta, nDeltaSize, false))
+	{
+		MemorySnapShot_CloseMemory();
+		return false;
+	}
+	MemorySnapShot_Store(&marker, sizeof(marker));
+	MemorySnapShot_Store(&nBase, sizeof(nBase));
+	if (bCaptureError || marker != SNAPSHOT_DELTA_MAGIC)
+	{
+		MemorySnapShot_CloseMemory();
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory state, not a delta state.");
+		return false;
+	}
+	if (!nBase || nBase != Layout.nDeltaBase)
+	{
+		MemorySnapShot_CloseMemory();
+		Log_AlertDlg(LOG_ERROR, "Unable to restore memory state, delta state is for another base state.");
+		return false;
+	}
+
+	/* RAM won't match any base if restore fails half way */
+	nDeltaBase = 0;
+	bLightweight = true;
+
+	for (i = 0; i < MSS_SECTIONS && !bCaptureError; i++)
+	{
+		if (MemorySnapShot_Sections[i].Capture != STMemory_MemorySnapShot_Capture)
+		{
+			MemorySnapShot_StoreSection(i, false);
+			continue;
+		}
+		/* whole memory from base, then changed pages from delta */
+		DeltaMemory = CaptureMemory;
+		CaptureMemory.pBuffer = (Uint8 *)pBase;
+		CaptureMemory.nPos = Layout.nOffset[i];
+		CaptureMemory.nSize = Layout.nOffset[i+1];
+		MemorySnapShot_StoreSection(i, false);
+		STMemory_ClearDirtyDelta();
+		CaptureMemory = DeltaMemory;
+		STMemory_MemorySnapShot_CaptureDelta(false);
+	}
+	MemorySnapShot_StoreMagic(false);
+	MemorySnapShot_CloseMemory();
+	bLightweight = false;
+
+	if (bCaptureError)
+	{
+		Log_AlertDlg(LOG_ERROR, "Delta memory state restore failed!\nPlease reboot emulation.");
+		return false;
+	}
+	nDeltaBase = nBase;
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /*
  * Save and restore functions required by the UAE CPU core...
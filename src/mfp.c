@@ -138,6 +138,7 @@ const char MFP_fileid[] = "Hatari mfp.c : " __DATE__ " " __TIME__;
 #include "sound.h"
 #include "stMemory.h"
 #include "tos.h"
+#include "utils.h"
 #include "vdi.h"
 #include "screen.h"
 #include "video.h"
@@ -229,6 +230,13 @@ bool		MFP_UpdateNeeded = false;		/* When set to true, main CPU loop should call
 static Uint64	MFP_Pending_Time_Min;			/* Clock value of the oldest pending int since last MFP_UpdateIRQ() */
 static Uint64	MFP_Pending_Time[ MFP_INT_MAX+1 ];	/* Clock value when pending is set to 1 for each non-masked int */
 
+/* Interrupts checked by MFP_CheckPendingInterrupts() (GPIP6, GPIP2 and the RS232 */
+/* error interrupts are never requested) */
+#define	MFP_CHECKED_INTS	( ( 1 << MFP_INT_GPIP7 ) | ( 1 << MFP_INT_TIMER_A ) | ( 1 << MFP_INT_RCV_BUF_FULL ) \
+				| ( 1 << MFP_INT_TRN_BUF_EMPTY ) | ( 1 << MFP_INT_TIMER_B ) | ( 1 << MFP_INT_GPIP5 ) \
+				| ( 1 << MFP_INT_GPIP4 ) | ( 1 << MFP_INT_TIMER_C ) | ( 1 << MFP_INT_TIMER_D ) \
+				| ( 1 << MFP_INT_GPIP3 ) | ( 1 << MFP_INT_GPIP1 ) | ( 1 << MFP_INT_GPIP0 ) )
+
 static const Uint16 MFPDiv[] =
 {
 	0,
@@ -257,7 +265,6 @@ static const Uint16 MFPDiv[] =
 
 static Uint8	MFP_ConvertIntNumber ( int Interrupt , Uint8 **pMFP_IER , Uint8 **pMFP_IPR , Uint8 **pMFP_ISR , Uint8 **pMFP_IMR );
 static void	MFP_Exception ( int Interrupt );
-static bool	MFP_InterruptRequest ( int Int , Uint8 Bit , Uint8 IPRx , Uint8 IMRx , Uint8 PriorityMaskA , Uint8 PriorityMaskB );
 static int	MFP_CheckPendingInterrupts ( void );
 
 
@@ -562,69 +569,54 @@ void MFP_UpdateIRQ ( Uint64 Event_Time )
 
 /*-----------------------------------------------------------------------*/
 /**
- * Test if interrupt 'Bit' is set in pending and mask register.
- * Also check that no higher priority interrupt is in service.
- * Depending on the interrupt, we check either IPRA/IMRA or IPRB/IMRB
- * @return true if the MFP interrupt request is allowed
+ * Return the number of the highest bit set in a non zero 16 bit value
  */
-static bool MFP_InterruptRequest ( int Int , Uint8 Bit , Uint8 IPRx , Uint8 IMRx , Uint8 PriorityMaskA , Uint8 PriorityMaskB )
+static inline int MFP_HighestBit ( Uint16 Value )
 {
-//fprintf ( stderr , "mfp int req %d %x %x %X %x %x\n" , Int , Bit , IPRx , IMRx , PriorityMaskA , PriorityMaskB );
-
-	if ( ( IPRx & IMRx & Bit ) 					/* Interrupt is pending and not masked */
-	    && ( MFP_Pending_Time[ Int ] <= MFP_Pending_Time_Min ) )	/* Process pending requests in chronological time */
-	{
-		/* Are any higher priority interrupts in service ? */
-		if ( ( ( MFP_ISRA & PriorityMaskA ) == 0 ) && ( ( MFP_ISRB & PriorityMaskB ) == 0 ) )
-			return true;				/* No higher int in service */
-	}
+#if defined(__GNUC__)
+	return 31 - __builtin_clz ( Value );
+#else
+	int	n = 15;
 
-	return false;
+	while ( ( Value & ( 1 << n ) ) == 0 )
+		n--;
+	return n;
+#endif
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
  * Check if any MFP interrupts can be serviced.
+ * Interrupts 0-15 are handled as bits of 16 bit values, with the A registers
+ * in the upper byte, so the highest priority pending interrupt is the highest
+ * bit set in IPR & IMR. An interrupt is allowed if no interrupt with the same
+ * or a higher priority is in service, and pending requests are processed
+ * in chronological time.
  * @return MFP interrupt number for the highest interrupt allowed, else return -1.
  */
 static int MFP_CheckPendingInterrupts ( void )
 {
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP7 , MFP_GPIP7_BIT, MFP_IPRA, MFP_IMRA, 0x80, 0x00 ) )		/* Check MFP GPIP7 interrupt (bit 7) */
-		return MFP_INT_GPIP7;
-	
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_A , MFP_TIMER_A_BIT, MFP_IPRA, MFP_IMRA, 0xe0, 0x00 ) )	/* Check Timer A (bit 5) */
-		return MFP_INT_TIMER_A;
+	Uint16	Pending, InService;
+	int	Int;
 
-	if ( MFP_InterruptRequest ( MFP_INT_RCV_BUF_FULL , MFP_RCV_BUF_FULL_BIT, MFP_IPRA, MFP_IMRA, 0xf0, 0x00 ) )	/* Check Receive buffer full (bit 4) */
-		return MFP_INT_RCV_BUF_FULL;
+	Pending = ( ( MFP_IPRA & MFP_IMRA ) << 8 ) | ( MFP_IPRB & MFP_IMRB );
+	Pending &= MFP_CHECKED_INTS;
+	InService = ( MFP_ISRA << 8 ) | MFP_ISRB;
 
-	if ( MFP_InterruptRequest ( MFP_INT_TRN_BUF_EMPTY , MFP_TRN_BUF_EMPTY_BIT, MFP_IPRA, MFP_IMRA, 0xfc, 0x00 ) )	/* Check transmit buffer empty (bit 2) */
-		return MFP_INT_TRN_BUF_EMPTY;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_B , MFP_TIMER_B_BIT, MFP_IPRA, MFP_IMRA, 0xff, 0x00 ) )	/* Check Timer B (bit 0) */
-		return MFP_INT_TIMER_B;
-
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP5 , MFP_FDCHDC_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0x80 ) )		/* Check FDC (bit 7) */
-		return MFP_INT_GPIP5;
-
-	if ( MFP_InterruptRequest ( MFP_INT_ACIA , MFP_ACIA_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xc0 ) )		/* Check ACIA (Keyboard or MIDI) (bit 6) */
-		return MFP_INT_ACIA;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_C , MFP_TIMER_C_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xe0 ) )	/* Check Timer C (bit 5) */
-		return MFP_INT_TIMER_C;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_D , MFP_TIMER_D_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xf0 ) )	/* Check Timer D (bit 4) */
-		return MFP_INT_TIMER_D;
+	while ( Pending )
+	{
+		Int = MFP_HighestBit ( Pending );
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPU_DONE , MFP_GPU_DONE_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xf8 ) )	/* Check GPU done (bit 3) */
-		return MFP_INT_GPU_DONE;
+		/* Are any higher priority interrupts in service ? Then lower ones are blocked too */
+		if ( InService >> Int )
+			return -1;
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP1 , MFP_GPIP1_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xfe ) )		/* Check (Falcon) Centronics ACK / (ST) RS232 DCD (bit 1) */
-		return MFP_INT_GPIP1;
+		if ( MFP_Pending_Time[ Int ] <= MFP_Pending_Time_Min )	/* Process pending requests in chronological time */
+			return Int;
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP0 , MFP_GPIP0_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xff ) )		/* Check Centronics BUSY (bit 0) */
-		return MFP_INT_GPIP0;
+		Pending &= ~( 1 << Int );
+	}
 
 	return -1;						/* No pending interrupt */
 }
@@ -739,6 +731,17 @@ void MFP_TimerB_EventCount_Interrupt ( int Delayed_Cycles )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the next Timer B event in Event Count mode generates
+ * an interrupt (video only adds an interrupt for the line where it happens)
+ */
+bool MFP_TimerB_EventCount_Expires ( void )
+{
+	return MFP_TB_MAINCOUNTER == 1;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Start Timer A or B - EventCount mode is done in HBL handler to time correctly
@@ -783,7 +786,7 @@ static int MFP_StartTimer_AB(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 		if ( ( M68000_GetPC() == 0x14d78 ) && ( STMemory_ReadLong ( 0x14d6c ) == 0x11faff75 ) )
 		{
 //			fprintf ( stderr , "mfp add jitter %d\n" , TimerClockCycles );
-			TimerClockCycles += rand()%5-2;		/* add jitter for wod2 */
+			TimerClockCycles += Utils_Rand()%5-2;		/* add jitter for wod2 */
 		}
 
 		if (LOG_TRACE_LEVEL(TRACE_MFP_START))
@@ -1473,6 +1476,9 @@ void MFP_TimerBData_ReadByte(void)
 		int FrameCycles, HblCounterVideo;
 		int pos_start , pos_read;
 
+		/* Count the event of the current line if it was already reached */
+		Video_TimerB_Sync();
+
 		/* Cycle position of the start of the current instruction */
 		//pos_start = nFrameCycles % nCyclesPerLine;
 		Video_GetPosition ( &FrameCycles , &HblCounterVideo , &pos_start );
@@ -1578,6 +1584,9 @@ void MFP_ActiveEdge_WriteByte(void)
 
 	M68000_WaitState(4);
 
+	/* Count the event of the current line if it was reached at its old position */
+	Video_TimerB_Sync();
+
 	/* 0 -> 1, timer B is now counting start of line events (cycle 56+28) */
 	if ( ( ( MFP_AER & ( 1 << 3 ) ) == 0 ) && ( ( IoMem[0xfffa03] & ( 1 << 3 ) ) != 1 ) )
 	{
@@ -1604,7 +1613,7 @@ void MFP_ActiveEdge_WriteByte(void)
 
 	/* Timer B position changed, update the next interrupt */
 	if ( LineTimerBCycle_old != LineTimerBCycle )
-		Video_AddInterruptTimerB ( LineTimerBCycle );
+		Video_TimerB_Update ();
 
 	MFP_AER = IoMem[0xfffa03];
 }
@@ -1793,6 +1802,9 @@ void MFP_TimerBCtrl_WriteByte(void)
 
 	if (MFP_TBCR != new_tbcr)           /* Timer control changed */
 	{
+		/* Count a pending event count line with the old mode */
+		Video_TimerB_Sync();
+
 		/* If we stop a timer which was in delay mode, we need to store
 		 * the current value of the counter to be able to read it or to
 		 * continue from where we left if the timer is restarted later
@@ -1802,6 +1814,7 @@ void MFP_TimerBCtrl_WriteByte(void)
 
 		MFP_TBCR = new_tbcr;            /* set to new value before calling MFP_StartTimer */
 		MFP_StartTimerB();              /* start/stop timer depending on control reg */
+		Video_TimerB_Update();
 	}
 }
 
@@ -37,9 +37,24 @@ const char Midi_fileid[] = "Hatari midi.c : " __DATE__ " " __TIME__;
 #define ACIA_SR_RX_FULL            0x01
 
 
+/* Bytes are exchanged with the frontend once per frame. Output bytes are
+ * stamped with the emulated clock to give the correct delta times when they
+ * are sent, input bytes are queued until the ACIA can receive them. */
+#define MIDI_OUT_RING_SIZE         4096
+#define MIDI_IN_FIFO_SIZE          1024
+
 struct retro_midi_interface *MidiRetroInterface;
 static Uint64 MidiWriteClockCounter;
 
+static struct {
+	Uint8 nByte;
+	Uint64 nClock;
+} MidiOutRing[MIDI_OUT_RING_SIZE];
+static int nMidiOutHead, nMidiOutCount;
+
+static Uint8 MidiInFifo[MIDI_IN_FIFO_SIZE];
+static int nMidiInHead, nMidiInCount;
+
 static Uint8 MidiControlRegister;
 static Uint8 MidiStatusRegister;
 static Uint8 nRxDataByte;
@@ -72,6 +87,7 @@ void Midi_Reset(void)
 	MidiStatusRegister = ACIA_SR_TX_EMPTY;
 	nRxDataByte = 1;
 	MidiWriteClockCounter = 0;
+	nMidiInHead = nMidiInCount = 0;
 
 	if (MidiRetroInterface)
 		CycInt_AddRelativeInterrupt(2050, INT_CPU_CYCLE, INTERRUPT_MIDI);
@@ -136,6 +152,43 @@ void Midi_Data_ReadByte(void)
 }
 
 
+/**
+ * Write to MIDI data register ($FFFC06).
+ */
+/**
+ * Send the queued output bytes to the frontend, with the delay in
+ * microseconds since the previous byte.
+ */
+static void Midi_SendOutput(void)
+{
+	Uint64 deltaTime;
+	bool ret;
+
+	while (nMidiOutCount > 0)
+	{
+		Uint8 nByte = MidiOutRing[nMidiOutHead].nByte;
+		Uint64 nClock = MidiOutRing[nMidiOutHead].nClock;
+
+		nMidiOutHead = (nMidiOutHead + 1) % MIDI_OUT_RING_SIZE;
+		nMidiOutCount--;
+
+		if (MidiWriteClockCounter == 0 || nClock < MidiWriteClockCounter)
+			MidiWriteClockCounter = nClock;
+
+		deltaTime = (Uint64)((double)(nClock - MidiWriteClockCounter) /
+                      ((double)MachineClocks.CPU_Freq / 1000000.0) + 0.5);
+		if (deltaTime > 0xFFFFFFFF)
+			deltaTime = 0;
+
+		ret = MidiRetroInterface->write(nByte, (uint32_t)deltaTime);
+		if (!ret)
+			LOG_TRACE(TRACE_MIDI, "MIDI: write error (doesn't stop MIDI)\n");
+
+		MidiWriteClockCounter = nClock;
+	}
+}
+
+
 /**
  * Write to MIDI data register ($FFFC06).
  */
@@ -156,22 +209,16 @@ void Midi_Data_WriteByte(void)
 
 	if (MidiRetroInterface->output_enabled())
 	{
-		Uint64 deltaTime;
-		bool ret;
+		int nTail;
 
-		if (MidiWriteClockCounter == 0)
-			MidiWriteClockCounter = CyclesGlobalClockCounter;
+		/* Ring is full (very dense stream), send it before the end of the frame */
+		if (nMidiOutCount == MIDI_OUT_RING_SIZE)
+			Midi_SendOutput();
 
-		deltaTime = (Uint64)((double)(CyclesGlobalClockCounter - MidiWriteClockCounter) /
-                      ((double)MachineClocks.CPU_Freq / 1000000.0) + 0.5);
-		if (deltaTime > 0xFFFFFFFF)
-			deltaTime = 0;
-
-		ret = MidiRetroInterface->write(nTxDataByte, (uint32_t)deltaTime);
-		if (!ret)
-			LOG_TRACE(TRACE_MIDI, "MIDI: write error (doesn't stop MIDI)\n");
-
-		MidiWriteClockCounter = CyclesGlobalClockCounter;
+		nTail = (nMidiOutHead + nMidiOutCount) % MIDI_OUT_RING_SIZE;
+		MidiOutRing[nTail].nByte = nTxDataByte;
+		MidiOutRing[nTail].nClock = CyclesGlobalClockCounter;
+		nMidiOutCount++;
 	}
 
 	MidiStatusRegister &= ~ACIA_SR_TX_EMPTY;
@@ -206,37 +253,61 @@ void Midi_InterruptHandler_Update(void)
 		MidiStatusRegister |= ACIA_SR_TX_EMPTY;
 	}
 
-	/* Read the bytes in, if we have any */
-	if (MidiRetroInterface && MidiRetroInterface->input_enabled())
+	/* Read the next byte in, if we have any and the previous one was read */
+	if (nMidiInCount > 0 && !(MidiStatusRegister & ACIA_SR_RX_FULL))
 	{
-		bool ret;
-
-		ret = MidiRetroInterface->read(&nInChar);
-		if (ret)
+		nInChar = MidiInFifo[nMidiInHead];
+		nMidiInHead = (nMidiInHead + 1) % MIDI_IN_FIFO_SIZE;
+		nMidiInCount--;
+
+		LOG_TRACE(TRACE_MIDI, "MIDI: Read character -> $%x\n", nInChar);
+		/* Copy into the data register */
+		nRxDataByte = nInChar;
+		/* Do we need to generate a receive interrupt? */
+		if ((MidiControlRegister & 0x80) == 0x80)
 		{
-			LOG_TRACE(TRACE_MIDI, "MIDI: Read character -> $%x\n", nInChar);
-			/* Copy into our internal queue */
-			nRxDataByte = nInChar;
-			/* Do we need to generate a receive interrupt? */
-			if ((MidiControlRegister & 0x80) == 0x80)
-			{
-				LOG_TRACE(TRACE_MIDI, "MIDI: WriteData receive interrupt!\n");
-				/* Acknowledge in MFP circuit */
-				MFP_InputOnChannel ( MFP_INT_ACIA , 0 );
-				MidiStatusRegister |= ACIA_SR_INTERRUPT_REQUEST;
-			}
-			MidiStatusRegister |= ACIA_SR_RX_FULL;
-			/* GPIP I4 - General Purpose Pin Keyboard/MIDI interrupt:
-			 * It will remain low(0) until data is read from $fffc06. */
-			MFP_GPIP &= ~0x10;
+			LOG_TRACE(TRACE_MIDI, "MIDI: WriteData receive interrupt!\n");
+			/* Acknowledge in MFP circuit */
+			MFP_InputOnChannel ( MFP_INT_ACIA , 0 );
+			MidiStatusRegister |= ACIA_SR_INTERRUPT_REQUEST;
 		}
-		else
-			LOG_TRACE(TRACE_MIDI, "MIDI: read error (doesn't stop MIDI)\n");
+		MidiStatusRegister |= ACIA_SR_RX_FULL;
+		/* GPIP I4 - General Purpose Pin Keyboard/MIDI interrupt:
+		 * It will remain low(0) until data is read from $fffc06. */
+		MFP_GPIP &= ~0x10;
 	}
 
 	CycInt_AddRelativeInterrupt(2050, INT_CPU_CYCLE, INTERRUPT_MIDI);
 }
 
+/**
+ * Exchange the data of the last frame with the frontend : send the queued
+ * output bytes and poll all available input bytes.
+ * This is called once per frame.
+ */
+void Midi_UpdateFrame(void)
+{
+	Uint8 nInChar;
+
+	if (!MidiRetroInterface)
+		return;
+
+	if (MidiRetroInterface->output_enabled())
+	{
+		Midi_SendOutput();
+		MidiRetroInterface->flush();
+	}
+
+	if (MidiRetroInterface->input_enabled())
+	{
+		while (nMidiInCount < MIDI_IN_FIFO_SIZE && MidiRetroInterface->read(&nInChar))
+		{
+			MidiInFifo[(nMidiInHead + nMidiInCount) % MIDI_IN_FIFO_SIZE] = nInChar;
+			nMidiInCount++;
+		}
+	}
+}
+
 void Midi_SetRetroInterface(struct retro_midi_interface *interface)
 {
 	MidiRetroInterface = interface;
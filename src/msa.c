@@ -101,6 +101,27 @@ typedef struct
 
 #define MSA_WORKSPACE_SIZE  (1024*1024)  /* Size of workspace to use when saving MSA files */
 
+#define MSA_TRACK_DECODED   0x01         /* Track has been uncompressed into the disk buffer */
+#define MSA_TRACK_CHANGED   0x02         /* Track has been written since insert */
+
+/* Per drive state of MSA images inserted with MSA_Insert(): tracks are only
+ * uncompressed when first accessed, and on write-back only the changed ones
+ * are compressed again, the others are copied from the original file. */
+typedef struct
+{
+	Uint8	*pMsaFile;		/* Original compressed file, NULL if none */
+	long	nMsaFileSize;
+	Uint8	*pBuffer;		/* Disk buffer the tracks are uncompressed to */
+	long	nImageSize;
+	MSAHEADERSTRUCT	Header;		/* Header of the original file, in host order */
+	int	nBytesPerTrack;
+	int	nTracks;		/* Number of track blocks (tracks * sides) */
+	Uint32	*pTrackOffset;		/* Offset of each track block in the file */
+	Uint8	*pTrackState;		/* MSA_TRACK_xxx flags of each track block */
+} MSA_DRIVE_STRUCT;
+
+static MSA_DRIVE_STRUCT MSA_Drives[MAX_FLOPPYDRIVES];
+
 
 /*-----------------------------------------------------------------------*/
 /**
@@ -113,6 +134,53 @@ bool MSA_FileNameIsMSA(const char *pszFileName, bool bAllowGZ)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Uncompress one MSA track block of 'DataLength' bytes into 'pImageBuffer'
+ */
+static void MSA_UnCompressTrack(Uint8 *pImageBuffer, Uint8 *pMSAImageBuffer,
+                                int DataLength, int nBytesPerTrack)
+{
+	Uint8 Byte,Data;
+	int i,NumBytesUnCompressed,RunLength;
+
+	/* First check if is not compressed */
+	if (DataLength == nBytesPerTrack)
+	{
+		/* No compression on track, simply copy */
+		memcpy(pImageBuffer, pMSAImageBuffer, nBytesPerTrack);
+		return;
+	}
+
+	/* Uncompress track */
+	NumBytesUnCompressed = 0;
+	while (NumBytesUnCompressed < nBytesPerTrack)
+	{
+		Byte = *pMSAImageBuffer++;
+		if (Byte != 0xE5)                 /* Compressed header?? */
+		{
+			*pImageBuffer++ = Byte;       /* No, just copy byte */
+			NumBytesUnCompressed++;
+		}
+		else
+		{
+			Data = *pMSAImageBuffer++;    /* Byte to copy */
+			RunLength = do_get_mem_word(pMSAImageBuffer);  /* For length */
+			/* Limit length to size of track, incorrect images may overflow */
+			if (RunLength+NumBytesUnCompressed > nBytesPerTrack)
+			{
+				fprintf(stderr, "MSA_UnCompress: Illegal run length -> corrupted disk image?\n");
+				RunLength = nBytesPerTrack - NumBytesUnCompressed;
+			}
+			pMSAImageBuffer += sizeof(Uint16);
+			for (i = 0; i < RunLength; i++)
+				*pImageBuffer++ = Data;   /* Copy byte */
+			NumBytesUnCompressed += RunLength;
+		}
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Uncompress .MSA data into a new buffer.
@@ -121,8 +189,7 @@ Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize)
 {
 	MSAHEADERSTRUCT *pMSAHeader;
 	Uint8 *pMSAImageBuffer, *pImageBuffer;
-	Uint8 Byte,Data;
-	int i,Track,Side,DataLength,NumBytesUnCompressed,RunLength;
+	int Track,Side,DataLength;
 	Uint8 *pBuffer = NULL;
 
 	*pImageSize = 0;
@@ -159,45 +226,12 @@ Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize)
 			{
 				int nBytesPerTrack = NUMBYTESPERSECTOR*pMSAHeader->SectorsPerTrack;
 
-				/* Uncompress MSA Track, first check if is not compressed */
+				/* Uncompress MSA Track */
 				DataLength = do_get_mem_word(pMSAImageBuffer);
 				pMSAImageBuffer += sizeof(Uint16);
-				if (DataLength == nBytesPerTrack)
-				{
-					/* No compression on track, simply copy and continue */
-					memcpy(pImageBuffer, pMSAImageBuffer, nBytesPerTrack);
-					pImageBuffer += nBytesPerTrack;
-					pMSAImageBuffer += DataLength;
-				}
-				else
-				{
-					/* Uncompress track */
-					NumBytesUnCompressed = 0;
-					while (NumBytesUnCompressed < nBytesPerTrack)
-					{
-						Byte = *pMSAImageBuffer++;
-						if (Byte != 0xE5)                 /* Compressed header?? */
-						{
-							*pImageBuffer++ = Byte;       /* No, just copy byte */
-							NumBytesUnCompressed++;
-						}
-						else
-						{
-							Data = *pMSAImageBuffer++;    /* Byte to copy */
-							RunLength = do_get_mem_word(pMSAImageBuffer);  /* For length */
-							/* Limit length to size of track, incorrect images may overflow */
-							if (RunLength+NumBytesUnCompressed > nBytesPerTrack)
-							{
-								fprintf(stderr, "MSA_UnCompress: Illegal run length -> corrupted disk image?\n");
-								RunLength = nBytesPerTrack - NumBytesUnCompressed;
-							}
-							pMSAImageBuffer += sizeof(Uint16);
-							for (i = 0; i < RunLength; i++)
-								*pImageBuffer++ = Data;   /* Copy byte */
-							NumBytesUnCompressed += RunLength;
-						}
-					}
-				}
+				MSA_UnCompressTrack(pImageBuffer, pMSAImageBuffer, DataLength, nBytesPerTrack);
+				pImageBuffer += nBytesPerTrack;
+				pMSAImageBuffer += DataLength;
 			}
 		}
 
@@ -242,6 +276,154 @@ Uint8 *MSA_ReadDisk(int Drive, const char *pszFileName, long *pImageSize, int *p
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Find the offset of each track block of the .MSA file loaded for 'Drive'.
+ * Return false if the header or the blocks are not valid.
+ */
+static bool MSA_BuildTrackIndex(MSA_DRIVE_STRUCT *pDrv)
+{
+	const MSAHEADERSTRUCT *pMSAHeader = (const MSAHEADERSTRUCT *)pDrv->pMsaFile;
+	long Offset;
+	int i, DataLength;
+
+	if (pDrv->nMsaFileSize < (long)sizeof(MSAHEADERSTRUCT)
+	    || pMSAHeader->ID != SDL_SwapBE16(0x0E0F))
+		return false;
+
+	pDrv->Header.ID = 0x0E0F;
+	pDrv->Header.SectorsPerTrack = SDL_SwapBE16(pMSAHeader->SectorsPerTrack);
+	pDrv->Header.Sides = SDL_SwapBE16(pMSAHeader->Sides);
+	pDrv->Header.StartingTrack = SDL_SwapBE16(pMSAHeader->StartingTrack);
+	pDrv->Header.EndingTrack = SDL_SwapBE16(pMSAHeader->EndingTrack);
+	if (pDrv->Header.SectorsPerTrack == 0
+	    || pDrv->Header.EndingTrack < pDrv->Header.StartingTrack)
+		return false;
+
+	pDrv->nBytesPerTrack = NUMBYTESPERSECTOR * pDrv->Header.SectorsPerTrack;
+	pDrv->nTracks = (pDrv->Header.EndingTrack - pDrv->Header.StartingTrack + 1)
+	                * (pDrv->Header.Sides + 1);
+	pDrv->pTrackOffset = malloc(pDrv->nTracks * sizeof(Uint32));
+	pDrv->pTrackState = calloc(pDrv->nTracks, 1);
+	if (!pDrv->pTrackOffset || !pDrv->pTrackState)
+		return false;
+
+	/* Each block starts with its data length, so no need to uncompress */
+	Offset = sizeof(MSAHEADERSTRUCT);
+	for (i = 0; i < pDrv->nTracks; i++)
+	{
+		if (Offset + (long)sizeof(Uint16) > pDrv->nMsaFileSize)
+			return false;
+		DataLength = do_get_mem_word(pDrv->pMsaFile + Offset);
+		if (DataLength > pDrv->nBytesPerTrack
+		    || Offset + (long)sizeof(Uint16) + DataLength > pDrv->nMsaFileSize)
+			return false;
+		pDrv->pTrackOffset[i] = Offset;
+		Offset += sizeof(Uint16) + DataLength;
+	}
+
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the compressed data of the .MSA image in 'Drive' (the disk buffer
+ * itself belongs to the caller of MSA_Insert()).
+ */
+void MSA_Eject(int Drive)
+{
+	MSA_DRIVE_STRUCT *pDrv = &MSA_Drives[Drive];
+
+	free(pDrv->pMsaFile);
+	free(pDrv->pTrackOffset);
+	free(pDrv->pTrackState);
+	memset(pDrv, 0, sizeof(*pDrv));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Load .MSA file for 'Drive' without uncompressing it: only an index of
+ * the track blocks is built, and MSA_AccessTracks() must be called before
+ * accessing any part of the returned disk buffer. Images with invalid
+ * track blocks are uncompressed at once as with MSA_ReadDisk().
+ */
+Uint8 *MSA_Insert(int Drive, const char *pszFileName, long *pImageSize, int *pImageType)
+{
+	MSA_DRIVE_STRUCT *pDrv = &MSA_Drives[Drive];
+	Uint8 *pDiskBuffer;
+
+	MSA_Eject(Drive);
+	*pImageSize = 0;
+
+	pDrv->pMsaFile = HFile_Read(pszFileName, &pDrv->nMsaFileSize, NULL);
+	if (!pDrv->pMsaFile)
+		return NULL;
+
+	if (!MSA_BuildTrackIndex(pDrv))
+	{
+		pDiskBuffer = MSA_UnCompress(pDrv->pMsaFile, pImageSize);
+		MSA_Eject(Drive);
+	}
+	else
+	{
+		pDrv->nImageSize = (long)pDrv->nTracks * pDrv->nBytesPerTrack;
+		pDiskBuffer = malloc(pDrv->nImageSize);
+		if (!pDiskBuffer)
+			perror("MSA_Insert");
+		pDrv->pBuffer = pDiskBuffer;
+		*pImageSize = pDrv->nImageSize;
+	}
+
+	if (!pDiskBuffer)
+	{
+		MSA_Eject(Drive);
+		return NULL;
+	}
+
+	*pImageType = FLOPPY_IMAGE_TYPE_MSA;
+	return pDiskBuffer;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Make sure the tracks covering 'nBytes' bytes at 'Offset' in the disk
+ * buffer of 'Drive' are uncompressed. If 'bWrite' is set, these tracks
+ * are also marked to be compressed again by MSA_WriteDisk().
+ * Does nothing if the image in 'Drive' was not inserted with MSA_Insert().
+ */
+void MSA_AccessTracks(int Drive, long Offset, long nBytes, bool bWrite)
+{
+	MSA_DRIVE_STRUCT *pDrv = &MSA_Drives[Drive];
+	Uint8 *pBlock;
+	int Track, LastTrack;
+
+	if (!pDrv->pMsaFile || nBytes <= 0 || Offset < 0 || Offset >= pDrv->nImageSize)
+		return;
+
+	Track = Offset / pDrv->nBytesPerTrack;
+	LastTrack = (Offset + nBytes - 1) / pDrv->nBytesPerTrack;
+	if (LastTrack >= pDrv->nTracks)
+		LastTrack = pDrv->nTracks - 1;
+
+	for ( ; Track <= LastTrack; Track++)
+	{
+		if (!(pDrv->pTrackState[Track] & MSA_TRACK_DECODED))
+		{
+			pBlock = pDrv->pMsaFile + pDrv->pTrackOffset[Track];
+			MSA_UnCompressTrack(pDrv->pBuffer + (long)Track * pDrv->nBytesPerTrack,
+			                    pBlock + sizeof(Uint16), do_get_mem_word(pBlock),
+			                    pDrv->nBytesPerTrack);
+			pDrv->pTrackState[Track] |= MSA_TRACK_DECODED;
+		}
+		if (bWrite)
+			pDrv->pTrackState[Track] |= MSA_TRACK_CHANGED;
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return number of bytes of the same byte in the passed buffer
@@ -286,21 +468,85 @@ static int MSA_FindRunOfBytes(Uint8 *pBuffer, int nBytesInBuffer)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Compress one track of 'nBytesPerTrack' bytes from 'pImageBuffer' into an
+ * MSA track block (data length and data) at 'pMSABuffer'.
+ * Return the size of the block.
+ */
+static int MSA_CompressTrack(Uint8 *pMSABuffer, Uint8 *pImageBuffer, int nBytesPerTrack)
+{
+	Uint8 *pMSADataLength = pMSABuffer;
+	Uint8 *pTrackBuffer = pImageBuffer;
+	int nBytesToGo, nBytesRun, nCompressedBytes;
+
+	/* Skip data length (fill in later) */
+	pMSABuffer += sizeof(Uint16);
+
+	/* Compress track */
+	nBytesToGo = nBytesPerTrack;
+	nCompressedBytes = 0;
+	while (nBytesToGo > 0)
+	{
+		nBytesRun = MSA_FindRunOfBytes(pImageBuffer,nBytesToGo);
+		if (nBytesRun == 0)
+		{
+			/* Just copy byte */
+			*pMSABuffer++ = *pImageBuffer++;
+			nCompressedBytes++;
+			nBytesRun = 1;
+		}
+		else
+		{
+			/* Store run! */
+			*pMSABuffer++ = 0xE5;               /* Marker */
+			*pMSABuffer++ = *pImageBuffer;      /* Byte, and follow with 16-bit length */
+			do_put_mem_word(pMSABuffer, nBytesRun);
+			pMSABuffer += sizeof(Uint16);
+			pImageBuffer += nBytesRun;
+			nCompressedBytes += 4;
+		}
+		nBytesToGo -= nBytesRun;
+	}
+
+	/* Is compressed track smaller than the original? */
+	if (nCompressedBytes < nBytesPerTrack)
+	{
+		/* Yes, store size */
+		do_put_mem_word(pMSADataLength, nCompressedBytes);
+	}
+	else
+	{
+		/* No, just store uncompressed track */
+		nCompressedBytes = nBytesPerTrack;
+		do_put_mem_word(pMSADataLength, nBytesPerTrack);
+		memcpy(pMSADataLength + sizeof(Uint16), pTrackBuffer, nBytesPerTrack);
+	}
+
+	return sizeof(Uint16) + nCompressedBytes;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save compressed .MSA file from memory buffer. Returns true is all OK
+ * If the buffer is the one of an image inserted with MSA_Insert() and its
+ * geometry did not change, only the tracks written since the insert are
+ * compressed again, the other track blocks are copied from the original file.
+ * With a negative 'Drive', the whole buffer is compressed without accessing
+ * any drive (used when saving a copy of the buffer from another thread).
  */
 bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int ImageSize)
 {
 #ifdef SAVE_TO_MSA_IMAGES
 
+	MSA_DRIVE_STRUCT *pDrv = (Drive >= 0) ? &MSA_Drives[Drive] : NULL;
 	MSAHEADERSTRUCT *pMSAHeader;
-	Uint16 *pMSADataLength;
-	Uint8 *pMSAImageBuffer, *pMSABuffer, *pImageBuffer;
-	Uint16 nSectorsPerTrack, nSides, nCompressedBytes, nBytesPerTrack;
-	bool nRet;
-	int nTracks,nBytesToGo,nBytesRun;
-	int Track,Side;
+	Uint8 *pMSAImageBuffer, *pMSABuffer, *pImageBuffer, *pBlock;
+	Uint16 nSectorsPerTrack, nSides, nBytesPerTrack;
+	bool nRet, bIndexed;
+	int nTracks;
+	int Track,Side,Block;
 
 	/* Allocate workspace for compressed image */
 	pMSAImageBuffer = (Uint8 *)malloc(MSA_WORKSPACE_SIZE);
@@ -310,6 +556,11 @@ bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int Image
 		return false;
 	}
 
+	/* Boot sector is needed for the geometry */
+	bIndexed = (pDrv && pDrv->pMsaFile && pDrv->pBuffer == pBuffer && pDrv->nImageSize == ImageSize);
+	if (bIndexed)
+		MSA_AccessTracks(Drive, 0, NUMBYTESPERSECTOR, false);
+
 	/* Store header */
 	pMSAHeader = (MSAHEADERSTRUCT *)pMSAImageBuffer;
 	pMSAHeader->ID = SDL_SwapBE16(0x0E0F);
@@ -320,61 +571,37 @@ bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int Image
 	nTracks = ((ImageSize / NUMBYTESPERSECTOR) / nSectorsPerTrack) / nSides;
 	pMSAHeader->EndingTrack = SDL_SwapBE16(nTracks-1);
 
+	/* Original track blocks can only be kept if the layout is the same */
+	if (bIndexed && (pDrv->Header.SectorsPerTrack != nSectorsPerTrack
+	                 || pDrv->Header.Sides + 1 != nSides
+	                 || pDrv->Header.StartingTrack != 0
+	                 || pDrv->nTracks != nTracks * nSides))
+	{
+		MSA_AccessTracks(Drive, 0, ImageSize, false);
+		bIndexed = false;
+	}
+
 	/* Compress image */
 	pMSABuffer = pMSAImageBuffer + sizeof(MSAHEADERSTRUCT);
 	for (Track = 0; Track < nTracks; Track++)
 	{
 		for (Side = 0; Side < nSides; Side++)
 		{
+			Block = Track * nSides + Side;
+			if (bIndexed && !(pDrv->pTrackState[Block] & MSA_TRACK_CHANGED))
+			{
+				/* Unchanged track, copy original block */
+				pBlock = pDrv->pMsaFile + pDrv->pTrackOffset[Block];
+				memcpy(pMSABuffer, pBlock, sizeof(Uint16) + do_get_mem_word(pBlock));
+				pMSABuffer += sizeof(Uint16) + do_get_mem_word(pBlock);
+				continue;
+			}
+
 			/* Get track data pointer */
 			nBytesPerTrack = NUMBYTESPERSECTOR*nSectorsPerTrack;
 			pImageBuffer = pBuffer + (nBytesPerTrack*Side) + ((nBytesPerTrack*nSides)*Track);
 
-			/* Skip data length (fill in later) */
-			pMSADataLength = (Uint16 *)pMSABuffer;
-			pMSABuffer += sizeof(Uint16);
-
-			/* Compress track */
-			nBytesToGo = nBytesPerTrack;
-			nCompressedBytes = 0;
-			while (nBytesToGo > 0)
-			{
-				nBytesRun = MSA_FindRunOfBytes(pImageBuffer,nBytesToGo);
-				if (nBytesRun == 0)
-				{
-					/* Just copy byte */
-					*pMSABuffer++ = *pImageBuffer++;
-					nCompressedBytes++;
-					nBytesRun = 1;
-				}
-				else
-				{
-					/* Store run! */
-					*pMSABuffer++ = 0xE5;               /* Marker */
-					*pMSABuffer++ = *pImageBuffer;      /* Byte, and follow with 16-bit length */
-					do_put_mem_word(pMSABuffer, nBytesRun);
-					pMSABuffer += sizeof(Uint16);
-					pImageBuffer += nBytesRun;
-					nCompressedBytes += 4;
-				}
-				nBytesToGo -= nBytesRun;
-			}
-
-			/* Is compressed track smaller than the original? */
-			if (nCompressedBytes < nBytesPerTrack)
-			{
-				/* Yes, store size */
-				do_put_mem_word(pMSADataLength, nCompressedBytes);
-			}
-			else
-			{
-				/* No, just store uncompressed track */
-				do_put_mem_word(pMSADataLength, nBytesPerTrack);
-				pMSABuffer = ((Uint8 *)pMSADataLength) + 2;
-				pImageBuffer = pBuffer + (nBytesPerTrack*Side) + ((nBytesPerTrack*nSides)*Track);
-				memcpy(pMSABuffer,pImageBuffer, nBytesPerTrack);
-				pMSABuffer += nBytesPerTrack;
-			}
+			pMSABuffer += MSA_CompressTrack(pMSABuffer, pImageBuffer, nBytesPerTrack);
 		}
 	}
 
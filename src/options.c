@@ -26,6 +26,9 @@ const char Options_fileid[] = "Hatari options.c : " __DATE__ " " __TIME__;
 #include "configuration.h"
 #include "control.h"
 #include "debugui.h"
+#include "metrics.h"
+#include "controlBin.h"
+#include "gdbstub.h"
 #include "file.h"
 #include "floppy.h"
 #include "fdc.h"
@@ -34,6 +37,7 @@ const char Options_fileid[] = "Hatari options.c : " __DATE__ " " __TIME__;
 #include "sound.h"
 #include "video.h"
 #include "vdi.h"
+#include "inputMovie.h"
 #include "joy.h"
 #include "log.h"
 #include "tos.h"
@@ -42,6 +46,7 @@ const char Options_fileid[] = "Hatari options.c : " __DATE__ " " __TIME__;
 #include "hatari-glue.h"
 #include "68kDisass.h"
 #include "xbios.h"
+#include "falcon/dsp.h"
 
 bool bLoadAutoSave;        /* Load autosave memory snapshot at startup */
 bool bLoadMemorySave;      /* Load memory snapshot provided via option at startup */
@@ -72,6 +77,9 @@ enum {
 	OPT_MAXWIDTH,
 	OPT_MAXHEIGHT,
 	OPT_FORCEBPP,
+	OPT_NATIVE_RES,
+	OPT_HEADLESS,
+	OPT_FRAME_HASH,
 	OPT_BORDERS,		/* ST/STE display options */
 	OPT_RESOLUTION_ST,
 	OPT_SPEC512,
@@ -88,6 +96,8 @@ enum {
 	OPT_AVIRECORD_VCODEC,
 	OPT_AVIRECORD_FPS,
 	OPT_AVIRECORD_FILE,
+	OPT_SCREENSHOT_LEVEL,
+	OPT_FRAME_PIPE,
 	OPT_JOYSTICK,		/* device options */
 	OPT_JOYSTICK0,
 	OPT_JOYSTICK1,
@@ -108,22 +118,38 @@ enum {
 	OPT_DISKB,
 	OPT_SLOWFLOPPY,
 	OPT_FASTFLOPPY,
+	OPT_TURBOFLOPPY,
+	OPT_FLOPPYHLE,
+	OPT_DISKOVERLAY,
+	OPT_DISKJOURNAL,
 	OPT_WRITEPROT_FLOPPY,
 	OPT_WRITEPROT_HD,
 	OPT_HARDDRIVE,
 	OPT_GEMDOS_CASE,
+	OPT_GEMDOS_MMAP,
+	OPT_GEMDOS_PEXEC,
+	OPT_GEMDOS_FLUSH,
+	OPT_GEMDOS_OVERLAY,
 	OPT_GEMDOS_DRIVE,
 	OPT_ACSIHDIMAGE,
 	OPT_IDEMASTERHDIMAGE,
 	OPT_IDESLAVEHDIMAGE,
+	OPT_HDCACHE,
 	OPT_MEMSIZE,		/* memory options */
 	OPT_MEMSTATE,
+	OPT_MEMSTATE_LEVEL,
+	OPT_AUTOSAVE_INTERVAL,
 	OPT_TOS,		/* ROM options */
 	OPT_PATCHTOS,
 	OPT_CARTRIDGE,
 	OPT_CPULEVEL,		/* CPU options */
 	OPT_CPUCLOCK,
 	OPT_COMPATIBLE,
+	OPT_AUTO_PREFETCH,
+	OPT_CPU_TURBO,
+	OPT_BATCH_HBL,
+	OPT_FAST_TIMING,
+	OPT_DETERMINISTIC,
 #if ENABLE_WINUAE_CPU
 	OPT_CPU_CYCLE_EXACT,	/* WinUAE CPU/FPU/bus options */
 	OPT_CPU_ADDR24,
@@ -134,14 +160,21 @@ enum {
 	OPT_MACHINE,		/* system options */
 	OPT_BLITTER,
 	OPT_DSP,
+	OPT_DSPSKEW,
 	OPT_TIMERD,
 	OPT_FASTBOOT,
+	OPT_TURBOBOOT,
+	OPT_BOOTSNAPSHOT,
 	OPT_RTC,
+	OPT_IKBDCPU,
 	OPT_MICROPHONE,		/* sound options */
 	OPT_SOUND,
 	OPT_SOUNDBUFFERSIZE,
 	OPT_SOUNDSYNC,
 	OPT_YM_MIXING,
+	OPT_YM_HQ,
+	OPT_YM_COMPACT,
+	OPT_CROSSBAR_BATCH,
 #ifdef WIN32
 	OPT_WINCON,		/* debug options */
 #endif
@@ -151,16 +184,26 @@ enum {
 	OPT_CONOUT,
 	OPT_DISASM,
 	OPT_NATFEATS,
+	OPT_NATFEATS_MEMOPS,
+	OPT_DSPLOCKSTEP,
 	OPT_TRACE,
 	OPT_TRACEFILE,
+	OPT_TRACEBINFILE,
 	OPT_PARSE,
 	OPT_SAVECONFIG,
 	OPT_PARACHUTE,
 	OPT_CONTROLSOCKET,
+	OPT_GDBPORT,
+	OPT_CONTROLPORT,
 	OPT_LOGFILE,
 	OPT_LOGLEVEL,
 	OPT_ALERTLEVEL,
 	OPT_RUNVBLS,
+	OPT_BENCHMARK,
+	OPT_METRICS,
+	OPT_STATEHASH,
+	OPT_RECORDINPUT,
+	OPT_PLAYINPUT,
 	OPT_ERROR,
 	OPT_CONTINUE
 };
@@ -215,6 +258,12 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Maximum window height for borders & zooming" },
 	{ OPT_FORCEBPP, NULL, "--bpp",
 	  "<x>", "Force internal bitdepth (x = 8/15/16/32, 0=disable)" },
+	{ OPT_NATIVE_RES, NULL, "--native-res",
+	  "<bool>", "Don't zoom screen up to max size, leave that to host" },
+	{ OPT_HEADLESS, NULL, "--headless",
+	  "<bool>", "Don't render or show frames, except hashed ones" },
+	{ OPT_FRAME_HASH, NULL, "--frame-hash",
+	  "<x>", "Print hash of every <x>th frame (0=disable)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "ST/STE specific display" },
 	{ OPT_BORDERS, NULL, "--borders",
@@ -255,6 +304,10 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Force avi frame rate (x = 50/60/71/...)" },
 	{ OPT_AVIRECORD_FILE, NULL, "--avi-file",
 	  "<file>", "Use <file> to record avi" },
+	{ OPT_SCREENSHOT_LEVEL, NULL, "--screenshot-level",
+	  "<x>", "PNG screenshot compression level (x = 0-9)" },
+	{ OPT_FRAME_PIPE, NULL, "--frame-pipe",
+	  "<file>", "Write raw RGB24 frames to <file> (e.g. a named pipe)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Devices" },
 	{ OPT_JOYSTICK,  "-j", "--joystick",
@@ -304,14 +357,30 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Slow down floppy disk access emulation (deprecated, use --fastfdc)" },
 	{ OPT_FASTFLOPPY,   NULL, "--fastfdc",
 	  "<bool>", "Speed up floppy disk access emulation (can break some programs)" },
+	{ OPT_TURBOFLOPPY,   NULL, "--turbo-fdc",
+	  "<bool>", "Complete floppy commands at once for ST/MSA/DIM images" },
+	{ OPT_FLOPPYHLE,   NULL, "--floppy-hle",
+	  "<bool>", "Serve BIOS/XBIOS floppy sector calls from ST/MSA/DIM images" },
+	{ OPT_DISKOVERLAY,   NULL, "--disk-overlay",
+	  "<bool>", "Map .ST and HD images, discard their writes" },
+	{ OPT_DISKJOURNAL,   NULL, "--disk-journal",
+	  "<bool>", "Journal floppy writes, save images in background" },
 	{ OPT_WRITEPROT_FLOPPY, NULL, "--protect-floppy",
 	  "<x>", "Write protect floppy image contents (on/off/auto)" },
 	{ OPT_WRITEPROT_HD, NULL, "--protect-hd",
 	  "<x>", "Write protect harddrive <dir> contents (on/off/auto)" },
 	{ OPT_HARDDRIVE, "-d", "--harddrive",
-	  "<dir>", "Emulate harddrive partition(s) with <dir> contents" },
+	  "<dir>", "Emulate harddrive partition(s) with <dir> (or .zip) contents" },
 	{ OPT_GEMDOS_CASE, NULL, "--gemdos-case",
 	  "<x>", "Forcibly up/lowercase new GEMDOS dir/filenames (off/upper/lower)" },
+	{ OPT_GEMDOS_MMAP, NULL, "--gemdos-mmap",
+	  "<bool>", "Map big files opened read-only on GEMDOS HD" },
+	{ OPT_GEMDOS_PEXEC, NULL, "--gemdos-pexec",
+	  "<bool>", "Relocate programs run from GEMDOS HD natively" },
+	{ OPT_GEMDOS_FLUSH, NULL, "--gemdos-flush",
+	  "<x>", "When GEMDOS HD writes are flushed to host (write/vbl/close)" },
+	{ OPT_GEMDOS_OVERLAY, NULL, "--gemdos-overlay",
+	  "<dir>", "Host <dir> for changes to a GEMDOS HD .zip archive" },
 	{ OPT_GEMDOS_DRIVE, NULL, "--gemdos-drive",
 	  "<drive>", "Assign GEMDOS HD <dir> to drive letter <drive> (C-Z, skip)" },
 	{ OPT_ACSIHDIMAGE,   NULL, "--acsi",
@@ -320,12 +389,18 @@ static const opt_t HatariOptions[] = {
 	  "<file>", "Emulate an IDE master harddrive with an image <file>" },
 	{ OPT_IDESLAVEHDIMAGE,   NULL, "--ide-slave",
 	  "<file>", "Emulate an IDE slave harddrive with an image <file>" },
+	{ OPT_HDCACHE,   NULL, "--hd-cache",
+	  "<x>", "Harddrive image cache size (x = size in MiB, 0 = off)" },
 	
 	{ OPT_HEADER, NULL, NULL, NULL, "Memory" },
 	{ OPT_MEMSIZE,   "-s", "--memsize",
 	  "<x>", "ST RAM size (x = size in MiB from 0 to 14, 0 = 512KiB)" },
 	{ OPT_MEMSTATE,   NULL, "--memstate",
 	  "<file>", "Load memory snap-shot <file>" },
+	{ OPT_MEMSTATE_LEVEL, NULL, "--memstate-level",
+	  "<x>", "Memory snap-shot file compression level (x = 0-9)" },
+	{ OPT_AUTOSAVE_INTERVAL, NULL, "--autosave-interval",
+	  "<x>", "Auto-save memory snap-shot every x seconds (0 = off)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "ROM" },
 	{ OPT_TOS,       "-t", "--tos",
@@ -342,6 +417,16 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Set the CPU clock (x = 8/16/32)" },
 	{ OPT_COMPATIBLE, NULL, "--compatible",
 	  "<bool>", "Use a more compatible (but slower) 68000 CPU mode" },
+	{ OPT_AUTO_PREFETCH, NULL, "--auto-prefetch",
+	  "<bool>", "Emulate 68000 prefetch only once self-modifying code needs it" },
+	{ OPT_CPU_TURBO, NULL, "--cpu-turbo",
+	  "<bool>", "Run the CPU at 32 MHz while floppy/ACSI disks are busy" },
+	{ OPT_BATCH_HBL, NULL, "--batch-hbl",
+	  "<bool>", "Handle runs of lines without raster effects in one HBL interrupt" },
+	{ OPT_FAST_TIMING, NULL, "--fast-timing",
+	  "<bool>", "Faster, less exact CPU timing (no prefetch/pairing/wait states)" },
+	{ OPT_DETERMINISTIC, NULL, "--deterministic",
+	  "<bool>", "Derive randomness and clocks from emulated state only" },
 
 #if ENABLE_WINUAE_CPU
 	{ OPT_HEADER, NULL, NULL, NULL, "WinUAE CPU/FPU/bus" },
@@ -364,12 +449,20 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Use blitter emulation (ST only)" },
 	{ OPT_DSP,       NULL, "--dsp",
 	  "<x>", "DSP emulation (x = none/dummy/emu, Falcon only)" },
+	{ OPT_DSPSKEW,   NULL, "--dsp-skew",
+	  "<int>", "Max DSP cycles the DSP may lag behind the CPU (0-8192)" },
 	{ OPT_TIMERD,    NULL, "--timer-d",
 	  "<bool>", "Patch Timer-D (about doubles ST emulation speed)" },
 	{ OPT_FASTBOOT, NULL, "--fast-boot",
 	  "<bool>", "Patch TOS and memvalid system variables for faster boot" },
+	{ OPT_TURBOBOOT, NULL, "--turbo-boot",
+	  "<bool>", "Run boot at full speed without output until a disk access" },
+	{ OPT_BOOTSNAPSHOT, NULL, "--boot-snapshot",
+	  "<bool>", "Resume from a state saved before boot disk access" },
 	{ OPT_RTC,    NULL, "--rtc",
 	  "<bool>", "Enable real-time clock" },
+	{ OPT_IKBDCPU, NULL, "--ikbd-cpu",
+	  "<bool>", "Run unknown custom IKBD code on an emulated HD6301" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Sound" },
 	{ OPT_MICROPHONE,   NULL, "--mic",
@@ -382,6 +475,12 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Sound synchronized emulation (on|off, off=default)" },
 	{ OPT_YM_MIXING,   NULL, "--ym-mixing",
 	  "<x>", "YM sound mixing method (x=linear/table/model)" },
+	{ OPT_YM_HQ,   NULL, "--ym-hq",
+	  "<bool>", "Emulate YM at its own clock, with less aliasing (slower)" },
+	{ OPT_YM_COMPACT,   NULL, "--ym-compact",
+	  "<bool>", "Use a 12 KB YM volume table instead of the 64 KB one" },
+	{ OPT_CROSSBAR_BATCH,   NULL, "--crossbar-batch",
+	  "<bool>", "Handle Falcon sound matrix once per scanline (faster)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Debug" },
 #ifdef WIN32
@@ -400,10 +499,16 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Set disassembly options (help/uae/ext/<bitmask>)" },
 	{ OPT_NATFEATS, NULL, "--natfeats",
 	  "<bool>", "Whether Native Features support is enabled" },
+	{ OPT_NATFEATS_MEMOPS, NULL, "--natfeats-memops",
+	  "<x>", "NF_MEMOPS memory copy/fill cycles (off/free/cpu)" },
+	{ OPT_DSPLOCKSTEP, NULL, "--dsp-lockstep",
+	  "<bool>", "Verify fast DSP execution against the reference one" },
 	{ OPT_TRACE,   NULL, "--trace",
 	  "<flags>", "Activate emulation tracing, see '--trace help'" },
 	{ OPT_TRACEFILE, NULL, "--trace-file",
 	  "<file>", "Save trace output to <file> (default=stderr)" },
+	{ OPT_TRACEBINFILE, NULL, "--trace-bin-file",
+	  "<file>", "Save CPU PC & IO traces as binary records to <file>" },
 	{ OPT_PARSE, NULL, "--parse",
 	  "<file>", "Parse/execute debugger commands from <file>" },
 	{ OPT_SAVECONFIG, NULL, "--saveconfig",
@@ -413,6 +518,12 @@ static const opt_t HatariOptions[] = {
 #if HAVE_UNIX_DOMAIN_SOCKETS
 	{ OPT_CONTROLSOCKET, NULL, "--control-socket",
 	  "<file>", "Hatari reads options from given socket at run-time" },
+#endif
+#if HAVE_TCP_SOCKETS
+	{ OPT_GDBPORT, NULL, "--gdb-port",
+	  "<port>", "Accept GDB remote debugger connections on local TCP <port>" },
+	{ OPT_CONTROLPORT, NULL, "--control-port",
+	  "<port>", "Accept binary control protocol connections on local TCP <port>" },
 #endif
 	{ OPT_LOGFILE, NULL, "--log-file",
 	  "<file>", "Save log output to <file> (default=stderr)" },
@@ -422,6 +533,16 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Show dialog for log messages above given level" },
 	{ OPT_RUNVBLS, NULL, "--run-vbls",
 	  "<x>", "Exit after x VBLs" },
+	{ OPT_BENCHMARK, NULL, "--benchmark",
+	  "<x>", "Run x VBLs unthrottled, show host time per VBL and exit" },
+	{ OPT_METRICS, NULL, "--metrics",
+	  "<x>", "Log speed/frame time/audio/FDC metrics every x seconds (0=off)" },
+	{ OPT_STATEHASH, NULL, "--state-hash",
+	  "<x>", "Show CRC of emulation state every x VBLs" },
+	{ OPT_RECORDINPUT, NULL, "--record-input",
+	  "<file>", "Record emulated input from next VBL on to <file>" },
+	{ OPT_PLAYINPUT, NULL, "--play-input",
+	  "<file>", "Play back emulated input recorded to <file>" },
 
 	{ OPT_ERROR, NULL, NULL, NULL, NULL }
 };
@@ -1027,6 +1148,24 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ConfigureParams.Screen.nForceBpp = planes;
 			break;
 
+		case OPT_NATIVE_RES:
+			ok = Opt_Bool(argv[++i], OPT_NATIVE_RES, &ConfigureParams.Screen.bNativeRes);
+			break;
+
+		case OPT_HEADLESS:
+			ok = Opt_Bool(argv[++i], OPT_HEADLESS, &ConfigureParams.Screen.bHeadless);
+			break;
+
+		case OPT_FRAME_HASH:
+			val = atoi(argv[++i]);
+			if (val < 0)
+			{
+				return Opt_ShowError(OPT_FRAME_HASH, argv[i],
+							"Invalid frame hash interval");
+			}
+			ConfigureParams.Screen.nFrameHash = val;
+			break;
+
 			/* ST/STE display options */
 		case OPT_BORDERS:
 			ok = Opt_Bool(argv[++i], OPT_BORDERS, &ConfigureParams.Screen.bAllowOverscan);
@@ -1127,6 +1266,43 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 					argv[i], sizeof(ConfigureParams.Video.AviRecordFile), NULL);
 			break;
 
+		case OPT_MEMSTATE_LEVEL:
+			val = atoi(argv[++i]);
+			if (val < 0 || val > 9)
+			{
+				return Opt_ShowError(OPT_MEMSTATE_LEVEL, argv[i],
+							"Invalid memory snap-shot compression level");
+			}
+			ConfigureParams.Memory.nSnapshotCompression = val;
+			break;
+
+		case OPT_AUTOSAVE_INTERVAL:
+			val = atoi(argv[++i]);
+			if (val < 0 || val > 3600)
+			{
+				return Opt_ShowError(OPT_AUTOSAVE_INTERVAL, argv[i],
+							"Invalid auto-save interval");
+			}
+			ConfigureParams.Memory.nAutoSaveInterval = val;
+			break;
+
+		case OPT_SCREENSHOT_LEVEL:
+			val = atoi(argv[++i]);
+			if (val < 0 || val > 9)
+			{
+				return Opt_ShowError(OPT_SCREENSHOT_LEVEL, argv[i],
+							"Invalid screenshot compression level");
+			}
+			ConfigureParams.Video.ScreenShotCompression = val;
+			break;
+
+		case OPT_FRAME_PIPE:
+			i += 1;
+			/* false -> file is created if it doesn't exist */
+			ok = Opt_StrCpy(OPT_FRAME_PIPE, false, ConfigureParams.Video.FramePipeFile,
+					argv[i], sizeof(ConfigureParams.Video.FramePipeFile), NULL);
+			break;
+
 			/* VDI options */
 		case OPT_VDI:
 			ok = Opt_Bool(argv[++i], OPT_VDI, &ConfigureParams.Screen.bUseExtVdiResolutions);
@@ -1296,6 +1472,22 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ok = Opt_Bool(argv[++i], OPT_FASTFLOPPY, &ConfigureParams.DiskImage.FastFloppy);
 			break;
 
+		case OPT_TURBOFLOPPY:
+			ok = Opt_Bool(argv[++i], OPT_TURBOFLOPPY, &ConfigureParams.DiskImage.TurboFloppy);
+			break;
+
+		case OPT_FLOPPYHLE:
+			ok = Opt_Bool(argv[++i], OPT_FLOPPYHLE, &ConfigureParams.DiskImage.bFloppyHLE);
+			break;
+
+		case OPT_DISKOVERLAY:
+			ok = Opt_Bool(argv[++i], OPT_DISKOVERLAY, &ConfigureParams.DiskImage.bDiskOverlay);
+			break;
+
+		case OPT_DISKJOURNAL:
+			ok = Opt_Bool(argv[++i], OPT_DISKJOURNAL, &ConfigureParams.DiskImage.bDiskJournal);
+			break;
+
 		case OPT_WRITEPROT_FLOPPY:
 			i += 1;
 			if (strcasecmp(argv[i], "off") == 0)
@@ -1332,6 +1524,32 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 				return Opt_ShowError(OPT_GEMDOS_CASE, argv[i], "Unknown option value");
 			break;
 
+		case OPT_GEMDOS_MMAP:
+			ok = Opt_Bool(argv[++i], OPT_GEMDOS_MMAP, &ConfigureParams.HardDisk.bGemdosMmap);
+			break;
+
+		case OPT_GEMDOS_PEXEC:
+			ok = Opt_Bool(argv[++i], OPT_GEMDOS_PEXEC, &ConfigureParams.HardDisk.bGemdosFastPexec);
+			break;
+
+		case OPT_GEMDOS_FLUSH:
+			i += 1;
+			if (strcasecmp(argv[i], "write") == 0)
+				ConfigureParams.HardDisk.nGemdosFlush = GEMDOS_FLUSH_WRITE;
+			else if (strcasecmp(argv[i], "vbl") == 0)
+				ConfigureParams.HardDisk.nGemdosFlush = GEMDOS_FLUSH_VBL;
+			else if (strcasecmp(argv[i], "close") == 0)
+				ConfigureParams.HardDisk.nGemdosFlush = GEMDOS_FLUSH_CLOSE;
+			else
+				return Opt_ShowError(OPT_GEMDOS_FLUSH, argv[i], "Unknown option value");
+			break;
+
+		case OPT_GEMDOS_OVERLAY:
+			i += 1;
+			ok = Opt_StrCpy(OPT_GEMDOS_OVERLAY, false, ConfigureParams.HardDisk.szGemdosOverlayDir,
+					argv[i], sizeof(ConfigureParams.HardDisk.szGemdosOverlayDir), NULL);
+			break;
+
 		case OPT_GEMDOS_DRIVE:
 			i += 1;
 			if (strcasecmp(argv[i], "skip") == 0)
@@ -1402,6 +1620,15 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			break;
 
+		case OPT_HDCACHE:
+			val = atoi(argv[++i]);
+			if (val < 0 || val > 1024)
+			{
+				return Opt_ShowError(OPT_HDCACHE, argv[i], "Invalid cache size");
+			}
+			ConfigureParams.HardDisk.nHdCacheSize = val;
+			break;
+
 			/* Memory options */
 		case OPT_MEMSIZE:
 			memsize = atoi(argv[++i]);
@@ -1480,6 +1707,34 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 				bLoadAutoSave = false;
 			}
 			break;
+
+		case OPT_AUTO_PREFETCH:
+			ok = Opt_Bool(argv[++i], OPT_AUTO_PREFETCH, &ConfigureParams.System.bAutoPrefetch);
+			if (ok)
+			{
+				bLoadAutoSave = false;
+			}
+			break;
+
+		case OPT_CPU_TURBO:
+			ok = Opt_Bool(argv[++i], OPT_CPU_TURBO, &ConfigureParams.System.bCpuTurbo);
+			break;
+
+		case OPT_BATCH_HBL:
+			ok = Opt_Bool(argv[++i], OPT_BATCH_HBL, &ConfigureParams.System.bBatchHbl);
+			break;
+
+		case OPT_FAST_TIMING:
+			ok = Opt_Bool(argv[++i], OPT_FAST_TIMING, &ConfigureParams.System.bFastTiming);
+			if (ok)
+			{
+				bLoadAutoSave = false;
+			}
+			break;
+
+		case OPT_DETERMINISTIC:
+			ok = Opt_Bool(argv[++i], OPT_DETERMINISTIC, &ConfigureParams.System.bDeterministic);
+			break;
 #if ENABLE_WINUAE_CPU
 		case OPT_CPU_ADDR24:
 			ok = Opt_Bool(argv[++i], OPT_CPU_ADDR24, &ConfigureParams.System.bAddressSpace24);
@@ -1592,11 +1847,21 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_FASTBOOT:
 			ok = Opt_Bool(argv[++i], OPT_FASTBOOT, &ConfigureParams.System.bFastBoot);
 			break;
+		case OPT_TURBOBOOT:
+			ok = Opt_Bool(argv[++i], OPT_TURBOBOOT, &ConfigureParams.System.bTurboBoot);
+			break;
+		case OPT_BOOTSNAPSHOT:
+			ok = Opt_Bool(argv[++i], OPT_BOOTSNAPSHOT, &ConfigureParams.System.bBootSnapshot);
+			break;
 
 		case OPT_RTC:
 			ok = Opt_Bool(argv[++i], OPT_RTC, &ConfigureParams.System.bRealTimeClock);
 			break;
 
+		case OPT_IKBDCPU:
+			ok = Opt_Bool(argv[++i], OPT_IKBDCPU, &ConfigureParams.Keyboard.bIkbdCpu);
+			break;
+
 		case OPT_DSP:
 			i += 1;
 			if (strcasecmp(argv[i], "none") == 0)
@@ -1622,6 +1887,15 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			bLoadAutoSave = false;
 			break;
 
+		case OPT_DSPSKEW:
+			val = atoi(argv[++i]);
+			if (val < 0 || val > 8192)
+			{
+				return Opt_ShowError(OPT_DSPSKEW, argv[i], "Invalid DSP skew");
+			}
+			ConfigureParams.System.nDSPSkew = val;
+			break;
+
 			/* sound options */
 		case OPT_YM_MIXING:
 			i += 1;
@@ -1643,6 +1917,18 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			break;
 
+		case OPT_YM_HQ:
+			ok = Opt_Bool(argv[++i], OPT_YM_HQ, &ConfigureParams.Sound.bYmHighQuality);
+			break;
+
+		case OPT_YM_COMPACT:
+			ok = Opt_Bool(argv[++i], OPT_YM_COMPACT, &ConfigureParams.Sound.bYmCompactVolume);
+			break;
+
+		case OPT_CROSSBAR_BATCH:
+			ok = Opt_Bool(argv[++i], OPT_CROSSBAR_BATCH, &ConfigureParams.Sound.bCrossbarBatch);
+			break;
+
 		case OPT_SOUND:
 			i += 1;
 			if (strcasecmp(argv[i], "off") == 0)
@@ -1754,6 +2040,22 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			fprintf(stderr, "Native Features %s.\n", ConfigureParams.Log.bNatFeats ? "enabled" : "disabled");
 			break;
 
+		case OPT_NATFEATS_MEMOPS:
+			i += 1;
+			if (strcasecmp(argv[i], "off") == 0)
+				ConfigureParams.Log.nNatFeatsMemOps = NATFEATS_MEMOPS_OFF;
+			else if (strcasecmp(argv[i], "free") == 0)
+				ConfigureParams.Log.nNatFeatsMemOps = NATFEATS_MEMOPS_FREE;
+			else if (strcasecmp(argv[i], "cpu") == 0)
+				ConfigureParams.Log.nNatFeatsMemOps = NATFEATS_MEMOPS_CPU;
+			else
+				return Opt_ShowError(OPT_NATFEATS_MEMOPS, argv[i], "Unknown option value");
+			break;
+
+		case OPT_DSPLOCKSTEP:
+			ok = Opt_Bool(argv[++i], OPT_DSPLOCKSTEP, &bDspLockstep);
+			break;
+
 		case OPT_PARACHUTE:
 			bNoSDLParachute = true;
 			break;
@@ -1791,6 +2093,13 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 					NULL);
 			break;
 
+		case OPT_TRACEBINFILE:
+			i += 1;
+			ok = Opt_StrCpy(OPT_TRACEBINFILE, false, ConfigureParams.Log.sTraceBinFileName,
+					argv[i], sizeof(ConfigureParams.Log.sTraceBinFileName),
+					NULL);
+			break;
+
 		case OPT_CONTROLSOCKET:
 			i += 1;
 			errstr = Control_SetSocket(argv[i]);
@@ -1800,6 +2109,24 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			break;
 
+		case OPT_GDBPORT:
+			i += 1;
+			errstr = GdbStub_SetPort(atoi(argv[i]));
+			if (errstr)
+			{
+				return Opt_ShowError(OPT_GDBPORT, argv[i], errstr);
+			}
+			break;
+
+		case OPT_CONTROLPORT:
+			i += 1;
+			errstr = ControlBin_SetPort(atoi(argv[i]));
+			if (errstr)
+			{
+				return Opt_ShowError(OPT_CONTROLPORT, argv[i], errstr);
+			}
+			break;
+
 		case OPT_LOGFILE:
 			i += 1;
 			ok = Opt_StrCpy(OPT_LOGFILE, false, ConfigureParams.Log.sLogFileName,
@@ -1839,6 +2166,32 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_RUNVBLS:
 			Main_SetRunVBLs(atol(argv[++i]));
 			break;
+
+		case OPT_BENCHMARK:
+			Main_SetBenchmark(atol(argv[++i]));
+			break;
+
+		case OPT_METRICS:
+			Metrics_SetInterval(atol(argv[++i]));
+			break;
+
+		case OPT_STATEHASH:
+			Main_SetStateHash(atol(argv[++i]));
+			break;
+
+		case OPT_RECORDINPUT:
+			InputMovie_SetRecord(argv[++i]);
+			break;
+
+		case OPT_PLAYINPUT:
+			i += 1;
+			if (!File_Exists(argv[i]))
+			{
+				return Opt_ShowError(OPT_PLAYINPUT, argv[i], "Given input movie file doesn't exist (or has wrong file permissions)!");
+			}
+			InputMovie_SetPlayback(argv[i]);
+			bLoadAutoSave = false;
+			break;
 		       
 		case OPT_ERROR:
 			/* unknown option or missing option parameter */
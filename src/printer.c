@@ -6,9 +6,9 @@
 
   Printer communication. When bytes are sent from the ST they are sent to these
   functions via 'Printer_TransferByteTo()'. This will then open a file and
-  direct the output to this. These bytes are buffered up (to improve speed) and
-  this also allow us to detect when the stream goes into idle - at which point
-  we close the file/printer.
+  direct the output to this. These bytes are queued for the serial I/O worker
+  thread (so that a slow printer doesn't stall the emulation), and we detect
+  when the stream goes into idle - at which point we close the file/printer.
 */
 const char Printer_fileid[] = "Hatari printer.c : " __DATE__ " " __TIME__;
 
@@ -18,6 +18,7 @@ const char Printer_fileid[] = "Hatari printer.c : " __DATE__ " " __TIME__;
 #include "paths.h"
 #include "printer.h"
 #include "log.h"
+#include "serialIO.h"
 
 #define PRINTER_DEBUG 0
 #if PRINTER_DEBUG
@@ -26,13 +27,13 @@ const char Printer_fileid[] = "Hatari printer.c : " __DATE__ " " __TIME__;
 #define Dprintf(a)
 #endif
 
-/* After ~4 seconds (4*50 VBLs), flush & close printer */
+/* After ~4 seconds (4*50 VBLs), close printer */
 #define PRINTER_IDLE_CLOSE   (4*50)
 
 static int nIdleCount;
 static int bUnflushed;
 
-static FILE *pPrinterHandle;
+static serialio_t *pPrinterDev;
 
 
 /*-----------------------------------------------------------------------*/
@@ -73,7 +74,8 @@ void Printer_UnInit(void)
 	Dprintf((stderr, "Printer_UnInit()\n"));
 
 	/* Close any open files */
-	pPrinterHandle = HFile_Close(pPrinterHandle);
+	SerialIO_Close(pPrinterDev);
+	pPrinterDev = NULL;
 	bUnflushed = false;
 	nIdleCount = 0;
 }
@@ -92,20 +94,20 @@ bool Printer_TransferByteTo(Uint8 Byte)
 		return false;   /* Failed if printing disabled */
 
 	/* Have we made a connection to our printer/file? */
-	if (!pPrinterHandle)
+	if (!pPrinterDev)
 	{
 		/* open printer file... */
-		pPrinterHandle = File_Open(ConfigureParams.Printer.szPrintToFileName, "a+");
-		if (!pPrinterHandle)
+		pPrinterDev = SerialIO_Open(NULL, ConfigureParams.Printer.szPrintToFileName, true);
+		if (!pPrinterDev)
 		{
 			Log_AlertDlg(LOG_ERROR, "Printer output file open failed. Printing disabled.");
 			ConfigureParams.Printer.bEnablePrinting = false;
 			return false;
 		}
 	}
-	if (fputc(Byte, pPrinterHandle) != Byte)
+	if (!SerialIO_Write(pPrinterDev, &Byte, 1))
 	{
-		fprintf(stderr, "ERROR: Printer_TransferByteTo() writing failed!\n");
+		Dprintf(("Printer_TransferByteTo(): output buffer full, byte dropped\n"));
 		return false;
 	}
 	bUnflushed = true;
@@ -115,15 +117,14 @@ bool Printer_TransferByteTo(Uint8 Byte)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Empty printer buffer, and if remains idle for set time close connection
+ * If printer remains idle for set time close connection
  * (ie close file, stop printer)
  */
 void Printer_CheckIdleStatus(void)
 {
-	/* Is anything waiting for printer? */
+	/* Was anything sent to the printer? */
 	if (bUnflushed)
 	{
-		fflush(pPrinterHandle);
 		bUnflushed = false;
 		nIdleCount = 0;
 	}
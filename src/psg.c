@@ -271,9 +271,6 @@ void PSG_Set_DataRegister(Uint8 val)
 	if ( PSGRegisterSelect >= MAX_PSG_REGISTERS )
 		return;					/* not valid, ignore write and do nothing */
 
-	/* Create samples up until this point with current values */
-	Sound_Update(false);
-
 	/* When a read is made from $ff8800 without changing PSGRegisterSelect, we should return */
 	/* the non masked value. */
 	PSGRegisterReadData = val;			/* store non masked value for PSG_Get_DataRegister */
@@ -296,8 +293,9 @@ void PSG_Set_DataRegister(Uint8 val)
 
 	if ( PSGRegisterSelect < NUM_PSG_SOUND_REGISTERS )
 	{
-		/* Copy sound related registers 0..13 to the sound module's internal buffer */
-		Sound_WriteReg ( PSGRegisterSelect , PSGRegisters[PSGRegisterSelect] );
+		/* Copy sound related registers 0..13 to the sound module's internal buffer, */
+		/* once the samples up until this point are created with current values */
+		Sound_QueueReg ( PSGRegisterSelect , PSGRegisters[PSGRegisterSelect] );
 	}
 
 	else if ( PSGRegisterSelect == PSG_REG_IO_PORTA )
@@ -0,0 +1,274 @@
+/*
+  Hatari - recWriter.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Background writer for the WAV and AVI recordings.
+
+  Recorders give their data to RecWriter_Write(), which only copies it
+  into one of a fixed set of pre-allocated buffers. Full buffers are
+  queued to a writer thread doing the actual fwrite(), then recycled
+  through a free list. When all buffers are in use (storage is slower
+  than the recording), RecWriter_Write() waits for the next free one.
+  Before seeking in or closing a file, the recorder must call
+  RecWriter_Flush() to wait until all the data queued for it is written.
+
+  Without thread support, data is written directly.
+*/
+const char RecWriter_fileid[] = "Hatari recWriter.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "recWriter.h"
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+#include <rthreads/rthreads.h>
+
+#define RECWRITER_BUFFERS	8
+#define RECWRITER_BUFFER_SIZE	(1024*1024)
+
+typedef struct recbuffer_s {
+	struct recbuffer_s *next;
+	FILE *fp;				/* file to write the data to */
+	size_t used;
+	Uint8 *data;
+} recbuffer_t;
+
+static struct {
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;				/* signaled on each queue/free list change */
+	recbuffer_t buffers[RECWRITER_BUFFERS];
+	recbuffer_t *free;			/* free list */
+	recbuffer_t *head, *tail;		/* queue of buffers to write */
+	recbuffer_t *current;			/* buffer being filled, not queued yet */
+	bool busy;				/* writer thread is writing a buffer */
+	FILE *failed;				/* file for which a write failed */
+	bool quit;
+	bool failedInit;			/* thread creation failed, don't retry */
+} writer;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Writer thread: write the queued buffers in order and put them back
+ * to the free list, until RecWriter_UnInit() is called.
+ */
+static void RecWriter_ThreadFunc(void *data)
+{
+	recbuffer_t *buf;
+	bool ok;
+
+	slock_lock(writer.lock);
+	for (;;)
+	{
+		while (!writer.head && !writer.quit)
+			scond_wait(writer.cond, writer.lock);
+		if (!writer.head)
+			break;
+		buf = writer.head;
+		writer.head = buf->next;
+		if (!writer.head)
+			writer.tail = NULL;
+		writer.busy = true;
+		slock_unlock(writer.lock);
+
+		ok = (fwrite(buf->data, 1, buf->used, buf->fp) == buf->used);
+		if (!ok)
+			perror("RecWriter_ThreadFunc");
+
+		slock_lock(writer.lock);
+		if (!ok)
+			writer.failed = buf->fp;
+		writer.busy = false;
+		buf->next = writer.free;
+		writer.free = buf;
+		scond_broadcast(writer.cond);
+	}
+	slock_unlock(writer.lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Allocate the buffers and start the writer thread if not done yet,
+ * return true if they're available
+ */
+static bool RecWriter_Start(void)
+{
+	int i;
+
+	if (writer.thread)
+		return true;
+	if (writer.failedInit)
+		return false;
+
+	for (i = 0; i < RECWRITER_BUFFERS; i++)
+	{
+		writer.buffers[i].data = malloc(RECWRITER_BUFFER_SIZE);
+		if (!writer.buffers[i].data)
+			break;
+		writer.buffers[i].next = writer.free;
+		writer.free = &writer.buffers[i];
+	}
+	writer.lock = slock_new();
+	writer.cond = scond_new();
+	if (i == RECWRITER_BUFFERS && writer.lock && writer.cond)
+		writer.thread = sthread_create(RecWriter_ThreadFunc, NULL);
+
+	if (!writer.thread)
+	{
+		Log_Printf(LOG_WARN, "Failed to create recording writer thread, writing directly.\n");
+		RecWriter_UnInit();
+		writer.failedInit = true;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue the buffer being filled (called with the lock held)
+ */
+static void RecWriter_QueueCurrent(void)
+{
+	recbuffer_t *buf = writer.current;
+
+	if (!buf)
+		return;
+	writer.current = NULL;
+	buf->next = NULL;
+	if (writer.tail)
+		writer.tail->next = buf;
+	else
+		writer.head = buf;
+	writer.tail = buf;
+	scond_broadcast(writer.cond);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy 'nSize' bytes for file 'fp' to the write buffers.
+ * Return false if an earlier write to this file failed.
+ */
+bool RecWriter_Write(FILE *fp, const void *pData, size_t nSize)
+{
+	const Uint8 *src = pData;
+	size_t len;
+
+	if (!RecWriter_Start())
+		return fwrite(pData, 1, nSize, fp) == nSize;
+
+	slock_lock(writer.lock);
+	if (writer.failed == fp)
+	{
+		slock_unlock(writer.lock);
+		return false;
+	}
+	if (writer.current && writer.current->fp != fp)
+		RecWriter_QueueCurrent();
+
+	while (nSize > 0)
+	{
+		if (!writer.current)
+		{
+			while (!writer.free)
+				scond_wait(writer.cond, writer.lock);
+			writer.current = writer.free;
+			writer.free = writer.current->next;
+			writer.current->fp = fp;
+			writer.current->used = 0;
+		}
+		len = RECWRITER_BUFFER_SIZE - writer.current->used;
+		if (len > nSize)
+			len = nSize;
+		memcpy(writer.current->data + writer.current->used, src, len);
+		writer.current->used += len;
+		src += len;
+		nSize -= len;
+		if (writer.current->used == RECWRITER_BUFFER_SIZE)
+			RecWriter_QueueCurrent();
+	}
+	slock_unlock(writer.lock);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until all data given to RecWriter_Write() has been written.
+ * Return false if a write to file 'fp' failed.
+ */
+bool RecWriter_Flush(FILE *fp)
+{
+	bool ok;
+
+	if (!writer.thread)
+		return true;
+
+	slock_lock(writer.lock);
+	RecWriter_QueueCurrent();
+	while (writer.head || writer.busy)
+		scond_wait(writer.cond, writer.lock);
+	ok = (writer.failed != fp);
+	if (!ok)
+		writer.failed = NULL;
+	slock_unlock(writer.lock);
+	return ok;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write remaining data, stop the writer thread and free its buffers
+ */
+void RecWriter_UnInit(void)
+{
+	int i;
+
+	if (writer.thread)
+	{
+		RecWriter_Flush(NULL);
+		slock_lock(writer.lock);
+		writer.quit = true;
+		scond_broadcast(writer.cond);
+		slock_unlock(writer.lock);
+		sthread_join(writer.thread);
+		writer.thread = NULL;
+	}
+	if (writer.cond)
+		scond_free(writer.cond);
+	if (writer.lock)
+		slock_free(writer.lock);
+	writer.cond = NULL;
+	writer.lock = NULL;
+	for (i = 0; i < RECWRITER_BUFFERS; i++)
+	{
+		free(writer.buffers[i].data);
+		writer.buffers[i].data = NULL;
+	}
+	writer.free = writer.head = writer.tail = writer.current = NULL;
+	writer.failed = NULL;
+	writer.quit = false;
+}
+
+#else	/* no threads */
+
+bool RecWriter_Write(FILE *fp, const void *pData, size_t nSize)
+{
+	return fwrite(pData, 1, nSize, fp) == nSize;
+}
+
+bool RecWriter_Flush(FILE *fp)
+{
+	return true;
+}
+
+void RecWriter_UnInit(void)
+{
+}
+
+#endif
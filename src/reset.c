@@ -10,6 +10,7 @@ const char Reset_fileid[] = "Hatari reset.c : " __DATE__ " " __TIME__;
 
 #include "main.h"
 #include "configuration.h"
+#include "bootSnapshot.h"
 #include "cart.h"
 #include "dmaSnd.h"
 #include "crossbar.h"
@@ -31,6 +32,7 @@ const char Reset_fileid[] = "Hatari reset.c : " __DATE__ " " __TIME__;
 #include "tos.h"
 #include "vdi.h"
 #include "nvram.h"
+#include "utils.h"
 #include "video.h"
 #include "falcon/videl.h"
 #include "falcon/dsp.h"
@@ -55,6 +57,10 @@ static int Reset_ST(bool bCold)
 			return ret;               /* If we can not load a TOS image, return now! */
 
 		Cart_ResetImage();          /* Load cartridge program into ROM memory. */
+		STMemory_SetDirtyArea(0xe00000, 0x200000);  /* Reloaded ROM, for delta snapshots */
+		Utils_RandSeed();           /* Reseed emulated random numbers */
+		Main_TurboBootStart();      /* Boot at full speed until a disk is accessed */
+		BootSnapshot_ColdReset();   /* Restore or record the boot snapshot */
 	}
 	CycInt_Reset();               /* Reset interrupts */
 	MFP_Reset();                  /* Setup MFP chip */
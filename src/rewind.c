@@ -0,0 +1,219 @@
+/*
+  Hatari - rewind.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Rewind buffer: the emulation state is captured on every frame as a
+  delta memory snapshot, which stores only the RAM pages changed since
+  its base snapshot (see MemorySnapShot_CaptureDelta()).  A base and the
+  deltas taken against it form a segment.  A new segment is started
+  every REWIND_SEGMENT_FRAMES frames, so that deltas stay small, or
+  earlier if a delta doesn't fit to the scratch buffer.  When all
+  segments are in use, the oldest one is dropped.
+
+  Stepping back restores the latest captured state and drops it.  The
+  last segment is always the one RAM changes are tracked against, as
+  its base is either the last one captured or the one restored from.
+
+  Capture and step are both done at the VBL boundary, where the libretro
+  frontend also saves and loads its states.
+*/
+const char Rewind_fileid[] = "Hatari rewind.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "rewind.h"
+
+typedef struct
+{
+	Uint8 *pBase;				/* base snapshot */
+	Uint8 *pDelta[REWIND_SEGMENT_FRAMES];	/* deltas against it */
+	size_t nDeltaSize[REWIND_SEGMENT_FRAMES];
+	int nDeltas;
+} REWIND_SEGMENT;
+
+static REWIND_SEGMENT *pSegments;	/* ring of segments */
+static int nSegments;			/* ring size, zero when disabled */
+static int nFirst;			/* oldest segment */
+static int nUsed;			/* segments in use */
+static Uint8 *pScratch;			/* deltas are captured here first */
+static size_t nStateSize;		/* size of bases and scratch buffer */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return latest segment, or NULL if there's none.
+ */
+static REWIND_SEGMENT *Rewind_LastSegment(void)
+{
+	if (!nUsed)
+		return NULL;
+	return &pSegments[(nFirst + nUsed - 1) % nSegments];
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free given segment's snapshots.
+ */
+static void Rewind_FreeSegment(REWIND_SEGMENT *pSeg)
+{
+	while (pSeg->nDeltas > 0)
+		free(pSeg->pDelta[--pSeg->nDeltas]);
+	free(pSeg->pBase);
+	pSeg->pBase = NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Drop all captured states.
+ */
+static void Rewind_Clear(void)
+{
+	while (nUsed > 0)
+		Rewind_FreeSegment(&pSegments[(nFirst + --nUsed) % nSegments]);
+	nFirst = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start a new segment with a base snapshot of the current state,
+ * dropping the oldest one if all are in use.
+ * Return the new segment, or NULL on failure.
+ */
+static REWIND_SEGMENT *Rewind_NewSegment(void)
+{
+	REWIND_SEGMENT *pSeg;
+
+	if (nUsed == nSegments)
+	{
+		Rewind_FreeSegment(&pSegments[nFirst]);
+		nFirst = (nFirst + 1) % nSegments;
+		nUsed--;
+	}
+	pSeg = &pSegments[(nFirst + nUsed) % nSegments];
+
+	pSeg->pBase = malloc(nStateSize);
+	if (!pSeg->pBase || !MemorySnapShot_CaptureDeltaBase(pSeg->pBase, nStateSize))
+	{
+		free(pSeg->pBase);
+		pSeg->pBase = NULL;
+		return NULL;
+	}
+	nUsed++;
+	return pSeg;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set rewind buffer length in segments, i.e. in about seconds of
+ * 50 Hz emulation.  Captured states are dropped, zero disables rewind.
+ */
+void Rewind_SetLength(int nLength)
+{
+	Rewind_Clear();
+	free(pSegments);
+	free(pScratch);
+	pSegments = NULL;
+	pScratch = NULL;
+	nStateSize = 0;
+	nSegments = 0;
+
+	if (nLength <= 0)
+		return;
+	pSegments = calloc(nLength, sizeof(*pSegments));
+	if (!pSegments)
+	{
+		Log_Printf(LOG_WARN, "Not enough memory for rewind buffer.\n");
+		return;
+	}
+	nSegments = nLength;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture current emulation state to the rewind buffer.
+ * Called once per frame when rewind is enabled.
+ */
+void Rewind_Capture(void)
+{
+	REWIND_SEGMENT *pSeg;
+	size_t nSize;
+
+	if (!nSegments)
+		return;
+
+	/* snapshot size changes with machine configuration */
+	nSize = MemorySnapShot_MemorySize(true);
+	if (nSize != nStateSize)
+	{
+		Rewind_Clear();
+		free(pScratch);
+		pScratch = malloc(nSize);
+		nStateSize = pScratch ? nSize : 0;
+		if (!pScratch)
+			return;
+	}
+
+	pSeg = Rewind_LastSegment();
+	if (pSeg && pSeg->nDeltas < REWIND_SEGMENT_FRAMES)
+		nSize = MemorySnapShot_CaptureDelta(pScratch, nStateSize);
+	else
+		nSize = 0;
+
+	if (!nSize)
+	{
+		pSeg = Rewind_NewSegment();
+		if (!pSeg)
+			return;
+		nSize = MemorySnapShot_CaptureDelta(pScratch, nStateSize);
+		if (!nSize)
+			return;
+	}
+
+	pSeg->pDelta[pSeg->nDeltas] = malloc(nSize);
+	if (!pSeg->pDelta[pSeg->nDeltas])
+		return;
+	memcpy(pSeg->pDelta[pSeg->nDeltas], pScratch, nSize);
+	pSeg->nDeltaSize[pSeg->nDeltas++] = nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore latest captured emulation state and drop it from the buffer.
+ * Segment whose states are all dropped is kept until the next step,
+ * so that capture can continue against its base.
+ * Return false if there's no state to go back to.
+ */
+bool Rewind_Step(void)
+{
+	REWIND_SEGMENT *pSeg = Rewind_LastSegment();
+	bool bOk;
+	int n;
+
+	if (pSeg && !pSeg->nDeltas)
+	{
+		Rewind_FreeSegment(pSeg);
+		nUsed--;
+		pSeg = Rewind_LastSegment();
+	}
+	if (!pSeg || !pSeg->nDeltas)
+		return false;
+
+	n = --pSeg->nDeltas;
+	bOk = MemorySnapShot_RestoreDelta(pSeg->pBase, nStateSize,
+	                                  pSeg->pDelta[n], pSeg->nDeltaSize[n]);
+	free(pSeg->pDelta[n]);
+
+	/* states can't be continued from a different RAM */
+	if (!bOk)
+		Rewind_Clear();
+	return bOk;
+}
@@ -7,11 +7,11 @@
   RS-232 Communications
 
   This is similar to the printing functions, we open a direct file
-  (e.g. /dev/ttyS0) and send bytes over it.
+  (e.g. /dev/ttyS0) or a TCP endpoint and send bytes over it.
   Using such method mimicks the ST exactly, and even allows us to connect
-  to an actual ST! To wait for incoming data, we create a thread which copies
-  the bytes into an input buffer. This method fits in with the internet code
-  which also reads data into a buffer.
+  to an actual ST! The actual I/O is done by the serial I/O worker thread
+  (see serialIO.c), the emulation only exchanges bytes with its buffers,
+  and checks once per VBL whether new bytes were received.
 */
 const char RS232_fileid[] = "Hatari rs232.c : " __DATE__ " " __TIME__;
 
@@ -21,19 +21,13 @@ const char RS232_fileid[] = "Hatari rs232.c : " __DATE__ " " __TIME__;
 # include <termios.h>
 # include <unistd.h>
 #endif
-#ifdef WIIU
-//no rs323 for now
-#else
-#include <SDL.h>
-#include <SDL_thread.h>
-#include <errno.h>
-#endif
 #include "main.h"
 #include "configuration.h"
 #include "ioMem.h"
 #include "m68000.h"
 #include "mfp.h"
 #include "rs232.h"
+#include "serialIO.h"
 
 
 #define RS232_DEBUG 0
@@ -45,12 +39,8 @@ const char RS232_fileid[] = "Hatari rs232.c : " __DATE__ " " __TIME__;
 #endif
 
 
-static FILE *hComIn = NULL;        /* Handle to file for reading */
-static FILE *hComOut = NULL;       /* Handle to file for writing */
-
-static unsigned char InputBuffer_RS232[MAX_RS232INPUT_BUFFER];
-static int InputBuffer_Head=0, InputBuffer_Tail=0;
-static volatile bool bQuitThread = false;
+static serialio_t *pComDev = NULL;	/* Input and output of the COM port */
+static bool bRcvSignaled = false;	/* Receive interrupt raised for the waiting bytes */
 
 #if HAVE_TERMIOS_H
 
@@ -103,15 +93,13 @@ int cfsetispeed(struct termios *tios,speed_t ispeed)
 /**
  * Set serial line parameters to "raw" mode.
  */
-static bool RS232_SetRawMode(FILE *fhndl)
+static bool RS232_SetRawMode(int fd)
 {
 	struct termios termmode;
-	int fd;
 
 	memset (&termmode, 0, sizeof(termmode));    /* Init with zeroes */
-	fd = fileno(fhndl);                         /* Get file descriptor */
 
-	if (isatty(fd))
+	if (fd >= 0 && isatty(fd))
 	{
 		if (tcgetattr(fd, &termmode) != 0)
 			return false;
@@ -134,15 +122,13 @@ static bool RS232_SetRawMode(FILE *fhndl)
  * - Parity
  * - Start/stop bits
  */
-static bool RS232_SetBitsConfig(FILE *fhndl, int nCharSize, int nStopBits, bool bUseParity, bool bEvenParity)
+static bool RS232_SetBitsConfig(int fd, int nCharSize, int nStopBits, bool bUseParity, bool bEvenParity)
 {
 	struct termios termmode;
-	int fd;
 
 	memset (&termmode, 0, sizeof(termmode));    /* Init with zeroes */
-	fd = fileno(fhndl);
 
-	if (isatty(fd))
+	if (fd >= 0 && isatty(fd))
 	{
 		if (tcgetattr(fd, &termmode) != 0)
 		{
@@ -193,159 +179,62 @@ static bool RS232_SetBitsConfig(FILE *fhndl, int nCharSize, int nStopBits, bool
 
 /*-----------------------------------------------------------------------*/
 /**
- * Open file on COM port.
+ * Open files (or TCP endpoint) on COM port.
  */
 static bool RS232_OpenCOMPort(void)
 {
-	bool ok = true;
+	if (pComDev)
+		return true;
+	if (!ConfigureParams.RS232.szInFileName[0] && !ConfigureParams.RS232.szOutFileName[0])
+		return true;
 
-	if (!hComOut && ConfigureParams.RS232.szOutFileName[0])
+	pComDev = SerialIO_Open(ConfigureParams.RS232.szInFileName,
+	                        ConfigureParams.RS232.szOutFileName, false);
+	if (!pComDev)
 	{
-		/* Create our COM file for output */
-		hComOut = fopen(ConfigureParams.RS232.szOutFileName, "wb");
-		if (hComOut)
-		{
-			setvbuf(hComOut, NULL, _IONBF, 0);
-#if HAVE_TERMIOS_H
-			/* First set the output parameters to "raw" mode */
-			if (!RS232_SetRawMode(hComOut))
-			{
-				Log_Printf(LOG_WARN, "Can't set raw mode for %s\n",
-					   ConfigureParams.RS232.szOutFileName);
-			}
-#endif
-			Dprintf(("Successfully opened RS232 output file.\n"));
-		}
-		else
-		{
-			Log_Printf(LOG_WARN, "RS232: Failed to open output file %s\n",
-				   ConfigureParams.RS232.szOutFileName);
-			ok = false;
-		}
+		Log_Printf(LOG_WARN, "RS232: Failed to open input '%s' / output '%s'\n",
+			   ConfigureParams.RS232.szInFileName,
+			   ConfigureParams.RS232.szOutFileName);
+		return false;
 	}
+	bRcvSignaled = false;
 
-	if (!hComIn && ConfigureParams.RS232.szInFileName[0])
-	{
-		/* Create our COM file for input */
-		hComIn = fopen(ConfigureParams.RS232.szInFileName, "rb");
-		if (hComIn)
-		{
-			setvbuf(hComIn, NULL, _IONBF, 0);
 #if HAVE_TERMIOS_H
-			/* Now set the input parameters to "raw" mode */
-			if (!RS232_SetRawMode(hComIn))
-			{
-				Log_Printf(LOG_WARN, "Can't set raw mode for %s\n",
-					   ConfigureParams.RS232.szInFileName);
-			}
-#endif
-			Dprintf(("Successfully opened RS232 input file.\n"));
-		}
-		else
-		{
-			Log_Printf(LOG_WARN, "RS232: Failed to open input file %s\n",
-				   ConfigureParams.RS232.szInFileName);
-			ok = false;
-		}
-	}
-	return ok;
-}
-
-
-/*-----------------------------------------------------------------------*/
-/**
- * Close file on COM port
- */
-static void RS232_CloseCOMPort(void)
-{
-	if (hComIn)
-	{
-		/* Close */
-		fclose(hComIn);
-		hComIn = NULL;
-	}
-	if (hComOut)
+	/* Set the input and output parameters to "raw" mode */
+	if (!RS232_SetRawMode(SerialIO_GetFd(pComDev, true)))
 	{
-		fclose(hComOut);
-		hComOut = NULL;
+		Log_Printf(LOG_WARN, "Can't set raw mode for %s\n",
+			   ConfigureParams.RS232.szOutFileName);
 	}
-	Dprintf(("Closed RS232 files.\n"));
-}
-
-#ifndef WIIU
-/* thread stuff */
-static SDL_sem* pSemFreeBuf;       /* Semaphore to sync free space in InputBuffer_RS232 */
-static SDL_Thread *RS232Thread = NULL; /* Thread handle for reading incoming data */
-#endif
-
-/*-----------------------------------------------------------------------*/
-/**
- * Add incoming bytes from other machine into our input buffer
- */
-static void RS232_AddBytesToInputBuffer(unsigned char *pBytes, int nBytes)
-{
-	int i;
-#ifndef WIIU
-	/* Copy bytes into input buffer */
-	for (i=0; i<nBytes; i++)
+	if (!RS232_SetRawMode(SerialIO_GetFd(pComDev, false)))
 	{
-		SDL_SemWait(pSemFreeBuf);    /* Wait for free space in buffer */
-		InputBuffer_RS232[InputBuffer_Tail] = *pBytes++;
-		InputBuffer_Tail = (InputBuffer_Tail+1) % MAX_RS232INPUT_BUFFER;
+		Log_Printf(LOG_WARN, "Can't set raw mode for %s\n",
+			   ConfigureParams.RS232.szInFileName);
 	}
 #endif
+	Dprintf(("Successfully opened RS232 files.\n"));
+	return true;
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Thread to read incoming RS-232 data, and pass to emulator input buffer
+ * Close file on COM port
  */
-static int RS232_ThreadFunc(void *pData)
+static void RS232_CloseCOMPort(void)
 {
-	int iInChar;
-	unsigned char cInChar;
-#ifndef WIIU
-	/* Check for any RS-232 incoming data */
-	while (!bQuitThread)
+	if (pComDev)
 	{
-		if (hComIn)
-		{
-			/* Read the bytes in, if we have any */
-			iInChar = fgetc(hComIn);
-			if (iInChar != EOF)
-			{
-				/* Copy into our internal queue */
-				cInChar = iInChar;
-				RS232_AddBytesToInputBuffer(&cInChar, 1);
-				/* FIXME: Use semaphores to lock MFP variables? */
-				MFP_InputOnChannel ( MFP_INT_RCV_BUF_FULL , 0 );
-				Dprintf(("RS232: Read character $%x\n", iInChar));
-				/* Sleep for a while */
-				SDL_Delay(2);
-			}
-			else
-			{
-				/*Dprintf(("RS232: Reached end of input file!\n"));*/
-				/* potential data race on hComIn modification */
-				clearerr(hComIn);
-				SDL_Delay(20);
-			}
-		}
-		else
-		{
-			/* No RS-232 connection, sleep for 0.2s */
-			SDL_Delay(200);
-		}
+		SerialIO_Close(pComDev);
+		pComDev = NULL;
 	}
-#endif
-	return true;
+	Dprintf(("Closed RS232 files.\n"));
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Initialize RS-232, start thread to wait for incoming data
+ * Initialize RS-232
  * (we will open a connection when first bytes are sent even
  *  if RS-232 isn't initialized for reading).
  */
@@ -362,30 +251,6 @@ void RS232_Init(void)
 			return;
 		}
 	}
-	if (hComIn)
-	{
-		/* Create semaphore */
-		if (pSemFreeBuf == NULL)
-			pSemFreeBuf = SDL_CreateSemaphore(MAX_RS232INPUT_BUFFER);
-		if (pSemFreeBuf == NULL)
-		{
-			RS232_CloseCOMPort();
-			Log_Printf(LOG_WARN, "RS232_Init: Can't create semaphore!\n");
-			return;
-		}
-
-		/* Create thread to wait for incoming bytes over RS-232 */
-		if (!RS232Thread)
-		{
-			bQuitThread = false;
-#if WITH_SDL2
-			RS232Thread = SDL_CreateThread(RS232_ThreadFunc, "rs232", NULL);
-#else
-			RS232Thread = SDL_CreateThread(RS232_ThreadFunc, NULL);
-#endif
-			Dprintf(("RS232 thread has been created.\n"));
-		}
-	}
 #else
 	ConfigureParams.RS232.bEnableRS232 = false;
 	return;
@@ -399,31 +264,22 @@ void RS232_Init(void)
  */
 void RS232_UnInit(void)
 {
-#ifndef WIIU
-	/* Close, kill thread and free resource */
-	if (RS232Thread)
-	{
-		/* Instead of killing the thread directly, we should
-		 * probably better inform it via IPC so that it can
-		 * terminate gracefully... but then we would need to
-		 * wait until it exits, otherwise there's a data race
-		 * on accessing/modifying hComIn.
-		 */
-		Dprintf(("Killing RS232 thread...\n"));
-		bQuitThread = true;
-#if !WITH_SDL2
-		SDL_KillThread(RS232Thread);
-#endif
-		RS232Thread = NULL;
-	}
 	RS232_CloseCOMPort();
+}
+
 
-	if (pSemFreeBuf)
+/*-----------------------------------------------------------------------*/
+/**
+ * Called once per VBL: raise the receive interrupt when bytes
+ * from the other machine arrived in the input buffer.
+ */
+void RS232_Update(void)
+{
+	if (!bRcvSignaled && RS232_GetStatus())
 	{
-		SDL_DestroySemaphore(pSemFreeBuf);
-		pSemFreeBuf = NULL;
+		bRcvSignaled = true;
+		MFP_InputOnChannel ( MFP_INT_RCV_BUF_FULL , 0 );
 	}
-#endif
 }
 
 
@@ -459,15 +315,11 @@ void RS232_HandleUCR(Sint16 ucr)
 	Dprintf(("RS232_HandleUCR(%i) : character size=%i , stop bits=%i\n",
 	         ucr, nCharSize, nStopBits));
 
-	if (hComOut != NULL)
+	if (pComDev != NULL)
 	{
-		if (!RS232_SetBitsConfig(hComOut, nCharSize, nStopBits, ucr&4, ucr&2))
+		if (!RS232_SetBitsConfig(SerialIO_GetFd(pComDev, true), nCharSize, nStopBits, ucr&4, ucr&2))
 			Log_Printf(LOG_WARN, "RS232_HandleUCR: failed to set bits configuration for %s\n", ConfigureParams.RS232.szOutFileName);
-	}
-
-	if (hComIn != NULL)
-	{
-		if (!RS232_SetBitsConfig(hComIn, nCharSize, nStopBits, ucr&4, ucr&2))
+		if (!RS232_SetBitsConfig(SerialIO_GetFd(pComDev, false), nCharSize, nStopBits, ucr&4, ucr&2))
 			Log_Printf(LOG_WARN, "RS232_HandleUCR: failed to set bits configuration for %s\n", ConfigureParams.RS232.szInFileName);
 	}
 #endif /* HAVE_TERMIOS_H */
@@ -530,10 +382,10 @@ bool RS232_SetBaudRate(int nBaud)
 	}
 
 	/* Set ouput speed: */
-	if (hComOut != NULL)
+	fd = pComDev ? SerialIO_GetFd(pComDev, true) : -1;
+	if (fd >= 0)
 	{
 		memset (&termmode, 0, sizeof(termmode));    /* Init with zeroes */
-		fd = fileno(hComOut);
 		if (isatty(fd))
 		{
 			if (tcgetattr(fd, &termmode) != 0)
@@ -547,10 +399,10 @@ bool RS232_SetBaudRate(int nBaud)
 	}
 
 	/* Set input speed: */
-	if (hComIn != NULL)
+	fd = pComDev ? SerialIO_GetFd(pComDev, false) : -1;
+	if (fd >= 0)
 	{
 		memset (&termmode, 0, sizeof(termmode));    /* Init with zeroes */
-		fd = fileno(hComIn);
 		if (isatty(fd))
 		{
 			if (tcgetattr(fd, &termmode) != 0)
@@ -641,10 +493,10 @@ bool RS232_TransferBytesTo(Uint8 *pBytes, int nBytes)
 		RS232_OpenCOMPort();
 
 	/* Have we connected to the RS232? */
-	if (hComOut)
+	if (pComDev)
 	{
-		/* Send bytes directly to the COM file */
-		if (fwrite(pBytes, 1, nBytes, hComOut))
+		/* Queue bytes for the COM file, dropped if it can't keep up */
+		if (SerialIO_Write(pComDev, pBytes, nBytes))
 		{
 			Dprintf(("RS232: Sent %i bytes ($%x ...)\n", nBytes, *pBytes));
 			MFP_InputOnChannel ( MFP_INT_TRN_BUF_EMPTY , 0 );
@@ -663,21 +515,13 @@ bool RS232_TransferBytesTo(Uint8 *pBytes, int nBytes)
  */
 bool RS232_ReadBytes(Uint8 *pBytes, int nBytes)
 {
-	int i;
-#ifndef WIIU
 	/* Connected? */
-	if (hComIn && InputBuffer_Head != InputBuffer_Tail)
+	if (pComDev && SerialIO_Available(pComDev) >= nBytes)
 	{
 		/* Read bytes out of input buffer */
-		for (i=0; i<nBytes; i++)
-		{
-			*pBytes++ = InputBuffer_RS232[InputBuffer_Head];
-			InputBuffer_Head = (InputBuffer_Head+1) % MAX_RS232INPUT_BUFFER;
-			SDL_SemPost(pSemFreeBuf);    /* Signal free space */
-		}
+		SerialIO_Read(pComDev, pBytes, nBytes);
 		return true;
 	}
-#endif
 	return false;
 }
 
@@ -688,15 +532,10 @@ bool RS232_ReadBytes(Uint8 *pBytes, int nBytes)
  */
 bool RS232_GetStatus(void)
 {
-#ifndef WIIU
-	/* Connected? */
-	if (hComIn)
-	{
-		/* Do we have bytes in the input buffer? */
-		if (InputBuffer_Head != InputBuffer_Tail)
-			return true;
-	}
-#endif
+	/* Connected, and do we have bytes in the input buffer? */
+	if (pComDev && SerialIO_Available(pComDev) > 0)
+		return true;
+
 	/* No, none */
 	return false;
 }
@@ -825,6 +664,8 @@ void RS232_UDR_ReadByte(void)
 		/* Yes, generate another interrupt. */
 		MFP_InputOnChannel ( MFP_INT_RCV_BUF_FULL , 0 );
 	}
+	else
+		bRcvSignaled = false;
 }
 
 /*-----------------------------------------------------------------------*/
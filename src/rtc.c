@@ -19,6 +19,7 @@ const char Rtc_fileid[] = "Hatari rtc.c : " __DATE__ " " __TIME__;
 #include "main.h"
 #include "ioMem.h"
 #include "rtc.h"
+#include "utils.h"
 
 
 static bool rtc_bank;           /* RTC bank select (0=normal, 1=configuration(?)) */
@@ -35,8 +36,8 @@ void Rtc_SecondsUnits_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc21] = SystemTime->tm_sec % 10;
 }
 
@@ -51,8 +52,8 @@ void Rtc_SecondsTens_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc23] = SystemTime->tm_sec / 10;
 }
 
@@ -73,8 +74,8 @@ void Rtc_MinutesUnits_ReadByte(void)
 		time_t nTimeTicks;
 
 		/* Get system time */
-		nTimeTicks = time(NULL);
-		SystemTime = localtime(&nTimeTicks);
+		nTimeTicks = Utils_Time();
+		SystemTime = Utils_LocalTime(&nTimeTicks);
 		IoMem[0xfffc25] = SystemTime->tm_min % 10;
 	}
 }
@@ -109,8 +110,8 @@ void Rtc_MinutesTens_ReadByte(void)
 		time_t nTimeTicks;
 
 		/* Get system time */
-		nTimeTicks = time(NULL);
-		SystemTime = localtime(&nTimeTicks);
+		nTimeTicks = Utils_Time();
+		SystemTime = Utils_LocalTime(&nTimeTicks);
 		IoMem[0xfffc27] = SystemTime->tm_min / 10;
 	}
 }
@@ -139,8 +140,8 @@ void Rtc_HoursUnits_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc29] = SystemTime->tm_hour % 10;
 }
 
@@ -155,8 +156,8 @@ void Rtc_HoursTens_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc2b] = SystemTime->tm_hour / 10;
 }
 
@@ -171,8 +172,8 @@ void Rtc_Weekday_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc2d] = SystemTime->tm_wday;
 }
 
@@ -187,8 +188,8 @@ void Rtc_DayUnits_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc2f] = SystemTime->tm_mday % 10;
 }
 
@@ -203,8 +204,8 @@ void Rtc_DayTens_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc31] = SystemTime->tm_mday / 10;
 }
 
@@ -219,8 +220,8 @@ void Rtc_MonthUnits_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc33] = (SystemTime->tm_mon + 1) % 10;
 }
 
@@ -235,8 +236,8 @@ void Rtc_MonthTens_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc35] = (SystemTime->tm_mon + 1) / 10;
 }
 
@@ -251,8 +252,8 @@ void Rtc_YearUnits_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc37] = SystemTime->tm_year % 10;
 }
 
@@ -267,8 +268,8 @@ void Rtc_YearTens_ReadByte(void)
 	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	nTimeTicks = Utils_Time();
+	SystemTime = Utils_LocalTime(&nTimeTicks);
 	IoMem[0xfffc39] = (SystemTime->tm_year - 80) / 10;
 }
 
@@ -26,6 +26,7 @@
 
 const char Screen_fileid[] = "Hatari screen.c : " __DATE__ " " __TIME__;
 
+#include <inttypes.h>
 #include <SDL.h>
 #include <SDL_endian.h>
 
@@ -48,6 +49,10 @@ const char Screen_fileid[] = "Hatari screen.c : " __DATE__ " " __TIME__;
 #include "falcon/videl.h"
 #include "falcon/hostscreen.h"
 
+#if ENABLE_CONVERT_THREAD
+#include <rthreads/rthreads.h>
+#endif
+
 #define DEBUG 0
 
 #if DEBUG
@@ -77,6 +82,7 @@ Uint8 *pSTScreen;
 FRAMEBUFFER *pFrameBuffer;    /* Pointer into current 'FrameBuffer' */
 
 static FRAMEBUFFER FrameBuffers[NUM_FRAMEBUFFERS]; /* Store frame buffer details to tell how to update */
+static Uint8 *pSTScreenSrc;                        /* ST screen data to convert */
 static Uint8 *pSTScreenCopy;                       /* Keep track of current and previous ST screen data */
 static Uint8 *pPCScreenDest;                       /* Destination PC buffer */
 static int STScreenEndHorizLine;                   /* End lines to be converted */
@@ -85,9 +91,13 @@ static int STScreenWidthBytes;
 static int PCScreenOffsetX;                        /* how many pixels to skip from left when drawing */
 static int PCScreenOffsetY;                        /* how many pixels to skip from top when drawing */
 static SDL_Rect STScreenRect;                      /* screen size without statusbar */
+static SDL_Rect STDirtyRect;                       /* part of it changed in this frame */
 
 static int STScreenLineOffset[NUM_VISIBLE_LINES];  /* Offsets for ST screen lines eg, 0,160,320... */
 static Uint16 HBLPalette[16], PrevHBLPalette[16];  /* Current palette for line, also copy of first line */
+static Uint64 LineHashes[NUM_VISIBLE_LINES];       /* Line contents hashes of previously drawn frame */
+static Uint16 *pConvPalettes;                      /* Line palettes for conversion, 16 per line */
+static Uint32 *pConvPaletteMasks;                  /* Line palette/resolution masks for conversion */
 
 static void (*ScreenDrawFunctionsNormal[3])(void); /* Screen draw functions */
 static void (*ScreenDrawFunctionsVDI[3])(void) =
@@ -100,9 +110,42 @@ static void (*ScreenDrawFunctionsVDI[3])(void) =
 static bool bScreenContentsChanged;     /* true if buffer changed and requires blitting */
 static bool bScrDoubleY;                /* true if double on Y */
 static int ScrUpdateFlag;               /* Bit mask of how to update screen */
+static bool bScreenUpdated = true;      /* true if host screen was updated since Screen_CheckUpdated() */
+
+/* frame prepared for conversion by Screen_PrepareFrame() */
+static void (*pConvertFunction)(void);  /* conversion routine for it */
+static bool bConvertFullUpdate;         /* true if all lines need converting */
+static bool bConvertClear;              /* true if screen needs clearing first */
+static bool bConvertLines;              /* true if lines can be converted as they change */
+static bool bConvertVDILines;           /* true if VDI screen changes are tracked by NF_VDI */
+static int VDIConvertFirst, VDIConvertLast;  /* VDI screen lines changed in the frame */
+static bool bPrevFrameWasSpec512;
+
+#if ENABLE_CONVERT_THREAD
+enum {
+	CONVERT_IDLE,           /* no frame waiting for the thread */
+	CONVERT_PENDING,        /* snapshotted frame waiting for Screen_ConvertThread() */
+	CONVERT_RUNNING,        /* thread converting the snapshotted frame */
+	CONVERT_DONE            /* converted frame waiting for Screen_ConvertWait() */
+};
+static sthread_t *ConvertThread;
+static slock_t *ConvertLock;
+static scond_t *ConvertCond;
+static int nConvertState = CONVERT_IDLE;
+static bool bConvertQuit;
+static bool bConvertThreaded;           /* true if frames are converted in the thread */
+static bool bConvertSnapshot;           /* true if converting from below snapshot */
+static bool bConvertLocked;             /* true if thread could lock the screen */
+static Uint8 *pSTScreenSnapshot;        /* ST screen lines of snapshotted frame */
+static Uint32 SnapshotPaletteMasks[HBL_PALETTE_MASKS];
+#endif
 
 
 static bool Screen_DrawFrame(bool bForceFlip);
+static void (*Screen_ConvertVariant(void (*pFunc)(void)))(void);
+#if ENABLE_CONVERT_THREAD
+static void Screen_ConvertThreadStop(void);
+#endif
 
 #if WITH_SDL2
 
@@ -577,6 +620,9 @@ static void Screen_SetResolution(void)
 	int Width, Height, nZoom, SBarHeight, BitCount, maxW, maxH;
 	bool bDoubleLowRes = false;
 
+	/* Host screen can't change under the conversion thread */
+	Screen_ConvertWait();
+
 	/* Bits per pixel */
 	if (STRes == ST_HIGH_RES || bUseVDIRes)
 	{
@@ -620,7 +666,7 @@ static void Screen_SetResolution(void)
 		Resolution_GetLimits(&maxW, &maxH, &BitCount, ConfigureParams.Screen.bKeepResolutionST);
 		
 		/* Zoom if necessary, factors used for scaling mouse motions */
-		if (STRes == ST_LOW_RES &&
+		if (STRes == ST_LOW_RES && !ConfigureParams.Screen.bNativeRes &&
 		    2*Width <= maxW && 2*Height+SBarHeight <= maxH)
 		{
 			nZoom = 2;
@@ -728,6 +774,15 @@ void Screen_Init(void)
 		}
 	}
 	pFrameBuffer = &FrameBuffers[0];
+#if ENABLE_CONVERT_THREAD
+	/* swapped with above copy buffers when converting in the thread */
+	pSTScreenSnapshot = malloc(MAX_VDI_BYTES);
+	if (!pSTScreenSnapshot)
+	{
+		fprintf(stderr, "Failed to allocate frame buffer memory.\n");
+		exit(-1);
+	}
+#endif
 #ifndef __LIBRETRO__
 	/* Load and set icon */
 	snprintf(sIconFileName, sizeof(sIconFileName), "%s%chatari-icon.bmp",
@@ -767,6 +822,10 @@ void Screen_UnInit(void)
 {
 	int i;
 
+#if ENABLE_CONVERT_THREAD
+	Screen_ConvertThreadStop();
+	free(pSTScreenSnapshot);
+#endif
 	/* Free memory used for copies */
 	for (i = 0; i < NUM_FRAMEBUFFERS; i++)
 	{
@@ -821,6 +880,46 @@ void Screen_SetFullUpdate(void)
 	/* Update frame buffers */
 	for (i = 0; i < NUM_FRAMEBUFFERS; i++)
 		FrameBuffers[i].bFullUpdate = true;
+	bScreenUpdated = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if full screen update was requested since previous call,
+ * for (Falcon/TT) host screen rendering which doesn't use frame buffers
+ * for anything else.
+ */
+bool Screen_CheckFullUpdate(void)
+{
+	bool bFullUpdate = pFrameBuffer->bFullUpdate;
+
+	pFrameBuffer->bFullUpdate = false;
+	return bFullUpdate;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Tell that host screen surface contents have been updated
+ */
+void Screen_SetUpdated(void)
+{
+	bScreenUpdated = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if host screen surface contents were updated since
+ * previous call, so that unchanged frames don't need to be shown again.
+ */
+bool Screen_CheckUpdated(void)
+{
+	bool bUpdated = bScreenUpdated;
+
+	bScreenUpdated = false;
+	return bUpdated;
 }
 
 
@@ -1176,8 +1275,16 @@ static void Screen_SetFullUpdateMask(void)
  */
 static void Screen_SetConvertDetails(void)
 {
-	pSTScreen = pFrameBuffer->pSTScreen;          /* Source in ST memory */
+	pSTScreenSrc = pFrameBuffer->pSTScreen;       /* Source in ST memory */
 	pSTScreenCopy = pFrameBuffer->pSTScreenCopy;  /* Previous ST screen */
+	pConvPaletteMasks = HBLPaletteMasks;          /* HBL masks pointer */
+#if ENABLE_CONVERT_THREAD
+	if (bConvertSnapshot)
+	{
+		pSTScreenSrc = pSTScreenSnapshot;
+		pConvPaletteMasks = SnapshotPaletteMasks;
+	}
+#endif
 	pPCScreenDest = sdlscrn->pixels;              /* Destination PC screen */
 
 	PCScreenBytesPerLine = sdlscrn->pitch;        /* Bytes per line */
@@ -1185,7 +1292,7 @@ static void Screen_SetConvertDetails(void)
 	/* Center to available framebuffer */
 	pPCScreenDest += PCScreenOffsetY * PCScreenBytesPerLine + PCScreenOffsetX * (sdlscrn->format->BitsPerPixel/8);
 
-	pHBLPalettes = pFrameBuffer->HBLPalettes;     /* HBL palettes pointer */
+	pConvPalettes = pFrameBuffer->HBLPalettes;    /* HBL palettes pointer */
 	/* Not in TV-Mode? Then double up on Y: */
 	bScrDoubleY = !(ConfigureParams.Screen.nMonitorType == MONITOR_TYPE_TV);
 
@@ -1283,17 +1390,28 @@ static void Screen_Blit(SDL_Rect *sbar_rect)
 	{
 		int count = 1;
 		SDL_Rect rects[2];
-		rects[0] = STScreenRect;
+		rects[0] = STDirtyRect;
 		if (sbar_rect)
 		{
 			rects[1] = *sbar_rect;
 			count = 2;
 		}
-		SDL_UpdateRects(sdlscrn, count, rects);
+		if (!bBenchmarkMode)
+			SDL_UpdateRects(sdlscrn, count, rects);
 	}
+	bScreenUpdated = true;
 
 	/* Swap copy/raster buffers in screen. */
 	pTmpScreen = pFrameBuffer->pSTScreenCopy;
+#if ENABLE_CONVERT_THREAD
+	if (bConvertSnapshot)
+	{
+		/* emulation is already filling the raster buffer */
+		pFrameBuffer->pSTScreenCopy = pSTScreenSnapshot;
+		pSTScreenSnapshot = pTmpScreen;
+		return;
+	}
+#endif
 	pFrameBuffer->pSTScreenCopy = pFrameBuffer->pSTScreen;
 	pFrameBuffer->pSTScreen = pTmpScreen;
 }
@@ -1301,16 +1419,96 @@ static void Screen_Blit(SDL_Rect *sbar_rect)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Draw ST screen to window/full-screen framebuffer
- * @param  bForceFlip  Force screen update, even if contents did not change
- * @return  true if screen contents changed
+ * Return hash of the ST screen data, palette and resolution of line 'y',
+ * i.e. of everything its conversion depends on.
  */
-static bool Screen_DrawFrame(bool bForceFlip)
+static Uint64 Screen_LineHash(int y)
+{
+	const Uint32 *pLine = (const Uint32 *)(pSTScreenSrc + STScreenLineOffset[y]);
+	const Uint16 *pPal = pConvPalettes + (y<<4);
+	Uint64 hash = 0xcbf29ce484222325ULL ^ ((pConvPaletteMasks[y]>>16) & ST_RES_MASK);
+	int i;
+
+	for (i = 0; i < 16; i++)
+		hash = (hash ^ pPal[i]) * 0x100000001b3ULL;
+	for (i = 0; i < SCREENBYTES_LINE/4; i++)
+		hash = (hash ^ pLine[i]) * 0x100000001b3ULL;
+	return hash;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compare line hashes with the previously drawn frame and limit the lines
+ * to be converted to the changed ones (unless 'bFullUpdate' is set), and
+ * 'STDirtyRect' to the host screen area they cover.
+ * Return false if there's nothing to convert.
+ */
+static bool Screen_SetDirtyLines(bool bFullUpdate)
+{
+	int y, first = -1, last = -1;
+	Uint64 hash;
+
+	for (y = STScreenStartHorizLine; y < STScreenEndHorizLine; y++)
+	{
+		hash = Screen_LineHash(y);
+		if (hash != LineHashes[y])
+		{
+			LineHashes[y] = hash;
+			if (first < 0)
+				first = y;
+			last = y;
+		}
+	}
+	if (bFullUpdate)
+		return true;
+	if (first < 0)
+		return false;
+
+	/* converters advance nScreenZoomY host lines per ST line */
+	y = (first - STScreenStartHorizLine) * nScreenZoomY;
+	pPCScreenDest += y * PCScreenBytesPerLine;
+	STDirtyRect.y = PCScreenOffsetY + y;
+	STDirtyRect.h = (last + 1 - first) * nScreenZoomY;
+	STScreenStartHorizLine = first;
+	STScreenEndHorizLine = last + 1;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Limit the VDI screen lines to be converted to the ones reported changed
+ * by the NF_VDI driver (unless 'bFullUpdate' is set), and 'STDirtyRect'
+ * to the host screen area they cover.
+ * Return false if there's nothing to convert.
+ */
+static bool Screen_SetVDIDirtyLines(bool bFullUpdate)
+{
+	if (bFullUpdate)
+		return true;
+	if (VDIConvertFirst > VDIConvertLast)
+		return false;
+
+	pPCScreenDest += VDIConvertFirst * PCScreenBytesPerLine;
+	STDirtyRect.y = PCScreenOffsetY + VDIConvertFirst;
+	STDirtyRect.h = VDIConvertLast + 1 - VDIConvertFirst;
+	STScreenStartHorizLine = VDIConvertFirst;
+	STScreenEndHorizLine = VDIConvertLast + 1;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Scan palette/resolution masks of the emulated frame, handle resolution
+ * changes and select the conversion routine for it.  After this, the frame
+ * conversion (Screen_ConvertFrame()) doesn't use the emulation side state
+ * except for the ST screen lines, palettes and masks.
+ */
+static void Screen_PrepareFrame(void)
 {
 	int new_res;
-	void (*pDrawFunction)(void);
-	static bool bPrevFrameWasSpec512 = false;
-	SDL_Rect *sbar_rect;
 
 	/* Scan palette/resolution masks for each line and build up palette/difference tables */
 	new_res = Screen_ComparePaletteMask(STRes);
@@ -1319,13 +1517,70 @@ static bool Screen_DrawFrame(bool bForceFlip)
 	/* Did we change resolution this frame - allocate new screen if did so */
 	Screen_DidResolutionChange(new_res);
 	/* Is need full-update, tag as such */
-	if (pFrameBuffer->bFullUpdate)
+	bConvertClear = bConvertFullUpdate = pFrameBuffer->bFullUpdate;
+	if (bConvertFullUpdate)
 		Screen_SetFullUpdateMask();
+	bConvertLines = false;
 
-	/* restore area potentially left under overlay led
-	 * and saved by Statusbar_OverlayBackup()
-	 */
-	Statusbar_OverlayRestore(sdlscrn);
+	/* Select drawing for full-screen */
+	if (bUseVDIRes)
+	{
+		pConvertFunction = ScreenDrawFunctionsVDI[VDIRes];
+		bConvertVDILines = VDI_GetDirtyLines(&VDIConvertFirst, &VDIConvertLast);
+	}
+	else
+	{
+		pConvertFunction = ScreenDrawFunctionsNormal[STRes];
+		/* Check if is Spec512 image */
+		if (Spec512_IsImage())
+		{
+			bPrevFrameWasSpec512 = true;
+			/* What mode were we in? Keep to 320xH or 640xH */
+			if (pConvertFunction==ConvertLowRes_320x16Bit)
+				pConvertFunction = ConvertLowRes_320x16Bit_Spec;
+			else if (pConvertFunction==ConvertLowRes_640x16Bit)
+				pConvertFunction = ConvertLowRes_640x16Bit_Spec;
+			else if (pConvertFunction==ConvertLowRes_320x32Bit)
+				pConvertFunction = ConvertLowRes_320x32Bit_Spec;
+			else if (pConvertFunction==ConvertLowRes_640x32Bit)
+				pConvertFunction = ConvertLowRes_640x32Bit_Spec;
+			else if (pConvertFunction==ConvertMediumRes_640x32Bit)
+				pConvertFunction = ConvertMediumRes_640x32Bit_Spec;
+			else if (pConvertFunction==ConvertMediumRes_640x16Bit)
+				pConvertFunction = ConvertMediumRes_640x16Bit_Spec;
+		}
+		else if (bPrevFrameWasSpec512)
+		{
+			/* If we switch back from Spec512 mode to normal
+			 * screen rendering, we have to make sure to do
+			 * a full update of the screen. */
+			Screen_SetFullUpdateMask();
+			bPrevFrameWasSpec512 = false;
+			bConvertClear = bConvertFullUpdate = true;
+		}
+		/* Convert only changed lines, except with Spec512 which
+		 * tracks its palettes over the whole frame, and in mono
+		 * where conversion does not use the line offsets
+		 */
+		bConvertLines = !bPrevFrameWasSpec512 && !bUseHighRes;
+	}
+
+	/* Clear flags, remember type of overscan as if change need screen full update */
+	pFrameBuffer->bFullUpdate = false;
+	pFrameBuffer->OverscanModeCopy = OverscanMode;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert lines of frame prepared by Screen_PrepareFrame() to window/
+ * full-screen framebuffer.  This doesn't touch the statusbar, so it can
+ * run in the conversion thread.
+ * @return  false if screen couldn't be locked
+ */
+static bool Screen_ConvertLines(void)
+{
+	void (*pDrawFunction)(void) = pConvertFunction;
 
 	/* Lock screen for direct screen surface format writes */
 	if (Screen_Lock())
@@ -1334,71 +1589,261 @@ static bool Screen_DrawFrame(bool bForceFlip)
 
 		/* Set details */
 		Screen_SetConvertDetails();
+		pDrawFunction = Screen_ConvertVariant(pDrawFunction);
+		STDirtyRect = STScreenRect;
 		
 		/* Clear screen on full update to clear out borders and also interleaved lines */
-		if (pFrameBuffer->bFullUpdate && !bUseVDIRes)
+		if (bConvertClear && !bUseVDIRes)
 			Screen_ClearScreen();
-		
-		/* Call drawing for full-screen */
-		if (bUseVDIRes)
-		{
-			pDrawFunction = ScreenDrawFunctionsVDI[VDIRes];
-		}
-		else
-		{
-			pDrawFunction = ScreenDrawFunctionsNormal[STRes];
-			/* Check if is Spec512 image */
-			if (Spec512_IsImage())
-			{
-				bPrevFrameWasSpec512 = true;
-				/* What mode were we in? Keep to 320xH or 640xH */
-				if (pDrawFunction==ConvertLowRes_320x16Bit)
-					pDrawFunction = ConvertLowRes_320x16Bit_Spec;
-				else if (pDrawFunction==ConvertLowRes_640x16Bit)
-					pDrawFunction = ConvertLowRes_640x16Bit_Spec;
-				else if (pDrawFunction==ConvertLowRes_320x32Bit)
-					pDrawFunction = ConvertLowRes_320x32Bit_Spec;
-				else if (pDrawFunction==ConvertLowRes_640x32Bit)
-					pDrawFunction = ConvertLowRes_640x32Bit_Spec;
-				else if (pDrawFunction==ConvertMediumRes_640x32Bit)
-					pDrawFunction = ConvertMediumRes_640x32Bit_Spec;
-				else if (pDrawFunction==ConvertMediumRes_640x16Bit)
-					pDrawFunction = ConvertMediumRes_640x16Bit_Spec;
-			}
-			else if (bPrevFrameWasSpec512)
-			{
-				/* If we switch back from Spec512 mode to normal
-				 * screen rendering, we have to make sure to do
-				 * a full update of the screen. */
-				Screen_SetFullUpdateMask();
-				bPrevFrameWasSpec512 = false;
-			}
-		}
+
+		if (pDrawFunction && bConvertLines && !Screen_SetDirtyLines(bConvertFullUpdate))
+			pDrawFunction = NULL;
+		else if (pDrawFunction && bUseVDIRes && bConvertVDILines
+		         && !Screen_SetVDIDirtyLines(bConvertFullUpdate))
+			pDrawFunction = NULL;
 
 		if (pDrawFunction)
 			CALL_VAR(pDrawFunction);
 
 		/* Unlock screen */
 		Screen_UnLock();
+		return true;
+	}
 
-		/* draw overlay led(s) or statusbar after unlock */
-		Statusbar_OverlayBackup(sdlscrn);
-		sbar_rect = Statusbar_Update(sdlscrn, false);
-		
-		/* Clear flags, remember type of overscan as if change need screen full update */
-		pFrameBuffer->bFullUpdate = false;
-		pFrameBuffer->OverscanModeCopy = OverscanMode;
+	/* try again on next frame */
+	pFrameBuffer->bFullUpdate |= bConvertClear;
+	return false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Draw overlay led(s) or statusbar on converted frame and show it to user.
+ * Statusbar state belongs to the emulation, so this is never called
+ * from the conversion thread.
+ * @param  bForceFlip  Force screen update, even if contents did not change
+ * @return  true if screen contents changed
+ */
+static bool Screen_ShowFrame(bool bForceFlip)
+{
+	SDL_Rect *sbar_rect;
+
+	/* draw overlay led(s) or statusbar after unlock */
+	Statusbar_OverlayBackup(sdlscrn);
+	sbar_rect = Statusbar_Update(sdlscrn, false);
+
+	/* And show to user */
+	if (bScreenContentsChanged || bForceFlip || sbar_rect)
+	{
+		Screen_Blit(sbar_rect);
+	}
+
+	return bScreenContentsChanged;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert frame prepared by Screen_PrepareFrame() to window/full-screen
+ * framebuffer
+ * @param  bForceFlip  Force screen update, even if contents did not change
+ * @return  true if screen contents changed
+ */
+static bool Screen_ConvertFrame(bool bForceFlip)
+{
+	/* restore area potentially left under overlay led
+	 * and saved by Statusbar_OverlayBackup()
+	 */
+	Statusbar_OverlayRestore(sdlscrn);
+
+	if (!Screen_ConvertLines())
+		return false;
+	return Screen_ShowFrame(bForceFlip);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Draw ST screen to window/full-screen framebuffer
+ * @param  bForceFlip  Force screen update, even if contents did not change
+ * @return  true if screen contents changed
+ */
+static bool Screen_DrawFrame(bool bForceFlip)
+{
+	Screen_PrepareFrame();
+	return Screen_ConvertFrame(bForceFlip);
+}
+
+
+#if ENABLE_CONVERT_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Conversion thread: convert the snapshotted frame each time it's started
+ * by Screen_ConvertThread(), until Screen_ConvertThreadStop() is called.
+ * Statusbar is left to Screen_ConvertWait().
+ */
+static void Screen_ConvertThreadFunc(void *data)
+{
+	slock_lock(ConvertLock);
+	for (;;)
+	{
+		while (nConvertState != CONVERT_RUNNING && !bConvertQuit)
+			scond_wait(ConvertCond, ConvertLock);
+		if (bConvertQuit)
+			break;
+		slock_unlock(ConvertLock);
+
+		bConvertLocked = Screen_ConvertLines();
+
+		slock_lock(ConvertLock);
+		nConvertState = CONVERT_DONE;
+		scond_signal(ConvertCond);
+	}
+	slock_unlock(ConvertLock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until conversion thread is done with the frame it's converting,
+ * so that the host screen and conversion state can be accessed again,
+ * and then draw the statusbar on it here, in the emulation thread.
+ */
+void Screen_ConvertWait(void)
+{
+	if (!ConvertThread)
+		return;
+	slock_lock(ConvertLock);
+	while (nConvertState == CONVERT_RUNNING)
+		scond_wait(ConvertCond, ConvertLock);
+	slock_unlock(ConvertLock);
+
+	if (nConvertState == CONVERT_DONE)
+	{
+		nConvertState = CONVERT_IDLE;
+		if (bConvertLocked)
+			Screen_ShowFrame(false);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop conversion thread and free its resources
+ */
+static void Screen_ConvertThreadStop(void)
+{
+	if (!ConvertThread)
+		return;
+	slock_lock(ConvertLock);
+	bConvertQuit = true;
+	scond_signal(ConvertCond);
+	slock_unlock(ConvertLock);
+	sthread_join(ConvertThread);
+	scond_free(ConvertCond);
+	slock_free(ConvertLock);
+	ConvertThread = NULL;
+	bConvertQuit = false;
+	nConvertState = CONVERT_IDLE;
+}
 
-		/* And show to user */
-		if (bScreenContentsChanged || bForceFlip || sbar_rect)
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the frontend once the previous frame has been shown.  If
+ * 'bEnable' is set, start converting the frame snapshotted on last VBL
+ * in the conversion thread, so that it runs in parallel with emulating
+ * the next frame, and snapshot next frames too.  Otherwise convert the
+ * frame here and go back to converting them directly on VBL.
+ */
+void Screen_ConvertThread(bool bEnable)
+{
+	if (bEnable && !ConvertThread)
+	{
+		ConvertLock = slock_new();
+		ConvertCond = scond_new();
+		if (ConvertLock && ConvertCond)
+			ConvertThread = sthread_create(Screen_ConvertThreadFunc, NULL);
+		if (!ConvertThread)
 		{
-			Screen_Blit(sbar_rect);
+			Log_Printf(LOG_WARN, "Failed to create screen conversion thread.\n");
+			if (ConvertCond)
+				scond_free(ConvertCond);
+			if (ConvertLock)
+				slock_free(ConvertLock);
+			ConvertCond = NULL;
+			ConvertLock = NULL;
+			bEnable = false;
 		}
+	}
+	bConvertThreaded = bEnable;
 
-		return bScreenContentsChanged;
+	Screen_ConvertWait();
+	if (nConvertState != CONVERT_PENDING)
+		return;
+	if (!bEnable)
+	{
+		nConvertState = CONVERT_IDLE;
+		Screen_ConvertFrame(false);
+		bConvertSnapshot = false;
+		return;
 	}
+	/* statusbar isn't touched by the thread */
+	Statusbar_OverlayRestore(sdlscrn);
+	slock_lock(ConvertLock);
+	nConvertState = CONVERT_RUNNING;
+	scond_signal(ConvertCond);
+	slock_unlock(ConvertLock);
+}
 
-	return false;
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the frontend converts frames in a thread, so that
+ * other renderers can use threads too.
+ */
+bool Screen_ConvertThreaded(void)
+{
+	return bConvertThreaded;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Prepare frame and take a snapshot of its ST screen lines and masks
+ * for the conversion thread, as emulation overwrites those for next
+ * frame.  Return false if frame can't be converted in the thread.
+ */
+static bool Screen_SnapshotFrame(void)
+{
+	Screen_PrepareFrame();
+	if (!bConvertLines)
+		return false;
+
+	memcpy(pSTScreenSnapshot, pFrameBuffer->pSTScreen, NUM_VISIBLE_LINES*SCREENBYTES_LINE);
+	memcpy(SnapshotPaletteMasks, HBLPaletteMasks, sizeof(SnapshotPaletteMasks));
+	bConvertSnapshot = true;
+	nConvertState = CONVERT_PENDING;
+	return true;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish conversion of the snapshotted frame, if any
+ */
+static void Screen_ConvertFinish(void)
+{
+#if ENABLE_CONVERT_THREAD
+	Screen_ConvertWait();
+	if (nConvertState == CONVERT_PENDING)
+	{
+		/* wasn't started, do it now */
+		nConvertState = CONVERT_IDLE;
+		Screen_ConvertFrame(false);
+	}
+#endif
 }
 
 
@@ -1410,6 +1855,17 @@ bool Screen_Draw(void)
 {
 	if (!bQuitProgram && VideoBase)
 	{
+#if ENABLE_CONVERT_THREAD
+		/* Previous frame needs to be done before this one is prepared */
+		Screen_ConvertFinish();
+		bConvertSnapshot = false;
+		if (bConvertThreaded)
+		{
+			if (Screen_SnapshotFrame())
+				return false;
+			return Screen_ConvertFrame(false);
+		}
+#endif
 		/* And draw (if screen contents changed) */
 		return Screen_DrawFrame(false);
 	}
@@ -1418,6 +1874,79 @@ bool Screen_Draw(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if hash of the current frame is requested (--frame-hash)
+ */
+static bool Screen_FrameHashWanted(void)
+{
+	int interval = ConfigureParams.Screen.nFrameHash;
+
+	return interval > 0 && nVBLs % interval == 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if current frame should be rendered, i.e. unless running
+ * headless (--headless) and the frame hash isn't requested.  Skipped
+ * frames leave the dirty tracking state untouched, so the next rendered
+ * frame picks up all the changes.
+ */
+bool Screen_FrameWanted(void)
+{
+	return !ConfigureParams.Screen.bHeadless || Screen_FrameHashWanted();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return 64-bit FNV-1a hash of the rendered frame (without statusbar),
+ * and its size in pixels
+ */
+Uint64 Screen_GetFrameHash(int *pWidth, int *pHeight)
+{
+	Uint64 hash = 0xcbf29ce484222325ULL;
+	const Uint8 *pLine;
+	int x, y, w, h;
+
+	*pWidth = *pHeight = 0;
+	if (!sdlscrn)
+		return hash;
+
+	Screen_ConvertFinish();
+	w = sdlscrn->w * sdlscrn->format->BytesPerPixel;
+	h = sdlscrn->h - Statusbar_GetHeight();
+	pLine = sdlscrn->pixels;
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+			hash = (hash ^ pLine[x]) * 0x100000001b3ULL;
+		pLine += sdlscrn->pitch;
+	}
+	*pWidth = sdlscrn->w;
+	*pHeight = h;
+	return hash;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Output hash of the rendered frame, if one is requested for it
+ */
+void Screen_HashFrame(void)
+{
+	Uint64 hash;
+	int w, h;
+
+	if (!sdlscrn || !Screen_FrameHashWanted())
+		return;
+
+	hash = Screen_GetFrameHash(&w, &h);
+	fprintf(stderr, "Frame %d hash: %016"PRIx64" (%dx%dx%d)\n", nVBLs,
+	        hash, w, h, sdlscrn->format->BitsPerPixel);
+}
+
+
 /* -------------- screen conversion routines --------------------------------
   Screen conversion routines. We have a number of routines to convert ST screen
   to PC format. We split these into Low, Medium and High each with 8/16-bit
@@ -1450,7 +1979,7 @@ static int AdjustLinePaletteRemap(int y)
 	int i;
 
 	/* Copy palette and convert to RGB in display format */
-	actHBLPal = pHBLPalettes + (y<<4);    /* offset in palette */
+	actHBLPal = pConvPalettes + (y<<4);   /* offset in palette */
 	for (i=0; i<16; i++)
 	{
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
@@ -1459,7 +1988,7 @@ static int AdjustLinePaletteRemap(int y)
 		STRGBPalette[i] = ST2RGB[*actHBLPal++];
 #endif
 	}
-	ScrUpdateFlag = HBLPaletteMasks[y];
+	ScrUpdateFlag = pConvPaletteMasks[y];
 	return ScrUpdateFlag;
 }
 
@@ -1484,6 +2013,26 @@ static void Convert_StartFrame(void)
 		AdjustLinePaletteRemap(y++);     /* Update palette */
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the Spec512 converters after Spec512_StartScanLine(). Return
+ * true if line 'y' would be converted the same as in the previous frame,
+ * so that the host screen still has it. Lines are converted only when
+ * this returns false. Like Screen_SetDirtyLines(), this uses line hashes,
+ * but for Spec512 ones they include the palette writes of the line.
+ */
+static bool Convert_Spec512LineUnchanged(int y, const Uint32 *edi)
+{
+	Uint32 nRes = (pConvPaletteMasks[y] >> 16) & ST_RES_MASK;
+	Uint64 hash = Spec512_LineHash((const Uint8 *)edi, STScreenWidthBytes, nRes);
+
+	if (hash == LineHashes[y] && !bConvertFullUpdate)
+		return true;
+	LineHashes[y] = hash;
+	bScreenContentsChanged = true;
+	return false;
+}
+
 /* lookup tables and conversion macros */
 #include "convert/macros.h"
 
@@ -1511,3 +2060,56 @@ static void Convert_StartFrame(void)
 #include "convert/vdi16.c"		/* VDI x 16 color */
 #include "convert/vdi4.c"		/* VDI x 4 color */
 #include "convert/vdi2.c"		/* VDI x 2 color */
+
+/* Converters specialised on line width and Y doubling */
+CONVERT_VARIANTS_320(ConvertLowRes_320x16Bit);
+CONVERT_VARIANTS_640(ConvertLowRes_640x16Bit);
+CONVERT_VARIANTS_640(ConvertMediumRes_640x16Bit);
+CONVERT_VARIANTS_320(ConvertLowRes_320x32Bit);
+CONVERT_VARIANTS_640(ConvertLowRes_640x32Bit);
+CONVERT_VARIANTS_640(ConvertMediumRes_640x32Bit);
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the variant of converter 'pFunc' specialised on the current
+ * line width and Y doubling (set by Screen_SetConvertDetails()), or
+ * 'pFunc' itself if there's none for them.
+ */
+static void (*Screen_ConvertVariant(void (*pFunc)(void)))(void)
+{
+	static const struct {
+		void (*pFunc)(void);
+		void (* const *pVariants)(void);
+	} Variants[] = {
+		{ ConvertLowRes_320x16Bit, ConvertLowRes_320x16Bit_Variants },
+		{ ConvertLowRes_640x16Bit, ConvertLowRes_640x16Bit_Variants },
+		{ ConvertMediumRes_640x16Bit, ConvertMediumRes_640x16Bit_Variants },
+		{ ConvertLowRes_320x32Bit, ConvertLowRes_320x32Bit_Variants },
+		{ ConvertLowRes_640x32Bit, ConvertLowRes_640x32Bit_Variants },
+		{ ConvertMediumRes_640x32Bit, ConvertMediumRes_640x32Bit_Variants },
+	};
+	unsigned int i;
+	int nVariant;
+
+	if (bUseVDIRes || bUseHighRes)
+		return pFunc;
+
+	if (STScreenWidthBytes == CONVERT_WIDTH_NOBORDER)
+		nVariant = 0;
+	else if (STScreenWidthBytes == CONVERT_WIDTH_BORDER)
+		nVariant = 2;
+	else if (STScreenWidthBytes == CONVERT_WIDTH_OVERSCAN)
+		nVariant = 4;
+	else
+		return pFunc;
+	if (bScrDoubleY)
+		nVariant++;
+
+	for (i = 0; i < sizeof(Variants)/sizeof(Variants[0]); i++)
+	{
+		if (Variants[i].pFunc == pFunc)
+			return Variants[i].pVariants[nVariant];
+	}
+	return pFunc;
+}
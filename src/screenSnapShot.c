@@ -5,6 +5,13 @@
   or at your option any later version. Read the file gpl.txt for details.
 
   Screen Snapshots.
+
+  Screenshots are copied to one of a few pooled 24-bit RGB buffers on
+  the emulation thread, and encoded & written by a background thread
+  (when threads are available), so taking them doesn't stall emulation.
+  PNG encoding uses zlib directly, with a fast compression level by
+  default.  Raw frames can also be streamed to a file or named pipe
+  (--frame-pipe) for encoding by external tools.
 */
 const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " __TIME__;
 
@@ -15,6 +22,7 @@ const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " _
 #include "configuration.h"
 #include "log.h"
 #include "paths.h"
+#include "recWriter.h"
 #include "screen.h"
 #include "screenSnapShot.h"
 #include "statusbar.h"
@@ -23,11 +31,66 @@ const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " _
 #if HAVE_LIBPNG
 # include <png.h>
 # include <assert.h>
-# include "pixel_convert.h"				/* inline functions */
 #endif
+#if HAVE_ZLIB_H
+# include <zlib.h>
+#endif
+#include "pixel_convert.h"				/* inline functions */
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS)
+# include <rthreads/rthreads.h>
+# define SCREENSHOT_THREAD	1
+#else
+# define SCREENSHOT_THREAD	0
+#endif
+
+#ifdef __LIBRETRO__
+/* libretro GUI is drawn over the screen, which is saved before that */
+extern unsigned char *savbkg;
+extern int pauseg;
+#endif
+
+#define SCREENSHOT_BUFFERS	4		/* screenshots being encoded at the same time */
+
+typedef enum {
+	SHOT_FREE,
+	SHOT_QUEUED,
+	SHOT_ENCODING
+} shot_state_t;
+
+typedef struct {
+	shot_state_t state;
+	Uint32 seq;				/* queuing order */
+	int w, h;
+	Uint8 *rgb;				/* 24-bit RGB copy of the screen */
+	size_t rgbAlloc;
+	Uint8 *data;				/* encoded file contents */
+	size_t dataAlloc, dataSize;
+	char szFileName[FILENAME_MAX];
+} screenshot_t;
+
+static struct {
+	screenshot_t shots[SCREENSHOT_BUFFERS];
+	Uint32 seq;
+#if SCREENSHOT_THREAD
+	sthread_t *thread;
+	slock_t *lock;
+	scond_t *cond;				/* signaled on each shot state change */
+	bool quit;
+	bool failedInit;			/* thread creation failed, don't retry */
+#endif
+} ShotQueue;
 
+static struct {
+	FILE *fp;
+	bool failed;				/* don't retry opening */
+	int w, h;
+	Uint8 *row;
+	size_t rowAlloc;
+} FramePipe;
 
 static int nScreenShots = 0;                /* Number of screen shots saved */
+static bool bScreenShotsScanned = false;    /* whether nScreenShots is valid */
 
 
 /*-----------------------------------------------------------------------*/
@@ -70,32 +133,339 @@ static void ScreenSnapShot_GetNum(void)
 }
 
 
-#if HAVE_LIBPNG
 /**
- * Save given SDL surface as PNG. Return png file size > 0 for success.
+ * Make sure the buffer '*pBuf' of '*pAlloc' bytes can hold 'size' bytes
  */
-static int ScreenSnapShot_SavePNG(SDL_Surface *surface, const char *filename)
+static bool ScreenSnapShot_Reserve(Uint8 **pBuf, size_t *pAlloc, size_t size)
 {
-	FILE *fp = NULL;
-	int ret, bottom;
-  
-	fp = fopen(filename, "wb");
-	if (!fp)
-		return -1;
+	Uint8 *p;
+
+	if (*pAlloc >= size)
+		return true;
+	p = realloc(*pBuf, size);
+	if (!p)
+		return false;
+	*pBuf = p;
+	*pAlloc = size;
+	return true;
+}
 
-	if (ConfigureParams.Screen.bCrop)
-		bottom = Statusbar_GetHeight();
+
+/**
+ * Convert 'h' rows of 'w' surface pixels from 'src' to 24-bit RGB in 'dst'
+ * (with 'dstpitch' bytes per row)
+ */
+static void ScreenSnapShot_ConvertRows(SDL_Surface *surface, Uint8 *src, int w, int h,
+                                       Uint8 *dst, int dstpitch)
+{
+	SDL_PixelFormat *fmt = surface->format;
+	bool do_lock = SDL_MUSTLOCK(surface);
+	int y;
+
+	if (do_lock)
+		SDL_LockSurface(surface);
+	for (y = 0; y < h; y++) {
+		switch (fmt->BytesPerPixel) {
+		case 1:
+			PixelConvert_8to24Bits(dst, src, w, fmt->palette->colors);
+			break;
+		case 2:
+			PixelConvert_16to24Bits(dst, (Uint16*)src, w, fmt);
+			break;
+		case 3:
+			memcpy(dst, src, w * 3);
+			break;
+		case 4:
+			PixelConvert_32to24Bits(dst, (Uint32*)src, w, fmt);
+			break;
+		}
+		src += surface->pitch;
+		dst += dstpitch;
+	}
+	if (do_lock)
+		SDL_UnlockSurface(surface);
+}
+
+
+/**
+ * Return the emulated screen pixels of given surface
+ */
+static Uint8 *ScreenSnapShot_GetPixels(SDL_Surface *surface)
+{
+#ifdef __LIBRETRO__
+	if (pauseg == 1 && savbkg)
+		return savbkg;
+#endif
+	return surface->pixels;
+}
+
+
+#if HAVE_ZLIB_H
+/**
+ * Append PNG chunk of given type and contents (unless already there,
+ * after the 8 bytes for its length and type) to shot data, with its CRC
+ */
+static void ScreenSnapShot_PNGChunk(screenshot_t *shot, const char *type,
+                                    const void *data, Uint32 size)
+{
+	Uint8 *p = shot->data + shot->dataSize;
+	Uint32 crc;
+
+	p[0] = size >> 24; p[1] = size >> 16; p[2] = size >> 8; p[3] = size;
+	memcpy(p + 4, type, 4);
+	if (data)
+		memcpy(p + 8, data, size);
+	crc = crc32(crc32(0, NULL, 0), p + 4, size + 4);
+	p += 8 + size;
+	p[0] = crc >> 24; p[1] = crc >> 16; p[2] = crc >> 8; p[3] = crc;
+	shot->dataSize += 12 + size;
+}
+
+/**
+ * Encode screenshot RGB data as PNG file contents.  Return true for success.
+ */
+static bool ScreenSnapShot_EncodePNG(screenshot_t *shot, int level)
+{
+	static const Uint8 signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	static const char text[] = "Title\0Hatari screenshot";
+	Uint8 ihdr[13], filter = 0;
+	size_t rowsize = shot->w * 3;
+	z_stream z;
+	int y, ret;
+
+	memset(&z, 0, sizeof(z));
+	if (deflateInit(&z, level) != Z_OK)
+		return false;
+	if (!ScreenSnapShot_Reserve(&shot->data, &shot->dataAlloc, sizeof(signature)
+	                            + 4*12 + sizeof(ihdr) + sizeof(text) - 1
+	                            + deflateBound(&z, (rowsize + 1) * shot->h))) {
+		deflateEnd(&z);
+		return false;
+	}
+
+	memcpy(shot->data, signature, sizeof(signature));
+	shot->dataSize = sizeof(signature);
+
+	ihdr[0] = shot->w >> 24; ihdr[1] = shot->w >> 16; ihdr[2] = shot->w >> 8; ihdr[3] = shot->w;
+	ihdr[4] = shot->h >> 24; ihdr[5] = shot->h >> 16; ihdr[6] = shot->h >> 8; ihdr[7] = shot->h;
+	ihdr[8] = 8;			/* bit depth */
+	ihdr[9] = 2;			/* RGB color type */
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;	/* deflate, adaptive filters, no interlace */
+	ScreenSnapShot_PNGChunk(shot, "IHDR", ihdr, sizeof(ihdr));
+	ScreenSnapShot_PNGChunk(shot, "tEXt", text, sizeof(text) - 1);
+
+	/* compress the rows, each preceded by "no filter" byte, straight
+	 * to IDAT chunk contents (its header & CRC are added afterwards)
+	 */
+	z.next_out = shot->data + shot->dataSize + 8;
+	z.avail_out = shot->dataAlloc - shot->dataSize - 8 - 2*12;
+	ret = Z_OK;
+	for (y = 0; y < shot->h && ret == Z_OK; y++) {
+		z.next_in = &filter;
+		z.avail_in = 1;
+		ret = deflate(&z, Z_NO_FLUSH);
+		z.next_in = shot->rgb + y * rowsize;
+		z.avail_in = rowsize;
+		if (ret == Z_OK)
+			ret = deflate(&z, Z_NO_FLUSH);
+	}
+	if (ret == Z_OK)
+		ret = deflate(&z, Z_FINISH);
+	deflateEnd(&z);
+	if (ret != Z_STREAM_END)
+		return false;
+
+	ScreenSnapShot_PNGChunk(shot, "IDAT", NULL, z.total_out);
+	ScreenSnapShot_PNGChunk(shot, "IEND", NULL, 0);
+	return true;
+}
+
+#else
+
+/**
+ * Encode screenshot RGB data as BMP file contents.  Return true for success.
+ */
+static bool ScreenSnapShot_EncodeBMP(screenshot_t *shot, int level)
+{
+	int x, y, pad = (4 - (shot->w * 3) % 4) % 4;
+	Uint32 rowsize = shot->w * 3 + pad;
+	Uint32 size = 54 + rowsize * shot->h;
+	const Uint8 *src;
+	Uint8 *p;
+
+	if (!ScreenSnapShot_Reserve(&shot->data, &shot->dataAlloc, size))
+		return false;
+	p = shot->data;
+	memset(p, 0, 54);
+	p[0] = 'B'; p[1] = 'M';
+	p[2] = size; p[3] = size >> 8; p[4] = size >> 16; p[5] = size >> 24;
+	p[10] = 54;			/* pixel data offset */
+	p[14] = 40;			/* info header size */
+	p[18] = shot->w; p[19] = shot->w >> 8; p[20] = shot->w >> 16; p[21] = shot->w >> 24;
+	p[22] = shot->h; p[23] = shot->h >> 8; p[24] = shot->h >> 16; p[25] = shot->h >> 24;
+	p[26] = 1;			/* planes */
+	p[28] = 24;			/* bits per pixel */
+	p += 54;
+
+	/* bottom-up rows of BGR pixels */
+	for (y = shot->h - 1; y >= 0; y--) {
+		src = shot->rgb + y * shot->w * 3;
+		for (x = 0; x < shot->w; x++, src += 3) {
+			*p++ = src[2];
+			*p++ = src[1];
+			*p++ = src[0];
+		}
+		memset(p, 0, pad);
+		p += pad;
+	}
+	shot->dataSize = size;
+	return true;
+}
+#endif
+
+
+/**
+ * Encode queued screenshot and write it to its file
+ */
+static void ScreenSnapShot_Encode(screenshot_t *shot)
+{
+	FILE *fp;
+	bool ok;
+
+#if HAVE_ZLIB_H
+	ok = ScreenSnapShot_EncodePNG(shot, ConfigureParams.Video.ScreenShotCompression);
+#else
+	ok = ScreenSnapShot_EncodeBMP(shot, 0);
+#endif
+	if (ok) {
+		fp = fopen(shot->szFileName, "wb");
+		ok = fp && fwrite(shot->data, 1, shot->dataSize, fp) == shot->dataSize;
+		if (fp && fclose(fp) != 0)
+			ok = false;
+	}
+	if (ok)
+		fprintf(stderr, "Screen dump saved to: %s\n", shot->szFileName);
 	else
-		bottom = 0;
+		fprintf(stderr, "Screen dump to %s failed!\n", shot->szFileName);
+}
 
-	/* default compression/filter and configured cropping */
-	ret = ScreenSnapShot_SavePNG_ToFile(surface, fp, -1, -1, 0, 0, 0, bottom);
 
-	fclose (fp);
-	return ret;					/* >0 if OK, -1 if error */
+#if SCREENSHOT_THREAD
+/**
+ * Encoder thread: encode queued screenshots in order until
+ * ScreenSnapShot_UnInit() is called
+ */
+static void ScreenSnapShot_ThreadFunc(void *data)
+{
+	screenshot_t *shot;
+	int i;
+
+	slock_lock(ShotQueue.lock);
+	for (;;) {
+		shot = NULL;
+		for (i = 0; i < SCREENSHOT_BUFFERS; i++) {
+			if (ShotQueue.shots[i].state == SHOT_QUEUED &&
+			    (!shot || (Sint32)(ShotQueue.shots[i].seq - shot->seq) < 0))
+				shot = &ShotQueue.shots[i];
+		}
+		if (!shot) {
+			if (ShotQueue.quit)
+				break;
+			scond_wait(ShotQueue.cond, ShotQueue.lock);
+			continue;
+		}
+		shot->state = SHOT_ENCODING;
+		slock_unlock(ShotQueue.lock);
+
+		ScreenSnapShot_Encode(shot);
+
+		slock_lock(ShotQueue.lock);
+		shot->state = SHOT_FREE;
+		scond_broadcast(ShotQueue.cond);
+	}
+	slock_unlock(ShotQueue.lock);
+}
+
+/**
+ * Start the encoder thread if it isn't running yet.
+ * Return false if it can't be started.
+ */
+static bool ScreenSnapShot_StartThread(void)
+{
+	if (ShotQueue.thread)
+		return true;
+	if (ShotQueue.failedInit)
+		return false;
+	ShotQueue.lock = slock_new();
+	ShotQueue.cond = scond_new();
+	if (ShotQueue.lock && ShotQueue.cond)
+		ShotQueue.thread = sthread_create(ScreenSnapShot_ThreadFunc, NULL);
+	if (!ShotQueue.thread) {
+		Log_Printf(LOG_WARN, "Screenshot thread creation failed, encoding them directly.\n");
+		if (ShotQueue.cond)
+			scond_free(ShotQueue.cond);
+		if (ShotQueue.lock)
+			slock_free(ShotQueue.lock);
+		ShotQueue.cond = NULL;
+		ShotQueue.lock = NULL;
+		ShotQueue.failedInit = true;
+		return false;
+	}
+	return true;
+}
+#endif
+
+
+/**
+ * Return a free screenshot buffer, after waiting for one if all are in use
+ */
+static screenshot_t *ScreenSnapShot_GetFree(void)
+{
+	int i;
+
+#if SCREENSHOT_THREAD
+	if (ScreenSnapShot_StartThread()) {
+		slock_lock(ShotQueue.lock);
+		for (;;) {
+			for (i = 0; i < SCREENSHOT_BUFFERS; i++) {
+				if (ShotQueue.shots[i].state == SHOT_FREE) {
+					slock_unlock(ShotQueue.lock);
+					return &ShotQueue.shots[i];
+				}
+			}
+			scond_wait(ShotQueue.cond, ShotQueue.lock);
+		}
+	}
+#endif
+	for (i = 0; i < SCREENSHOT_BUFFERS; i++) {
+		if (ShotQueue.shots[i].state == SHOT_FREE)
+			return &ShotQueue.shots[i];
+	}
+	return &ShotQueue.shots[0];
+}
+
+
+/**
+ * Give filled screenshot buffer to the encoder thread,
+ * or encode it directly if there's none
+ */
+static void ScreenSnapShot_Queue(screenshot_t *shot)
+{
+#if SCREENSHOT_THREAD
+	if (ShotQueue.thread) {
+		slock_lock(ShotQueue.lock);
+		shot->seq = ShotQueue.seq++;
+		shot->state = SHOT_QUEUED;
+		scond_broadcast(ShotQueue.cond);
+		slock_unlock(ShotQueue.lock);
+		return;
+	}
+#endif
+	ScreenSnapShot_Encode(shot);
 }
 
 
+#if HAVE_LIBPNG
 /**
  * Save given SDL surface as PNG in an already opened FILE, eventually cropping some borders.
  * Return png file size > 0 for success.
@@ -207,40 +577,243 @@ png_cleanup:
 		png_destroy_write_struct(&png_ptr, NULL);
 	return ret;
 }
+
+
+/* Output buffer for ScreenSnapShot_SavePNG_ToMemory() */
+typedef struct {
+	Uint8 *data;
+	size_t size;
+	size_t alloc;
+} png_membuf_t;
+
+/**
+ * libpng write callback appending to a png_membuf_t
+ */
+static void ScreenSnapShot_PNGWriteMem(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+	png_membuf_t *buf = png_get_io_ptr(png_ptr);
+	Uint8 *newdata;
+	size_t alloc;
+
+	if (buf->size + length > buf->alloc)
+	{
+		alloc = 2 * (buf->size + length);
+		newdata = realloc(buf->data, alloc);
+		if (!newdata)
+			png_error(png_ptr, "out of memory");
+		buf->data = newdata;
+		buf->alloc = alloc;
+	}
+	memcpy(buf->data + buf->size, data, length);
+	buf->size += length;
+}
+
+static void ScreenSnapShot_PNGFlushMem(png_structp png_ptr)
+{
+}
+
+/**
+ * Save 'h' rows of 'w' 24-bit RGB pixels as PNG in memory, after the
+ * first 'offset' bytes of *pData.  *pData is grown with realloc() when
+ * needed (*pAlloc being its size).  As this doesn't access any surface,
+ * it can be called from another thread.
+ * Return png size > 0 for success.
+ * This function is used by avi_record.c to compress frames in parallel.
+ */
+int ScreenSnapShot_SavePNG_ToMemory(const Uint8 *rgb, int w, int h, int png_compression_level, int png_filter,
+		Uint8 **pData, size_t *pAlloc, size_t offset)
+{
+	png_membuf_t buf;
+	png_infop info_ptr = NULL;
+	png_structp png_ptr;
+	png_text pngtext;
+	char key[] = "Title";
+	char text[] = "Hatari screenshot";
+	int y, ret = -1;
+
+	buf.data = *pData;
+	buf.alloc = *pAlloc;
+	buf.size = offset;
+
+	png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	if (!png_ptr)
+		return ret;
+	info_ptr = png_create_info_struct(png_ptr);
+	if (!info_ptr)
+		goto png_cleanup;
+	if (setjmp(png_jmpbuf(png_ptr)))
+		goto png_cleanup;
+
+	png_set_write_fn(png_ptr, &buf, ScreenSnapShot_PNGWriteMem, ScreenSnapShot_PNGFlushMem);
+
+	/* same image properties and info as ScreenSnapShot_SavePNG_ToFile() */
+	png_set_IHDR(png_ptr, info_ptr, w, h, 8, PNG_COLOR_TYPE_RGB,
+		     PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+		     PNG_FILTER_TYPE_DEFAULT);
+	if ( png_compression_level >= 0 )
+		png_set_compression_level ( png_ptr , png_compression_level );
+	if ( png_filter >= 0 )
+		png_set_filter ( png_ptr , 0 , png_filter );
+
+	pngtext.key = key;
+	pngtext.text = text;
+	pngtext.compression = PNG_TEXT_COMPRESSION_NONE;
+#ifdef PNG_iTXt_SUPPORTED
+	pngtext.lang = NULL;
+#endif
+	png_set_text(png_ptr, info_ptr, &pngtext, 1);
+
+	png_write_info(png_ptr, info_ptr);
+	for (y = 0; y < h; y++)
+		png_write_row(png_ptr, (png_bytep)(rgb + y * w * 3));
+	png_write_end(png_ptr, info_ptr);
+
+	ret = buf.size - offset;				/* size of the png image */
+png_cleanup:
+	*pData = buf.data;
+	*pAlloc = buf.alloc;
+	png_destroy_write_struct(&png_ptr, &info_ptr);
+	return ret;
+}
 #endif
 
 
 /*-----------------------------------------------------------------------*/
 /**
  * Save screen shot file with filename like 'grab0000.[png|bmp]',
- * 'grab0001.[png|bmp]', etc... Whether screen shots are saved as BMP
- * or PNG depends on Hatari configuration.
+ * 'grab0001.[png|bmp]', etc... PNG is used when zlib is available.
+ * Screen is only copied here, it's encoded and saved in the background.
  */
 void ScreenSnapShot_SaveScreen(void)
 {
-	char *szFileName = malloc(FILENAME_MAX);
+	screenshot_t *shot;
+	int bottom = 0;
 
-	if (!szFileName)  return;
-
-	ScreenSnapShot_GetNum();
-	/* Create our filename */
+	/* scan existing ones only once, later ones might not be written yet */
+	if (!bScreenShotsScanned)
+	{
+		ScreenSnapShot_GetNum();
+		bScreenShotsScanned = true;
+	}
 	nScreenShots++;
-#if HAVE_LIBPNG
-	/* try first PNG */
-	sprintf(szFileName,"%s/grab%4.4d.png", Paths_GetWorkingDir(), nScreenShots);
-	if (ScreenSnapShot_SavePNG(sdlscrn, szFileName) > 0)
+
+	/* frame conversion may still be going on */
+	Screen_ConvertWait();
+
+	shot = ScreenSnapShot_GetFree();
+	if (ConfigureParams.Screen.bCrop)
+		bottom = Statusbar_GetHeight();
+	shot->w = sdlscrn->w;
+	shot->h = sdlscrn->h - bottom;
+	if (!ScreenSnapShot_Reserve(&shot->rgb, &shot->rgbAlloc, shot->w * shot->h * 3))
 	{
-		fprintf(stderr, "Screen dump saved to: %s\n", szFileName);
-		free(szFileName);
+		fprintf(stderr, "Screen dump failed!\n");
 		return;
 	}
+	ScreenSnapShot_ConvertRows(sdlscrn, ScreenSnapShot_GetPixels(sdlscrn),
+	                           shot->w, shot->h, shot->rgb, shot->w * 3);
+
+#if HAVE_ZLIB_H
+	snprintf(shot->szFileName, sizeof(shot->szFileName), "%s/grab%4.4d.png",
+	         Paths_GetWorkingDir(), nScreenShots);
+#else
+	snprintf(shot->szFileName, sizeof(shot->szFileName), "%s/grab%4.4d.bmp",
+	         Paths_GetWorkingDir(), nScreenShots);
 #endif
-	sprintf(szFileName,"%s/grab%4.4d.bmp", Paths_GetWorkingDir(), nScreenShots);
-	if (SDL_SaveBMP(sdlscrn, szFileName))
-		fprintf(stderr, "Screen dump failed!\n");
-	else
-		fprintf(stderr, "Screen dump saved to: %s\n", szFileName);
+	ScreenSnapShot_Queue(shot);
+}
 
-	free(szFileName);
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write current screen as a raw 24-bit RGB frame to the file or named
+ * pipe given with --frame-pipe, if any.  Called for each emulated frame.
+ * Writing is done in the background by the recording writer thread.
+ */
+void ScreenSnapShot_PipeFrame(void)
+{
+	Uint8 *src;
+	int y;
+
+	if (!ConfigureParams.Video.FramePipeFile[0] || FramePipe.failed)
+		return;
+	if (!FramePipe.fp)
+	{
+		FramePipe.fp = fopen(ConfigureParams.Video.FramePipeFile, "wb");
+		if (!FramePipe.fp)
+		{
+			Log_Printf(LOG_ERROR, "Can't open frame pipe '%s'\n",
+			           ConfigureParams.Video.FramePipeFile);
+			FramePipe.failed = true;
+			return;
+		}
+	}
+
+	Screen_ConvertWait();
+	if (sdlscrn->w != FramePipe.w || sdlscrn->h != FramePipe.h)
+	{
+		FramePipe.w = sdlscrn->w;
+		FramePipe.h = sdlscrn->h;
+		Log_Printf(LOG_INFO, "Frame pipe: %dx%d RGB24 frames\n", FramePipe.w, FramePipe.h);
+		if (!ScreenSnapShot_Reserve(&FramePipe.row, &FramePipe.rowAlloc, FramePipe.w * 3))
+		{
+			FramePipe.failed = true;
+			return;
+		}
+	}
+
+	src = ScreenSnapShot_GetPixels(sdlscrn);
+	for (y = 0; y < FramePipe.h; y++)
+	{
+		ScreenSnapShot_ConvertRows(sdlscrn, src, FramePipe.w, 1, FramePipe.row, 0);
+		if (!RecWriter_Write(FramePipe.fp, FramePipe.row, FramePipe.w * 3))
+		{
+			Log_Printf(LOG_ERROR, "Frame pipe write failed, stopping it\n");
+			FramePipe.failed = true;
+			return;
+		}
+		src += sdlscrn->pitch;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish pending screenshots and frame pipe writes, and free their resources
+ */
+void ScreenSnapShot_UnInit(void)
+{
+	int i;
+
+#if SCREENSHOT_THREAD
+	if (ShotQueue.thread)
+	{
+		slock_lock(ShotQueue.lock);
+		ShotQueue.quit = true;
+		scond_broadcast(ShotQueue.cond);
+		slock_unlock(ShotQueue.lock);
+		sthread_join(ShotQueue.thread);
+		scond_free(ShotQueue.cond);
+		slock_free(ShotQueue.lock);
+		ShotQueue.thread = NULL;
+		ShotQueue.cond = NULL;
+		ShotQueue.lock = NULL;
+		ShotQueue.quit = false;
+	}
+#endif
+	for (i = 0; i < SCREENSHOT_BUFFERS; i++)
+	{
+		free(ShotQueue.shots[i].rgb);
+		free(ShotQueue.shots[i].data);
+	}
+	memset(ShotQueue.shots, 0, sizeof(ShotQueue.shots));
+
+	if (FramePipe.fp)
+	{
+		RecWriter_Flush(FramePipe.fp);
+		fclose(FramePipe.fp);
+	}
+	free(FramePipe.row);
+	memset(&FramePipe, 0, sizeof(FramePipe));
 }
 
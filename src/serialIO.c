@@ -0,0 +1,775 @@
+/*
+  Hatari - serialIO.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Non-blocking byte streams for the RS-232 and printer ports.
+
+  A device has an input and/or an output endpoint, which can be a file,
+  a tty, or a TCP socket: "tcp:<host>:<port>" connects to a peer,
+  "tcp::<port>" waits for a peer to connect (e.g. for BBS or modem
+  emulation, a new peer can connect when the previous one left). When
+  the same TCP endpoint is given for input and output, it's opened once.
+
+  The emulation only copies bytes to/from a ring buffer in each direction
+  (single producer, single consumer, lock-free). One shared worker thread
+  poll()s the endpoints of all devices and does the actual read()/write()
+  calls, so a slow or stalled peer never blocks the emulation. When the
+  output ring is full, the new bytes are dropped like on an overrun.
+
+  Without thread support, or on hosts without poll() and sockets, files
+  are accessed directly with stdio and TCP endpoints are not available.
+*/
+const char SerialIO_fileid[] = "Hatari serialIO.c : " __DATE__ " " __TIME__;
+
+#include "config.h"
+#include "main.h"
+#include "file.h"
+#include "log.h"
+#include "serialIO.h"
+
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS) && HAVE_TCP_SOCKETS
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <rthreads/rthreads.h>
+
+#define SERIALIO_RING_SIZE	8192	/* Must be ^2 */
+#define SERIALIO_RING_MASK	(SERIALIO_RING_SIZE-1)
+#define SERIALIO_MAX_DEVICES	4
+#define SERIALIO_EOF_RETRY_MS	20	/* delay before reading again an input file at its end */
+
+typedef struct {
+	Uint8 data[SERIALIO_RING_SIZE];
+	Uint32 head;				/* updated by the producer only */
+	Uint32 tail;				/* updated by the consumer only */
+} serialio_ring_t;
+
+struct serialio_s {
+	bool used;
+	bool closing;				/* closed by the emulation, to be freed once output is sent */
+	int inFd, outFd;			/* -1 when not open, or peer not connected */
+	int listenFd;				/* TCP socket waiting for a peer, or -1 */
+	bool socketIn, socketOut;		/* input/output is the TCP endpoint */
+	bool inAtEof;				/* input file reached its end, retried later */
+	serialio_ring_t rx;			/* worker -> emulation */
+	serialio_ring_t tx;			/* emulation -> worker */
+};
+
+static struct {
+	sthread_t *thread;
+	slock_t *lock;				/* protects the device table, not the rings */
+	int wakeFd[2];				/* pipe to wake the worker from poll() */
+	unsigned int gen;			/* incremented on each device table change */
+	bool quit;
+	bool failedInit;			/* thread creation failed, don't retry */
+	serialio_t devices[SERIALIO_MAX_DEVICES];
+} io = { .wakeFd = { -1, -1 } };
+
+enum {
+	SERIALIO_POLL_IN,
+	SERIALIO_POLL_OUT,
+	SERIALIO_POLL_LISTEN
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wake the worker thread, to make it update the list of polled endpoints
+ */
+static void SerialIO_Wake(void)
+{
+	char c = 0;
+
+	if (write(io.wakeFd[1], &c, 1) < 0)
+	{
+		/* pipe is full: worker will wake up anyway */
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set options for a socket used to exchange data with a peer
+ */
+static void SerialIO_SetupSocket(int sock)
+{
+	int one = 1;
+
+	fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+	setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+	setsockopt(sock, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open a "tcp:<host>:<port>" or "tcp::<port>" endpoint. Return the
+ * socket, or -1 on error. Connecting is non-blocking, data is sent once
+ * the connection is established.
+ */
+static int SerialIO_OpenSocket(const char *pszName, bool *pbListen)
+{
+	struct addrinfo hints, *res, *ai;
+	const char *pszHost = pszName + 4;
+	const char *pszPort;
+	char host[256];
+	int sock = -1, one = 1;
+
+	pszPort = strrchr(pszHost, ':');
+	if (!pszPort || pszPort - pszHost >= (int)sizeof(host))
+	{
+		Log_Printf(LOG_WARN, "Invalid TCP endpoint '%s', use tcp:<host>:<port> or tcp::<port>\n", pszName);
+		return -1;
+	}
+	memcpy(host, pszHost, pszPort - pszHost);
+	host[pszPort - pszHost] = '\0';
+	pszPort++;
+	*pbListen = (host[0] == '\0');
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (*pbListen)
+		hints.ai_flags = AI_PASSIVE;
+	if (getaddrinfo(*pbListen ? NULL : host, pszPort, &hints, &res) != 0)
+	{
+		Log_Printf(LOG_WARN, "Can't resolve TCP endpoint '%s'\n", pszName);
+		return -1;
+	}
+
+	for (ai = res; ai; ai = ai->ai_next)
+	{
+		sock = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+		if (sock < 0)
+			continue;
+		if (*pbListen)
+		{
+			setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+			if (bind(sock, ai->ai_addr, ai->ai_addrlen) == 0 && listen(sock, 1) == 0)
+			{
+				fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+				break;
+			}
+		}
+		else
+		{
+			SerialIO_SetupSocket(sock);
+			if (connect(sock, ai->ai_addr, ai->ai_addrlen) == 0 || errno == EINPROGRESS)
+				break;
+		}
+		close(sock);
+		sock = -1;
+	}
+	freeaddrinfo(res);
+
+	if (sock < 0)
+		Log_Printf(LOG_WARN, "Can't open TCP endpoint '%s': %s\n", pszName, strerror(errno));
+	return sock;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open a file or tty endpoint, return its file descriptor or -1.
+ * "stdin", "stdout" and "stderr" can be used like with File_Open().
+ */
+static int SerialIO_OpenFile(const char *pszName, bool bOutput, bool bAppend)
+{
+	int fd;
+
+	if (!bOutput && strcmp(pszName, "stdin") == 0)
+		return dup(STDIN_FILENO);
+	if (bOutput && strcmp(pszName, "stdout") == 0)
+		return dup(STDOUT_FILENO);
+	if (bOutput && strcmp(pszName, "stderr") == 0)
+		return dup(STDERR_FILENO);
+
+	if (bOutput)
+		fd = open(pszName, O_WRONLY | O_CREAT | O_NOCTTY | O_NONBLOCK | (bAppend ? O_APPEND : O_TRUNC), 0644);
+	else
+		fd = open(pszName, O_RDONLY | O_NOCTTY | O_NONBLOCK);
+	if (fd < 0)
+		Log_Printf(LOG_WARN, "Can't open '%s': %s\n", pszName, strerror(errno));
+	return fd;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close the connection with the current TCP peer, a listening endpoint
+ * will then accept a new peer.
+ */
+static void SerialIO_Disconnect(serialio_t *dev)
+{
+	int sock = dev->socketIn ? dev->inFd : dev->outFd;
+
+	if (sock >= 0)
+		close(sock);
+	if (dev->socketIn)
+		dev->inFd = -1;
+	if (dev->socketOut)
+		dev->outFd = -1;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close all the endpoints of a device
+ */
+static void SerialIO_CloseFds(serialio_t *dev)
+{
+	if (dev->inFd >= 0)
+		close(dev->inFd);
+	if (dev->outFd >= 0 && dev->outFd != dev->inFd)
+		close(dev->outFd);
+	if (dev->listenFd >= 0)
+		close(dev->listenFd);
+	dev->inFd = dev->outFd = dev->listenFd = -1;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Worker: read available input bytes into the device's rx ring
+ */
+static void SerialIO_DoRead(serialio_t *dev)
+{
+	serialio_ring_t *ring = &dev->rx;
+	Uint32 head = ring->head;
+	Uint32 pos = head & SERIALIO_RING_MASK;
+	Uint32 space = SERIALIO_RING_SIZE - (head - __atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST));
+	ssize_t n;
+
+	if (space > SERIALIO_RING_SIZE - pos)
+		space = SERIALIO_RING_SIZE - pos;
+	if (space == 0)
+		return;
+
+	n = read(dev->inFd, &ring->data[pos], space);
+	if (n > 0)
+		__atomic_store_n(&ring->head, head + n, __ATOMIC_SEQ_CST);
+	else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+		return;
+	else if (dev->socketIn)
+	{
+		Log_Printf(LOG_INFO, "Serial peer disconnected\n");
+		SerialIO_Disconnect(dev);
+	}
+	else
+		dev->inAtEof = true;			/* try again later, like 'tail -f' */
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Worker: write bytes from the device's tx ring
+ */
+static void SerialIO_DoWrite(serialio_t *dev)
+{
+	serialio_ring_t *ring = &dev->tx;
+	Uint32 tail = ring->tail;
+	Uint32 pos = tail & SERIALIO_RING_MASK;
+	Uint32 count = __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) - tail;
+	ssize_t n;
+
+	if (count > SERIALIO_RING_SIZE - pos)
+		count = SERIALIO_RING_SIZE - pos;
+	if (count == 0)
+		return;
+
+#ifdef MSG_NOSIGNAL
+	if (dev->socketOut)
+		n = send(dev->outFd, &ring->data[pos], count, MSG_NOSIGNAL);
+	else
+#endif
+		n = write(dev->outFd, &ring->data[pos], count);
+
+	if (n > 0)
+		__atomic_store_n(&ring->tail, tail + n, __ATOMIC_SEQ_CST);
+	else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+		return;
+	else if (dev->socketOut)
+	{
+		Log_Printf(LOG_INFO, "Serial peer disconnected\n");
+		SerialIO_Disconnect(dev);
+	}
+	else
+	{
+		/* Output can't be written anymore, drop the data */
+		Log_Printf(LOG_WARN, "Serial output write failed: %s\n", strerror(errno));
+		__atomic_store_n(&ring->tail, tail + count, __ATOMIC_SEQ_CST);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Worker: accept a new TCP peer on a listening endpoint
+ */
+static void SerialIO_DoAccept(serialio_t *dev)
+{
+	int sock;
+
+	sock = accept(dev->listenFd, NULL, NULL);
+	if (sock < 0)
+		return;
+	SerialIO_SetupSocket(sock);
+	if (dev->socketIn)
+		dev->inFd = sock;
+	if (dev->socketOut)
+		dev->outFd = sock;
+	Log_Printf(LOG_INFO, "Serial peer connected\n");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Worker thread: poll all the endpoints and move the data between them
+ * and the rings, until SerialIO_UnInit() is called.
+ */
+static void SerialIO_ThreadFunc(void *data)
+{
+	struct pollfd fds[1 + 3 * SERIALIO_MAX_DEVICES];
+	struct {
+		serialio_t *dev;
+		int what;
+	} ref[1 + 3 * SERIALIO_MAX_DEVICES];
+	serialio_t *dev;
+	unsigned int gen;
+	int i, n, nfds, timeout;
+	char buf[64];
+
+	slock_lock(io.lock);
+	while (!io.quit)
+	{
+		fds[0].fd = io.wakeFd[0];
+		fds[0].events = POLLIN;
+		nfds = 1;
+		timeout = -1;
+
+		for (i = 0; i < SERIALIO_MAX_DEVICES; i++)
+		{
+			dev = &io.devices[i];
+			if (!dev->used)
+				continue;
+
+			if (dev->closing && (dev->outFd < 0 || dev->tx.head == dev->tx.tail))
+			{
+				SerialIO_CloseFds(dev);
+				dev->closing = false;
+				dev->used = false;
+				continue;
+			}
+			if (dev->listenFd >= 0 && (dev->socketIn ? dev->inFd : dev->outFd) < 0)
+			{
+				fds[nfds].fd = dev->listenFd;
+				fds[nfds].events = POLLIN;
+				ref[nfds].dev = dev;
+				ref[nfds++].what = SERIALIO_POLL_LISTEN;
+			}
+			if (dev->inFd >= 0 && !dev->closing)
+			{
+				if (dev->inAtEof)
+					timeout = SERIALIO_EOF_RETRY_MS;
+				else if (__atomic_load_n(&dev->rx.head, __ATOMIC_SEQ_CST)
+				         - __atomic_load_n(&dev->rx.tail, __ATOMIC_SEQ_CST) < SERIALIO_RING_SIZE)
+				{
+					fds[nfds].fd = dev->inFd;
+					fds[nfds].events = POLLIN;
+					ref[nfds].dev = dev;
+					ref[nfds++].what = SERIALIO_POLL_IN;
+				}
+			}
+			if (dev->outFd >= 0 && __atomic_load_n(&dev->tx.head, __ATOMIC_SEQ_CST)
+			                       != __atomic_load_n(&dev->tx.tail, __ATOMIC_SEQ_CST))
+			{
+				fds[nfds].fd = dev->outFd;
+				fds[nfds].events = POLLOUT;
+				ref[nfds].dev = dev;
+				ref[nfds++].what = SERIALIO_POLL_OUT;
+			}
+		}
+		gen = io.gen;
+		slock_unlock(io.lock);
+
+		n = poll(fds, nfds, timeout);
+		if (n > 0 && (fds[0].revents & POLLIN))
+		{
+			while (read(io.wakeFd[0], buf, sizeof(buf)) > 0)
+				;
+		}
+
+		slock_lock(io.lock);
+		if (n == 0)
+		{
+			for (i = 0; i < SERIALIO_MAX_DEVICES; i++)
+				io.devices[i].inAtEof = false;
+		}
+		if (n <= 0 || gen != io.gen)
+			continue;
+
+		for (i = 1; i < nfds; i++)
+		{
+			if (!fds[i].revents)
+				continue;
+			dev = ref[i].dev;
+			switch (ref[i].what)
+			{
+			 case SERIALIO_POLL_LISTEN:
+				SerialIO_DoAccept(dev);
+				break;
+			 case SERIALIO_POLL_IN:
+				if (dev->inFd == fds[i].fd)
+					SerialIO_DoRead(dev);
+				break;
+			 case SERIALIO_POLL_OUT:
+				if (dev->outFd == fds[i].fd)
+					SerialIO_DoWrite(dev);
+				break;
+			}
+		}
+	}
+	slock_unlock(io.lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the worker thread if not done yet, return true if it's running
+ */
+static bool SerialIO_Start(void)
+{
+	if (io.thread)
+		return true;
+	if (io.failedInit)
+		return false;
+
+	io.lock = slock_new();
+	if (io.lock && pipe(io.wakeFd) == 0)
+	{
+		fcntl(io.wakeFd[0], F_SETFL, fcntl(io.wakeFd[0], F_GETFL) | O_NONBLOCK);
+		fcntl(io.wakeFd[1], F_SETFL, fcntl(io.wakeFd[1], F_GETFL) | O_NONBLOCK);
+		io.quit = false;
+		io.thread = sthread_create(SerialIO_ThreadFunc, NULL);
+	}
+
+	if (!io.thread)
+	{
+		Log_Printf(LOG_WARN, "Can't start the serial I/O thread, RS232 and printer output disabled.\n");
+		io.failedInit = true;
+		if (io.wakeFd[0] >= 0)
+		{
+			close(io.wakeFd[0]);
+			close(io.wakeFd[1]);
+			io.wakeFd[0] = io.wakeFd[1] = -1;
+		}
+		if (io.lock)
+			slock_free(io.lock);
+		io.lock = NULL;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open a device with the given input and output endpoints (NULL or ""
+ * when not used). bAppend tells whether an output file is appended to,
+ * or truncated. Return NULL on error.
+ */
+serialio_t *SerialIO_Open(const char *pszInName, const char *pszOutName, bool bAppend)
+{
+	bool bInTcp, bOutTcp, bListen = false;
+	serialio_t *dev = NULL;
+	int i, sock;
+
+	if (pszInName && !*pszInName)
+		pszInName = NULL;
+	if (pszOutName && !*pszOutName)
+		pszOutName = NULL;
+	bInTcp = pszInName && strncmp(pszInName, "tcp:", 4) == 0;
+	bOutTcp = pszOutName && strncmp(pszOutName, "tcp:", 4) == 0;
+
+	if (bInTcp && bOutTcp && strcmp(pszInName, pszOutName) != 0)
+	{
+		Log_Printf(LOG_WARN, "Serial input and output can't use different TCP endpoints\n");
+		return NULL;
+	}
+	if (!SerialIO_Start())
+		return NULL;
+
+	slock_lock(io.lock);
+	for (i = 0; i < SERIALIO_MAX_DEVICES; i++)
+	{
+		if (!io.devices[i].used)
+		{
+			dev = &io.devices[i];
+			break;
+		}
+	}
+	if (!dev)
+	{
+		slock_unlock(io.lock);
+		return NULL;
+	}
+	memset(dev, 0, sizeof(*dev));
+	dev->inFd = dev->outFd = dev->listenFd = -1;
+
+	if (bInTcp || bOutTcp)
+	{
+		sock = SerialIO_OpenSocket(bInTcp ? pszInName : pszOutName, &bListen);
+		if (sock < 0)
+			goto error;
+		dev->socketIn = bInTcp;
+		dev->socketOut = bOutTcp;
+		if (bListen)
+			dev->listenFd = sock;
+		else
+		{
+			if (bInTcp)
+				dev->inFd = sock;
+			if (bOutTcp)
+				dev->outFd = sock;
+		}
+	}
+	if (pszInName && !bInTcp)
+	{
+		dev->inFd = SerialIO_OpenFile(pszInName, false, false);
+		if (dev->inFd < 0)
+			goto error;
+	}
+	if (pszOutName && !bOutTcp)
+	{
+		dev->outFd = SerialIO_OpenFile(pszOutName, true, bAppend);
+		if (dev->outFd < 0)
+			goto error;
+	}
+
+	dev->used = true;
+	io.gen++;
+	slock_unlock(io.lock);
+	SerialIO_Wake();
+	return dev;
+
+error:
+	SerialIO_CloseFds(dev);
+	slock_unlock(io.lock);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close a device. Bytes still in its output ring are written before
+ * the endpoints are closed by the worker.
+ */
+void SerialIO_Close(serialio_t *dev)
+{
+	if (!dev)
+		return;
+	slock_lock(io.lock);
+	dev->closing = true;
+	io.gen++;
+	slock_unlock(io.lock);
+	SerialIO_Wake();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue bytes to send to the device's output. Return false (and drop
+ * the bytes) if there isn't enough room for them.
+ */
+bool SerialIO_Write(serialio_t *dev, const Uint8 *pData, int nSize)
+{
+	serialio_ring_t *ring = &dev->tx;
+	Uint32 head = ring->head;
+	int i;
+
+	if (nSize > (int)(SERIALIO_RING_SIZE - (head - __atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST))))
+		return false;
+
+	for (i = 0; i < nSize; i++)
+		ring->data[(head + i) & SERIALIO_RING_MASK] = pData[i];
+	__atomic_store_n(&ring->head, head + nSize, __ATOMIC_SEQ_CST);
+
+	/* If the worker had sent everything, it doesn't poll the output anymore */
+	if (__atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST) == head)
+		SerialIO_Wake();
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read up to nSize received bytes, return the number of bytes read
+ */
+int SerialIO_Read(serialio_t *dev, Uint8 *pData, int nSize)
+{
+	serialio_ring_t *ring = &dev->rx;
+	Uint32 tail = ring->tail;
+	Uint32 count = __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) - tail;
+	int i;
+
+	if (nSize > (int)count)
+		nSize = count;
+	for (i = 0; i < nSize; i++)
+		pData[i] = ring->data[(tail + i) & SERIALIO_RING_MASK];
+	__atomic_store_n(&ring->tail, tail + nSize, __ATOMIC_SEQ_CST);
+
+	/* If the ring was full, the worker doesn't poll the input anymore */
+	if (nSize > 0 && __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) - tail >= SERIALIO_RING_SIZE)
+		SerialIO_Wake();
+	return nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of received bytes waiting to be read
+ */
+int SerialIO_Available(serialio_t *dev)
+{
+	return __atomic_load_n(&dev->rx.head, __ATOMIC_ACQUIRE) - dev->rx.tail;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the file descriptor of the device's input or output (e.g. to
+ * configure a tty), or -1
+ */
+int SerialIO_GetFd(serialio_t *dev, bool bOutput)
+{
+	return bOutput ? dev->outFd : dev->inFd;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the worker thread and close all devices
+ */
+void SerialIO_UnInit(void)
+{
+	int i;
+
+	if (!io.thread)
+		return;
+
+	slock_lock(io.lock);
+	io.quit = true;
+	slock_unlock(io.lock);
+	SerialIO_Wake();
+	sthread_join(io.thread);
+	io.thread = NULL;
+
+	for (i = 0; i < SERIALIO_MAX_DEVICES; i++)
+	{
+		if (io.devices[i].used)
+			SerialIO_CloseFds(&io.devices[i]);
+		io.devices[i].used = false;
+	}
+	close(io.wakeFd[0]);
+	close(io.wakeFd[1]);
+	io.wakeFd[0] = io.wakeFd[1] = -1;
+	slock_free(io.lock);
+	io.lock = NULL;
+}
+
+#else	/* no worker thread */
+
+struct serialio_s {
+	FILE *in, *out;
+	int peek;				/* byte read ahead from input, or EOF */
+};
+
+
+serialio_t *SerialIO_Open(const char *pszInName, const char *pszOutName, bool bAppend)
+{
+	serialio_t *dev = calloc(1, sizeof(*dev));
+
+	if (!dev)
+		return NULL;
+	dev->peek = EOF;
+	if (pszInName && *pszInName)
+	{
+		dev->in = File_Open(pszInName, "rb");
+		if (!dev->in)
+			goto error;
+		setvbuf(dev->in, NULL, _IONBF, 0);
+	}
+	if (pszOutName && *pszOutName)
+	{
+		dev->out = File_Open(pszOutName, bAppend ? "ab" : "wb");
+		if (!dev->out)
+			goto error;
+		setvbuf(dev->out, NULL, _IONBF, 0);
+	}
+	return dev;
+
+error:
+	SerialIO_Close(dev);
+	return NULL;
+}
+
+void SerialIO_Close(serialio_t *dev)
+{
+	if (!dev)
+		return;
+	File_Close(dev->in);
+	File_Close(dev->out);
+	free(dev);
+}
+
+bool SerialIO_Write(serialio_t *dev, const Uint8 *pData, int nSize)
+{
+	return dev->out && fwrite(pData, 1, nSize, dev->out) == (size_t)nSize;
+}
+
+int SerialIO_Available(serialio_t *dev)
+{
+	if (dev->peek == EOF && dev->in)
+	{
+		dev->peek = fgetc(dev->in);
+		if (dev->peek == EOF)
+			clearerr(dev->in);
+	}
+	return dev->peek != EOF;
+}
+
+int SerialIO_Read(serialio_t *dev, Uint8 *pData, int nSize)
+{
+	int n = 0;
+
+	while (n < nSize && SerialIO_Available(dev))
+	{
+		pData[n++] = dev->peek;
+		dev->peek = EOF;
+	}
+	return n;
+}
+
+int SerialIO_GetFd(serialio_t *dev, bool bOutput)
+{
+	FILE *fp = bOutput ? dev->out : dev->in;
+
+	return fp ? fileno(fp) : -1;
+}
+
+void SerialIO_UnInit(void)
+{
+}
+
+#endif
@@ -93,6 +93,8 @@ const char Sound_fileid[] = "Hatari sound.c : " __DATE__ " " __TIME__;
 #include "ymFormat.h"
 #include "avi_record.h"
 #include "clocks_timings.h"
+#include "perfcount.h"
+#include "metrics.h"
 
 
 
@@ -162,6 +164,15 @@ static ymu16 ymout5_u16[32][32][32];
 /* Same table, after conversion to signed results (same pointer, with different type) */
 static yms16 *ymout5 = (yms16 *)ymout5_u16;
 
+/* Compact version of ymout5 with only one entry for all the permutations */
+/* of 3 volumes (sorted as hi >= mid >= lo), which fits in the L1 cache. */
+/* Exact for the linear and model mixing, within 1 for the measured table. */
+#define YM_COMPACT_SIZE		( 32*33*34/6 )		/* 5984 combinations */
+static yms16 ymout5_compact[ YM_COMPACT_SIZE ];
+static ymu16 YmCompactOffsetHi[ 32 ];			/* combinations with a lower hi */
+static ymu16 YmCompactOffsetMid[ 32 ];			/* combinations with a lower mid */
+static bool YmVolumeCompact;				/* use ymout5_compact instead of ymout5 */
+
 
 
 /*--------------------------------------------------------------*/
@@ -206,11 +217,36 @@ static ymu32	noiseStep;
 static ymu32	noisePos;
 static ymu32	currentNoise;
 static ymu32	RndRack;				/* current random seed */
+#define YM_RND_BITS	17				/* LFSR length */
+static ymu32	RndJumpTable[ 32 ][ YM_RND_BITS ];	/* LFSR state from each bit after 2^i steps */
 
 static ymu32	envStep;
 static ymu32	envPos;
 static int	envShape;
 
+static yms32	LowPass_y0, LowPass_x1;			/* LowPassFilter() state */
+static yms32	PWMalias_y0, PWMalias_x1;		/* PWMaliasFilter() state */
+
+/* High quality engine, YM2149 run at its own tick rate (MasterClock / 8)	*/
+/* and decimated to the replay freq with a polyphase FIR filter		*/
+#define YM_HQ_TAPS	128			/* FIR length, in YM ticks */
+#define YM_HQ_PHASE_BITS	6
+#define YM_HQ_PHASES	(1 << YM_HQ_PHASE_BITS)	/* FIR phases between 2 YM ticks */
+#define YM_HQ_FRAC_BITS	16
+
+static struct {
+	ymu32	cntA, cntB, cntC;		/* tone counters, in YM ticks */
+	ymu32	outA, outB, outC;		/* tone outputs : 0 or 0xffff */
+	ymu32	cntNoise;
+	ymu32	cntEnv;
+	ymu32	frac;				/* output position after last tick */
+	ymu32	ratio;				/* YM ticks per output sample */
+	int	histPos;
+	int	rateIn, rateOut;		/* FIR was built for these */
+	yms16	hist[ 2 * YM_HQ_TAPS ];		/* 2 copies, for a linear window */
+	yms16	coefs[ YM_HQ_PHASES ][ YM_HQ_TAPS ];
+} YmHQ;
+
 static ymu16	EnvMask3Voices = 0;			/* mask is 0x1f for voices having an active envelope */
 static ymu16	Vol3Voices = 0;				/* volume 0-0x1f for voices having a constant volume */
 							/* volume is set to 0 if voice has an envelope in EnvMask3Voices */
@@ -235,19 +271,29 @@ static int	CurrentSamplesNb = 0;			/* Number of samples already generated for th
 
 bool		Sound_BufferIndexNeedReset = false;
 
+/* YM register writes waiting for the samples before them to be generated */
+#define YM_QUEUE_SIZE	4096
+static struct {
+	int	Pos;					/* sample of the VBL the write is done before */
+	Uint8	Reg;
+	Uint8	Data;
+} YmQueue[ YM_QUEUE_SIZE ];
+static int	YmQueueHead, YmQueueTail;
+
 
 /*--------------------------------------------------------------*/
 /* Local functions prototypes					*/
 /*--------------------------------------------------------------*/
 
 static ymsample	LowPassFilter		(ymsample x0);
-static ymsample	PWMaliasFilter		(ymsample x0);
 
 static void	interpolate_volumetable	(ymu16 volumetable[32][32][32]);
 
 static void	YM2149_BuildModelVolumeTable(ymu16 volumetable[32][32][32]);
 static void	YM2149_BuildLinearVolumeTable(ymu16 volumetable[32][32][32]);
 static void	YM2149_Normalise_5bit_Table(ymu16 *in_5bit , yms16 *out_5bit, unsigned int Level, bool DoCenter);
+static void	YM2149_BuildCompactVolumeTable(void);
+static inline yms16 YM2149_Volume	(ymu16 Tone3Voices);
 
 static void	YM2149_EnvBuild		(void);
 static void	Ym2149_BuildVolumeTable	(void);
@@ -258,9 +304,14 @@ static ymu32	YM2149_RndCompute	(void);
 static ymu32	Ym2149_ToneStepCompute	(ymu8 rHigh , ymu8 rLow);
 static ymu32	Ym2149_NoiseStepCompute	(ymu8 rNoise);
 static ymu32	Ym2149_EnvStepCompute	(ymu8 rHigh , ymu8 rLow);
-static ymsample	YM2149_NextSample	(void);
+static void	YM2149_DoSamples	(ymsample *pBuffer, int nSamples);
+static void	YM2149_DoSamples_HQ	(ymsample *pBuffer, int nSamples);
+static void	YM2149_RndJumpBuild	(void);
+static void	Ym2149_Advance		(int nSamples);
 
+static int	Sound_GetSamplesPassed(void);
 static int	Sound_SetSamplesPassed(bool FillFrame);
+static void	Sound_WriteQueuedRegs(int nPos);
 static void	Sound_GenerateSamples(int SamplesToGenerate);
 
 
@@ -340,7 +391,7 @@ ymsample	Subsonic_IIR_HPF_Right(ymsample x0)
  */
 static ymsample	LowPassFilter(ymsample x0)
 {
-	static	yms32 y0 = 0, x1 = 0;
+	yms32 y0 = LowPass_y0, x1 = LowPass_x1;
 
 	if (x0 >= y0)
 	/* YM Pull up:   fc = 7586.1 Hz (44.1 KHz), fc = 8257.0 Hz (48 KHz) */
@@ -349,35 +400,8 @@ static ymsample	LowPassFilter(ymsample x0)
 	/* R8 Pull down: fc = 1992.0 Hz (44.1 KHz), fc = 2168.0 Hz (48 KHz) */
 		y0 = ((x0 + x1) + (6*y0)) >> 3;
 
-	x1 = x0;
-	return y0;
-}
-
-/**
- * This piecewise selective filter works by filtering the falling
- * edge of a sampled pulse-wave differently from the rising edge.
- *
- * Piecewise selective filtering is effective because harmonics on
- * one part of a wave partially define harmonics on other portions.
- *
- * Piecewise selective filtering can efficiently reduce aliasing
- * with minimal harmonic removal.
- *
- * I disclose this information into the public domain so that it
- * cannot be patented. May 23 2012 David Savinkoff.
- */
-static ymsample	PWMaliasFilter(ymsample x0)
-{
-	static	yms32 y0 = 0, x1 = 0;
-
-	if (x0 >= y0)
-	/* YM Pull up   */
-		y0 = x0;
-	else
-	/* R8 Pull down */
-		y0 = (3*(x0 + x1) + (y0<<1)) >> 3;
-
-	x1 = x0;
+	LowPass_y0 = y0;
+	LowPass_x1 = x0;
 	return y0;
 }
 
@@ -614,6 +638,59 @@ static void	YM2149_Normalise_5bit_Table(ymu16 *in_5bit , yms16 *out_5bit, unsign
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Build ymout5_compact from ymout5 : the 3 volumes of each entry are
+ * sorted, so only 5984 of the 32768 entries are kept. Each entry is
+ * taken from ymout5 with the volumes in C >= B >= A order.
+ */
+
+static void	YM2149_BuildCompactVolumeTable(void)
+{
+	int	hi, mid, lo;
+
+	for (hi = 0; hi < 32; hi++)
+	{
+		YmCompactOffsetHi[ hi ] = hi * (hi+1) * (hi+2) / 6;
+		YmCompactOffsetMid[ hi ] = hi * (hi+1) / 2;
+	}
+
+	for (hi = 0; hi < 32; hi++)
+		for (mid = 0; mid <= hi; mid++)
+			for (lo = 0; lo <= mid; lo++)
+				ymout5_compact[ YmCompactOffsetHi[hi] + YmCompactOffsetMid[mid] + lo ]
+					= ymout5[ YM_MERGE_VOICE ( hi , mid , lo ) ];
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * D/A conversion of the 3 volumes into a sample, using either the full
+ * conversion table or the compact one.
+ */
+
+static inline yms16	YM2149_Volume(ymu16 Tone3Voices)
+{
+	ymu16	a, b, c, t;
+
+	if ( !YmVolumeCompact )
+		return ymout5[ Tone3Voices ];
+
+	a = Tone3Voices & YM_MASK_1VOICE;
+	b = ( Tone3Voices >> 5 ) & YM_MASK_1VOICE;
+	c = Tone3Voices >> 10;
+
+	/* sort the 3 volumes, so that c >= b >= a */
+	if ( a > b )	{ t = a; a = b; b = t; }
+	if ( b > c )	{ t = b; b = c; c = t; }
+	if ( a > b )	{ t = a; a = b; b = t; }
+
+	return ymout5_compact[ YmCompactOffsetHi[c] + YmCompactOffsetMid[b] + a ];
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Precompute all 16 possible envelopes.
@@ -673,6 +750,9 @@ static void	Ym2149_BuildVolumeTable(void)
 		YM2149_Normalise_5bit_Table ( ymout5_u16[0][0] , ymout5 , (YM_OUTPUT_LEVEL>>1) , YM_OUTPUT_CENTERED );
 	else
 		YM2149_Normalise_5bit_Table ( ymout5_u16[0][0] , ymout5 , YM_OUTPUT_LEVEL , YM_OUTPUT_CENTERED );
+
+	YM2149_BuildCompactVolumeTable();
+	YmVolumeCompact = ConfigureParams.Sound.bYmCompactVolume;
 }
 
 
@@ -691,6 +771,9 @@ static void	Ym2149_Init(void)
 	/* Build the volume conversion table */
 	Ym2149_BuildVolumeTable();
 
+	/* Build the noise LFSR jump table */
+	YM2149_RndJumpBuild();
+
 	/* Reset YM2149 internal states */
 	Ym2149_Reset();
 }
@@ -721,6 +804,10 @@ static void	Ym2149_Reset(void)
 
 	envShape = 0;
 	envPos = 0;
+
+	YmHQ.cntA = YmHQ.cntB = YmHQ.cntC = 0;
+	YmHQ.outA = YmHQ.outB = YmHQ.outC = 0;
+	YmHQ.cntNoise = YmHQ.cntEnv = 0;
 }
 
 
@@ -909,6 +996,35 @@ static ymu32	Ym2149_EnvStepCompute(ymu8 rHigh , ymu8 rLow)
  */
 
 #ifndef NEWSTEP
+/**
+ * This piecewise selective filter works by filtering the falling
+ * edge of a sampled pulse-wave differently from the rising edge.
+ *
+ * Piecewise selective filtering is effective because harmonics on
+ * one part of a wave partially define harmonics on other portions.
+ *
+ * Piecewise selective filtering can efficiently reduce aliasing
+ * with minimal harmonic removal.
+ *
+ * I disclose this information into the public domain so that it
+ * cannot be patented. May 23 2012 David Savinkoff.
+ */
+static ymsample	PWMaliasFilter(ymsample x0)
+{
+	yms32 y0 = PWMalias_y0, x1 = PWMalias_x1;
+
+	if (x0 >= y0)
+	/* YM Pull up   */
+		y0 = x0;
+	else
+	/* R8 Pull down */
+		y0 = (3*(x0 + x1) + (y0<<1)) >> 3;
+
+	PWMalias_y0 = y0;
+	PWMalias_x1 = x0;
+	return y0;
+}
+
 static ymsample	YM2149_NextSample(void)
 {
 	ymsample	sample;
@@ -959,7 +1075,7 @@ static ymsample	YM2149_NextSample(void)
 
 	/* D/A conversion of the 3 volumes into a sample using a precomputed conversion table */
 
-	sample = ymout5[ Tone3Voices ];			/* 16 bits signed value */
+	sample = YM2149_Volume ( Tone3Voices );		/* 16 bits signed value */
 
 
 	/* Increment positions */
@@ -978,76 +1094,484 @@ static ymsample	YM2149_NextSample(void)
 	else
 		return PWMaliasFilter(sample);
 }
+
+static void	YM2149_DoSamples(ymsample *pBuffer, int nSamples)
+{
+	while (nSamples-- > 0)
+		*pBuffer++ = YM2149_NextSample();
+}
 #else
-static ymsample	YM2149_NextSample(void)
+/**
+ * Compute 'nSamples' samples into pBuffer. The generator and filter
+ * state is loaded into local variables once per block (there are no
+ * register writes within a block), which lets the compiler keep it
+ * in registers instead of updating the globals on every sample.
+ */
+static void	YM2149_DoSamples(ymsample *pBuffer, int nSamples)
 {
-	ymsample	sample;
+	ymu32		pA = posA, pB = posB, pC = posC;
+	const ymu32	sA = stepA, sB = stepB, sC = stepC;
+	const ymu32	tA = mixerTA, tB = mixerTB, tC = mixerTC;
+	const ymu32	nA = mixerNA, nB = mixerNB, nC = mixerNC;
+	ymu32		nPos = noisePos;
+	const ymu32	nStep = noiseStep;
+	ymu32		bn = currentNoise;		/* 0 or 0xffff */
+	ymu32		ePos = envPos;
+	const ymu32	eStep = envStep;
+	const ymu16	*pEnv = YmEnvWaves[ envShape ];
+	const ymu16	EnvMask = EnvMask3Voices;
+	const ymu16	Vol = Vol3Voices;
+	const bool	bLowPass = UseLowPassFilter;
+	yms32		y0, x1;
 	ymu32		bt;
-	ymu32		bn;
-	ymu16		Env3Voices;			/* 0x00CCBBAA */
 	ymu16		Tone3Voices;			/* 0x00CCBBAA */
+	yms32		sample;
+	int		i;
 
+	if ( bLowPass )
+	{
+		y0 = LowPass_y0;
+		x1 = LowPass_x1;
+	}
+	else
+	{
+		y0 = PWMalias_y0;
+		x1 = PWMalias_x1;
+	}
 
-	/* Noise value : 0 or 0xffff */
-	if ( noisePos&0xff000000 )			/* integer part > 0 */
+	for (i = 0; i < nSamples; i++)
 	{
-		currentNoise = YM2149_RndCompute();
-		noisePos &= 0xffffff;			/* keep fractional part of noisePos */
+		/* Noise value : 0 or 0xffff */
+		if ( nPos&0xff000000 )			/* integer part > 0 */
+		{
+			bn = YM2149_RndCompute();
+			nPos &= 0xffffff;		/* keep fractional part of noisePos */
+		}
+
+		/* Tone3Voices will contain the output state of each voice : 0 or 0x1f */
+		bt = -( (pA>>24) & 1);			/* 0 if bit24=0 or 0xffffffff if bit24=1 */
+		bt = (bt | tA) & (bn | nA);		/* 0 or 0xffff */
+		Tone3Voices = bt & YM_MASK_1VOICE;	/* 0 or 0x1f */
+		bt = -( (pB>>24) & 1);
+		bt = (bt | tB) & (bn | nB);
+		Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 5;
+		bt = -( (pC>>24) & 1);
+		bt = (bt | tC) & (bn | nC);
+		Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 10;
+
+		/* Combine fixed volumes and the envelope volume at the current */
+		/* position (integer part of envPos is in bits 24-31), and keep */
+		/* the volumes depending on the output state of each voice */
+		Tone3Voices &= ( ( pEnv[ ePos>>24 ] & EnvMask ) | Vol );
+
+		/* When a step period is 0, the represented frequency was filtered  */
+		/* from the ouput of the YM2149 : remove the voice's AC component, */
+		/* the transient DC component remains ("-1" is a good fit for it)  */
+		if (sA == 0  &&  (Tone3Voices & YM_MASK_A) > 1)
+			Tone3Voices -= 1;
+		if (sB == 0  &&  (Tone3Voices & YM_MASK_B) > 1<<5)
+			Tone3Voices -= 1<<5;
+		if (sC == 0  &&  (Tone3Voices & YM_MASK_C) > 1<<10)
+			Tone3Voices -= 1<<10;
+
+		/* D/A conversion of the 3 volumes into a sample */
+		sample = YM2149_Volume ( Tone3Voices );	/* 16 bits signed value */
+
+		/* Increment positions */
+		pA += sA;
+		pB += sB;
+		pC += sC;
+		nPos += nStep;
+
+		ePos += eStep;
+		if ( ePos >= (3*32) << 24 )		/* blocks 0, 1 and 2 were used (envPos 0 to 95) */
+			ePos -= (2*32) << 24;		/* replay/loop blocks 1 and 2 (envPos 32 to 95) */
+
+		/* Low pass filter or PWM alias filter, as in LowPassFilter() and PWMaliasFilter() */
+		if ( sample >= y0 )
+			y0 = bLowPass ? (3*(sample + x1) + (y0<<1)) >> 3 : sample;
+		else if ( bLowPass )
+			y0 = ((sample + x1) + (6*y0)) >> 3;
+		else
+			y0 = (3*(sample + x1) + (y0<<1)) >> 3;
+		x1 = sample;
+
+		pBuffer[i] = y0;
 	}
-	bn = currentNoise;				/* 0 or 0xffff */
 
-	/* Get the 5 bits volume corresponding to the current envelope's position */
-	Env3Voices = YmEnvWaves[ envShape ][ envPos>>24 ];	/* integer part of envPos is in bits 24-31 */
-	Env3Voices &= EnvMask3Voices;			/* only keep volumes for voices using envelope */
+	posA = pA;
+	posB = pB;
+	posC = pC;
+	noisePos = nPos;
+	currentNoise = bn;
+	envPos = ePos;
 
-//fprintf ( stderr , "env %x %x %x\n" , Env3Voices , envStep , envPos );
+	if ( bLowPass )
+	{
+		LowPass_y0 = y0;
+		LowPass_x1 = x1;
+	}
+	else
+	{
+		PWMalias_y0 = y0;
+		PWMalias_x1 = x1;
+	}
+}
+#endif
 
-	/* Tone3Voices will contain the output state of each voice : 0 or 0x1f */
-	bt = -( (posA>>24) & 1);			/* 0 if bit24=0 or 0xffffffff if bit24=1 */
-	bt = (bt | mixerTA) & (bn | mixerNA);		/* 0 or 0xffff */
-	Tone3Voices = bt & YM_MASK_1VOICE;		/* 0 or 0x1f */
-	bt = -( (posB>>24) & 1);
-	bt = (bt | mixerTB) & (bn | mixerNB);
-	Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 5;
-	bt = -( (posC>>24) & 1);
-	bt = (bt | mixerTC) & (bn | mixerNC);
-	Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 10;
 
-	/* Combine fixed volumes and envelope volumes and keep the resulting */
-	/* volumes depending on the output state of each voice (0 or 0x1f) */
-	Tone3Voices &= ( Env3Voices | Vol3Voices );
+/*-----------------------------------------------------------------------*/
+/**
+ * Modified Bessel function of order 0, for the Kaiser window
+ */
+static double	YM2149_HQ_BesselI0(double x)
+{
+	double	sum = 1.0, term = 1.0;
+	int	k;
 
-	/* D/A conversion of the 3 volumes into a sample using a precomputed conversion table */
+	for (k = 1; k < 32; k++)
+	{
+		term *= (x / (2*k)) * (x / (2*k));
+		sum += term;
+	}
+	return sum;
+}
 
-	if (stepA == 0  &&  (Tone3Voices & YM_MASK_A) > 1)
-		Tone3Voices -= 1;     /* Voice A AC component removed; Transient DC component remains */
+/**
+ * Build the polyphase FIR used to decimate YM ticks to the replay freq :
+ * a Kaiser windowed sinc with its cut off at 40% of the replay freq,
+ * sampled at YM_HQ_PHASES sub-tick positions. Each phase is normalised
+ * to a DC gain of 1 (<<15).
+ */
+static void	YM2149_HQ_BuildFilter(int rateIn, int rateOut)
+{
+	const double	beta = 8.0;			/* ~80 dB stop band */
+	double		fc = 0.4 * rateOut / rateIn;	/* in cycles per YM tick */
+	double		h[ YM_HQ_TAPS ], sum, t, x;
+	int		p, k, total, center;
 
-	if (stepB == 0  &&  (Tone3Voices & YM_MASK_B) > 1<<5)
-		Tone3Voices -= 1<<5;  /* Voice B AC component removed; Transient DC component remains */
+	for (p = 0; p < YM_HQ_PHASES; p++)
+	{
+		sum = 0;
+		for (k = 0; k < YM_HQ_TAPS; k++)
+		{
+			/* newest tick is in hist[YM_HQ_TAPS-1], a constant delay */
+			/* of YM_HQ_TAPS/2 ticks centers the window */
+			t = k - YM_HQ_TAPS/2 + 1 - (double)p / YM_HQ_PHASES;
+			x = t / (YM_HQ_TAPS/2);
+			h[k] = ( t == 0 ? 2*fc : sin(2*M_PI*fc*t) / (M_PI*t) )
+				* YM2149_HQ_BesselI0(beta * sqrt(x*x < 1 ? 1 - x*x : 0))
+				/ YM2149_HQ_BesselI0(beta);
+			sum += h[k];
+		}
+		total = 0;
+		for (k = 0; k < YM_HQ_TAPS; k++)
+		{
+			YmHQ.coefs[p][k] = (yms16)floor(h[k] / sum * (1<<15) + 0.5);
+			total += YmHQ.coefs[p][k];
+		}
+		center = YM_HQ_TAPS/2 - 1 + (p >= YM_HQ_PHASES/2);
+		YmHQ.coefs[p][center] += (1<<15) - total;	/* rounding error */
+	}
 
-	if (stepC == 0  &&  (Tone3Voices & YM_MASK_C) > 1<<10)
-		Tone3Voices -= 1<<10; /* Voice C AC component removed; Transient DC component remains */
+	YmHQ.rateIn = rateIn;
+	YmHQ.rateOut = rateOut;
+	YmHQ.ratio = ((yms64)rateIn << YM_HQ_FRAC_BITS) / rateOut;
+}
 
-	sample = ymout5[ Tone3Voices ];			/* 16 bits signed value */
 
+/*-----------------------------------------------------------------------*/
+/**
+ * High quality version of YM2149_DoSamples() : tone, noise and envelope
+ * counters are updated on each YM tick as in the real chip, where a tone
+ * output toggles every 'per' ticks, noise changes every 2*'per' ticks
+ * and the envelope steps every 'per' ticks. Ticks are then band limited
+ * before decimation, instead of aliasing on high frequency content.
+ */
+static void	YM2149_DoSamples_HQ(ymsample *pBuffer, int nSamples)
+{
+	ymu32		perA, perB, perC, perNoise, perEnv;
+	const ymu16	*pEnv = YmEnvWaves[ envShape ];
+	yms16		*pHist, *pCoef;
+	ymu32		bt, bn, ticks;
+	ymu16		Tone3Voices;
+	yms32		sum;
+	int		rateIn = YM_ATARI_CLOCK / 8;
+	int		i, k;
 
-	/* Increment positions */
-	posA += stepA;
-	posB += stepB;
-	posC += stepC;
-	noisePos += noiseStep;
+	if (YM_REPLAY_FREQ <= 0)
+	{
+		memset(pBuffer, 0, nSamples * sizeof(ymsample));
+		return;
+	}
+	if (YmHQ.rateIn != rateIn || YmHQ.rateOut != YM_REPLAY_FREQ)
+		YM2149_HQ_BuildFilter(rateIn, YM_REPLAY_FREQ);
+
+	perA = (SoundRegs[1] << 8) | SoundRegs[0];
+	perB = (SoundRegs[3] << 8) | SoundRegs[2];
+	perC = (SoundRegs[5] << 8) | SoundRegs[4];
+	perNoise = SoundRegs[6];
+	perEnv = (SoundRegs[12] << 8) | SoundRegs[11];
+
+	/* On the YM2149, period 0 gives the same result as period 1 */
+	if (perA == 0)
+		perA = 1;
+	if (perB == 0)
+		perB = 1;
+	if (perC == 0)
+		perC = 1;
+	if (perNoise == 0)
+		perNoise = 1;
+	perNoise *= 2;					/* noise runs at half the tone clock */
+	if (perEnv == 0)
+		perEnv = 1;
+
+	bn = currentNoise;
+
+	for (i = 0; i < nSamples; i++)
+	{
+		YmHQ.frac += YmHQ.ratio;
+		for (ticks = YmHQ.frac >> YM_HQ_FRAC_BITS; ticks > 0; ticks--)
+		{
+			if (++YmHQ.cntA >= perA)
+			{
+				YmHQ.cntA = 0;
+				YmHQ.outA ^= 0xffff;
+			}
+			if (++YmHQ.cntB >= perB)
+			{
+				YmHQ.cntB = 0;
+				YmHQ.outB ^= 0xffff;
+			}
+			if (++YmHQ.cntC >= perC)
+			{
+				YmHQ.cntC = 0;
+				YmHQ.outC ^= 0xffff;
+			}
+			if (++YmHQ.cntNoise >= perNoise)
+			{
+				YmHQ.cntNoise = 0;
+				bn = YM2149_RndCompute();
+			}
+			if (++YmHQ.cntEnv >= perEnv)
+			{
+				YmHQ.cntEnv = 0;
+				envPos += 1 << 24;
+				if ( envPos >= (3*32) << 24 )	/* replay/loop blocks 1 and 2 */
+					envPos -= (2*32) << 24;
+			}
 
-	envPos += envStep;
-	if ( envPos >= (3*32) << 24 )			/* blocks 0, 1 and 2 were used (envPos 0 to 95) */
-		envPos -= (2*32) << 24;			/* replay/loop blocks 1 and 2 (envPos 32 to 95) */
+			bt = (YmHQ.outA | mixerTA) & (bn | mixerNA);
+			Tone3Voices = bt & YM_MASK_1VOICE;
+			bt = (YmHQ.outB | mixerTB) & (bn | mixerNB);
+			Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 5;
+			bt = (YmHQ.outC | mixerTC) & (bn | mixerNC);
+			Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 10;
+			Tone3Voices &= ( ( pEnv[ envPos>>24 ] & EnvMask3Voices ) | Vol3Voices );
+
+			YmHQ.hist[ YmHQ.histPos ] = YmHQ.hist[ YmHQ.histPos + YM_HQ_TAPS ] = YM2149_Volume ( Tone3Voices );
+			if (++YmHQ.histPos == YM_HQ_TAPS)
+				YmHQ.histPos = 0;
+		}
+		YmHQ.frac &= (1 << YM_HQ_FRAC_BITS) - 1;
+
+		/* oldest to newest tick, with the filter phase for the output position */
+		pHist = &YmHQ.hist[ YmHQ.histPos ];
+		pCoef = YmHQ.coefs[ YmHQ.frac >> (YM_HQ_FRAC_BITS - YM_HQ_PHASE_BITS) ];
+		sum = 0;
+		for (k = 0; k < YM_HQ_TAPS; k++)
+			sum += pHist[k] * pCoef[k];
+		sum >>= 15;
+		if (sum > 32767)
+			sum = 32767;
+		else if (sum < -32768)
+			sum = -32768;
+
+		/* ST analog low pass filter, aliasing is already removed */
+		if ( UseLowPassFilter )
+			pBuffer[i] = LowPassFilter(sum);
+		else
+			pBuffer[i] = sum;
+	}
 
-	/* Apply low pass filter ? */
-	if ( UseLowPassFilter )
-		return LowPassFilter(sample);
+	currentNoise = bn;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Step the noise LFSR 'nSteps' times at once. The LFSR is linear, so
+ * this combines the precomputed effects of 2^i steps on each of its bits.
+ */
+static void	YM2149_RndJump(ymu32 nSteps)
+{
+	ymu32	rack;
+	int	i, b;
+
+	for ( i = 0 ; nSteps ; i++ , nSteps >>= 1 )
+	{
+		if ( !( nSteps & 1 ) )
+			continue;
+		rack = 0;
+		for ( b = 0 ; b < YM_RND_BITS ; b++ )
+			if ( RndRack & ( 1 << b ) )
+				rack ^= RndJumpTable[ i ][ b ];
+		RndRack = rack;
+	}
+}
+
+/**
+ * Build RndJumpTable[i][b], the LFSR state reached from bit 'b' alone
+ * after 2^i steps.
+ */
+static void	YM2149_RndJumpBuild(void)
+{
+	ymu32	SavedRack = RndRack;
+	int	i, b;
+
+	for ( b = 0 ; b < YM_RND_BITS ; b++ )
+	{
+		RndRack = 1 << b;
+		YM2149_RndCompute();
+		RndJumpTable[ 0 ][ b ] = RndRack;
+	}
+	for ( i = 1 ; i < 32 ; i++ )
+		for ( b = 0 ; b < YM_RND_BITS ; b++ )
+		{
+			RndRack = RndJumpTable[ i-1 ][ b ];
+			YM2149_RndJump( 1 << (i-1) );
+			RndJumpTable[ i ][ b ] = RndRack;
+		}
+
+	RndRack = SavedRack;
+}
+
+/**
+ * Return the noise value after 'nSteps' more noise changes, which
+ * is the one given by the last of them.
+ */
+static ymu32	YM2149_RndAdvance(ymu32 nSteps, ymu32 bn)
+{
+	if ( nSteps == 0 )
+		return bn;
+	YM2149_RndJump( nSteps - 1 );
+	return YM2149_RndCompute();
+}
+
+/**
+ * Add 'nSteps' envelope positions (1<<24 units each) to envPos,
+ * looping over blocks 1 and 2 (envPos 32 to 95) as when stepping.
+ */
+static ymu32	YM2149_EnvAdvance(ymu32 Pos, ymu64 nUnits)
+{
+	ymu64	pos = Pos + nUnits;
+
+	if ( pos >= (ymu64)(3*32) << 24 )
+		pos = ( (ymu64)32 << 24 ) + ( pos - ( (ymu64)32 << 24 ) ) % ( (ymu64)(2*32) << 24 );
+	return pos;
+}
+
+/**
+ * Same as YM2149_DoSamples() for the YM state, but without computing the
+ * samples : the tone, noise and envelope counters are advanced by 'nSamples'
+ * samples in closed form.
+ */
+static void	YM2149_AdvanceSteps(int nSamples)
+{
+	const ymu32	frac = 0xffffff;
+	ymu64	pos;
+	ymu32	nSteps;
+
+	posA += stepA * (ymu32)nSamples;
+	posB += stepB * (ymu32)nSamples;
+	posC += stepC * (ymu32)nSamples;
+
+	/* Noise changes at a sample if its position reached an integer */
+	/* part > 0, then only the fractional part is kept */
+	nSteps = ( noisePos > frac );
+	pos = ( noisePos & frac ) + (ymu64)noiseStep * ( nSamples - 1 );
+	if ( noiseStep > frac )
+		nSteps += nSamples - 1;
 	else
-		return PWMaliasFilter(sample);
+		nSteps += pos >> 24;
+	currentNoise = YM2149_RndAdvance( nSteps , currentNoise );
+	noisePos = ( pos & frac ) + noiseStep;
+
+	envPos = YM2149_EnvAdvance( envPos , (ymu64)envStep * nSamples );
+}
+
+/**
+ * Same as YM2149_DoSamples_HQ() for the YM state, but without computing
+ * the samples : the tick counters are advanced by 'nSamples' samples
+ * in closed form. The FIR history is left as is.
+ */
+static void	YM2149_AdvanceHQ(int nSamples)
+{
+	ymu32	perA, perB, perC, perNoise, perEnv;
+	ymu64	ticks;
+	int	rateIn = YM_ATARI_CLOCK / 8;
+
+	if (YM_REPLAY_FREQ <= 0)
+		return;
+	if (YmHQ.rateIn != rateIn || YmHQ.rateOut != YM_REPLAY_FREQ)
+		YM2149_HQ_BuildFilter(rateIn, YM_REPLAY_FREQ);
+
+	perA = (SoundRegs[1] << 8) | SoundRegs[0];
+	perB = (SoundRegs[3] << 8) | SoundRegs[2];
+	perC = (SoundRegs[5] << 8) | SoundRegs[4];
+	perNoise = SoundRegs[6];
+	perEnv = (SoundRegs[12] << 8) | SoundRegs[11];
+
+	/* On the YM2149, period 0 gives the same result as period 1 */
+	if (perA == 0)
+		perA = 1;
+	if (perB == 0)
+		perB = 1;
+	if (perC == 0)
+		perC = 1;
+	if (perNoise == 0)
+		perNoise = 1;
+	perNoise *= 2;					/* noise runs at half the tone clock */
+	if (perEnv == 0)
+		perEnv = 1;
+
+	ticks = YmHQ.frac + (ymu64)YmHQ.ratio * nSamples;
+	YmHQ.frac = ticks & ( (1 << YM_HQ_FRAC_BITS) - 1 );
+	ticks >>= YM_HQ_FRAC_BITS;
+
+	/* each counter wraps (cnt+ticks)/per times */
+	if ( ( ( YmHQ.cntA + ticks ) / perA ) & 1 )
+		YmHQ.outA ^= 0xffff;
+	YmHQ.cntA = ( YmHQ.cntA + ticks ) % perA;
+	if ( ( ( YmHQ.cntB + ticks ) / perB ) & 1 )
+		YmHQ.outB ^= 0xffff;
+	YmHQ.cntB = ( YmHQ.cntB + ticks ) % perB;
+	if ( ( ( YmHQ.cntC + ticks ) / perC ) & 1 )
+		YmHQ.outC ^= 0xffff;
+	YmHQ.cntC = ( YmHQ.cntC + ticks ) % perC;
+
+	currentNoise = YM2149_RndAdvance( ( YmHQ.cntNoise + ticks ) / perNoise , currentNoise );
+	YmHQ.cntNoise = ( YmHQ.cntNoise + ticks ) % perNoise;
+
+	envPos = YM2149_EnvAdvance( envPos , ( ( YmHQ.cntEnv + ticks ) / perEnv ) << 24 );
+	YmHQ.cntEnv = ( YmHQ.cntEnv + ticks ) % perEnv;
+}
+
+/**
+ * Advance the YM state by 'nSamples' samples without computing them,
+ * when they're not needed (fast forward, no sound output). The state
+ * ends up the same as after generating them, so snapshots taken after
+ * this are the same too.
+ */
+static void	Ym2149_Advance(int nSamples)
+{
+	if ( nSamples <= 0 )
+		return;
+	if ( ConfigureParams.Sound.bYmHighQuality )
+		YM2149_AdvanceHQ( nSamples );
+	else
+		YM2149_AdvanceSteps( nSamples );
 }
-#endif
 
 
 /*-----------------------------------------------------------------------*/
@@ -1178,6 +1702,7 @@ void	Sound_WriteReg( int reg , Uint8 data )
 		case 13:
 			SoundRegs[13] = data & 0xf;
 			envPos = 0;					/* when writing to EnvShape, we must reset the EnvPos */
+			YmHQ.cntEnv = 0;
 			envShape = SoundRegs[13];
 			bEnvelopeFreqFlag = true;			/* used for YmFormat saving */
 			break;
@@ -1219,12 +1744,18 @@ void Sound_Reset(void)
 	bEnvelopeFreqFlag = false;
 
 	CompleteSndBufIdx = 0;
+#ifdef __LIBRETRO__
+	/* The ring buffer read by the front end holds the latency */
+	nGeneratedSamples = 0;
+#else
 	/* We do not start with 0 here to fake some initial samples: */
 	nGeneratedSamples = SoundBufferSize + SAMPLES_PER_FRAME;
+#endif
 	ActiveSndBufIdx = nGeneratedSamples % MIXBUFFER_SIZE;
 	SamplesPerFrame = SAMPLES_PER_FRAME;
 	CurrentSamplesNb = 0;
 	ActiveSndBufIdxAvi = ActiveSndBufIdx;
+	YmQueueHead = YmQueueTail = 0;
 //fprintf ( stderr , "Sound_Reset SoundBufferSize %d SAMPLES_PER_FRAME %d nGeneratedSamples %d , ActiveSndBufIdx %d\n" ,
 //	SoundBufferSize , SAMPLES_PER_FRAME, nGeneratedSamples , ActiveSndBufIdx );
 
@@ -1246,7 +1777,11 @@ void Sound_Reset(void)
 void Sound_ResetBufferIndex(void)
 {
 	Audio_Lock();
+#ifdef __LIBRETRO__
+	nGeneratedSamples = 0;
+#else
 	nGeneratedSamples = SoundBufferSize + SAMPLES_PER_FRAME;
+#endif
 	ActiveSndBufIdx =  (CompleteSndBufIdx + nGeneratedSamples) % MIXBUFFER_SIZE;
 	SamplesPerFrame = SAMPLES_PER_FRAME;
 	CurrentSamplesNb = 0;
@@ -1263,6 +1798,12 @@ void Sound_ResetBufferIndex(void)
  */
 void Sound_MemorySnapShot_Capture(bool bSave)
 {
+	/* Snapshots aren't taken between the queued writes and their samples */
+	if (bSave && YmQueueTail > YmQueueHead)
+		Sound_Update(false);
+	else if (!bSave)
+		YmQueueHead = YmQueueTail = 0;
+
 	/* Save/Restore details */
 	MemorySnapShot_Store(&stepA, sizeof(stepA));
 	MemorySnapShot_Store(&stepB, sizeof(stepB));
@@ -1299,17 +1840,13 @@ void Sound_MemorySnapShot_Capture(bool bSave)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Find how many samples to generate and store in 'nSamplesToGenerate'
- * Also update sound cycles counter to store how many we actually did
- * so generates set amount each frame.
- * If FillFrame is true, this means we reach the end of the VBL and me must
- * add as many samples as necessary to get a total of SamplesPerFrame
- * for this VBL.
+ * Return how many samples of the current VBL should have been generated
+ * at this point of the VBL.
  */
-static int Sound_SetSamplesPassed(bool FillFrame)
+static int Sound_GetSamplesPassed(void)
 {
 	int nSoundCycles;
-	int SamplesToGenerate;				/* How many samples are needed for this time-frame */
+	int nSamples;
 
 	nSoundCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
 
@@ -1317,14 +1854,31 @@ static int Sound_SetSamplesPassed(bool FillFrame)
 	/* 882/160256 samples per cpu clock cycle */
 
 	/* Total number of samples that we should have at this point of the VBL */
-	SamplesToGenerate = nSoundCycles * SamplesPerFrame
+	nSamples = nSoundCycles * SamplesPerFrame
 		/ ClocksTimings_GetCyclesPerVBL ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
 
-//if (SamplesToGenerate > SamplesPerFrame )
-//fprintf ( stderr , "over run %d %d\n" , SamplesPerFrame , SamplesToGenerate );
+//if (nSamples > SamplesPerFrame )
+//fprintf ( stderr , "over run %d %d\n" , SamplesPerFrame , nSamples );
+
+	if (nSamples > SamplesPerFrame)
+		nSamples = SamplesPerFrame;
+
+	return nSamples;
+}
+
+/**
+ * Find how many samples to generate and store in 'nSamplesToGenerate'
+ * Also update sound cycles counter to store how many we actually did
+ * so generates set amount each frame.
+ * If FillFrame is true, this means we reach the end of the VBL and me must
+ * add as many samples as necessary to get a total of SamplesPerFrame
+ * for this VBL.
+ */
+static int Sound_SetSamplesPassed(bool FillFrame)
+{
+	int SamplesToGenerate;				/* How many samples are needed for this time-frame */
 
-	if (SamplesToGenerate > SamplesPerFrame)
-		SamplesToGenerate = SamplesPerFrame;
+	SamplesToGenerate = Sound_GetSamplesPassed();
 
 	SamplesToGenerate -= CurrentSamplesNb;		/* don't count samples that were already generated up to now */
 	if ( SamplesToGenerate < 0 )
@@ -1353,6 +1907,7 @@ static int Sound_SetSamplesPassed(bool FillFrame)
 	{
 		Log_Printf ( LOG_WARN , "Your system is too slow, some sound samples were not correctly emulated\n" );
 		Sound_BufferIndexNeedReset = true;
+		Metrics_Count ( METRICS_AUDIO_RESYNC );
 	}
 
 //fprintf ( stderr , "vbl %d hbl %d samp_gen %d / %d frac %lx\n" , nVBLs , nHBL , SamplesToGenerate , SamplesPerFrame , (long int)SamplesPerFrame_unrounded );
@@ -1361,46 +1916,133 @@ static int Sound_SetSamplesPassed(bool FillFrame)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Do the queued YM register writes which happened before sample 'nPos'
+ * of the current VBL.
+ */
+static void Sound_WriteQueuedRegs(int nPos)
+{
+	while (YmQueueHead < YmQueueTail && YmQueue[YmQueueHead].Pos <= nPos)
+	{
+		Sound_WriteReg(YmQueue[YmQueueHead].Reg, YmQueue[YmQueueHead].Data);
+		YmQueueHead++;
+	}
+	if (YmQueueHead == YmQueueTail)
+		YmQueueHead = YmQueueTail = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue a write to YM register 'reg' at the current cycle, to be done
+ * when the samples up to this cycle are generated. Digi sound replay
+ * writes YM registers thousands of times per VBL, this avoids calling
+ * Sound_Update() for each of them. The samples are the same as when
+ * generating them before each write.
+ */
+void Sound_QueueReg(int reg, Uint8 data)
+{
+	int nPos;
+
+	if (YmQueueTail == YM_QUEUE_SIZE)
+		Sound_Update(false);			/* do all the pending writes */
+
+	nPos = Sound_GetSamplesPassed();
+	if (nPos < CurrentSamplesNb)
+		nPos = CurrentSamplesNb;
+	if (YmQueueTail > YmQueueHead && nPos < YmQueue[YmQueueTail-1].Pos)
+		nPos = YmQueue[YmQueueTail-1].Pos;
+
+	YmQueue[YmQueueTail].Pos = nPos;
+	YmQueue[YmQueueTail].Reg = reg;
+	YmQueue[YmQueueTail].Data = data;
+	YmQueueTail++;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Generate samples for all channels during this time-frame
  */
 static void Sound_GenerateSamples(int SamplesToGenerate)
 {
-	int	i;
-	int	idx;
+	static ymsample	YmBuffer[MIXBUFFER_SIZE];
+	int	i, n, idx, done;
+	bool	bHighPass, bSkipYm;
 
 	if (SamplesToGenerate <= 0)
+	{
+		Sound_WriteQueuedRegs(CurrentSamplesNb);
 		return;
+	}
 
-	if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
+	/* Without sound output or in fast forward, nobody listens to the YM */
+	/* output unless it's recorded : only advance its state. Register */
+	/* writes are still done at their position, DMA sound and the crossbar */
+	/* are still run as they have side effects visible to the CPU. */
+	bSkipYm = ( ConfigureParams.System.bFastForward || !bSoundWorking )
+	          && !bRecordingWav && !bRecordingAvi;
+
+	/* YM samples are generated in blocks between the queued register writes, */
+	/* then copied to the mix buffer in at most 2 spans, as the ring buffer */
+	/* can wrap during this block. */
+	for (done = 0; ; done += n)
 	{
-		for (i = 0; i < SamplesToGenerate; i++)
+		Sound_WriteQueuedRegs(CurrentSamplesNb + done);
+		if (done == SamplesToGenerate)
+			break;
+
+		n = SamplesToGenerate - done;
+		if (YmQueueHead < YmQueueTail && YmQueue[YmQueueHead].Pos < CurrentSamplesNb + SamplesToGenerate)
+			n = YmQueue[YmQueueHead].Pos - CurrentSamplesNb - done;
+		if (bSkipYm)
 		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = Subsonic_IIR_HPF_Left( YM2149_NextSample() );
+			Ym2149_Advance(n);
+			memset(YmBuffer + done, 0, n * sizeof(ymsample));
 		}
+		else if (ConfigureParams.Sound.bYmHighQuality)
+			YM2149_DoSamples_HQ(YmBuffer + done, n);
+		else
+			YM2149_DoSamples(YmBuffer + done, n);
+	}
+
+	/* Ste and TT DmaSnd does its own filtering */
+	bHighPass = (ConfigureParams.System.nMachineType == MACHINE_FALCON
+	             || ConfigureParams.System.nMachineType == MACHINE_ST);
+
+	for (done = 0; done < SamplesToGenerate; done += n)
+	{
+		idx = (ActiveSndBufIdx + done) % MIXBUFFER_SIZE;
+		n = SamplesToGenerate - done;
+		if (n > MIXBUFFER_SIZE - idx)
+			n = MIXBUFFER_SIZE - idx;
+		if (bHighPass)
+		{
+			for (i = 0; i < n; i++)
+				MixBuffer[idx+i][0] = MixBuffer[idx+i][1] = Subsonic_IIR_HPF_Left( YmBuffer[done+i] );
+		}
+		else
+		{
+			for (i = 0; i < n; i++)
+				MixBuffer[idx+i][0] = MixBuffer[idx+i][1] = YmBuffer[done+i];
+		}
+	}
+
+	if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
+	{
  		/* If Falcon emulation, crossbar does the job */
+		PERFCOUNT_BEGIN(PERFCOUNT_DMASND, nPerfPrev);
  		Crossbar_GenerateSamples(ActiveSndBufIdx, SamplesToGenerate);
+		PERFCOUNT_END(nPerfPrev);
 	}
 	else if (ConfigureParams.System.nMachineType != MACHINE_ST)
 	{
-		for (i = 0; i < SamplesToGenerate; i++)
-		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = YM2149_NextSample();
-		}
  		/* If Ste or TT emulation, DmaSnd does mixing and filtering */
+		PERFCOUNT_BEGIN(PERFCOUNT_DMASND, nPerfPrev);
  		DmaSnd_GenerateSamples(ActiveSndBufIdx, SamplesToGenerate);
+		PERFCOUNT_END(nPerfPrev);
 	}
-	else if (ConfigureParams.System.nMachineType == MACHINE_ST)
-	{
-		for (i = 0; i < SamplesToGenerate; i++)
-		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = Subsonic_IIR_HPF_Left( YM2149_NextSample() );
-		}
- 	}
 
 	ActiveSndBufIdx = (ActiveSndBufIdx + SamplesToGenerate) % MIXBUFFER_SIZE;
 	nGeneratedSamples += SamplesToGenerate;
@@ -1427,7 +2069,9 @@ void Sound_Update(bool FillFrame)
 	SamplesToGenerate = Sound_SetSamplesPassed( FillFrame );
 
 	/* And generate */
+	PERFCOUNT_BEGIN(PERFCOUNT_SOUND, nPerfPrev);
 	Sound_GenerateSamples( SamplesToGenerate );
+	PERFCOUNT_END(nPerfPrev);
 
 	/* Allow audio callback function to occur again */
 	Audio_Unlock();
@@ -1438,70 +2082,200 @@ void Sound_Update(bool FillFrame)
 }
 
 #ifdef __LIBRETRO__
-extern short signed int SNDBUF[1024*2];
-static void Retro_Audio_CallBack(int len)
-{
-Sint16 *pBuffer;
-int i, window, nSamplesPerFrame;
-pBuffer = (Sint16 *)&SNDBUF[0];
-len = len / 4; // Use length in samples (16 bit stereo), not in bytes
-/* Adjust emulation rate within +/- 0.58% (10 cents) occasionally,
-* to synchronize sound. Note that an octave (frequency doubling)
-* has 12 semitones (12th root of two for a semitone), and that
-* one semitone has 100 cents (1200th root of two for one cent).
-* Ten cents are desired, thus, the 120th root of two minus one is
-* multiplied by 1,000,000 to convert to microseconds, and divided
-* by nScreenRefreshRate=60 to get a 96 microseconds swallow size.
-* (2^(10cents/(12semitones*100cents)) - 1) * 10^6 / nScreenRefreshRate
-* See: main.c - Main_WaitOnVbl()
-*/
-pulse_swallowing_count = 0; /* 0 = Unaltered emulation rate */
-if (ConfigureParams.Sound.bEnableSoundSync)
+/*-----------------------------------------------------------------------*/
+/* Single producer / single consumer ring between the emulation, which	*/
+/* writes each VBL's samples, and the front end, which reads them at its	*/
+/* own pace (possibly from another thread). Each side only writes its own	*/
+/* index, published with release and read with acquire ordering.		*/
+/*-----------------------------------------------------------------------*/
+
+#define RETRO_RING_SIZE		8192			/* stereo samples, power of 2 */
+#define RETRO_RING_MASK		(RETRO_RING_SIZE - 1)
+#define RETRO_RATE_DELTA	0.005			/* max. rate control adjustment */
+#define RETRO_SINC_TAPS		16			/* ring samples used for one output sample */
+#define RETRO_SINC_PHASES	64			/* sub-sample positions in the sinc table */
+
+static Sint16	RetroRing[ RETRO_RING_SIZE ][ 2 ];
+static Uint32	RetroRingHead;				/* written samples, producer only */
+static Uint32	RetroRingTail;				/* read samples, consumer only */
+static Uint32	RetroRingFrac;				/* consumer position between 2 samples, 16.16 */
+static bool	RetroRingStarted;			/* consumer reached target fill once */
+
+static int	RetroOutputFreq = 44100;		/* front end rate */
+static bool	RetroSinc;				/* windowed sinc instead of linear interpolation */
+static int	RetroSincFreq;				/* input freq RetroSincTable was built for */
+static Sint16	RetroSincTable[ RETRO_SINC_PHASES ][ RETRO_SINC_TAPS ];
+
+/**
+ * Producer : move all generated samples from MixBuffer to the ring.
+ * Samples which don't fit (consumer isn't reading) are dropped.
+ */
+static void Sound_RetroRingWrite(void)
 {
-/* Sound synchronized emulation */
-nSamplesPerFrame = nAudioFrequency/nScreenRefreshRate;
-window = (nSamplesPerFrame > SoundBufferSize) ? nSamplesPerFrame : SoundBufferSize;
-/* Window Comparator for SoundBufferSize */
-if (nGeneratedSamples < window + (window >> 1))
-/* Increase emulation rate to maintain sound synchronization */
-pulse_swallowing_count = -5793 / nScreenRefreshRate;
-else
-if (nGeneratedSamples > (window << 1) + (window >> 2))
-/* Decrease emulation rate to maintain sound synchronization */
-pulse_swallowing_count = 5793 / nScreenRefreshRate;
-/* Otherwise emulation rate is unaltered. */
+	Uint32 head = RetroRingHead;
+	Uint32 tail = __atomic_load_n(&RetroRingTail, __ATOMIC_ACQUIRE);
+	int i, n = nGeneratedSamples;
+
+	if (n > (int)(RETRO_RING_SIZE - (head - tail)))
+		n = RETRO_RING_SIZE - (head - tail);
+	for (i = 0; i < n; i++, head++)
+	{
+		RetroRing[head & RETRO_RING_MASK][0] = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][0];
+		RetroRing[head & RETRO_RING_MASK][1] = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][1];
+	}
+	__atomic_store_n(&RetroRingHead, head, __ATOMIC_RELEASE);
+
+	CompleteSndBufIdx = (CompleteSndBufIdx + nGeneratedSamples) % MIXBUFFER_SIZE;
+	nGeneratedSamples = 0;
 }
-if (nGeneratedSamples >= len)
-{
-/* Enough samples available: Pass completed buffer to audio system
-* by write samples into sound buffer and by converting them from
-* 'signed' to 'unsigned' */
-for (i = 0; i < len; i++)
+
+/**
+ * Consumer : drop all the samples in the ring (e.g. after frames that
+ * were emulated without being shown), and wait for it to fill again.
+ */
+void Sound_RetroRingFlush(void)
 {
-*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][0];
-*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][1];
-}
-CompleteSndBufIdx += len;
-nGeneratedSamples -= len;
+	RetroRingTail = __atomic_load_n(&RetroRingHead, __ATOMIC_ACQUIRE);
+	RetroRingFrac = 0;
+	RetroRingStarted = false;
 }
-else /* Not enough samples available: */
-{
-for (i = 0; i < nGeneratedSamples; i++)
+
+/**
+ * Set the front end rate and the interpolation used to convert the
+ * samples generated at nAudioFrequency to it.
+ */
+void Sound_RetroRingSetOutput(int nOutputFreq, bool bSinc)
 {
-*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][0];
-*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][1];
+	RetroOutputFreq = nOutputFreq;
+	RetroSinc = bSinc;
 }
-/* If the buffer is filled more than 50%, mirror sample buffer to fake the
-* missing samples */
-if (nGeneratedSamples >= len/2)
+
+/**
+ * Build the polyphase table of a Blackman windowed sinc low pass filter
+ * for each of RETRO_SINC_PHASES positions between 2 samples. The cut off
+ * is set below the lowest of the input and output Nyquist frequencies,
+ * each phase is normalized to a gain of 1 (1<<14).
+ */
+static void Sound_RetroBuildSinc(void)
 {
-int remaining = len - nGeneratedSamples;
-memcpy(pBuffer, SNDBUF+(nGeneratedSamples-remaining)*4, remaining*4);
-}
-CompleteSndBufIdx += nGeneratedSamples;
-nGeneratedSamples = 0;
+	double fc, t, x, w, h[RETRO_SINC_TAPS], sum;
+	int p, k, half = RETRO_SINC_TAPS / 2;
+
+	fc = 0.9 * (RetroOutputFreq < nAudioFrequency ? (double)RetroOutputFreq / nAudioFrequency : 1.0);
+	for (p = 0; p < RETRO_SINC_PHASES; p++)
+	{
+		sum = 0;
+		for (k = 0; k < RETRO_SINC_TAPS; k++)
+		{
+			/* distance between tap k and the output position */
+			t = k - (half - 1) - (double)p / RETRO_SINC_PHASES;
+			x = M_PI * fc * t;
+			w = 0.42 + 0.5 * cos(M_PI * t / half) + 0.08 * cos(2 * M_PI * t / half);
+			h[k] = (x == 0 ? 1.0 : sin(x) / x) * w;
+			sum += h[k];
+		}
+		for (k = 0; k < RETRO_SINC_TAPS; k++)
+			RetroSincTable[p][k] = (Sint16)floor(h[k] * (1 << 14) / sum + 0.5);
+	}
+	RetroSincFreq = nAudioFrequency;
 }
-CompleteSndBufIdx = CompleteSndBufIdx % MIXBUFFER_SIZE;
+
+/**
+ * Consumer : read exactly 'nSamples' stereo samples into pBuffer.
+ * The ring is read at nAudioFrequency / RetroOutputFreq samples per
+ * output sample. This read rate is nudged by up to +/- 0.5% depending on
+ * how far the ring fill level is from 2 reads worth of samples, which
+ * absorbs the difference between the emulated and the front end rates
+ * without ever dropping or repeating whole blocks. Output samples are
+ * interpolated between the ring samples, linearly or with a 16 taps
+ * windowed sinc. Until the ring gets filled up to its target the first
+ * time (and after an underrun), silence is returned.
+ *
+ * The published tail is the first of the RETRO_SINC_TAPS samples around
+ * the read position, the output position being between its 8th and 9th
+ * samples (linear interpolation only uses these 2).
+ */
+void Sound_RetroRingRead(Sint16 *pBuffer, int nSamples)
+{
+	Uint32 tail = RetroRingTail;
+	Uint32 head = __atomic_load_n(&RetroRingHead, __ATOMIC_ACQUIRE);
+	Uint32 fill = head - tail, target;
+	Uint32 pos, step, need;
+	double base, ratio;
+	int i, c, k;
+
+	base = (double)nAudioFrequency / RetroOutputFreq;
+	target = (Uint32)(2 * nSamples * base) + RETRO_SINC_TAPS;
+	if (!RetroRingStarted && fill < target)
+	{
+		memset(pBuffer, 0, nSamples * 4);
+		return;
+	}
+	RetroRingStarted = true;
+	if (RetroSinc && RetroSincFreq != nAudioFrequency)
+		Sound_RetroBuildSinc();
+
+	/* more samples than target : read faster (and the other way) */
+	ratio = RETRO_RATE_DELTA * ((double)fill - target) / target;
+	if (ratio > RETRO_RATE_DELTA)
+		ratio = RETRO_RATE_DELTA;
+	else if (ratio < -RETRO_RATE_DELTA)
+		ratio = -RETRO_RATE_DELTA;
+	step = (Uint32)(base * (1.0 + ratio) * 65536.0 + 0.5);
+
+	/* samples needed past the tail, including the taps after the last position */
+	need = (RetroRingFrac + (Uint32)nSamples * step) >> 16;
+	if (need + RETRO_SINC_TAPS > fill)
+	{
+		/* underrun, stretch what's left and start over */
+		need = fill > RETRO_SINC_TAPS ? fill - RETRO_SINC_TAPS : 0;
+		step = need ? (Uint32)(((Uint64)need << 16) / nSamples) : 0;
+		RetroRingFrac = 0;
+		RetroRingStarted = false;
+	}
+
+	if (fill < RETRO_SINC_TAPS)
+	{
+		memset(pBuffer, 0, nSamples * 4);
+		pos = 0;
+	}
+	else if (RetroSinc)
+	{
+		pos = RetroRingFrac;
+		for (i = 0; i < nSamples; i++, pos += step)
+		{
+			Uint32 idx = tail + (pos >> 16);
+			const Sint16 *h = RetroSincTable[(pos & 0xffff) >> 10];
+			int acc[2] = { 0, 0 };
+			for (k = 0; k < RETRO_SINC_TAPS; k++)
+			{
+				acc[0] += RetroRing[(idx + k) & RETRO_RING_MASK][0] * h[k];
+				acc[1] += RetroRing[(idx + k) & RETRO_RING_MASK][1] * h[k];
+			}
+			for (c = 0; c < 2; c++)
+			{
+				acc[c] = (acc[c] + (1 << 13)) >> 14;
+				*pBuffer++ = acc[c] > 32767 ? 32767 : acc[c] < -32768 ? -32768 : acc[c];
+			}
+		}
+	}
+	else
+	{
+		pos = RetroRingFrac;
+		for (i = 0; i < nSamples; i++, pos += step)
+		{
+			Uint32 idx = tail + (pos >> 16) + RETRO_SINC_TAPS / 2 - 1;
+			for (c = 0; c < 2; c++)
+			{
+				int s0 = RetroRing[idx & RETRO_RING_MASK][c];
+				int s1 = RetroRing[(idx + 1) & RETRO_RING_MASK][c];
+				*pBuffer++ = s0 + (((s1 - s0) * (int)((pos & 0xffff) >> 1)) >> 15);
+			}
+		}
+	}
+
+	RetroRingFrac = pos & 0xffff;
+	__atomic_store_n(&RetroRingTail, tail + (pos >> 16), __ATOMIC_RELEASE);
 }
 #endif
 
@@ -1522,8 +2296,7 @@ void Sound_Update_VBL(void)
 //fprintf ( stderr , "vbl done %d %d\n" , SamplesPerFrame , CurrentSamplesNb );
 
 #ifdef __LIBRETRO__
-memset(SNDBUF,0,1024*4);
-Retro_Audio_CallBack(CurrentSamplesNb*4);
+	Sound_RetroRingWrite();
 #endif
 
 	CurrentSamplesNb = 0;					/* VBL is complete, reset counter for next VBL */
@@ -1622,5 +2395,8 @@ void Sound_SetYmVolumeMixing(void)
 {
 	/* Build the volume conversion table */
 	Ym2149_BuildVolumeTable();
+
+	/* Build the noise LFSR jump table */
+	YM2149_RndJumpBuild();
 }
 
@@ -0,0 +1,404 @@
+/*
+  Hatari - sparseImage.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Sparse and compressed hard disk images.
+
+  Most hard disk images are largely empty, but raw images take their
+  full size on the host. A sparse image only stores the clusters (64 KiB
+  by default) that contain data, each one compressed with zlib, and an
+  index tells where each cluster is in the file. Clusters are decoded on
+  demand, and the last SPARSEIMAGE_CACHE ones are kept in memory.
+
+  File layout (all values big-endian, everything 512-byte aligned):
+
+    0   "HATARISP"   magic
+    8   version      (1)
+    12  cluster size in bytes (multiple of 512)
+    16  disk size in sectors
+    20  number of clusters
+    24  index offset in bytes
+    ...
+    index: for each cluster, its offset in 512-byte sectors (0 if the
+           cluster is empty, i.e. all zeros) and its stored length in
+           bytes (equal to the cluster size if it's not compressed)
+
+  Modified clusters are compressed again when they leave the cache or
+  when the image is flushed/closed. A cluster is rewritten in place if it
+  still fits, otherwise it is appended uncompressed at the end of the file
+  (so each cluster moves at most once), and then its index entry is
+  updated. tools/hd-sparse.py converts raw images from and to this format,
+  and compacts sparse images again.
+*/
+const char SparseImage_fileid[] = "Hatari sparseImage.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "sparseImage.h"
+
+#if HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#define SPARSEIMAGE_MAGIC	"HATARISP"
+#define SPARSEIMAGE_VERSION	1
+#define SPARSEIMAGE_NONE	0xffffffff
+
+#define SparseImage_GetBE32(p)	(((Uint32)(p)[0] << 24) | ((Uint32)(p)[1] << 16) | ((Uint32)(p)[2] << 8) | (p)[3])
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store a 32-bit big-endian value
+ */
+static void SparseImage_PutBE32(Uint8 *p, Uint32 nValue)
+{
+	p[0] = nValue >> 24;
+	p[1] = nValue >> 16;
+	p[2] = nValue >> 8;
+	p[3] = nValue;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the file is a sparse image
+ */
+bool SparseImage_Check(const char *pszFileName)
+{
+	char magic[8];
+	FILE *fp;
+	bool bSparse = false;
+
+	fp = fopen(pszFileName, "rb");
+	if (fp)
+	{
+		bSparse = fread(magic, sizeof(magic), 1, fp) == 1
+		          && memcmp(magic, SPARSEIMAGE_MAGIC, sizeof(magic)) == 0;
+		fclose(fp);
+	}
+	return bSparse;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the header and index of the sparse image 'fp'.
+ * Return false if it's not a (valid) sparse image.
+ */
+bool SparseImage_Open(SPARSEIMAGE *pImg, FILE *fp, bool bReadOnly)
+{
+	Uint8 header[28], *pIndex;
+	Uint32 i;
+
+	memset(pImg, 0, sizeof(*pImg));
+
+	if (fseeko(fp, 0, SEEK_SET) != 0 || fread(header, sizeof(header), 1, fp) != 1
+	    || memcmp(header, SPARSEIMAGE_MAGIC, 8) != 0)
+		return false;
+	if (SparseImage_GetBE32(header + 8) != SPARSEIMAGE_VERSION)
+	{
+		Log_Printf(LOG_ERROR, "Unsupported sparse image version %d.\n",
+		           SparseImage_GetBE32(header + 8));
+		return false;
+	}
+	pImg->nClusterSize = SparseImage_GetBE32(header + 12);
+	pImg->nSectors = SparseImage_GetBE32(header + 16);
+	pImg->nClusters = SparseImage_GetBE32(header + 20);
+	pImg->nIndexOffset = SparseImage_GetBE32(header + 24);
+	if (pImg->nClusterSize == 0 || pImg->nClusterSize % SPARSEIMAGE_SECTOR_SIZE
+	    || pImg->nClusterSize > 16 * 1024 * 1024
+	    || pImg->nClusters != ((Uint64)pImg->nSectors * SPARSEIMAGE_SECTOR_SIZE
+	                           + pImg->nClusterSize - 1) / pImg->nClusterSize)
+	{
+		Log_Printf(LOG_ERROR, "Invalid sparse image header.\n");
+		return false;
+	}
+
+	pImg->pOffset = malloc(pImg->nClusters * sizeof(Uint32));
+	pImg->pLength = malloc(pImg->nClusters * sizeof(Uint32));
+	pImg->pPacked = malloc(pImg->nClusterSize + pImg->nClusterSize / 1000 + 64);
+	pIndex = malloc(pImg->nClusters * 8);
+	for (i = 0; i < SPARSEIMAGE_CACHE; i++)
+	{
+		pImg->Cache[i].nCluster = SPARSEIMAGE_NONE;
+		pImg->Cache[i].pData = malloc(pImg->nClusterSize);
+		if (!pImg->Cache[i].pData)
+			pIndex = NULL;
+	}
+	if (!pImg->pOffset || !pImg->pLength || !pImg->pPacked || !pIndex
+	    || fseeko(fp, pImg->nIndexOffset, SEEK_SET) != 0
+	    || fread(pIndex, 8, pImg->nClusters, fp) != pImg->nClusters)
+	{
+		Log_Printf(LOG_ERROR, "Failed to read the sparse image index.\n");
+		free(pIndex);
+		pImg->fp = fp;
+		SparseImage_Close(pImg);
+		return false;
+	}
+
+	for (i = 0; i < pImg->nClusters; i++)
+	{
+		pImg->pOffset[i] = SparseImage_GetBE32(pIndex + i * 8);
+		pImg->pLength[i] = SparseImage_GetBE32(pIndex + i * 8 + 4);
+	}
+	free(pIndex);
+
+	fseeko(fp, 0, SEEK_END);
+	pImg->nEnd = ftello(fp);
+	pImg->nEnd = (pImg->nEnd + SPARSEIMAGE_SECTOR_SIZE - 1) & ~(off_t)(SPARSEIMAGE_SECTOR_SIZE - 1);
+	pImg->bReadOnly = bReadOnly;
+	pImg->fp = fp;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store a modified cluster in the file, and update its index entry
+ */
+static bool SparseImage_StoreCluster(SPARSEIMAGE *pImg, SPARSEIMAGE_CLUSTER *pCluster)
+{
+	Uint32 nNum = pCluster->nCluster;
+	Uint32 nLength = 0, nOffset = 0, i;
+	const Uint8 *pStored = pCluster->pData;
+	Uint8 entry[8];
+
+	for (i = 0; i < pImg->nClusterSize; i++)
+	{
+		if (pCluster->pData[i])
+		{
+			nLength = pImg->nClusterSize;
+			break;
+		}
+	}
+
+	/* Compressed clusters are rewritten in place while they fit.
+	 * Otherwise they're moved to the end of the file uncompressed,
+	 * and stay so, so that they always have enough room. */
+	if (nLength && pImg->pOffset[nNum] && pImg->pLength[nNum] == pImg->nClusterSize)
+	{
+		nOffset = pImg->pOffset[nNum];
+	}
+	else if (nLength)
+	{
+#if HAVE_LIBZ
+		uLongf nPacked = pImg->nClusterSize + pImg->nClusterSize / 1000 + 64;
+
+		if (compress2(pImg->pPacked, &nPacked, pCluster->pData,
+		              pImg->nClusterSize, Z_BEST_SPEED) == Z_OK
+		    && nPacked < pImg->nClusterSize)
+		{
+			pStored = pImg->pPacked;
+			nLength = nPacked;
+		}
+#endif
+		if (pImg->pOffset[nNum] && (nLength + SPARSEIMAGE_SECTOR_SIZE - 1) / SPARSEIMAGE_SECTOR_SIZE
+		    <= (pImg->pLength[nNum] + SPARSEIMAGE_SECTOR_SIZE - 1) / SPARSEIMAGE_SECTOR_SIZE)
+		{
+			nOffset = pImg->pOffset[nNum];
+		}
+		else
+		{
+			nOffset = pImg->nEnd / SPARSEIMAGE_SECTOR_SIZE;
+			pStored = pCluster->pData;
+			nLength = pImg->nClusterSize;
+		}
+	}
+
+	if (nLength)
+	{
+		if (fseeko(pImg->fp, (off_t)nOffset * SPARSEIMAGE_SECTOR_SIZE, SEEK_SET) != 0
+		    || fwrite(pStored, nLength, 1, pImg->fp) != 1)
+		{
+			Log_Printf(LOG_WARN, "Failed to write sparse image cluster %u.\n", nNum);
+			return false;
+		}
+		if (nOffset == pImg->nEnd / SPARSEIMAGE_SECTOR_SIZE)
+			pImg->nEnd += (nLength + SPARSEIMAGE_SECTOR_SIZE - 1) & ~(SPARSEIMAGE_SECTOR_SIZE - 1);
+	}
+
+	/* Index entry is updated once the data is there */
+	SparseImage_PutBE32(entry, nOffset);
+	SparseImage_PutBE32(entry + 4, nLength);
+	if (fseeko(pImg->fp, pImg->nIndexOffset + (off_t)nNum * 8, SEEK_SET) != 0
+	    || fwrite(entry, sizeof(entry), 1, pImg->fp) != 1)
+	{
+		Log_Printf(LOG_WARN, "Failed to update sparse image index.\n");
+		return false;
+	}
+	pImg->pOffset[nNum] = nOffset;
+	pImg->pLength[nNum] = nLength;
+	pCluster->bDirty = false;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the cache entry of cluster 'nNum', decoding it if needed.
+ * Return NULL on error.
+ */
+static SPARSEIMAGE_CLUSTER *SparseImage_GetCluster(SPARSEIMAGE *pImg, Uint32 nNum)
+{
+	SPARSEIMAGE_CLUSTER *pCluster = &pImg->Cache[0];
+	Uint32 nLength = pImg->pLength[nNum];
+	bool bOk = true;
+	int i;
+
+	for (i = 0; i < SPARSEIMAGE_CACHE; i++)
+	{
+		if (pImg->Cache[i].nCluster == nNum)
+		{
+			pImg->Cache[i].nLastUsed = ++pImg->nUseCounter;
+			return &pImg->Cache[i];
+		}
+		if (pImg->Cache[i].nLastUsed < pCluster->nLastUsed)
+			pCluster = &pImg->Cache[i];
+	}
+
+	if (pCluster->bDirty && !SparseImage_StoreCluster(pImg, pCluster))
+		Log_Printf(LOG_WARN, "Discarding sparse image cluster %u.\n", pCluster->nCluster);
+	pCluster->nCluster = SPARSEIMAGE_NONE;
+	pCluster->bDirty = false;
+
+	if (pImg->pOffset[nNum] == 0)
+	{
+		memset(pCluster->pData, 0, pImg->nClusterSize);
+	}
+	else if (nLength == 0 || nLength > pImg->nClusterSize
+	         || fseeko(pImg->fp, (off_t)pImg->pOffset[nNum] * SPARSEIMAGE_SECTOR_SIZE, SEEK_SET) != 0
+	         || fread(nLength == pImg->nClusterSize ? pCluster->pData : pImg->pPacked,
+	                  nLength, 1, pImg->fp) != 1)
+	{
+		bOk = false;
+	}
+	else if (nLength < pImg->nClusterSize)
+	{
+#if HAVE_LIBZ
+		uLongf nUnpacked = pImg->nClusterSize;
+
+		bOk = uncompress(pCluster->pData, &nUnpacked, pImg->pPacked, nLength) == Z_OK
+		      && nUnpacked == pImg->nClusterSize;
+#else
+		bOk = false;
+#endif
+	}
+	if (!bOk)
+	{
+		Log_Printf(LOG_WARN, "Failed to read sparse image cluster %u.\n", nNum);
+		pCluster->nLastUsed = 0;
+		return NULL;
+	}
+
+	pCluster->nCluster = nNum;
+	pCluster->nLastUsed = ++pImg->nUseCounter;
+	return pCluster;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read 'nCount' sectors from 'nSector' into 'pDst'.
+ * Return the number of sectors read.
+ */
+int SparseImage_Read(SPARSEIMAGE *pImg, Uint8 *pDst, Uint32 nSector, int nCount)
+{
+	Uint32 nPerCluster = pImg->nClusterSize / SPARSEIMAGE_SECTOR_SIZE;
+	SPARSEIMAGE_CLUSTER *pCluster;
+	int n = 0, nOffset, nPart;
+
+	while (n < nCount && nSector + n < pImg->nSectors)
+	{
+		pCluster = SparseImage_GetCluster(pImg, (nSector + n) / nPerCluster);
+		if (!pCluster)
+			break;
+		nOffset = (nSector + n) % nPerCluster;
+		nPart = nPerCluster - nOffset;
+		if (nPart > nCount - n)
+			nPart = nCount - n;
+		if (nPart > (int)(pImg->nSectors - nSector - n))
+			nPart = pImg->nSectors - nSector - n;
+		memcpy(pDst + n * SPARSEIMAGE_SECTOR_SIZE,
+		       pCluster->pData + nOffset * SPARSEIMAGE_SECTOR_SIZE,
+		       nPart * SPARSEIMAGE_SECTOR_SIZE);
+		n += nPart;
+	}
+	return n;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write 'nCount' sectors from 'pSrc' at 'nSector' (in the cache).
+ * Return the number of sectors written.
+ */
+int SparseImage_Write(SPARSEIMAGE *pImg, const Uint8 *pSrc, Uint32 nSector, int nCount)
+{
+	Uint32 nPerCluster = pImg->nClusterSize / SPARSEIMAGE_SECTOR_SIZE;
+	SPARSEIMAGE_CLUSTER *pCluster;
+	int n = 0, nOffset, nPart;
+
+	if (pImg->bReadOnly)
+		return 0;
+
+	while (n < nCount && nSector + n < pImg->nSectors)
+	{
+		pCluster = SparseImage_GetCluster(pImg, (nSector + n) / nPerCluster);
+		if (!pCluster)
+			break;
+		nOffset = (nSector + n) % nPerCluster;
+		nPart = nPerCluster - nOffset;
+		if (nPart > nCount - n)
+			nPart = nCount - n;
+		if (nPart > (int)(pImg->nSectors - nSector - n))
+			nPart = pImg->nSectors - nSector - n;
+		memcpy(pCluster->pData + nOffset * SPARSEIMAGE_SECTOR_SIZE,
+		       pSrc + n * SPARSEIMAGE_SECTOR_SIZE,
+		       nPart * SPARSEIMAGE_SECTOR_SIZE);
+		pCluster->bDirty = true;
+		n += nPart;
+	}
+	return n;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store all the modified clusters in the file
+ */
+void SparseImage_Flush(SPARSEIMAGE *pImg)
+{
+	int i;
+
+	for (i = 0; i < SPARSEIMAGE_CACHE; i++)
+	{
+		if (pImg->Cache[i].bDirty)
+			SparseImage_StoreCluster(pImg, &pImg->Cache[i]);
+	}
+	fflush(pImg->fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store the modified clusters and free the index and cache
+ * (the file itself is closed by the caller)
+ */
+void SparseImage_Close(SPARSEIMAGE *pImg)
+{
+	int i;
+
+	if (!pImg->fp)
+		return;
+
+	SparseImage_Flush(pImg);
+	for (i = 0; i < SPARSEIMAGE_CACHE; i++)
+		free(pImg->Cache[i].pData);
+	free(pImg->pPacked);
+	free(pImg->pLength);
+	free(pImg->pOffset);
+	memset(pImg, 0, sizeof(*pImg));
+}
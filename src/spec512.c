@@ -259,9 +259,6 @@ void Spec512_StartFrame(void)
 {
 	int i;
 
-	/* Set so screen gets full-update when returns from Spectrum 512 display */
-	Screen_SetFullUpdate();
-
 	/* Set terminators on each line, so when scan during conversion we know when to stop */
 	for (i = 0; i < (nScanlinesPerFrame+1); i++)
 	{
@@ -343,6 +340,50 @@ void Spec512_StartScanLine(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the palette changes during the next 'nSpans' 4-pixel
+ * spans, i.e. in the displayed part of the line after Spec512_StartScanLine().
+ * Otherwise all palette writes of the line happen in the borders, so the
+ * line can be converted as a normal one with the current 'STRGBPalette',
+ * before calling Spec512_EndScanLine().
+ */
+bool Spec512_LineChangesPalette(int nSpans)
+{
+	/* Next palette write still to be done on this line (or terminator) */
+	int LineCycles = pCyclePalette->LineCycles;
+
+	return LineCycles >= 0 && LineCycles < ScanLineCycleCount + nSpans*4;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return hash of everything the conversion of the current scan line
+ * depends on, after Spec512_StartScanLine(): the current palette, the
+ * palette writes still to be done on the line and the given ST screen
+ * data. 'nSeed' is mixed in for other conversion parameters.
+ */
+Uint64 Spec512_LineHash(const Uint8 *pSTLine, int nBytes, Uint32 nSeed)
+{
+	const CYCLEPALETTE *pWrite;
+	Uint64 hash = 0x84222325cbf29ce4ULL ^ nSeed;	/* differs from normal lines */
+	int i;
+
+	for (i = 0; i < 16; i++)
+		hash = (hash ^ STRGBPalette[i]) * 0x100000001b3ULL;
+	hash = (hash ^ ScanLineCycleCount) * 0x100000001b3ULL;
+	for (pWrite = pCyclePalette; pWrite->LineCycles >= 0; pWrite++)
+	{
+		hash = (hash ^ pWrite->LineCycles) * 0x100000001b3ULL;
+		hash = (hash ^ (pWrite->Index << 16 | pWrite->Colour)) * 0x100000001b3ULL;
+	}
+	for (i = 0; i < nBytes; i += 4)
+		hash = (hash ^ *(const Uint32 *)(pSTLine + i)) * 0x100000001b3ULL;
+	return hash;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Run to end of scan line looking up palettes so 'STRGBPalette' is up-to-date
@@ -16,8 +16,58 @@ const char STMemory_fileid[] = "Hatari stMemory.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "memory.h"
 #include "memorySnapShot.h"
+#include "screen.h"
 #include "tos.h"
 #include "vdi.h"
+#include "video.h"
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if HAVE_LIBZ
+/* Remove possible conflicting mkdir declaration from cpu/sysdeps.h */
+#undef mkdir
+#include <zlib.h>
+#endif
+
+/* Snapshot files store ST RAM in separately compressed chunks, which
+ * are compressed and decompressed on several threads.
+ */
+#if defined(__LIBRETRO__) && defined(HAVE_THREADS) && HAVE_LIBZ
+# include <rthreads/rthreads.h>
+# define STMEMORY_THREADS	1
+#else
+# define STMEMORY_THREADS	0
+#endif
+
+#define STRAM_CHUNK_SHIFT	16
+#define STRAM_CHUNK_SIZE	(1 << STRAM_CHUNK_SHIFT)
+#define STRAM_CHUNKS		(0x1000000 >> STRAM_CHUNK_SHIFT)
+#define STRAM_THREADS_MAX	8	/* for compressing/decompressing chunks */
+
+#if HAVE_LIBZ
+typedef z_stream STRAM_STREAM;
+#else
+typedef int STRAM_STREAM;		/* no streams without zlib */
+#endif
+
+/* Chunks being compressed or decompressed by STMemory_ChunkWorker() */
+static struct
+{
+	Uint32 nCount;			/* chunks 0 to nCount-1 are processed */
+	Uint32 nNext;			/* next one to take */
+	bool bSave;
+	int nLevel;			/* compression level */
+	Uint8 *pData;			/* save: compressed chunks, at their RAM offsets */
+	Uint32 *pLength;		/* save: compressed length of each chunk */
+	const Uint32 *pOffset;		/* restore: offset of each chunk in pData */
+	bool bError;			/* restore: decompression failed */
+#if STMEMORY_THREADS
+	slock_t *lock;
+#endif
+} ChunkJobs;
 
 
 /* STRam points to our ST Ram. Unless the user enabled SMALL_MEM where we have
@@ -33,13 +83,347 @@ Uint8 STRam[16*1024*1024];
 
 Uint32 STRamEnd;            /* End of ST Ram, above this address is no-mans-land and ROM/IO memory */
 
+Uint8 STRamDirty[STRAM_PAGES+1];    /* Changed pages, STRAM_DIRTY_* bits */
+
+
+/**
+ * Zero host memory. Where the system guarantees that discarded anonymous
+ * pages read back as zero (Linux), whole host pages are given back with
+ * madvise() instead of being written, so that RAM which isn't used by
+ * the emulated programs doesn't need to be allocated by the host.
+ */
+static void STMemory_ZeroHost(Uint8 *pMem, size_t nSize)
+{
+#if HAVE_SYS_MMAN_H && defined(__linux__) && defined(MADV_DONTNEED)
+	static uintptr_t nPageSize;
+	uintptr_t nStart, nEnd;
+
+	if (!nPageSize)
+	{
+		long nSysPageSize = sysconf(_SC_PAGESIZE);
+		nPageSize = nSysPageSize > 0 ? (uintptr_t)nSysPageSize : 4096;
+	}
+	nStart = ((uintptr_t)pMem + nPageSize - 1) & ~(nPageSize - 1);
+	nEnd = ((uintptr_t)pMem + nSize) & ~(nPageSize - 1);
+	if (nEnd > nStart && madvise((void *)nStart, nEnd - nStart, MADV_DONTNEED) == 0)
+	{
+		memset(pMem, 0, nStart - (uintptr_t)pMem);
+		memset((void *)nEnd, 0, (uintptr_t)pMem + nSize - nEnd);
+		return;
+	}
+#endif
+	memset(pMem, 0, nSize);
+}
+
+/**
+ * Ask the host to back the (2 MiB aligned) inside of the given memory
+ * area with transparent huge pages, to save TLB misses on the RAM
+ * accesses of the emulated CPU. Only a hint, failures are ignored.
+ */
+void STMemory_AdviseHugePages(void *pMem, size_t nSize)
+{
+#if HAVE_SYS_MMAN_H && defined(__linux__) && defined(MADV_HUGEPAGE)
+	const uintptr_t nHugeSize = 2*1024*1024;
+	uintptr_t nStart, nEnd;
+
+	nStart = ((uintptr_t)pMem + nHugeSize - 1) & ~(nHugeSize - 1);
+	nEnd = ((uintptr_t)pMem + nSize) & ~(nHugeSize - 1);
+	if (nEnd > nStart)
+		madvise((void *)nStart, nEnd - nStart, MADV_HUGEPAGE);
+#endif
+}
 
 /**
  * Clear section of ST's memory space.
  */
 static void STMemory_Clear(Uint32 StartAddress, Uint32 EndAddress)
 {
-	memset(&STRam[StartAddress], 0, EndAddress-StartAddress);
+	STMemory_ZeroHost(&STRam[StartAddress], EndAddress-StartAddress);
+	STMemory_SetDirtyArea(StartAddress, EndAddress-StartAddress);
+}
+
+/**
+ * Return size of given RAM chunk, the last one can be partial
+ */
+static Uint32 STMemory_ChunkSize(Uint32 nChunk)
+{
+	Uint32 nStart = nChunk << STRAM_CHUNK_SHIFT;
+
+	return STRamEnd - nStart < STRAM_CHUNK_SIZE ? STRamEnd - nStart : STRAM_CHUNK_SIZE;
+}
+
+/**
+ * Decompress given chunk from ChunkJobs.pData to ST RAM, with given
+ * inflate stream (NULL if it couldn't be initialized).
+ * A chunk of length 0 is zeroed, one of the chunk size is stored as is.
+ * Return false if the chunk data is bad.
+ */
+static bool STMemory_DecodeChunk(Uint32 nChunk, STRAM_STREAM *pStream)
+{
+	Uint8 *pMem = &STRam[nChunk << STRAM_CHUNK_SHIFT];
+	Uint8 *pSrc = ChunkJobs.pData + ChunkJobs.pOffset[nChunk];
+	Uint32 nLen = ChunkJobs.pOffset[nChunk+1] - ChunkJobs.pOffset[nChunk];
+	Uint32 nSize = STMemory_ChunkSize(nChunk);
+
+	if (nLen == 0)
+	{
+		STMemory_ZeroHost(pMem, nSize);
+		return true;
+	}
+	if (nLen == nSize)
+	{
+		memcpy(pMem, pSrc, nSize);
+		return true;
+	}
+#if HAVE_LIBZ
+	if (pStream && inflateReset(pStream) == Z_OK)
+	{
+		pStream->next_in = pSrc;
+		pStream->avail_in = nLen;
+		pStream->next_out = pMem;
+		pStream->avail_out = nSize;
+		if (inflate(pStream, Z_FINISH) == Z_STREAM_END
+		    && pStream->avail_out == 0)
+			return true;
+	}
+#endif
+	return false;
+}
+
+/**
+ * Compress given ST RAM chunk for a snapshot to its offset in
+ * ChunkJobs.pData, and set its length: 0 if it's all zero, the chunk
+ * size if it's stored as is.
+ */
+static void STMemory_EncodeChunk(Uint32 nChunk, STRAM_STREAM *pStream)
+{
+	Uint8 *pMem = &STRam[nChunk << STRAM_CHUNK_SHIFT];
+	Uint8 *pDst = ChunkJobs.pData + (nChunk << STRAM_CHUNK_SHIFT);
+	Uint32 nLen = STMemory_ChunkSize(nChunk);
+	Uint32 i;
+
+	/* reading pages never written to doesn't allocate them */
+	for (i = 0; i < nLen && !pMem[i]; i++)
+		;
+	if (i == nLen)
+	{
+		ChunkJobs.pLength[nChunk] = 0;
+		return;
+	}
+#if HAVE_LIBZ
+	/* compressed chunk needs to be smaller than the chunk */
+	if (pStream && deflateReset(pStream) == Z_OK)
+	{
+		pStream->next_in = pMem;
+		pStream->avail_in = nLen;
+		pStream->next_out = pDst;
+		pStream->avail_out = nLen - 1;
+		if (deflate(pStream, Z_FINISH) == Z_STREAM_END)
+		{
+			ChunkJobs.pLength[nChunk] = nLen - 1 - pStream->avail_out;
+			return;
+		}
+	}
+#endif
+	memcpy(pDst, pMem, nLen);
+	ChunkJobs.pLength[nChunk] = nLen;
+}
+
+/**
+ * Compress or decompress ChunkJobs chunks until none are left. Run on
+ * the calling thread and, with thread support, a few others alongside,
+ * each with its own zlib stream.
+ */
+static void STMemory_ChunkWorker(void *data)
+{
+	STRAM_STREAM Stream, *pStream = NULL;
+	Uint32 nChunk;
+
+#if HAVE_LIBZ
+	memset(&Stream, 0, sizeof(Stream));
+	if (ChunkJobs.bSave)
+	{
+		if (ChunkJobs.nLevel > 0 && deflateInit(&Stream, ChunkJobs.nLevel) == Z_OK)
+			pStream = &Stream;
+	}
+	else if (inflateInit(&Stream) == Z_OK)
+		pStream = &Stream;
+#endif
+	for (;;)
+	{
+#if STMEMORY_THREADS
+		if (ChunkJobs.lock)
+			slock_lock(ChunkJobs.lock);
+#endif
+		nChunk = ChunkJobs.nNext < ChunkJobs.nCount ? ChunkJobs.nNext++ : STRAM_CHUNKS;
+#if STMEMORY_THREADS
+		if (ChunkJobs.lock)
+			slock_unlock(ChunkJobs.lock);
+#endif
+		if (nChunk == STRAM_CHUNKS)
+			break;
+
+		if (ChunkJobs.bSave)
+		{
+			STMemory_EncodeChunk(nChunk, pStream);
+			continue;
+		}
+		if (!STMemory_DecodeChunk(nChunk, pStream))
+			ChunkJobs.bError = true;	/* only ever set */
+	}
+#if HAVE_LIBZ
+	if (pStream && ChunkJobs.bSave)
+		deflateEnd(pStream);
+	else if (pStream)
+		inflateEnd(pStream);
+#endif
+}
+
+/**
+ * Compress (bSave) or decompress the first 'nCount' snapshot chunks, in
+ * parallel when there are enough of them and the host has several cores.
+ * Return false if decompressing some chunk failed.
+ */
+static bool STMemory_ProcessChunks(Uint32 nCount, bool bSave)
+{
+#if STMEMORY_THREADS
+	sthread_t *Threads[STRAM_THREADS_MAX-1];
+	int nThreads = 0, nCores = 1, i;
+
+# ifdef _SC_NPROCESSORS_ONLN
+	nCores = sysconf(_SC_NPROCESSORS_ONLN);
+# endif
+	if (nCores > STRAM_THREADS_MAX)
+		nCores = STRAM_THREADS_MAX;
+	/* a few chunks per thread are worth starting it */
+	if (nCores > (int)nCount / 4)
+		nCores = nCount / 4;
+#endif
+
+	ChunkJobs.nCount = nCount;
+	ChunkJobs.nNext = 0;
+	ChunkJobs.bSave = bSave;
+	ChunkJobs.nLevel = ConfigureParams.Memory.nSnapshotCompression;
+	ChunkJobs.bError = false;
+
+#if STMEMORY_THREADS
+	ChunkJobs.lock = nCores > 1 ? slock_new() : NULL;
+	if (ChunkJobs.lock)
+	{
+		for (i = 0; i < nCores - 1; i++)
+		{
+			Threads[nThreads] = sthread_create(STMemory_ChunkWorker, NULL);
+			if (Threads[nThreads])
+				nThreads++;
+		}
+	}
+#endif
+	STMemory_ChunkWorker(NULL);
+#if STMEMORY_THREADS
+	for (i = 0; i < nThreads; i++)
+		sthread_join(Threads[i]);
+	if (ChunkJobs.lock)
+		slock_free(ChunkJobs.lock);
+	ChunkJobs.lock = NULL;
+#endif
+	return !ChunkJobs.bError;
+}
+
+/**
+ * Save/Restore ST RAM as separately compressed chunks: length of each
+ * chunk, and then the chunk data (see STMemory_DecodeChunk()). Chunks
+ * are compressed and decompressed on several threads (see
+ * STMemory_ProcessChunks()).
+ */
+static void STMemory_MemorySnapShot_CaptureChunks(bool bSave)
+{
+	Uint32 nChunks = (STRamEnd + STRAM_CHUNK_SIZE - 1) >> STRAM_CHUNK_SHIFT;
+	Uint32 Length[STRAM_CHUNKS], Offset[STRAM_CHUNKS+1];
+	Uint32 nTotal = 0, nChunk;
+	Uint8 *pData;
+
+	if (bSave)
+	{
+		pData = malloc(STRamEnd ? STRamEnd : 1);
+		if (!pData)
+		{
+			MemorySnapShot_SetError();
+			return;
+		}
+		/* compress chunks to their RAM offsets, then pack them */
+		ChunkJobs.pData = pData;
+		ChunkJobs.pLength = Length;
+		STMemory_ProcessChunks(nChunks, true);
+		for (nChunk = 0; nChunk < nChunks; nChunk++)
+		{
+			memmove(pData + nTotal, pData + (nChunk << STRAM_CHUNK_SHIFT), Length[nChunk]);
+			nTotal += Length[nChunk];
+		}
+		MemorySnapShot_Store(Length, nChunks * sizeof(Uint32));
+		MemorySnapShot_StorePacked(pData, nTotal);
+		free(pData);
+		return;
+	}
+
+	MemorySnapShot_Store(Length, nChunks * sizeof(Uint32));
+	Offset[0] = 0;
+	for (nChunk = 0; nChunk < nChunks; nChunk++)
+	{
+		if (Length[nChunk] > STMemory_ChunkSize(nChunk))
+		{
+			MemorySnapShot_SetError();
+			return;
+		}
+		nTotal += Length[nChunk];
+		Offset[nChunk+1] = nTotal;
+	}
+	pData = malloc(nTotal ? nTotal : 1);
+	if (!pData)
+	{
+		MemorySnapShot_SetError();
+		return;
+	}
+	MemorySnapShot_StorePacked(pData, nTotal);
+
+	ChunkJobs.pData = pData;
+	ChunkJobs.pOffset = Offset;
+	if (!STMemory_ProcessChunks(nChunks, false))
+		MemorySnapShot_SetError();
+	free(pData);
+}
+
+/**
+ * Save/Restore a RAM area in a snapshot. On restore, chunks which are
+ * all zero are cleared with STMemory_ZeroHost() instead of being copied,
+ * so RAM that was never used before the snapshot stays unallocated.
+ * The snapshot data is the same as with a single MemorySnapShot_Store().
+ */
+static void STMemory_MemorySnapShot_CaptureRam(Uint8 *pMem, Uint32 nSize, bool bSave)
+{
+	static Uint8 Chunk[0x10000];
+	Uint32 nPos, nLen, i;
+
+	if (bSave)
+	{
+		/* Reading pages never written to doesn't allocate them */
+		MemorySnapShot_Store(pMem, nSize);
+		return;
+	}
+
+	for (nPos = 0; nPos < nSize; nPos += nLen)
+	{
+		nLen = nSize - nPos;
+		if (nLen > sizeof(Chunk))
+			nLen = sizeof(Chunk);
+		MemorySnapShot_Store(Chunk, nLen);
+
+		for (i = 0; i < nLen && !Chunk[i]; i++)
+			;
+		if (i == nLen)
+			STMemory_ZeroHost(pMem + nPos, nLen);
+		else
+			memcpy(pMem + nPos, Chunk, nLen);
+	}
 }
 
 /**
@@ -58,9 +442,13 @@ bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *na
 {
 	Uint32 end;
 
+	/* DMA could write to RAM of batched video lines */
+	Video_HBL_Sync();
+
 	if (STMemory_ValidArea(addr, len))
 	{
 		memcpy(&STRam[addr], src, len);
+		STMemory_SetDirtyArea(addr, len);
 		return true;
 	}
 	Log_Printf(LOG_WARN, "Invalid '%s' RAM range 0x%x+%i!\n", name, addr, len);
@@ -68,7 +456,10 @@ bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *na
 	for (end = addr + len; addr < end; addr++, src++)
 	{
 		if (STMemory_ValidArea(addr, 1))
+		{
 			STRam[addr] = *src;
+			STMemory_SetDirty(addr);
+		}
 	}
 	return false;
 }
@@ -80,12 +471,107 @@ bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *na
 void STMemory_MemorySnapShot_Capture(bool bSave)
 {
 	MemorySnapShot_Store(&STRamEnd, sizeof(STRamEnd));
+	if (STRamEnd > 0x1000000)
+	{
+		MemorySnapShot_SetError();
+		return;
+	}
 
 	/* Only save/restore area of memory machine is set to, eg 1Mb */
-	MemorySnapShot_Store(STRam, STRamEnd);
+	if (MemorySnapShot_RamInChunks())
+		STMemory_MemorySnapShot_CaptureChunks(bSave);
+	else
+		STMemory_MemorySnapShot_CaptureRam(STRam, STRamEnd, bSave);
 
 	/* And Cart/TOS/Hardware area */
 	MemorySnapShot_Store(&RomMem[0xE00000], 0x200000);
+
+	/* Whole memory changed on restore, screen needs to be converted again */
+	if (!bSave)
+		STMemory_SetDirtyArea(0, 0x1000000);
+}
+
+
+/**
+ * Return host pointer to start of given ST memory page
+ */
+static Uint8 *STMemory_PageAddr(Uint32 page)
+{
+	Uint32 addr = page << STRAM_PAGE_SHIFT;
+
+	if (addr >= 0xE00000)
+		return &RomMem[addr];
+	return &STRam[addr];
+}
+
+
+/**
+ * Save/Restore only RAM / ROM pages changed since the delta snapshot
+ * base was captured or restored, for delta memory snapshots. IO memory pages are always
+ * included because IO register writes aren't tracked. Only the UAE CPU
+ * core tracks its writes, with the WinUAE one all of RAM / ROM is saved.
+ * When restoring, the base snapshot needs to be restored first.
+ */
+void STMemory_MemorySnapShot_CaptureDelta(bool bSave)
+{
+	Uint32 nRamEnd = STRamEnd, nCount = 0, page;
+
+	MemorySnapShot_Store(&nRamEnd, sizeof(nRamEnd));
+
+	if (bSave)
+	{
+		/* IO memory pages are marked here to get them stored */
+		STMemory_SetDirtyArea(0xff0000, 0x10000);
+#if ENABLE_WINUAE_CPU
+		STMemory_SetDirtyArea(0, STRamEnd);
+		STMemory_SetDirtyArea(0xe00000, 0x200000);
+#endif
+		for (page = 0; page < STRAM_PAGES; page++)
+			nCount += STRamDirty[page] & STRAM_DIRTY_DELTA;
+
+		MemorySnapShot_Store(&nCount, sizeof(nCount));
+		for (page = 0; page < STRAM_PAGES; page++)
+		{
+			if (!(STRamDirty[page] & STRAM_DIRTY_DELTA))
+				continue;
+			MemorySnapShot_Store(&page, sizeof(page));
+			MemorySnapShot_Store(STMemory_PageAddr(page), STRAM_PAGE_SIZE);
+		}
+		return;
+	}
+
+	if (nRamEnd != STRamEnd)
+	{
+		Log_Printf(LOG_WARN, "Delta memory snapshot is for different memory size!\n");
+		MemorySnapShot_SetError();
+		return;
+	}
+	MemorySnapShot_Store(&nCount, sizeof(nCount));
+	while (nCount-- > 0)
+	{
+		MemorySnapShot_Store(&page, sizeof(page));
+		if (page >= STRAM_PAGES)
+		{
+			MemorySnapShot_SetError();
+			return;
+		}
+		MemorySnapShot_Store(STMemory_PageAddr(page), STRAM_PAGE_SIZE);
+		STRamDirty[page] = STRAM_DIRTY_ALL;
+	}
+}
+
+
+/**
+ * Forget which memory pages have been changed, called only when a delta
+ * snapshot base has been captured or restored.  Other snapshots must
+ * leave this alone, as deltas are taken against the base.
+ */
+void STMemory_ClearDirtyDelta(void)
+{
+	Uint32 page;
+
+	for (page = 0; page <= STRAM_PAGES; page++)
+		STRamDirty[page] &= ~STRAM_DIRTY_DELTA;
 }
 
 
@@ -113,6 +599,8 @@ void STMemory_SetDefaultConfig(void)
 		0x0A    /* 4 MiB */
 	};
 
+	STMemory_AdviseHugePages(STRam, STRamEnd);
+
 	if (bRamTosImage)
 	{
 		/* Clear ST-RAM, excluding the RAM TOS image */
@@ -754,6 +754,30 @@ static SDL_Rect* Statusbar_OverlayDraw(SDL_Surface *surf)
 }
 
 
+#ifndef __LIBRETRO__
+/*-----------------------------------------------------------------------*/
+/**
+ * Grow given dirty area to contain also given rectangle
+ */
+static void Statusbar_AddDirty(SDL_Rect *dirty, const SDL_Rect *rect)
+{
+	int x1, y1, x2, y2;
+
+	if (!dirty->w) {
+		*dirty = *rect;
+		return;
+	}
+	x1 = dirty->x < rect->x ? dirty->x : rect->x;
+	y1 = dirty->y < rect->y ? dirty->y : rect->y;
+	x2 = dirty->x + dirty->w > rect->x + rect->w ? dirty->x + dirty->w : rect->x + rect->w;
+	y2 = dirty->y + dirty->h > rect->y + rect->h ? dirty->y + dirty->h : rect->y + rect->h;
+	dirty->x = x1;
+	dirty->y = y1;
+	dirty->w = x2 - x1;
+	dirty->h = y2 - y1;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /**
  * Update statusbar information (leds etc) if/when needed.
@@ -768,9 +792,9 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 	static char FdcOld[FDC_MSG_MAX_LEN] = "";
 	char FdcNew[FDC_MSG_MAX_LEN];
 	Uint32 color, currentticks;
-	static SDL_Rect rect;
-	SDL_Rect *last_rect;
-	int i, updates;
+	static SDL_Rect dirty;
+	SDL_Rect rect, *last_rect;
+	int i;
 
 	assert(surf);
 	if (!(StatusbarHeight && ConfigureParams.Screen.bShowStatusbar)) {
@@ -794,9 +818,13 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 #endif
 	assert(surf->h == ScreenHeight + StatusbarHeight);
 
+	/* only the union of the changed items needs to be updated */
+	dirty.w = dirty.h = 0;
 	currentticks = SDL_GetTicks();
 	last_rect = Statusbar_ShowMessage(surf, currentticks);
-	updates = last_rect ? 1 : 0;
+	if (last_rect) {
+		Statusbar_AddDirty(&dirty, last_rect);
+	}
 
 	rect = LedRect;
 	for (i = 0; i < MAX_DRIVE_LEDS; i++) {
@@ -811,8 +839,7 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 		rect.x = Led[i].offset;
 		SDL_FillRect(surf, &rect, color);
 		DEBUGPRINT(("LED[%d] = %d\n", i, Led[i].state));
-		last_rect = &rect;
-		updates++;
+		Statusbar_AddDirty(&dirty, &rect);
 	}
 
 	FDC_Get_Statusbar_Text(FdcNew, sizeof(FdcNew));
@@ -820,8 +847,7 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 		strcpy(FdcOld, FdcNew);
 		SDL_FillRect(surf, &FDCTextRect, GrayBg);
 		SDLGui_Text(FDCTextRect.x, FDCTextRect.y, FdcNew);
-		last_rect = &FDCTextRect;
-		updates++;
+		Statusbar_AddDirty(&dirty, &FDCTextRect);
 	}
 
 	if (nOldFrameSkips != nFrameSkips ||
@@ -847,8 +873,7 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 		SDL_FillRect(surf, &FrameSkipsRect, GrayBg);
 		SDLGui_Text(FrameSkipsRect.x, FrameSkipsRect.y, fscount);
 		DEBUGPRINT(("FS = %s\n", fscount));
-		last_rect = &FrameSkipsRect;
-		updates++;
+		Statusbar_AddDirty(&dirty, &FrameSkipsRect);
 	}
 
 	if ((bRecordingYM || bRecordingWav || bRecordingAvi)
@@ -861,14 +886,10 @@ SDL_Rect* Statusbar_Update(SDL_Surface *surf, bool do_update)
 		}
 		SDL_FillRect(surf, &RecLedRect, color);
 		DEBUGPRINT(("REC = ON\n"));
-		last_rect = &RecLedRect;
-		updates++;
+		Statusbar_AddDirty(&dirty, &RecLedRect);
 	}
 
-	if (updates > 1) {
-		/* multiple items updated -> update whole statusbar */
-		last_rect = &FullRect;
-	}
+	last_rect = dirty.w ? &dirty : NULL;
 	if (do_update && last_rect) {
 		SDL_UpdateRects(surf, 1, last_rect);
 		last_rect = NULL;
@@ -19,6 +19,7 @@
 const char TOS_fileid[] = "Hatari tos.c : " __DATE__ " " __TIME__;
 
 #include <SDL_endian.h>
+#include <sys/stat.h>
 
 #include "main.h"
 #include "configuration.h"
@@ -53,6 +54,15 @@ static const char * const pszTosNameExts[] =
 	NULL
 };
 
+/* Last loaded TOS file, reused on resets while the file doesn't change */
+static struct {
+	char szFileName[FILENAME_MAX];
+	off_t nStatSize;     /* size and time of the file on disk */
+	time_t nStatTime;
+	Uint8 *pData;        /* file contents (uncompressed) */
+	long nSize;
+} TosFileCache;
+
 static struct {
 	FILE *file;          /* file pointer to contents of INF file */
 	char prgname[16];    /* TOS name of the program to auto start */
@@ -561,6 +571,47 @@ static void TOS_CheckSysConfig(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the contents of the TOS image file. The file is only read again
+ * when its name, size or modification time changed since the last call,
+ * otherwise resets don't need any file I/O (or decompression).
+ * The returned buffer belongs to the cache, it must not be freed.
+ */
+static Uint8 *TOS_ReadFile(const char *pszFileName, long *pFileSize)
+{
+	struct stat st;
+	bool bStat;
+
+	bStat = stat(pszFileName, &st) == 0;
+	if (TosFileCache.pData && bStat
+	    && strcmp(TosFileCache.szFileName, pszFileName) == 0
+	    && TosFileCache.nStatSize == st.st_size
+	    && TosFileCache.nStatTime == st.st_mtime)
+	{
+		*pFileSize = TosFileCache.nSize;
+		return TosFileCache.pData;
+	}
+
+	free(TosFileCache.pData);
+	TosFileCache.pData = HFile_Read(pszFileName, &TosFileCache.nSize, pszTosNameExts);
+	if (!TosFileCache.pData || TosFileCache.nSize <= 0)
+	{
+		free(TosFileCache.pData);
+		TosFileCache.pData = NULL;
+		return NULL;
+	}
+	/* Without stat() info (e.g. other extension used), don't reuse it */
+	snprintf(TosFileCache.szFileName, sizeof(TosFileCache.szFileName), "%s",
+	         bStat ? pszFileName : "");
+	TosFileCache.nStatSize = bStat ? st.st_size : 0;
+	TosFileCache.nStatTime = bStat ? st.st_mtime : 0;
+
+	*pFileSize = TosFileCache.nSize;
+	return TosFileCache.pData;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Load TOS Rom image file into ST memory space and fix image so it can be
@@ -576,7 +627,7 @@ int TOS_LoadImage(void)
 
 	/* Load TOS image into memory so that we can check its version */
 	TosVersion = 0;
-	pTosFile = HFile_Read(ConfigureParams.Rom.szTosImageFileName, &nFileSize, pszTosNameExts);
+	pTosFile = TOS_ReadFile(ConfigureParams.Rom.szTosImageFileName, &nFileSize);
 
 	if (!pTosFile || nFileSize <= 0)
 	{
@@ -599,7 +650,7 @@ int TOS_LoadImage(void)
 		else
 			nRamTosLoaderSize = 0x100;
 		TosSize -= nRamTosLoaderSize;
-		memmove(pTosFile, pTosFile + nRamTosLoaderSize, TosSize);
+		pTosFile += nRamTosLoaderSize;
 		bRamTosImage = true;
 	}
 	else
@@ -632,6 +683,15 @@ int TOS_LoadImage(void)
 		return -2;
 	}
 
+#if ENABLE_ST_ONLY
+	if (!bIsEmuTOS && TosVersion >= 0x0300)
+	{
+		Log_AlertDlg(LOG_FATAL, "TOS versions 3.x and 4.x are for Atari TT/Falcon,\n"
+		             "which are not supported by this ST/STE only build.");
+		return -2;
+	}
+#endif
+
 	/* Assert that machine type matches the TOS version. Note that EmuTOS can
 	 * handle all machine types, so we don't do the system check there: */
 	if (!bIsEmuTOS)
@@ -681,9 +741,6 @@ int TOS_LoadImage(void)
 	/* Set connected devices, memory configuration, etc. */
 	STMemory_SetDefaultConfig();
 
-	/* and free loaded image */
-	free(pTosFile);
-
 	bTosImageLoaded = true;
 	TOS_CreateAutoInf();
 
@@ -15,6 +15,7 @@
 #define UAE_MEMORY_H
 
 #include "maccess.h"
+#include "stMemory.h"
 
 #define call_mem_get_func(func, addr) ((*func)(addr))
 #define call_mem_put_func(func, addr, v) ((*func)(addr, v))
@@ -66,9 +67,26 @@ extern addrbank mem_banks[65536];
 #define put_mem_bank(addr, b) (mem_banks[bankindex(addr)] = *(b))
 #endif
 
+/* Host pointers to the start of each 64 KiB bank for plain RAM/ROM banks
+ * which can be accessed directly (reads: ST RAM, TT RAM and ROM, writes:
+ * ST RAM), NULL for the others (system RAM, IO, void or bus error regions)
+ * which always go through the bank functions. */
+extern uae_u8 *mem_banks_rptr[65536];
+extern uae_u8 *mem_banks_wptr[65536];
+
+/* Mark ST RAM written through mem_banks_wptr[] for delta memory snapshots */
+#define STRAM_DIRTY(addr) (STRamDirty[((addr) & 0xffffff) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL)
+
 extern void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMemStart);
 extern void memory_uninit (void);
+extern uae_u8 *memory_get_ttmemory(uae_u32 *pSize);
 extern void map_banks(addrbank *bank, int first, int count);
+/* Reasons for watching writes to a memory bank */
+#define MEMORY_WATCH_DEBUGGER	1
+#define MEMORY_WATCH_PREFETCH	2
+#define MEMORY_WATCH_VIDEO	4
+
+extern void memory_watch_bank(int bnr, int reason, bool watch);
 
 #ifndef NO_INLINE_MEMORY_ACCESS
 
@@ -95,31 +113,60 @@ extern void byteput(uaecptr addr, uae_u32 b);
 
 static inline uae_u32 get_long(uaecptr addr)
 {
+    uae_u8 *p = mem_banks_rptr[bankindex(addr)];
+    if (p)
+	return do_get_mem_long(p + (addr & 0xffff));
     return longget(addr);
 }
 
 static inline uae_u32 get_word(uaecptr addr)
 {
+    uae_u8 *p = mem_banks_rptr[bankindex(addr)];
+    if (p)
+	return do_get_mem_word(p + (addr & 0xffff));
     return wordget(addr);
 }
 
 static inline uae_u32 get_byte(uaecptr addr)
 {
+    uae_u8 *p = mem_banks_rptr[bankindex(addr)];
+    if (p)
+	return p[addr & 0xffff];
     return byteget(addr);
 }
 
 static inline void put_long(uaecptr addr, uae_u32 l)
 {
+    uae_u8 *p = mem_banks_wptr[bankindex(addr)];
+    if (p) {
+	STRAM_DIRTY(addr);
+	STRAM_DIRTY(addr + 3);
+	do_put_mem_long(p + (addr & 0xffff), l);
+	return;
+    }
     longput(addr, l);
 }
 
 static inline void put_word(uaecptr addr, uae_u32 w)
 {
+    uae_u8 *p = mem_banks_wptr[bankindex(addr)];
+    if (p) {
+	STRAM_DIRTY(addr);
+	STRAM_DIRTY(addr + 1);
+	do_put_mem_word(p + (addr & 0xffff), w);
+	return;
+    }
     wordput(addr, w);
 }
 
 static inline void put_byte(uaecptr addr, uae_u32 b)
 {
+    uae_u8 *p = mem_banks_wptr[bankindex(addr)];
+    if (p) {
+	STRAM_DIRTY(addr);
+	p[addr & 0xffff] = b;
+	return;
+    }
     byteput(addr, b);
 }
 
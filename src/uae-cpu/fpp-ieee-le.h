@@ -0,0 +1,37 @@
+ /*
+  * UAE - The Un*x Amiga Emulator
+  *
+  * MC68881 emulation
+  * Support functions for little endian IEEE compatible host CPUs.
+  * Single precision values are converted through the host FPU instead
+  * of rebuilding them bit by bit, which also gets infinities, NaNs and
+  * denormals right. Uses type punning through unions like fpp-ieee-be.h.
+  */
+
+STATIC_INLINE double to_single (uae_u32 value)
+{
+    union {
+        float f;
+        uae_u32 u;
+    } val;
+
+    val.u = value;
+    return val.f;
+}
+
+STATIC_INLINE uae_u32 from_single (double src)
+{
+    union {
+        float f;
+        uae_u32 u;
+    } val;
+
+    val.f = src;
+    return val.u;
+}
+
+#define HAVE_from_single
+#define HAVE_to_single
+
+/* Get the rest of the conversion functions defined.  */
+#include "fpp-unknown.h"
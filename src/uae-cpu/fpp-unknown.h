@@ -80,14 +80,28 @@ STATIC_INLINE uae_u32 from_single(double src)
 STATIC_INLINE double to_exten(uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
 {
     double frac;
+    int expon;
 
     if ((wrd1 & 0x7fff0000) == 0 && wrd2 == 0 && wrd3 == 0)
         return 0.0;
+    /* Normalized value which fits a double exactly (as all values
+     * stored by from_exten() do): just rebias the exponent and
+     * shift the mantissa into place.
+     */
+    expon = ((wrd1 >> 16) & 0x7fff) - 16383;
+    if ((wrd2 & 0x80000000) && (wrd3 & 0x7ff) == 0
+        && expon >= -1022 && expon <= 1023) {
+        fpu_register_parts result;
+        result.parts[FHI] = (wrd1 & 0x80000000) | ((uae_u32)(expon + 1023) << 20)
+                          | ((wrd2 >> 11) & 0x000fffff);
+        result.parts[FLO] = (wrd2 << 21) | (wrd3 >> 11);
+        return result.val;
+    }
     frac = (double) wrd2 / 2147483648.0 +
         (double) wrd3 / 9223372036854775808.0;
     if (wrd1 & 0x80000000)
         frac = -frac;
-    return ldexp (frac, ((wrd1 >> 16) & 0x7fff) - 16383);
+    return ldexp (frac, expon);
 }
 #endif
 
@@ -96,6 +110,7 @@ STATIC_INLINE void from_exten(double src, uae_u32 * wrd1, uae_u32 * wrd2, uae_u3
 {
     int expon;
     double frac;
+    fpu_register_parts const *p = (fpu_register_parts const *)&src;
 
     if (src == 0.0) {
         *wrd1 = 0;
@@ -103,6 +118,16 @@ STATIC_INLINE void from_exten(double src, uae_u32 * wrd1, uae_u32 * wrd2, uae_u3
         *wrd3 = 0;
         return;
     }
+    /* Normalized double: rebias the exponent and make the integer
+     * bit explicit, no frexp() needed.
+     */
+    expon = (p->parts[FHI] >> 20) & 0x7ff;
+    if (expon != 0 && expon != 0x7ff) {
+        *wrd1 = (p->parts[FHI] & 0x80000000) | ((uae_u32)(expon - 1023 + 16383) << 16);
+        *wrd2 = 0x80000000 | ((p->parts[FHI] & 0x000fffff) << 11) | (p->parts[FLO] >> 21);
+        *wrd3 = p->parts[FLO] << 11;
+        return;
+    }
     if (src < 0) {
         *wrd1 = 0x80000000;
         src = -src;
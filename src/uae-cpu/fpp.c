@@ -24,6 +24,9 @@ const char FPP_fileid[] = "Hatari fpp.c : " __DATE__ " " __TIME__;
 
 #if defined(powerpc) || defined(__mc68020__)
 # include "fpp-ieee-be.h"
+#elif defined(__STDC_IEC_559__) && defined(__FLOAT_WORD_ORDER__) \
+      && __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# include "fpp-ieee-le.h"
 #else
 # include "fpp-unknown.h"
 #endif
@@ -107,7 +107,10 @@ int intlev(void)
 int Init680x0(void)
 {
 	currprefs.cpu_level = changed_prefs.cpu_level = ConfigureParams.System.nCpuLevel;
-	currprefs.cpu_compatible = changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu;
+	currprefs.cpu_compatible = changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu
+	                                                          && !ConfigureParams.System.bFastTiming
+	                                                          && !bPrefetchAuto;
+	bFastTiming = ConfigureParams.System.bFastTiming;
 	currprefs.address_space_24 = changed_prefs.address_space_24 = true;
 
 	init_m68k();
@@ -213,6 +216,37 @@ unsigned long OpCode_VDI(uae_u32 opcode)
 	return 4;
 }
 
+/**
+ * Relocate a program loaded by the cartridge Pexec code (see cart_asm.s).
+ * When GemDOS_PexecRelocate() doesn't do it, the 'move.l 8(a5),a3' which
+ * this opcode replaced is emulated and the following branch is skipped,
+ * so that the cartridge code relocates the program itself.
+ */
+unsigned long OpCode_Pexec(uae_u32 opcode)
+{
+	Uint32 pc = M68000_GetPC();
+
+	/* this is valid only when called from cartridge code */
+	if (pc >= 0xfa0000 && pc < 0xfc0000)
+	{
+		/* A5: basepage, A4: relocation table, D7: absflag */
+		if (GemDOS_PexecRelocate(Regs[REG_A5], Regs[REG_A4], Regs[REG_D7]))
+			m68k_incpc(2);
+		else
+		{
+			Regs[REG_A3] = STMemory_ReadLong(Regs[REG_A5] + 8);
+			m68k_incpc(4);
+		}
+	}
+	else
+	{
+		/* illegal instruction */
+		op_illg(opcode);
+	}
+	fill_prefetch_0();
+	return 4;
+}
+
 
 /**
  * Emulator Native Features ID opcode interception.
@@ -220,7 +254,6 @@ unsigned long OpCode_VDI(uae_u32 opcode)
 unsigned long OpCode_NatFeat_ID(uae_u32 opcode)
 {
 	Uint32 stack = Regs[REG_A7] + SIZE_LONG;	/* skip return address */
-	Uint16 SR = M68000_GetSR();
 
 	if (NatFeat_ID(stack, &(Regs[REG_D0]))) {
 		m68k_incpc(2);
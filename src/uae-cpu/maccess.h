@@ -17,7 +17,8 @@
 
 /* Can the actual CPU access unaligned memory? */
 #ifndef CPU_CAN_ACCESS_UNALIGNED
-# if defined(__i386__) || defined(powerpc) || defined(__mc68020__)
+# if defined(__i386__) || defined(__x86_64__) || defined(__aarch64__) \
+     || defined(powerpc) || defined(__mc68020__)
 #  define CPU_CAN_ACCESS_UNALIGNED 1
 # else
 #  define CPU_CAN_ACCESS_UNALIGNED 0
@@ -51,14 +52,65 @@ static inline void do_put_mem_word(void *a, uae_u16 v)
 	*(uae_u16 *)a = SDL_SwapBE16(v);
 }
 
+#define do_get_mem_long_aligned	do_get_mem_long
+#define do_get_mem_word_aligned	do_get_mem_word
+#define do_put_mem_long_aligned	do_put_mem_long
+#define do_put_mem_word_aligned	do_put_mem_word
+
 
 #else  /* Cpu can not access unaligned memory: */
 
+#include <stdint.h>
+#include <SDL_endian.h>
+
+/* Accesses to memory known to be 2-byte aligned, as 68000 word and long
+ * accesses always are: halfword loads/stores and one byte swap (rev16 /
+ * rev on ARM) instead of assembling the value byte by byte.
+ */
+static inline uae_u32 do_get_mem_long_aligned(void *a)
+{
+	uae_u16 *w = (uae_u16 *)a;
+
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+	return ((uae_u32)w[0] << 16) | w[1];
+#else
+	return SDL_Swap32(((uae_u32)w[1] << 16) | w[0]);
+#endif
+}
+
+static inline uae_u16 do_get_mem_word_aligned(void *a)
+{
+	return SDL_SwapBE16(*(uae_u16 *)a);
+}
+
+static inline void do_put_mem_long_aligned(void *a, uae_u32 v)
+{
+	uae_u16 *w = (uae_u16 *)a;
+
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+	w[0] = v >> 16;
+	w[1] = v;
+#else
+	v = SDL_Swap32(v);
+	w[0] = v;
+	w[1] = v >> 16;
+#endif
+}
+
+static inline void do_put_mem_word_aligned(void *a, uae_u16 v)
+{
+	*(uae_u16 *)a = SDL_SwapBE16(v);
+}
+
+#define MEM_IS_ALIGNED(a)	((((uintptr_t)(a)) & 1) == 0)
+
 
 static inline uae_u32 do_get_mem_long(void *a)
 {
 	uae_u8 *b = (uae_u8 *)a;
 
+	if (MEM_IS_ALIGNED(a))
+		return do_get_mem_long_aligned(a);
 	return (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
 }
 
@@ -66,6 +118,8 @@ static inline uae_u16 do_get_mem_word(void *a)
 {
 	uae_u8 *b = (uae_u8 *)a;
 
+	if (MEM_IS_ALIGNED(a))
+		return do_get_mem_word_aligned(a);
 	return (b[0] << 8) | b[1];
 }
 
@@ -74,6 +128,11 @@ static inline void do_put_mem_long(void *a, uae_u32 v)
 {
 	uae_u8 *b = (uae_u8 *)a;
 
+	if (MEM_IS_ALIGNED(a))
+	{
+		do_put_mem_long_aligned(a, v);
+		return;
+	}
 	b[0] = v >> 24;
 	b[1] = v >> 16;    
 	b[2] = v >> 8;
@@ -84,6 +143,11 @@ static inline void do_put_mem_word(void *a, uae_u16 v)
 {
 	uae_u8 *b = (uae_u8 *)a;
 
+	if (MEM_IS_ALIGNED(a))
+	{
+		do_put_mem_word_aligned(a, v);
+		return;
+	}
 	b[0] = v >> 8;
 	b[1] = v;
 }
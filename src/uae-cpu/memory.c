@@ -26,9 +26,15 @@ const char Memory_fileid[] = "Hatari memory.c : " __DATE__ " " __TIME__;
 #include "reset.h"
 #include "stMemory.h"
 #include "m68000.h"
+#include "screen.h"
+#include "video.h"
 
 #include "newcpu.h"
 
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
 
 /* Set illegal_mem to 1 for debug output: */
 #define illegal_mem 1
@@ -60,6 +66,9 @@ addrbank *mem_banks[65536];
 addrbank mem_banks[65536];
 #endif
 
+uae_u8 *mem_banks_rptr[65536];
+uae_u8 *mem_banks_wptr[65536];
+
 #ifdef NO_INLINE_MEMORY_ACCESS
 __inline__ uae_u32 longget (uaecptr addr)
 {
@@ -254,6 +263,8 @@ static void STmem_lput(uaecptr addr, uae_u32 l)
 {
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+    STRamDirty[(addr + 3) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     do_put_mem_long(STmemory + addr, l);
 }
 
@@ -261,6 +272,8 @@ static void STmem_wput(uaecptr addr, uae_u32 w)
 {
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+    STRamDirty[(addr + 1) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     do_put_mem_word(STmemory + addr, w);
 }
 
@@ -268,6 +281,7 @@ static void STmem_bput(uaecptr addr, uae_u32 b)
 {
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     STmemory[addr] = b;
 }
 
@@ -345,6 +359,8 @@ static void SysMem_lput(uaecptr addr, uae_u32 l)
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
 
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+    STRamDirty[(addr + 3) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     do_put_mem_long(STmemory + addr, l);
 }
 
@@ -359,6 +375,8 @@ static void SysMem_wput(uaecptr addr, uae_u32 w)
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
 
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
+    STRamDirty[(addr + 1) >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     do_put_mem_word(STmemory + addr, w);
 }
 
@@ -372,6 +390,7 @@ static void SysMem_bput(uaecptr addr, uae_u32 b)
 
     addr -= STmem_start & STmem_mask;
     addr &= STmem_mask;
+    STRamDirty[addr >> STRAM_PAGE_SHIFT] = STRAM_DIRTY_ALL;
     STmemory[addr] = b;
 }
 
@@ -589,6 +608,98 @@ static uae_u8 *IOmem_xlate(uaecptr addr)
 }
 
 
+/*
+ * **** Watched memory ****
+ * Banks containing addresses watched by the debugger are replaced with
+ * a bank whose functions call the original bank's functions. Writes to
+ * them additionally request a debugger check after the current
+ * instruction, so that watch-only breakpoints are evaluated only when
+ * the memory they depend on may have changed.
+ * In auto prefetch mode, the banks with the executing code are watched
+ * too, for writes to the prefetch window of the current instruction.
+ * With batched HBLs, the banks read by the batched lines are watched for
+ * writes that must happen after these lines were processed.
+ */
+static addrbank *watch_orig[256];	/* original banks, NULL if not watched */
+static uae_u8 watch_reasons[256];	/* MEMORY_WATCH_* bits */
+
+#define WATCH_ORIG(addr) (watch_orig[bankindex(addr) & 0xff])
+#define WATCH_REASONS(addr) (watch_reasons[bankindex(addr) & 0xff])
+
+static uae_u32 Watch_lget(uaecptr addr)
+{
+    return call_mem_get_func(WATCH_ORIG(addr)->lget, addr);
+}
+
+static uae_u32 Watch_wget(uaecptr addr)
+{
+    return call_mem_get_func(WATCH_ORIG(addr)->wget, addr);
+}
+
+static uae_u32 Watch_bget(uaecptr addr)
+{
+    return call_mem_get_func(WATCH_ORIG(addr)->bget, addr);
+}
+
+static void Watch_lput(uaecptr addr, uae_u32 l)
+{
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_VIDEO) {
+	Video_HBL_Sync();
+	if (!WATCH_ORIG(addr)) {
+	    longput(addr, l);
+	    return;
+	}
+    }
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_PREFETCH)
+	m68k_prefetch_check(addr, 4);
+    call_mem_put_func(WATCH_ORIG(addr)->lput, addr, l);
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_DEBUGGER)
+	set_special(SPCFLAG_DEBUGGER);
+}
+
+static void Watch_wput(uaecptr addr, uae_u32 w)
+{
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_VIDEO) {
+	Video_HBL_Sync();
+	if (!WATCH_ORIG(addr)) {
+	    wordput(addr, w);
+	    return;
+	}
+    }
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_PREFETCH)
+	m68k_prefetch_check(addr, 2);
+    call_mem_put_func(WATCH_ORIG(addr)->wput, addr, w);
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_DEBUGGER)
+	set_special(SPCFLAG_DEBUGGER);
+}
+
+static void Watch_bput(uaecptr addr, uae_u32 b)
+{
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_VIDEO) {
+	Video_HBL_Sync();
+	if (!WATCH_ORIG(addr)) {
+	    byteput(addr, b);
+	    return;
+	}
+    }
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_PREFETCH)
+	m68k_prefetch_check(addr, 1);
+    call_mem_put_func(WATCH_ORIG(addr)->bput, addr, b);
+    if (WATCH_REASONS(addr) & MEMORY_WATCH_DEBUGGER)
+	set_special(SPCFLAG_DEBUGGER);
+}
+
+static int Watch_check(uaecptr addr, uae_u32 size)
+{
+    return WATCH_ORIG(addr)->check(addr, size);
+}
+
+static uae_u8 *Watch_xlate(uaecptr addr)
+{
+    return WATCH_ORIG(addr)->xlateaddr(addr);
+}
+
+
 
 /* **** Address banks **** */
 
@@ -606,6 +717,13 @@ static addrbank BusErrMem_bank =
     BusErrMem_xlate, BusErrMem_check
 };
 
+static addrbank Watch_bank =
+{
+    Watch_lget, Watch_wget, Watch_bget,
+    Watch_lput, Watch_wput, Watch_bput,
+    Watch_xlate, Watch_check
+};
+
 static addrbank STmem_bank =
 {
     STmem_lget, STmem_wget, STmem_bget,
@@ -660,8 +778,35 @@ static addrbank IOmem_bank =
 static void init_mem_banks (void)
 {
     int i;
-    for (i = 0; i < 65536; i++)
+    for (i = 0; i < 65536; i++) {
 	put_mem_bank (i<<16, &dummy_bank);
+	mem_banks_rptr[i] = mem_banks_wptr[i] = NULL;
+    }
+    memset(watch_orig, 0, sizeof(watch_orig));
+    memset(watch_reasons, 0, sizeof(watch_reasons));
+}
+
+
+/*
+ * Set the direct access pointers of bank 'bnr' for given address bank.
+ * The bank functions of these do nothing more than access the memory;
+ * TT RAM is only direct if its mask wraps on the whole bank.
+ */
+static void set_mem_bank_ptr (addrbank *bank, int bnr)
+{
+    uaecptr addr = bnr << 16;
+    bool tt_direct = TTmem_size && (TTmem_size & TTmem_mask) == 0;
+
+    if (bank == &STmem_bank || bank == &ROMmem_bank
+        || (bank == &TTmem_bank && tt_direct))
+	mem_banks_rptr[bnr] = bank->xlateaddr(addr);
+    else
+	mem_banks_rptr[bnr] = NULL;
+
+    if (bank == &STmem_bank)
+	mem_banks_wptr[bnr] = bank->xlateaddr(addr);
+    else
+	mem_banks_wptr[bnr] = NULL;
 }
 
 
@@ -724,11 +869,23 @@ void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMe
     map_banks(&STmem_bank, 0x01, (STmem_size >> 16) - 1);
 
     /* TT memory isn't really supported yet */
-    if (TTmem_size > 0)
-	TTmemory = (uae_u8 *)malloc (TTmem_size);
-    if (TTmemory != 0)
+    if (TTmem_size > 0) {
+#if HAVE_SYS_MMAN_H
+	/* Anonymous mapping : zero pages are only allocated when used */
+	TTmemory = mmap(NULL, TTmem_size, PROT_READ | PROT_WRITE,
+	                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (TTmemory == MAP_FAILED)
+	    TTmemory = NULL;
+	else
+	    STMemory_AdviseHugePages(TTmemory, TTmem_size);
+#else
+	TTmemory = (uae_u8 *)calloc (1, TTmem_size);
+#endif
+    }
+    if (TTmemory != 0) {
+	TTmem_mask = TTmem_size - 1;
 	map_banks (&TTmem_bank, TTmem_start >> 16, TTmem_size >> 16);
-    else
+    } else
 	TTmem_size = 0;
     TTmem_mask = TTmem_size - 1;
 
@@ -765,14 +922,28 @@ void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMe
 }
 
 
+/*
+ * Return TT memory and its size, or NULL if there's none.
+ */
+uae_u8 *memory_get_ttmemory(uae_u32 *pSize)
+{
+    *pSize = TTmem_size;
+    return TTmem_size ? TTmemory : NULL;
+}
+
+
 /*
  * Uninitialize the memory banks.
  */
 void memory_uninit (void)
 {
     /* Here, we free allocated memory from memory_init */
-    if (TTmem_size > 0) {
+    if (TTmemory) {
+#if HAVE_SYS_MMAN_H
+	munmap(TTmemory, TTmem_size);
+#else
 	free(TTmemory);
+#endif
 	TTmemory = NULL;
     }
 
@@ -798,14 +969,56 @@ void map_banks (addrbank *bank, int start, int size)
     unsigned long int hioffs = 0, endhioffs = 0x100;
 
     if (start >= 0x100) {
-	for (bnr = start; bnr < start + size; bnr++)
+	for (bnr = start; bnr < start + size; bnr++) {
 	    put_mem_bank (bnr << 16, bank);
+	    set_mem_bank_ptr (bank, bnr);
+	}
 	return;
     }
     /* Some ROMs apparently require a 24 bit address space... */
     if (currprefs.address_space_24)
 	endhioffs = 0x10000;
     for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100)
-	for (bnr = start; bnr < start+size; bnr++)
+	for (bnr = start; bnr < start+size; bnr++) {
 	    put_mem_bank ((bnr + hioffs) << 16, bank);
+	    set_mem_bank_ptr (bank, bnr + hioffs);
+	}
+}
+
+
+/*
+ * Start or stop watching writes to given bank (in the 24-bit address
+ * space, including its mirrors) for the given MEMORY_WATCH_* reason.
+ * Reads from the bank are still done directly when possible.
+ */
+void memory_watch_bank(int bnr, int reason, bool watch)
+{
+    unsigned long int hioffs, endhioffs = 0x100;
+    addrbank *bank;
+
+    bnr &= 0xff;
+    if (watch)
+	watch_reasons[bnr] |= reason;
+    else
+	watch_reasons[bnr] &= ~reason;
+    watch = watch_reasons[bnr] != 0;
+    if (watch == (watch_orig[bnr] != NULL))
+	return;
+
+    if (watch) {
+	watch_orig[bnr] = mem_banks[bnr];
+	bank = &Watch_bank;
+    } else {
+	bank = watch_orig[bnr];
+	watch_orig[bnr] = NULL;
+    }
+    if (currprefs.address_space_24)
+	endhioffs = 0x10000;
+    for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100) {
+	put_mem_bank ((bnr + hioffs) << 16, bank);
+	if (watch)
+	    mem_banks_wptr[bnr + hioffs] = NULL;
+	else
+	    set_mem_bank_ptr (bank, bnr + hioffs);
+    }
 }
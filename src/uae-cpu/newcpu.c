@@ -144,6 +144,7 @@ const char NewCpu_fileid[] = "Hatari newcpu.c : " __DATE__ " " __TIME__;
 #include "newcpu.h"
 #include "main.h"
 #include "m68000.h"
+#include "stMemory.h"
 #include "cycInt.h"
 #include "mfp.h"
 #include "tos.h"
@@ -160,6 +161,8 @@ const char NewCpu_fileid[] = "Hatari newcpu.c : " __DATE__ " " __TIME__;
 #include "debugui.h"
 #include "debugcpu.h"
 #include "68kDisass.h"
+#include "perfcount.h"
+#include "timeline.h"
 
 #ifdef HAVE_CAPSIMAGE
 #if CAPSIMAGE_VERSION == 5
@@ -191,7 +194,12 @@ int fpp_movem_index1[256];
 int fpp_movem_index2[256];
 int fpp_movem_next[256];
 
-cpuop_func *cpufunctbl[65536];
+/* Opcode -> handler through a 16-bit index, 128 KB instead of the 512 KB
+ * a pointer per opcode takes on 64-bit hosts (there are < 2000 distinct
+ * handlers per CPU level). Index 0 is always op_illg_1. */
+cpuop_func *cpufunc_handlers[CPUFUNC_HANDLERS_MAX];
+uae_u16 cpufunc_index[65536];
+static int cpufunc_handlers_count;
 
 int OpcodeFamily;
 int BusCyclePenalty = 0;
@@ -258,42 +266,79 @@ static unsigned long REGPARAM2 op_illg_1 (uae_u32 opcode)
 }
 
 
+/*
+ * Return index of given handler in cpufunc_handlers[], adding it
+ * if it's not there yet.
+ */
+static uae_u16 cpufunc_handler_id(cpuop_func *f)
+{
+    int i;
+
+    for (i = cpufunc_handlers_count - 1; i >= 0; i--) {
+	if (cpufunc_handlers[i] == f)
+	    return i;
+    }
+    if (cpufunc_handlers_count >= CPUFUNC_HANDLERS_MAX)
+	abort();
+    cpufunc_handlers[cpufunc_handlers_count] = f;
+    return cpufunc_handlers_count++;
+}
+
+/*
+ * Set handler for given opcode (e.g. for Hatari's own illegal opcodes).
+ */
+void cpufunctbl_set(uae_u32 opcode, cpuop_func *f)
+{
+    cpufunc_index[opcode & 0xffff] = cpufunc_handler_id(f);
+}
+
 void build_cpufunctbl(void)
 {
     int i;
     unsigned long opcode;
+#if ENABLE_ST_ONLY
+    /* only the 68000 tables get linked in */
+    const struct cputbl *tbl = (! currprefs.cpu_compatible ? op_smalltbl_4_ff
+			      : op_smalltbl_5_ff);
+#else
     const struct cputbl *tbl = (currprefs.cpu_level == 4 ? op_smalltbl_0_ff
 			      : currprefs.cpu_level == 3 ? op_smalltbl_1_ff
 			      : currprefs.cpu_level == 2 ? op_smalltbl_2_ff
 			      : currprefs.cpu_level == 1 ? op_smalltbl_3_ff
 			      : ! currprefs.cpu_compatible ? op_smalltbl_4_ff
 			      : op_smalltbl_5_ff);
+#endif
 
     Log_Printf(LOG_DEBUG, "Building CPU function table (%d %d %d).\n",
 	           currprefs.cpu_level, currprefs.cpu_compatible, currprefs.address_space_24);
 
+    /* one slot per generated table entry, no need to search */
+    cpufunc_handlers[0] = op_illg_1;
+    cpufunc_handlers_count = 1;
     for (opcode = 0; opcode < 65536; opcode++)
-	cpufunctbl[opcode] = op_illg_1;
+	cpufunc_index[opcode] = 0;
     for (i = 0; tbl[i].handler != NULL; i++) {
+	if (cpufunc_handlers_count >= CPUFUNC_HANDLERS_MAX)
+	    abort();
+	cpufunc_handlers[cpufunc_handlers_count] = tbl[i].handler;
 	if (! tbl[i].specific)
-	    cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+	    cpufunc_index[tbl[i].opcode] = cpufunc_handlers_count;
+	cpufunc_handlers_count++;
     }
     for (opcode = 0; opcode < 65536; opcode++) {
-	cpuop_func *f;
-
 	if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > currprefs.cpu_level)
 	    continue;
 
 	if (table68k[opcode].handler != -1) {
-	    f = cpufunctbl[table68k[opcode].handler];
-	    if (f == op_illg_1)
+	    uae_u16 id = cpufunc_index[table68k[opcode].handler];
+	    if (id == 0)
 		abort();
-	    cpufunctbl[opcode] = f;
+	    cpufunc_index[opcode] = id;
 	}
     }
     for (i = 0; tbl[i].handler != NULL; i++) {
 	if (tbl[i].specific)
-	    cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+	    cpufunc_index[tbl[i].opcode] = i + 1;
     }
 }
 
@@ -377,7 +422,7 @@ static int backup_pointer = 0;
 struct regstruct lastint_regs;
 int lastint_no;
 */
-struct regstruct regs;
+struct regstruct regs CACHE_ALIGNED;
 static long int m68kpc_offset;
 
 
@@ -868,6 +913,54 @@ static void InterruptAddJitter (int Level , int Pending)
 }
 
 
+/* Interrupt cycles after the IACK sequence, see the end of Exception() */
+#define INTERRUPT_CYCLES_MFP	(44+12-CPU_IACK_CYCLES_MFP)
+#define INTERRUPT_CYCLES_VIDEO	(44+12-CPU_IACK_CYCLES_VIDEO)
+#define INTERRUPT_CYCLES_OTHER	(44+4)
+
+/* Stack frame and new PC for an MFP or autovector interrupt on a 68000.
+ * This is what Exception() does for these, without the checks for
+ * the CPU exceptions, the debugger and the 68010+ stack frames, as there
+ * can be hundreds of such interrupts per frame. */
+static void Exception_Interrupt68000(int nr, uaecptr currpc, int ExceptionSource)
+{
+    uaecptr newpc;
+
+    MakeSR();
+    if (!regs.s) {
+	regs.usp = m68k_areg(regs, 7);
+	m68k_areg(regs, 7) = regs.isp;
+	regs.s = 1;
+    }
+
+    m68k_areg(regs, 7) -= 4;
+    put_long (m68k_areg(regs, 7), currpc);
+    m68k_areg(regs, 7) -= 2;
+    put_word (m68k_areg(regs, 7), regs.sr);
+
+    newpc = get_long (regs.vbr + 4*nr);
+    LOG_TRACE(TRACE_CPU_EXCEPTION, "cpu exception %d currpc %x buspc %x newpc %x fault_e3 %x op_e3 %hx addr_e3 %x\n",
+	nr, currpc, BusErrorPC, newpc, last_fault_for_exception_3, last_op_for_exception_3, last_addr_for_exception_3);
+
+    if (newpc & 1) {
+	fprintf(stderr,"Address Error during exception, new PC=$%x\n",newpc);
+	Exception ( 3 , m68k_getpc() , M68000_EXC_SRC_CPU );
+	return;
+    }
+
+    m68k_setpc (newpc);
+    fill_prefetch_0 ();
+    exception_trace (nr);
+
+    if (ExceptionSource == M68000_EXC_SRC_INT_MFP)
+	M68000_AddCycles(INTERRUPT_CYCLES_MFP);
+    else if (nr == 26 || nr == 28)
+	M68000_AddCycles(INTERRUPT_CYCLES_VIDEO);
+    else
+	M68000_AddCycles(INTERRUPT_CYCLES_OTHER);
+}
+
+
 /* Handle exceptions. We need a special case to handle MFP exceptions */
 /* on Atari ST, because it's possible to change the MFP's vector base */
 /* and get a conflict with 'normal' cpu exceptions. */
@@ -883,8 +976,10 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
     {
         M68000_AddCycles ( CPU_IACK_CYCLES_MFP );
 	CPU_IACK = true;
+        PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
         while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
             CALL_VAR(PendingInterruptFunction);
+        PERFCOUNT_END(nPerfPrev);
         nr = MFP_ProcessIACK ( nr );
 	CPU_IACK = false;
     }
@@ -892,14 +987,30 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
     {
         M68000_AddCycles ( CPU_IACK_CYCLES_VIDEO );
 	CPU_IACK = true;
+        PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
         while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
             CALL_VAR(PendingInterruptFunction);
+        PERFCOUNT_END(nPerfPrev);
         if ( MFP_UpdateNeeded == true )
             MFP_UpdateIRQ ( 0 );					/* update MFP's state if some internal timers related to MFP expired */
+        if ( nr == 26 )
+            Video_HBL_Sync ();						/* batched HBLs set the pending bit too */
         pendingInterrupts &= ~( 1 << ( nr - 24 ) );			/* clear HBL or VBL pending bit */
 	CPU_IACK = false;
     }
 
+    if (unlikely(bTimelineEnabled) && ExceptionSource != M68000_EXC_SRC_CPU)
+        Timeline_AddInterrupt(nr, ExceptionSource);
+
+    /* Usual interrupts on a 68000 (MFP vectors can also be below 24 */
+    /* if its vector base was changed, these take the generic path) */
+    if (currprefs.cpu_level == 0 && nr >= 24
+	&& (ExceptionSource == M68000_EXC_SRC_INT_MFP || ExceptionSource == M68000_EXC_SRC_AUTOVEC))
+    {
+	Exception_Interrupt68000(nr, currpc, ExceptionSource);
+	return;
+    }
+
 
     if (ExceptionSource == M68000_EXC_SRC_CPU)
       {
@@ -1103,16 +1214,16 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
     /* Handle exception cycles (special case for MFP) */
     if (ExceptionSource == M68000_EXC_SRC_INT_MFP)
     {
-      M68000_AddCycles(44+12-CPU_IACK_CYCLES_MFP);	/* MFP interrupt, 'nr' can be in a different range depending on $fffa17 */
+      M68000_AddCycles(INTERRUPT_CYCLES_MFP);		/* MFP interrupt, 'nr' can be in a different range depending on $fffa17 */
     }
     else if (nr >= 24 && nr <= 31)
     {
       if ( nr == 26 )					/* HBL */
-        M68000_AddCycles(44+12-CPU_IACK_CYCLES_VIDEO);	/* Video Interrupt */
+        M68000_AddCycles(INTERRUPT_CYCLES_VIDEO);	/* Video Interrupt */
       else if ( nr == 28 ) 				/* VBL */
-        M68000_AddCycles(44+12-CPU_IACK_CYCLES_VIDEO);	/* Video Interrupt */
+        M68000_AddCycles(INTERRUPT_CYCLES_VIDEO);	/* Video Interrupt */
       else
-        M68000_AddCycles(44+4);				/* Other Interrupts */
+        M68000_AddCycles(INTERRUPT_CYCLES_OTHER);	/* Other Interrupts */
     }
     else if(nr >= 32 && nr <= 47)
     {
@@ -1515,6 +1626,100 @@ void m68k_mull (uae_u32 opcode, uae_u32 src, uae_u16 extra)
 }
 
 
+/*
+ * Auto prefetch mode: the 68000 runs without prefetch emulation, with the
+ * memory banks holding the current instruction and the words following
+ * it watched for writes. A write there would not have been seen by a real
+ * 68000 if the words were already in its prefetch queue, so the prefetch
+ * emulation is switched on, seeded with the words from before the write.
+ */
+#define PREFETCH_WINDOW 16	/* longest 68000 instruction + 2 prefetched words */
+
+static int prefetch_watch_first = -1, prefetch_watch_last = -1;
+static uae_u32 prefetch_watch_base = 0x80000000;	/* never matches */
+static uae_u8 prefetch_saved[PREFETCH_WINDOW];
+static uaecptr prefetch_saved_pc;
+static bool prefetch_saved_valid;
+static bool prefetch_hit;
+
+/* Stop watching the banks of the executing code */
+static void m68k_prefetch_unwatch (void)
+{
+    if (prefetch_watch_first >= 0)
+	memory_watch_bank (prefetch_watch_first, MEMORY_WATCH_PREFETCH, false);
+    if (prefetch_watch_last >= 0)
+	memory_watch_bank (prefetch_watch_last, MEMORY_WATCH_PREFETCH, false);
+    prefetch_watch_first = prefetch_watch_last = -1;
+    prefetch_watch_base = 0x80000000;
+}
+
+/* Watch the banks of the prefetch window at given PC */
+static void m68k_prefetch_watch (uaecptr pc)
+{
+    int first = (pc >> 16) & 0xff;
+    int last = ((pc + PREFETCH_WINDOW - 1) >> 16) & 0xff;
+
+    /* a window crossing banks is checked again on every instruction */
+    prefetch_watch_base = (first == last ? pc & 0xff0000 : 0x80000000);
+    if (first == prefetch_watch_first && last == prefetch_watch_last)
+	return;
+    m68k_prefetch_unwatch ();
+    memory_watch_bank (first, MEMORY_WATCH_PREFETCH, true);
+    memory_watch_bank (last, MEMORY_WATCH_PREFETCH, true);
+    prefetch_watch_first = first;
+    prefetch_watch_last = last;
+}
+
+/* Called for each instruction in auto prefetch mode, with the PC of it */
+STATIC_INLINE void m68k_prefetch_watch_pc (uaecptr pc)
+{
+    pc &= 0xffffff;
+    if (unlikely(pc - prefetch_watch_base > 0x10000 - PREFETCH_WINDOW))
+	m68k_prefetch_watch (pc);
+}
+
+/* Called before a write of 'size' bytes to 'addr' in a watched bank */
+void m68k_prefetch_check (uaecptr addr, int size)
+{
+    uaecptr pc = BusErrorPC & 0xffffff;
+
+    if (((addr + size - 1 - pc) & 0xffffff) >= (uae_u32)(PREFETCH_WINDOW + size - 1)
+        || prefetch_hit)
+	return;
+
+    /* keep the code as the prefetch queue would have seen it */
+    prefetch_saved_pc = pc;
+    prefetch_saved_valid = pc + PREFETCH_WINDOW <= STRamEnd;
+    if (prefetch_saved_valid)
+	memcpy (prefetch_saved, &STRam[pc], PREFETCH_WINDOW);
+    prefetch_hit = true;
+    set_special (SPCFLAG_MODE_CHANGE);
+}
+
+/* Leave the auto prefetch mode after a write to the prefetch window */
+static void m68k_prefetch_enable (void)
+{
+    uaecptr pc = m68k_getpc ();
+    uae_u32 offs = (pc - prefetch_saved_pc) & 0xffffff;
+
+    prefetch_hit = false;
+    M68000_PrefetchNeeded ();
+    m68k_prefetch_unwatch ();
+
+    if (prefetch_saved_valid && offs <= PREFETCH_WINDOW - 4 && !(offs & 1)) {
+	/* next instruction continues in the window, use the old words */
+#ifdef UNALIGNED_PROFITABLE
+	regs.prefetch = do_get_mem_long (prefetch_saved + offs);
+#else
+	do_put_mem_long (&regs.prefetch, do_get_mem_long (prefetch_saved + offs));
+#endif
+	regs.prefetch_pc = pc;
+    } else {
+	/* force a refill on the next fetch */
+	regs.prefetch_pc = pc + 4;
+    }
+}
+
 void m68k_reset (void)
 {
     regs.s = 1;
@@ -1535,6 +1740,9 @@ void m68k_reset (void)
     m68k_areg(regs, 7) = get_long(0);
     m68k_setpc(get_long(4));
     refill_prefetch (m68k_getpc(), 0);
+
+    prefetch_hit = false;
+    m68k_prefetch_unwatch ();
 }
 
 
@@ -1687,12 +1895,23 @@ static int do_specialties (void)
 	    if (regs.spcflags & SPCFLAG_BRK)
 		return 1;
 	
-	    M68000_AddCycles(4);
+	    /* Without a delayed MFP/DSP int (checked below after each step),
+	     * only the next cycle int can leave the STOP state : go straight
+	     * to it instead of adding 4 cycles at a time until it's reached */
+	    if ( ( PendingInterruptCount > 0 ) && ( ( regs.spcflags & ( SPCFLAG_MFP | SPCFLAG_DSP ) ) == 0 ) )
+	    {
+		int StepInternal = INT_CONVERT_TO_INTERNAL ( 4 >> nCpuFreqShift , INT_CPU_CYCLE );
+		M68000_AddCycles ( 4 * ( ( PendingInterruptCount + StepInternal - 1 ) / StepInternal ) );
+	    }
+	    else
+		M68000_AddCycles(4);
 	
 	    /* It is possible one or more ints happen at the same time */
 	    /* We must process them during the same cpu cycle then choose the highest priority one */
+	    PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
 		CALL_VAR(PendingInterruptFunction);
+	    PERFCOUNT_END(nPerfPrev);
 	    if ( MFP_UpdateNeeded == true )
 	        MFP_UpdateIRQ ( 0 );
 
@@ -1774,10 +1993,15 @@ static void m68k_run_1 (void)
 	{
 	    int FrameCycles, HblCounterVideo, LineCycles;
 
-	    Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	    if (TraceBinFile)
+		Log_TraceRecord(TRACE_RECORD_CPU_PC, 2, m68k_getpc (), opcode);
+	    else
+	    {
+		Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
-	    LOG_TRACE_PRINT ( "cpu video_cyc=%6d %3d@%3d : " , FrameCycles, LineCycles, HblCounterVideo );
-	    Disasm(stderr, m68k_getpc (), NULL, 1);
+		LOG_TRACE_PRINT ( "cpu video_cyc=%6d %3d@%3d : " , FrameCycles, LineCycles, HblCounterVideo );
+		Disasm(stderr, m68k_getpc (), NULL, 1);
+	    }
 	}
 
 	/* assert (!regs.stopped && !(regs.spcflags & SPCFLAG_STOP)); */
@@ -1800,7 +2024,7 @@ static void m68k_run_1 (void)
 	//if ( CAPSGetDebugRequest() )
 	//  DebugUI(REASON_CPU_BREAKPOINT);
 
-	cycles = (*cpufunctbl[opcode])(opcode);
+	cycles = (*cpufunctbl_get(opcode))(opcode);
 //fprintf (stderr, "ir out %x %x\n",do_get_mem_long(&regs.prefetch) , regs.prefetch_pc);
 
 #ifdef DEBUG_PREFETCH
@@ -1826,8 +2050,10 @@ static void m68k_run_1 (void)
 	/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	if ( PendingInterruptCount <= 0 )
 	{
+	    PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
 		CALL_VAR ( PendingInterruptFunction );		/* call the interrupt's handler */
+	    PERFCOUNT_END(nPerfPrev);
 	    if ( MFP_UpdateNeeded == true )
 		MFP_UpdateIRQ ( 0 );				/* update MFP's state if some internal timers related to MFP expired */
 	}
@@ -1845,6 +2071,139 @@ static void m68k_run_1 (void)
 }
 
 
+#if !defined(DEBUG_PREFETCH) && COUNT_INSTRS == 0
+#define M68K_RUN_FAST 1
+
+#if defined(__GNUC__)
+#define M68K_RUN_INLINE static inline __attribute__((always_inline))
+#else
+#define M68K_RUN_INLINE static inline
+#endif
+
+/* Same as m68k_run_1 / m68k_run_2, for the common case where CPU
+   disassembly tracing isn't active and with the prefetch, DSP and wait
+   state choices fixed at compile time, so that the specialized loops below have no
+   per-instruction checks of the configuration. Those settings can only
+   change from interrupt handlers (reset, GUI, debugger shortcut) or from
+   the debugger run through do_specialties(), so they are checked only
+   there instead of on every instruction; m68k_go then picks the right
+   loop again. */
+M68K_RUN_INLINE void m68k_run_fast (const bool prefetch, const bool dsp, const bool waitstates,
+                                     const bool autoprefetch)
+{
+    for (;;) {
+	int cycles;
+	bool recheck = false;
+	uae_u32 opcode = prefetch ? get_iword_prefetch (0) : get_iword (0);
+
+	if (prefetch && (regs.spcflags & SPCFLAG_BUSERROR))
+	{
+	    unset_special(SPCFLAG_BUSERROR);
+	    Exception(2,0,M68000_EXC_SRC_CPU);
+
+	    /* Get opcode for bus error handler and check other special bits */
+	    opcode = get_iword_prefetch (0);
+	    if (regs.spcflags) {
+		if (do_specialties ())
+		    return;
+	    }
+	}
+
+	/* In case of a Bus Error, we need the PC of the instruction that caused */
+	/* the error to build the exception stack frame */
+	BusErrorPC = m68k_getpc();
+	if (autoprefetch)
+	    m68k_prefetch_watch_pc(BusErrorPC);
+
+	if (dsp && prefetch)
+	    Cycles_SetCounter(CYCLES_COUNTER_CPU, 0);	/* to measure the total number of cycles spent in the cpu */
+
+	cycles = (*cpufunctbl_get(opcode))(opcode);
+
+	if (dsp && !prefetch)
+	    Cycles_SetCounter(CYCLES_COUNTER_CPU, 0);
+
+	if (prefetch)
+	    M68000_AddCyclesWithPairing(cycles);
+	else
+	    M68000_AddCycles(cycles);
+	if (waitstates && (regs.spcflags & SPCFLAG_EXTRA_CYCLES)) {
+	  /* Add some extra cycles to simulate a wait state */
+	  unset_special(SPCFLAG_EXTRA_CYCLES);
+	  M68000_AddCycles(nWaitStateCycles);
+	  nWaitStateCycles = 0;
+	}
+
+	/* See m68k_run_1 for the interrupt handling order */
+	if ( PendingInterruptCount <= 0 )
+	{
+	    PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
+	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction )
+		    && ( !prefetch || ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
+		CALL_VAR ( PendingInterruptFunction );		/* call the interrupt's handler */
+	    PERFCOUNT_END(nPerfPrev);
+	    if ( MFP_UpdateNeeded == true )
+		MFP_UpdateIRQ ( 0 );				/* update MFP's state if some internal timers related to MFP expired */
+	    recheck = true;
+	}
+
+	if (regs.spcflags) {
+	    if (do_specialties ())
+		return;
+	    recheck = true;
+	}
+
+	if (recheck && bDspEnabled != dsp)
+	    return;
+
+	/* Run DSP 56k code if necessary */
+	if (dsp) {
+	    DSP_Run( Cycles_GetCounter(CYCLES_COUNTER_CPU) * (prefetch ? 2 : 1) );
+	}
+
+	if (recheck && LOG_TRACE_LEVEL(TRACE_CPU_DISASM))
+	    return;
+    }
+}
+
+/* ST/STE: 68000 with prefetch, no DSP */
+static void m68k_run_1_fast (void)
+{
+    m68k_run_fast (true, false, true, false);
+}
+
+/* Falcon in compatible CPU mode */
+static void m68k_run_1_fast_dsp (void)
+{
+    m68k_run_fast (true, true, true, false);
+}
+
+/* TT: 68030 without DSP */
+static void m68k_run_2_fast (void)
+{
+    m68k_run_fast (false, false, true, false);
+}
+
+/* Falcon: 68030 with DSP */
+static void m68k_run_2_fast_dsp (void)
+{
+    m68k_run_fast (false, true, true, false);
+}
+
+/* ST/STE in auto prefetch mode: 68000 without prefetch until it's needed */
+static void m68k_run_2_fast_auto (void)
+{
+    m68k_run_fast (false, false, true, true);
+}
+
+/* Fast timing mode: no wait states (nor pairing, as there's no prefetch) */
+static void m68k_run_2_fast_timing (void)
+{
+    m68k_run_fast (false, false, false, false);
+}
+#endif
+
+
 /* Same thing, but don't use prefetch to get opcode.  */
 static void m68k_run_2 (void)
 {
@@ -1857,10 +2216,15 @@ static void m68k_run_2 (void)
 	{
 	    int FrameCycles, HblCounterVideo, LineCycles;
 
-	    Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	    if (TraceBinFile)
+		Log_TraceRecord(TRACE_RECORD_CPU_PC, 2, m68k_getpc (), opcode);
+	    else
+	    {
+		Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
-	    LOG_TRACE_PRINT ( "cpu video_cyc=%6d %3d@%3d : " , FrameCycles, LineCycles, HblCounterVideo );
-	    Disasm(stderr, m68k_getpc (), NULL, 1);
+		LOG_TRACE_PRINT ( "cpu video_cyc=%6d %3d@%3d : " , FrameCycles, LineCycles, HblCounterVideo );
+		Disasm(stderr, m68k_getpc (), NULL, 1);
+	    }
 	}
 
 	/* assert (!regs.stopped && !(regs.spcflags & SPCFLAG_STOP)); */
@@ -1875,8 +2239,10 @@ static void m68k_run_2 (void)
 	/* In case of a Bus Error, we need the PC of the instruction that caused */
 	/* the error to build the exception stack frame */
 	BusErrorPC = m68k_getpc();
+	if (bPrefetchAuto)
+	    m68k_prefetch_watch_pc(BusErrorPC);
 
-	cycles = (*cpufunctbl[opcode])(opcode);
+	cycles = (*cpufunctbl_get(opcode))(opcode);
 
 	if (bDspEnabled)
 	    Cycles_SetCounter(CYCLES_COUNTER_CPU, 0);	/* to measure the total number of cycles spent in the cpu */
@@ -1891,8 +2257,10 @@ static void m68k_run_2 (void)
 
         if ( PendingInterruptCount <= 0 )
 	{
+	    PERFCOUNT_BEGIN(PERFCOUNT_CYCINT, nPerfPrev);
 	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
 		CALL_VAR(PendingInterruptFunction);
+	    PERFCOUNT_END(nPerfPrev);
 	    if ( MFP_UpdateNeeded == true )
 		MFP_UpdateIRQ ( 0 );
 	}
@@ -1921,6 +2289,24 @@ void m68k_go (int may_quit)
 
     in_m68k_go++;
     while (!(regs.spcflags & SPCFLAG_BRK)) {
+        if (unlikely(prefetch_hit))
+          m68k_prefetch_enable();
+        else if (!bPrefetchAuto)
+          m68k_prefetch_unwatch();
+#ifdef M68K_RUN_FAST
+        if (!LOG_TRACE_LEVEL(TRACE_CPU_DISASM))
+        {
+          if (currprefs.cpu_compatible)
+            bDspEnabled ? m68k_run_1_fast_dsp() : m68k_run_1_fast();
+          else if (bDspEnabled)
+            m68k_run_2_fast_dsp();
+          else if (bPrefetchAuto)
+            m68k_run_2_fast_auto();
+          else
+            bFastTiming ? m68k_run_2_fast_timing() : m68k_run_2_fast();
+          continue;
+        }
+#endif
         if(currprefs.cpu_compatible)
           m68k_run_1();
          else
@@ -1941,7 +2327,7 @@ static void m68k_verify (uaecptr addr, uaecptr *nextpc)
     last_op_for_exception_3 = opcode;
     m68kpc_offset = 2;
 
-    if (cpufunctbl[opcode] == op_illg_1) {
+    if (cpufunctbl_get(opcode) == op_illg_1) {
 	opcode = 0x4AFC;
     }
     dp = table68k + opcode;
@@ -1991,7 +2377,7 @@ void m68k_disasm (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt)
 
 	opcode = get_iword_1 (m68kpc_offset);
 	m68kpc_offset += 2;
-	if (cpufunctbl[opcode] == op_illg_1) {
+	if (cpufunctbl_get(opcode) == op_illg_1) {
 	    opcode = 0x4AFC;
 	}
 	dp = table68k + opcode;
@@ -2126,6 +2512,12 @@ STATIC_INLINE int getDivu68kCycles_2 (uae_u32 dividend, uae_u16 divisor)
 	return (mcycles = 5) * 2;
 
     mcycles = 38;
+
+    // Without carry from the shifts (partial remainder always < $8000),
+    // each of the 15 quotient msbits takes 1 cycle if set, 2 if clear
+    if (divisor <= 0x8000)
+	return (mcycles + 30 - m68k_bitcount ((dividend / divisor) & 0xfffe)) * 2;
+
     hdivisor = divisor << 16;
 
     for (i = 0; i < 15; i++) {
@@ -2163,7 +2555,6 @@ STATIC_INLINE int getDivs68kCycles_2 (uae_s32 dividend, uae_s16 divisor)
 {
     int mcycles;
     uae_u32 aquot;
-    int i;
 
     if (divisor == 0)
 	return 0;
@@ -2189,13 +2580,8 @@ STATIC_INLINE int getDivs68kCycles_2 (uae_s32 dividend, uae_s16 divisor)
 	    mcycles++;
     }
 
-    // Count 15 msbits in absolute of quotient
-
-    for (i = 0; i < 15; i++) {
-	if ((uae_s16)aquot >= 0)
-	    mcycles++;
-	aquot <<= 1;
-    }
+    // Count 15 msbits in absolute of quotient (one cycle for each clear bit)
+    mcycles += 15 - m68k_bitcount (aquot & 0xfffe);
 
     return mcycles * 2;
 }
@@ -163,8 +163,8 @@ STATIC_INLINE uaecptr m68k_getpc_p (uae_u8 *p)
 }
 
 #define get_ibyte(o) do_get_mem_byte(regs.pc_p + (o) + 1)
-#define get_iword(o) do_get_mem_word(regs.pc_p + (o))
-#define get_ilong(o) do_get_mem_long(regs.pc_p + (o))
+#define get_iword(o) do_get_mem_word_aligned(regs.pc_p + (o))
+#define get_ilong(o) do_get_mem_long_aligned(regs.pc_p + (o))
 
 STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
 {
@@ -341,6 +341,7 @@ extern void m68k_go (int);
 extern void m68k_dumpstate (FILE *, uaecptr *);
 extern void m68k_disasm (FILE *, uaecptr, uaecptr *, int);
 extern void m68k_reset (void);
+extern void m68k_prefetch_check (uaecptr addr, int size);
 
 extern void mmu_op (uae_u32, uae_u16);
 
@@ -352,6 +353,18 @@ extern void fbcc_opp (uae_u32, uaecptr, uae_u32);
 extern void fsave_opp (uae_u32);
 extern void frestore_opp (uae_u32);
 
+/* Number of bits set, for the MUL/DIV cycle counts */
+STATIC_INLINE int m68k_bitcount (uae_u32 v)
+{
+#ifdef __GNUC__
+    return __builtin_popcount (v);
+#else
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    return (((v + (v >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+#endif
+}
+
 extern int getDivu68kCycles (uae_u32 dividend, uae_u16 divisor);
 extern int getDivs68kCycles (uae_s32 dividend, uae_s16 divisor);
 
@@ -379,7 +392,11 @@ extern const struct cputbl op_smalltbl_4_ff[];
 /* 68000 slow but compatible.  */
 extern const struct cputbl op_smalltbl_5_ff[];
 
-extern cpuop_func *cpufunctbl[65536];
+#define CPUFUNC_HANDLERS_MAX 4096
+extern cpuop_func *cpufunc_handlers[CPUFUNC_HANDLERS_MAX];
+extern uae_u16 cpufunc_index[65536];
+#define cpufunctbl_get(opcode) (cpufunc_handlers[cpufunc_index[opcode]])
+extern void cpufunctbl_set(uae_u32 opcode, cpuop_func *f);
 
 extern uae_u32 caar, cacr;
 
@@ -144,6 +144,15 @@ typedef uae_u32 uaecptr;
  */
 #define CPU_EMU_SIZE 0
 
+/* Placement hints for the generated opcode handlers (see gencpu.c) */
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+# define OPCODE_HOT __attribute__((hot))
+# define OPCODE_COLD __attribute__((cold))
+#else
+# define OPCODE_HOT
+# define OPCODE_COLD
+#endif
+
 #ifndef REGPARAM
 # define REGPARAM
 #endif
@@ -745,6 +745,49 @@ int ZEXPORT unzLocateFile (unzFile file, const char *szFileName, int iCaseSensit
 }
 
 
+/**
+ * Get the position of the current file in the central directory
+ * return UNZ_OK if there is no problem
+ */
+int ZEXPORT unzGetFilePos (unzFile file, unz_file_pos *file_pos)
+{
+	unz_s* s;
+
+	if (file==NULL || file_pos==NULL)
+		return UNZ_PARAMERROR;
+	s=(unz_s*)file;
+	if (!s->current_file_ok)
+		return UNZ_END_OF_LIST_OF_FILE;
+
+	file_pos->pos_in_zip_directory = s->pos_in_central_dir;
+	file_pos->num_of_file = s->num_file;
+	return UNZ_OK;
+}
+
+
+/**
+ * Set the current file of the zipfile to the one at file_pos
+ * return UNZ_OK if there is no problem
+ */
+int ZEXPORT unzGoToFilePos (unzFile file, const unz_file_pos *file_pos)
+{
+	unz_s* s;
+	int err;
+
+	if (file==NULL || file_pos==NULL)
+		return UNZ_PARAMERROR;
+	s=(unz_s*)file;
+
+	s->pos_in_central_dir = file_pos->pos_in_zip_directory;
+	s->num_file = file_pos->num_of_file;
+	err = unzlocal_GetCurrentFileInfoInternal(file,&s->cur_file_info,
+											   &s->cur_file_info_internal,
+											   NULL,0,NULL,0,NULL,0);
+	s->current_file_ok = (err == UNZ_OK);
+	return err;
+}
+
+
 /**
  * Read the local header of the current zipfile
  * Check the coherency of the local header and info in the end of central
@@ -22,6 +22,7 @@ const char VDI_fileid[] = "Hatari vdi.c : " __DATE__ " " __TIME__;
 #include "vdi.h"
 #include "video.h"
 #include "configuration.h"
+#include "log.h"
 
 
 Uint32 VDI_OldPC;                  /* When call Trap#2, store off PC */
@@ -37,6 +38,11 @@ int VDIPlanes = 4;
 static Uint32 LineABase;           /* Line-A structure */
 static Uint32 FontBase;            /* Font base, used for 16-pixel high font */
 
+/* NF_VDI accelerated drawing */
+static bool bVdiAccel;             /* guest driver reports all screen changes */
+static int VDIDirtyFirst = -1;     /* screen lines changed since last frame */
+static int VDIDirtyLast = -1;
+
 /* Last VDI opcode & vectors */
 static Uint16 VDIOpCode;
 static Uint32 VDIControl;
@@ -159,6 +165,9 @@ void VDI_Reset(void)
 {
 	/* no VDI calls in progress */
 	VDI_OldPC = 0;
+	/* driver needs to be re-initialized */
+	bVdiAccel = false;
+	VDIDirtyFirst = VDIDirtyLast = -1;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -900,6 +909,348 @@ void VDI_Complete(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Add screen lines y...y+h-1 to the lines changed since last frame
+ */
+static void VDI_MarkDirty(int y, int h)
+{
+	if (h <= 0)
+		return;
+	if (VDIDirtyFirst < 0 || y < VDIDirtyFirst)
+		VDIDirtyFirst = y;
+	if (y + h - 1 > VDIDirtyLast)
+		VDIDirtyLast = y + h - 1;
+}
+
+#if !ENABLE_WINUAE_CPU
+/**
+ * Add screen lines whose memory was written since the previous call
+ * to the lines changed since last frame (all of them if screen moved)
+ */
+static void VDI_MarkWrittenLines(void)
+{
+	static Uint32 nPrevBase = 0xffffffff;
+	static int nPrevSize;
+	int linebytes = (VDIWidth * VDIPlanes) / 8;
+	int y;
+
+	if (VideoBase != nPrevBase || linebytes * VDIHeight != nPrevSize)
+	{
+		nPrevBase = VideoBase;
+		nPrevSize = linebytes * VDIHeight;
+		VDI_MarkDirty(0, VDIHeight);
+	}
+	else
+	{
+		for (y = 0; y < VDIHeight; y++)
+		{
+			if (STMemory_IsDirtyScreen(VideoBase + y * linebytes, linebytes))
+				VDI_MarkDirty(y, 1);
+		}
+	}
+	STMemory_ClearDirtyScreen(VideoBase, nPrevSize);
+}
+#endif
+
+/**
+ * Get the screen lines changed since the previous call, for limiting
+ * the screen conversion to them. Return false if changes aren't tracked,
+ * i.e. whole screen needs to be checked, otherwise true (with
+ * first > last if nothing changed).
+ */
+bool VDI_GetDirtyLines(int *first, int *last)
+{
+#if ENABLE_WINUAE_CPU
+	/* WinUAE CPU core doesn't track writes, only NF_VDI driver changes are known */
+	if (!bVdiAccel)
+		return false;
+#else
+	VDI_MarkWrittenLines();
+#endif
+	if (VDIDirtyFirst < 0)
+	{
+		*first = 0;
+		*last = -1;
+	}
+	else
+	{
+		*first = VDIDirtyFirst;
+		*last = VDIDirtyLast;
+	}
+	VDIDirtyFirst = VDIDirtyLast = -1;
+	return true;
+}
+
+/**
+ * Clip given rectangle to the VDI screen, return false if nothing is left.
+ * Offsets to the clipped left/top edge are added to 'dx' & 'dy' if given.
+ */
+static bool VDI_ClipRect(int *x, int *y, int *w, int *h, int *dx, int *dy)
+{
+	if (*x < 0)
+	{
+		if (dx)
+			*dx -= *x;
+		*w += *x;
+		*x = 0;
+	}
+	if (*y < 0)
+	{
+		if (dy)
+			*dy -= *y;
+		*h += *y;
+		*y = 0;
+	}
+	if (*x + *w > VDIWidth)
+		*w = VDIWidth - *x;
+	if (*y + *h > VDIHeight)
+		*h = VDIHeight - *y;
+	return *w > 0 && *h > 0;
+}
+
+/**
+ * Return host pointer to VDI screen at 'base', or NULL if it's not
+ * fully within ST RAM
+ */
+static Uint8 *VDI_ScreenAddr(Uint32 base)
+{
+	Uint32 size = VDIHeight * ((VDIWidth * VDIPlanes) / 8);
+
+	if (!STMemory_ValidArea(base, size) || base + size > STRamEnd || (base & 1))
+		return NULL;
+	return (Uint8 *)STRAM_ADDR(base);
+}
+
+/**
+ * Set pixels selected by 'mask' in the 16-pixel group at 'p'
+ * (VDIPlanes interleaved words) to given color
+ */
+static inline void VDI_PutGroup(Uint8 *p, Uint16 mask, int color)
+{
+	Uint16 word;
+	int plane;
+
+	for (plane = 0; plane < VDIPlanes; plane++, p += 2)
+	{
+		word = do_get_mem_word(p) & ~mask;
+		if (color & (1 << plane))
+			word |= mask;
+		do_put_mem_word(p, word);
+	}
+}
+
+/**
+ * Return color of pixel x on screen line at 'line'
+ */
+static inline int VDI_GetPixel(Uint8 *line, int x)
+{
+	Uint8 *p = line + (x >> 4) * VDIPlanes * 2;
+	Uint16 bit = 0x8000 >> (x & 15);
+	int plane, color = 0;
+
+	for (plane = 0; plane < VDIPlanes; plane++, p += 2)
+	{
+		if (do_get_mem_word(p) & bit)
+			color |= 1 << plane;
+	}
+	return color;
+}
+
+/**
+ * Fill rectangle x,y,w,h of the VDI screen at 'screen' with given color
+ */
+static void VDI_FillRect(Uint8 *screen, int x, int y, int w, int h, int color)
+{
+	int linebytes = (VDIWidth * VDIPlanes) / 8;
+	int x0, x1, group, last;
+	Uint16 mask;
+	Uint8 *line;
+
+	last = (x + w - 1) >> 4;
+	for (line = screen + y * linebytes; h > 0; h--, line += linebytes)
+	{
+		for (group = x >> 4; group <= last; group++)
+		{
+			x0 = group == (x >> 4) ? (x & 15) : 0;
+			x1 = group == last ? ((x + w - 1) & 15) : 15;
+			mask = (0xffff >> x0) & (0xffff << (15 - x1));
+			VDI_PutGroup(line + group * VDIPlanes * 2, mask, color);
+		}
+	}
+}
+
+/**
+ * Copy rectangle sx,sy,w,h of the VDI screen at 'screen' to dx,dy
+ * (areas may overlap)
+ */
+static void VDI_CopyRect(Uint8 *screen, int sx, int sy, int dx, int dy, int w, int h)
+{
+	int linebytes = (VDIWidth * VDIPlanes) / 8;
+	Uint8 colors[MAX_VDI_WIDTH];
+	Uint8 *src, *dst;
+	int i, step;
+
+	if (dy > sy)
+	{
+		/* copy from the bottom up, so overlapping lines aren't overwritten */
+		sy += h - 1;
+		dy += h - 1;
+		step = -linebytes;
+	}
+	else
+		step = linebytes;
+
+	src = screen + sy * linebytes;
+	dst = screen + dy * linebytes;
+	for (; h > 0; h--, src += step, dst += step)
+	{
+		/* read whole line first, for overlap on the same line */
+		for (i = 0; i < w; i++)
+			colors[i] = VDI_GetPixel(src, sx + i);
+		for (i = 0; i < w; i++)
+			VDI_PutGroup(dst + ((dx + i) >> 4) * VDIPlanes * 2,
+			             0x8000 >> ((dx + i) & 15), colors[i]);
+	}
+}
+
+/**
+ * Expand monochrome bitmap 'bits' (e.g. font data), 'pitch' bytes per line,
+ * starting from bit 'bx', to rectangle x,y,w,h of the VDI screen at 'screen'.
+ * Set bits are drawn with 'fg' color, cleared ones with 'bg' color unless
+ * it's negative (transparent).
+ */
+static void VDI_ExpandRect(Uint8 *screen, const Uint8 *bits, int pitch, int bx,
+                           int x, int y, int w, int h, int fg, int bg)
+{
+	int linebytes = (VDIWidth * VDIPlanes) / 8;
+	Uint8 *line;
+	int i, b;
+
+	for (line = screen + y * linebytes; h > 0; h--, line += linebytes, bits += pitch)
+	{
+		for (i = 0; i < w; i++)
+		{
+			b = bx + i;
+			if (bits[b >> 3] & (0x80 >> (b & 7)))
+				VDI_PutGroup(line + ((x + i) >> 4) * VDIPlanes * 2,
+				             0x8000 >> ((x + i) & 15), fg);
+			else if (bg >= 0)
+				VDI_PutGroup(line + ((x + i) >> 4) * VDIPlanes * 2,
+				             0x8000 >> ((x + i) & 15), bg);
+		}
+	}
+}
+
+/**
+ * Native Feature for drawing to extended VDI resolution screen from
+ * a VDI driver, instead of doing that with emulated 68k code.
+ * Subid tells the operation, stack arguments (longs) are:
+ * - NF_VDI_INIT: -
+ *   Returns 1 (and enables tracking of changed screen lines from
+ *   following calls) if extended VDI resolution is in use, otherwise 0
+ * - NF_VDI_FILL: screen address, x, y, w, h, color
+ * - NF_VDI_COPY: screen address, source x, source y, x, y, w, h
+ * - NF_VDI_EXPAND: screen address, bitmap address, bitmap line bytes,
+ *   bitmap start x, x, y, w, h, color, background color (-1 = transparent)
+ * - NF_VDI_DIRTY: x, y, w, h of screen area drawn by 68k code
+ *   (e.g. mouse cursor), to get it converted to host screen
+ * Other operations return 1 on success, 0 if they were not done.
+ * Only drawing to the shown screen is tracked for changed lines.
+ */
+bool VDI_NatFeat(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 args[10];
+	int x, y, w, h, sx, sy, bx, pitch, i;
+	Uint8 *screen;
+	Uint32 bits;
+
+	*retval = 0;
+	if (!bUseVDIRes)
+		return true;
+
+	if (subid == NF_VDI_INIT)
+	{
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI_INIT()\n");
+		bVdiAccel = true;
+		VDI_MarkDirty(0, VDIHeight);
+		*retval = 1;
+		return true;
+	}
+	if (!STMemory_ValidArea(stack, sizeof(args)))
+	{
+		M68000_BusError(stack, BUS_ERROR_READ);
+		return false;
+	}
+	for (i = 0; i < ARRAYSIZE(args); i++)
+		args[i] = STMemory_ReadLong(stack + i * SIZE_LONG);
+
+	switch (subid)
+	{
+	 case NF_VDI_FILL:
+		x = args[1]; y = args[2]; w = args[3]; h = args[4];
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI_FILL(0x%x, %d,%d %dx%d, %d)\n",
+			  args[0], x, y, w, h, args[5]);
+		screen = VDI_ScreenAddr(args[0]);
+		if (!screen || !VDI_ClipRect(&x, &y, &w, &h, NULL, NULL))
+			return true;
+		VDI_FillRect(screen, x, y, w, h, args[5]);
+		break;
+
+	 case NF_VDI_COPY:
+		sx = args[1]; sy = args[2]; x = args[3]; y = args[4]; w = args[5]; h = args[6];
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI_COPY(0x%x, %d,%d -> %d,%d %dx%d)\n",
+			  args[0], sx, sy, x, y, w, h);
+		screen = VDI_ScreenAddr(args[0]);
+		if (!screen || !VDI_ClipRect(&sx, &sy, &w, &h, &x, &y)
+		    || !VDI_ClipRect(&x, &y, &w, &h, &sx, &sy))
+			return true;
+		VDI_CopyRect(screen, sx, sy, x, y, w, h);
+		break;
+
+	 case NF_VDI_EXPAND:
+		bits = args[1]; pitch = args[2]; bx = args[3];
+		x = args[4]; y = args[5]; w = args[6]; h = args[7];
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI_EXPAND(0x%x, 0x%x/%d+%d, %d,%d %dx%d, %d/%d)\n",
+			  args[0], bits, pitch, bx, x, y, w, h, args[8], args[9]);
+		screen = VDI_ScreenAddr(args[0]);
+		sy = 0;
+		if (!screen || pitch <= 0 || bx < 0
+		    || !VDI_ClipRect(&x, &y, &w, &h, &bx, &sy) || pitch * 8 < bx + w)
+			return true;
+		bits += sy * pitch;
+		if (!STMemory_ValidArea(bits, h * pitch))
+		{
+			M68000_BusError(bits, BUS_ERROR_READ);
+			return false;
+		}
+		VDI_ExpandRect(screen, (const Uint8 *)STRAM_ADDR(bits), pitch, bx, x, y, w, h,
+		               args[8], (Sint32)args[9]);
+		break;
+
+	 case NF_VDI_DIRTY:
+		x = args[0]; y = args[1]; w = args[2]; h = args[3];
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI_DIRTY(%d,%d %dx%d)\n", x, y, w, h);
+		if (VDI_ClipRect(&x, &y, &w, &h, NULL, NULL))
+			VDI_MarkDirty(y, h);
+		*retval = 1;
+		return true;
+
+	 default:
+		LOG_TRACE(TRACE_NATFEATS, "NF_VDI: unknown subid %d\n", subid);
+		return true;
+	}
+
+	/* drawing done directly to ST RAM, so mark it for snapshots */
+	STMemory_SetDirtyArea(args[0] + y * ((VDIWidth * VDIPlanes) / 8),
+	                      h * ((VDIWidth * VDIPlanes) / 8));
+	if (args[0] == VideoBase)
+		VDI_MarkDirty(y, h);
+	*retval = 1;
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save desktop configuration file for VDI, eg desktop.inf(TOS 1.04) or newdesk.inf(TOS 2.06)
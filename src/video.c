@@ -354,6 +354,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "configuration.h"
 #include "cycles.h"
 #include "fdc.h"
+#include "gemdos.h"
 #include "cycInt.h"
 #include "ioMem.h"
 #include "keymap.h"
@@ -362,6 +363,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "memorySnapShot.h"
 #include "mfp.h"
 #include "printer.h"
+#include "rs232.h"
 #include "screen.h"
 #include "screenSnapShot.h"
 #include "shortcut.h"
@@ -369,6 +371,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "dmaSnd.h"
 #include "spec512.h"
 #include "stMemory.h"
+#include "timeline.h"
 #include "vdi.h"
 #include "video.h"
 #include "ymFormat.h"
@@ -377,6 +380,23 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "avi_record.h"
 #include "ikbd.h"
 #include "floppy_ipf.h"
+#include "perfcount.h"
+#include "metrics.h"
+#include "utils.h"
+
+#ifdef __LIBRETRO__
+extern int hatari_input_scanline;
+extern void update_input_late(void);
+#endif
+
+/* SSE2 and NEON are always available on x86-64 and AArch64 */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN && defined(__SSE2__)
+#include <emmintrin.h>
+#define VIDEO_SHIFT_SSE2 1
+#elif SDL_BYTEORDER == SDL_LIL_ENDIAN && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VIDEO_SHIFT_NEON 1
+#endif
 
 
 /* The border's mask allows to keep track of all the border tricks		*/
@@ -405,6 +425,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 int STRes = ST_LOW_RES;                         /* current ST resolution */
 int TTRes;                                      /* TT shifter resolution mode */
 int nFrameSkips;                                /* speed up by skipping video frames */
+bool bSkipNextFrame;                            /* front end asks to skip drawing of next frame */
 
 bool bUseHighRes;                               /* Use hi-res (ie Mono monitor) */
 int OverscanMode;                               /* OVERSCANMODE_xxxx for current display frame */
@@ -421,6 +442,8 @@ int nStartHBL;                                  /* Start HBL for visible screen
 int nEndHBL;                                    /* End HBL for visible screen */
 int nScanlinesPerFrame = 313;                   /* Number of scan lines per frame */
 int nCyclesPerLine = 512;                       /* Cycles per horizontal line scan */
+int VideoLineStartCycle;			/* ShifterLines[nHBL].StartCycle */
+int VideoPrevLineStartCycle;			/* ShifterLines[nHBL-1].StartCycle */
 static int nFirstVisibleHbl = FIRST_VISIBLE_HBL_50HZ;			/* The first line of the ST screen that is copied to the PC screen buffer */
 static int nLastVisibleHbl = FIRST_VISIBLE_HBL_50HZ+NUM_VISIBLE_LINES;	/* The last line of the ST screen that is copied to the PC screen buffer */
 static int CyclesPerVBL = 313*512;		/* Number of cycles per VBL */
@@ -437,6 +460,7 @@ static Uint8 *pVideoRaster;			/* Pointer to Video raster, after VideoBase in PC
 static bool bSteBorderFlag;			/* true when screen width has been switched to 336 (e.g. in Obsession) */
 static int NewSteBorderFlag = -1;		/* New value for next line */
 static bool bTTColorsSync, bTTColorsSTSync;	/* whether TT colors need conversion to SDL */
+static Uint32 TTColorsChanged[256/32];		/* TT palette entries needing conversion to SDL */
 
 bool bTTSampleHold = false;				/* TT special video mode */
 static bool bTTHypermono = false;		/* TT special video mode */
@@ -454,6 +478,13 @@ static int VblVideoCycleOffset = VBL_VIDEO_CYCLE_OFFSET_STF;
 
 int	LineTimerBCycle = LINE_END_CYCLE_50 + TIMERB_VIDEO_CYCLE_OFFSET;	/* position of the Timer B interrupt on active lines */
 int	TimerBEventCountCycleStart = -1;	/* value of Cycles_GetCounterOnWriteAccess last time timer B was started for the current VBL */
+static int TimerBEventLine = -1;	/* line with an EndLine interrupt, where timer B's event count expires */
+static int TimerBCountedLine = -1;	/* last line whose timer B event was counted for the current VBL */
+
+static int HblBatchLastLine = -1;	/* line whose HBL interrupt also handles the previous lines, -1 if none */
+static bool bHblBatchBroken;		/* a batch was synced before its end, don't batch again until next VBL */
+static int HblBatchFirstBank;		/* ST RAM banks read by the batched lines, watched for writes */
+static int HblBatchNbBanks;
 
 int HblJitterIndex = 0;
 const int HblJitterArray[] = {
@@ -518,7 +549,50 @@ typedef struct
 } SHIFTER_FRAME;
 
 
-SHIFTER_FRAME	ShifterFrame;
+SHIFTER_FRAME	ShifterFrame CACHE_ALIGNED;
+
+
+/* Results of the border checks for res/freq switches on the current and previous line */
+#define SHIFTER_MEMO_RES	0
+#define SHIFTER_MEMO_SYNC	1
+#define SHIFTER_MEMO_WRITES	16		/* switches remembered per line */
+#define SHIFTER_MEMO_KEYS	24
+
+typedef struct
+{
+	int	Key[ SHIFTER_MEMO_KEYS ];	/* switch and the state the checks depend on */
+	int	Line[ 2 ][ 4 ];			/* resulting state of the switch line and the next one */
+	int	BlankLines;			/* BlankLines increment */
+} SHIFTER_MEMO;
+
+static struct
+{
+	int	VBL, HBL;			/* line being recorded */
+	int	Cur;				/* Lines[] index for that line */
+	int	nWrites, nPrevWrites;		/* switches on current/previous line */
+	SHIFTER_MEMO	Lines[ 2 ][ SHIFTER_MEMO_WRITES ];
+} ShifterMemo;
+
+
+#define VIDEO_LINE_MAXBYTES	256		/* max number of bytes read by the shifter for one line, incl. scrolling */
+
+typedef struct
+{
+	Uint8	*pScreen;			/* destination of this line in the screen buffer */
+	bool	bBlank;				/* line is in the top/bottom border */
+	Uint32	BorderMask;			/* borders' states for this line */
+	int	PixelScroll;			/* STF pixel shift for this line */
+	int	VideoOffset;			/* bytes offset for overscan lines */
+	int	LineRes;			/* 0=low res  1=med res */
+	bool	bSteBorder;			/* STE 336 pixels line */
+	int	HWScrollCount;			/* STE hardware scrolling */
+	int	HWScrollPrefetch;
+	int	RasterOffset;			/* position of the video counter at the start of the line in VideoLinesData[] */
+} VIDEO_LINE;
+
+static VIDEO_LINE	VideoLines[ NUM_VISIBLE_LINES ];			/* lines to convert on next Video_ConvertScreenLines */
+static Uint8		VideoLinesData[ NUM_VISIBLE_LINES ][ VIDEO_LINE_MAXBYTES ];	/* bytes read by the shifter for each line */
+static int		nVideoLines;
 
 
 
@@ -530,11 +604,18 @@ static void	Video_SetSystemTimings ( void );
 
 static Uint32	Video_CalculateAddress ( void );
 static int	Video_GetMMUStartCycle ( int DisplayStartCycle );
+static void	Video_SetLineStartCycles ( void );
 static void	Video_WriteToShifter ( Uint8 Res );
 static void 	Video_Sync_SetDefaultStartEnd ( Uint8 Freq , int HblCounterVideo , int LineCycles );
+static void	Video_Shifter_CheckBorders ( int Type , Uint8 Value , int FrameCycles , int HblCounterVideo , int LineCycles );
 
 static int	Video_HBL_GetPos ( void );
 static int	Video_TimerB_GetDefaultPos ( void );
+static void	Video_TimerB_CountLine ( int nLine , int EventCycles , int Delayed_Cycles );
+static void	Video_TimerB_Arm ( void );
+static void	Video_HBL_Line ( int FrameCycles , int PendingCyclesOver , bool bBatched );
+static void	Video_HBL_StartBatch ( void );
+static void	Video_HBL_StopBatch ( void );
 static void	Video_EndHBL ( void );
 static void	Video_StartHBL ( void );
 
@@ -542,10 +623,13 @@ static void	Video_StoreFirstLinePalette(void);
 static void	Video_StoreResolution(int y);
 static void	Video_CopyScreenLineMono(void);
 static void	Video_CopyScreenLineColor(void);
+static void	Video_ConvertScreenLines(void);
 static void	Video_CopyVDIScreen(void);
 static void	Video_SetHBLPaletteMaskPointers(void);
 
+static void	Video_SetTTColorsChanged(int first, int last);
 static void	Video_UpdateTTPalette(int bpp);
+static bool	Video_FrameIsSkipped(void);
 static void	Video_DrawScreen(void);
 
 static void	Video_ResetShifterTimings(void);
@@ -570,6 +654,8 @@ void Video_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&bUseHighRes, sizeof(bUseHighRes));
 	MemorySnapShot_Store(&nVBLs, sizeof(nVBLs));
 	MemorySnapShot_Store(&nHBL, sizeof(nHBL));
+	MemorySnapShot_Store(&TimerBEventLine, sizeof(TimerBEventLine));
+	MemorySnapShot_Store(&TimerBCountedLine, sizeof(TimerBCountedLine));
 	MemorySnapShot_Store(&nStartHBL, sizeof(nStartHBL));
 	MemorySnapShot_Store(&nEndHBL, sizeof(nEndHBL));
 	MemorySnapShot_Store(&OverscanMode, sizeof(OverscanMode));
@@ -589,6 +675,13 @@ void Video_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&bTTSampleHold, sizeof(bTTSampleHold));
 	MemorySnapShot_Store(&bTTHypermono, sizeof(bTTHypermono));
 	MemorySnapShot_Store(&TTSpecialVideoMode, sizeof(TTSpecialVideoMode));
+
+	if (!bSave)
+	{
+		Video_HBL_StopBatch();		/* restored HBL interrupt is for the current line */
+		Video_SetLineStartCycles();
+		Video_SetTTColorsChanged(0, 255);
+	}
 }
 
 
@@ -601,6 +694,9 @@ void Video_Reset(void)
 	/* NOTE! Must reset all of these register type things here!!!! */
 	Video_Reset_Glue();
 
+	/* Forget the lines of a batched HBL */
+	Video_HBL_StopBatch();
+
 	/* Set system specific timings */
 	Video_SetSystemTimings();
 
@@ -694,73 +790,18 @@ static void	Video_SetSystemTimings(void)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Convert the elapsed number of cycles since the start of the VBL
- * into the corresponding HBL number and the cycle position in the current
- * HBL. We use the starting cycle position of the closest HBL to compute
- * the cycle position on the line (this allows to mix lines with different
- * values for nCyclesPerLine).
- * We can have 2 cases on the limit where the real video line count can be
- * different from nHBL :
- * - when reading video address between cycle 0 and 12, LineCycle will be <0,
- *   so we need to use the data from line nHBL-1
- * - if LineCycle >= nCyclesPerLine, this means the HBL int was not processed
- *   yet, so the video line number is in fact nHBL+1
+ * Update the start cycles of the current and previous lines used by
+ * Video_ConvertPosition(), each time nHBL or these lines' StartCycle
+ * change. This way IO handlers polling the video position get it
+ * with just a subtraction and compares.
  */
-
-void	Video_ConvertPosition ( int FrameCycles , int *pHBL , int *pLineCycles )
-{
-	if ( 0 && FrameCycles >= CyclesPerVBL )				/* rare case between end of last hbl and start of next VBL (during 64 cycles) */
-	{
-		*pHBL = ( FrameCycles - CyclesPerVBL ) / nCyclesPerLine;
-		*pLineCycles = ( FrameCycles - CyclesPerVBL ) % nCyclesPerLine;
-	//fprintf ( stderr , "out of vbl FrameCycles %d CyclesPerVBL %d nHBL=%d %d %d\n" , FrameCycles , CyclesPerVBL, nHBL , *pHBL , *pLineCycles );
-	}
-
-	else								/* most common case */
-	{
-		*pHBL = nHBL;
-		*pLineCycles = FrameCycles - ShifterFrame.ShifterLines[ nHBL ].StartCycle;
-
-		if ( *pLineCycles < 0 )					/* reading from the previous video line */
-		{
-			*pHBL = nHBL-1;
-			*pLineCycles = FrameCycles - ShifterFrame.ShifterLines[ nHBL-1 ].StartCycle;
-		}
-	
-		else if ( *pLineCycles >= nCyclesPerLine )		/* reading on the next line, but HBL int was delayed */
-		{
-			*pHBL = nHBL+1;
-			*pLineCycles -= nCyclesPerLine;
-		}
-	}
-
-if ( *pLineCycles < 0 )
-	fprintf ( stderr , "bug nHBL=%d %d %d\n" , nHBL , *pHBL , *pLineCycles );
-
-//if ( ( *pHBL != FrameCycles / nCyclesPerLine ) || ( *pLineCycles != FrameCycles % nCyclesPerLine ) )
-//  LOG_TRACE ( TRACE_VIDEO_ADDR , "conv pos %d %d - %d %d\n" , *pHBL , FrameCycles / nCyclesPerLine , *pLineCycles , FrameCycles % nCyclesPerLine );
-//  LOG_TRACE ( TRACE_VIDEO_ADDR , "conv pos %d %d %d\n" , FrameCycles , *pHBL , *pLineCycles );
-}
-
-
-void	Video_GetPosition ( int *pFrameCycles , int *pHBL , int *pLineCycles )
+static void	Video_SetLineStartCycles ( void )
 {
-	*pFrameCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
-	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
-}
-
-
-void	Video_GetPosition_OnWriteAccess ( int *pFrameCycles , int *pHBL , int *pLineCycles )
-{
-	*pFrameCycles = Cycles_GetCounterOnWriteAccess(CYCLES_COUNTER_VIDEO);
-	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
-}
-
-
-void	Video_GetPosition_OnReadAccess ( int *pFrameCycles , int *pHBL , int *pLineCycles )
-{
-	*pFrameCycles = Cycles_GetCounterOnReadAccess(CYCLES_COUNTER_VIDEO);
-	Video_ConvertPosition ( *pFrameCycles , pHBL , pLineCycles );
+	VideoLineStartCycle = ShifterFrame.ShifterLines[ nHBL ].StartCycle;
+	if ( nHBL > 0 )
+		VideoPrevLineStartCycle = ShifterFrame.ShifterLines[ nHBL-1 ].StartCycle;
+	else
+		VideoPrevLineStartCycle = VideoLineStartCycle;
 }
 
 
@@ -975,6 +1016,99 @@ static void Video_WriteToShifter ( Uint8 Res )
 		return;						/* do nothing */
 
 
+	/* Switches while the screen is displayed need the exact CPU timings */
+	if ( HblCounterVideo >= nStartHBL && HblCounterVideo < nEndHBL )
+		M68000_TurboTimingAccess();
+
+	/* Check for border changes made by this resolution switch */
+	Video_Shifter_CheckBorders ( SHIFTER_MEMO_RES , Res , FrameCycles , HblCounterVideo , LineCycles );
+
+
+	/* Update HBL's position only if display has not reached pos LINE_START_CYCLE_50 */
+	/* and HBL interrupt was already handled at the beginning of this line. */
+	/* This also changes the number of cycles per line. */
+	if ( ( LineCycles <= LINE_START_CYCLE_50 ) && ( HblCounterVideo == nHBL ) )
+	{
+		nCyclesPerLine = Video_HBL_GetPos();
+		Video_AddInterruptHBL ( nCyclesPerLine );
+	}
+
+
+	/* Update Timer B's position */
+	LineTimerBCycle = Video_TimerB_GetPos ( HblCounterVideo );
+	Video_AddInterruptTimerB ( LineTimerBCycle );
+
+
+	ShifterFrame.Res = Res;
+	if ( Res == 0x02 )						/* high res */
+	{
+		ShifterFrame.ResPosHi.VBL = nVBLs;
+		ShifterFrame.ResPosHi.FrameCycles = FrameCycles;
+		ShifterFrame.ResPosHi.HBL = HblCounterVideo;
+		ShifterFrame.ResPosHi.LineCycles = LineCycles;
+	}
+	else if ( Res == 0x01 )						/* med res */
+	{
+		ShifterFrame.ResPosMed.VBL = nVBLs;
+		ShifterFrame.ResPosMed.FrameCycles = FrameCycles;
+		ShifterFrame.ResPosMed.HBL = HblCounterVideo;
+		ShifterFrame.ResPosMed.LineCycles = LineCycles;
+	}
+	else								/* low res */
+	{
+		ShifterFrame.ResPosLo.VBL = nVBLs;
+		ShifterFrame.ResPosLo.FrameCycles = FrameCycles;
+		ShifterFrame.ResPosLo.HBL = HblCounterVideo;
+		ShifterFrame.ResPosLo.LineCycles = LineCycles;
+	}
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set some default values for DisplayStartCycle/DisplayEndCycle
+ * when changing frequency in lo/med res (testing orders are important
+ * because the line can already have some borders changed).
+ * This is necessary as some freq changes can modify start/end
+ * even if they're not made at the exact borders' positions.
+ * These values will be modified later if some borders are changed.
+ */
+static void	Video_Sync_SetDefaultStartEnd ( Uint8 Freq , int HblCounterVideo , int LineCycles )
+{
+	if ( Freq == 0x02 )					/* switch to 50 Hz */
+	{
+		if ( ( LineCycles <= ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle )	/* start could be 0,52,56 */
+		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle == LINE_START_CYCLE_60 ) )
+			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle = LINE_START_CYCLE_50;
+
+		if ( ( LineCycles <= ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle )	/* end could be 160,372,376,460 */
+		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle < LINE_END_CYCLE_50 ) )
+			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle = LINE_END_CYCLE_50;
+	}
+
+	else							/* switch to 60 Hz */
+	{
+		if ( LineCycles < ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle )	/* start could be 0,52,56 */
+			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle = LINE_START_CYCLE_60;
+
+		if ( ( LineCycles < ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle )	/* end could be 160,372,376,460 */
+		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle <= LINE_END_CYCLE_50 ) )
+			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle = LINE_END_CYCLE_60;
+	}
+
+//fprintf ( stderr , "sync default pos %d %d %d\n", HblCounterVideo , ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle , ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check for border removal and other line changes made by a resolution
+ * switch to 'Res' at the given position (Video_WriteToShifter()).
+ * This only updates ShifterLines[] and BlankLines, see Video_Shifter_CheckBorders().
+ */
+static void Video_Res_CheckBorders ( Uint8 Res , int FrameCycles , int HblCounterVideo , int LineCycles )
+{
 	if ( Res == 0x02 )					/* switch to high res */
 	{
 		if ( LineCycles < ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle )	/* start could be 0,52,56 */
@@ -1201,116 +1335,17 @@ static void Video_WriteToShifter ( Uint8 Res )
 		}
 	}
 #endif
-
-
-	/* Update HBL's position only if display has not reached pos LINE_START_CYCLE_50 */
-	/* and HBL interrupt was already handled at the beginning of this line. */
-	/* This also changes the number of cycles per line. */
-	if ( ( LineCycles <= LINE_START_CYCLE_50 ) && ( HblCounterVideo == nHBL ) )
-	{
-		nCyclesPerLine = Video_HBL_GetPos();
-		Video_AddInterruptHBL ( nCyclesPerLine );
-	}
-
-
-	/* Update Timer B's position */
-	LineTimerBCycle = Video_TimerB_GetPos ( HblCounterVideo );
-	Video_AddInterruptTimerB ( LineTimerBCycle );
-
-
-	ShifterFrame.Res = Res;
-	if ( Res == 0x02 )						/* high res */
-	{
-		ShifterFrame.ResPosHi.VBL = nVBLs;
-		ShifterFrame.ResPosHi.FrameCycles = FrameCycles;
-		ShifterFrame.ResPosHi.HBL = HblCounterVideo;
-		ShifterFrame.ResPosHi.LineCycles = LineCycles;
-	}
-	else if ( Res == 0x01 )						/* med res */
-	{
-		ShifterFrame.ResPosMed.VBL = nVBLs;
-		ShifterFrame.ResPosMed.FrameCycles = FrameCycles;
-		ShifterFrame.ResPosMed.HBL = HblCounterVideo;
-		ShifterFrame.ResPosMed.LineCycles = LineCycles;
-	}
-	else								/* low res */
-	{
-		ShifterFrame.ResPosLo.VBL = nVBLs;
-		ShifterFrame.ResPosLo.FrameCycles = FrameCycles;
-		ShifterFrame.ResPosLo.HBL = HblCounterVideo;
-		ShifterFrame.ResPosLo.LineCycles = LineCycles;
-	}
 }
 
 
-
 /*-----------------------------------------------------------------------*/
 /**
- * Set some default values for DisplayStartCycle/DisplayEndCycle
- * when changing frequency in lo/med res (testing orders are important
- * because the line can already have some borders changed).
- * This is necessary as some freq changes can modify start/end
- * even if they're not made at the exact borders' positions.
- * These values will be modified later if some borders are changed.
+ * Check for border removal and other line changes made by a frequency
+ * switch to 'Freq' at the given position (Video_Sync_WriteByte()).
+ * This only updates ShifterLines[], see Video_Shifter_CheckBorders().
  */
-static void	Video_Sync_SetDefaultStartEnd ( Uint8 Freq , int HblCounterVideo , int LineCycles )
+static void Video_Sync_CheckBorders ( Uint8 Freq , int FrameCycles , int HblCounterVideo , int LineCycles )
 {
-	if ( Freq == 0x02 )					/* switch to 50 Hz */
-	{
-		if ( ( LineCycles <= ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle )	/* start could be 0,52,56 */
-		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle == LINE_START_CYCLE_60 ) )
-			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle = LINE_START_CYCLE_50;
-
-		if ( ( LineCycles <= ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle )	/* end could be 160,372,376,460 */
-		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle < LINE_END_CYCLE_50 ) )
-			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle = LINE_END_CYCLE_50;
-	}
-
-	else							/* switch to 60 Hz */
-	{
-		if ( LineCycles < ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle )	/* start could be 0,52,56 */
-			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle = LINE_START_CYCLE_60;
-
-		if ( ( LineCycles < ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle )	/* end could be 160,372,376,460 */
-		  && ( ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle <= LINE_END_CYCLE_50 ) )
-			ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle = LINE_END_CYCLE_60;
-	}
-
-//fprintf ( stderr , "sync default pos %d %d %d\n", HblCounterVideo , ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle , ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle );
-}
-
-
-/*-----------------------------------------------------------------------*/
-/**
- * Write to VideoSync (0xff820a), Hz setting
- */
-void Video_Sync_WriteByte ( void )
-{
-	int FrameCycles, HblCounterVideo, LineCycles;
-	Uint8 Freq;
-
-
-	if ( bUseVDIRes )
-		return;						/* no 50/60 Hz freq in VDI mode */
-
-
-	/* We're only interested in bit 1 (50/60Hz) */
-	Freq = IoMem[0xff820a] & 2;
-
-	Video_GetPosition_OnWriteAccess ( &FrameCycles , &HblCounterVideo , &LineCycles );
-
-	LOG_TRACE(TRACE_VIDEO_SYNC ,"sync=0x%2.2X video_cyc_w=%d line_cyc_w=%d @ nHBL=%d/video_hbl_w=%d pc=%x instr_cyc=%d\n",
-	               Freq, FrameCycles, LineCycles, nHBL, HblCounterVideo, M68000_GetPC(), CurrentInstrCycles );
-
-	/* Ignore consecutive writes of the same value */
-	if ( Freq == ShifterFrame.Freq )
-		return;						/* do nothing */
-
-	/* Ignore freq changes if we are in high res */
-	/* 2009/04/26 : don't ignore for now (see ST Cnx in Punish Your Machine) */
-//	if ( ShifterFrame.Res == 0x02 )
-//		return;						/* do nothing */
-
 	/* Set some default values for DisplayStartCycle/DisplayEndCycle before checking for border removal */
 	Video_Sync_SetDefaultStartEnd ( Freq , HblCounterVideo , LineCycles );
 
@@ -1422,6 +1457,159 @@ void Video_Sync_WriteByte ( void )
 				ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayStartCycle , ShifterFrame.ShifterLines[ HblCounterVideo ].DisplayEndCycle );
 		}
 	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store the line state used and changed by the border checks
+ */
+static inline void Video_Shifter_GetLine ( int *pState , int HblCounter )
+{
+	pState[0] = ShifterFrame.ShifterLines[ HblCounter ].BorderMask;
+	pState[1] = ShifterFrame.ShifterLines[ HblCounter ].DisplayPixelShift;
+	pState[2] = ShifterFrame.ShifterLines[ HblCounter ].DisplayStartCycle;
+	pState[3] = ShifterFrame.ShifterLines[ HblCounter ].DisplayEndCycle;
+}
+
+static inline void Video_Shifter_SetLine ( const int *pState , int HblCounter )
+{
+	ShifterFrame.ShifterLines[ HblCounter ].BorderMask = pState[0];
+	ShifterFrame.ShifterLines[ HblCounter ].DisplayPixelShift = pState[1];
+	ShifterFrame.ShifterLines[ HblCounter ].DisplayStartCycle = pState[2];
+	ShifterFrame.ShifterLines[ HblCounter ].DisplayEndCycle = pState[3];
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check for border changes made by a res/freq switch, reusing the result
+ * of the previous line when the switch is the same as the one at the same
+ * index in the previous line, with the same state for everything the
+ * checks depend on. Fullscreen code repeats the same switches on each line
+ * and each frame, so this avoids most of the border analysis for them.
+ * Memo is bypassed when border changes are traced, so that they're all shown.
+ */
+static void Video_Shifter_CheckBorders ( int Type , Uint8 Value , int FrameCycles , int HblCounterVideo , int LineCycles )
+{
+	SHIFTER_MEMO	*pMemo , *pPrev;
+	SHIFTER_POS	*pPos;
+	int		Key[ SHIFTER_MEMO_KEYS ];
+	int		Blank;
+
+	if ( LOG_TRACE_LEVEL ( TRACE_VIDEO_BORDER_H ) )
+	{
+		if ( Type == SHIFTER_MEMO_RES )
+			Video_Res_CheckBorders ( Value , FrameCycles , HblCounterVideo , LineCycles );
+		else
+			Video_Sync_CheckBorders ( Value , FrameCycles , HblCounterVideo , LineCycles );
+		return;
+	}
+
+	/* Start recording the switches of a new line, previous one is matched against */
+	if ( HblCounterVideo != ShifterMemo.HBL || nVBLs != ShifterMemo.VBL )
+	{
+		ShifterMemo.Cur ^= 1;
+		ShifterMemo.nPrevWrites = ShifterMemo.nWrites;
+		ShifterMemo.nWrites = 0;
+		ShifterMemo.HBL = HblCounterVideo;
+		ShifterMemo.VBL = nVBLs;
+	}
+
+	/* Everything the checks read, except the lines' state */
+	pPos = ( Type == SHIFTER_MEMO_RES ) ? &ShifterFrame.ResPosHi : &ShifterFrame.FreqPos60;
+	Key[0] = Type;
+	Key[1] = Value;
+	Key[2] = ( Type == SHIFTER_MEMO_RES ) ? ShifterFrame.Res : ShifterFrame.Freq;
+	Key[3] = LineCycles;
+	Key[4] = FrameCycles - pPos->FrameCycles;	/* only compared to small values */
+	if ( Key[4] < 0 )
+		Key[4] = -1;
+	else if ( Key[4] > 33 )
+		Key[4] = 33;
+	Key[5] = pPos->LineCycles;
+	Key[6] = ( pPos->HBL == HblCounterVideo );
+	Key[7] = IoMem[0xff820a] & 2;
+	Key[8] = ConfigureParams.System.nMachineType;
+	Key[9] = ( HblCounterVideo >= nStartHBL ) && ( HblCounterVideo < nEndHBL + BlankLines );
+	Key[10] = nHBL - HblCounterVideo;
+	/* 'Panic' hack in Video_Sync_CheckBorders() */
+	Key[11] = ( Type == SHIFTER_MEMO_SYNC ) && ( HblCounterVideo == 34 ) && ( LineCycles == 56 )
+		&& ( STMemory_ReadLong ( M68000_GetPC() ) == 0x4e7352b8 )
+		&& ( STMemory_ReadLong ( M68000_GetPC()+4 ) == 0x04664e73 );
+	Video_Shifter_GetLine ( &Key[12] , HblCounterVideo );
+	Video_Shifter_GetLine ( &Key[16] , HblCounterVideo+1 );
+	Video_Shifter_GetLine ( &Key[20] , nHBL );
+
+	/* Same switch as in previous line? */
+	if ( ShifterMemo.nWrites < ShifterMemo.nPrevWrites )
+	{
+		pPrev = &ShifterMemo.Lines[ ShifterMemo.Cur ^ 1 ][ ShifterMemo.nWrites ];
+		if ( memcmp ( pPrev->Key , Key , sizeof ( Key ) ) == 0 )
+		{
+			Video_Shifter_SetLine ( pPrev->Line[0] , HblCounterVideo );
+			Video_Shifter_SetLine ( pPrev->Line[1] , HblCounterVideo+1 );
+			BlankLines += pPrev->BlankLines;
+			if ( ShifterMemo.nWrites < SHIFTER_MEMO_WRITES )
+				ShifterMemo.Lines[ ShifterMemo.Cur ][ ShifterMemo.nWrites++ ] = *pPrev;
+			return;
+		}
+	}
+
+	Blank = BlankLines;
+	if ( Type == SHIFTER_MEMO_RES )
+		Video_Res_CheckBorders ( Value , FrameCycles , HblCounterVideo , LineCycles );
+	else
+		Video_Sync_CheckBorders ( Value , FrameCycles , HblCounterVideo , LineCycles );
+
+	if ( ShifterMemo.nWrites < SHIFTER_MEMO_WRITES )
+	{
+		pMemo = &ShifterMemo.Lines[ ShifterMemo.Cur ][ ShifterMemo.nWrites++ ];
+		memcpy ( pMemo->Key , Key , sizeof ( Key ) );
+		Video_Shifter_GetLine ( pMemo->Line[0] , HblCounterVideo );
+		Video_Shifter_GetLine ( pMemo->Line[1] , HblCounterVideo+1 );
+		pMemo->BlankLines = BlankLines - Blank;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write to VideoSync (0xff820a), Hz setting
+ */
+void Video_Sync_WriteByte ( void )
+{
+	int FrameCycles, HblCounterVideo, LineCycles;
+	Uint8 Freq;
+
+
+	if ( bUseVDIRes )
+		return;						/* no 50/60 Hz freq in VDI mode */
+
+
+	/* We're only interested in bit 1 (50/60Hz) */
+	Freq = IoMem[0xff820a] & 2;
+
+	Video_GetPosition_OnWriteAccess ( &FrameCycles , &HblCounterVideo , &LineCycles );
+
+	LOG_TRACE(TRACE_VIDEO_SYNC ,"sync=0x%2.2X video_cyc_w=%d line_cyc_w=%d @ nHBL=%d/video_hbl_w=%d pc=%x instr_cyc=%d\n",
+	               Freq, FrameCycles, LineCycles, nHBL, HblCounterVideo, M68000_GetPC(), CurrentInstrCycles );
+
+	/* Ignore consecutive writes of the same value */
+	if ( Freq == ShifterFrame.Freq )
+		return;						/* do nothing */
+
+	/* Ignore freq changes if we are in high res */
+	/* 2009/04/26 : don't ignore for now (see ST Cnx in Punish Your Machine) */
+//	if ( ShifterFrame.Res == 0x02 )
+//		return;						/* do nothing */
+
+	/* Switches while the screen is displayed need the exact CPU timings */
+	if ( HblCounterVideo >= nStartHBL && HblCounterVideo < nEndHBL )
+		M68000_TurboTimingAccess();
+
+	/* Check for border changes made by this frequency switch */
+	Video_Shifter_CheckBorders ( SHIFTER_MEMO_SYNC , Freq , FrameCycles , HblCounterVideo , LineCycles );
 
 
 	/* Store cycle position of freq 50/60 to check for top/bottom border removal in Video_EndHBL. */
@@ -1608,7 +1796,6 @@ void Video_InterruptHandler_HBL ( void )
 {
 	int FrameCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
 	int PendingCyclesOver;
-	int NewHBLPos;
 
 	/* How many cycle was this HBL delayed (>= 0) */
 	PendingCyclesOver = -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
@@ -1616,6 +1803,31 @@ void Video_InterruptHandler_HBL ( void )
 	/* Remove this interrupt from list and re-order */
 	CycInt_AcknowledgeInterrupt();
 
+	/* If this interrupt ends a batch, the previous lines ended exactly on time */
+	if ( HblBatchLastLine >= 0 )
+	{
+		while ( nHBL < HblBatchLastLine )
+			Video_HBL_Line ( VideoLineStartCycle + nCyclesPerLine , 0 , true );
+		Video_HBL_StopBatch ();
+	}
+
+	Video_HBL_Line ( FrameCycles , PendingCyclesOver , false );
+
+	if ( ConfigureParams.System.bBatchHbl )
+		Video_HBL_StartBatch ();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Handle the end of line nHBL, which happened at FrameCycles-PendingCyclesOver.
+ * For a line processed from a batch, the HBL interrupt of the next line
+ * is already set.
+ */
+static void Video_HBL_Line ( int FrameCycles , int PendingCyclesOver , bool bBatched )
+{
+	int NewHBLPos;
+
 	/* Videl Vertical counter increment (To be removed when Videl emulation is finished) */
 	/* VFC is incremented every half line, here, we increment it every line (should be completed) */
 	if (ConfigureParams.System.nMachineType == MACHINE_FALCON) {
@@ -1634,9 +1846,15 @@ void Video_InterruptHandler_HBL ( void )
 	NewHBLPos = Video_HBL_GetPos();
 
 	/* Generate new HBL, if need to - there are 313 HBLs per frame in 50 Hz */
-	if (nHBL < nScanlinesPerFrame-1)
+	if ( !bBatched && ( nHBL < nScanlinesPerFrame-1 ) )
 		Video_AddInterruptHBL ( NewHBLPos );
 
+#ifdef __LIBRETRO__
+	/* Optional low latency input, polled within the frame */
+	if (nHBL == hatari_input_scanline)
+		update_input_late();
+#endif
+
 
 	/* In case we're mixing 50 Hz (512 cycles) and 60 Hz (508 cycles) lines on the same screen, */
 	/* we must update the position where the next VBL will happen (instead of the initial value in CyclesPerVBL) */
@@ -1674,6 +1892,15 @@ void Video_InterruptHandler_HBL ( void )
 	/* Set pending bit for HBL interrupt in the CPU IPL */
 	M68000_Exception(EXCEPTION_HBLANK , M68000_EXC_SRC_AUTOVEC);	/* Horizontal blank interrupt, level 2 */
 
+	/* Count timer B's event for this line if it had no EndLine interrupt */
+	/* (must be done before Video_EndHBL changes nStartHBL/nEndHBL) */
+	if ( TimerBEventLine == nHBL )
+	{
+		CycInt_RemovePendingInterrupt ( INTERRUPT_VIDEO_ENDLINE );
+		TimerBEventLine = -1;
+	}
+	if ( TimerBCountedLine < nHBL )
+		Video_TimerB_CountLine ( nHBL , ShifterFrame.ShifterLines[ nHBL ].StartCycle + Video_TimerB_GetPos ( nHBL ) , 0 );
 
 	Video_EndHBL();					/* Check some borders removal and copy line to display buffer */
 
@@ -1683,6 +1910,9 @@ void Video_InterruptHandler_HBL ( void )
 	IPF_Emulate();
 	/* TEMP IPF */
 
+	if (unlikely(bTimelineEnabled))
+		Timeline_EndLine(nHBL, false);
+
 	nHBL++;						/* Increase HBL count */
 
 	if (nHBL < nScanlinesPerFrame)
@@ -1694,7 +1924,128 @@ void Video_InterruptHandler_HBL ( void )
 
 		/* Setup next HBL */
 		Video_StartHBL();
+
+		/* Add an EndLine interrupt if timer B expires on this line */
+		LineTimerBCycle = Video_TimerB_GetDefaultPos ();
+		Video_TimerB_Arm ();
 	}
+	Video_SetLineStartCycles();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called after the HBL interrupt of line nHBL-1 : when nothing depends on
+ * the next lines' HBLs (HBL interrupt masked and already pending, timer B
+ * not counting lines, no DMA sound, no mixed 50/60 Hz lines), replace
+ * their HBL interrupts by a single one at the end of the last line of the
+ * frame. Anything that could notice the skipped lines calls Video_HBL_Sync()
+ * first, this includes writes to the ST RAM read by these lines, which
+ * are watched by 64 KB banks (not available with the WinUAE CPU core).
+ * With IPF support, the FDC emulation runs from each HBL and prevents batching.
+ */
+static void Video_HBL_StartBatch ( void )
+{
+#if !ENABLE_WINUAE_CPU && !defined(HAVE_CAPSIMAGE)
+	int FrameCycles, HblCounterVideo, LineCycles;
+	int LastLine;
+	int LineBytes;
+	Uint32 Addr;
+	int i;
+
+	if ( bHblBatchBroken || bUseVDIRes || ( nHBL >= nScanlinesPerFrame-1 ) )
+		return;
+
+	if ( ( ConfigureParams.System.nMachineType != MACHINE_ST )
+	  && ( ConfigureParams.System.nMachineType != MACHINE_STE )
+	  && ( ConfigureParams.System.nMachineType != MACHINE_MEGA_STE ) )
+		return;
+
+	if ( ( regs.intmask < 2 ) || ( ( pendingInterrupts & ( 1 << 2 ) ) == 0 )
+	  || ( MFP_TBCR == 0x08 ) || !DmaSnd_STE_HBL_Idle ()
+	  || unlikely(bTimelineEnabled) || LOG_TRACE_LEVEL ( TRACE_VIDEO_HBL ) )
+		return;
+
+	/* Pending changes to the video counter are applied during the line copy */
+	if ( ( pVideoRasterDelayed != NULL ) || ( VideoCounterDelayedOffset != 0 ) )
+		return;
+
+	/* Each line must have the same length, see Video_HBL_Line() */
+	if ( ( ( nScanlinesPerFrame == SCANLINES_PER_FRAME_50HZ ) && ( nCyclesPerLine == CYCLES_PER_LINE_60HZ ) )
+	  || ( ( nScanlinesPerFrame == SCANLINES_PER_FRAME_60HZ ) && ( nCyclesPerLine == CYCLES_PER_LINE_50HZ ) ) )
+		return;
+
+	/* The HBL of the current line must not be late already */
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	if ( HblCounterVideo != nHBL )
+		return;
+
+	LastLine = nScanlinesPerFrame-1;
+#ifdef __LIBRETRO__
+	/* Input is polled from the HBL interrupt of this line */
+	if ( ( hatari_input_scanline >= nHBL ) && ( hatari_input_scanline < LastLine ) )
+		LastLine = hatari_input_scanline;
+#endif
+	if ( LastLine <= nHBL )
+		return;
+
+	/* Watch the banks that can be read by the lines before LastLine */
+	LineBytes = VIDEO_LINE_MAXBYTES + 2 * ( NewLineWidth > LineWidth ? NewLineWidth : LineWidth );
+	Addr = pVideoRaster - STRam;
+	HblBatchFirstBank = Addr >> 16;
+	HblBatchNbBanks = ( ( Addr + ( LastLine - nHBL ) * LineBytes ) >> 16 ) - HblBatchFirstBank + 1;
+	if ( HblBatchNbBanks > 256 )
+		HblBatchNbBanks = 256;
+	for ( i = 0 ; i < HblBatchNbBanks ; i++ )
+		memory_watch_bank ( HblBatchFirstBank + i , MEMORY_WATCH_VIDEO , true );
+
+	HblBatchLastLine = LastLine;
+	CycInt_AddRelativeInterrupt ( ( LastLine - nHBL + 1 ) * nCyclesPerLine - LineCycles , INT_CPU_CYCLE , INTERRUPT_VIDEO_HBL );
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * End the current batch, without processing its lines.
+ */
+static void Video_HBL_StopBatch ( void )
+{
+#if !ENABLE_WINUAE_CPU
+	int i;
+
+	for ( i = 0 ; i < HblBatchNbBanks ; i++ )
+		memory_watch_bank ( HblBatchFirstBank + i , MEMORY_WATCH_VIDEO , false );
+#endif
+	HblBatchNbBanks = 0;
+	HblBatchLastLine = -1;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Process the batched lines whose end was already reached, and go back to
+ * one HBL interrupt per line until next VBL. Called before any access
+ * which could notice that these lines were not processed yet.
+ */
+void Video_HBL_Sync ( void )
+{
+	int FrameCycles;
+	int LastLine = HblBatchLastLine;
+
+	if ( LastLine < 0 )
+		return;
+
+	FrameCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
+	while ( ( nHBL < LastLine ) && ( VideoLineStartCycle + nCyclesPerLine <= FrameCycles ) )
+		Video_HBL_Line ( VideoLineStartCycle + nCyclesPerLine , 0 , true );
+
+	Video_HBL_StopBatch ();
+	bHblBatchBroken = true;
+
+	/* Move the HBL interrupt back to the end of the current line */
+	if ( nHBL < LastLine )
+		Video_AddInterruptHBL ( nCyclesPerLine );
 }
 
 
@@ -1824,7 +2175,11 @@ static void Video_EndHBL(void)
 	{
 		/* Copy for hi-res (no overscan) */
 		if (nHBL >= nFirstVisibleHbl && nHBL < nLastVisibleHbl)
+		{
+			PERFCOUNT_BEGIN(PERFCOUNT_VIDEOLINE, nPerfPrev);
 			Video_CopyScreenLineMono();
+			PERFCOUNT_END(nPerfPrev);
+		}
 	}
 	/* Are we in possible visible color display (including borders)? */
 	else if (nHBL >= nFirstVisibleHbl && nHBL < nLastVisibleHbl)
@@ -1835,7 +2190,9 @@ static void Video_EndHBL(void)
 		/* Copy line of screen to buffer to simulate TV raster trace
 		 * - required for mouse cursor display/game updates
 		 * Eg, Lemmings and The Killing Game Show are good examples */
+		PERFCOUNT_BEGIN(PERFCOUNT_VIDEOLINE, nPerfPrev);
 		Video_CopyScreenLineColor();
+		PERFCOUNT_END(nPerfPrev);
 	}
 }
 
@@ -1875,6 +2232,95 @@ static void Video_StartHBL(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Count the timer B event of a line, if timer B is in event count mode
+ * and the line is within the display.
+ * We must ensure that the write to fffa1b to activate timer B was
+ * completed before the point where the end of line signal was generated
+ * (in the case of a move.b #8,$fffa1b that would happen 4 cycles
+ * before end of line, the interrupt should not be generated)
+ */
+static void Video_TimerB_CountLine ( int nLine , int EventCycles , int Delayed_Cycles )
+{
+	TimerBCountedLine = nLine;
+
+	/* Timer B occurs at END of first visible screen line in Event Count mode */
+	if ( ( nLine >= nStartHBL ) && ( nLine < nEndHBL + BlankLines )
+		&& ( MFP_TBCR == 0x08 )						/* Is timer in Event Count mode ? */
+		&& ( ( TimerBEventCountCycleStart == -1 )			/* timer B was started during a previous VBL */
+		  || ( TimerBEventCountCycleStart < EventCycles ) ) )		/* timer B was started before this possible interrupt */
+		MFP_TimerB_EventCount_Interrupt ( Delayed_Cycles );		/* we have a valid timer B interrupt */
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add an EndLine interrupt on the current line if timer B's event count
+ * expires on this line (the events of the other lines are counted
+ * from the HBL handler without needing an interrupt of their own).
+ */
+static void Video_TimerB_Arm ( void )
+{
+	TimerBEventLine = -1;
+
+	if ( ( MFP_TBCR == 0x08 ) && MFP_TimerB_EventCount_Expires()
+		&& ( nHBL >= nStartHBL ) && ( nHBL < nEndHBL + BlankLines ) )
+	{
+		TimerBEventLine = nHBL;
+		Video_AddInterruptTimerB ( LineTimerBCycle );
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Count timer B's event for the current line if its position was already
+ * reached, so that MFP's event counter is up to date. Called by the MFP
+ * before reading or changing timer B's state.
+ */
+void Video_TimerB_Sync ( void )
+{
+	int FrameCycles, HblCounterVideo, LineCycles;
+
+	Video_HBL_Sync ();
+
+	if ( bUseVDIRes || TimerBCountedLine >= nHBL )
+		return;
+
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	if ( ( HblCounterVideo == nHBL ) && ( LineCycles >= LineTimerBCycle ) )
+		Video_TimerB_CountLine ( nHBL , FrameCycles - LineCycles + LineTimerBCycle , 0 );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Timer B's event count mode or counter changed, check if an EndLine
+ * interrupt is needed on the current line.
+ */
+void Video_TimerB_Update ( void )
+{
+	int FrameCycles, HblCounterVideo, LineCycles;
+
+	Video_HBL_Sync ();
+
+	if ( bUseVDIRes )
+		return;
+
+	if ( TimerBEventLine >= 0 )
+	{
+		CycInt_RemovePendingInterrupt ( INTERRUPT_VIDEO_ENDLINE );
+		TimerBEventLine = -1;
+	}
+
+	/* If this line's position was already reached, next HBL will check the next line */
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	if ( ( TimerBCountedLine < nHBL ) && ( HblCounterVideo == nHBL ) && ( LineCycles < LineTimerBCycle ) )
+		Video_TimerB_Arm ();
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * End Of Line interrupt
@@ -1884,6 +2330,8 @@ static void Video_StartHBL(void)
  * after DisplayEndCycle.
  * Note that if bit 3 of MFP AER is 1, then timer B will count start of line
  * instead of end of line (at cycle 52+24 or 56+24)
+ * This interrupt is only added on the lines where timer B's event count
+ * expires, see Video_TimerB_Arm().
  */
 void Video_InterruptHandler_EndLine(void)
 {
@@ -1902,46 +2350,12 @@ void Video_InterruptHandler_EndLine(void)
 	if (bUseVDIRes)
 		return;
 
-	/* Generate new Endline, if need to - there are 313 HBLs per frame */
-	if (nHBL < nScanlinesPerFrame-1)
-	{
-		/* By default, next EndLine's int will be on line nHBL+1 at pos 376+24 or 372+24 */
-		if ( ( IoMem[0xfffa03] & ( 1 << 3 ) ) == 0 )		/* count end of line */
-		{
-			/* If EndLine int is delayed too much (more than 100 cycles), nLineCycles will */
-			/* be in the range 0..xxx instead of 400..512. In that case, we need to add */
-			/* nCyclesPerLine to be in the range 512..x+512 */
-			/* Maximum possible delay should be around 160 cycles on STF (DIVS) */
-			/* In that case, HBL int will be delayed too, so we will have HblCounterVideo == nHBL+1 */
-			if ( HblCounterVideo == nHBL+1 )		/* int happened in fact on the next line nHBL+1 */
-				LineCycles += nCyclesPerLine;
-
-			LineTimerBCycle = Video_TimerB_GetDefaultPos ();
-		}
-
-		else							/* count start of line, no possible delay to handle */
-		{
-			LineTimerBCycle = Video_TimerB_GetDefaultPos ();
-		}
-
-//fprintf ( stderr , "new tb %d %d %d\n" , LineTimerBCycle , nCyclesPerLine , LineTimerBCycle - LineCycles + nCyclesPerLine );
-		CycInt_AddRelativeInterrupt ( LineTimerBCycle - LineCycles + nCyclesPerLine,
-					 INT_CPU_CYCLE, INTERRUPT_VIDEO_ENDLINE );
-	}
+	/* Ignore interrupt if this line's event was already counted */
+	if ( ( TimerBEventLine != nHBL ) || ( TimerBCountedLine >= nHBL ) )
+		return;
 
-	/* Timer B occurs at END of first visible screen line in Event Count mode */
-	if ( ( nHBL >= nStartHBL ) && ( nHBL < nEndHBL + BlankLines ) )
-	{
-		/* Handle Timer B when using Event Count mode */
-		/* We must ensure that the write to fffa1b to activate timer B was */
-		/* completed before the point where the end of line signal was generated */
-		/* (in the case of a move.b #8,$fffa1b that would happen 4 cycles */
-		/* before end of line, the interrupt should not be generated) */
-		if ( (MFP_TBCR == 0x08)						/* Is timer in Event Count mode ? */
-			&& ( ( TimerBEventCountCycleStart == -1 )		/* timer B was started during a previous VBL */
-			  || ( TimerBEventCountCycleStart < FrameCycles-PendingCycles ) ) )	/* timer B was started before this possible interrupt */
-			MFP_TimerB_EventCount_Interrupt ( PendingCycles );	/* we have a valid timer B interrupt */
-	}
+	TimerBEventLine = -1;
+	Video_TimerB_CountLine ( nHBL , FrameCycles - PendingCycles , PendingCycles );
 }
 
 
@@ -2021,6 +2435,97 @@ static void Video_StoreResolution(int y)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Shift 'count' big endian plane words of a line to the left by 'shift'
+ * pixels (1-15), taking the new low bits from the word of the same plane
+ * 'stride' words later (4 in low res, 2 in med res, 1 in high res).
+ * Words are shifted in place from left to right, so words that are
+ * still to be shifted are never overwritten before they are read.
+ * 8 words are shifted at a time with SSE2/NEON.
+ */
+static void Video_ShiftLineLeft(Uint16 *p, int count, int stride, int shift)
+{
+	int i = 0;
+
+#if VIDEO_SHIFT_SSE2
+	const __m128i sl = _mm_cvtsi32_si128(shift);
+	const __m128i sr = _mm_cvtsi32_si128(16 - shift);
+	__m128i a, b;
+
+	for ( ; i + 8 <= count ; i += 8 )
+	{
+		a = _mm_loadu_si128((const __m128i *)(p + i));
+		b = _mm_loadu_si128((const __m128i *)(p + i + stride));
+		a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));	/* to host endian */
+		b = _mm_or_si128(_mm_slli_epi16(b, 8), _mm_srli_epi16(b, 8));
+		a = _mm_or_si128(_mm_sll_epi16(a, sl), _mm_srl_epi16(b, sr));
+		a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));	/* back to big endian */
+		_mm_storeu_si128((__m128i *)(p + i), a);
+	}
+#elif VIDEO_SHIFT_NEON
+	const int16x8_t sl = vdupq_n_s16(shift);
+	const int16x8_t sr = vdupq_n_s16(shift - 16);		/* negative: shift to the right */
+	uint16x8_t a, b;
+
+	for ( ; i + 8 <= count ; i += 8 )
+	{
+		a = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8((const Uint8 *)(p + i))));
+		b = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8((const Uint8 *)(p + i + stride))));
+		a = vorrq_u16(vshlq_u16(a, sl), vshlq_u16(b, sr));
+		vst1q_u8((Uint8 *)(p + i), vrev16q_u8(vreinterpretq_u8_u16(a)));
+	}
+#endif
+	for ( ; i < count ; i++ )
+		do_put_mem_word(p + i, (do_get_mem_word(p + i) << shift)
+		                | (do_get_mem_word(p + i + stride) >> (16 - shift)));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Shift 'count' big endian plane words of a line to the right by 'shift'
+ * pixels (1-15), taking the new high bits from the word of the same plane
+ * 'stride' words before. Words are shifted in place from right to left.
+ */
+static void Video_ShiftLineRight(Uint16 *p, int count, int stride, int shift)
+{
+	int i = count;
+
+#if VIDEO_SHIFT_SSE2
+	const __m128i sr = _mm_cvtsi32_si128(shift);
+	const __m128i sl = _mm_cvtsi32_si128(16 - shift);
+	__m128i a, b;
+
+	for ( ; i >= 8 ; i -= 8 )
+	{
+		a = _mm_loadu_si128((const __m128i *)(p + i - 8));
+		b = _mm_loadu_si128((const __m128i *)(p + i - 8 - stride));
+		a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+		b = _mm_or_si128(_mm_slli_epi16(b, 8), _mm_srli_epi16(b, 8));
+		a = _mm_or_si128(_mm_srl_epi16(a, sr), _mm_sll_epi16(b, sl));
+		a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+		_mm_storeu_si128((__m128i *)(p + i - 8), a);
+	}
+#elif VIDEO_SHIFT_NEON
+	const int16x8_t sr = vdupq_n_s16(-shift);
+	const int16x8_t sl = vdupq_n_s16(16 - shift);
+	uint16x8_t a, b;
+
+	for ( ; i >= 8 ; i -= 8 )
+	{
+		a = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8((const Uint8 *)(p + i - 8))));
+		b = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8((const Uint8 *)(p + i - 8 - stride))));
+		a = vorrq_u16(vshlq_u16(a, sr), vshlq_u16(b, sl));
+		vst1q_u8((Uint8 *)(p + i - 8), vrev16q_u8(vreinterpretq_u8_u16(a)));
+	}
+#endif
+	while ( --i >= 0 )
+		do_put_mem_word(p + i, (do_get_mem_word(p + i) >> shift)
+		                | (do_get_mem_word(p + i - stride) << (16 - shift)));
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Copy one line of monochrome screen into buffer for conversion later.
@@ -2041,12 +2546,8 @@ static void Video_CopyScreenLineMono(void)
 		nNegScrollCnt = 16 - HWScrollCount;
 
 		/* Shift the whole line by the given scroll count */
-		while ((Uint8*)pScrollAdj < pSTScreen + SCREENBYTES_MONOLINE-2)
-		{
-			do_put_mem_word(pScrollAdj, (do_get_mem_word(pScrollAdj) << HWScrollCount)
-			                | (do_get_mem_word(pScrollAdj+1) >> nNegScrollCnt));
-			++pScrollAdj;
-		}
+		Video_ShiftLineLeft(pScrollAdj, SCREENBYTES_MONOLINE/2-1, 1, HWScrollCount);
+		pScrollAdj += SCREENBYTES_MONOLINE/2-1;
 
 		/* Handle the last 16 pixels of the line */
 		do_put_mem_word(pScrollAdj, (do_get_mem_word(pScrollAdj) << HWScrollCount)
@@ -2101,8 +2602,276 @@ static void Video_CopyScreenLineMono(void)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Copy one line of color screen into buffer for conversion later.
+ * Convert one line captured by Video_CopyScreenLineColor into the screen
+ * buffer : copy the bytes read by the shifter and apply the borders and the
+ * STF/STE pixel scrolling that were recorded for this line.
+ */
+static void Video_ConvertScreenLineColor(const VIDEO_LINE *pLine, Uint8 *pData)
+{
+	Uint8 *pScreen = pLine->pScreen;
+	Uint8 *pRaster = pData + pLine->RasterOffset;	/* video counter at the start of the line */
+	Uint8 *pRasterEndLine;				/* addr of the last byte copied from pRaster to pScreen (for HWScrollCount) */
+	int STF_PixelScroll = pLine->PixelScroll;
+	int i;
+
+	if ( pLine->bBlank )
+	{
+		/* Clear line to color '0' */
+		memset(pScreen, 0, SCREENBYTES_LINE);
+		return;
+	}
+
+	/* Does have left border ? */
+	if ( pLine->BorderMask & ( BORDERMASK_LEFT_OFF | BORDERMASK_LEFT_OFF_MED ) )	/* bigger line by 26 bytes on the left */
+	{
+		pRaster += BORDERBYTES_LEFT-SCREENBYTES_LEFT+pLine->VideoOffset;
+		memcpy(pScreen, pRaster, SCREENBYTES_LEFT);
+		pRaster += SCREENBYTES_LEFT;
+	}
+	else if ( pLine->BorderMask & BORDERMASK_LEFT_OFF_2_STE )	/* bigger line by 20 bytes on the left (STE specific) */
+	{							/* bytes 0-3 are not shown, only next 16 bytes (32 pixels, 4 bitplanes) */
+		if ( SCREENBYTES_LEFT > BORDERBYTES_LEFT_2_STE )
+		{
+			memset ( pScreen, 0, SCREENBYTES_LEFT-BORDERBYTES_LEFT_2_STE+4 );	/* clear unused pixels + bytes 0-3 */
+			memcpy ( pScreen+SCREENBYTES_LEFT-BORDERBYTES_LEFT_2_STE+4, pRaster+pLine->VideoOffset+4, BORDERBYTES_LEFT_2_STE-4 );
+		}
+		else
+			memcpy ( pScreen, pRaster+BORDERBYTES_LEFT_2_STE-SCREENBYTES_LEFT+pLine->VideoOffset, SCREENBYTES_LEFT );
+
+		pRaster += BORDERBYTES_LEFT_2_STE+pLine->VideoOffset;
+	}
+	else if (pLine->BorderMask & BORDERMASK_LEFT_PLUS_2)	/* bigger line by 2 bytes on the left */
+	{
+		if ( SCREENBYTES_LEFT > 2 )
+		{
+			memset(pScreen,0,SCREENBYTES_LEFT-2);		/* clear unused pixels */
+			memcpy(pScreen+SCREENBYTES_LEFT-2, pRaster, 2);
+		}
+		else
+		{						/* nothing to copy, left border is not large enough */
+		}
+
+		pRaster += 2;
+	}
+	else if (pLine->bSteBorder)				/* bigger line by 8 bytes on the left (STE specific) */
+	{
+		if ( SCREENBYTES_LEFT > 4*2 )
+		{
+			memset(pScreen,0,SCREENBYTES_LEFT-4*2);	/* clear unused pixels */
+			memcpy(pScreen+SCREENBYTES_LEFT-4*2, pRaster, 4*2);
+		}
+		else
+		{						/* nothing to copy, left border is not large enough */
+		}
+
+		pRaster += 4*2;
+	}
+	else
+		memset(pScreen,0,SCREENBYTES_LEFT);		/* left border not removed, clear to color '0' */
+
+	/* Short line due to hires in the middle ? */
+	if (pLine->BorderMask & BORDERMASK_STOP_MIDDLE)
+	{
+		/* 106 bytes less in the line */
+		memcpy(pScreen+SCREENBYTES_LEFT, pRaster, SCREENBYTES_MIDDLE-106);
+		memset(pScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE-106, 0, 106);	/* clear unused pixels */
+		pRaster += (SCREENBYTES_MIDDLE-106);
+	}
+	else
+	{
+		/* normal middle part (160 bytes) */
+		memcpy(pScreen+SCREENBYTES_LEFT, pRaster, SCREENBYTES_MIDDLE);
+		pRaster += SCREENBYTES_MIDDLE;
+	}
+
+	/* Does have right border ? */
+	if (pLine->BorderMask & BORDERMASK_RIGHT_OFF)
+	{
+		memcpy(pScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE, pRaster, SCREENBYTES_RIGHT);
+		pRasterEndLine = pRaster + SCREENBYTES_RIGHT;
+	}
+	else if (pLine->BorderMask & BORDERMASK_RIGHT_MINUS_2)
+	{
+		/* Shortened line by 2 bytes */
+		memset(pScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE-2, 0, SCREENBYTES_RIGHT+2);
+		pRasterEndLine = pRaster - 2;
+	}
+	else
+	{
+		/* Simply clear right border to '0' */
+		memset(pScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE,0,SCREENBYTES_RIGHT);
+		pRasterEndLine = pRaster;
+	}
+
+	/* Shifter read bytes and borders can change, but display is blank, so finally clear the line with color 0 */
+	if (pLine->BorderMask & BORDERMASK_BLANK_LINE)
+		memset(pScreen, 0, SCREENBYTES_LINE);
+
+	/* STE specific */
+	if (!pLine->bSteBorder && pLine->HWScrollCount)		/* Handle STE fine scrolling (HWScrollCount is zero on ST) */
+	{
+		Uint16 *pScrollAdj;	/* Pointer to actual position in line */
+		int nNegScrollCnt;
+		Uint16 *pScrollEndAddr;	/* Pointer to end of the line */
+
+		nNegScrollCnt = 16 - pLine->HWScrollCount;
+		if (pLine->BorderMask & BORDERMASK_LEFT_OFF)
+			pScrollAdj = (Uint16 *)pScreen;
+		else if (pLine->BorderMask & BORDERMASK_LEFT_OFF_2_STE)
+		{
+			if ( SCREENBYTES_LEFT > BORDERBYTES_LEFT_2_STE )
+				pScrollAdj = (Uint16 *)(pScreen+8);	/* don't scroll the 8 first bytes (keep color 0)*/
+			else
+				pScrollAdj = (Uint16 *)pScreen;	/* we render less bytes on screen than a real ST, scroll the whole line */
+		}
+		else
+			pScrollAdj = (Uint16 *)(pScreen + SCREENBYTES_LEFT);
+
+		/* When shifting the line to the left, we will have 'HWScrollCount' missing pixels at	*/
+		/* the end of the line. We must complete these last 16 pixels with pixels from the	*/
+		/* video counter last accessed value in pRasterEndLine.				*/
+		/* There're 2 passes :									*/
+		/*  - shift whole line except the last 16 pixels					*/
+		/*  - shift/complete the last 16 pixels							*/
+
+		/* Addr of the last byte to shift in the 1st pass (excluding the last 16 pixels of the line) */
+		if (pLine->BorderMask & BORDERMASK_RIGHT_OFF)
+			pScrollEndAddr = (Uint16 *)(pScreen + SCREENBYTES_LINE - 8);
+		else
+			pScrollEndAddr = (Uint16 *)(pScreen + SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 8);
+
+
+		if ( pLine->LineRes == 1 )				/* med res */
+		{
+			/* in med res, 16 pixels are 4 bytes, not 8 as in low res, so only the last 4 bytes need a special case */
+			pScrollEndAddr += 2;			/* 2 Uint16 = 4 bytes = 16 pixels */
+
+			/* Shift the whole line to the left by the given scroll count (except the last 16 pixels) */
+			if (pScrollAdj < pScrollEndAddr)
+			{
+				Video_ShiftLineLeft(pScrollAdj, pScrollEndAddr - pScrollAdj, 2, pLine->HWScrollCount);
+				pScrollAdj = pScrollEndAddr;
+			}
+			/* Handle the last 16 pixels of the line (complete the line with pixels from pRasterEndLine) */
+			for ( i=0 ; i<2 ; i++ )
+				do_put_mem_word(pScrollAdj+i, (do_get_mem_word(pScrollAdj+i) << pLine->HWScrollCount)
+			                | (do_get_mem_word(pRasterEndLine+i*2) >> nNegScrollCnt));
+
+			/* If scrolling with $ff8264, there's no prefetch, which means display starts */
+			/* 16 pixels later but still stops at the normal point (eg we display */
+			/* (320-16) pixels in low res). We shift the whole line 4 bytes to the right to */
+			/* get the correct result (using memmove, as src/dest are overlapping). */
+			if ( pLine->HWScrollPrefetch != 1 )
+			{
+				if (pLine->BorderMask & BORDERMASK_RIGHT_OFF)
+					memmove ( pScreen+4 , pScreen , SCREENBYTES_LINE - 4 );
+				else
+					memmove ( pScreen+4 , pScreen , SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 4 );
+
+				memset ( pScreen , 0 , 4 );	/* first 16 pixels are color '0' */
+			}
+		}
+
+		else						/* low res */
+		{
+			/* Shift the whole line to the left by the given scroll count (except the last 16 pixels) */
+			if (pScrollAdj < pScrollEndAddr)
+			{
+				Video_ShiftLineLeft(pScrollAdj, pScrollEndAddr - pScrollAdj, 4, pLine->HWScrollCount);
+				pScrollAdj = pScrollEndAddr;
+			}
+			/* Handle the last 16 pixels of the line (complete the line with pixels from pRasterEndLine) */
+			for ( i=0 ; i<4 ; i++ )
+				do_put_mem_word(pScrollAdj+i, (do_get_mem_word(pScrollAdj+i) << pLine->HWScrollCount)
+			                | (do_get_mem_word(pRasterEndLine+i*2) >> nNegScrollCnt));
+
+			/* If scrolling with $ff8264, there's no prefetch, which means display starts */
+			/* 16 pixels later but still stops at the normal point (eg we display */
+			/* (320-16) pixels in low res). We shift the whole line 8 bytes to the right to */
+			/* get the correct result (using memmove, as src/dest are overlapping). */
+			if ( pLine->HWScrollPrefetch != 1 )
+			{
+				if (pLine->BorderMask & BORDERMASK_RIGHT_OFF)
+					memmove ( pScreen+8 , pScreen , SCREENBYTES_LINE - 8 );
+				else
+					memmove ( pScreen+8 , pScreen , SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 8 );
+
+				memset ( pScreen , 0 , 8 );	/* first 16 pixels are color '0' */
+			}
+		}
+	}
+
+
+	/* Handle 4 pixels hardware scrolling ('ST Cnx' demo in 'Punish Your Machine') */
+	/* as well as scrolling occurring when removing the left border. */
+	/* If >0, shift the line by STF_PixelScroll pixels to the right */
+	/* If <0, shift the line by -STF_PixelScroll pixels to the left */
+	/* This should be handled after the STE's hardware scrolling as it will scroll */
+	/* the whole displayed area (while the STE scrolls pixels inside the displayed area) */
+	if ( STF_PixelScroll > 0 )
+	{
+		Uint16 *pScreenLineEnd;
+		int count;
+
+		pScreenLineEnd = (Uint16 *) ( pScreen + SCREENBYTES_LINE - 2 );
+		if ( pLine->LineRes == 0 )			/* low res */
+		{
+			count = ( SCREENBYTES_LINE - 8 ) / 2;
+			pScreenLineEnd -= count;
+			Video_ShiftLineRight ( pScreenLineEnd + 1 , count , 4 , STF_PixelScroll );
+			/* Handle the first 16 pixels of the line (add color 0 pixels to the extreme left) */
+			do_put_mem_word ( pScreenLineEnd-0 , ( do_get_mem_word ( pScreenLineEnd-0 ) >> STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineEnd-1 , ( do_get_mem_word ( pScreenLineEnd-1 ) >> STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineEnd-2 , ( do_get_mem_word ( pScreenLineEnd-2 ) >> STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineEnd-3 , ( do_get_mem_word ( pScreenLineEnd-3 ) >> STF_PixelScroll ) );
+		}
+		else					/* med res */
+		{
+			count = ( SCREENBYTES_LINE - 4 ) / 2;
+			pScreenLineEnd -= count;
+			Video_ShiftLineRight ( pScreenLineEnd + 1 , count , 2 , STF_PixelScroll );
+			/* Handle the first 16 pixels of the line (add color 0 pixels to the extreme left) */
+			do_put_mem_word ( pScreenLineEnd-0 , ( do_get_mem_word ( pScreenLineEnd-0 ) >> STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineEnd-1 , ( do_get_mem_word ( pScreenLineEnd-1 ) >> STF_PixelScroll ) );
+		}
+	}
+	else if ( STF_PixelScroll < 0 )
+	{
+		Uint16 *pScreenLineStart;
+		int count;
+
+		STF_PixelScroll = -STF_PixelScroll;
+		pScreenLineStart = (Uint16 *)pScreen;
+		if ( pLine->LineRes == 0 )			/* low res */
+		{
+			count = ( SCREENBYTES_LINE - 8 ) / 2;
+			Video_ShiftLineLeft ( pScreenLineStart , count , 4 , STF_PixelScroll );
+			pScreenLineStart += count;
+			/* Handle the last 16 pixels of the line (add color 0 pixels to the extreme right) */
+			do_put_mem_word ( pScreenLineStart+0 , ( do_get_mem_word ( pScreenLineStart+0 ) << STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineStart+1 , ( do_get_mem_word ( pScreenLineStart+1 ) << STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineStart+2 , ( do_get_mem_word ( pScreenLineStart+2 ) << STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineStart+3 , ( do_get_mem_word ( pScreenLineStart+3 ) << STF_PixelScroll ) );
+		}
+		else					/* med res */
+		{
+			count = ( SCREENBYTES_LINE - 4 ) / 2;
+			Video_ShiftLineLeft ( pScreenLineStart , count , 2 , STF_PixelScroll );
+			pScreenLineStart += count;
+			/* Handle the last 16 pixels of the line (add color 0 pixels to the extreme right) */
+			do_put_mem_word ( pScreenLineStart+0 , ( do_get_mem_word ( pScreenLineStart+0 ) << STF_PixelScroll ) );
+			do_put_mem_word ( pScreenLineStart+1 , ( do_get_mem_word ( pScreenLineStart+1 ) << STF_PixelScroll ) );
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Record one line of color screen for conversion later.
  * Possible lines may be top/bottom border, and/or left/right borders.
+ * The video counter is advanced as the shifter would do, while the bytes
+ * it read are kept with the line's borders/scrolling states, so the line
+ * can be converted by Video_ConvertScreenLines when drawing the screen.
  */
 static void Video_CopyScreenLineColor(void)
 {
@@ -2110,7 +2879,12 @@ static void Video_CopyScreenLineColor(void)
 	int VideoOffset = 0;
 	int STF_PixelScroll = 0;
 	int LineRes;
+	bool bBlank;
+	VIDEO_LINE *pLine = NULL;
+	Uint8 *pData = NULL;
+	Uint8 *pRasterLine;				/* value of pVideoRaster at the start of the line */
 	Uint8 *pVideoRasterEndLine;			/* addr of the last byte copied from pVideoRaster to pSTScreen (for HWScrollCount) */
+	int ReadStart, ReadEnd;				/* bytes read by the shifter, relative to pRasterLine */
 	int i;
 
 	LineBorderMask = ShifterFrame.ShifterLines[ nHBL ].BorderMask;
@@ -2176,103 +2950,77 @@ static void Video_CopyScreenLineColor(void)
 		// fprintf(stderr , "scr off %d %d\n" , STF_PixelScroll , VideoOffset);
 	}
 
-
 	/* Is total blank line? I.e. top/bottom border? */
-	if ((nHBL < nStartHBL) || (nHBL >= nEndHBL + BlankLines)
-	    || (LineBorderMask & BORDERMASK_EMPTY_LINE))
+	bBlank = (nHBL < nStartHBL) || (nHBL >= nEndHBL + BlankLines)
+	    || (LineBorderMask & BORDERMASK_EMPTY_LINE);
+
+	/* Record this line for Video_ConvertScreenLines, unless the frame won't be drawn */
+	if ( !Video_FrameIsSkipped() )
 	{
-		/* Clear line to color '0' */
-		memset(pSTScreen, 0, SCREENBYTES_LINE);
+		if ( nVideoLines == NUM_VISIBLE_LINES )
+			Video_ConvertScreenLines();
+		pLine = &VideoLines[ nVideoLines ];
+		pData = VideoLinesData[ nVideoLines++ ];
+
+		pLine->pScreen = pSTScreen;
+		pLine->bBlank = bBlank;
+		pLine->BorderMask = LineBorderMask;
+		pLine->PixelScroll = STF_PixelScroll;
+		pLine->VideoOffset = VideoOffset;
+		pLine->LineRes = LineRes;
+		pLine->bSteBorder = bSteBorderFlag;
+		pLine->HWScrollCount = HWScrollCount;
+		pLine->HWScrollPrefetch = HWScrollPrefetch;
 	}
-	else
+
+	if ( !bBlank )
 	{
+		/* Advance the video counter by the number of bytes read by the shifter */
+		/* and keep the range of bytes that will be needed to convert the line */
+		pRasterLine = pVideoRaster;
+		ReadStart = 0;
+
 		/* Does have left border ? */
 		if ( LineBorderMask & ( BORDERMASK_LEFT_OFF | BORDERMASK_LEFT_OFF_MED ) )	/* bigger line by 26 bytes on the left */
 		{
-			pVideoRaster += BORDERBYTES_LEFT-SCREENBYTES_LEFT+VideoOffset;
-			memcpy(pSTScreen, pVideoRaster, SCREENBYTES_LEFT);
-			pVideoRaster += SCREENBYTES_LEFT;
+			ReadStart = BORDERBYTES_LEFT-SCREENBYTES_LEFT+VideoOffset;
+			pVideoRaster += BORDERBYTES_LEFT+VideoOffset;
 		}
 		else if ( LineBorderMask & BORDERMASK_LEFT_OFF_2_STE )	/* bigger line by 20 bytes on the left (STE specific) */
-		{							/* bytes 0-3 are not shown, only next 16 bytes (32 pixels, 4 bitplanes) */
+		{
 			if ( SCREENBYTES_LEFT > BORDERBYTES_LEFT_2_STE )
-			{
-				memset ( pSTScreen, 0, SCREENBYTES_LEFT-BORDERBYTES_LEFT_2_STE+4 );	/* clear unused pixels + bytes 0-3 */
-				memcpy ( pSTScreen+SCREENBYTES_LEFT-BORDERBYTES_LEFT_2_STE+4, pVideoRaster+VideoOffset+4, BORDERBYTES_LEFT_2_STE-4 );
-			}
+				ReadStart = VideoOffset+4;
 			else
-				memcpy ( pSTScreen, pVideoRaster+BORDERBYTES_LEFT_2_STE-SCREENBYTES_LEFT+VideoOffset, SCREENBYTES_LEFT );
-
+				ReadStart = BORDERBYTES_LEFT_2_STE-SCREENBYTES_LEFT+VideoOffset;
 			pVideoRaster += BORDERBYTES_LEFT_2_STE+VideoOffset;
 		}
 		else if (LineBorderMask & BORDERMASK_LEFT_PLUS_2)	/* bigger line by 2 bytes on the left */
-		{
-			if ( SCREENBYTES_LEFT > 2 )
-			{
-				memset(pSTScreen,0,SCREENBYTES_LEFT-2);		/* clear unused pixels */
-				memcpy(pSTScreen+SCREENBYTES_LEFT-2, pVideoRaster, 2);
-			}
-			else
-			{						/* nothing to copy, left border is not large enough */
-			}
-
 			pVideoRaster += 2;
-		}
 		else if (bSteBorderFlag)				/* bigger line by 8 bytes on the left (STE specific) */
-		{
-			if ( SCREENBYTES_LEFT > 4*2 )
-			{
-				memset(pSTScreen,0,SCREENBYTES_LEFT-4*2);	/* clear unused pixels */
-				memcpy(pSTScreen+SCREENBYTES_LEFT-4*2, pVideoRaster, 4*2);
-			}
-			else
-			{						/* nothing to copy, left border is not large enough */
-			}
-
 			pVideoRaster += 4*2;
-		}
-		else
-			memset(pSTScreen,0,SCREENBYTES_LEFT);		/* left border not removed, clear to color '0' */
 
 		/* Short line due to hires in the middle ? */
 		if (LineBorderMask & BORDERMASK_STOP_MIDDLE)
-		{
-			/* 106 bytes less in the line */
-			memcpy(pSTScreen+SCREENBYTES_LEFT, pVideoRaster, SCREENBYTES_MIDDLE-106);
-			memset(pSTScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE-106, 0, 106);	/* clear unused pixels */
-			pVideoRaster += (SCREENBYTES_MIDDLE-106);
-		}
+			pVideoRaster += (SCREENBYTES_MIDDLE-106);	/* 106 bytes less in the line */
 		else
-		{
-			/* normal middle part (160 bytes) */
-			memcpy(pSTScreen+SCREENBYTES_LEFT, pVideoRaster, SCREENBYTES_MIDDLE);
-			pVideoRaster += SCREENBYTES_MIDDLE;
-		}
+			pVideoRaster += SCREENBYTES_MIDDLE;		/* normal middle part (160 bytes) */
+		ReadEnd = pVideoRaster - pRasterLine;
 
 		/* Does have right border ? */
 		if (LineBorderMask & BORDERMASK_RIGHT_OFF)
 		{
-			memcpy(pSTScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE, pVideoRaster, SCREENBYTES_RIGHT);
 			pVideoRasterEndLine = pVideoRaster + SCREENBYTES_RIGHT;
+			ReadEnd += SCREENBYTES_RIGHT;
 			pVideoRaster += BORDERBYTES_RIGHT;
 		}
 		else if (LineBorderMask & BORDERMASK_RIGHT_MINUS_2)
 		{
 			/* Shortened line by 2 bytes */
-			memset(pSTScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE-2, 0, SCREENBYTES_RIGHT+2);
 			pVideoRaster -= 2;
 			pVideoRasterEndLine = pVideoRaster;
 		}
 		else
-		{
-			/* Simply clear right border to '0' */
-			memset(pSTScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE,0,SCREENBYTES_RIGHT);
 			pVideoRasterEndLine = pVideoRaster;
-		}
-
-		/* Shifter read bytes and borders can change, but display is blank, so finally clear the line with color 0 */
-		if (LineBorderMask & BORDERMASK_BLANK_LINE)
-			memset(pSTScreen, 0, SCREENBYTES_LINE);
 
 		/* Full right border removal up to the end of the line (cycle 512) */
 		if (LineBorderMask & BORDERMASK_RIGHT_OFF_FULL)
@@ -2285,121 +3033,45 @@ static void Video_CopyScreenLineColor(void)
 		/* STE specific */
 		if (!bSteBorderFlag && HWScrollCount)		/* Handle STE fine scrolling (HWScrollCount is zero on ST) */
 		{
-			Uint16 *pScrollAdj;	/* Pointer to actual position in line */
-			int nNegScrollCnt;
-			Uint16 *pScrollEndAddr;	/* Pointer to end of the line */
-
-			nNegScrollCnt = 16 - HWScrollCount;
-			if (LineBorderMask & BORDERMASK_LEFT_OFF)
-				pScrollAdj = (Uint16 *)pSTScreen;
-			else if (LineBorderMask & BORDERMASK_LEFT_OFF_2_STE)
-			{
-				if ( SCREENBYTES_LEFT > BORDERBYTES_LEFT_2_STE )
-					pScrollAdj = (Uint16 *)(pSTScreen+8);	/* don't scroll the 8 first bytes (keep color 0)*/
-				else
-					pScrollAdj = (Uint16 *)pSTScreen;	/* we render less bytes on screen than a real ST, scroll the whole line */
-			}
-			else
-				pScrollAdj = (Uint16 *)(pSTScreen + SCREENBYTES_LEFT);
-
-			/* When shifting the line to the left, we will have 'HWScrollCount' missing pixels at	*/
-			/* the end of the line. We must complete these last 16 pixels with pixels from the	*/
-			/* video counter last accessed value in pVideoRasterEndLine.				*/
-			/* There're 2 passes :									*/
-			/*  - shift whole line except the last 16 pixels					*/
-			/*  - shift/complete the last 16 pixels							*/
-
-			/* Addr of the last byte to shift in the 1st pass (excluding the last 16 pixels of the line) */
-			if (LineBorderMask & BORDERMASK_RIGHT_OFF)
-				pScrollEndAddr = (Uint16 *)(pSTScreen + SCREENBYTES_LINE - 8);
-			else
-				pScrollEndAddr = (Uint16 *)(pSTScreen + SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 8);
-
-
+			/* The last 16 pixels of the line are completed with the bytes at pVideoRasterEndLine */
 			if ( LineRes == 1 )				/* med res */
 			{
-				/* in med res, 16 pixels are 4 bytes, not 8 as in low res, so only the last 4 bytes need a special case */
-				pScrollEndAddr += 2;			/* 2 Uint16 = 4 bytes = 16 pixels */
-
-				/* Shift the whole line to the left by the given scroll count (except the last 16 pixels) */
-				while (pScrollAdj < pScrollEndAddr)
-				{
-					do_put_mem_word(pScrollAdj, (do_get_mem_word(pScrollAdj) << HWScrollCount)
-					                | (do_get_mem_word(pScrollAdj+2) >> nNegScrollCnt));
-					++pScrollAdj;
-				}
-				/* Handle the last 16 pixels of the line (complete the line with pixels from pVideoRasterEndLine) */
-				for ( i=0 ; i<2 ; i++ )
-					do_put_mem_word(pScrollAdj+i, (do_get_mem_word(pScrollAdj+i) << HWScrollCount)
-				                | (do_get_mem_word(pVideoRasterEndLine+i*2) >> nNegScrollCnt));
+				if ( ReadEnd < pVideoRasterEndLine + 2*2 - pRasterLine )
+					ReadEnd = pVideoRasterEndLine + 2*2 - pRasterLine;
 
 				/* Depending on whether $ff8264 or $ff8265 was used to scroll, */
 				/* we prefetched 16 pixel (4 bytes) */
 				if ( HWScrollPrefetch == 1 )		/* $ff8265 prefetches 16 pixels */
 					pVideoRaster += 2 * 2;		/* 2 bitplans */
-
-				/* If scrolling with $ff8264, there's no prefetch, which means display starts */
-				/* 16 pixels later but still stops at the normal point (eg we display */
-				/* (320-16) pixels in low res). We shift the whole line 4 bytes to the right to */
-				/* get the correct result (using memmove, as src/dest are overlapping). */
-				else
-				{
-					if (LineBorderMask & BORDERMASK_RIGHT_OFF)
-						memmove ( pSTScreen+4 , pSTScreen , SCREENBYTES_LINE - 4 );
-					else
-						memmove ( pSTScreen+4 , pSTScreen , SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 4 );
-
-					memset ( pSTScreen , 0 , 4 );	/* first 16 pixels are color '0' */
-				}
 			}
 
 			else						/* low res */
 			{
-				/* Shift the whole line to the left by the given scroll count (except the last 16 pixels) */
-				while (pScrollAdj < pScrollEndAddr)
-				{
-					do_put_mem_word(pScrollAdj, (do_get_mem_word(pScrollAdj) << HWScrollCount)
-					                | (do_get_mem_word(pScrollAdj+4) >> nNegScrollCnt));
-					++pScrollAdj;
-				}
-				/* Handle the last 16 pixels of the line (complete the line with pixels from pVideoRasterEndLine) */
-				for ( i=0 ; i<4 ; i++ )
-					do_put_mem_word(pScrollAdj+i, (do_get_mem_word(pScrollAdj+i) << HWScrollCount)
-				                | (do_get_mem_word(pVideoRasterEndLine+i*2) >> nNegScrollCnt));
+				if ( ReadEnd < pVideoRasterEndLine + 4*2 - pRasterLine )
+					ReadEnd = pVideoRasterEndLine + 4*2 - pRasterLine;
 
 				/* Depending on whether $ff8264 or $ff8265 was used to scroll, */
 				/* we prefetched 16 pixel (8 bytes) */
 				if ( HWScrollPrefetch == 1 )		/* $ff8265 prefetches 16 pixels */
 					pVideoRaster += 4 * 2;		/* 4 bitplans */
 
-				/* If scrolling with $ff8264, there's no prefetch, which means display starts */
-				/* 16 pixels later but still stops at the normal point (eg we display */
-				/* (320-16) pixels in low res). We shift the whole line 8 bytes to the right to */
-				/* get the correct result (using memmove, as src/dest are overlapping). */
-				else
-				{
-					if (LineBorderMask & BORDERMASK_RIGHT_OFF)
-						memmove ( pSTScreen+8 , pSTScreen , SCREENBYTES_LINE - 8 );
-					else
-						memmove ( pSTScreen+8 , pSTScreen , SCREENBYTES_LEFT + SCREENBYTES_MIDDLE - 8 );
-
-					memset ( pSTScreen , 0 , 8 );	/* first 16 pixels are color '0' */
-				}
-
 				/* On STE, when we have a 230 bytes overscan line and HWScrollCount > 0 */
 				/* we must read 6 bytes less than expected if scrolling is using prefetching ($ff8265) */
 				/* (this is not the case for the 224 bytes overscan which is a multiple of 8) */
-				if ( (LineBorderMask & BORDERMASK_LEFT_OFF) && (LineBorderMask & BORDERMASK_RIGHT_OFF) )
-				  {
-				    if ( HWScrollPrefetch == 1 )
+				if ( (LineBorderMask & BORDERMASK_LEFT_OFF) && (LineBorderMask & BORDERMASK_RIGHT_OFF)
+				  && ( HWScrollPrefetch == 1 ) )
 					pVideoRaster -= 6;		/* we don't add 8 bytes (see above), but 2 */
-				    else
-					pVideoRaster -= 0;
-				  }
-
 			}
 		}
 
+		/* Copy the bytes read by the shifter, as RAM can change before the line is converted */
+		if ( pLine )
+		{
+			if ( ReadStart > 0 )
+				ReadStart = 0;
+			pLine->RasterOffset = -ReadStart;
+			memcpy ( pData , pRasterLine + ReadStart , ReadEnd - ReadStart );
+		}
 		/* LineWidth is zero on ST. */
 		/* On STE, the Shifter skips the given amount of words. */
 		pVideoRaster += LineWidth*2;
@@ -2448,65 +3120,6 @@ static void Video_CopyScreenLineColor(void)
 			LineWidth = NewLineWidth;
 			NewLineWidth = -1;
 		}
-
-
-		/* Handle 4 pixels hardware scrolling ('ST Cnx' demo in 'Punish Your Machine') */
-		/* as well as scrolling occurring when removing the left border. */
-		/* If >0, shift the line by STF_PixelScroll pixels to the right */
-		/* If <0, shift the line by -STF_PixelScroll pixels to the left */
-		/* This should be handled after the STE's hardware scrolling as it will scroll */
-		/* the whole displayed area (while the STE scrolls pixels inside the displayed area) */
-		if ( STF_PixelScroll > 0 )
-		{
-			Uint16 *pScreenLineEnd;
-			int count;
-
-			pScreenLineEnd = (Uint16 *) ( pSTScreen + SCREENBYTES_LINE - 2 );
-			if ( LineRes == 0 )			/* low res */
-			{
-				for ( count = 0 ; count < ( SCREENBYTES_LINE - 8 ) / 2 ; count++ , pScreenLineEnd-- )
-					do_put_mem_word ( pScreenLineEnd , ( ( do_get_mem_word ( pScreenLineEnd - 4 ) << 16 ) | ( do_get_mem_word ( pScreenLineEnd ) ) ) >> STF_PixelScroll );
-				/* Handle the first 16 pixels of the line (add color 0 pixels to the extreme left) */
-				do_put_mem_word ( pScreenLineEnd-0 , ( do_get_mem_word ( pScreenLineEnd-0 ) >> STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineEnd-1 , ( do_get_mem_word ( pScreenLineEnd-1 ) >> STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineEnd-2 , ( do_get_mem_word ( pScreenLineEnd-2 ) >> STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineEnd-3 , ( do_get_mem_word ( pScreenLineEnd-3 ) >> STF_PixelScroll ) );
-			}
-			else					/* med res */
-			{
-				for ( count = 0 ; count < ( SCREENBYTES_LINE - 4 ) / 2 ; count++ , pScreenLineEnd-- )
-					do_put_mem_word ( pScreenLineEnd , ( ( do_get_mem_word ( pScreenLineEnd - 2 ) << 16 ) | ( do_get_mem_word ( pScreenLineEnd ) ) ) >> STF_PixelScroll );
-				/* Handle the first 16 pixels of the line (add color 0 pixels to the extreme left) */
-				do_put_mem_word ( pScreenLineEnd-0 , ( do_get_mem_word ( pScreenLineEnd-0 ) >> STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineEnd-1 , ( do_get_mem_word ( pScreenLineEnd-1 ) >> STF_PixelScroll ) );
-			}
-		}
-		else if ( STF_PixelScroll < 0 )
-		{
-			Uint16 *pScreenLineStart;
-			int count;
-
-			STF_PixelScroll = -STF_PixelScroll;
-			pScreenLineStart = (Uint16 *)pSTScreen;
-			if ( LineRes == 0 )			/* low res */
-			{
-				for ( count = 0 ; count < ( SCREENBYTES_LINE - 8 ) / 2 ; count++ , pScreenLineStart++ )
-					do_put_mem_word ( pScreenLineStart , ( ( do_get_mem_word ( pScreenLineStart ) << STF_PixelScroll ) | ( do_get_mem_word ( pScreenLineStart + 4 ) >> (16-STF_PixelScroll) ) ) );
-				/* Handle the last 16 pixels of the line (add color 0 pixels to the extreme right) */
-				do_put_mem_word ( pScreenLineStart+0 , ( do_get_mem_word ( pScreenLineStart+0 ) << STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineStart+1 , ( do_get_mem_word ( pScreenLineStart+1 ) << STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineStart+2 , ( do_get_mem_word ( pScreenLineStart+2 ) << STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineStart+3 , ( do_get_mem_word ( pScreenLineStart+3 ) << STF_PixelScroll ) );
-			}
-			else					/* med res */
-			{
-				for ( count = 0 ; count < ( SCREENBYTES_LINE - 4 ) / 2 ; count++ , pScreenLineStart++ )
-					do_put_mem_word ( pScreenLineStart , ( ( do_get_mem_word ( pScreenLineStart ) << STF_PixelScroll ) | ( do_get_mem_word ( pScreenLineStart + 2 ) >> (16-STF_PixelScroll) ) ) );
-				/* Handle the last 16 pixels of the line (add color 0 pixels to the extreme right) */
-				do_put_mem_word ( pScreenLineStart+0 , ( do_get_mem_word ( pScreenLineStart+0 ) << STF_PixelScroll ) );
-				do_put_mem_word ( pScreenLineStart+1 , ( do_get_mem_word ( pScreenLineStart+1 ) << STF_PixelScroll ) );
-			}
-		}
 	}
 
 	/* Each screen line copied to buffer is always same length */
@@ -2518,6 +3131,22 @@ static void Video_CopyScreenLineColor(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert all the color lines recorded by Video_CopyScreenLineColor
+ * since the last call into the screen buffer.
+ */
+static void Video_ConvertScreenLines(void)
+{
+	int i;
+
+	for ( i = 0 ; i < nVideoLines ; i++ )
+		Video_ConvertScreenLineColor ( &VideoLines[ i ] , VideoLinesData[ i ] );
+
+	nVideoLines = 0;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Copy extended GEM resolution screen
@@ -2590,10 +3219,20 @@ static void Video_SetHBLPaletteMaskPointers(void)
 static void Video_ResetShifterTimings(void)
 {
 	Uint8 nSyncByte;
+	int nNewRefreshRate;
 
 	nSyncByte = IoMem_ReadByte(0xff820a);
 
 	if ((IoMem_ReadByte(0xff8260) & 3) == 2)
+		nNewRefreshRate = 71;
+	else
+		nNewRefreshRate = (nSyncByte & 2) ? 50 : 60;
+
+	/* The IKBD clock counts the frames elapsed so far with the old VBL duration */
+	if (nNewRefreshRate != nScreenRefreshRate)
+		IKBD_UpdateClock();
+
+	if (nNewRefreshRate == 71)
 	{
 		/* 71 Hz, monochrome */
 		nScreenRefreshRate = 71;
@@ -2603,7 +3242,7 @@ static void Video_ResetShifterTimings(void)
 		nFirstVisibleHbl = FIRST_VISIBLE_HBL_71HZ;
 		nLastVisibleHbl = FIRST_VISIBLE_HBL_71HZ + VIDEO_HEIGHT_HBL_MONO;
 	}
-	else if (nSyncByte & 2)  /* Check if running in 50 Hz or in 60 Hz */
+	else if (nNewRefreshRate == 50)
 	{
 		/* 50 Hz */
 		nScreenRefreshRate = 50;
@@ -2638,6 +3277,8 @@ static void Video_ResetShifterTimings(void)
 	LastCycleScroll8265 = -1;
 
 	TimerBEventCountCycleStart = -1;		/* reset timer B activation cycle for this VBL */
+	TimerBEventLine = -1;
+	TimerBCountedLine = -1;
 
 	BlankLines = 0;
 }
@@ -2659,6 +3300,7 @@ static void Video_InitShifterLines ( void )
 	}
 
 	ShifterFrame.ShifterLines[0].StartCycle = 0;			/* 1st HBL starts at cycle 0 */
+	Video_SetLineStartCycles ();
 }
 
 
@@ -2671,6 +3313,7 @@ static void Video_ClearOnVBL(void)
 	/* New screen, so first HBL */
 	nHBL = 0;
 	OverscanMode = OVERSCANMODE_NONE;
+	bHblBatchBroken = false;
 
 	Video_ResetShifterTimings();
 
@@ -2683,6 +3326,7 @@ static void Video_ClearOnVBL(void)
 	}
 	pVideoRaster = &STRam[VideoBase];
 	pSTScreen = pFrameBuffer->pSTScreen;
+	nVideoLines = 0;
 
 	Video_SetScreenRasters();
 	Video_InitShifterLines();
@@ -2715,7 +3359,21 @@ void Video_GetTTRes(int *width, int *height, int *bpp)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Convert TT palette to SDL palette
+ * Mark TT palette entries 'first' to 'last' as needing conversion to SDL
+ */
+static void Video_SetTTColorsChanged(int first, int last)
+{
+	if (last > 255)
+		last = 255;
+	for (; first <= last; first++)
+		TTColorsChanged[first >> 5] |= 1u << (first & 31);
+	bTTColorsSync = false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert changed TT palette entries to SDL palette
  */
 static void Video_UpdateTTPalette(int bpp)
 {
@@ -2743,6 +3401,7 @@ static void Video_UpdateTTPalette(int bpp)
 			dst += SIZE_WORD;
 		}
 		bTTColorsSTSync = true;
+		Video_SetTTColorsChanged(offset * 16, offset * 16 + 15);
 	}
 
 	colors = 1 << bpp;
@@ -2784,10 +3443,13 @@ static void Video_UpdateTTPalette(int bpp)
 	}
 	else
 	{
-		for (i = 0; i < colors; i++)
+		for (i = 0; i < colors; i++, ttpalette += SIZE_WORD)
 		{
-			lowbyte = IoMem_ReadByte(ttpalette++);
-			highbyte = IoMem_ReadByte(ttpalette++);
+			if (!(TTColorsChanged[i >> 5] & (1u << (i & 31))))
+				continue;
+			TTColorsChanged[i >> 5] &= ~(1u << (i & 31));
+			lowbyte = IoMem_ReadByte(ttpalette);
+			highbyte = IoMem_ReadByte(ttpalette + 1);
 			r = (lowbyte  & 0x0f) << 4;
 			g = (highbyte & 0xf0);
 			b = (highbyte & 0x0f) << 4;
@@ -2820,8 +3482,10 @@ bool Video_RenderTTScreen(void)
 	{
 		HostScreen_setWindowSize(width, height, 8);
 		nPrevTTRes = TTRes;
-		if (bpp == 1)   /* Assert that mono palette will be used in mono mode */
-			bTTColorsSync = false;
+		/* Assert that mono palette will be used in mono mode,
+		 * and that palette overwritten by it isn't used in others
+		 */
+		Video_SetTTColorsChanged(0, 255);
 	}
 
 	/* colors need synching? */
@@ -2831,6 +3495,7 @@ bool Video_RenderTTScreen(void)
 	}
 	else if (TTSpecialVideoMode != nPrevTTSpecialVideoMode)
 	{
+		Video_SetTTColorsChanged(0, 255);
 		Video_UpdateTTPalette(bpp);
 		nPrevTTSpecialVideoMode = TTSpecialVideoMode;
 	}
@@ -2848,6 +3513,16 @@ bool Video_RenderTTScreen(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the current frame will not be drawn at the next VBL
+ */
+static bool Video_FrameIsSkipped(void)
+{
+	return nVBLs % (nFrameSkips+1) || bSkipNextFrame;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Draw screen (either with ST/STE shifter drawing functions or with
@@ -2856,8 +3531,13 @@ bool Video_RenderTTScreen(void)
 static void Video_DrawScreen(void)
 {
 	/* Skip frame if need to */
-	if (nVBLs % (nFrameSkips+1))
+	if (Video_FrameIsSkipped())
+	{
+		Metrics_Count(METRICS_FRAME_SKIPPED);
 		return;
+	}
+
+	PERFCOUNT_BEGIN(PERFCOUNT_VIDEO, nPerfPrev);
 
 	/* Use extended VDI resolution?
 	 * If so, just copy whole screen on VBL rather than per HBL */
@@ -2865,7 +3545,11 @@ static void Video_DrawScreen(void)
 		Video_CopyVDIScreen();
 
 	/* Now draw the screen! */
-	if (ConfigureParams.System.nMachineType == MACHINE_FALCON && !bUseVDIRes)
+	if (!Screen_FrameWanted())
+	{
+		/* headless, nothing to show */
+	}
+	else if (ConfigureParams.System.nMachineType == MACHINE_FALCON && !bUseVDIRes)
 	{
 		VIDEL_renderScreen();
 	}
@@ -2878,11 +3562,15 @@ static void Video_DrawScreen(void)
 		/* Before drawing the screen, ensure all unused lines are cleared to color 0 */
 		/* (this can happen in 60 Hz when hatari is displaying the screen's border) */
 		/* pSTScreen was set during Video_CopyScreenLineColor */
+		Video_ConvertScreenLines();
 		if (!bUseVDIRes && nHBL < nLastVisibleHbl)
 			memset(pSTScreen, 0, SCREENBYTES_LINE * ( nLastVisibleHbl - nHBL ) );
 
 		Screen_Draw();
 	}
+	Screen_HashFrame();
+
+	PERFCOUNT_END(nPerfPrev);
 }
 
 
@@ -2922,10 +3610,14 @@ static void Video_AddInterruptHBL ( int Pos )
 }
 
 
+/**
+ * Add or move the EndLine interrupt, only on the line where
+ * timer B's event count expires and if not counted yet.
+ */
 void Video_AddInterruptTimerB ( int Pos )
 {
 //fprintf ( stderr , "add timerb pos=%d\n" , Pos );
-	if ( !bUseVDIRes )
+	if ( !bUseVDIRes && ( TimerBEventLine == nHBL ) && ( TimerBCountedLine < nHBL ) )
 		Video_AddInterrupt ( Pos , INTERRUPT_VIDEO_ENDLINE );
 }
 
@@ -2950,16 +3642,9 @@ void Video_StartInterrupts ( int PendingCyclesOver )
 	{
 		Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
-		/* Set Timer B interrupt for line 0 */
-		Pos = Video_TimerB_GetPos ( 0 );
-		if ( Pos > FrameCycles )		/* check Pos for line 0 was not already reached */
-			Video_AddInterruptTimerB ( Pos );
-		else					/* the VBL was delayed by more than 1 HBL, add an immediate timer B */
-		{
-			LOG_TRACE(TRACE_VIDEO_VBL , "VBL %d delayed too much video_cyc=%d >= pos=%d for first timer B, add immediate timer B\n" ,
-				nVBLs , FrameCycles , Pos );
-			CycInt_AddRelativeInterrupt ( 4 , INT_CPU_CYCLE, INTERRUPT_VIDEO_ENDLINE );
-		}
+		/* Timer B's EndLine interrupt is added by the HBL handler, */
+		/* on the line where timer B's event count expires */
+		LineTimerBCycle = Video_TimerB_GetPos ( 0 );
 
 		/* Set HBL interrupt for line 0 */
 		Pos = Video_HBL_GetPos();
@@ -2969,7 +3654,7 @@ void Video_StartInterrupts ( int PendingCyclesOver )
 		{
 			LOG_TRACE(TRACE_VIDEO_VBL , "VBL %d delayed too much video_cyc=%d >= pos=%d for first HBL, add immediate HBL\n" ,
 				nVBLs , FrameCycles , Pos );
-			CycInt_AddRelativeInterrupt ( 8 , INT_CPU_CYCLE, INTERRUPT_VIDEO_HBL );		/* use 8 instead of 4 to happen after immediate timer b */
+			CycInt_AddRelativeInterrupt ( 8 , INT_CPU_CYCLE, INTERRUPT_VIDEO_HBL );
 		}
 	}
 
@@ -2997,6 +3682,12 @@ void Video_InterruptHandler_VBL ( void )
 	/* Remove this interrupt from list and re-order */
 	CycInt_AcknowledgeInterrupt();
 
+	/* Process the lines of an HBL batch ending with this VBL */
+	Video_HBL_Sync();
+
+	if (unlikely(bTimelineEnabled))
+		Timeline_EndLine(nHBL, true);
+
 	/* Increment the vbl jitter index */
 	VblJitterIndex++;
 	VblJitterIndex %= VBL_JITTER_ARRAY_SIZE;
@@ -3012,6 +3703,15 @@ void Video_InterruptHandler_VBL ( void )
 	/* Check printer status */
 	Printer_CheckIdleStatus();
 
+	/* Check for received RS232 bytes */
+	RS232_Update();
+
+	/* Flush files written through GEMDOS HD emulation */
+	GemDOS_FlushFiles();
+
+	/* Raise or restore the CPU clock for the next frame */
+	M68000_TurboUpdate();
+
 	/* Update counter for number of screen refreshes per second */
 	nVBLs++;
 	/* Set video registers for frame */
@@ -3034,12 +3734,11 @@ void Video_InterruptHandler_VBL ( void )
 	/* Act on shortcut keys */
 	ShortCut_ActKey();
 
-	/* Update the IKBD's internal clock */
-	IKBD_UpdateClockOnVBL ();
-
 	/* Record video frame is necessary */
 	if ( bRecordingAvi )
 		Avi_RecordVideoStream ();
+	/* Stream raw frame to external tools, if requested */
+	ScreenSnapShot_PipeFrame();
 
 	/* Store off PSG registers for YM file, is enabled */
 	YMFormat_UpdateRecording();
@@ -3377,7 +4076,7 @@ void Video_ColorReg_ReadWord(void)
 	if ( (ConfigureParams.System.nMachineType == MACHINE_ST)
 	  && ( M68000_GetPC() < 0x400000 ) )				/* PC in RAM < 4MB */
 	{
-		col = ( col & 0x777 ) | ( rand() & 0x888 );
+		col = ( col & 0x777 ) | ( Utils_Rand() & 0x888 );
 		IoMem_WriteWord ( addr , col );
 	}
 
@@ -3779,7 +4478,8 @@ void Video_TTShiftMode_WriteWord(void)
  */
 void Video_TTColorRegs_WriteWord(void)
 {
-	bTTColorsSync = false;
+	Video_SetTTColorsChanged((IoAccessCurrentAddress - 0xff8400) >> 1,
+	                         (IoAccessBaseAddress + nIoMemAccessSize - 1 - 0xff8400) >> 1);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -42,6 +42,7 @@ const char WAVFormat_fileid[] = "Hatari wavFormat.c : " __DATE__ " " __TIME__;
 #include "configuration.h"
 #include "file.h"
 #include "log.h"
+#include "recWriter.h"
 #include "sound.h"
 #include "wavFormat.h"
 
@@ -138,6 +139,10 @@ void WAVFormat_CloseFile(void)
 
 		bRecordingWav = false;
 
+		/* Wait until all samples are written */
+		if (!RecWriter_Flush(WavFileHndl))
+			perror("WAVFormat_CloseFile");
+
 		/* Update headers with sizes */
 		nWavFileBytes = SDL_SwapLE32((12+24+8+nWavOutputBytes)-8);  /* File length, less 8 bytes for 'RIFF' and length */
 		fseek(WavFileHndl, 4, SEEK_SET);                            /* 'Total Length Of Package' element */
@@ -173,19 +178,24 @@ void WAVFormat_CloseFile(void)
  */
 void WAVFormat_Update(Sint16 pSamples[][2], int Index, int Length)
 {
-	Sint16 sample[2];
-	int i;
+	Sint16 samples[1024][2];
+	int i, n, done;
 
 	if (bRecordingWav)
 	{
-		/* Output, better if did in two section if wrap */
-		for(i = 0; i < Length; i++)
+		for (done = 0; done < Length; done += n)
 		{
-			/* Convert sample to little endian */
-			sample[0] = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][0]);
-			sample[1] = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][1]);
-			/* And store */
-			if (fwrite(&sample, sizeof(sample), 1, WavFileHndl) != 1)
+			n = Length - done;
+			if (n > 1024)
+				n = 1024;
+			for (i = 0; i < n; i++)
+			{
+				/* Convert sample to little endian */
+				samples[i][0] = SDL_SwapLE16(pSamples[(Index+done+i)%MIXBUFFER_SIZE][0]);
+				samples[i][1] = SDL_SwapLE16(pSamples[(Index+done+i)%MIXBUFFER_SIZE][1]);
+			}
+			/* And queue for the writer */
+			if (!RecWriter_Write(WavFileHndl, samples, n * sizeof(samples[0])))
 			{
 				perror("WAVFormat_Update");
 				WAVFormat_CloseFile();
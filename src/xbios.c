@@ -64,7 +64,6 @@ static const int BaudRates[] =
 };
 
 
-#if ENABLE_TRACING
 /**
  * XBIOS Floppy Read
  * Call 8
@@ -84,8 +83,13 @@ static bool XBios_Floprd(Uint32 Params)
 
 	LOG_TRACE(TRACE_OS_XBIOS, "XBIOS 0x08 Floprd(0x%x, %d, %d, %d, %d, %d) at PC 0x%X for: %s\n",
 		  pBuffer, Dev, Sector, Track, Side, Count,
-		  M68000_GetPC(), EmulationDrives[Dev].sFileName);
-	return false;
+		  M68000_GetPC(), Dev < MAX_FLOPPYDRIVES ? EmulationDrives[Dev].sFileName : "-");
+
+	/* Read the sectors directly from the image? */
+	if (!Floppy_AccessSectorsHLE(Dev, false, pBuffer, Sector, Track, Side, Count))
+		return false;
+	Regs[REG_D0] = 0;
+	return true;
 }
 
 
@@ -108,11 +112,17 @@ static bool XBios_Flopwr(Uint32 Params)
 
 	LOG_TRACE(TRACE_OS_XBIOS, "XBIOS 0x09 Flopwr(0x%x, %d, %d, %d, %d, %d) at PC 0x%X for: %s\n",
 		  pBuffer, Dev, Sector, Track, Side, Count,
-		  M68000_GetPC(), EmulationDrives[Dev].sFileName);
-	return false;
+		  M68000_GetPC(), Dev < MAX_FLOPPYDRIVES ? EmulationDrives[Dev].sFileName : "-");
+
+	/* Write the sectors directly to the image? */
+	if (!Floppy_AccessSectorsHLE(Dev, true, pBuffer, Sector, Track, Side, Count))
+		return false;
+	Regs[REG_D0] = 0;
+	return true;
 }
 
 
+#if ENABLE_TRACING
 /**
  * XBIOS Devconnect
  * Call 139
@@ -135,8 +145,6 @@ static bool XBios_Devconnect(Uint32 Params)
 }
 
 #else /* !ENABLE_TRACING */
-#define XBios_Floprd(params)     false
-#define XBios_Flopwr(params)     false
 #define XBios_Devconnect(params) false
 #endif
 
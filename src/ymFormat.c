@@ -178,6 +178,9 @@ void YMFormat_UpdateRecording(void)
 	/* Can record this VBL information? */
 	if (bRecordingYM)
 	{
+		/* Do queued register writes of this VBL */
+		Sound_Update(false);
+
 		/* Copy VBL registers to workspace */
 		for(i=0; i<(NUM_PSG_SOUND_REGISTERS-1); i++)
 			*pYMData++ = SoundRegs[i];
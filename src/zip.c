@@ -13,6 +13,7 @@ const char ZIP_fileid[] = "Hatari zip.c : " __DATE__ " " __TIME__;
 #include <unistd.h>
 #include <dirent.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <zlib.h>
 
 #include "main.h"
@@ -36,6 +37,7 @@ const char ZIP_fileid[] = "Hatari zip.c : " __DATE__ " " __TIME__;
 /* #define SAVE_TO_ZIP_IMAGES */
 
 #define ZIP_PATH_MAX  256
+#define ZIP_CACHE_SIZE  8	/* Number of archive directories kept in memory */
 
 #if HAVE_LIBZ
 
@@ -53,6 +55,27 @@ static const char * const pszDiskNameExts[] =
 };
 
 
+/* Parsed central directory of an archive, so that browsing an archive or
+ * loading a disk from it does not need to scan the directory each time.
+ * An entry is valid as long as the archive modification time and size
+ * do not change. */
+typedef struct
+{
+	char *path;			/* Archive file name, NULL if entry is unused */
+	time_t mtime;
+	off_t size;
+	unsigned int lastuse;
+	int nfiles;
+	char **names;
+	uLong *sizes;			/* Uncompressed size of each file */
+	time_t *mtimes;			/* Modification time of each file */
+	unz_file_pos *pos;		/* Position of each file in the central directory */
+} zip_cache_entry;
+
+static zip_cache_entry ZipCache[ZIP_CACHE_SIZE];
+static unsigned int nZipCacheUse;
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Does filename end with a .ZIP extension? If so, return true.
@@ -83,90 +106,199 @@ static int Zip_FileNameHasSlash(const char *fn)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Returns a list of files from a zip file. returns NULL on failure,
- * returns a pointer to an array of strings if successful. Sets nfiles
- * to the number of files.
+ * Free the directory stored in a cache entry.
  */
-zip_dir *ZIP_GetFiles(const char *pszFileName)
+static void ZIP_FreeCacheEntry(zip_cache_entry *ce)
+{
+	int i;
+
+	for (i = 0; i < ce->nfiles; i++)
+		free(ce->names[i]);
+	free(ce->names);
+	free(ce->sizes);
+	free(ce->mtimes);
+	free(ce->pos);
+	free(ce->path);
+	memset(ce, 0, sizeof(*ce));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the whole central directory of a zip file into a cache entry,
+ * in a single pass. Return false on failure.
+ */
+static bool ZIP_ScanArchive(zip_cache_entry *ce, const char *pszFileName)
 {
-	int nfiles;
-	unsigned int i;
 	unz_global_info gi;
-	int err;
-	unzFile uf;
-	char **filelist;
 	unz_file_info file_info;
 	char filename_inzip[ZIP_PATH_MAX];
-	zip_dir *zd;
+	struct tm tm;
+	unzFile uf;
+	int i;
 
 	uf = unzOpen(pszFileName);
 	if (uf == NULL)
 	{
 		Log_Printf(LOG_ERROR, "ZIP_GetFiles: Cannot open %s\n", pszFileName);
-		return NULL;
+		return false;
 	}
 
-	err = unzGetGlobalInfo(uf,&gi);
-	if (err != UNZ_OK)
+	if (unzGetGlobalInfo(uf, &gi) != UNZ_OK)
 	{
-		Log_Printf(LOG_ERROR, "Error %d with zipfile in unzGetGlobalInfo \n",err);
-		return NULL;
+		Log_Printf(LOG_ERROR, "Error with zipfile in unzGetGlobalInfo\n");
+		unzClose(uf);
+		return false;
 	}
 
-	/* allocate a file list */
-	filelist = (char **)malloc(gi.number_entry*sizeof(char *));
-	if (!filelist)
+	ce->names = calloc(gi.number_entry + 1, sizeof(char *));
+	ce->sizes = malloc((gi.number_entry + 1) * sizeof(uLong));
+	ce->mtimes = malloc((gi.number_entry + 1) * sizeof(time_t));
+	ce->pos = malloc((gi.number_entry + 1) * sizeof(unz_file_pos));
+	if (!ce->names || !ce->sizes || !ce->mtimes || !ce->pos)
 	{
-		perror("ZIP_GetFiles");
-		return NULL;
+		perror("ZIP_ScanArchive");
+		unzClose(uf);
+		return false;
 	}
 
-	nfiles = gi.number_entry;  /* set the number of files */
-
-	for (i = 0; i < gi.number_entry; i++)
+	for (i = 0; i < (int)gi.number_entry; i++)
 	{
-		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, ZIP_PATH_MAX, NULL, 0, NULL, 0);
-		if (err != UNZ_OK)
+		if (unzGetCurrentFileInfo(uf, &file_info, filename_inzip, ZIP_PATH_MAX, NULL, 0, NULL, 0) != UNZ_OK
+		    || unzGetFilePos(uf, &ce->pos[i]) != UNZ_OK)
 		{
-			free(filelist);
-			return NULL;
+			Log_Printf(LOG_ERROR, "ZIP_GetFiles: Error in ZIP-file\n");
+			unzClose(uf);
+			return false;
 		}
-
-		filelist[i] = (char *)malloc(strlen(filename_inzip) + 1);
-		if (!filelist[i])
+		ce->names[i] = strdup(filename_inzip);
+		if (!ce->names[i])
 		{
-			perror("ZIP_GetFiles");
-			free(filelist);
-			return NULL;
+			perror("ZIP_ScanArchive");
+			unzClose(uf);
+			return false;
+		}
+		ce->sizes[i] = file_info.uncompressed_size;
+		memset(&tm, 0, sizeof(tm));
+		tm.tm_sec = file_info.tmu_date.tm_sec;
+		tm.tm_min = file_info.tmu_date.tm_min;
+		tm.tm_hour = file_info.tmu_date.tm_hour;
+		tm.tm_mday = file_info.tmu_date.tm_mday;
+		tm.tm_mon = file_info.tmu_date.tm_mon;
+		tm.tm_year = file_info.tmu_date.tm_year - 1900;
+		tm.tm_isdst = -1;
+		ce->mtimes[i] = mktime(&tm);
+		ce->nfiles++;
+
+		if ((i+1) < (int)gi.number_entry && unzGoToNextFile(uf) != UNZ_OK)
+		{
+			Log_Printf(LOG_ERROR, "ZIP_GetFiles: Error in ZIP-file\n");
+			unzClose(uf);
+			return false;
 		}
+	}
+
+	unzClose(uf);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the cached directory of a zip file, scanning the archive only if
+ * it is not cached yet or has changed since. Returns NULL on failure.
+ */
+static zip_cache_entry *ZIP_GetCacheEntry(const char *pszFileName)
+{
+	struct stat st;
+	zip_cache_entry *ce = NULL;
+	int i;
+
+	if (stat(pszFileName, &st) != 0)
+	{
+		Log_Printf(LOG_ERROR, "ZIP_GetFiles: Cannot open %s\n", pszFileName);
+		return NULL;
+	}
 
-		strcpy(filelist[i], filename_inzip);
-		if ((i+1) < gi.number_entry)
+	for (i = 0; i < ZIP_CACHE_SIZE; i++)
+	{
+		if (ZipCache[i].path && strcmp(ZipCache[i].path, pszFileName) == 0)
 		{
-			err = unzGoToNextFile(uf);
-			if (err != UNZ_OK)
+			ce = &ZipCache[i];
+			if (ce->mtime == st.st_mtime && ce->size == st.st_size)
 			{
-				Log_Printf(LOG_ERROR, "ZIP_GetFiles: Error in ZIP-file\n");
-				/* deallocate memory */
-				for (; i > 0; i--)
-					free(filelist[i]);
-				free(filelist);
-				return NULL;
+				ce->lastuse = ++nZipCacheUse;
+				return ce;
 			}
+			break;
 		}
 	}
 
-	unzClose(uf);
+	/* Not cached or outdated: reuse a free or the least recently used entry */
+	if (!ce)
+	{
+		ce = &ZipCache[0];
+		for (i = 0; i < ZIP_CACHE_SIZE && ce->path; i++)
+		{
+			if (!ZipCache[i].path || ZipCache[i].lastuse < ce->lastuse)
+				ce = &ZipCache[i];
+		}
+	}
+	ZIP_FreeCacheEntry(ce);
+
+	if (!ZIP_ScanArchive(ce, pszFileName) || !(ce->path = strdup(pszFileName)))
+	{
+		ZIP_FreeCacheEntry(ce);
+		return NULL;
+	}
+	ce->mtime = st.st_mtime;
+	ce->size = st.st_size;
+	ce->lastuse = ++nZipCacheUse;
+
+	return ce;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Returns a list of files from a zip file. returns NULL on failure,
+ * returns a pointer to an array of strings if successful. Sets nfiles
+ * to the number of files.
+ */
+zip_dir *ZIP_GetFiles(const char *pszFileName)
+{
+	zip_cache_entry *ce;
+	zip_dir *zd;
+
+	ce = ZIP_GetCacheEntry(pszFileName);
+	if (!ce)
+		return NULL;
 
 	zd = (zip_dir *)malloc(sizeof(zip_dir));
 	if (!zd)
 	{
 		perror("ZIP_GetFiles");
-		free(filelist);
 		return NULL;
 	}
-	zd->names = filelist;
-	zd->nfiles = nfiles;
+	zd->names = (char **)malloc((ce->nfiles + 1) * sizeof(char *));
+	if (!zd->names)
+	{
+		perror("ZIP_GetFiles");
+		free(zd);
+		return NULL;
+	}
+
+	/* Callers own (and free) their copy of the names */
+	for (zd->nfiles = 0; zd->nfiles < ce->nfiles; zd->nfiles++)
+	{
+		zd->names[zd->nfiles] = strdup(ce->names[zd->nfiles]);
+		if (!zd->names[zd->nfiles])
+		{
+			perror("ZIP_GetFiles");
+			ZIP_FreeZipDir(zd);
+			return NULL;
+		}
+	}
 
 	return zd;
 }
@@ -332,51 +464,37 @@ struct dirent **ZIP_GetFilesDir(const zip_dir *zip, const char *dir, int *entrie
 /**
  * Check an image file in the archive, return the uncompressed length
  */
-static long ZIP_CheckImageFile(unzFile uf, char *filename, int namelen, int *pImageType)
+static long ZIP_CheckImageFile(const char *filename, uLong size, int *pImageType)
 {
-	unz_file_info file_info;
-
-	if (unzLocateFile(uf,filename, 0) != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "Error: File \"%s\" not found in the archive!\n", filename);
-		return -1;
-	}
-
-	if (unzGetCurrentFileInfo(uf, &file_info, filename, namelen, NULL, 0, NULL, 0) != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "Error with zipfile in unzGetCurrentFileInfo\n");
-		return -1;
-	}
-
 	/* check for .stx, .ipf, .msa, .dim or .st extension */
 	if (STX_FileNameIsSTX(filename, false))
 	{
 		*pImageType = FLOPPY_IMAGE_TYPE_STX;
-		return file_info.uncompressed_size;
+		return size;
 	}
 
 	if (IPF_FileNameIsIPF(filename, false))
 	{
 		*pImageType = FLOPPY_IMAGE_TYPE_IPF;
-		return file_info.uncompressed_size;
+		return size;
 	}
 
 	if (MSA_FileNameIsMSA(filename, false))
 	{
 		*pImageType = FLOPPY_IMAGE_TYPE_MSA;
-		return file_info.uncompressed_size;
+		return size;
 	}
 
 	if (ST_FileNameIsST(filename, false))
 	{
 		*pImageType = FLOPPY_IMAGE_TYPE_ST;
-		return file_info.uncompressed_size;
+		return size;
 	}
 
 	if (DIM_FileNameIsDIM(filename, false))
 	{
 		*pImageType = FLOPPY_IMAGE_TYPE_DIM;
-		return file_info.uncompressed_size;
+		return size;
 	}
 
 	Log_Printf(LOG_ERROR, "Not an .ST, .MSA, .DIM, .IPF or .STX file.\n");
@@ -385,91 +503,67 @@ static long ZIP_CheckImageFile(unzFile uf, char *filename, int namelen, int *pIm
 
 /*-----------------------------------------------------------------------*/
 /**
- * Return the first matching file in a zip, or NULL on failure.
- * String buffer size is ZIP_PATH_MAX
+ * Return the index of the first matching file in a cached zip directory,
+ * or -1 if there is none.
  */
-static char *ZIP_FirstFile(const char *filename, const char * const ppsExts[])
+static int ZIP_FirstFile(const zip_cache_entry *ce, const char * const ppsExts[])
 {
-	zip_dir *files;
 	int i, j;
-	char *name;
 
-	files = ZIP_GetFiles(filename);
-	if (files == NULL)
-		return NULL;
+	/* There was no extension given -> use the very first name */
+	if (!ppsExts)
+		return ce->nfiles > 0 ? 0 : -1;
 
-	name = malloc(ZIP_PATH_MAX);
-	if (!name)
+	for (i = 0; i < ce->nfiles; i++)
 	{
-		perror("ZIP_FirstFile");
-		ZIP_FreeZipDir(files);
-		return NULL;
-	}
-
-	/* Do we have to scan for a certain extension? */
-	if (ppsExts)
-	{
-		name[0] = '\0';
-		for(i = files->nfiles-1; i >= 0; i--)
+		for (j = 0; ppsExts[j] != NULL; j++)
 		{
-			for (j = 0; ppsExts[j] != NULL; j++)
-			{
-				if (File_DoesFileExtensionMatch(files->names[i], ppsExts[j]))
-				{
-					strncpy(name, files->names[i], ZIP_PATH_MAX);
-					break;
-				}
-			}
+			if (File_DoesFileExtensionMatch(ce->names[i], ppsExts[j]))
+				return i;
 		}
 	}
-	else
-	{
-		/* There was no extension given -> use the very first name */
-		strncpy(name, files->names[0], ZIP_PATH_MAX);
-	}
 
-	/* free the files */
-	ZIP_FreeZipDir(files);
+	return -1;
+}
+
 
-	if (name[0] == '\0')
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the index of a file in a cached zip directory, or -1 if the
+ * archive does not contain it.
+ */
+static int ZIP_FindFile(const zip_cache_entry *ce, const char *filename)
+{
+	int i;
+
+	for (i = 0; i < ce->nfiles; i++)
 	{
-		free(name);
-		return NULL;
+		if (unzStringFileNameCompare(ce->names[i], filename, 0) == 0)
+			return i;
 	}
 
-	return name;
+	return -1;
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Extract a file (filename) from a ZIP-file (uf), the number of 
+ * Extract the file at position 'pos' of a ZIP-file (uf), the number of
  * bytes to uncompress is size. Returns a pointer to a buffer containing
  * the uncompressed data, or NULL.
  */
-static void *ZIP_ExtractFile(unzFile uf, const char *filename, uLong size)
+static void *ZIP_ExtractFile(unzFile uf, const unz_file_pos *pos, uLong size)
 {
 	int err = UNZ_OK;
-	char filename_inzip[ZIP_PATH_MAX];
 	void* buf;
 	uInt size_buf;
-	unz_file_info file_info;
 
-
-	if (unzLocateFile(uf,filename, 0) != UNZ_OK)
+	if (unzGoToFilePos(uf, pos) != UNZ_OK)
 	{
 		Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not find file in archive\n");
 		return NULL;
 	}
 
-	err = unzGetCurrentFileInfo(uf,&file_info,filename_inzip,sizeof(filename_inzip),NULL,0,NULL,0);
-
-	if (err != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not get file info\n");
-		return NULL;
-	}
-
 	size_buf = size;
 	buf = malloc(size_buf);
 	if (!buf)
@@ -492,6 +586,7 @@ static void *ZIP_ExtractFile(unzFile uf, const char *filename, uLong size)
 		if (err < 0)
 		{
 			Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not read file\n");
+			free(buf);
 			return NULL;
 		}
 	}
@@ -503,19 +598,13 @@ static void *ZIP_ExtractFile(unzFile uf, const char *filename, uLong size)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Load disk image from a .ZIP archive into memory, set  the number
- * of bytes loaded into pImageSize and return the data or NULL on error.
+ * Extract file number 'idx' of a cached zip directory.
  */
-Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath, long *pImageSize, int *pImageType)
+static void *ZIP_ExtractCachedFile(const char *pszFileName, const zip_cache_entry *ce,
+                                   int idx, uLong size)
 {
-	uLong ImageSize=0;
-	unzFile uf=NULL;
-	Uint8 *buf;
-	char *path;
-	Uint8 *pDiskBuffer = NULL;
-
-	*pImageSize = 0;
-	*pImageType = FLOPPY_IMAGE_TYPE_NONE;
+	unzFile uf;
+	void *buf;
 
 	uf = unzOpen(pszFileName);
 	if (uf == NULL)
@@ -524,45 +613,53 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath,
 		return NULL;
 	}
 
+	buf = ZIP_ExtractFile(uf, &ce->pos[idx], size);
+
+	unzCloseCurrentFile(uf);
+	unzClose(uf);
+
+	return buf;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Load disk image from the archive with directory 'ce' into memory, set
+ * the number of bytes loaded into pImageSize and return the data or NULL.
+ */
+static Uint8 *ZIP_ReadDiskFromDir(const char *pszFileName, const zip_cache_entry *ce,
+                                  const char *pszZipPath, long *pImageSize, int *pImageType)
+{
+	uLong ImageSize=0;
+	Uint8 *buf;
+	int idx;
+	Uint8 *pDiskBuffer = NULL;
+
 	if (pszZipPath == NULL || pszZipPath[0] == 0)
 	{
-		path = ZIP_FirstFile(pszFileName, pszDiskNameExts);
-		if (path == NULL)
+		idx = ZIP_FirstFile(ce, pszDiskNameExts);
+		if (idx < 0)
 		{
 			Log_Printf(LOG_ERROR, "Cannot open %s\n", pszFileName);
-			unzClose(uf);
 			return NULL;
 		}
 	}
 	else
 	{
-		path = malloc(ZIP_PATH_MAX);
-		if (path == NULL)
+		idx = ZIP_FindFile(ce, pszZipPath);
+		if (idx < 0)
 		{
-			perror("ZIP_ReadDisk");
-			unzClose(uf);
+			Log_Printf(LOG_ERROR, "Error: File \"%s\" not found in the archive!\n", pszZipPath);
 			return NULL;
 		}
-		strncpy(path, pszZipPath, ZIP_PATH_MAX);
-		path[ZIP_PATH_MAX-1] = '\0';
 	}
 
-	ImageSize = ZIP_CheckImageFile(uf, path, ZIP_PATH_MAX, pImageType);
+	ImageSize = ZIP_CheckImageFile(ce->names[idx], ce->sizes[idx], pImageType);
 	if (ImageSize <= 0)
-	{
-		unzClose(uf);
-		free(path);
 		return NULL;
-	}
 
 	/* extract to buf */
-	buf = ZIP_ExtractFile(uf, path, ImageSize);
-
-	unzCloseCurrentFile(uf);
-	unzClose(uf);
-	free(path);
-	path = NULL;
-
+	buf = ZIP_ExtractCachedFile(pszFileName, ce, idx, ImageSize);
 	if (buf == NULL)
 	{
 		return NULL;  /* failed extraction, return error */
@@ -609,6 +706,54 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath,
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Load disk image from a .ZIP archive into memory, set  the number
+ * of bytes loaded into pImageSize and return the data or NULL on error.
+ */
+Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath, long *pImageSize, int *pImageType)
+{
+	zip_cache_entry *ce;
+
+	*pImageSize = 0;
+	*pImageType = FLOPPY_IMAGE_TYPE_NONE;
+
+	ce = ZIP_GetCacheEntry(pszFileName);
+	if (ce == NULL)
+	{
+		Log_Printf(LOG_ERROR, "Cannot open %s\n", pszFileName);
+		return NULL;
+	}
+
+	return ZIP_ReadDiskFromDir(pszFileName, ce, pszZipPath, pImageSize, pImageType);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Same as ZIP_ReadDisk(), but scan the archive into a private directory
+ * instead of using the shared cache, so that it can be called from
+ * another thread.
+ */
+Uint8 *ZIP_ReadDiskUncached(const char *pszFileName, const char *pszZipPath, long *pImageSize, int *pImageType)
+{
+	zip_cache_entry ce;
+	Uint8 *pDiskBuffer = NULL;
+
+	*pImageSize = 0;
+	*pImageType = FLOPPY_IMAGE_TYPE_NONE;
+
+	memset(&ce, 0, sizeof(ce));
+	if (ZIP_ScanArchive(&ce, pszFileName))
+		pDiskBuffer = ZIP_ReadDiskFromDir(pszFileName, &ce, pszZipPath, pImageSize, pImageType);
+	else
+		Log_Printf(LOG_ERROR, "Cannot open %s\n", pszFileName);
+	ZIP_FreeCacheEntry(&ce);
+
+	return pDiskBuffer;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Load first file from a .ZIP archive into memory, and return the number
@@ -616,58 +761,134 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath,
  */
 Uint8 *ZIP_ReadFirstFile(const char *pszFileName, long *pImageSize, const char * const ppszExts[])
 {
-	unzFile uf=NULL;
+	zip_cache_entry *ce;
 	Uint8 *pBuffer;
-	char *pszZipPath;
-	unz_file_info file_info;
+	int idx;
 
 	*pImageSize = 0;
 
-	/* Open the ZIP file */
-	uf = unzOpen(pszFileName);
-	if (uf == NULL)
+	/* Get the ZIP directory */
+	ce = ZIP_GetCacheEntry(pszFileName);
+	if (ce == NULL)
 	{
 		Log_Printf(LOG_ERROR, "Cannot open '%s'\n", pszFileName);
 		return NULL;
 	}
 
 	/* Locate the first file in the ZIP archive */
-	pszZipPath = ZIP_FirstFile(pszFileName, ppszExts);
-	if (pszZipPath == NULL)
+	idx = ZIP_FirstFile(ce, ppszExts);
+	if (idx < 0)
 	{
 		Log_Printf(LOG_ERROR, "Failed to locate first file in '%s'\n", pszFileName);
-		unzClose(uf);
 		return NULL;
 	}
 
-	if (unzLocateFile(uf, pszZipPath, 0) != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "Error: Can not locate '%s' in the archive!\n", pszZipPath);
-		free(pszZipPath);
-		return NULL;
-	}
+	/* Extract to buffer */
+	pBuffer = ZIP_ExtractCachedFile(pszFileName, ce, idx, ce->sizes[idx]);
+
+	if (pBuffer)
+		*pImageSize = ce->sizes[idx];
 
-	/* Get file information (file size!) */
-	if (unzGetCurrentFileInfo(uf, &file_info, pszZipPath, ZIP_PATH_MAX, NULL, 0, NULL, 0) != UNZ_OK)
+	return pBuffer;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Look up a file or directory in the archive for GEMDOS HD emulation.
+ * 'pszPath' uses '/' separators and is matched case insensitively, an
+ * empty path is the archive root. Directories don't need to have an
+ * entry of their own, files in them are enough. Sets the uncompressed
+ * size, modification time and type of the entry, and returns false if
+ * the archive doesn't contain it.
+ */
+bool ZIP_GetFileInfo(const char *pszFileName, const char *pszPath,
+                     long *pSize, time_t *pTime, bool *pbDir)
+{
+	zip_cache_entry *ce;
+	int i, len;
+
+	ce = ZIP_GetCacheEntry(pszFileName);
+	if (!ce)
+		return false;
+
+	*pSize = 0;
+	*pTime = ce->mtime;
+	*pbDir = true;
+
+	len = strlen(pszPath);
+	if (len == 0)
+		return true;
+
+	for (i = 0; i < ce->nfiles; i++)
 	{
-		Log_Printf(LOG_ERROR, "Error with zipfile in unzGetCurrentFileInfo.\n");
-		free(pszZipPath);
-		return NULL;
+		const char *name = ce->names[i];
+
+		if (strncasecmp(name, pszPath, len) != 0)
+			continue;
+		if (name[len] == '\0')
+		{
+			*pSize = ce->sizes[i];
+			*pTime = ce->mtimes[i];
+			*pbDir = false;
+			return true;
+		}
+		if (name[len] == '/')
+		{
+			if (name[len+1] == '\0')
+				*pTime = ce->mtimes[i];
+			return true;
+		}
 	}
 
-	/* Extract to buffer */
-	pBuffer = ZIP_ExtractFile(uf, pszZipPath, file_info.uncompressed_size);
+	return false;
+}
 
-	/* And close the file */
-	unzCloseCurrentFile(uf);
-	unzClose(uf);
 
-	free(pszZipPath);
+/*-----------------------------------------------------------------------*/
+/**
+ * Extract file 'pszPath' (matched like in ZIP_GetFileInfo) from the
+ * archive to host file 'pszDestFile'. Returns true if all is OK.
+ */
+bool ZIP_ExtractFileTo(const char *pszFileName, const char *pszPath, const char *pszDestFile)
+{
+	zip_cache_entry *ce;
+	void *buf = NULL;
+	FILE *fp;
+	bool bRet;
+	int i;
+
+	ce = ZIP_GetCacheEntry(pszFileName);
+	if (!ce)
+		return false;
 
-	if (pBuffer)
-		*pImageSize = file_info.uncompressed_size;
+	for (i = 0; i < ce->nfiles; i++)
+	{
+		if (strcasecmp(ce->names[i], pszPath) == 0)
+			break;
+	}
+	if (i >= ce->nfiles)
+		return false;
 
-	return pBuffer;
+	if (ce->sizes[i] > 0)
+	{
+		buf = ZIP_ExtractCachedFile(pszFileName, ce, i, ce->sizes[i]);
+		if (!buf)
+			return false;
+	}
+
+	/* not File_Save(), it would compress files with .gz extension */
+	fp = fopen(pszDestFile, "wb");
+	if (!fp)
+	{
+		free(buf);
+		return false;
+	}
+	bRet = (fwrite(buf, 1, ce->sizes[i], fp) == ce->sizes[i]);
+	bRet = (fclose(fp) == 0) && bRet;
+	free(buf);
+
+	return bRet;
 }
 
 #else
@@ -680,6 +901,10 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *name, const char *path, long *size ,
 {
 	return NULL;
 }
+Uint8 *ZIP_ReadDiskUncached(const char *name, const char *path, long *size , int *pImageType)
+{
+	return NULL;
+}
 struct dirent **ZIP_GetFilesDir(const zip_dir *zip, const char *dir, int *entries)
 {
 	return NULL;
@@ -691,6 +916,15 @@ zip_dir *ZIP_GetFiles(const char *pszFileName)
 void ZIP_FreeZipDir(zip_dir *f_zd)
 {
 }
+bool ZIP_GetFileInfo(const char *pszFileName, const char *pszPath,
+                     long *pSize, time_t *pTime, bool *pbDir)
+{
+	return false;
+}
+bool ZIP_ExtractFileTo(const char *pszFileName, const char *pszPath, const char *pszDestFile)
+{
+	return false;
+}
 
 #endif  /* HAVE_LIBZ */
 
@@ -0,0 +1,58 @@
+#!/bin/sh
+#
+# Run the benchmark cases listed in the "cases" file, show their
+# timings and compare their emulation state hashes with the reference
+# ones in results/ (or with --golden, save them there), see readme.txt.
+
+golden=0
+if [ "$1" = "--golden" ]; then
+	golden=1
+elif [ $# -ne 0 ]; then
+	echo "usage: ${0##*/} [--golden]"
+	exit 1
+fi
+
+HATARI=${HATARI:-../../build/src/hatari}
+HASH_VBLS=${HASH_VBLS:-100}
+
+if [ \! -x "$HATARI" ]; then
+	echo "ERROR: Hatari binary '$HATARI' missing!"
+	exit 1
+fi
+if [ \! -f "$TOS" ]; then
+	echo "ERROR: TOS image '$TOS' missing, set it with TOS variable!"
+	exit 1
+fi
+
+mkdir -p out results
+failed=0
+
+grep -v '^#' cases > out/cases
+while read name vbls prog opts; do
+	[ -z "$name" ] && continue
+	if [ \! -f "programs/$prog" ]; then
+		echo "SKIP: $name, program 'programs/$prog' missing"
+		continue
+	fi
+	echo "RUN: $name ($vbls VBLs)"
+	log=out/$name.log
+	$HATARI --configfile /dev/null --tos "$TOS" --rtc off --sound off \
+		$opts --benchmark "$vbls" --state-hash "$HASH_VBLS" \
+		"programs/$prog" > "$log" 2>&1
+	grep '^BENCHMARK:' "$log"
+	grep '^STATEHASH:' "$log" > "out/$name.hash"
+
+	if [ $golden -eq 1 ]; then
+		cp "out/$name.hash" "results/$name.hash"
+	elif [ \! -f "results/$name.hash" ]; then
+		echo "NOTE: no reference hashes for $name, run with --golden"
+	elif cmp -s "out/$name.hash" "results/$name.hash"; then
+		echo "OK: state hashes match"
+	else
+		echo "FAIL: state hashes differ from the reference:"
+		diff "results/$name.hash" "out/$name.hash" | head -4
+		failed=1
+	fi
+done < out/cases
+
+exit $failed
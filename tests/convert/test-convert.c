@@ -0,0 +1,269 @@
+/*
+ * Hatari - test-convert.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * Check that the vector versions of the ST screen conversion kernels
+ * in src/convert/macros.h give the same output as the scalar macros,
+ * and show how many nanoseconds each variant takes per screen line.
+ *
+ * Usage: test-convert [<screen dump> [<bytes per line>]]
+ *
+ * The screen dump is raw ST screen memory, for example saved from the
+ * Hatari debugger with "save screen.bin <video base> 32000" (or more,
+ * for overscan screens). Without it, random data is used.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <SDL_types.h>
+#include <SDL_endian.h>
+
+Uint32 STRGBPalette[16];
+
+#include "../../src/convert/macros.h"
+
+#define MAX_LINES	320
+#define MAX_LINE_BYTES	256
+#define BENCH_LOOPS	2000
+
+static Uint8 ScreenData[MAX_LINES * MAX_LINE_BYTES];
+static int nLines;
+
+/* Output of the reference and tested kernels, large enough
+ * for 640 pixel wide 32 bit lines with left+right overscan
+ */
+#define MAX_OUT_LONGS	1024
+static Uint32 RefLine[MAX_LINES][MAX_OUT_LONGS];
+static Uint32 TestLine[MAX_LINES][MAX_OUT_LONGS];
+
+
+/* ---------------------------------------------------------------------- */
+/* Scalar kernels, in the order of the src/convert/ files, for 16 pixels */
+
+/* Pixel offsets of the 4 BUILD_PIXELS steps */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+# define PIXEL_ORDER	12, 4, 8, 0
+#else
+# define PIXEL_ORDER	4, 12, 0, 8
+#endif
+
+#define LOW_SCALAR(name, type, plot, scale) \
+static void name(const Uint32 *edi, void *out) \
+{ \
+	static const int order[4] = { PIXEL_ORDER }; \
+	type *esi = out; \
+	Uint32 eax, ebx, ecx, edx; \
+	ebx = *edi; \
+	ecx = *(edi+1); \
+	LOW_BUILD_PIXELS_0 ; plot(order[0]*scale) ; \
+	LOW_BUILD_PIXELS_1 ; plot(order[1]*scale) ; \
+	LOW_BUILD_PIXELS_2 ; plot(order[2]*scale) ; \
+	LOW_BUILD_PIXELS_3 ; plot(order[3]*scale) ; \
+}
+
+#define MED_SCALAR(name, type, plot) \
+static void name(const Uint32 *edi, void *out) \
+{ \
+	static const int order[4] = { PIXEL_ORDER }; \
+	type *esi = out; \
+	Uint32 eax, ebx, ecx; \
+	ebx = *edi; \
+	MED_BUILD_PIXELS_0 ; plot(order[0]) ; \
+	MED_BUILD_PIXELS_1 ; plot(order[1]) ; \
+	MED_BUILD_PIXELS_2 ; plot(order[2]) ; \
+	MED_BUILD_PIXELS_3 ; plot(order[3]) ; \
+}
+
+LOW_SCALAR(Scalar_Low_320x16, Uint16, PLOT_LOW_320_16BIT, 1)
+LOW_SCALAR(Scalar_Low_320x32, Uint32, PLOT_LOW_320_32BIT, 1)
+LOW_SCALAR(Scalar_Low_640x16, Uint32, PLOT_LOW_640_16BIT, 1)
+LOW_SCALAR(Scalar_Low_640x32, Uint32, PLOT_LOW_640_32BIT, 2)
+MED_SCALAR(Scalar_Med_640x16, Uint16, PLOT_MED_640_16BIT)
+MED_SCALAR(Scalar_Med_640x32, Uint32, PLOT_MED_640_32BIT)
+
+#ifdef CONVERT_LOW_SIMD
+static void Simd_Low_320x16(const Uint32 *edi, void *out)
+{
+	Convert_Low_320x16Bit(edi, out);
+}
+static void Simd_Low_320x32(const Uint32 *edi, void *out)
+{
+	Convert_Low_320x32Bit(edi, out);
+}
+static void Simd_Low_640x32(const Uint32 *edi, void *out)
+{
+	Convert_Low_640x32Bit(edi, out);
+}
+#endif
+
+
+/* ---------------------------------------------------------------------- */
+
+typedef void (*kernel_t)(const Uint32 *edi, void *out);
+
+static const struct {
+	const char *name;
+	int planebytes;		/* ST bytes per 16 pixels */
+	int outbytes;		/* output bytes per 16 pixels */
+	kernel_t reference;
+	kernel_t variant;	/* NULL if there's only the scalar one */
+} Kernels[] = {
+#ifdef CONVERT_LOW_SIMD
+	{ "low 320x16", 8, 32, Scalar_Low_320x16, Simd_Low_320x16 },
+	{ "low 320x32", 8, 64, Scalar_Low_320x32, Simd_Low_320x32 },
+	{ "low 640x16", 8, 64, Scalar_Low_640x16, Simd_Low_320x32 },
+	{ "low 640x32", 8, 128, Scalar_Low_640x32, Simd_Low_640x32 },
+#else
+	{ "low 320x16", 8, 32, Scalar_Low_320x16, NULL },
+	{ "low 320x32", 8, 64, Scalar_Low_320x32, NULL },
+	{ "low 640x16", 8, 64, Scalar_Low_640x16, NULL },
+	{ "low 640x32", 8, 128, Scalar_Low_640x32, NULL },
+#endif
+	{ "med 640x16", 4, 32, Scalar_Med_640x16, NULL },
+	{ "med 640x32", 4, 64, Scalar_Med_640x32, NULL },
+};
+
+/* Normal and (left+right) overscan line widths */
+static const struct {
+	const char *name;
+	int bytes;
+} Widths[] = {
+	{ "normal", 160 },
+	{ "overscan", 224 },
+};
+
+
+static void ConvertLines(kernel_t kernel, int planebytes, int outbytes,
+                         int linebytes, Uint32 out[][MAX_OUT_LONGS])
+{
+	int y, x;
+
+	for (y = 0; y < nLines; y++)
+	{
+		const Uint8 *src = &ScreenData[y * MAX_LINE_BYTES];
+		Uint8 *dst = (Uint8 *)out[y];
+
+		for (x = 0; x < linebytes / planebytes; x++)
+			kernel((const Uint32 *)(src + x * planebytes), dst + x * outbytes);
+	}
+}
+
+static double BenchLines(kernel_t kernel, int planebytes, int outbytes, int linebytes)
+{
+	struct timespec t0, t1;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < BENCH_LOOPS; i++)
+		ConvertLines(kernel, planebytes, outbytes, linebytes, TestLine);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	       / ((double)BENCH_LOOPS * nLines);
+}
+
+static void LoadScreen(const char *filename, int linebytes)
+{
+	FILE *fp;
+	int y;
+
+	fp = fopen(filename, "rb");
+	if (!fp)
+	{
+		perror(filename);
+		exit(1);
+	}
+	for (y = 0; y < MAX_LINES; y++)
+	{
+		if (fread(&ScreenData[y * MAX_LINE_BYTES], linebytes, 1, fp) != 1)
+			break;
+	}
+	fclose(fp);
+	nLines = y;
+	if (!nLines)
+	{
+		fprintf(stderr, "%s: not even one line of %d bytes\n", filename, linebytes);
+		exit(1);
+	}
+}
+
+int main(int argc, const char *argv[])
+{
+	int linebytes = 160;
+	int failed = 0;
+	unsigned int k, w;
+	int i;
+
+	srand(1);
+	for (i = 0; i < 16; i++)
+		STRGBPalette[i] = ((Uint32)rand() << 16) ^ (Uint32)rand();
+
+	if (argc > 2)
+		linebytes = atoi(argv[2]);
+	if (linebytes < 8 || linebytes > MAX_LINE_BYTES)
+	{
+		fprintf(stderr, "Bytes per line must be 8-%d\n", MAX_LINE_BYTES);
+		return 1;
+	}
+	if (argc > 1)
+	{
+		LoadScreen(argv[1], linebytes);
+	}
+	else
+	{
+		nLines = MAX_LINES;
+		for (i = 0; i < (int)sizeof(ScreenData); i++)
+			ScreenData[i] = rand();
+	}
+	printf("%d lines of %s screen data\n", nLines, argc > 1 ? argv[1] : "random");
+#ifndef CONVERT_LOW_SIMD
+	printf("No vector kernels for this host, benchmarking scalar ones only\n");
+#endif
+
+	for (k = 0; k < sizeof(Kernels)/sizeof(Kernels[0]); k++)
+	{
+		for (w = 0; w < sizeof(Widths)/sizeof(Widths[0]); w++)
+		{
+			int width = Widths[w].bytes;
+			double ns_ref, ns_var;
+
+			/* dumped lines are shorter than overscan ones */
+			if (argc > 1 && width > linebytes)
+				continue;
+
+			ns_ref = BenchLines(Kernels[k].reference, Kernels[k].planebytes,
+			                    Kernels[k].outbytes, width);
+			if (!Kernels[k].variant)
+			{
+				printf("%s %-8s: scalar %7.1f ns/line\n",
+				       Kernels[k].name, Widths[w].name, ns_ref);
+				continue;
+			}
+
+			memset(RefLine, 0, sizeof(RefLine));
+			memset(TestLine, 0, sizeof(TestLine));
+			ConvertLines(Kernels[k].reference, Kernels[k].planebytes,
+			             Kernels[k].outbytes, width, RefLine);
+			ConvertLines(Kernels[k].variant, Kernels[k].planebytes,
+			             Kernels[k].outbytes, width, TestLine);
+			if (memcmp(RefLine, TestLine, sizeof(RefLine)) != 0)
+			{
+				printf("FAIL: %s %s output differs from the scalar one\n",
+				       Kernels[k].name, Widths[w].name);
+				failed = 1;
+			}
+
+			ns_var = BenchLines(Kernels[k].variant, Kernels[k].planebytes,
+			                    Kernels[k].outbytes, width);
+			printf("%s %-8s: scalar %7.1f ns/line, vector %7.1f ns/line\n",
+			       Kernels[k].name, Widths[w].name, ns_ref, ns_var);
+		}
+	}
+
+	if (!failed)
+		printf("OK: vector kernels match the scalar ones\n");
+	return failed;
+}
@@ -23,6 +23,7 @@ Uint32 STRamEnd = 4*1024*1024;
 /* fake memory banks */
 #include "memory.h"
 addrbank *mem_banks[65536];
+void memory_watch_bank(int bnr, bool watch) { }
 
 /* fake IO memory variables */
 #include "ioMem.h"
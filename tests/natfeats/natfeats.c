@@ -23,6 +23,7 @@ static int nf_ok;
 
 /* handles for NF features that may be used more frequently */
 static long nfid_print, nfid_debugger, nfid_fastforward;
+static long nfid_cycles, nfid_profile, nfid_memops;
 
 
 /* API documentation is in natfeats.h header */
@@ -38,6 +39,9 @@ int nf_init(void)
 		nfid_print = nf_id("NF_STDERR");
 		nfid_debugger = nf_id("NF_DEBUGGER");
 		nfid_fastforward = nf_id("NF_FASTFORWARD");
+		nfid_cycles = nf_id("NF_CYCLES");
+		nfid_profile = nf_id("NF_PROFILE");
+		nfid_memops = nf_id("NF_MEMOPS");
 	} else {
 		Cconws("Native Features initialization failed!\r\n");
 	}
@@ -74,6 +78,65 @@ long nf_fastforward(long enabled)
 	}
 }
 
+long nf_cycles(unsigned long counters[4])
+{
+	if (nfid_cycles) {
+		return nf_call(nfid_cycles, counters);
+	}
+	return 0;
+}
+
+void nf_profile_start(const char *name)
+{
+	if (nfid_profile) {
+		nf_call(nfid_profile | 0, name);
+	}
+}
+
+long nf_profile_stop(const char *name)
+{
+	if (nfid_profile) {
+		return nf_call(nfid_profile | 1, name);
+	}
+	return 0;
+}
+
+void nf_profile_show(void)
+{
+	if (nfid_profile) {
+		nf_call(nfid_profile | 2);
+	} else {
+		Cconws("NF_PROFILE unavailable!\r\n");
+	}
+}
+
+long nf_dump(const char *name, const void *addr, long size)
+{
+	long id;
+	if (nf_ok && (id = nf_id("NF_DUMP"))) {
+		return nf_call(id, name, addr, size);
+	} else {
+		Cconws("NF_DUMP unavailable!\r\n");
+		return 0;
+	}
+}
+
+void *nf_memmove(void *dst, const void *src, long size)
+{
+	if (nfid_memops) {
+		return (void *)nf_call(nfid_memops | 0, dst, src, size);
+	}
+	return 0;
+}
+
+void *nf_memset(void *dst, int value, long size)
+{
+	if (nfid_memops) {
+		return (void *)nf_call(nfid_memops | 1, dst, (long)value, size);
+	}
+	return 0;
+}
+
 void nf_shutdown(void)
 {
 	long id;
@@ -135,8 +198,11 @@ int main()
 		return 1;
 	}
 	old_ff = nf_fastforward(1);
+	nf_profile_start("nf_showname");
 	nf_print("Emulator name:\n");
 	nf_showname();
+	nf_profile_stop("nf_showname");
+	nf_profile_show();
 	nf_print("Shutting down...\n");
 	nf_fastforward(old_ff);
 	nf_exit(0);
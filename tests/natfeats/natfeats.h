@@ -55,6 +55,38 @@ extern long nf_debugger(void);
  */
 extern long nf_fastforward(long enabled);
 
+/**
+ * fill 'counters' with emulated CPU cycles and host nanoseconds
+ * (Hatari specific), 'counters' may be NULL
+ * returns lower 32 bits of emulated CPU cycles
+ */
+extern long nf_cycles(unsigned long counters[4]);
+
+/**
+ * start / stop named profiling region, statistics for
+ * all regions are shown on emulator console with nf_profile_show()
+ * (Hatari specific)
+ * nf_profile_stop() returns emulated CPU cycles since region start
+ */
+extern void nf_profile_start(const char *name);
+extern long nf_profile_stop(const char *name);
+extern void nf_profile_show(void);
+
+/**
+ * write given memory area to a host file in emulator's
+ * current directory, 'name' can't contain a path (Hatari specific)
+ * returns number of bytes written
+ */
+extern long nf_dump(const char *name, const void *addr, long size);
+
+/**
+ * copy / fill memory natively, when enabled with --natfeats-memops
+ * (Hatari specific)
+ * returns 'dst', or NULL if caller needs to do it itself
+ */
+extern void *nf_memmove(void *dst, const void *src, long size);
+extern void *nf_memset(void *dst, int value, long size);
+
 /**
  * terminate the execution of the emulation if possible
  * (runs in supervisor mode)
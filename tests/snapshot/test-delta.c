@@ -0,0 +1,113 @@
+/*
+ * Hatari - test-delta.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * Check that delta memory snapshots restore RAM to the state they were
+ * captured at, also when other (e.g. autosave) snapshots have been
+ * captured in between, and that a delta is refused on top of some other
+ * base than the one it was captured against.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "memorySnapShot.h"
+#include "stMemory.h"
+
+#define TEST_RAM_SIZE	(1024*1024)
+
+static Uint8 RefRam[TEST_RAM_SIZE];
+static int failed;
+
+static void Check(bool bOk, const char *psWhat)
+{
+	printf("%s: %s\n", bOk ? "OK" : "FAIL", psWhat);
+	if (!bOk)
+		failed = 1;
+}
+
+/* emulated writes which mark their pages changed */
+static void WriteRam(Uint32 addr, int count, Uint32 value)
+{
+	while (count-- > 0)
+	{
+		STMemory_WriteLong(addr, value++);
+		addr += 4;
+	}
+}
+
+/* writes which restores should undo */
+static void ScribbleRam(void)
+{
+	memset(STRam, 0x55, TEST_RAM_SIZE);
+	STMemory_SetDirtyArea(0, TEST_RAM_SIZE);
+}
+
+int main(int argc, const char *argv[])
+{
+	Uint8 *pBase, *pBase2, *pState, *pDelta;
+	size_t nSize, nDelta;
+	int i;
+
+	STRamEnd = TEST_RAM_SIZE;
+	srand(1);
+	for (i = 0; i < TEST_RAM_SIZE; i++)
+		STRam[i] = rand();
+	STMemory_SetDirtyArea(0, 0x1000000);
+
+	nSize = MemorySnapShot_MemorySize(true);
+	pBase = malloc(nSize);
+	pBase2 = malloc(nSize);
+	pDelta = malloc(nSize);
+	pState = malloc(MemorySnapShot_MemorySize(false));
+	if (!pBase || !pBase2 || !pDelta || !pState)
+	{
+		fprintf(stderr, "Not enough memory for the states\n");
+		return 1;
+	}
+
+	Check(MemorySnapShot_CaptureDelta(pDelta, nSize) == 0,
+	      "delta isn't captured without a base");
+
+	Check(MemorySnapShot_CaptureDeltaBase(pBase, nSize), "base captured");
+	WriteRam(0x1000, 16, 0x12345678);
+	WriteRam(0x80000, 1024, 0xdeadbeef);
+
+	/* e.g. autosave, must not change what deltas are taken against */
+	Check(MemorySnapShot_CaptureMemory(pState, MemorySnapShot_MemorySize(false), false),
+	      "full state captured between base and delta");
+	WriteRam(TEST_RAM_SIZE - 8, 2, 0xcafef00d);
+
+	memcpy(RefRam, STRam, TEST_RAM_SIZE);
+	nDelta = MemorySnapShot_CaptureDelta(pDelta, nSize);
+	Check(nDelta > 0 && nDelta < nSize / 4, "delta stores only changed pages");
+
+	ScribbleRam();
+	Check(MemorySnapShot_RestoreDelta(pBase, nSize, pDelta, nDelta), "delta restored");
+	Check(memcmp(RefRam, STRam, TEST_RAM_SIZE) == 0, "RAM matches the delta state");
+
+	/* deltas after a restore are still against the same base */
+	WriteRam(0x2000, 4, 0x55aa55aa);
+	memcpy(RefRam, STRam, TEST_RAM_SIZE);
+	nDelta = MemorySnapShot_CaptureDelta(pDelta, nSize);
+	ScribbleRam();
+	Check(MemorySnapShot_RestoreDelta(pBase, nSize, pDelta, nDelta), "second delta restored");
+	Check(memcmp(RefRam, STRam, TEST_RAM_SIZE) == 0, "RAM matches the second delta state");
+
+	Check(MemorySnapShot_CaptureDeltaBase(pBase2, nSize), "new base captured");
+	Check(!MemorySnapShot_RestoreDelta(pBase2, nSize, pDelta, nDelta),
+	      "delta refused on top of another base");
+	Check(!MemorySnapShot_RestoreDelta(pState, MemorySnapShot_MemorySize(false), pDelta, nDelta),
+	      "delta refused on top of a non-base state");
+
+	free(pBase);
+	free(pBase2);
+	free(pDelta);
+	free(pState);
+
+	if (!failed)
+		printf("OK: delta memory snapshots restore the captured RAM\n");
+	return failed;
+}
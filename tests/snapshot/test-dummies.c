@@ -0,0 +1,98 @@
+/*
+ * Dummy stuff needed to compile memory snapshot test code
+ */
+#include <stdarg.h>
+#include "main.h"
+
+/* fake logging, errors are shown so that failures can be seen */
+#include "log.h"
+void Log_Printf(LOGTYPE nType, const char *psFormat, ...)
+{
+	va_list argptr;
+
+	if (nType > LOG_WARN)
+		return;
+	va_start(argptr, psFormat);
+	vfprintf(stderr, psFormat, argptr);
+	va_end(argptr);
+}
+void Log_AlertDlg(LOGTYPE nType, const char *psFormat, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, psFormat);
+	vfprintf(stderr, psFormat, argptr);
+	va_end(argptr);
+	fputc('\n', stderr);
+}
+
+/* fake Hatari configuration variables */
+#include "configuration.h"
+CNF_PARAMS ConfigureParams;
+
+/* fake file, reset, statusbar and video functions */
+#include "file.h"
+bool File_QueryOverwrite(const char *pszFileName) { return true; }
+#include "reset.h"
+int Reset_Cold(void) { return 0; }
+#include "bootSnapshot.h"
+void BootSnapshot_Cancel(void) { }
+#include "statusbar.h"
+void Statusbar_UpdateInfo(void) { }
+#include "screen.h"
+#include "video.h"
+int nScreenRefreshRate = 50;
+void Video_HBL_Sync(void) { }
+
+/* fake IO memory */
+#include "ioMem.h"
+void IoMem_Init(void) { }
+void IoMem_UnInit(void) { }
+
+/* fake TOS and VDI variables used by memory setup */
+#include "tos.h"
+Uint32 TosAddress, TosSize;
+bool bRamTosImage;
+bool bIsEmuTOS;
+unsigned int ConnectedDriveMask;
+#include "vdi.h"
+bool bUseVDIRes;
+int VDIWidth, VDIHeight, VDIPlanes;
+
+/* fake drive variables used by memory setup */
+#include "gemdos.h"
+EMULATEDDRIVE **emudrives;
+#include "floppy.h"
+int nBootDrive;
+
+/* fake debugger snapshot */
+#include "debugui.h"
+void DebugUI_MemorySnapShot_Capture(const char *path, bool bSave) { }
+
+/* other snapshot sections, these tests need only the memory one */
+#define DUMMY_CAPTURE(name) \
+	void name##_MemorySnapShot_Capture(bool bSave); \
+	void name##_MemorySnapShot_Capture(bool bSave) { }
+DUMMY_CAPTURE(ACIA)
+DUMMY_CAPTURE(Blitter)
+DUMMY_CAPTURE(Configuration)
+DUMMY_CAPTURE(Crossbar)
+DUMMY_CAPTURE(CycInt)
+DUMMY_CAPTURE(Cycles)
+DUMMY_CAPTURE(DSP)
+DUMMY_CAPTURE(DmaSnd)
+DUMMY_CAPTURE(FDC)
+DUMMY_CAPTURE(Floppy)
+DUMMY_CAPTURE(GemDOS)
+DUMMY_CAPTURE(IKBD)
+DUMMY_CAPTURE(IPF)
+DUMMY_CAPTURE(IoMem)
+DUMMY_CAPTURE(M68000)
+DUMMY_CAPTURE(MFP)
+DUMMY_CAPTURE(PSG)
+DUMMY_CAPTURE(STX)
+DUMMY_CAPTURE(Sound)
+DUMMY_CAPTURE(TOS)
+DUMMY_CAPTURE(Utils)
+DUMMY_CAPTURE(VIDEL)
+DUMMY_CAPTURE(Video)
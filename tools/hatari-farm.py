@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+#
+# Run many headless Hatari instances in parallel for regression testing
+#
+# This file is distributed under the GNU General Public License, version 2
+# or at your option any later version. Read the file gpl.txt for details.
+"""
+Usage: hatari-farm [-j <jobs>] [-e <hatari>] [-o <results>] [-r] <job list>
+
+Runs the jobs in the given job list with headless Hatari instances,
+as many in parallel as there are host CPU cores (or given with -j),
+and outputs a result line for each job:
+  <name> <PASS|FAIL|ERROR> <seconds> <frame>:<hash>,...
+
+Job list has one job per line, empty lines and lines starting
+with '#' are ignored.  Each job line is a job name followed by
+whitespace separated key=value fields:
+  tos=<file>        TOS image
+  machine=<type>    st/ste/tt/falcon (default st)
+  disk=<file>       floppy image for drive A
+  input=<file>      input recorded with Hatari --record-input
+  frames=<count>    number of VBLs to run (required)
+  hashes=<frame>:<hash>,...  expected frame hashes at given VBLs
+  args=<arg>,...    additional Hatari options
+
+Floppy images are write protected, so the same image can be shared
+by any number of jobs.  ROM and disk image contents are shared
+between the instances through the host page cache.
+
+Options:
+  -j <jobs>     number of parallel Hatari instances
+  -e <hatari>   Hatari executable (default "hatari")
+  -o <file>     write results to <file> instead of stdout
+  -r            record: output the checkpoint hashes for given frames
+                as new 'hashes=' values, instead of comparing them
+"""
+import getopt
+import os
+import re
+import subprocess
+import sys
+import threading
+import time
+
+try:
+    import queue
+except ImportError:
+    import Queue as queue
+
+HASH_RE = re.compile(r"^Frame (\d+) hash: ([0-9a-f]+)")
+
+class Job:
+    "single Hatari run and its checkpoints"
+    def __init__(self, line, lineno):
+        fields = line.split()
+        self.name = fields[0]
+        self.tos = self.disk = self.input = None
+        self.machine = "st"
+        self.frames = 0
+        self.hashes = {}
+        self.args = []
+        for field in fields[1:]:
+            if "=" not in field:
+                raise ValueError("line %d: '%s' isn't key=value" % (lineno, field))
+            key, value = field.split("=", 1)
+            if key in ("tos", "disk", "input", "machine"):
+                setattr(self, key, value)
+            elif key == "frames":
+                self.frames = int(value)
+            elif key == "hashes":
+                for item in value.split(","):
+                    frame, digest = item.split(":")
+                    self.hashes[int(frame)] = digest.lower()
+            elif key == "args":
+                self.args = value.split(",")
+            else:
+                raise ValueError("line %d: unknown key '%s'" % (lineno, key))
+        if self.frames <= 0:
+            raise ValueError("line %d: job '%s' lacks frames" % (lineno, self.name))
+
+    def interval(self):
+        "return frame hash interval covering all checkpoints"
+        step = 0
+        for frame in self.hashes:
+            a, b = step, frame
+            while b:
+                a, b = b, a % b
+            step = a
+        return step
+
+    def command(self, hatari):
+        "return Hatari command line for the job"
+        cmd = [hatari, "--headless", "on", "--fast-forward", "on",
+               "--sound", "off", "--statusbar", "off", "--drive-led", "off",
+               "--machine", self.machine, "--run-vbls", str(self.frames),
+               "--frame-hash", str(self.interval())]
+        if self.tos:
+            cmd += ["--tos", self.tos]
+        if self.disk:
+            cmd += ["--protect-floppy", "on", "--disk-a", self.disk]
+        if self.input:
+            cmd += ["--play-input", self.input]
+        return cmd + self.args
+
+    def run(self, hatari, record):
+        "run job, return its result line"
+        start = time.time()
+        try:
+            proc = subprocess.Popen(self.command(hatari), stdout=subprocess.PIPE,
+                                    stderr=subprocess.STDOUT, universal_newlines=True)
+        except OSError as err:
+            return "%s ERROR 0.00 %s" % (self.name, err)
+        seen = {}
+        for line in proc.stdout:
+            match = HASH_RE.match(line)
+            if match:
+                seen[int(match.group(1))] = match.group(2)
+        status = proc.wait()
+        elapsed = time.time() - start
+
+        hashes = ",".join(["%d:%s" % (frame, seen.get(frame, "-"))
+                           for frame in sorted(self.hashes)])
+        if status != 0:
+            result = "ERROR"
+        elif record or all([seen.get(frame) == digest
+                            for frame, digest in self.hashes.items()]):
+            result = "PASS"
+        else:
+            result = "FAIL"
+        if record:
+            hashes = "hashes=" + hashes
+        return "%s %s %.2f %s" % (self.name, result, elapsed, hashes)
+
+
+def read_jobs(filename):
+    "parse job list file"
+    jobs = []
+    for lineno, line in enumerate(open(filename), 1):
+        line = line.strip()
+        if line and not line.startswith("#"):
+            jobs.append(Job(line, lineno))
+    return jobs
+
+
+def run_jobs(jobs, workers, hatari, record, out):
+    "run jobs in 'workers' threads, each running one Hatari process at a time"
+    todo = queue.Queue()
+    for job in jobs:
+        todo.put(job)
+    lock = threading.Lock()
+    failed = [0]
+
+    def worker():
+        while True:
+            try:
+                job = todo.get_nowait()
+            except queue.Empty:
+                return
+            result = job.run(hatari, record)
+            with lock:
+                out.write(result + "\n")
+                out.flush()
+                if " PASS " not in result:
+                    failed[0] += 1
+
+    threads = [threading.Thread(target=worker) for i in range(workers)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return failed[0]
+
+
+def cpu_count():
+    "return number of host CPU cores"
+    try:
+        import multiprocessing
+        return multiprocessing.cpu_count()
+    except (ImportError, NotImplementedError):
+        return 1
+
+
+def main(argv):
+    "parse options and run the job list"
+    try:
+        opts, args = getopt.getopt(argv[1:], "hj:e:o:r")
+    except getopt.GetoptError as err:
+        sys.stderr.write("ERROR: %s\n%s" % (err, __doc__))
+        return 1
+    workers = cpu_count()
+    hatari = "hatari"
+    out = sys.stdout
+    record = False
+    for opt, arg in opts:
+        if opt == "-h":
+            sys.stdout.write(__doc__)
+            return 0
+        elif opt == "-j":
+            workers = max(1, int(arg))
+        elif opt == "-e":
+            hatari = arg
+        elif opt == "-o":
+            out = open(arg, "w")
+        elif opt == "-r":
+            record = True
+    if len(args) != 1:
+        sys.stderr.write(__doc__)
+        return 1
+
+    jobs = read_jobs(args[0])
+    start = time.time()
+    failed = run_jobs(jobs, min(workers, len(jobs)), hatari, record, out)
+    sys.stderr.write("%d jobs, %d failed, %.2f seconds\n"
+                     % (len(jobs), failed, time.time() - start))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
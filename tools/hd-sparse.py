@@ -0,0 +1,147 @@
+#!/usr/bin/env python
+#
+# Convert hard disk images between the raw and the Hatari sparse format
+#
+# This file is distributed under the GNU General Public License, version 2
+# or at your option any later version. Read the file gpl.txt for details.
+"""
+Usage: hd-sparse [-r] [-c <KiB>] <input image> <output image>
+
+Converts a raw hard disk image to a sparse (compressed) one that Hatari
+can use for ACSI and IDE emulation. Input can also be a sparse image,
+which is then stored again without the space left by rewritten clusters.
+
+Options:
+  -r        write a raw image instead
+  -c <KiB>  cluster size for sparse images (default 64)
+"""
+import getopt
+import struct
+import sys
+import zlib
+
+MAGIC = b"HATARISP"
+VERSION = 1
+SECTOR = 512
+
+def align(value):
+    return (value + SECTOR - 1) // SECTOR * SECTOR
+
+class SparseReader:
+    "read clusters of a sparse image"
+    def __init__(self, f):
+        self.f = f
+        header = f.read(28)
+        (version, self.csize, self.sectors, self.count, idx) = struct.unpack(">5I", header[8:])
+        if version != VERSION:
+            raise ValueError("unsupported sparse image version %d" % version)
+        f.seek(idx)
+        data = f.read(self.count * 8)
+        self.index = [struct.unpack(">2I", data[i*8:i*8+8]) for i in range(self.count)]
+
+    def size(self):
+        return self.sectors * SECTOR
+
+    def clusters(self, csize):
+        "return image contents in 'csize' byte pieces"
+        data = b""
+        left = self.size()
+        for (offset, length) in self.index:
+            if offset == 0:
+                cluster = bytes(self.csize)
+            else:
+                self.f.seek(offset * SECTOR)
+                cluster = self.f.read(length)
+                if length < self.csize:
+                    cluster = zlib.decompress(cluster)
+            data += cluster
+            while left > 0 and len(data) >= min(csize, left):
+                n = min(csize, left)
+                piece, data = data[:n], data[n:]
+                left -= n
+                yield piece
+
+class RawReader:
+    "read clusters of a raw image"
+    def __init__(self, f):
+        self.f = f
+        f.seek(0, 2)
+        self.bytes = f.tell()
+        f.seek(0)
+        if self.bytes % SECTOR:
+            raise ValueError("raw image size is not a multiple of %d" % SECTOR)
+
+    def size(self):
+        return self.bytes
+
+    def clusters(self, csize):
+        while True:
+            data = self.f.read(csize)
+            if not data:
+                break
+            yield data
+
+def write_sparse(reader, out, csize):
+    size = reader.size()
+    count = (size + csize - 1) // csize
+    idx = SECTOR
+    out.write(MAGIC + struct.pack(">5I", VERSION, csize, size // SECTOR, count, idx))
+    pos = align(idx + count * 8)
+    index = []
+    for cluster in reader.clusters(csize):
+        cluster = cluster.ljust(csize, b"\0")
+        if not cluster.strip(b"\0"):
+            index.append((0, 0))
+            continue
+        packed = zlib.compress(cluster, 9)
+        if len(packed) >= csize:
+            packed = cluster
+        out.seek(pos)
+        out.write(packed)
+        index.append((pos // SECTOR, len(packed)))
+        pos = align(pos + len(packed))
+    out.seek(idx)
+    for entry in index:
+        out.write(struct.pack(">2I", *entry))
+    # pad the file to whole sectors
+    out.truncate(pos)
+
+def write_raw(reader, out):
+    for cluster in reader.clusters(1024*1024):
+        out.write(cluster)
+
+def main(argv):
+    raw = False
+    csize = 64 * 1024
+    try:
+        opts, args = getopt.getopt(argv[1:], "rc:h")
+    except getopt.GetoptError as err:
+        sys.stderr.write("ERROR: %s\n%s" % (err, __doc__))
+        return 1
+    for opt, arg in opts:
+        if opt == "-r":
+            raw = True
+        elif opt == "-c":
+            csize = int(arg) * 1024
+        else:
+            sys.stderr.write(__doc__)
+            return 0
+    if len(args) != 2 or csize <= 0:
+        sys.stderr.write(__doc__)
+        return 1
+
+    with open(args[0], "rb") as f:
+        if f.read(len(MAGIC)) == MAGIC:
+            f.seek(0)
+            reader = SparseReader(f)
+        else:
+            reader = RawReader(f)
+        with open(args[1], "wb") as out:
+            if raw:
+                write_raw(reader, out)
+            else:
+                write_sparse(reader, out, csize)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+#
+# Decode Hatari binary trace files (--trace-bin-file option output)
+#
+# This file is distributed under the GNU General Public License, version 2
+# or at your option any later version. Read the file gpl.txt for details.
+"""
+Usage: trace-decode [-j] [-m <MHz>] <trace file>
+
+Prints the records of a Hatari binary trace file as text, or with
+the -j option, converts them to Chrome/Perfetto trace event JSON
+(which can be viewed with "chrome://tracing" or ui.perfetto.dev).
+
+Options:
+  -j, --json   output trace event JSON instead of text
+  -m <MHz>     CPU clock used for JSON timestamps (default 8)
+"""
+import getopt
+import json
+import struct
+import sys
+
+MAGIC = b"HATARITR"
+VERSION = 1
+RECORD = struct.Struct(">BBxxIQII")
+
+TYPES = {1: "cpu", 2: "io_read", 3: "io_write"}
+SIZES = {1: "b", 2: "w", 4: "l"}
+
+def records(f):
+    "yield (type, size, pc, cycles, address, value) tuples"
+    header = f.read(16)
+    if header[:8] != MAGIC:
+        raise ValueError("not a Hatari binary trace file")
+    (version, size) = struct.unpack(">2I", header[8:])
+    if version != VERSION or size != RECORD.size:
+        raise ValueError("unsupported trace file version %d" % version)
+    while True:
+        data = f.read(size * 4096)
+        for i in range(len(data) // size):
+            yield RECORD.unpack_from(data, i * size)
+        if len(data) < size * 4096:
+            break
+
+def print_text(f, out):
+    for (rtype, size, pc, cycles, addr, value) in records(f):
+        name = TYPES.get(rtype, "type%d" % rtype)
+        if rtype == 1:
+            out.write("%12d pc=%06x opcode=%04x\n" % (cycles, pc, value))
+        else:
+            digits = 2 * size
+            out.write("%12d pc=%06x %s.%s $%06x = $%0*x\n" % (
+                cycles, pc, name, SIZES.get(size, "?"), addr, digits, value))
+
+def print_json(f, out, mhz):
+    out.write('{"traceEvents": [\n')
+    sep = ""
+    for (rtype, size, pc, cycles, addr, value) in records(f):
+        name = TYPES.get(rtype, "type%d" % rtype)
+        if rtype == 1:
+            args = {"pc": "%06x" % pc, "opcode": "%04x" % value}
+            event = {"name": "pc=%06x" % pc, "cat": name, "tid": 1}
+        else:
+            args = {"pc": "%06x" % pc, "value": "%0*x" % (2 * size, value)}
+            event = {"name": "%s $%06x" % (name, addr), "cat": name, "tid": 2}
+        event.update({"ph": "i", "s": "t", "pid": 1,
+                      "ts": cycles / float(mhz), "args": args})
+        out.write(sep + json.dumps(event))
+        sep = ",\n"
+    out.write('\n]}\n')
+
+def main(argv):
+    as_json = False
+    mhz = 8
+    try:
+        opts, args = getopt.getopt(argv[1:], "jm:h", ["json", "help"])
+    except getopt.GetoptError as err:
+        sys.stderr.write("ERROR: %s\n%s" % (err, __doc__))
+        return 1
+    for opt, arg in opts:
+        if opt in ("-j", "--json"):
+            as_json = True
+        elif opt == "-m":
+            mhz = int(arg)
+        else:
+            sys.stderr.write(__doc__)
+            return 0
+    if len(args) != 1 or mhz <= 0:
+        sys.stderr.write(__doc__)
+        return 1
+
+    with open(args[0], "rb") as f:
+        if as_json:
+            print_json(f, sys.stdout, mhz)
+        else:
+            print_text(f, sys.stdout)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))